@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <unicode/uchar.h>
+#include <unicode/utf8.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "olap/rowset/segment_v2/inverted_index/analyzer/basic/basic_analyzer.h"
+
+namespace doris {
+
+#define OLD_IS_IN_RANGE(c, start, end) ((uint32_t)((c) - (start)) <= ((end) - (start)))
+
+#define OLD_IS_CHINESE_CHAR(c)                                                       \
+    (OLD_IS_IN_RANGE(c, 0x4E00, 0x9FFF) || OLD_IS_IN_RANGE(c, 0x3400, 0x4DBF) ||     \
+     OLD_IS_IN_RANGE(c, 0x20000, 0x2A6DF) || OLD_IS_IN_RANGE(c, 0x2A700, 0x2EBEF) || \
+     OLD_IS_IN_RANGE(c, 0x30000, 0x3134A))
+
+// BasicTokenizer::cut before the ascii words were found 16 bytes at a time
+static void old_basic_tokenizer_cut(std::string& buffer, bool lowercase,
+                                    std::vector<std::string_view>& tokens_text) {
+    auto* s = (uint8_t*)buffer.data();
+    int32_t length = buffer.size();
+
+    for (int32_t i = 0; i < length;) {
+        uint8_t firstByte = s[i];
+
+        if (is_alnum(firstByte)) {
+            int32_t start = i;
+            while (i < length) {
+                uint8_t nextByte = s[i];
+                if (!is_alnum(nextByte)) {
+                    break;
+                }
+                if (lowercase) {
+                    s[i] = to_lower(nextByte);
+                } else {
+                    s[i] = nextByte;
+                }
+                i++;
+            }
+            std::string_view token((const char*)(s + start), i - start);
+            tokens_text.emplace_back(token);
+        } else {
+            UChar32 c = U_UNASSIGNED;
+            const int32_t prev_i = i;
+
+            U8_NEXT(s, i, length, c);
+            if (c < 0) {
+                continue;
+            }
+
+            if (OLD_IS_CHINESE_CHAR(c)) {
+                const int32_t len = i - prev_i;
+                tokens_text.emplace_back(reinterpret_cast<const char*>(s + prev_i), len);
+            }
+        }
+    }
+}
+
+static std::vector<std::string> make_log_lines() {
+    std::vector<std::string> lines;
+    for (int i = 0; i < 1000; ++i) {
+        lines.push_back("2024-01-01 12:00:" + std::to_string(i % 60) +
+                        " INFO [RequestHandler-" + std::to_string(i % 32) +
+                        "] GET /api/v1/users/" + std::to_string(i * 7919) +
+                        "/profile?session=AbCdEf0123456789 status=200 latency=" +
+                        std::to_string(i % 500) + "ms user_agent=Mozilla/5.0 请求成功");
+    }
+    return lines;
+}
+
+static void BM_OldBasicTokenizer(benchmark::State& state) {
+    auto lines = make_log_lines();
+    std::string buffer;
+    std::vector<std::string_view> tokens_text;
+    for (auto _ : state) {
+        for (const auto& line : lines) {
+            buffer = line;
+            tokens_text.clear();
+            old_basic_tokenizer_cut(buffer, true, tokens_text);
+            benchmark::DoNotOptimize(tokens_text.data());
+        }
+    }
+}
+
+static void BM_BasicTokenizer(benchmark::State& state) {
+    auto lines = make_log_lines();
+    segment_v2::BasicTokenizer tokenizer(true, false);
+    lucene::util::SStringReader<char> reader;
+    for (auto _ : state) {
+        for (const auto& line : lines) {
+            reader.init(line.data(), line.size(), false);
+            tokenizer.reset(&reader);
+            benchmark::DoNotOptimize(tokenizer);
+        }
+    }
+}
+
+BENCHMARK(BM_OldBasicTokenizer);
+BENCHMARK(BM_BasicTokenizer);
+
+#undef OLD_IS_CHINESE_CHAR
+#undef OLD_IS_IN_RANGE
+
+} // namespace doris
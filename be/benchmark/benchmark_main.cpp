@@ -17,8 +17,13 @@
 
 #include <benchmark/benchmark.h>
 
+#include "basic_tokenizer_benchmark.hpp"
 #include "benchmark_bit_pack.hpp"
 #include "binary_cast_benchmark.hpp"
+#include "column_predicate_benchmark.hpp"
+#include "load_benchmark.hpp"
+#include "local_exchange_block_queue_benchmark.hpp"
+#include "operator_benchmark.hpp"
 #include "vec/core/block.h"
 #include "vec/data_types/data_type.h"
 #include "vec/data_types/data_type_string.h"
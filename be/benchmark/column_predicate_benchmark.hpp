@@ -0,0 +1,103 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "olap/comparison_predicate.h"
+#include "vec/common/assert_cast.h"
+#include "vec/columns/predicate_column.h"
+
+namespace doris {
+
+// rows of one segment iterator batch
+static constexpr uint16_t kPredicateBenchmarkRows = 4064;
+
+// column with values in [0, 100), so `value < selectivity` selects selectivity% of the rows
+static vectorized::MutableColumnPtr make_predicate_benchmark_column() {
+    auto column = vectorized::PredicateColumnType<TYPE_INT>::create();
+    std::default_random_engine e;
+    std::uniform_int_distribution<int32_t> u(0, 99);
+    for (uint16_t i = 0; i < kPredicateBenchmarkRows; i++) {
+        int32_t value = u(e);
+        column->insert_data(reinterpret_cast<const char*>(&value), 0);
+    }
+    return column;
+}
+
+// the branchy loop used before for dense columns
+static void BM_ColumnPredicateScalarSelector(benchmark::State& state) {
+    auto column = make_predicate_benchmark_column();
+    const auto& data =
+            assert_cast<const vectorized::PredicateColumnType<TYPE_INT>&>(*column).get_data();
+    const auto value = static_cast<int32_t>(state.range(0));
+    std::vector<uint16_t> sel(kPredicateBenchmarkRows);
+
+    for (auto _ : state) {
+        uint16_t new_size = 0;
+        for (uint16_t i = 0; i < kPredicateBenchmarkRows; i++) {
+            if (data[i] < value) {
+                sel[new_size++] = i;
+            }
+        }
+        benchmark::DoNotOptimize(new_size);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * kPredicateBenchmarkRows);
+}
+
+static void BM_ColumnPredicateDense(benchmark::State& state) {
+    auto column = make_predicate_benchmark_column();
+    ComparisonPredicateBase<TYPE_INT, PredicateType::LT> predicate(
+            0, static_cast<int32_t>(state.range(0)));
+    std::vector<uint16_t> sel(kPredicateBenchmarkRows);
+
+    for (auto _ : state) {
+        uint16_t new_size = predicate.evaluate(*column, sel.data(), kPredicateBenchmarkRows);
+        benchmark::DoNotOptimize(new_size);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * kPredicateBenchmarkRows);
+}
+
+// every other row is selected already, evaluated through `sel`
+static void BM_ColumnPredicateSparse(benchmark::State& state) {
+    auto column = make_predicate_benchmark_column();
+    ComparisonPredicateBase<TYPE_INT, PredicateType::LT> predicate(
+            0, static_cast<int32_t>(state.range(0)));
+    std::vector<uint16_t> sel(kPredicateBenchmarkRows);
+
+    for (auto _ : state) {
+        uint16_t size = 0;
+        for (uint16_t i = 0; i < kPredicateBenchmarkRows; i += 2) {
+            sel[size++] = i;
+        }
+        uint16_t new_size = predicate.evaluate(*column, sel.data(), size);
+        benchmark::DoNotOptimize(new_size);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * kPredicateBenchmarkRows / 2);
+}
+
+BENCHMARK(BM_ColumnPredicateScalarSelector)->DenseRange(0, 100, 25)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_ColumnPredicateDense)->DenseRange(0, 100, 25)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_ColumnPredicateSparse)->DenseRange(0, 100, 25)->Unit(benchmark::kNanosecond);
+
+} // namespace doris
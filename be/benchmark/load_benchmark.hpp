@@ -0,0 +1,347 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+#include <gen_cpp/AgentService_types.h>
+#include <gen_cpp/Descriptors_types.h>
+#include <gen_cpp/internal_service.pb.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "common/object_pool.h"
+#include "exec/tablet_info.h"
+#include "io/fs/local_file_system.h"
+#include "olap/delta_writer.h"
+#include "olap/memtable_flush_executor.h"
+#include "olap/memtable_memory_limiter.h"
+#include "olap/options.h"
+#include "olap/page_cache.h"
+#include "olap/segment_loader.h"
+#include "olap/storage_engine.h"
+#include "olap/tablet_column_object_pool.h"
+#include "olap/tablet_manager.h"
+#include "olap/tablet_meta.h"
+#include "olap/tablet_schema_cache.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
+#include "runtime/memory/cache_manager.h"
+#include "runtime/thread_context.h"
+#include "util/cpu_info.h"
+#include "util/mem_info.h"
+#include "util/time.h"
+#include "vec/core/block.h"
+
+// End to end benchmarks of the load path of a tablet: DeltaWriter::write into the memtables,
+// flushes on the MemTableFlushExecutor, the segment writing and the rowset commit, on the local
+// file system under ./load_benchmark_data.
+namespace doris {
+
+static constexpr size_t kLoadBenchmarkRows = 1 << 20;
+static constexpr size_t kLoadBenchmarkBatchRows = 4096;
+
+enum LoadBenchmarkKeys { LOAD_DUP_KEYS = 0, LOAD_UNIQUE_KEYS_MOW = 1, LOAD_AGG_KEYS = 2 };
+
+// The storage engine is opened by the first load benchmark and kept for the rest of the run.
+static StorageEngine* load_benchmark_engine() {
+    static StorageEngine* engine = [] {
+        auto* exec_env = ExecEnv::GetInstance();
+        exec_env->init_mem_tracker();
+        CpuInfo::init();
+        MemInfo::init();
+        exec_env->set_cache_manager(CacheManager::create_global_instance());
+        exec_env->set_storage_page_cache(StoragePageCache::create_global_cache(1 << 30, 10, 0));
+        exec_env->set_segment_loader(new SegmentLoader(1000, 1000));
+        exec_env->set_tablet_schema_cache(TabletSchemaCache::create_global_schema_cache(
+                config::tablet_schema_cache_capacity));
+        exec_env->set_tablet_column_object_pool(TabletColumnObjectPool::create_global_column_cache(
+                config::tablet_schema_cache_capacity));
+        exec_env->set_delete_bitmap_agg_cache(
+                DeleteBitmapAggCache::create_instance(config::delete_bitmap_agg_cache_capacity));
+        exec_env->set_memtable_memory_limiter(new MemTableMemoryLimiter());
+
+        char buffer[1024];
+        config::storage_root_path = std::string(getcwd(buffer, sizeof(buffer))) +
+                                    "/load_benchmark_data";
+        static_cast<void>(io::global_local_filesystem()->delete_directory(
+                config::storage_root_path));
+        static_cast<void>(io::global_local_filesystem()->create_directory(
+                config::storage_root_path));
+        EngineOptions options;
+        options.store_paths.emplace_back(config::storage_root_path, -1);
+        auto storage_engine = std::make_unique<StorageEngine>(options);
+        auto* res = storage_engine.get();
+        auto st = storage_engine->open();
+        CHECK(st.ok()) << st;
+        exec_env->set_storage_engine(std::move(storage_engine));
+        return res;
+    }();
+    return engine;
+}
+
+// (k BIGINT, s VARCHAR(64), v0 BIGINT, ..., v<width - 1> BIGINT) of the key model `keys`, with an
+// inverted index on `s` when `inverted_index` is set.
+static void create_load_benchmark_tablet_request(int64_t tablet_id, int64_t keys, int64_t width,
+                                                 bool inverted_index, TCreateTabletReq* request) {
+    request->tablet_id = tablet_id;
+    request->__set_version(1);
+    request->partition_id = 10001;
+    request->tablet_schema.schema_hash = 270068375;
+    request->tablet_schema.short_key_column_count = 1;
+    request->tablet_schema.keys_type = keys == LOAD_DUP_KEYS         ? TKeysType::DUP_KEYS
+                                       : keys == LOAD_UNIQUE_KEYS_MOW ? TKeysType::UNIQUE_KEYS
+                                                                      : TKeysType::AGG_KEYS;
+    request->tablet_schema.storage_type = TStorageType::COLUMN;
+    request->__set_storage_format(TStorageFormat::V2);
+    request->__set_enable_unique_key_merge_on_write(keys == LOAD_UNIQUE_KEYS_MOW);
+
+    TColumn k;
+    k.column_name = "k";
+    k.__set_is_key(true);
+    k.column_type.type = TPrimitiveType::BIGINT;
+    request->tablet_schema.columns.push_back(k);
+
+    TColumn s;
+    s.column_name = "s";
+    s.__set_is_key(false);
+    s.column_type.type = TPrimitiveType::VARCHAR;
+    s.column_type.__set_len(64);
+    if (keys != LOAD_DUP_KEYS) {
+        s.__set_aggregation_type(TAggregationType::REPLACE);
+    }
+    request->tablet_schema.columns.push_back(s);
+
+    for (int64_t i = 0; i < width; i++) {
+        TColumn v;
+        v.column_name = "v" + std::to_string(i);
+        v.__set_is_key(false);
+        v.column_type.type = TPrimitiveType::BIGINT;
+        if (keys != LOAD_DUP_KEYS) {
+            v.__set_aggregation_type(keys == LOAD_AGG_KEYS ? TAggregationType::SUM
+                                                           : TAggregationType::REPLACE);
+        }
+        request->tablet_schema.columns.push_back(v);
+    }
+
+    if (inverted_index) {
+        TOlapTableIndex index;
+        index.index_id = 1;
+        index.index_name = "s_index";
+        index.index_type = TIndexType::INVERTED;
+        index.columns.emplace_back("s");
+        request->tablet_schema.__set_indexes({index});
+    }
+}
+
+static TDescriptorTable create_load_benchmark_descriptor_table(int64_t width) {
+    TDescriptorTableBuilder dtb;
+    TTupleDescriptorBuilder tuple_builder;
+    int column_pos = 0;
+    tuple_builder.add_slot(TSlotDescriptorBuilder()
+                                   .type(TYPE_BIGINT)
+                                   .column_name("k")
+                                   .column_pos(column_pos++)
+                                   .nullable(false)
+                                   .build());
+    tuple_builder.add_slot(TSlotDescriptorBuilder()
+                                   .string_type(64)
+                                   .column_name("s")
+                                   .column_pos(column_pos++)
+                                   .nullable(false)
+                                   .build());
+    for (int64_t i = 0; i < width; i++) {
+        tuple_builder.add_slot(TSlotDescriptorBuilder()
+                                       .type(TYPE_BIGINT)
+                                       .column_name("v" + std::to_string(i))
+                                       .column_pos(column_pos++)
+                                       .nullable(false)
+                                       .build());
+    }
+    tuple_builder.build(&dtb);
+    return dtb.desc_tbl();
+}
+
+// Keys are drawn from [0, kLoadBenchmarkRows), so about a third of the rows of a load update an
+// earlier row of the same key on the unique and aggregate models.
+static std::vector<vectorized::Block> make_load_benchmark_blocks(const TupleDescriptor* tuple_desc,
+                                                                 size_t* bytes) {
+    std::default_random_engine e(42);
+    std::uniform_int_distribution<int64_t> u(0, kLoadBenchmarkRows - 1);
+    std::vector<vectorized::Block> blocks;
+    *bytes = 0;
+    for (size_t rows = 0; rows < kLoadBenchmarkRows; rows += kLoadBenchmarkBatchRows) {
+        vectorized::Block block;
+        for (const auto& slot_desc : tuple_desc->slots()) {
+            block.insert(vectorized::ColumnWithTypeAndName(slot_desc->get_empty_mutable_column(),
+                                                           slot_desc->type(),
+                                                           slot_desc->col_name()));
+        }
+        auto columns = block.mutate_columns();
+        for (size_t i = 0; i < kLoadBenchmarkBatchRows; i++) {
+            int64_t key = u(e);
+            columns[0]->insert_data(reinterpret_cast<const char*>(&key), sizeof(key));
+            auto str = "value_" + std::to_string(key % 1000);
+            columns[1]->insert_data(str.data(), str.size());
+            for (size_t c = 2; c < columns.size(); c++) {
+                int64_t value = key * static_cast<int64_t>(c);
+                columns[c]->insert_data(reinterpret_cast<const char*>(&value), sizeof(value));
+            }
+        }
+        block.set_columns(std::move(columns));
+        *bytes += block.bytes();
+        blocks.emplace_back(std::move(block));
+    }
+    return blocks;
+}
+
+// {keys model, number of BIGINT value columns, inverted index on the string column}
+//
+// Reported per load of kLoadBenchmarkRows rows, besides the time: `write_ms` of DeltaWriter::write
+// on the caller thread, `to_block_ms` and `segment_write_ms` of the flush threads, `commit_ms` of
+// close, build_rowset, the delete bitmap of merge-on-write and commit_txn, `peak_memtable_bytes`
+// of the memtables of the writer, `peak_thread_bytes` allocated on the caller thread, and the
+// `disk_bytes` of the segments.
+static void BM_DeltaWriterLoad(benchmark::State& state) {
+    SCOPED_INIT_THREAD_CONTEXT();
+    auto* engine = load_benchmark_engine();
+    static int64_t next_tablet_id = 60001;
+    const int64_t tablet_id = next_tablet_id++;
+    const int64_t width = state.range(1);
+    TCreateTabletReq request;
+    create_load_benchmark_tablet_request(tablet_id, state.range(0), width, state.range(2) != 0,
+                                         &request);
+    RuntimeProfile create_tablet_profile("CreateTablet");
+    auto st = engine->create_tablet(request, &create_tablet_profile);
+    if (!st.ok()) {
+        state.SkipWithError(st.to_string().c_str());
+        return;
+    }
+
+    ObjectPool obj_pool;
+    DescriptorTbl* desc_tbl = nullptr;
+    static_cast<void>(
+            DescriptorTbl::create(&obj_pool, create_load_benchmark_descriptor_table(width),
+                                  &desc_tbl));
+    TupleDescriptor* tuple_desc = desc_tbl->get_tuple_descriptor(0);
+    size_t bytes = 0;
+    auto blocks = make_load_benchmark_blocks(tuple_desc, &bytes);
+    DorisVector<uint32_t> row_idxs(kLoadBenchmarkBatchRows);
+    std::iota(row_idxs.begin(), row_idxs.end(), 0U);
+
+    int64_t txn_id = 20001;
+    double write_ns = 0;
+    double to_block_ns = 0;
+    double segment_write_ns = 0;
+    double commit_ns = 0;
+    double disk_bytes = 0;
+    int64_t peak_memtable_bytes = 0;
+    int64_t peak_thread_bytes = 0;
+    for (auto _ : state) {
+        PUniqueId load_id;
+        load_id.set_hi(0);
+        load_id.set_lo(txn_id);
+        WriteRequest write_req;
+        write_req.tablet_id = tablet_id;
+        write_req.schema_hash = request.tablet_schema.schema_hash;
+        write_req.txn_id = txn_id++;
+        write_req.partition_id = request.partition_id;
+        write_req.load_id = load_id;
+        write_req.tuple_desc = tuple_desc;
+        write_req.slots = &(tuple_desc->slots());
+        write_req.is_high_priority = false;
+        write_req.table_schema_param = std::make_shared<OlapTableSchemaParam>();
+        RuntimeProfile profile("LoadChannels");
+        DeltaWriter delta_writer(*engine, write_req, &profile, TUniqueId {});
+
+        int64_t thread_bytes = 0;
+        {
+            SCOPED_PEAK_MEM(&thread_bytes);
+            int64_t start_ns = MonotonicNanos();
+            for (const auto& block : blocks) {
+                st = delta_writer.write(&block, row_idxs);
+                if (!st.ok()) {
+                    break;
+                }
+                peak_memtable_bytes = std::max(
+                        peak_memtable_bytes,
+                        delta_writer._memtable_writer->active_memtable_mem_consumption() +
+                                delta_writer.mem_consumption(MemType::WRITE_FINISHED) +
+                                delta_writer.mem_consumption(MemType::FLUSH));
+            }
+            write_ns += static_cast<double>(MonotonicNanos() - start_ns);
+        }
+        peak_thread_bytes = std::max(peak_thread_bytes, thread_bytes);
+
+        int64_t start_ns = MonotonicNanos();
+        if (st.ok()) {
+            st = delta_writer.close();
+        }
+        if (st.ok()) {
+            st = delta_writer.wait_flush();
+        }
+        if (st.ok()) {
+            st = delta_writer.build_rowset();
+        }
+        if (st.ok()) {
+            st = delta_writer.submit_calc_delete_bitmap_task();
+        }
+        if (st.ok()) {
+            st = delta_writer.wait_calc_delete_bitmap();
+        }
+        if (st.ok()) {
+            st = delta_writer.commit_txn(PSlaveTabletNodes());
+        }
+        if (!st.ok()) {
+            state.SkipWithError(st.to_string().c_str());
+            break;
+        }
+        commit_ns += static_cast<double>(MonotonicNanos() - start_ns);
+        const auto& flush_stats = delta_writer._memtable_writer->get_flush_token_stats();
+        to_block_ns += static_cast<double>(flush_stats.flush_to_block_time_ns);
+        segment_write_ns += static_cast<double>(flush_stats.flush_write_time_ns);
+        disk_bytes += static_cast<double>(flush_stats.flush_disk_size_bytes);
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * kLoadBenchmarkRows);
+    state.SetBytesProcessed(int64_t(state.iterations()) * bytes);
+    state.counters["write_ms"] =
+            benchmark::Counter(write_ns / 1e6, benchmark::Counter::kAvgIterations);
+    state.counters["to_block_ms"] =
+            benchmark::Counter(to_block_ns / 1e6, benchmark::Counter::kAvgIterations);
+    state.counters["segment_write_ms"] =
+            benchmark::Counter(segment_write_ns / 1e6, benchmark::Counter::kAvgIterations);
+    state.counters["commit_ms"] =
+            benchmark::Counter(commit_ns / 1e6, benchmark::Counter::kAvgIterations);
+    state.counters["disk_bytes"] =
+            benchmark::Counter(disk_bytes, benchmark::Counter::kAvgIterations);
+    state.counters["peak_memtable_bytes"] = static_cast<double>(peak_memtable_bytes);
+    state.counters["peak_thread_bytes"] = static_cast<double>(peak_thread_bytes);
+
+    static_cast<void>(engine->tablet_manager()->drop_tablet(tablet_id, request.replica_id, false));
+}
+
+BENCHMARK(BM_DeltaWriterLoad)
+        ->ArgsProduct({{LOAD_DUP_KEYS, LOAD_UNIQUE_KEYS_MOW, LOAD_AGG_KEYS}, {4, 32}, {0, 1}})
+        ->Unit(benchmark::kMillisecond);
+
+} // namespace doris
@@ -0,0 +1,120 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "pipeline/local_exchange/local_exchanger.h"
+
+namespace doris::pipeline {
+
+// Mimics how local exchange sinks push blocks into the data queue of one source: one
+// queue per channel, a mutex per channel and a source dependency to wake up.
+struct BlockQueueBenchContext {
+    static constexpr int NUM_CHANNELS = 8;
+    std::vector<BlockQueue<int64_t>> queues;
+    std::vector<std::unique_ptr<std::mutex>> locks;
+    std::unique_ptr<std::atomic<bool>[]> ready;
+    std::atomic<int64_t> signals = 0;
+
+    BlockQueueBenchContext()
+            : queues(NUM_CHANNELS), ready(std::make_unique<std::atomic<bool>[]>(NUM_CHANNELS)) {
+        for (int i = 0; i < NUM_CHANNELS; i++) {
+            locks.push_back(std::make_unique<std::mutex>());
+            ready[i] = false;
+        }
+    }
+
+    void set_ready(int channel_id) {
+        ready[channel_id] = true;
+        signals++;
+    }
+
+    // Drain the queue like a source and block itself when it is empty.
+    void consume(int channel_id) {
+        int64_t item;
+        while (queues[channel_id].try_dequeue(item)) {
+            benchmark::DoNotOptimize(item);
+        }
+        std::unique_lock l(*locks[channel_id]);
+        ready[channel_id] = false;
+    }
+};
+
+static BlockQueueBenchContext* g_block_queue_ctx = nullptr;
+
+// Previous behaviour: take the channel lock and signal the source for every block.
+static void BM_BlockQueue_LockedEnqueue(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        g_block_queue_ctx = new BlockQueueBenchContext();
+    }
+    int64_t i = 0;
+    for (auto _ : state) {
+        auto& ctx = *g_block_queue_ctx;
+        int channel_id = int(i % BlockQueueBenchContext::NUM_CHANNELS);
+        {
+            std::unique_lock l(*ctx.locks[channel_id]);
+            ctx.queues[channel_id].enqueue(i);
+            ctx.set_ready(channel_id);
+        }
+        if (state.thread_index() == 0 && i % 64 == 0) {
+            ctx.consume(channel_id);
+        }
+        i++;
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        state.counters["signals"] = double(g_block_queue_ctx->signals);
+        delete g_block_queue_ctx;
+        g_block_queue_ctx = nullptr;
+    }
+}
+
+// Current behaviour: lock free enqueue, only signal the source if it is blocked.
+static void BM_BlockQueue_LockFreeEnqueue(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        g_block_queue_ctx = new BlockQueueBenchContext();
+    }
+    int64_t i = 0;
+    for (auto _ : state) {
+        auto& ctx = *g_block_queue_ctx;
+        int channel_id = int(i % BlockQueueBenchContext::NUM_CHANNELS);
+        ctx.queues[channel_id].enqueue(i);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!ctx.ready[channel_id]) {
+            ctx.set_ready(channel_id);
+        }
+        if (state.thread_index() == 0 && i % 64 == 0) {
+            ctx.consume(channel_id);
+        }
+        i++;
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        state.counters["signals"] = double(g_block_queue_ctx->signals);
+        delete g_block_queue_ctx;
+        g_block_queue_ctx = nullptr;
+    }
+}
+
+BENCHMARK(BM_BlockQueue_LockedEnqueue)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_BlockQueue_LockFreeEnqueue)->ThreadRange(1, 64)->UseRealTime();
+
+} // namespace doris::pipeline
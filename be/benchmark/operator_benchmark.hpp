@@ -0,0 +1,155 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+#include <gen_cpp/data.pb.h>
+#include <gen_cpp/segment_v2.pb.h>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "agent/be_exec_version_manager.h"
+#include "pipeline/common/agg_utils.h"
+#include "vec/common/assert_cast.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/core/block.h"
+#include "vec/core/sort_block.h"
+#include "vec/core/sort_description.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+// Benchmarks of the building blocks of operators, over synthetic blocks. Run with
+// `--benchmark_format=json --benchmark_out=<file>` to keep the results for regression tracking.
+namespace doris::vectorized {
+
+static constexpr size_t kOperatorBenchmarkRows = 65536;
+
+// Block of (k BIGINT, s STRING). `k` has `cardinality` distinct values, with skew 0 they are
+// uniform, the larger skew is the more rows go to the smallest keys.
+static Block make_operator_benchmark_block(size_t rows, int64_t cardinality, int64_t skew) {
+    auto key_column = ColumnInt64::create();
+    auto str_column = ColumnString::create();
+    std::default_random_engine e(42);
+    std::uniform_real_distribution<double> u(0, 1);
+    for (size_t i = 0; i < rows; i++) {
+        auto key = static_cast<int64_t>(std::pow(u(e), 1.0 + static_cast<double>(skew)) *
+                                        static_cast<double>(cardinality));
+        key_column->insert_value(key);
+        auto str = "value_" + std::to_string(key);
+        str_column->insert_data(str.data(), str.size());
+    }
+    Block block;
+    block.insert({std::move(key_column), std::make_shared<DataTypeInt64>(), "k"});
+    block.insert({std::move(str_column), std::make_shared<DataTypeString>(), "s"});
+    return block;
+}
+
+// emplace of the group by keys into the hash table of aggregation
+static void BM_AggHashMapEmplace(benchmark::State& state) {
+    auto block = make_operator_benchmark_block(kOperatorBenchmarkRows, state.range(0),
+                                               state.range(1));
+    const auto& keys =
+            assert_cast<const ColumnInt64&>(*block.get_by_position(0).column).get_data();
+    char place = 0;
+
+    for (auto _ : state) {
+        AggData<UInt64> hash_map;
+        for (auto key : keys) {
+            AggData<UInt64>::LookupResult it;
+            bool inserted = false;
+            hash_map.emplace(static_cast<UInt64>(key), it, inserted);
+            if (inserted) {
+                it->second = &place;
+            }
+        }
+        benchmark::DoNotOptimize(hash_map.size());
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * kOperatorBenchmarkRows);
+}
+
+static void BM_SortBlock(benchmark::State& state) {
+    auto block = make_operator_benchmark_block(kOperatorBenchmarkRows, state.range(0),
+                                               state.range(1));
+    SortDescription description {SortColumnDescription(0, 1, 1)};
+    const auto limit = static_cast<UInt64>(state.range(2));
+
+    for (auto _ : state) {
+        Block dest_block = block.clone_empty();
+        sort_block(block, dest_block, description, limit);
+        benchmark::DoNotOptimize(dest_block);
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * kOperatorBenchmarkRows);
+}
+
+// filter the string column with `selectivity`% of the rows selected
+static void BM_ColumnStringFilter(benchmark::State& state) {
+    auto block = make_operator_benchmark_block(kOperatorBenchmarkRows, kOperatorBenchmarkRows, 0);
+    const auto& column = *block.get_by_position(1).column;
+    IColumn::Filter filter(kOperatorBenchmarkRows);
+    std::default_random_engine e(42);
+    std::uniform_int_distribution<int64_t> u(0, 99);
+    for (size_t i = 0; i < kOperatorBenchmarkRows; i++) {
+        filter[i] = u(e) < state.range(0);
+    }
+
+    for (auto _ : state) {
+        auto result = column.filter(filter, -1);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * kOperatorBenchmarkRows);
+}
+
+// serialize a block as the exchange sink does, range(0) is the CompressionTypePB
+static void BM_BlockSerialize(benchmark::State& state) {
+    auto block = make_operator_benchmark_block(kOperatorBenchmarkRows, 1024, 0);
+    const auto compression_type = static_cast<segment_v2::CompressionTypePB>(state.range(0));
+    size_t uncompressed_bytes = 0;
+    size_t compressed_bytes = 0;
+
+    for (auto _ : state) {
+        PBlock pblock;
+        auto st = block.serialize(BeExecVersionManager::get_newest_version(), &pblock,
+                                  &uncompressed_bytes, &compressed_bytes, compression_type);
+        if (!st.ok()) {
+            state.SkipWithError(st.to_string().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(pblock);
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * uncompressed_bytes);
+    state.counters["compressed_bytes"] = static_cast<double>(compressed_bytes);
+}
+
+// {cardinality, skew}
+BENCHMARK(BM_AggHashMapEmplace)
+        ->ArgsProduct({{16, 4096, 65536}, {0, 2}})
+        ->Unit(benchmark::kMicrosecond);
+// {cardinality, skew, limit}
+BENCHMARK(BM_SortBlock)
+        ->ArgsProduct({{16, 65536}, {0, 2}, {0, 100}})
+        ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ColumnStringFilter)->DenseRange(0, 100, 25)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BlockSerialize)
+        ->Arg(segment_v2::CompressionTypePB::NO_COMPRESSION)
+        ->Arg(segment_v2::CompressionTypePB::LZ4)
+        ->Arg(segment_v2::CompressionTypePB::ZSTD)
+        ->Unit(benchmark::kMicrosecond);
+
+} // namespace doris::vectorized
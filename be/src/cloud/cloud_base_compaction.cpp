@@ -435,6 +435,10 @@ Status CloudBaseCompaction::modify_rowsets() {
                                                     stats.num_rows(), stats.data_size());
         }
     }
+    if (output_rowset_delete_bitmap) {
+        // out of the header lock, the output rowset is visible already
+        _tablet->tablet_meta()->delete_bitmap().update_agg_cache(*output_rowset_delete_bitmap);
+    }
     return Status::OK();
 }
 
@@ -392,6 +392,10 @@ Status CloudCumulativeCompaction::modify_rowsets() {
                                                     stats.num_rows(), stats.data_size());
         }
     }
+    if (output_rowset_delete_bitmap) {
+        // out of the header lock, the output rowset is visible already
+        _tablet->tablet_meta()->delete_bitmap().update_agg_cache(*output_rowset_delete_bitmap);
+    }
     // agg delete bitmap for pre rowsets
     if (config::enable_agg_and_remove_pre_rowsets_delete_bitmap &&
         _tablet->keys_type() == KeysType::UNIQUE_KEYS &&
@@ -89,8 +89,19 @@ void CloudInternalServiceImpl::get_file_cache_meta_by_tablet_id(
                 auto* cache = io::FileCacheFactory::instance()->get_by_path(cache_key);
 
                 auto segments_meta = cache->get_hot_blocks_meta(cache_key);
+                FileCacheBlockMeta* last_meta = nullptr;
                 for (const auto& tuple : segments_meta) {
+                    // Coalesce adjacent blocks of the same kind, so the peer downloads them
+                    // with one larger read instead of one remote read per block.
+                    if (last_meta != nullptr &&
+                        last_meta->offset() + last_meta->size() == std::get<0>(tuple) &&
+                        last_meta->cache_type() == cache_type_to_pb(std::get<2>(tuple)) &&
+                        last_meta->expiration_time() == std::get<3>(tuple)) {
+                        last_meta->set_size(last_meta->size() + std::get<1>(tuple));
+                        continue;
+                    }
                     FileCacheBlockMeta* meta = response->add_file_cache_block_metas();
+                    last_meta = meta;
                     meta->set_tablet_id(tablet_id);
                     meta->set_rowset_id(rowset_id);
                     meta->set_segment_id(segment_id);
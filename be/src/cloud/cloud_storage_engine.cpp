@@ -256,6 +256,9 @@ void CloudStorageEngine::stop() {
     if (_cumu_compaction_thread_pool) {
         _cumu_compaction_thread_pool->shutdown();
     }
+    if (_value_column_group_thread_pool) {
+        _value_column_group_thread_pool->shutdown();
+    }
     LOG(INFO) << "Cloud storage engine is stopped.";
 
     if (_calc_tablet_delete_bitmap_task_thread_pool) {
@@ -318,6 +321,12 @@ Status CloudStorageEngine::start_bg_threads(std::shared_ptr<WorkloadGroup> wg_sp
                             .set_min_threads(cumu_thread_num)
                             .set_max_threads(cumu_thread_num)
                             .build(&_cumu_compaction_thread_pool));
+    if (config::vertical_compaction_value_group_thread_num > 0) {
+        RETURN_IF_ERROR(ThreadPoolBuilder("ValueColumnGroupThreadPool")
+                                .set_min_threads(config::vertical_compaction_value_group_thread_num)
+                                .set_max_threads(config::vertical_compaction_value_group_thread_num)
+                                .build(&_value_column_group_thread_pool));
+    }
     RETURN_IF_ERROR(Thread::create(
             "StorageEngine", "compaction_tasks_producer_thread",
             [this]() { this->_compaction_tasks_producer_callback(); },
@@ -982,6 +991,8 @@ Status CloudStorageEngine::submit_compaction_task(const CloudTabletSPtr& tablet,
 }
 
 void CloudStorageEngine::_lease_compaction_thread_callback() {
+    // job -> lease rounds since its last lease
+    std::unordered_map<const void*, int> rounds_since_lease;
     while (!_stop_background_threads_latch.wait_for(
             std::chrono::seconds(config::lease_compaction_interval_seconds))) {
         std::vector<std::shared_ptr<CloudFullCompaction>> full_compactions;
@@ -1012,18 +1023,38 @@ void CloudStorageEngine::_lease_compaction_thread_callback() {
             }
         }
         // TODO(plat1ko): Support batch lease rpc
+        // A job seen for the first time is leased at once, then every `renew_rounds` rounds.
+        // The lease lasts 4 rounds, so at most 3 rounds may be skipped.
+        int renew_rounds = std::clamp(config::lease_compaction_renew_rounds, 1, 3);
+        std::unordered_map<const void*, int> next_rounds_since_lease;
+        auto need_lease = [&](const void* job) {
+            auto it = rounds_since_lease.find(job);
+            int rounds = it == rounds_since_lease.end() ? renew_rounds : it->second + 1;
+            bool lease = rounds >= renew_rounds;
+            next_rounds_since_lease[job] = lease ? 0 : rounds;
+            return lease;
+        };
         for (auto& stop_token : compation_stop_tokens) {
-            stop_token->do_lease();
+            if (need_lease(stop_token.get())) {
+                stop_token->do_lease();
+            }
         }
         for (auto& comp : full_compactions) {
-            comp->do_lease();
+            if (need_lease(comp.get())) {
+                comp->do_lease();
+            }
         }
         for (auto& comp : cumu_compactions) {
-            comp->do_lease();
+            if (need_lease(comp.get())) {
+                comp->do_lease();
+            }
         }
         for (auto& comp : base_compactions) {
-            comp->do_lease();
+            if (need_lease(comp.get())) {
+                comp->do_lease();
+            }
         }
+        rounds_since_lease = std::move(next_rounds_since_lease);
     }
 }
 
@@ -42,6 +42,17 @@ void TabletHotspot::count(const BaseTablet& tablet) {
     counter->cur_counter++;
 }
 
+bool TabletHotspot::is_recently_accessed(int64_t tablet_id, int64_t seconds) {
+    auto& slot = _tablets_hotspot[tablet_id % s_slot_size];
+    std::lock_guard lock(slot.mtx);
+    auto iter = slot.map.find(tablet_id);
+    if (iter == slot.map.end()) {
+        return false;
+    }
+    return std::chrono::system_clock::now() - iter->second->last_access_time <
+           std::chrono::seconds(seconds);
+}
+
 TabletHotspot::TabletHotspot() {
     _counter_thread = std::thread(&TabletHotspot::make_dot_point, this);
 }
@@ -69,6 +69,8 @@ public:
     ~TabletHotspot();
     // When query the tablet, count it
     void count(const BaseTablet& tablet);
+    // Whether the tablet has been queried within the last `seconds` seconds
+    bool is_recently_accessed(int64_t tablet_id, int64_t seconds);
     void get_top_n_hot_partition(std::vector<THotTableMessage>* hot_tables);
 
 private:
@@ -83,6 +83,9 @@ DECLARE_mInt64(cumu_compaction_interval_s);
 
 DECLARE_mInt32(compaction_timeout_seconds);
 DECLARE_mInt32(lease_compaction_interval_seconds);
+// Renew the lease of each compaction job every N lease rounds (clamped to [1, 3]). A lease is
+// valid for 4 rounds, so renewing less often cuts lease rpcs to meta-service.
+DECLARE_mInt32(lease_compaction_renew_rounds);
 DECLARE_mBool(enable_parallel_cumu_compaction);
 DECLARE_mDouble(base_compaction_thread_num_factor);
 DECLARE_mDouble(cumu_compaction_thread_num_factor);
@@ -138,12 +138,23 @@ DEFINE_Double(schema_change_mem_limit_frac, "0.6");
 // memory greater than 16 GB.
 DEFINE_mInt64(mmap_threshold, "134217728"); // bytes
 
+// Allocator allocations smaller than this are tracked but skip the process and query memory
+// limit checks, which are comparatively expensive for short-lived batch-sized buffers.
+// Set to 0 to check every allocation.
+DEFINE_mInt64(allocator_check_limit_min_bytes, "65536");
+
+// Advise transparent huge pages (madvise MADV_HUGEPAGE) for Allocator buffers of at least 2MB,
+// such as hash table buckets and arena chunks. Takes effect when THP is in `madvise` mode.
+DEFINE_mBool(enable_huge_page_for_large_alloc, "false");
+
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
 DEFINE_mInt32(hash_table_double_grow_degree, "31");
 
 DEFINE_mInt32(max_fill_rate, "2");
 
+DEFINE_mInt64(agg_two_level_hash_table_threshold, "1048576");
+
 DEFINE_mInt32(double_resize_threshold, "23");
 
 // The maximum low water mark of the system `/proc/meminfo/MemAvailable`, Unit byte, default -1.
@@ -225,6 +236,9 @@ DEFINE_Int32(delete_worker_count, "3");
 DEFINE_Int32(alter_tablet_worker_count, "3");
 // the count of thread to alter index
 DEFINE_Int32(alter_index_worker_count, "3");
+// the count of thread shared by all alter index tasks to build the indexes of a segment in
+// parallel, 0 means the indexes are built one by one in the alter index thread
+DEFINE_Int32(index_build_thread_num, "0");
 // the count of thread to clone
 DEFINE_Int32(clone_worker_count, "3");
 // the count of thread to clone
@@ -257,6 +271,7 @@ DEFINE_mInt32(download_low_speed_limit_kbps, "50");
 DEFINE_mInt32(download_low_speed_time, "300");
 // whether to download small files in batch
 DEFINE_mBool(enable_batch_download, "true");
+DEFINE_mInt32(clone_download_batch_parallelism, "1");
 // whether to check md5sum when download
 DEFINE_mBool(enable_download_md5sum_check, "false");
 // download binlog meta timeout, default 30s
@@ -293,6 +308,20 @@ DEFINE_Int32(be_service_threads, "64");
 // The pipeline task has a high concurrency, therefore reducing its report frequency
 DEFINE_mInt32(pipeline_status_report_interval, "10");
 DEFINE_mInt32(pipeline_task_exec_time_slice, "100");
+// Scale the time slice of a pipeline task by the number of tasks waiting on its core: up to
+// twice the slice when none waits, down to a quarter when many do.
+DEFINE_mBool(enable_adaptive_pipeline_task_time_slice, "false");
+DEFINE_mBool(enable_pipeline_task_random_steal, "true");
+// Level pipeline tasks in the multilevel feedback queue by the CPU time of their whole query
+// instead of their own runtime, so short interactive queries stay ahead of wide long ones.
+DEFINE_mBool(pipeline_task_queue_level_by_query, "false");
+DEFINE_Bool(enable_numa_aware_pipeline_scheduling, "false");
+DEFINE_mBool(enable_hash_join_probe_prefetch, "true");
+DEFINE_mBool(enable_hash_join_clustered_build, "true");
+DEFINE_mInt64(hash_join_clustered_build_min_rows, "4194304");
+DEFINE_mBool(enable_streaming_agg_adaptive_passthrough, "true");
+DEFINE_mInt32(streaming_agg_adaptive_hysteresis_windows, "3");
+DEFINE_mInt64(streaming_agg_passthrough_retry_rows, "1048576");
 // number of scanner thread pool size for olap table
 // and the min thread num of remote scanner thread pool
 DEFINE_Int32(doris_scanner_thread_pool_thread_num, "-1");
@@ -308,6 +337,9 @@ DEFINE_Int32(remote_split_source_batch_size, "1000");
 DEFINE_Int32(doris_max_remote_scanner_thread_pool_thread_num, "-1");
 // number of olap scanner thread pool queue size
 DEFINE_Int32(doris_scanner_thread_pool_queue_size, "102400");
+// Dispatch queued scan tasks round-robin across queries instead of in submission order, so a
+// large scan cannot delay the scan tasks of small queries sharing the same scanner pool.
+DEFINE_mBool(enable_fair_scan_task_dispatch, "false");
 // default thrift client connect timeout(in seconds)
 DEFINE_mInt32(thrift_connect_timeout_seconds, "3");
 DEFINE_mInt32(fetch_rpc_timeout_seconds, "30");
@@ -391,13 +423,32 @@ DEFINE_Bool(disable_pk_storage_page_cache, "false");
 DEFINE_String(pk_storage_page_cache_limit, "10%");
 // data page size for primary key index
 DEFINE_Int32(primary_key_data_page_size, "32768");
+DEFINE_Bool(enable_pk_index_fence_prefixes, "true");
 
 DEFINE_mInt32(data_page_cache_stale_sweep_time_sec, "300");
 DEFINE_mInt32(index_page_cache_stale_sweep_time_sec, "600");
 DEFINE_mInt32(pk_index_page_cache_stale_sweep_time_sec, "600");
+DEFINE_Bool(enable_data_page_cache_tiny_lfu_admission, "false");
+DEFINE_Bool(enable_index_page_cache_tiny_lfu_admission, "false");
+DEFINE_Bool(enable_pk_index_page_cache_tiny_lfu_admission, "false");
+DEFINE_String(decoded_page_cache_limit, "0");
+DEFINE_mInt32(decoded_page_cache_stale_sweep_time_sec, "300");
 
 DEFINE_Bool(enable_low_cardinality_optimize, "true");
 DEFINE_Bool(enable_low_cardinality_cache_code, "true");
+DEFINE_mBool(enable_segment_iterator_staged_predicate_read, "true");
+DEFINE_mBool(enable_late_arrival_runtime_filter_zone_map_pruning, "true");
+DEFINE_mBool(enable_late_arrival_runtime_filter_row_group_pruning, "true");
+DEFINE_mBool(enable_parallel_scan_page_aligned_split, "true");
+DEFINE_mBool(enable_segment_remote_page_prefetch, "false");
+DEFINE_mInt64(segment_remote_page_prefetch_merge_distance_bytes, "1048576");
+DEFINE_mInt64(segment_remote_page_prefetch_max_read_bytes, "8388608");
+DEFINE_mBool(enable_compaction_remote_page_prefetch, "false");
+DEFINE_mInt64(compaction_remote_page_prefetch_bytes_per_segment, "67108864");
+DEFINE_mBool(enable_adaptive_column_encoding, "false");
+DEFINE_mDouble(adaptive_column_encoding_min_space_saving, "0.2");
+DEFINE_mBool(enable_frame_of_reference_min_delta, "false");
+DEFINE_mBool(enable_dict_page_fsst_fallback, "false");
 
 // be policy
 // whether check compaction checksum
@@ -414,6 +465,11 @@ DEFINE_mInt32(vertical_compaction_num_columns_per_group, "5");
 DEFINE_Int32(vertical_compaction_max_row_source_memory_mb, "1024");
 // In vertical compaction, max dest segment file size
 DEFINE_mInt64(vertical_compaction_max_segment_size, "1073741824");
+// In vertical compaction, the count of thread shared by all compactions to merge value column
+// groups ahead of the group being written, 0 means the groups are merged one by one
+DEFINE_Int32(vertical_compaction_value_group_thread_num, "0");
+// In vertical compaction, max memory of the blocks merged ahead by one compaction
+DEFINE_mInt64(vertical_compaction_value_group_prefetch_bytes, "268435456");
 
 // If enabled, segments will be flushed column by column
 DEFINE_mBool(enable_vertical_segment_writer, "true");
@@ -470,6 +526,13 @@ DEFINE_mInt32(multi_get_max_threads, "10");
 // The upper limit of "permits" held by all compaction tasks. This config can be set to limit memory consumption for compaction.
 DEFINE_mInt64(total_permits_for_compaction_score, "1000000");
 
+// The bytes per second compaction can read from and write to one data dir, 0 means no limit.
+// Cumulative compaction goes before base compaction, which goes before cold data compaction.
+DEFINE_mInt64(compaction_io_bytes_per_second_per_disk, "0");
+// When the average latency of the other reads of a data dir goes over this, the compaction io
+// limit of the data dir is lowered until it does not, 0 means the limit is fixed
+DEFINE_mInt64(compaction_io_query_read_latency_threshold_us, "20000");
+
 // sleep interval in ms after generated compaction tasks
 DEFINE_mInt32(generate_compaction_tasks_interval_ms, "100");
 
@@ -520,6 +583,7 @@ DEFINE_mInt64(pick_rowset_to_compact_interval_sec, "86400");
 DEFINE_mBool(enable_compaction_priority_scheduling, "true");
 DEFINE_mInt32(low_priority_compaction_task_num_per_disk, "2");
 DEFINE_mInt32(low_priority_compaction_score_threshold, "200");
+DEFINE_mDouble(compaction_read_amplification_weight, "0");
 
 // Thread count to do tablet meta checkpoint, -1 means use the data directories count.
 DEFINE_Int32(max_meta_checkpoint_threads, "-1");
@@ -587,6 +651,7 @@ DEFINE_mInt64(streaming_load_max_mb, "102400");
 // Therefore, it is necessary to limit the maximum number of
 // such data when using stream load to prevent excessive memory consumption.
 DEFINE_mInt64(streaming_load_json_max_mb, "100");
+DEFINE_mInt64(streaming_load_pipe_max_buffered_bytes, "16777216");
 // the alive time of a TabletsChannel.
 // If the channel does not receive any data till this time,
 // the channel will be removed.
@@ -664,6 +729,15 @@ DEFINE_mInt64(write_buffer_size, "209715200");
 DEFINE_mInt64(write_buffer_size_for_agg, "419430400");
 // max parallel flush task per memtable writer
 DEFINE_mInt32(memtable_flush_running_count_limit, "2");
+// Sort the rows of a memtable by the normalized keys of the key columns with radix sort,
+// only the rows with equal normalized keys are compared column by column.
+DEFINE_mBool(enable_memtable_normalized_key_sort, "true");
+// Aggregate the rows with the same keys of an aggregate key or merge-on-read unique key
+// memtable in a hash table when they are inserted, so that fewer rows are sorted.
+DEFINE_mBool(enable_memtable_pre_aggregation, "false");
+// The pre-aggregation of a memtable stops when less than this ratio of the rows inserted
+// are merged by it.
+DEFINE_mDouble(memtable_pre_aggregation_min_merged_ratio, "0.1");
 
 // maximum sleep time to wait for memory when writing or flushing memtable.
 DEFINE_mInt32(memtable_wait_for_memory_sleep_time_s, "300");
@@ -764,6 +838,11 @@ DEFINE_Int32(high_priority_flush_thread_num_per_store, "6");
 // number of threads = min(flush_thread_num_per_store * num_store,
 //                         max_flush_thread_num_per_cpu * num_cpu)
 DEFINE_Int32(max_flush_thread_num_per_cpu, "4");
+// number of threads encoding the columns of the segments flushed from memtables,
+// 0 to encode the columns one by one in the flush thread
+DEFINE_Int32(segment_column_encode_thread_num, "0");
+// the max number of threads encoding the columns of one segment at the same time
+DEFINE_mInt32(segment_column_encode_parallelism, "4");
 
 // config for tablet meta checkpoint
 DEFINE_mInt32(tablet_meta_checkpoint_min_new_rowsets_num, "10");
@@ -782,6 +861,7 @@ DEFINE_Int64(brpc_socket_max_unwritten_bytes, "-1");
 // Controller Attachment and send it through http brpc when the length of the Tuple/Block data
 // is greater than 1.8G. This is to avoid the error of Request length overflow (2G).
 DEFINE_mBool(transfer_large_data_by_brpc, "true");
+DEFINE_mBool(enable_exchange_adaptive_compression, "true");
 
 // max number of txns for every txn_partition_map in txn manager
 // this is a self protection to avoid too many txns saving in manager
@@ -924,6 +1004,8 @@ DEFINE_String(kafka_debug, "disable");
 // Change this size to 0 to fix it temporarily.
 DEFINE_mInt32(routine_load_consumer_pool_size, "1024");
 
+DEFINE_mBool(enable_routine_load_json_batching_by_line, "true");
+
 // Used in single-stream-multi-table load. When receive a batch of messages from kafka,
 // if the size of batch is more than this threshold, we will request plans for all related tables.
 DEFINE_Int32(multi_table_batch_plan_threshold, "200");
@@ -971,6 +1053,7 @@ DEFINE_mInt32(parquet_column_max_buffer_mb, "8");
 DEFINE_mDouble(max_amplified_read_ratio, "0.8");
 DEFINE_mInt32(merged_oss_min_io_size, "1048576");
 DEFINE_mInt32(merged_hdfs_min_io_size, "8192");
+DEFINE_mBool(enable_adaptive_merged_io, "true");
 
 // OrcReader
 DEFINE_mInt32(orc_natural_read_size_mb, "8");
@@ -981,6 +1064,7 @@ DEFINE_mInt64(small_column_size_buffer, "100");
 DEFINE_mInt32(runtime_filter_sampling_frequency, "64");
 DEFINE_mInt32(execution_max_rpc_timeout_sec, "3600");
 DEFINE_mBool(execution_ignore_eovercrowded, "true");
+DEFINE_mInt32(exchange_multi_blocks_byte_size, "0");
 // cooldown task configs
 DEFINE_Int32(cooldown_thread_num, "5");
 DEFINE_mInt64(generate_cooldown_task_interval_sec, "20");
@@ -1066,6 +1150,7 @@ DEFINE_mInt64(workload_group_scan_task_wait_timeout_ms, "10000");
 DEFINE_mBool(variant_use_cloud_schema_dict_cache, "true");
 DEFINE_mDouble(variant_ratio_of_defaults_as_sparse_column, "1");
 DEFINE_mInt64(variant_threshold_rows_to_estimate_sparse_column, "2048");
+DEFINE_mBool(variant_keep_materialized_subcolumns, "true");
 DEFINE_mBool(variant_throw_exeception_on_invalid_json, "false");
 
 // block file cache
@@ -1108,6 +1193,7 @@ DEFINE_mInt64(file_cache_error_log_limit_bytes, "209715200"); // 200MB
 DEFINE_mInt64(cache_lock_wait_long_tail_threshold_us, "30000000");
 DEFINE_mInt64(cache_lock_held_long_tail_threshold_us, "30000000");
 DEFINE_mBool(enable_file_cache_keep_base_compaction_output, "false");
+DEFINE_mInt64(file_cache_keep_hot_base_compaction_output_sec, "3600");
 DEFINE_mInt64(file_cache_remove_block_qps_limit, "1000");
 DEFINE_mInt64(file_cache_background_gc_interval_ms, "100");
 DEFINE_mBool(enable_reader_dryrun_when_download_file_cache, "true");
@@ -1123,6 +1209,7 @@ DEFINE_mBool(enable_evaluate_shadow_queue_diff, "false");
 
 DEFINE_Int32(file_cache_downloader_thread_num_min, "32");
 DEFINE_Int32(file_cache_downloader_thread_num_max, "32");
+DEFINE_Int32(file_cache_background_load_thread_num, "8");
 
 DEFINE_mInt32(index_cache_entry_stay_time_after_lookup_s, "1800");
 DEFINE_mInt32(inverted_index_cache_stale_sweep_time_sec, "600");
@@ -1137,6 +1224,10 @@ DEFINE_Int32(inverted_index_query_cache_shards, "256");
 // inverted index match bitmap cache size
 DEFINE_String(inverted_index_query_cache_limit, "10%");
 
+// cache the bitmap of a whole compound predicate of MATCH predicates in the inverted index
+// query cache, besides the bitmaps of its leaves
+DEFINE_mBool(enable_inverted_index_compound_query_cache, "false");
+
 // inverted index
 DEFINE_mDouble(inverted_index_ram_buffer_size, "512");
 // -1 indicates not working.
@@ -1184,6 +1275,7 @@ DEFINE_mInt32(schema_cache_sweep_time_sec, "100");
 DEFINE_Int32(segment_cache_capacity, "-1");
 DEFINE_Int32(segment_cache_fd_percentage, "20");
 DEFINE_mInt32(estimated_mem_per_column_reader, "512");
+DEFINE_mBool(enable_segment_lazy_column_reader, "false");
 DEFINE_Int32(segment_cache_memory_percentage, "5");
 DEFINE_Bool(enable_segment_cache_prune, "true");
 
@@ -1195,7 +1287,11 @@ DEFINE_Bool(enable_set_in_bitmap_value, "true");
 
 DEFINE_Int64(max_hdfs_file_handle_cache_num, "20000");
 DEFINE_Int32(max_hdfs_file_handle_cache_time_sec, "28800");
+DEFINE_Int32(hdfs_hedged_read_threadpool_size, "0");
+DEFINE_Int32(hdfs_hedged_read_threshold_ms, "500");
+DEFINE_String(hdfs_short_circuit_domain_socket_path, "");
 DEFINE_Int64(max_external_file_meta_cache_num, "1000");
+DEFINE_Int64(regexp_cache_capacity, "4096");
 DEFINE_mInt32(common_obj_lru_cache_stale_sweep_time_sec, "900");
 // Apply delete pred in cumu compaction
 DEFINE_mBool(enable_delete_when_cumu_compaction, "false");
@@ -1254,6 +1350,7 @@ DEFINE_mInt64(mow_primary_key_index_max_size_in_memory, "52428800");
 DEFINE_mInt32(publish_version_gap_logging_threshold, "200");
 // get agg by cache for mow table
 DEFINE_mBool(enable_mow_get_agg_by_cache, "true");
+DEFINE_mBool(enable_mow_update_agg_cache_on_commit, "true");
 // get agg correctness check for mow table
 DEFINE_mBool(enable_mow_get_agg_correctness_check_core, "false");
 DEFINE_mBool(enable_agg_and_remove_pre_rowsets_delete_bitmap, "true");
@@ -1284,6 +1381,15 @@ DEFINE_mInt32(group_commit_queue_mem_limit, "67108864");
 // group_commit_wal_max_disk_limit=1024 or group_commit_wal_max_disk_limit=10% can be automatically identified.
 DEFINE_String(group_commit_wal_max_disk_limit, "10%");
 DEFINE_Bool(group_commit_wait_replay_wal_finish, "false");
+// Tune the commit interval and data size of every group commit from the load rate, the commit
+// latency and the memory of loads, instead of taking the table properties as they are.
+DEFINE_mBool(enable_group_commit_adaptive_batching, "false");
+// The longest time(ms) the adaptive batching waits to commit a slow load,
+// a table with a longer group_commit_interval_ms waits as long as the property.
+DEFINE_mInt64(group_commit_adaptive_max_interval_ms, "10000");
+// Whether a load of group commit returns only after the blocks it wrote to the wal are synced
+// to disk. The wals of a wal dir are synced by one thread, the loads waiting share the syncs.
+DEFINE_mBool(group_commit_sync_wal_on_append, "false");
 
 DEFINE_mInt32(scan_thread_nice_value, "0");
 DEFINE_mInt32(tablet_schema_cache_recycle_interval, "3600");
@@ -1359,6 +1465,13 @@ DEFINE_Int32(spill_io_thread_pool_queue_size, "102400");
 
 // paused query in queue timeout(ms) will be resumed or canceled
 DEFINE_Int64(spill_in_paused_queue_timeout_ms, "60000");
+DEFINE_mInt32(spill_read_ahead_blocks, "2");
+DEFINE_mString(spill_block_compression_codec, "zstd");
+DEFINE_Validator(spill_block_compression_codec, [](const std::string& config) -> bool {
+    return config == "zstd" || config == "lz4" || config == "none";
+});
+DEFINE_mBool(enable_spill_load_aware_placement, "true");
+DEFINE_mBool(enable_normalized_key_sort_block, "true");
 
 DEFINE_mBool(check_segment_when_build_rowset_meta, "false");
 
@@ -1367,6 +1480,9 @@ DEFINE_mBool(force_azure_blob_global_endpoint, "false");
 DEFINE_mInt32(max_s3_client_retry, "10");
 DEFINE_mInt32(s3_read_base_wait_time_ms, "100");
 DEFINE_mInt32(s3_read_max_wait_time_ms, "800");
+DEFINE_mBool(enable_s3_read_hedging, "false");
+DEFINE_mInt32(s3_read_hedge_min_delay_ms, "50");
+DEFINE_mInt32(s3_read_hedge_max_percent, "5");
 DEFINE_mBool(enable_s3_object_check_after_upload, "true");
 
 DEFINE_mBool(enable_s3_rate_limiter, "false");
@@ -1435,6 +1551,13 @@ DEFINE_Int64(num_buffered_reader_prefetch_thread_pool_max_thread, "64");
 DEFINE_Int64(num_s3_file_upload_thread_pool_min_thread, "16");
 // The max thread num for S3FileUploadThreadPool
 DEFINE_Int64(num_s3_file_upload_thread_pool_max_thread, "64");
+// The thread num of CsvParseThreadPool, which parses the lines of csv files for the csv readers,
+// 0 to parse the lines in the scanner thread only
+DEFINE_Int32(csv_parse_thread_num, "0");
+// the max number of threads parsing the lines of one csv reader at the same time
+DEFINE_mInt32(csv_parse_parallelism, "4");
+DEFINE_Int32(sort_merge_thread_num, "0");
+DEFINE_mInt32(sort_merge_parallelism, "4");
 // The maximum jvm heap usage ratio for hdfs write workload
 DEFINE_mDouble(max_hdfs_wirter_jni_heap_usage_ratio, "0.5");
 // The sleep milliseconds duration when hdfs write exceeds the maximum usage
@@ -1458,6 +1581,7 @@ DEFINE_Int64(s3_file_system_local_upload_buffer_size, "5242880");
 DEFINE_Bool(enable_jvm_monitor, "false");
 
 DEFINE_Int32(load_data_dirs_threads, "-1");
+DEFINE_Int32(load_tablet_meta_threads_per_data_dir, "1");
 
 // Skip loading stale rowset meta when initializing `TabletMeta` from protobuf
 DEFINE_mBool(skip_loading_stale_rowset_meta, "false");
@@ -1467,6 +1591,8 @@ DEFINE_Bool(enable_file_logger, "true");
 // The minimum row group size when exporting Parquet files. default 128MB
 DEFINE_Int64(min_row_group_size, "134217728");
 
+DEFINE_mBool(enable_parquet_writer_parallel_column_encoding, "false");
+
 DEFINE_mInt64(compaction_memory_bytes_limit, "1073741824");
 
 DEFINE_mInt64(compaction_batch_size, "-1");
@@ -1495,6 +1621,13 @@ DEFINE_mInt32(lz4_compression_block_size, "262144");
 
 DEFINE_mBool(enable_pipeline_task_leakage_detect, "false");
 
+DEFINE_mBool(enable_pipeline_task_hw_counters, "false");
+
+DEFINE_mBool(enable_pipeline_task_state_timeline, "false");
+DEFINE_mInt32(pipeline_task_state_timeline_max_transitions, "256");
+
+DEFINE_mBool(enable_nested_loop_join_filter_before_materialize, "true");
+
 DEFINE_mInt32(check_score_rounds_num, "1000");
 
 DEFINE_Int32(query_cache_size, "512");
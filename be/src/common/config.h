@@ -172,6 +172,15 @@ DECLARE_Double(schema_change_mem_limit_frac);
 // memory greater than 16 GB.
 DECLARE_mInt64(mmap_threshold); // bytes
 
+// Allocator allocations smaller than this are tracked but skip the process and query memory
+// limit checks, which are comparatively expensive for short-lived batch-sized buffers.
+// Set to 0 to check every allocation.
+DECLARE_mInt64(allocator_check_limit_min_bytes);
+
+// Advise transparent huge pages (madvise MADV_HUGEPAGE) for Allocator buffers of at least 2MB,
+// such as hash table buckets and arena chunks. Takes effect when THP is in `madvise` mode.
+DECLARE_mBool(enable_huge_page_for_large_alloc);
+
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
 DECLARE_mInt32(hash_table_double_grow_degree);
@@ -179,6 +188,10 @@ DECLARE_mInt32(hash_table_double_grow_degree);
 // The max fill rate for hash table
 DECLARE_mInt32(max_fill_rate);
 
+// The serialized key hash table of aggregation is split into 256 sub tables once it holds more
+// than this number of elements, so that a resize only rehashes one sub table. <= 0 disables it.
+DECLARE_mInt64(agg_two_level_hash_table_threshold);
+
 DECLARE_mInt32(double_resize_threshold);
 
 // The maximum low water mark of the system `/proc/meminfo/MemAvailable`, Unit byte, default -1.
@@ -270,6 +283,9 @@ DECLARE_Int32(delete_worker_count);
 DECLARE_Int32(alter_tablet_worker_count);
 // the count of thread to alter index
 DECLARE_Int32(alter_index_worker_count);
+// the count of thread shared by all alter index tasks to build the indexes of a segment in
+// parallel, 0 means the indexes are built one by one in the alter index thread
+DECLARE_Int32(index_build_thread_num);
 // the count of thread to clone
 DECLARE_Int32(clone_worker_count);
 // the count of thread to clone
@@ -301,6 +317,9 @@ DECLARE_mInt32(download_low_speed_limit_kbps);
 DECLARE_mInt32(download_low_speed_time);
 // whether to download small files in batch.
 DECLARE_mBool(enable_batch_download);
+// max number of file batches downloaded concurrently by one clone task, 1 means serially.
+// Each connection is still limited by max_download_speed_kbps.
+DECLARE_mInt32(clone_download_batch_parallelism);
 // whether to check md5sum when download
 DECLARE_mBool(enable_download_md5sum_check);
 // download binlog meta timeout
@@ -340,6 +359,32 @@ DECLARE_Int32(be_service_threads);
 DECLARE_mInt32(pipeline_status_report_interval);
 // Time slice for pipeline task execution (ms)
 DECLARE_mInt32(pipeline_task_exec_time_slice);
+// Scale the time slice of a pipeline task by the number of tasks waiting on its core: up to
+// twice the slice when none waits, down to a quarter when many do.
+DECLARE_mBool(enable_adaptive_pipeline_task_time_slice);
+// Whether an idle pipeline core picks a random victim to steal from instead of scanning
+// the neighbouring cores in order.
+DECLARE_mBool(enable_pipeline_task_random_steal);
+// Level pipeline tasks in the multilevel feedback queue by the CPU time of their whole query
+// instead of their own runtime, so short interactive queries stay ahead of wide long ones.
+DECLARE_mBool(pipeline_task_queue_level_by_query);
+// Group pipeline workers by NUMA node, bind them to the cpus of their node and keep the
+// tasks of one query on one node. Only takes effect on hosts with more than one NUMA node.
+DECLARE_Bool(enable_numa_aware_pipeline_scheduling);
+// Prefetch bucket heads and chain heads of upcoming probe rows when probing a hash join
+// hash table which is too large to stay in cache.
+DECLARE_mBool(enable_hash_join_probe_prefetch);
+// Store the build rows of a hash join hash table clustered by bucket when the build side has at
+// least `hash_join_clustered_build_min_rows` rows, so chain walks of the probe stay sequential.
+DECLARE_mBool(enable_hash_join_clustered_build);
+DECLARE_mInt64(hash_join_clustered_build_min_rows);
+// Let the streaming pre-aggregation sample the reduction ratio of every batch of input rows and
+// switch to passing rows through after `streaming_agg_adaptive_hysteresis_windows` batches in a
+// row reduce too little. After `streaming_agg_passthrough_retry_rows` passed through rows the
+// hash table is flushed and aggregation is tried again.
+DECLARE_mBool(enable_streaming_agg_adaptive_passthrough);
+DECLARE_mInt32(streaming_agg_adaptive_hysteresis_windows);
+DECLARE_mInt64(streaming_agg_passthrough_retry_rows);
 // number of scanner thread pool size for olap table
 // and the min thread num of remote scanner thread pool
 DECLARE_mInt32(doris_scanner_thread_pool_thread_num);
@@ -351,6 +396,9 @@ DECLARE_mInt32(remote_split_source_batch_size);
 DECLARE_Int32(doris_max_remote_scanner_thread_pool_thread_num);
 // number of olap scanner thread pool queue size
 DECLARE_Int32(doris_scanner_thread_pool_queue_size);
+// Dispatch queued scan tasks round-robin across queries instead of in submission order, so a
+// large scan cannot delay the scan tasks of small queries sharing the same scanner pool.
+DECLARE_mBool(enable_fair_scan_task_dispatch);
 // default thrift client connect timeout(in seconds)
 DECLARE_mInt32(thrift_connect_timeout_seconds);
 DECLARE_mInt32(fetch_rpc_timeout_seconds);
@@ -437,15 +485,62 @@ DECLARE_Bool(disable_pk_storage_page_cache);
 DECLARE_String(pk_storage_page_cache_limit);
 // data page size for primary key index
 DECLARE_Int32(primary_key_data_page_size);
+// Keep an array of 8 byte key prefixes next to the value index of primary key index,
+// so that a point lookup binary searches integers instead of whole keys.
+DECLARE_Bool(enable_pk_index_fence_prefixes);
 
 // inc_rowset snapshot rs sweep time interval
 DECLARE_mInt32(data_page_cache_stale_sweep_time_sec);
 DECLARE_mInt32(index_page_cache_stale_sweep_time_sec);
 // great impact on the performance of MOW, so it can be longer.
 DECLARE_mInt32(pk_index_page_cache_stale_sweep_time_sec);
+// Admit a page into a full page cache only if it is read more often than the page it evicts,
+// keeps large scans from flushing the hot pages out of the cache.
+DECLARE_Bool(enable_data_page_cache_tiny_lfu_admission);
+DECLARE_Bool(enable_index_page_cache_tiny_lfu_admission);
+DECLARE_Bool(enable_pk_index_page_cache_tiny_lfu_admission);
+// Cache for the decoded dictionaries of dict encoded columns, "0" to disable it.
+DECLARE_String(decoded_page_cache_limit);
+DECLARE_mInt32(decoded_page_cache_stale_sweep_time_sec);
 
 DECLARE_Bool(enable_low_cardinality_optimize);
 DECLARE_Bool(enable_low_cardinality_cache_code);
+// Read the columns of short circuit predicates in stages, only for the rows passing the
+// predicates evaluated before, instead of reading all predicate columns up front.
+DECLARE_mBool(enable_segment_iterator_staged_predicate_read);
+// Prune the unread rows of open segment iterators by page zone map when IN or min/max
+// runtime filters arrive after the scan has started.
+DECLARE_mBool(enable_late_arrival_runtime_filter_zone_map_pruning);
+// Skip the unread row groups of open parquet readers by statistics when IN or min/max runtime
+// filters arrive after the file scan has started.
+DECLARE_mBool(enable_late_arrival_runtime_filter_row_group_pruning);
+// When a parallel scan splits a segment between two scanners, move the split point to the
+// start of a data page of the first column, so that no page is read by both scanners.
+DECLARE_mBool(enable_parallel_scan_page_aligned_split);
+// For segments on remote storage, issue merged asynchronous reads of the data pages to be
+// scanned right after the row ranges are known, so the file cache is filled ahead of decoding.
+DECLARE_mBool(enable_segment_remote_page_prefetch);
+// Page ranges closer than this are merged into one prefetch read.
+DECLARE_mInt64(segment_remote_page_prefetch_merge_distance_bytes);
+// Upper bound of the size of one merged prefetch read.
+DECLARE_mInt64(segment_remote_page_prefetch_max_read_bytes);
+// Prefetch the data pages of all columns of remote segments read by compaction, compaction
+// reads bypass the normal file cache queue and are cached as disposable.
+DECLARE_mBool(enable_compaction_remote_page_prefetch);
+// Max bytes of data pages prefetched for one segment read by compaction.
+DECLARE_mInt64(compaction_remote_page_prefetch_bytes_per_segment);
+// Let the fixed length columns left to the default encoding choose among bitshuffle, frame of
+// reference and plain encoding, by the encoded size of their first page.
+DECLARE_mBool(enable_adaptive_column_encoding);
+// The space frame of reference encoding has to save over bitshuffle to be chosen, since it
+// decodes slower.
+DECLARE_mDouble(adaptive_column_encoding_min_space_saving);
+// Let frame of reference pages pack ascending values as (delta - min delta) when it is smaller,
+// which suits timestamps and auto increment ids. BEs older than this format can not read them.
+DECLARE_mBool(enable_frame_of_reference_min_delta);
+// Compress the strings of dict encoded columns with a per page symbol table, instead of storing
+// them plain, once the dictionary overflowed. BEs older than this page format can not read them.
+DECLARE_mBool(enable_dict_page_fsst_fallback);
 
 // be policy
 // whether check compaction checksum
@@ -462,6 +557,11 @@ DECLARE_mInt32(vertical_compaction_num_columns_per_group);
 DECLARE_Int32(vertical_compaction_max_row_source_memory_mb);
 // In vertical compaction, max dest segment file size
 DECLARE_mInt64(vertical_compaction_max_segment_size);
+// In vertical compaction, the count of thread shared by all compactions to merge value column
+// groups ahead of the group being written, 0 means the groups are merged one by one
+DECLARE_Int32(vertical_compaction_value_group_thread_num);
+// In vertical compaction, max memory of the blocks merged ahead by one compaction
+DECLARE_mInt64(vertical_compaction_value_group_prefetch_bytes);
 
 // If enabled, segments will be flushed column by column
 DECLARE_mBool(enable_vertical_segment_writer);
@@ -517,6 +617,13 @@ DECLARE_mInt32(multi_get_max_threads);
 // The upper limit of "permits" held by all compaction tasks. This config can be set to limit memory consumption for compaction.
 DECLARE_mInt64(total_permits_for_compaction_score);
 
+// The bytes per second compaction can read from and write to one data dir, 0 means no limit.
+// Cumulative compaction goes before base compaction, which goes before cold data compaction.
+DECLARE_mInt64(compaction_io_bytes_per_second_per_disk);
+// When the average latency of the other reads of a data dir goes over this, the compaction io
+// limit of the data dir is lowered until it does not, 0 means the limit is fixed
+DECLARE_mInt64(compaction_io_query_read_latency_threshold_us);
+
 // sleep interval in ms after generated compaction tasks
 DECLARE_mInt32(generate_compaction_tasks_interval_ms);
 // sleep interval in second after update replica infos
@@ -560,6 +667,10 @@ DECLARE_mInt64(pick_rowset_to_compact_interval_sec);
 DECLARE_mBool(enable_compaction_priority_scheduling);
 DECLARE_mInt32(low_priority_compaction_task_num_per_disk);
 DECLARE_mInt32(low_priority_compaction_score_threshold);
+// Pick the tablets to compact by the query CPU compaction saves, that is the compaction score
+// scaled by the scans of the tablet and the rows they merged since its last compaction.
+// The weight of read amplification in the priority, 0 to pick by compaction score only.
+DECLARE_mDouble(compaction_read_amplification_weight);
 
 // Thread count to do tablet meta checkpoint, -1 means use the data directories count.
 DECLARE_Int32(max_meta_checkpoint_threads);
@@ -622,6 +733,9 @@ DECLARE_mInt64(streaming_load_max_mb);
 // Therefore, it is necessary to limit the maximum number of
 // such data when using stream load to prevent excessive memory consumption.
 DECLARE_mInt64(streaming_load_json_max_mb);
+// The bytes of the http body a stream load buffers ahead of the scan, the receiving of the body
+// only blocks when the scan falls behind by more than this.
+DECLARE_mInt64(streaming_load_pipe_max_buffered_bytes);
 // the alive time of a TabletsChannel.
 // If the channel does not receive any data till this time,
 // the channel will be removed.
@@ -702,6 +816,15 @@ DECLARE_mInt64(write_buffer_size);
 DECLARE_mInt64(write_buffer_size_for_agg);
 // max parallel flush task per memtable writer
 DECLARE_mInt32(memtable_flush_running_count_limit);
+// Sort the rows of a memtable by the normalized keys of the key columns with radix sort,
+// only the rows with equal normalized keys are compared column by column.
+DECLARE_mBool(enable_memtable_normalized_key_sort);
+// Aggregate the rows with the same keys of an aggregate key or merge-on-read unique key
+// memtable in a hash table when they are inserted, so that fewer rows are sorted.
+DECLARE_mBool(enable_memtable_pre_aggregation);
+// The pre-aggregation of a memtable stops when less than this ratio of the rows inserted
+// are merged by it.
+DECLARE_mDouble(memtable_pre_aggregation_min_merged_ratio);
 
 // maximum sleep time to wait for memory when writing or flushing memtable.
 DECLARE_mInt32(memtable_wait_for_memory_sleep_time_s);
@@ -799,6 +922,11 @@ DECLARE_Int32(high_priority_flush_thread_num_per_store);
 // number of threads = min(flush_thread_num_per_store * num_store,
 //                         max_flush_thread_num_per_cpu * num_cpu)
 DECLARE_Int32(max_flush_thread_num_per_cpu);
+// number of threads encoding the columns of the segments flushed from memtables,
+// 0 to encode the columns one by one in the flush thread
+DECLARE_Int32(segment_column_encode_thread_num);
+// the max number of threads encoding the columns of one segment at the same time
+DECLARE_mInt32(segment_column_encode_parallelism);
 
 // config for tablet meta checkpoint
 DECLARE_mInt32(tablet_meta_checkpoint_min_new_rowsets_num);
@@ -820,6 +948,9 @@ DECLARE_Int64(brpc_socket_max_unwritten_bytes);
 // Controller Attachment and send it through http brpc when the length of the Tuple/Block data
 // is greater than 1.8G. This is to avoid the error of Request length overflow (2G).
 DECLARE_mBool(transfer_large_data_by_brpc);
+// Whether exchange sinks send blocks uncompressed for a while after a block compresses poorly.
+// The number of skipped blocks doubles on every poorly compressed block, up to 64.
+DECLARE_mBool(enable_exchange_adaptive_compression);
 
 // max number of txns for every txn_partition_map in txn manager
 // this is a self protection to avoid too many txns saving in manager
@@ -960,6 +1091,11 @@ DECLARE_mString(kafka_debug);
 // Change this size to 0 to fix it temporarily.
 DECLARE_mInt32(routine_load_consumer_pool_size);
 
+// When a json routine load job reads json by line, append the kafka messages into the shared
+// chunks of the pipe with a line delimiter, so the json reader parses a batch of messages per
+// read instead of getting one buffer, and one pipe notification, per message.
+DECLARE_mBool(enable_routine_load_json_batching_by_line);
+
 // the timeout of condition variable wait in blocking_get and blocking_put
 DECLARE_mInt32(blocking_queue_cv_wait_timeout_ms);
 
@@ -1010,6 +1146,9 @@ DECLARE_mDouble(max_amplified_read_ratio);
 // 1MB for oss, 8KB for hdfs
 DECLARE_mInt32(merged_oss_min_io_size);
 DECLARE_mInt32(merged_hdfs_min_io_size);
+// Shrink the amplified read ratio and the equivalent IO size of a merged reader when the merged
+// data is skipped without being read, e.g. by the lazy read of parquet.
+DECLARE_mBool(enable_adaptive_merged_io);
 
 // OrcReader
 DECLARE_mInt32(orc_natural_read_size_mb);
@@ -1019,6 +1158,9 @@ DECLARE_mInt64(small_column_size_buffer);
 DECLARE_mInt32(runtime_filter_sampling_frequency);
 DECLARE_mInt32(execution_max_rpc_timeout_sec);
 DECLARE_mBool(execution_ignore_eovercrowded);
+// Pack the queued blocks of an exchange channel into one rpc up to this many bytes.
+// Used when the query does not set exchange_multi_blocks_byte_size, 0 means disabled.
+DECLARE_mInt32(exchange_multi_blocks_byte_size);
 
 // cooldown task configs
 DECLARE_Int32(cooldown_thread_num);
@@ -1147,6 +1289,9 @@ DECLARE_mInt64(cache_lock_held_long_tail_threshold_us);
 // If your file cache is ample enough to accommodate all the data in your database,
 // enable this option; otherwise, it is recommended to leave it disabled.
 DECLARE_mBool(enable_file_cache_keep_base_compaction_output);
+// Keep the output of base compaction in the file cache if the tablet has been queried
+// within this many seconds, 0 means disabled.
+DECLARE_mInt64(file_cache_keep_hot_base_compaction_output_sec);
 DECLARE_mInt64(file_cache_remove_block_qps_limit);
 DECLARE_mInt64(file_cache_background_gc_interval_ms);
 DECLARE_mBool(enable_reader_dryrun_when_download_file_cache);
@@ -1155,6 +1300,8 @@ DECLARE_mInt64(file_cache_background_ttl_gc_interval_ms);
 DECLARE_mInt64(file_cache_background_ttl_gc_batch);
 DECLARE_Int32(file_cache_downloader_thread_num_min);
 DECLARE_Int32(file_cache_downloader_thread_num_max);
+// threads used to load the file cache blocks on disk into memory after restart
+DECLARE_Int32(file_cache_background_load_thread_num);
 // used to persist lru information before be reboot and load the info back
 DECLARE_mInt64(file_cache_background_lru_dump_interval_ms);
 // dump queue only if the queue update specific times through several dump intervals
@@ -1179,6 +1326,10 @@ DECLARE_Int32(inverted_index_query_cache_shards);
 // inverted index match bitmap cache size
 DECLARE_String(inverted_index_query_cache_limit);
 
+// cache the bitmap of a whole compound predicate of MATCH predicates in the inverted index
+// query cache, besides the bitmaps of its leaves
+DECLARE_mBool(enable_inverted_index_compound_query_cache);
+
 // inverted index
 DECLARE_mDouble(inverted_index_ram_buffer_size);
 DECLARE_mInt32(inverted_index_max_buffered_docs);
@@ -1228,6 +1379,10 @@ DECLARE_Int32(segment_cache_memory_percentage);
 DECLARE_Bool(enable_segment_cache_prune);
 
 DECLARE_mInt32(estimated_mem_per_column_reader);
+// If true, a cached segment only keeps its footer and creates the ColumnReader of a column
+// when the column is first read, instead of creating readers for all columns at once.
+// Useful for wide tables whose queries only touch a few columns.
+DECLARE_mBool(enable_segment_lazy_column_reader);
 
 // enable binlog
 DECLARE_Bool(enable_feature_binlog);
@@ -1238,9 +1393,17 @@ DECLARE_Bool(enable_set_in_bitmap_value);
 // max number of hdfs file handle in cache
 DECLARE_Int64(max_hdfs_file_handle_cache_num);
 DECLARE_Int32(max_hdfs_file_handle_cache_time_sec);
+// Defaults of the hdfs client for the hdfs file systems which don't set them in their own conf.
+// Hedged reads are enabled if the thread pool size is larger than 0, and short-circuit local
+// reads are enabled if the domain socket path of the co-located DataNode is set.
+DECLARE_Int32(hdfs_hedged_read_threadpool_size);
+DECLARE_Int32(hdfs_hedged_read_threshold_ms);
+DECLARE_String(hdfs_short_circuit_domain_socket_path);
 
 // max number of meta info of external files, such as parquet footer
 DECLARE_Int64(max_external_file_meta_cache_num);
+// max number of compiled regexp patterns shared by all queries, 0 disables the cache
+DECLARE_Int64(regexp_cache_capacity);
 // Apply delete pred in cumu compaction
 DECLARE_mBool(enable_delete_when_cumu_compaction);
 
@@ -1291,6 +1454,9 @@ DECLARE_mBool(variant_use_cloud_schema_dict_cache);
 // Threshold to estimate a column is sparsed
 // Notice: TEST ONLY
 DECLARE_mInt64(variant_threshold_rows_to_estimate_sparse_column);
+// Keep variant paths that are already typed subcolumns in the rowset as subcolumns, instead of
+// splitting them into sparse columns again
+DECLARE_mBool(variant_keep_materialized_subcolumns);
 // Treat invalid json format str as string, instead of throwing exception if false
 DECLARE_mBool(variant_throw_exeception_on_invalid_json);
 
@@ -1317,6 +1483,9 @@ DECLARE_mInt64(mow_primary_key_index_max_size_in_memory);
 DECLARE_mInt32(publish_version_gap_logging_threshold);
 // get agg by cache for mow table
 DECLARE_mBool(enable_mow_get_agg_by_cache);
+// Update the agg cache of the segments a publish or compaction writes delete bitmap for when
+// it commits, so that reads at the new version don't aggregate the bitmaps again.
+DECLARE_mBool(enable_mow_update_agg_cache_on_commit);
 // get agg correctness check for mow table
 DECLARE_mBool(enable_mow_get_agg_correctness_check_core);
 DECLARE_mBool(enable_agg_and_remove_pre_rowsets_delete_bitmap);
@@ -1353,6 +1522,15 @@ DECLARE_mInt32(group_commit_queue_mem_limit);
 // group_commit_wal_max_disk_limit=1024 or group_commit_wal_max_disk_limit=10% can be automatically identified.
 DECLARE_mString(group_commit_wal_max_disk_limit);
 DECLARE_Bool(group_commit_wait_replay_wal_finish);
+// Tune the commit interval and data size of every group commit from the load rate, the commit
+// latency and the memory of loads, instead of taking the table properties as they are.
+DECLARE_mBool(enable_group_commit_adaptive_batching);
+// The longest time(ms) the adaptive batching waits to commit a slow load,
+// a table with a longer group_commit_interval_ms waits as long as the property.
+DECLARE_mInt64(group_commit_adaptive_max_interval_ms);
+// Whether a load of group commit returns only after the blocks it wrote to the wal are synced
+// to disk. The wals of a wal dir are synced by one thread, the loads waiting share the syncs.
+DECLARE_mBool(group_commit_sync_wal_on_append);
 
 // The configuration item is used to lower the priority of the scanner thread,
 // typically employed to ensure CPU scheduling for write operations.
@@ -1431,6 +1609,18 @@ DECLARE_mInt32(spill_gc_work_time_ms);
 DECLARE_Int32(spill_io_thread_pool_thread_num);
 DECLARE_Int32(spill_io_thread_pool_queue_size);
 DECLARE_Int64(spill_in_paused_queue_timeout_ms);
+// Number of blocks a spill reader keeps reading ahead in the spill io thread pool, 0 disables it.
+DECLARE_mInt32(spill_read_ahead_blocks);
+// Compression codec of spilled blocks: zstd, lz4 or none. lz4 is cheaper on cpu when the spill
+// disk is fast, zstd writes less data.
+DECLARE_mString(spill_block_compression_codec);
+// Place new spill streams on the spill dir with the least expected write wait, estimated from
+// the active spill writers and the recent write throughput of each disk, instead of the dir with
+// the lowest disk usage. Spreads the streams of one query over all spill disks.
+DECLARE_mBool(enable_spill_load_aware_placement);
+// Sort a block on several integer or date columns by one memcmp of the normalized keys of the
+// rows, instead of sorting column by column.
+DECLARE_mBool(enable_normalized_key_sort_block);
 
 DECLARE_mBool(check_segment_when_build_rowset_meta);
 
@@ -1455,6 +1645,12 @@ DECLARE_mInt32(max_s3_client_retry);
 // and the max retry time is max_s3_client_retry
 DECLARE_mInt32(s3_read_base_wait_time_ms);
 DECLARE_mInt32(s3_read_max_wait_time_ms);
+// When a s3 "get" request has not returned after max(p95 of the recent get latencies,
+// s3_read_hedge_min_delay_ms), send a duplicate request and take whichever returns first.
+// The duplicated requests are limited to s3_read_hedge_max_percent of all the requests.
+DECLARE_mBool(enable_s3_read_hedging);
+DECLARE_mInt32(s3_read_hedge_min_delay_ms);
+DECLARE_mInt32(s3_read_hedge_max_percent);
 DECLARE_mBool(enable_s3_object_check_after_upload);
 
 // write as inverted index tmp directory
@@ -1502,6 +1698,16 @@ DECLARE_Int64(num_buffered_reader_prefetch_thread_pool_max_thread);
 DECLARE_Int64(num_s3_file_upload_thread_pool_min_thread);
 // The max thread num for S3FileUploadThreadPool
 DECLARE_Int64(num_s3_file_upload_thread_pool_max_thread);
+// The thread num of CsvParseThreadPool, which parses the lines of csv files for the csv readers,
+// 0 to parse the lines in the scanner thread only
+DECLARE_Int32(csv_parse_thread_num);
+// the max number of threads parsing the lines of one csv reader at the same time
+DECLARE_mInt32(csv_parse_parallelism);
+// The thread num of SortMergeThreadPool, which merges the key ranges of a full sort without
+// limit at the same time, 0 to merge the sorted blocks in the reading thread only
+DECLARE_Int32(sort_merge_thread_num);
+// the max number of threads merging the sorted blocks of one sorter at the same time
+DECLARE_mInt32(sort_merge_parallelism);
 // The maximum jvm heap usage ratio for hdfs write workload
 DECLARE_mDouble(max_hdfs_wirter_jni_heap_usage_ratio);
 // The sleep milliseconds duration when hdfs write exceeds the maximum usage
@@ -1527,6 +1733,9 @@ DECLARE_Bool(enable_jvm_monitor);
 
 // Num threads to load data dirs, default value -1 indicates the same number of threads as the number of data dirs
 DECLARE_Int32(load_data_dirs_threads);
+// Num threads to parse tablet metas and create tablets within one data dir when BE starts,
+// 1 means loading tablets of a data dir serially
+DECLARE_Int32(load_tablet_meta_threads_per_data_dir);
 
 // Skip loading stale rowset meta when initializing `TabletMeta` from protobuf
 DECLARE_mBool(skip_loading_stale_rowset_meta);
@@ -1539,6 +1748,10 @@ DECLARE_Bool(enable_file_logger);
 // The minimum row group size when exporting Parquet files.
 DECLARE_Int64(min_row_group_size);
 
+// Encode and compress the columns of a Parquet row group in parallel on the arrow CPU thread
+// pool, instead of on the sink's pipeline task only.
+DECLARE_mBool(enable_parquet_writer_parallel_column_encoding);
+
 DECLARE_mInt64(compaction_memory_bytes_limit);
 
 DECLARE_mInt64(compaction_batch_size);
@@ -1564,6 +1777,19 @@ DECLARE_mInt32(lz4_compression_block_size);
 
 DECLARE_mBool(enable_pipeline_task_leakage_detect);
 
+// Record cpu cycles, instructions, cache misses and branch misses of each pipeline task
+// by the thread's perf_event counters, shown in the task profile.
+DECLARE_mBool(enable_pipeline_task_hw_counters);
+
+// Record the state transitions of each pipeline task, shown as "StateTimeline" in the task
+// profile. At most pipeline_task_state_timeline_max_transitions transitions are kept per task.
+DECLARE_mBool(enable_pipeline_task_state_timeline);
+DECLARE_mInt32(pipeline_task_state_timeline_max_transitions);
+
+// Evaluate the join conjuncts of an inner or cross nested loop join on each probe row against a
+// build block before materializing them, so only the matched pairs are copied.
+DECLARE_mBool(enable_nested_loop_join_filter_before_materialize);
+
 DECLARE_mInt32(check_score_rounds_num);
 
 // MB
@@ -601,6 +601,64 @@ Status RowIdStorageReader::read_by_rowids(const PMultiGetRequestV2& request,
     return Status::OK();
 }
 
+// Resolves the tablet, rowset and segment of a file mapping of doris format, `row_id` is only
+// for the error messages.
+static Status get_doris_format_segment(const std::shared_ptr<IdFileMap>& id_file_map,
+                                       const std::shared_ptr<FileMapping>& file_mapping,
+                                       int64_t row_id, int64_t* acquire_tablet_ms,
+                                       int64_t* acquire_rowsets_ms, int64_t* acquire_segments_ms,
+                                       BaseTabletSPtr* tablet, BetaRowsetSharedPtr* rowset,
+                                       segment_v2::SegmentSharedPtr* segment) {
+    auto [tablet_id, rowset_id, segment_id] = file_mapping->get_doris_format_info();
+    *tablet = scope_timer_run(
+            [&]() {
+                auto res = ExecEnv::get_tablet(tablet_id);
+                return !res.has_value() ? nullptr
+                                        : std::dynamic_pointer_cast<BaseTablet>(res.value());
+            },
+            acquire_tablet_ms);
+    if (!*tablet) {
+        return Status::InternalError(
+                "Backend:{} tablet not found, tablet_id: {}, rowset_id: {}, segment_id: {}, "
+                "row_id: {}",
+                BackendOptions::get_localhost(), tablet_id, rowset_id.to_string(), segment_id,
+                row_id);
+    }
+
+    *rowset = std::static_pointer_cast<BetaRowset>(
+            scope_timer_run([&]() { return id_file_map->get_temp_rowset(tablet_id, rowset_id); },
+                            acquire_rowsets_ms));
+    if (!*rowset) {
+        return Status::InternalError(
+                "Backend:{} rowset_id not found, tablet_id: {}, rowset_id: {}, segment_id: {}, "
+                "row_id: {}",
+                BackendOptions::get_localhost(), tablet_id, rowset_id.to_string(), segment_id,
+                row_id);
+    }
+
+    SegmentCacheHandle segment_cache;
+    RETURN_IF_ERROR(scope_timer_run(
+            [&]() {
+                return SegmentLoader::instance()->load_segments(*rowset, &segment_cache, true);
+            },
+            acquire_segments_ms));
+
+    auto it =
+            std::find_if(segment_cache.get_segments().cbegin(), segment_cache.get_segments().cend(),
+                         [segment_id](const segment_v2::SegmentSharedPtr& seg) {
+                             return seg->id() == segment_id;
+                         });
+    if (it == segment_cache.get_segments().end()) {
+        return Status::InternalError(
+                "Backend:{} segment not found, tablet_id: {}, rowset_id: {}, segment_id: {}, "
+                "row_id: {}",
+                BackendOptions::get_localhost(), tablet_id, rowset_id.to_string(), segment_id,
+                row_id);
+    }
+    *segment = *it;
+    return Status::OK();
+}
+
 Status RowIdStorageReader::read_batch_doris_format_row(
         const PRequestBlockDesc& request_block_desc, std::shared_ptr<IdFileMap> id_file_map,
         std::vector<SlotDescriptor>& slots, const TUniqueId& query_id,
@@ -625,19 +683,92 @@ Status RowIdStorageReader::read_batch_doris_format_row(
         }
     }
 
+    if (request_block_desc.fetch_row_store()) {
+        for (size_t j = 0; j < request_block_desc.row_id_size(); ++j) {
+            auto file_id = request_block_desc.file_id(j);
+            auto file_mapping = id_file_map->get_file_mapping(file_id);
+            if (!file_mapping) {
+                return Status::InternalError(
+                        "Backend:{} file_mapping not found, query_id: {}, file_id: {}",
+                        BackendOptions::get_localhost(), print_id(query_id), file_id);
+            }
+
+            RETURN_IF_ERROR(read_doris_format_row(
+                    id_file_map, file_mapping, request_block_desc.row_id(j), slots,
+                    full_read_schema, row_store_read_struct, stats, acquire_tablet_ms,
+                    acquire_rowsets_ms, acquire_segments_ms, lookup_row_data_ms, iterator_map,
+                    result_block));
+        }
+        return Status::OK();
+    }
+
+    // Group the rows by the segment they are in, so that each segment is resolved once and each
+    // of its columns is read in one pass of a column iterator over the sorted rowids.
+    struct SegmentRows {
+        std::vector<size_t> positions;
+        std::vector<segment_v2::rowid_t> row_ids;
+        // the index in `row_ids` of each position
+        std::vector<size_t> row_id_idxs;
+        vectorized::MutableColumns columns;
+    };
+    std::unordered_map<uint32_t, SegmentRows> segment_rows;
+    std::vector<std::pair<SegmentRows*, size_t>> row_of_positions(request_block_desc.row_id_size());
     for (size_t j = 0; j < request_block_desc.row_id_size(); ++j) {
-        auto file_id = request_block_desc.file_id(j);
+        auto& rows = segment_rows[request_block_desc.file_id(j)];
+        row_of_positions[j] = {&rows, rows.positions.size()};
+        rows.positions.push_back(j);
+    }
+
+    for (auto& [file_id, rows] : segment_rows) {
         auto file_mapping = id_file_map->get_file_mapping(file_id);
         if (!file_mapping) {
             return Status::InternalError(
                     "Backend:{} file_mapping not found, query_id: {}, file_id: {}",
                     BackendOptions::get_localhost(), print_id(query_id), file_id);
         }
+        BaseTabletSPtr tablet;
+        BetaRowsetSharedPtr rowset;
+        segment_v2::SegmentSharedPtr segment;
+        RETURN_IF_ERROR(get_doris_format_segment(
+                id_file_map, file_mapping, request_block_desc.row_id(rows.positions[0]),
+                acquire_tablet_ms, acquire_rowsets_ms, acquire_segments_ms, &tablet, &rowset,
+                &segment));
+
+        std::vector<size_t> order(rows.positions.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            order[i] = i;
+        }
+        std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+            return request_block_desc.row_id(rows.positions[lhs]) <
+                   request_block_desc.row_id(rows.positions[rhs]);
+        });
+        rows.row_id_idxs.resize(order.size());
+        for (size_t i : order) {
+            auto row_id =
+                    static_cast<segment_v2::rowid_t>(request_block_desc.row_id(rows.positions[i]));
+            if (rows.row_ids.empty() || rows.row_ids.back() != row_id) {
+                rows.row_ids.push_back(row_id);
+            }
+            rows.row_id_idxs[i] = rows.row_ids.size() - 1;
+        }
 
-        RETURN_IF_ERROR(read_doris_format_row(
-                id_file_map, file_mapping, request_block_desc.row_id(j), slots, full_read_schema,
-                row_store_read_struct, stats, acquire_tablet_ms, acquire_rowsets_ms,
-                acquire_segments_ms, lookup_row_data_ms, iterator_map, result_block));
+        for (int x = 0; x < slots.size(); ++x) {
+            auto column = result_block.get_by_position(x).column->clone_empty();
+            std::unique_ptr<segment_v2::ColumnIterator> iterator;
+            RETURN_IF_ERROR(segment->seek_and_read_by_rowids(full_read_schema, &slots[x],
+                                                             rows.row_ids, column, stats,
+                                                             iterator));
+            rows.columns.emplace_back(std::move(column));
+        }
+    }
+
+    // put the rows back in the order of the request
+    for (int x = 0; x < slots.size(); ++x) {
+        auto column = result_block.get_by_position(x).column->assume_mutable();
+        column->reserve(column->size() + row_of_positions.size());
+        for (const auto& [rows, idx] : row_of_positions) {
+            column->insert_from(*rows->columns[x], rows->row_id_idxs[idx]);
+        }
     }
     return Status::OK();
 }
@@ -966,52 +1097,12 @@ Status RowIdStorageReader::read_doris_format_row(
         std::unordered_map<IteratorKey, IteratorItem, HashOfIteratorKey>& iterator_map,
         vectorized::Block& result_block) {
     auto [tablet_id, rowset_id, segment_id] = file_mapping->get_doris_format_info();
-    BaseTabletSPtr tablet = scope_timer_run(
-            [&]() {
-                auto res = ExecEnv::get_tablet(tablet_id);
-                return !res.has_value() ? nullptr
-                                        : std::dynamic_pointer_cast<BaseTablet>(res.value());
-            },
-            acquire_tablet_ms);
-    if (!tablet) {
-        return Status::InternalError(
-                "Backend:{} tablet not found, tablet_id: {}, rowset_id: {}, segment_id: {}, "
-                "row_id: {}",
-                BackendOptions::get_localhost(), tablet_id, rowset_id.to_string(), segment_id,
-                row_id);
-    }
-
-    BetaRowsetSharedPtr rowset = std::static_pointer_cast<BetaRowset>(
-            scope_timer_run([&]() { return id_file_map->get_temp_rowset(tablet_id, rowset_id); },
-                            acquire_rowsets_ms));
-    if (!rowset) {
-        return Status::InternalError(
-                "Backend:{} rowset_id not found, tablet_id: {}, rowset_id: {}, segment_id: {}, "
-                "row_id: {}",
-                BackendOptions::get_localhost(), tablet_id, rowset_id.to_string(), segment_id,
-                row_id);
-    }
-
-    SegmentCacheHandle segment_cache;
-    RETURN_IF_ERROR(scope_timer_run(
-            [&]() {
-                return SegmentLoader::instance()->load_segments(rowset, &segment_cache, true);
-            },
-            acquire_segments_ms));
-
-    auto it =
-            std::find_if(segment_cache.get_segments().cbegin(), segment_cache.get_segments().cend(),
-                         [segment_id](const segment_v2::SegmentSharedPtr& seg) {
-                             return seg->id() == segment_id;
-                         });
-    if (it == segment_cache.get_segments().end()) {
-        return Status::InternalError(
-                "Backend:{} segment not found, tablet_id: {}, rowset_id: {}, segment_id: {}, "
-                "row_id: {}",
-                BackendOptions::get_localhost(), tablet_id, rowset_id.to_string(), segment_id,
-                row_id);
-    }
-    segment_v2::SegmentSharedPtr segment = *it;
+    BaseTabletSPtr tablet;
+    BetaRowsetSharedPtr rowset;
+    segment_v2::SegmentSharedPtr segment;
+    RETURN_IF_ERROR(get_doris_format_segment(id_file_map, file_mapping, row_id, acquire_tablet_ms,
+                                             acquire_rowsets_ms, acquire_segments_ms, &tablet,
+                                             &rowset, &segment));
 
     // if row_store_read_struct not empty, means the line we should read from row_store
     if (!row_store_read_struct.default_values.empty()) {
@@ -29,10 +29,12 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <ostream>
 #include <string>
 #include <tuple>
+#include <type_traits>
 
 #include "common/exception.h"
 #include "common/logging.h"
@@ -46,8 +48,13 @@
 #include "runtime/raw_value.h"
 #include "runtime/types.h"
 #include "util/string_parser.hpp"
+#include "util/simd/bits.h"
 #include "util/string_util.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_const.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
 #include "vec/data_types/data_type.h"
 #include "vec/data_types/data_type_factory.hpp"
 // NOLINTNEXTLINE(unused-includes)
@@ -539,6 +546,7 @@ Status VOlapTablePartitionParam::init() {
 
     _mem_usage = _partition_block.allocated_bytes();
     _mem_tracker->consume(_mem_usage);
+    _build_range_index();
     return Status::OK();
 }
 
@@ -787,6 +795,7 @@ Status VOlapTablePartitionParam::add_partitions(
                                      part);
         }
     }
+    _build_range_index();
 
     return Status::OK();
 }
@@ -872,8 +881,156 @@ Status VOlapTablePartitionParam::replace_partitions(
             it++;
         }
     }
+    _build_range_index();
 
     return Status::OK();
 }
 
+template <typename T>
+static uint64_t partition_order_key(T value) {
+    if constexpr (std::is_signed_v<T>) {
+        // flip the sign bit so that the negative values come first
+        return static_cast<uint64_t>(static_cast<int64_t>(value)) ^ (uint64_t(1) << 63);
+    } else {
+        return static_cast<uint64_t>(value);
+    }
+}
+
+// call `func` with the type as a template argument if the range index supports it
+template <typename Func>
+static bool dispatch_range_index_type(PrimitiveType type, Func&& func) {
+    switch (type) {
+    case TYPE_TINYINT:
+        func.template operator()<TYPE_TINYINT>();
+        return true;
+    case TYPE_SMALLINT:
+        func.template operator()<TYPE_SMALLINT>();
+        return true;
+    case TYPE_INT:
+        func.template operator()<TYPE_INT>();
+        return true;
+    case TYPE_BIGINT:
+        func.template operator()<TYPE_BIGINT>();
+        return true;
+    case TYPE_DATEV2:
+        func.template operator()<TYPE_DATEV2>();
+        return true;
+    case TYPE_DATETIMEV2:
+        func.template operator()<TYPE_DATETIMEV2>();
+        return true;
+    default:
+        return false;
+    }
+}
+
+void VOlapTablePartitionParam::_build_range_index() {
+    _range_index.reset();
+    if (_is_in_partition || _partition_slot_locs.size() != 1) {
+        return;
+    }
+    const auto& bound = _partition_block.get_by_position(_partition_slot_locs[0]);
+    auto index = std::make_unique<RangePartitionIndex>();
+    index->type = vectorized::remove_nullable(bound.type)->get_primitive_type();
+    const auto* bound_column = bound.column.get();
+    if (bound_column->is_nullable()) {
+        bound_column = &assert_cast<const vectorized::ColumnNullable*>(bound_column)
+                                ->get_nested_column();
+    }
+    bool valid = true;
+    auto build = [&]<PrimitiveType Type>() {
+        const auto& data =
+                assert_cast<const vectorized::ColumnVector<Type>&>(*bound_column).get_data();
+        // the map is ordered by the right ends, and the one without a right end is the last
+        for (const auto& [end, part] : *_partitions_map) {
+            int32_t end_row = std::get<1>(end);
+            int32_t start_row = part->start_key.second;
+            if ((end_row != -1 && bound.column->is_null_at(end_row)) ||
+                (start_row != -1 && bound.column->is_null_at(start_row))) {
+                valid = false;
+                return;
+            }
+            if (end_row != -1) {
+                index->ends.push_back(partition_order_key(data[end_row]));
+            }
+            index->starts.push_back(start_row == -1 ? 0 : partition_order_key(data[start_row]));
+            index->has_starts.push_back(start_row != -1);
+            index->parts.push_back(part);
+        }
+    };
+    if (dispatch_range_index_type(index->type, build) && valid) {
+        _range_index = std::move(index);
+    }
+}
+
+template <PrimitiveType Type>
+void VOlapTablePartitionParam::_find_partitions_in_range_index(
+        const vectorized::IColumn& column, int rows,
+        std::vector<VOlapTablePartition*>& partitions) const {
+    const auto& data = assert_cast<const vectorized::ColumnVector<Type>&>(column).get_data();
+    const auto& index = *_range_index;
+    const uint64_t* ends = index.ends.data();
+    size_t num_ends = index.ends.size();
+    auto locate = [&](uint64_t key) -> VOlapTablePartition* {
+        // the first part whose right end is greater than the key, with no branch on the keys
+        const uint64_t* first = ends;
+        size_t len = num_ends;
+        while (len > 0) {
+            size_t half = len / 2;
+            bool go_right = first[half] <= key;
+            first = go_right ? first + half + 1 : first;
+            len = go_right ? len - half - 1 : half;
+        }
+        auto pos = static_cast<size_t>(first - ends);
+        if (pos == index.parts.size() || (index.has_starts[pos] && key < index.starts[pos])) {
+            return nullptr;
+        }
+        return index.parts[pos];
+    };
+
+    uint64_t min_key = std::numeric_limits<uint64_t>::max();
+    uint64_t max_key = 0;
+    for (int i = 0; i < rows; ++i) {
+        uint64_t key = partition_order_key(data[i]);
+        min_key = std::min(min_key, key);
+        max_key = std::max(max_key, key);
+    }
+    // a partition is one range of keys, so all the keys are in it if the min and max are
+    auto* partition = locate(min_key);
+    if (partition != nullptr && locate(max_key) == partition) {
+        std::fill(partitions.begin(), partitions.begin() + rows, partition);
+        return;
+    }
+    for (int i = 0; i < rows; ++i) {
+        partitions[i] = locate(partition_order_key(data[i]));
+    }
+}
+
+void VOlapTablePartitionParam::find_partitions(
+        vectorized::Block* block, int rows, std::vector<VOlapTablePartition*>& partitions) const {
+    if (_range_index != nullptr && rows > 0) {
+        auto loc = _transformed_slot_locs.empty() ? _partition_slot_locs[0]
+                                                   : _transformed_slot_locs[0];
+        const auto& key = block->get_by_position(loc);
+        const auto* column = key.column.get();
+        // nulls and const columns are left to the comparator
+        bool supported = !vectorized::is_column_const(*column) &&
+                         vectorized::remove_nullable(key.type)->get_primitive_type() ==
+                                 _range_index->type;
+        if (supported && column->is_nullable()) {
+            const auto* nullable = assert_cast<const vectorized::ColumnNullable*>(column);
+            supported = !simd::contain_byte(nullable->get_null_map_data().data(), rows, 1);
+            column = &nullable->get_nested_column();
+        }
+        if (supported) {
+            dispatch_range_index_type(_range_index->type, [&]<PrimitiveType Type>() {
+                _find_partitions_in_range_index<Type>(*column, rows, partitions);
+            });
+            return;
+        }
+    }
+    for (int i = 0; i < rows; ++i) {
+        find_partition(block, i, partitions[i]);
+    }
+}
+
 } // namespace doris
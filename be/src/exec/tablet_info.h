@@ -36,6 +36,7 @@
 #include "common/logging.h"
 #include "common/object_pool.h"
 #include "common/status.h"
+#include "runtime/define_primitive_type.h"
 #include "runtime/descriptors.h"
 #include "runtime/raw_value.h"
 #include "vec/columns/column.h"
@@ -222,6 +223,13 @@ public:
         return (partition != nullptr);
     }
 
+    // Find the partitions of the first `rows` rows of the block, the same as find_partition()
+    // does for every row. The range partitions on one integer or date column are searched in
+    // sorted arrays of their bounds, and a block whose keys all fall in one partition takes
+    // one search.
+    void find_partitions(vectorized::Block* block, int rows,
+                         std::vector<VOlapTablePartition*>& partitions) const;
+
     ALWAYS_INLINE void find_tablets(
             vectorized::Block* block, const std::vector<uint32_t>& indexes,
             const std::vector<VOlapTablePartition*>& partitions,
@@ -312,6 +320,24 @@ private:
     // check if this partition contain this key
     bool _part_contains(VOlapTablePartition* part, BlockRowWithIndicator key) const;
 
+    // the range partitions on one integer or date column, the keys are mapped to uint64 in order
+    struct RangePartitionIndex {
+        PrimitiveType type;
+        // the right ends of parts, except the last part if it has no right end
+        std::vector<uint64_t> ends;
+        std::vector<uint64_t> starts;
+        std::vector<uint8_t> has_starts;
+        // sorted by the right ends
+        std::vector<VOlapTablePartition*> parts;
+    };
+
+    // build _range_index again after the partitions are changed
+    void _build_range_index();
+
+    template <PrimitiveType Type>
+    void _find_partitions_in_range_index(const vectorized::IColumn& column, int rows,
+                                         std::vector<VOlapTablePartition*>& partitions) const;
+
     // this partition only valid in this schema
     std::shared_ptr<OlapTableSchemaParam> _schema;
     TOlapTablePartitionParam _t_param;
@@ -331,6 +357,8 @@ private:
     std::unique_ptr<
             std::map<BlockRowWithIndicator, VOlapTablePartition*, VOlapTablePartKeyComparator>>
             _partitions_map;
+    // nullptr if the partitions can only be found in _partitions_map
+    std::unique_ptr<RangePartitionIndex> _range_index;
 
     bool _is_in_partition = false;
     uint32_t _mem_usage = 0;
@@ -0,0 +1,57 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "exprs/regexp_cache.h"
+
+#include <algorithm>
+
+namespace doris {
+
+std::string RegexpCache::make_key(std::string_view scope, std::string_view options,
+                                  std::string_view pattern) {
+    std::string key;
+    key.reserve(scope.size() + options.size() + pattern.size() + 8);
+    key.append(scope);
+    key.push_back('\0');
+    // length prefixed, so the options can never run into the pattern
+    key.append(std::to_string(options.size()));
+    key.push_back('\0');
+    key.append(options);
+    key.append(pattern);
+    return key;
+}
+
+std::shared_ptr<re2::RE2> RegexpCache::lookup(const std::string& key) {
+    auto* handle = LRUCachePolicy::lookup(key);
+    if (handle == nullptr) {
+        return nullptr;
+    }
+    auto re = ((CacheValue*)LRUCachePolicy::value(handle))->re;
+    LRUCachePolicy::release(handle);
+    return re;
+}
+
+void RegexpCache::insert(const std::string& key, std::shared_ptr<re2::RE2> re) {
+    auto* value = new CacheValue;
+    const auto program_size = static_cast<size_t>(std::max(re->ProgramSize(), 0));
+    value->re = std::move(re);
+    auto* handle = LRUCachePolicy::insert(key, value, 1, program_size, CachePriority::NORMAL);
+    LRUCachePolicy::release(handle);
+}
+
+} // namespace doris
@@ -0,0 +1,63 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <re2/re2.h>
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "runtime/exec_env.h"
+#include "runtime/memory/lru_cache_policy.h"
+
+namespace doris {
+
+// Process-wide cache of compiled regular expressions. re2::RE2 is thread-safe once compiled, so
+// every expression, fragment instance and row that uses the same pattern with the same options
+// shares one compiled program instead of compiling it again.
+class RegexpCache : public LRUCachePolicy {
+public:
+    RegexpCache(size_t capacity)
+            : LRUCachePolicy(CachePolicy::CacheType::REGEXP_CACHE, capacity,
+                             LRUCacheType::NUMBER,
+                             config::common_obj_lru_cache_stale_sweep_time_sec) {}
+
+    static RegexpCache* create_global_cache(size_t capacity) { return new RegexpCache(capacity); }
+
+    static RegexpCache* instance() { return ExecEnv::GetInstance()->regexp_cache(); }
+
+    // `scope` tells apart callers that compile the same pattern with different RE2 options,
+    // `options` holds the caller specific flags.
+    static std::string make_key(std::string_view scope, std::string_view options,
+                                std::string_view pattern);
+
+    // Returns nullptr on a miss.
+    std::shared_ptr<re2::RE2> lookup(const std::string& key);
+
+    void insert(const std::string& key, std::shared_ptr<re2::RE2> re);
+
+private:
+    class CacheValue : public LRUCacheValueBase {
+    public:
+        std::shared_ptr<re2::RE2> re;
+    };
+};
+
+} // namespace doris
@@ -38,5 +38,11 @@ public:
     static bool compile_regex(const StringRef& pattern, std::string* error_str,
                               const StringRef& match_parameter, const StringRef& options_value,
                               std::unique_ptr<re2::RE2>& re);
+
+    // Same as above, but the regex comes from RegexpCache, so a pattern is compiled once and then
+    // shared by every row, expression and fragment that uses it.
+    static bool compile_regex(const StringRef& pattern, std::string* error_str,
+                              const StringRef& match_parameter, const StringRef& options_value,
+                              std::shared_ptr<re2::RE2>& re);
 };
 } // namespace doris
@@ -42,10 +42,13 @@
 #include "http/http_handler.h"
 #include "http/http_method.h"
 #include "http/http_request.h"
+#include "http/http_status.h"
 #include "io/fs/local_file_system.h"
 #include "runtime/exec_env.h"
 #include "util/bfd_parser.h"
 #include "util/pprof_utils.h" // IWYU pragma: keep
+#include "util/query_cpu_profiler.h"
+#include "util/uid_util.h"
 
 namespace doris {
 
@@ -207,6 +210,60 @@ void ProfileAction::handle(HttpRequest* req) {
 #endif
 }
 
+// CPU profile of one query, e.g.
+// /pprof/query_profile?query_id=xxx-xxx&seconds=10&frequency=99&type=flamegraph
+// returns the folded stacks unless type is flamegraph.
+class QueryProfileAction : public HttpHandlerWithAuth {
+public:
+    QueryProfileAction(ExecEnv* exec_env) : HttpHandlerWithAuth(exec_env) {}
+
+    ~QueryProfileAction() override = default;
+
+    void handle(HttpRequest* req) override;
+};
+
+void QueryProfileAction::handle(HttpRequest* req) {
+#if defined(ADDRESS_SANITIZER) || defined(LEAK_SANITIZER) || defined(THREAD_SANITIZER)
+    std::string str = "CPU profiling is not available with address sanitizer builds.";
+    HttpChannel::send_reply(req, str);
+#else
+    TUniqueId query_id;
+    if (!parse_id(req->param("query_id"), &query_id)) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                "invalid query_id: " + req->param("query_id"));
+        return;
+    }
+    int seconds = kPprofDefaultSampleSecs;
+    const std::string& seconds_str = req->param(SECOND_KEY);
+    if (!seconds_str.empty()) {
+        seconds = std::atoi(seconds_str.c_str());
+    }
+    int frequency = 99;
+    const std::string& frequency_str = req->param("frequency");
+    if (!frequency_str.empty()) {
+        frequency = std::atoi(frequency_str.c_str());
+    }
+
+    // shares SIGPROF with the gperftools CPU profiler of ProfileAction
+    std::lock_guard<std::mutex> lock(kPprofActionMutex);
+    std::string folded_stacks;
+    Status st = QueryCpuProfiler::profile(query_id, seconds, frequency, &folded_stacks);
+    if (st.ok() && req->param("type") == "flamegraph") {
+        std::string svg_content;
+        std::string flamegraph_install_dir =
+                std::string(std::getenv("DORIS_HOME")) + "/tools/FlameGraph/";
+        st = PprofUtils::generate_flamegraph_from_folded(folded_stacks, flamegraph_install_dir,
+                                                         &svg_content);
+        folded_stacks = std::move(svg_content);
+    }
+    if (!st.ok()) {
+        HttpChannel::send_reply(req, st.to_string());
+    } else {
+        HttpChannel::send_reply(req, folded_stacks);
+    }
+#endif
+}
+
 class PmuProfileAction : public HttpHandlerWithAuth {
 public:
     PmuProfileAction(ExecEnv* exec_env) : HttpHandlerWithAuth(exec_env) {}
@@ -315,6 +372,8 @@ Status PprofActions::setup(ExecEnv* exec_env, EvHttpServer* http_server, ObjectP
                                   pool.add(new GrowthAction(exec_env)));
     http_server->register_handler(HttpMethod::GET, "/pprof/profile",
                                   pool.add(new ProfileAction(exec_env)));
+    http_server->register_handler(HttpMethod::GET, "/pprof/query_profile",
+                                  pool.add(new QueryProfileAction(exec_env)));
     http_server->register_handler(HttpMethod::GET, "/pprof/pmuprofile",
                                   pool.add(new PmuProfileAction(exec_env)));
     http_server->register_handler(HttpMethod::GET, "/pprof/contention",
@@ -29,6 +29,7 @@
 #include <sys/time.h>
 #include <thrift/protocol/TDebugProtocol.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 #include <ctime>
@@ -355,23 +356,27 @@ void StreamLoadAction::on_chunk_data(HttpRequest* req) {
     SCOPED_ATTACH_TASK(ExecEnv::GetInstance()->stream_load_pipe_tracker());
 
     int64_t start_read_data_time = MonotonicNanos();
+    // Copy the segments of the evbuffer into the chunks of the body sink directly, small reads
+    // of the connection are packed into full chunks instead of a 128KB buffer per read.
+    constexpr int kMaxSegments = 16;
+    evbuffer_iovec segments[kMaxSegments];
     while (evbuffer_get_length(evbuf) > 0) {
-        ByteBufferPtr bb;
-        Status st = ByteBuffer::allocate(128 * 1024, &bb);
-        if (!st.ok()) {
-            ctx->status = st;
-            return;
-        }
-        auto remove_bytes = evbuffer_remove(evbuf, bb->ptr, bb->capacity);
-        bb->pos = remove_bytes;
-        bb->flip();
-        st = ctx->body_sink->append(bb);
-        if (!st.ok()) {
-            LOG(WARNING) << "append body content failed. errmsg=" << st << ", " << ctx->brief();
-            ctx->status = st;
-            return;
-        }
-        ctx->receive_bytes += remove_bytes;
+        int num_segments =
+                std::min(evbuffer_peek(evbuf, -1, nullptr, segments, kMaxSegments), kMaxSegments);
+        size_t append_bytes = 0;
+        for (int i = 0; i < num_segments; ++i) {
+            Status st = ctx->body_sink->append(static_cast<const char*>(segments[i].iov_base),
+                                               segments[i].iov_len);
+            if (!st.ok()) {
+                LOG(WARNING) << "append body content failed. errmsg=" << st << ", "
+                             << ctx->brief();
+                ctx->status = st;
+                return;
+            }
+            append_bytes += segments[i].iov_len;
+        }
+        evbuffer_drain(evbuf, append_bytes);
+        ctx->receive_bytes += append_bytes;
     }
     int64_t read_data_time = MonotonicNanos() - start_read_data_time;
     int64_t last_receive_and_read_data_cost_nanos = ctx->receive_and_read_data_cost_nanos;
@@ -417,11 +422,11 @@ Status StreamLoadAction::_process_put(HttpRequest* http_req,
         std::shared_ptr<io::StreamLoadPipe> pipe;
         if (ctx->is_chunked_transfer) {
             pipe = std::make_shared<io::StreamLoadPipe>(
-                    io::kMaxPipeBufferedBytes /* max_buffered_bytes */);
+                    config::streaming_load_pipe_max_buffered_bytes /* max_buffered_bytes */);
             pipe->set_is_chunked_transfer(true);
         } else {
             pipe = std::make_shared<io::StreamLoadPipe>(
-                    io::kMaxPipeBufferedBytes /* max_buffered_bytes */,
+                    config::streaming_load_pipe_max_buffered_bytes /* max_buffered_bytes */,
                     MIN_CHUNK_SIZE /* min_chunk_size */, ctx->body_bytes /* total_length */);
         }
         request.fileType = TFileType::FILE_STREAM;
@@ -734,13 +734,13 @@ FileBlocksHolder BlockFileCache::get_or_set(const UInt128Wrapper& hash, size_t o
 
     ReadStatistics* stats = context.stats;
     DCHECK(stats != nullptr);
-    MonotonicStopWatch sw;
-    sw.start();
-    std::lock_guard cache_lock(_mutex);
-    stats->lock_wait_timer += sw.elapsed_time();
     FileBlocks file_blocks;
     int64_t duration = 0;
     {
+        MonotonicStopWatch sw;
+        sw.start();
+        std::lock_guard cache_lock(_mutex);
+        stats->lock_wait_timer += sw.elapsed_time();
         SCOPED_RAW_TIMER(&duration);
         if (auto iter = _key_to_time.find(hash);
             context.cache_type == FileCacheType::INDEX && iter != _key_to_time.end()) {
@@ -763,13 +763,17 @@ FileBlocksHolder BlockFileCache::get_or_set(const UInt128Wrapper& hash, size_t o
             fill_holes_with_empty_file_blocks(file_blocks, hash, context, range, cache_lock);
         }
         DCHECK(!file_blocks.empty());
-        *_num_read_blocks << file_blocks.size();
-        for (auto& block : file_blocks) {
-            if (block->state_unsafe() == FileBlock::State::DOWNLOADED) {
-                *_num_hit_blocks << 1;
-            }
+    }
+    // The metrics don't need the cache lock, update them after releasing it so that
+    // concurrent scanners spend less time waiting on the lock.
+    size_t num_hit_blocks = 0;
+    for (auto& block : file_blocks) {
+        if (block->state_unsafe() == FileBlock::State::DOWNLOADED) {
+            ++num_hit_blocks;
         }
     }
+    *_num_read_blocks << file_blocks.size();
+    *_num_hit_blocks << num_hit_blocks;
     *_get_or_set_latency_us << (duration / 1000);
     return FileBlocksHolder(std::move(file_blocks));
 }
@@ -1894,19 +1898,19 @@ void BlockFileCache::run_background_monitor() {
                     _disposable_queue.get_capacity(cache_lock));
             _cur_disposable_queue_element_count_metrics->set_value(
                     _disposable_queue.get_elements_num(cache_lock));
+        }
 
-            if (_num_read_blocks->get_value() > 0) {
-                _hit_ratio->set_value((double)_num_hit_blocks->get_value() /
-                                      _num_read_blocks->get_value());
-            }
-            if (_num_read_blocks_5m->get_value() > 0) {
-                _hit_ratio_5m->set_value((double)_num_hit_blocks_5m->get_value() /
-                                         _num_read_blocks_5m->get_value());
-            }
-            if (_num_read_blocks_1h->get_value() > 0) {
-                _hit_ratio_1h->set_value((double)_num_hit_blocks_1h->get_value() /
-                                         _num_read_blocks_1h->get_value());
-            }
+        if (_num_read_blocks->get_value() > 0) {
+            _hit_ratio->set_value((double)_num_hit_blocks->get_value() /
+                                  _num_read_blocks->get_value());
+        }
+        if (_num_read_blocks_5m->get_value() > 0) {
+            _hit_ratio_5m->set_value((double)_num_hit_blocks_5m->get_value() /
+                                     _num_read_blocks_5m->get_value());
+        }
+        if (_num_read_blocks_1h->get_value() > 0) {
+            _hit_ratio_1h->set_value((double)_num_hit_blocks_1h->get_value() /
+                                     _num_read_blocks_1h->get_value());
         }
     }
 }
@@ -251,8 +251,8 @@ void FileCacheBlockDownloader::download_segment_file(const DownloadFileMeta& met
 
     for (size_t i = 0; i < task_num; i++) {
         size_t offset = meta.offset + i * one_single_task_size;
-        size_t size =
-                std::min(one_single_task_size, static_cast<size_t>(meta.download_size - offset));
+        size_t size = std::min(one_single_task_size,
+                               static_cast<size_t>(download_size) - i * one_single_task_size);
         size_t bytes_read;
         VLOG_DEBUG << "download_segment_file, path=" << meta.path << ", read_at offset=" << offset
                    << ", size=" << size;
@@ -26,6 +26,7 @@
 #include "io/cache/block_file_cache.h"
 #include "io/cache/file_block.h"
 #include "io/cache/file_cache_common.h"
+#include "io/fs/err_utils.h"
 #include "io/fs/file_reader_writer_fwd.h"
 #include "io/fs/file_writer.h"
 #include "io/fs/local_file_reader.h"
@@ -237,11 +238,13 @@ Status FSFileCacheStorage::remove(const FileCacheKey& key) {
             RETURN_IF_ERROR(fs->delete_file(file));
         }
     }
-    std::vector<FileInfo> files;
-    bool exists {false};
-    RETURN_IF_ERROR(fs->list(dir, true, &files, &exists));
-    if (files.empty()) {
-        RETURN_IF_ERROR(fs->delete_directory(dir));
+    // rmdir only succeeds on an empty directory, which saves listing the whole key
+    // directory on every removal and never drops a block that is being written concurrently.
+    std::error_code ec;
+    std::filesystem::remove(dir, ec);
+    if (ec && ec != std::errc::directory_not_empty && ec != std::errc::file_exists &&
+        ec != std::errc::no_such_file_or_directory) [[unlikely]] {
+        return localfs_error(ec, fmt::format("failed to remove dir {}", dir));
     }
     return Status::OK();
 }
@@ -654,10 +657,8 @@ Status FSFileCacheStorage::parse_filename_suffix_to_cache_type(
 }
 
 void FSFileCacheStorage::load_cache_info_into_memory(BlockFileCache* _mgr) const {
-    int scan_length = 10000;
-    std::vector<BatchLoadArgs> batch_load_buffer;
-    batch_load_buffer.reserve(scan_length);
-    auto add_cell_batch_func = [&]() {
+    size_t scan_length = 10000;
+    auto add_cell_batch_func = [&](std::vector<BatchLoadArgs>& batch_load_buffer) {
         SCOPED_CACHE_LOCK(_mgr->_mutex, _mgr);
 
         auto f = [&](const BatchLoadArgs& args) {
@@ -682,7 +683,8 @@ void FSFileCacheStorage::load_cache_info_into_memory(BlockFileCache* _mgr) const
         batch_load_buffer.clear();
     };
 
-    auto scan_file_cache = [&](std::filesystem::directory_iterator& key_it) {
+    auto scan_file_cache = [&](std::filesystem::directory_iterator& key_it,
+                               std::vector<BatchLoadArgs>& batch_load_buffer) {
         TEST_SYNC_POINT_CALLBACK("BlockFileCache::TmpFile1");
         for (; key_it != std::filesystem::directory_iterator(); ++key_it) {
             auto key_with_suffix = key_it->path().filename().native();
@@ -725,7 +727,7 @@ void FSFileCacheStorage::load_cache_info_into_memory(BlockFileCache* _mgr) const
 
                 // add lock
                 if (batch_load_buffer.size() >= scan_length) {
-                    add_cell_batch_func();
+                    add_cell_batch_func(batch_load_buffer);
                     std::this_thread::sleep_for(std::chrono::microseconds(10));
                 }
             }
@@ -739,6 +741,7 @@ void FSFileCacheStorage::load_cache_info_into_memory(BlockFileCache* _mgr) const
             LOG(WARNING) << ec.message();
             return;
         }
+        std::vector<std::filesystem::path> key_prefix_paths;
         for (; key_prefix_it != std::filesystem::directory_iterator(); ++key_prefix_it) {
             if (!key_prefix_it->is_directory()) {
                 // skip version file
@@ -755,12 +758,41 @@ void FSFileCacheStorage::load_cache_info_into_memory(BlockFileCache* _mgr) const
                 }
                 continue;
             }
-            std::filesystem::directory_iterator key_it {key_prefix_it->path(), ec};
-            if (ec) {
-                LOG(WARNING) << ec.message();
-                continue;
+            key_prefix_paths.push_back(key_prefix_it->path());
+        }
+        // The key prefix directories are disjoint, so they are walked by several threads,
+        // each of which adds its own batches of cells under the cache lock.
+        auto scan_key_prefix_dirs = [&](size_t begin, size_t step) {
+            std::vector<BatchLoadArgs> buffer;
+            buffer.reserve(scan_length);
+            for (size_t i = begin; i < key_prefix_paths.size(); i += step) {
+                std::error_code ec;
+                std::filesystem::directory_iterator key_it {key_prefix_paths[i], ec};
+                if (ec) {
+                    LOG(WARNING) << ec.message();
+                    continue;
+                }
+                scan_file_cache(key_it, buffer);
+            }
+            if (!buffer.empty()) {
+                add_cell_batch_func(buffer);
             }
-            scan_file_cache(key_it);
+        };
+        size_t num_threads = std::min<size_t>(
+                std::max(config::file_cache_background_load_thread_num, 1),
+                std::max<size_t>(key_prefix_paths.size(), 1));
+        auto mem_tracker = thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker_sptr();
+        std::vector<std::thread> load_threads;
+        load_threads.reserve(num_threads - 1);
+        for (size_t i = 1; i < num_threads; ++i) {
+            load_threads.emplace_back([&, i]() {
+                SCOPED_ATTACH_TASK(mem_tracker);
+                scan_key_prefix_dirs(i, num_threads);
+            });
+        }
+        scan_key_prefix_dirs(0, num_threads);
+        for (auto& thread : load_threads) {
+            thread.join();
         }
     } else {
         std::filesystem::directory_iterator key_it {_cache_base_path, ec};
@@ -768,10 +800,12 @@ void FSFileCacheStorage::load_cache_info_into_memory(BlockFileCache* _mgr) const
             LOG(WARNING) << ec.message();
             return;
         }
-        scan_file_cache(key_it);
-    }
-    if (!batch_load_buffer.empty()) {
-        add_cell_batch_func();
+        std::vector<BatchLoadArgs> batch_load_buffer;
+        batch_load_buffer.reserve(scan_length);
+        scan_file_cache(key_it, batch_load_buffer);
+        if (!batch_load_buffer.empty()) {
+            add_cell_batch_func(batch_load_buffer);
+        }
     }
     TEST_SYNC_POINT_CALLBACK("BlockFileCache::TmpFile2");
 }
@@ -20,13 +20,16 @@
 #include <benchmark/benchmark.h>
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <chrono>
 #include <ctime>
 #include <iostream>
+#include <random>
 #include <string>
 #include <vector>
 
 #include "common/status.h"
+#include "io/fs/buffered_reader.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/file_writer.h"
 #include "util/slice.h"
@@ -155,6 +158,127 @@ public:
         return status;
     }
 
+    // Ranges of a parquet-like projection scan over a file of `file_size` bytes.
+    // The file is split into row groups of `row_group_size` bytes, each holding `num_columns`
+    // equally sized column chunks, and `read_columns` of them are read in every row group.
+    // The footer (the last `footer_size` bytes) is not included, see `parquet_read()`.
+    std::vector<PrefetchRange> parquet_ranges(size_t file_size) {
+        size_t footer_size = get_conf("footer_size", 64 * 1024L);
+        size_t row_group_size = get_conf("row_group_size", 128 * 1024 * 1024L);
+        size_t num_columns = std::max(get_conf("num_columns", 32L), 1L);
+        size_t read_columns = std::clamp(get_conf("read_columns", 4L), 1L, (long)num_columns);
+        std::vector<PrefetchRange> ranges;
+        if (file_size <= footer_size) {
+            return ranges;
+        }
+        size_t data_size = file_size - footer_size;
+        for (size_t group_start = 0; group_start < data_size; group_start += row_group_size) {
+            size_t group_size = std::min(row_group_size, data_size - group_start);
+            size_t chunk_size = group_size / num_columns;
+            if (chunk_size == 0) {
+                break;
+            }
+            for (size_t i = 0; i < read_columns; ++i) {
+                size_t column = i * num_columns / read_columns;
+                size_t start = group_start + column * chunk_size;
+                ranges.emplace_back(start, start + chunk_size);
+            }
+        }
+        return ranges;
+    }
+
+    // `num_pages` reads of `page_size` bytes at random page aligned offsets, which is how
+    // segment pages are fetched by point queries and index lookups.
+    std::vector<PrefetchRange> random_ranges(size_t file_size) {
+        size_t page_size = std::max(get_conf("page_size", 64 * 1024L), 1L);
+        size_t num_pages = get_conf("num_pages", 1000L);
+        std::vector<PrefetchRange> ranges;
+        if (file_size < page_size) {
+            return ranges;
+        }
+        std::mt19937_64 rng(get_conf("seed", 0L));
+        std::uniform_int_distribution<size_t> dist(0, file_size / page_size - 1);
+        for (size_t i = 0; i < num_pages; ++i) {
+            size_t start = dist(rng) * page_size;
+            ranges.emplace_back(start, start + page_size);
+        }
+        return ranges;
+    }
+
+    // Read the footer and then the column chunks of `parquet_ranges()`. The column chunks
+    // are read through a MergeRangeFileReader unless `merge_io` is false, the footer is out
+    // of its ranges and goes to the underlying reader directly.
+    Status parquet_read(benchmark::State& state, FileReaderSPtr reader) {
+        size_t file_size = reader->size();
+        size_t footer_size = std::min((size_t)get_conf("footer_size", 64 * 1024L), file_size);
+        std::vector<PrefetchRange> ranges = parquet_ranges(file_size);
+        FileReaderSPtr range_reader = reader;
+        if (_conf_map["merge_io"] != "false" && !ranges.empty()) {
+            range_reader = std::make_shared<MergeRangeFileReader>(nullptr, reader, ranges);
+        }
+        ranges.insert(ranges.begin(), PrefetchRange(file_size - footer_size, file_size));
+        Status st = read_ranges(state, range_reader, ranges);
+        if (range_reader != reader) {
+            static_cast<void>(reader->close());
+        }
+        return st;
+    }
+
+    // Read `ranges` in order, report the throughput and the latency percentiles of each read.
+    Status read_ranges(benchmark::State& state, FileReaderSPtr reader,
+                       const std::vector<PrefetchRange>& ranges) {
+        bm_log("begin to read {} ranges {}, thread: {}", ranges.size(), _name,
+               state.thread_index());
+        std::vector<char> buffer;
+        std::vector<double> latencies;
+        latencies.reserve(ranges.size());
+        size_t read_size = 0;
+
+        Status status;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (const auto& range : ranges) {
+            size_t size = range.end_offset - range.start_offset;
+            buffer.resize(size);
+            size_t bytes_read = 0;
+            auto read_start = std::chrono::high_resolution_clock::now();
+            status = reader->read_at(range.start_offset, {buffer.data(), size}, &bytes_read);
+            auto read_end = std::chrono::high_resolution_clock::now();
+            if (!status.ok()) {
+                bm_log("reader read_at error: {}", status.to_string());
+                break;
+            }
+            latencies.push_back(
+                    std::chrono::duration<double, std::milli>(read_end - read_start).count());
+            read_size += bytes_read;
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds =
+                std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+        state.counters["ReadRate(B/S)"] =
+                benchmark::Counter(read_size, benchmark::Counter::kIsRate);
+        state.counters["ReadTotal(B)"] = read_size;
+        state.counters["ReadTime(S)"] = elapsed_seconds.count();
+        state.counters["ReadCount"] = latencies.size();
+        if (!latencies.empty()) {
+            std::sort(latencies.begin(), latencies.end());
+            auto percentile = [&](double p) {
+                return latencies[std::min(latencies.size() - 1, (size_t)(p * latencies.size()))];
+            };
+            state.counters["ReadLatencyP50(MS)"] = percentile(0.5);
+            state.counters["ReadLatencyP99(MS)"] = percentile(0.99);
+            state.counters["ReadLatencyMax(MS)"] = latencies.back();
+        }
+
+        if (status.ok() && reader != nullptr) {
+            status = reader->close();
+        }
+        bm_log("finish to read {} ranges {}, thread: {}, size {}, seconds: {}, status: {}",
+               ranges.size(), _name, state.thread_index(), read_size, elapsed_seconds.count(),
+               status);
+        return status;
+    }
+
     Status write(benchmark::State& state, FileWriter* writer) {
         bm_log("begin to write {}, thread: {}, size: {}", _name, state.thread_index(), _file_size);
         size_t write_size = _file_size;
@@ -196,6 +320,10 @@ public:
     }
 
 protected:
+    long get_conf(const std::string& key, long default_value) {
+        return _conf_map.contains(key) ? std::stol(_conf_map[key]) : default_value;
+    }
+
     std::string _name;
     int _threads;
     int _iterations;
@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "io/fs/benchmark/hdfs_benchmark.hpp"
+#include "io/fs/benchmark/local_benchmark.hpp"
 #include "io/fs/benchmark/s3_benchmark.hpp"
 
 namespace doris::io {
@@ -46,6 +47,10 @@ Status BenchmarkFactory::getBm(const std::string fs_type, const std::string op_t
             *bm = new S3SingleReadBenchmark(threads, iterations, file_size, conf_map);
         } else if (op_type == "prefetch_read") {
             *bm = new S3PrefetchReadBenchmark(threads, iterations, file_size, conf_map);
+        } else if (op_type == "parquet_read") {
+            *bm = new S3ParquetReadBenchmark(threads, iterations, file_size, conf_map);
+        } else if (op_type == "random_read") {
+            *bm = new S3RandomReadBenchmark(threads, iterations, file_size, conf_map);
         } else if (op_type == "rename") {
             *bm = new S3RenameBenchmark(threads, iterations, file_size, conf_map);
         } else if (op_type == "exists") {
@@ -64,6 +69,10 @@ Status BenchmarkFactory::getBm(const std::string fs_type, const std::string op_t
             *bm = new HdfsOpenReadBenchmark(threads, iterations, file_size, conf_map);
         } else if (op_type == "single_read") {
             *bm = new HdfsSingleReadBenchmark(threads, iterations, file_size, conf_map);
+        } else if (op_type == "parquet_read") {
+            *bm = new HdfsParquetReadBenchmark(threads, iterations, file_size, conf_map);
+        } else if (op_type == "random_read") {
+            *bm = new HdfsRandomReadBenchmark(threads, iterations, file_size, conf_map);
         } else if (op_type == "rename") {
             *bm = new HdfsRenameBenchmark(threads, iterations, file_size, conf_map);
         } else if (op_type == "exists") {
@@ -73,6 +82,22 @@ Status BenchmarkFactory::getBm(const std::string fs_type, const std::string op_t
                     "unknown params: fs_type: {}, op_type: {}, iterations: {}", fs_type, op_type,
                     iterations);
         }
+    } else if (fs_type == "local") {
+        if (op_type == "create_write") {
+            *bm = new LocalCreateWriteBenchmark(threads, iterations, file_size, conf_map);
+        } else if (op_type == "open_read") {
+            *bm = new LocalOpenReadBenchmark(threads, iterations, file_size, conf_map);
+        } else if (op_type == "single_read") {
+            *bm = new LocalSingleReadBenchmark(threads, iterations, file_size, conf_map);
+        } else if (op_type == "parquet_read") {
+            *bm = new LocalParquetReadBenchmark(threads, iterations, file_size, conf_map);
+        } else if (op_type == "random_read") {
+            *bm = new LocalRandomReadBenchmark(threads, iterations, file_size, conf_map);
+        } else {
+            return Status::Error<ErrorCode::INVALID_ARGUMENT>(
+                    "unknown params: fs_type: {}, op_type: {}, iterations: {}", fs_type, op_type,
+                    iterations);
+        }
     }
     return Status::OK();
 }
@@ -24,7 +24,7 @@
 #include "util/cpu_info.h"
 #include "util/threadpool.h"
 
-DEFINE_string(fs_type, "hdfs", "Supported File System: s3, hdfs");
+DEFINE_string(fs_type, "hdfs", "Supported File System: s3, hdfs, local");
 DEFINE_string(operation, "create_write",
               "Supported Operations: create_write, open_read, open, rename, delete, exists");
 DEFINE_string(threads, "1", "Number of threads");
@@ -45,9 +45,13 @@ std::string get_usage(const std::string& progname) {
     ss << "\nfs_type:\n";
     ss << "     hdfs\n";
     ss << "     s3\n";
+    ss << "     local\n";
     ss << "\nop_type:\n";
     ss << "     read\n";
     ss << "     write\n";
+    ss << "     parquet_read: footer and projected column chunks, see conf row_group_size,\n"
+          "                   num_columns, read_columns, footer_size and merge_io\n";
+    ss << "     random_read: random pages, see conf page_size and num_pages\n";
     ss << "\nthreads:\n";
     ss << "     num of threads\n";
     ss << "\niterations:\n";
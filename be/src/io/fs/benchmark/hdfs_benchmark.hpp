@@ -80,6 +80,48 @@ public:
     }
 };
 
+// Read the footer and the projected column chunks of a single specified file
+class HdfsParquetReadBenchmark : public HdfsSingleReadBenchmark {
+public:
+    HdfsParquetReadBenchmark(int threads, int iterations, size_t file_size,
+                             const std::map<std::string, std::string>& conf_map)
+            : HdfsSingleReadBenchmark(threads, iterations, file_size, conf_map) {
+        _name = "HdfsParquetReadBenchmark";
+    }
+    virtual ~HdfsParquetReadBenchmark() = default;
+
+    Status run(benchmark::State& state) override {
+        return parquet_read(state, DORIS_TRY(open(get_file_path(state))));
+    }
+
+protected:
+    Result<FileReaderSPtr> open(const std::string& file_path) {
+        io::FileReaderOptions reader_opts;
+        FileSystemProperties params {.system_type = TFileType::FILE_HDFS,
+                                     .properties = {},
+                                     .hdfs_params = parse_properties(_conf_map),
+                                     .broker_addresses = {}};
+        FileDescription fd {.path = file_path, .file_size = -1, .mtime = 0, .fs_name = ""};
+        return FileFactory::create_file_reader(params, fd, reader_opts, nullptr);
+    }
+};
+
+// Read random pages of a single specified file
+class HdfsRandomReadBenchmark : public HdfsParquetReadBenchmark {
+public:
+    HdfsRandomReadBenchmark(int threads, int iterations, size_t file_size,
+                            const std::map<std::string, std::string>& conf_map)
+            : HdfsParquetReadBenchmark(threads, iterations, file_size, conf_map) {
+        _name = "HdfsRandomReadBenchmark";
+    }
+    virtual ~HdfsRandomReadBenchmark() = default;
+
+    Status run(benchmark::State& state) override {
+        auto reader = DORIS_TRY(open(get_file_path(state)));
+        return read_ranges(state, reader, random_ranges(reader->size()));
+    }
+};
+
 class HdfsCreateWriteBenchmark : public BaseBenchmark {
 public:
     HdfsCreateWriteBenchmark(int threads, int iterations, size_t file_size,
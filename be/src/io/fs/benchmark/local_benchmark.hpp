@@ -0,0 +1,125 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "io/fs/benchmark/base_benchmark.h"
+#include "io/fs/file_reader.h"
+#include "io/fs/file_writer.h"
+#include "io/fs/local_file_system.h"
+#include "util/slice.h"
+
+namespace doris::io {
+
+class LocalOpenReadBenchmark : public BaseBenchmark {
+public:
+    LocalOpenReadBenchmark(int threads, int iterations, size_t file_size,
+                           const std::map<std::string, std::string>& conf_map)
+            : BaseBenchmark("LocalReadBenchmark", threads, iterations, file_size, conf_map) {}
+    LocalOpenReadBenchmark(const std::string& name, int threads, int iterations,
+                           size_t file_size, const std::map<std::string, std::string>& conf_map)
+            : BaseBenchmark(name, threads, iterations, file_size, conf_map) {}
+    virtual ~LocalOpenReadBenchmark() = default;
+
+    Status open(benchmark::State& state, FileReaderSPtr* reader) {
+        auto file_path = get_file_path(state);
+        auto start = std::chrono::high_resolution_clock::now();
+        RETURN_IF_ERROR(global_local_filesystem()->open_file(file_path, reader));
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds =
+                std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.counters["OpenReaderTime(S)"] = elapsed_seconds.count();
+        return Status::OK();
+    }
+
+    Status run(benchmark::State& state) override {
+        FileReaderSPtr reader;
+        RETURN_IF_ERROR(open(state, &reader));
+        return read(state, reader);
+    }
+};
+
+// Read a single specified file
+class LocalSingleReadBenchmark : public LocalOpenReadBenchmark {
+public:
+    LocalSingleReadBenchmark(int threads, int iterations, size_t file_size,
+                             const std::map<std::string, std::string>& conf_map)
+            : LocalOpenReadBenchmark(threads, iterations, file_size, conf_map) {}
+    LocalSingleReadBenchmark(const std::string& name, int threads, int iterations,
+                             size_t file_size, const std::map<std::string, std::string>& conf_map)
+            : LocalOpenReadBenchmark(name, threads, iterations, file_size, conf_map) {}
+    virtual ~LocalSingleReadBenchmark() = default;
+
+    virtual std::string get_file_path(benchmark::State& state) override {
+        std::string file_path = _conf_map["file_path"];
+        bm_log("file_path: {}", file_path);
+        return file_path;
+    }
+};
+
+// Read the footer and the projected column chunks of a single specified file
+class LocalParquetReadBenchmark : public LocalSingleReadBenchmark {
+public:
+    LocalParquetReadBenchmark(int threads, int iterations, size_t file_size,
+                              const std::map<std::string, std::string>& conf_map)
+            : LocalSingleReadBenchmark("LocalParquetReadBenchmark", threads, iterations,
+                                       file_size, conf_map) {}
+    virtual ~LocalParquetReadBenchmark() = default;
+
+    Status run(benchmark::State& state) override {
+        FileReaderSPtr reader;
+        RETURN_IF_ERROR(open(state, &reader));
+        return parquet_read(state, reader);
+    }
+};
+
+// Read random pages of a single specified file
+class LocalRandomReadBenchmark : public LocalSingleReadBenchmark {
+public:
+    LocalRandomReadBenchmark(int threads, int iterations, size_t file_size,
+                             const std::map<std::string, std::string>& conf_map)
+            : LocalSingleReadBenchmark("LocalRandomReadBenchmark", threads, iterations,
+                                       file_size, conf_map) {}
+    virtual ~LocalRandomReadBenchmark() = default;
+
+    Status run(benchmark::State& state) override {
+        FileReaderSPtr reader;
+        RETURN_IF_ERROR(open(state, &reader));
+        return read_ranges(state, reader, random_ranges(reader->size()));
+    }
+};
+
+class LocalCreateWriteBenchmark : public BaseBenchmark {
+public:
+    LocalCreateWriteBenchmark(int threads, int iterations, size_t file_size,
+                              const std::map<std::string, std::string>& conf_map)
+            : BaseBenchmark("LocalCreateWriteBenchmark", threads, iterations, file_size,
+                            conf_map) {}
+    virtual ~LocalCreateWriteBenchmark() = default;
+
+    Status run(benchmark::State& state) override {
+        auto file_path = get_file_path(state);
+        if (_file_size <= 0) {
+            _file_size = 10 * 1024 * 1024; // default 10MB
+        }
+        io::FileWriterPtr writer;
+        RETURN_IF_ERROR(global_local_filesystem()->create_file(file_path, &writer));
+        return write(state, writer.get());
+    }
+};
+
+} // namespace doris::io
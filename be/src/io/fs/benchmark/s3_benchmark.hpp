@@ -91,6 +91,54 @@ public:
     }
 };
 
+// Read the footer and the projected column chunks of a single specified file
+class S3ParquetReadBenchmark : public S3Benchmark {
+public:
+    S3ParquetReadBenchmark(int threads, int iterations, size_t file_size,
+                           const std::map<std::string, std::string>& conf_map)
+            : S3Benchmark("S3ParquetReadBenchmark", threads, iterations, file_size, conf_map) {}
+    virtual ~S3ParquetReadBenchmark() = default;
+
+    virtual std::string get_file_path(benchmark::State& state) override {
+        std::string file_path = _conf_map["file_path"];
+        bm_log("file_path: {}", file_path);
+        return file_path;
+    }
+
+    Status run(benchmark::State& state) override {
+        auto file_path = get_file_path(state);
+        std::shared_ptr<io::S3FileSystem> fs;
+        RETURN_IF_ERROR(get_fs(file_path, &fs));
+
+        io::FileReaderSPtr reader;
+        io::FileReaderOptions reader_opts;
+        RETURN_IF_ERROR(fs->open_file(file_path, &reader, &reader_opts));
+        return parquet_read(state, reader);
+    }
+};
+
+// Read random pages of a single specified file
+class S3RandomReadBenchmark : public S3ParquetReadBenchmark {
+public:
+    S3RandomReadBenchmark(int threads, int iterations, size_t file_size,
+                          const std::map<std::string, std::string>& conf_map)
+            : S3ParquetReadBenchmark(threads, iterations, file_size, conf_map) {
+        _name = "S3RandomReadBenchmark";
+    }
+    virtual ~S3RandomReadBenchmark() = default;
+
+    Status run(benchmark::State& state) override {
+        auto file_path = get_file_path(state);
+        std::shared_ptr<io::S3FileSystem> fs;
+        RETURN_IF_ERROR(get_fs(file_path, &fs));
+
+        io::FileReaderSPtr reader;
+        io::FileReaderOptions reader_opts;
+        RETURN_IF_ERROR(fs->open_file(file_path, &reader, &reader_opts));
+        return read_ranges(state, reader, random_ranges(reader->size()));
+    }
+};
+
 // Read a single specified file by prefetch reader
 class S3PrefetchReadBenchmark : public S3Benchmark {
 public:
@@ -29,8 +29,10 @@
 #include "common/config.h"
 #include "common/status.h"
 #include "runtime/exec_env.h"
+#include "runtime/memory/global_memory_arbitrator.h"
 #include "runtime/thread_context.h"
 #include "runtime/workload_management/io_throttle.h"
+#include "util/mem_info.h"
 #include "util/runtime_profile.h"
 #include "util/slice.h"
 #include "util/threadpool.h"
@@ -80,6 +82,7 @@ Status MergeRangeFileReader::read_at_impl(size_t offset, Slice result, size_t* b
         }
     } else if (!cached_data.empty()) {
         // the data in range may be skipped or ignored
+        _add_wasted_bytes(cached_data.end_offset - cached_data.start_offset);
         for (int16_t box_index : cached_data.ref_box) {
             _dec_box_ref(box_index);
         }
@@ -258,6 +261,19 @@ void MergeRangeFileReader::_dec_box_ref(int16_t box_index) {
     }
 }
 
+void MergeRangeFileReader::_add_wasted_bytes(size_t wasted_bytes) {
+    _statistics.wasted_bytes += wasted_bytes;
+    if (!config::enable_adaptive_merged_io || _statistics.merged_bytes <= 0) {
+        return;
+    }
+    // The skipped data is read in vain like the hollow data, so shrink the merge thresholds by
+    // the ratio of the merged data that is actually used.
+    double used_ratio =
+            1.0 - std::min(1.0, (double)_statistics.wasted_bytes / _statistics.merged_bytes);
+    _max_amplified_ratio = config::max_amplified_read_ratio * used_ratio;
+    _equivalent_io_size = (size_t)(_base_equivalent_io_size * used_ratio);
+}
+
 void MergeRangeFileReader::_read_in_box(RangeCachedData& cached_data, size_t offset, Slice result,
                                         size_t* bytes_read) {
     SCOPED_RAW_TIMER(&_statistics.copy_time);
@@ -299,6 +315,7 @@ void MergeRangeFileReader::_read_in_box(RangeCachedData& cached_data, size_t off
     if (offset > cached_data.start_offset) {
         // the data in range may be skipped
         size_t to_skip = offset - cached_data.start_offset;
+        _add_wasted_bytes(to_skip);
         handle_in_box(to_skip, nullptr);
     }
 
@@ -636,6 +653,12 @@ PrefetchBufferedReader::PrefetchBufferedReader(RuntimeProfile* profile, io::File
     if (buffer_size == -1L) {
         buffer_size = config::remote_storage_read_buffer_mb * 1024 * 1024;
     }
+    if (buffer_size > s_max_pre_buffer_size &&
+        GlobalMemoryArbitrator::process_memory_usage() + buffer_size >=
+                MemInfo::soft_mem_limit()) {
+        // prefetch with only one buffer under memory pressure
+        buffer_size = s_max_pre_buffer_size;
+    }
     _size = _reader->size();
     _whole_pre_buffer_size = buffer_size;
     _file_range.end_offset = std::min(_file_range.end_offset, _size);
@@ -223,6 +223,8 @@ public:
         int64_t request_bytes = 0;
         int64_t merged_bytes = 0;
         int64_t apply_bytes = 0;
+        // the merged bytes which are skipped without being read
+        int64_t wasted_bytes = 0;
     };
 
     struct RangeCachedData {
@@ -288,6 +290,7 @@ public:
         // 1MB for oss, 8KB for hdfs
         _equivalent_io_size =
                 _is_oss ? config::merged_oss_min_io_size : config::merged_hdfs_min_io_size;
+        _base_equivalent_io_size = _equivalent_io_size;
         for (const PrefetchRange& range : _random_access_ranges) {
             _statistics.apply_bytes += range.end_offset - range.start_offset;
         }
@@ -306,6 +309,8 @@ public:
                                                          random_profile, 1);
             _apply_bytes = ADD_CHILD_COUNTER_WITH_LEVEL(_profile, "ApplyBytes", TUnit::BYTES,
                                                         random_profile, 1);
+            _wasted_bytes = ADD_CHILD_COUNTER_WITH_LEVEL(_profile, "WastedBytes", TUnit::BYTES,
+                                                         random_profile, 1);
         }
     }
 
@@ -349,6 +354,7 @@ protected:
             COUNTER_UPDATE(_request_bytes, _statistics.request_bytes);
             COUNTER_UPDATE(_merged_bytes, _statistics.merged_bytes);
             COUNTER_UPDATE(_apply_bytes, _statistics.apply_bytes);
+            COUNTER_UPDATE(_wasted_bytes, _statistics.wasted_bytes);
             if (_reader != nullptr) {
                 _reader->collect_profile_before_close();
             }
@@ -363,6 +369,7 @@ private:
     RuntimeProfile::Counter* _request_bytes = nullptr;
     RuntimeProfile::Counter* _merged_bytes = nullptr;
     RuntimeProfile::Counter* _apply_bytes = nullptr;
+    RuntimeProfile::Counter* _wasted_bytes = nullptr;
 
     int _search_read_range(size_t start_offset, size_t end_offset);
     void _clean_cached_data(RangeCachedData& cached_data);
@@ -371,6 +378,7 @@ private:
     Status _fill_box(int range_index, size_t start_offset, size_t to_read, size_t* bytes_read,
                      const IOContext* io_ctx);
     void _dec_box_ref(int16_t box_index);
+    void _add_wasted_bytes(size_t wasted_bytes);
 
     RuntimeProfile* _profile = nullptr;
     io::FileReaderSPtr _reader;
@@ -388,6 +396,7 @@ private:
     bool _is_oss;
     double _max_amplified_ratio;
     size_t _equivalent_io_size;
+    size_t _base_equivalent_io_size;
 
     Statistics _statistics;
 };
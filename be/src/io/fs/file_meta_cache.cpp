@@ -21,11 +21,16 @@
 
 namespace doris {
 
+std::string FileMetaCache::get_key(const io::FileReaderSPtr& file_reader, int64_t mtime) {
+    return file_reader->path().native() + "_" + std::to_string(mtime) + "_" +
+           std::to_string(file_reader->size());
+}
+
 Status FileMetaCache::get_parquet_footer(io::FileReaderSPtr file_reader, io::IOContext* io_ctx,
                                          int64_t mtime, size_t* meta_size,
                                          ObjLRUCache::CacheHandle* handle) {
     ObjLRUCache::CacheHandle cache_handle;
-    std::string cache_key = file_reader->path().native() + std::to_string(mtime);
+    std::string cache_key = get_key(file_reader, mtime);
     auto hit_cache = _cache.lookup({cache_key}, &cache_handle);
     if (hit_cache) {
         *handle = std::move(cache_handle);
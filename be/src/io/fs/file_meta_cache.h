@@ -34,6 +34,10 @@ public:
 
     ObjLRUCache& cache() { return _cache; }
 
+    // The key of the cached meta of a file. A file rewritten at the same path gets another key
+    // by its modification time and size.
+    static std::string get_key(const io::FileReaderSPtr& file_reader, int64_t mtime);
+
     Status get_parquet_footer(io::FileReaderSPtr file_reader, io::IOContext* io_ctx, int64_t mtime,
                               size_t* meta_size, ObjLRUCache::CacheHandle* handle);
 
@@ -34,6 +34,7 @@
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "cpp/sync_point.h"
 #include "io/fs/err_utils.h"
+#include "olap/compaction_io_limiter.h"
 #include "olap/data_dir.h"
 #include "olap/olap_common.h"
 #include "olap/options.h"
@@ -42,6 +43,7 @@
 #include "util/async_io.h"
 #include "util/debug_points.h"
 #include "util/doris_metrics.h"
+#include "util/time.h"
 
 namespace doris {
 namespace io {
@@ -144,6 +146,17 @@ Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_
 
     LIMIT_LOCAL_SCAN_IO(get_data_dir_path(), bytes_read);
 
+    // compaction reads are limited by the compaction io limiter of the data dir, while the
+    // latency of the other reads tells it how busy the disk is
+    auto compaction_io_class = CompactionIOLimiter::current_io_class();
+    int64_t read_start_us = 0;
+    if (compaction_io_class != CompactionIOClass::NONE) {
+        CompactionIOLimiter::instance()->acquire(get_data_dir_path(), compaction_io_class,
+                                                 bytes_req);
+    } else if (CompactionIOLimiter::enabled()) {
+        read_start_us = MonotonicMicros();
+    }
+
     while (bytes_req != 0) {
         auto res = SYNC_POINT_HOOK_RETURN_VALUE(::pread(_fd, to, bytes_req, offset),
                                                 "LocalFileReader::pread", _fd, to);
@@ -169,6 +182,10 @@ Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_
             *bytes_read += res;
         }
     }
+    if (read_start_us > 0) {
+        CompactionIOLimiter::instance()->record_query_read(get_data_dir_path(),
+                                                           MonotonicMicros() - read_start_us);
+    }
     DorisMetrics::instance()->local_bytes_read_total->increment(*bytes_read);
     return Status::OK();
 }
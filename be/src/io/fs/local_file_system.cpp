@@ -85,9 +85,6 @@ Status LocalFileSystem::open_file_impl(const Path& file, FileReaderSPtr* reader,
     TEST_SYNC_POINT_RETURN_WITH_VALUE("LocalFileSystem::open_file_impl",
                                       Status::IOError("inject io error"));
     int64_t fsize = opts ? opts->file_size : -1;
-    if (fsize < 0) {
-        RETURN_IF_ERROR(file_size_impl(file, &fsize));
-    }
     int fd = -1;
     RETRY_ON_EINTR(fd, open(file.c_str(), O_RDONLY));
     DBUG_EXECUTE_IF("LocalFileSystem.create_file_impl.open_file_failed", {
@@ -104,6 +101,22 @@ Status LocalFileSystem::open_file_impl(const Path& file, FileReaderSPtr* reader,
     if (fd < 0) {
         return localfs_error(errno, fmt::format("failed to open {}", file.native()));
     }
+    if (fsize < 0) {
+        // fstat the opened fd instead of stat-ing the path beforehand, which saves a path
+        // lookup on every open of a small file such as a file cache block
+        struct stat st;
+        int err = 0;
+        if (-1 == ::fstat(fd, &st)) [[unlikely]] {
+            err = errno;
+        } else if (!S_ISREG(st.st_mode)) [[unlikely]] {
+            err = EISDIR;
+        }
+        if (err != 0) [[unlikely]] {
+            ::close(fd);
+            return localfs_error(err, fmt::format("failed to get file size {}", file.native()));
+        }
+        fsize = st.st_size;
+    }
     *reader = std::make_shared<LocalFileReader>(file, fsize, fd);
     return Status::OK();
 }
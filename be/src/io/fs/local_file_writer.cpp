@@ -36,8 +36,10 @@
 #include "cpp/sync_point.h"
 #include "io/fs/err_utils.h"
 #include "io/fs/file_writer.h"
+#include "io/fs/local_file_reader.h"
 #include "io/fs/local_file_system.h"
 #include "io/fs/path.h"
+#include "olap/compaction_io_limiter.h"
 #include "olap/data_dir.h"
 #include "util/debug_points.h"
 #include "util/doris_metrics.h"
@@ -69,6 +71,7 @@ Status sync_dir(const io::Path& dirname) {
 
 LocalFileWriter::LocalFileWriter(Path path, int fd, bool sync_data)
         : _path(std::move(path)), _fd(fd), _sync_data(sync_data) {
+    BeConfDataDirReader::get_data_dir_by_file_path(&_path, &_data_dir_path);
     DorisMetrics::instance()->local_file_open_writing->increment(1);
     DorisMetrics::instance()->local_file_writer_total->increment(1);
 }
@@ -136,6 +139,10 @@ Status LocalFileWriter::appendv(const Slice* data, size_t data_cnt) {
         bytes_req += result.size;
         iov[i] = {result.data, result.size};
     }
+    auto compaction_io_class = CompactionIOLimiter::current_io_class();
+    if (compaction_io_class != CompactionIOClass::NONE) {
+        CompactionIOLimiter::instance()->acquire(_data_dir_path, compaction_io_class, bytes_req);
+    }
 
     size_t completed_iov = 0;
     size_t n_left = bytes_req;
@@ -186,6 +193,29 @@ Status LocalFileWriter::appendv(const Slice* data, size_t data_cnt) {
     return Status::OK();
 }
 
+Status LocalFileWriter::sync_data() {
+    if (_state != State::OPENED) [[unlikely]] {
+        return Status::InternalError("sync closed file: {}", _path.native());
+    }
+    if (_dirty) {
+#ifdef __APPLE__
+        if (fcntl(_fd, F_FULLFSYNC) < 0) [[unlikely]] {
+            return localfs_error(errno, fmt::format("failed to sync {}", _path.native()));
+        }
+#else
+        if (0 != ::fdatasync(_fd)) [[unlikely]] {
+            return localfs_error(errno, fmt::format("failed to sync {}", _path.native()));
+        }
+#endif
+        _dirty = false;
+    }
+    if (!_dir_synced) {
+        RETURN_IF_ERROR(sync_dir(_path.parent_path()));
+        _dir_synced = true;
+    }
+    return Status::OK();
+}
+
 // TODO(ByteYue): Refactor this function as FileWriter::flush()
 Status LocalFileWriter::_finalize() {
     TEST_SYNC_POINT_RETURN_WITH_VALUE("LocalFileWriter::finalize",
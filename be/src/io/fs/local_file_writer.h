@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstddef>
+#include <string>
 
 #include "common/status.h"
 #include "io/fs/file_writer.h"
@@ -40,14 +41,20 @@ public:
 
     Status close(bool non_block = false) override;
 
+    // Make the data appended so far durable without closing the file.
+    Status sync_data();
+
 private:
     Status _finalize();
     void _abort();
     Status _close(bool sync);
 
     Path _path;
+    std::string _data_dir_path; // be conf's data dir path
     int _fd; // owned
     bool _dirty = false;
+    // whether the entry of the file in its directory is durable
+    bool _dir_synced = false;
     const bool _sync_data = true;
     size_t _bytes_appended = 0;
     State _state {State::OPENED};
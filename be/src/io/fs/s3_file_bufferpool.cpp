@@ -53,6 +53,10 @@ struct Memory : boost::noncopyable, Allocator {
         s3_file_buffer_allocated << -1;
     }
     void alloc(size_t size) { _data = static_cast<char*>(Allocator::alloc(size, 0)); }
+    void grow(size_t size) {
+        _data = static_cast<char*>(Allocator::realloc(_data, _size, size, 0));
+        _size = size;
+    }
     void dealloc() {
         if (_data == nullptr) {
             return;
@@ -66,7 +70,7 @@ struct Memory : boost::noncopyable, Allocator {
 
 struct FileBuffer::PartData {
     Memory<> _memory;
-    PartData() : _memory(config::s3_write_buffer_size) {}
+    explicit PartData(size_t size) : _memory(size) {}
     ~PartData() = default;
     [[nodiscard]] Slice data() const { return Slice {_memory._data, _memory._size}; }
     [[nodiscard]] size_t size() const { return _memory._size; }
@@ -77,13 +81,13 @@ Slice FileBuffer::get_slice() const {
 }
 
 FileBuffer::FileBuffer(BufferType type, std::function<FileBlocksHolderPtr()> alloc_holder,
-                       size_t offset, OperationState state)
+                       size_t offset, OperationState state, size_t capacity)
         : _type(type),
           _alloc_holder(std::move(alloc_holder)),
           _offset(offset),
           _size(0),
           _state(std::move(state)),
-          _inner_data(std::make_unique<FileBuffer::PartData>()),
+          _inner_data(std::make_unique<FileBuffer::PartData>(capacity)),
           _capacity(_inner_data->size()) {}
 
 FileBuffer::~FileBuffer() {
@@ -98,6 +102,14 @@ FileBuffer::~FileBuffer() {
 Status UploadFileBuffer::append_data(const Slice& data) {
     TEST_SYNC_POINT_RETURN_WITH_VALUE("UploadFileBuffer::append_data", Status::OK(), this,
                                       data.get_size());
+    if (_size + data.get_size() > _capacity) [[unlikely]] {
+        // Buffers of small files start small, grow it by doubling up to the part size
+        size_t capacity = std::max(_size + data.get_size(),
+                                   std::min<size_t>(_capacity * 2, config::s3_write_buffer_size));
+        SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(ExecEnv::GetInstance()->s3_file_buffer_tracker());
+        RETURN_IF_CATCH_EXCEPTION(_inner_data->_memory.grow(capacity));
+        _capacity = capacity;
+    }
     std::memcpy((void*)(_inner_data->data().get_data() + _size), data.get_data(), data.get_size());
     _size += data.get_size();
     _crc_value = crc32c::Extend(_crc_value, data.get_data(), data.get_size());
@@ -244,9 +256,10 @@ Status FileBufferBuilder::build(std::shared_ptr<FileBuffer>* buf) {
     OperationState state(_sync_after_complete_task, _is_cancelled);
 
     if (_type == BufferType::UPLOAD) {
+        size_t capacity = std::min<size_t>(_capacity, config::s3_write_buffer_size);
         RETURN_IF_CATCH_EXCEPTION(*buf = std::make_shared<UploadFileBuffer>(
                                           std::move(_upload_cb), std::move(state), _offset,
-                                          std::move(_alloc_holder_cb)));
+                                          std::move(_alloc_holder_cb), capacity));
         return Status::OK();
     }
     if (_type == BufferType::DOWNLOAD) {
@@ -29,18 +29,24 @@
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
 #include <utility>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "io/fs/err_utils.h"
 #include "io/fs/obj_storage_client.h"
 #include "io/fs/s3_common.h"
+#include "runtime/exec_env.h"
 #include "runtime/thread_context.h"
 #include "runtime/workload_management/io_throttle.h"
 #include "util/bvar_helper.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
 #include "util/s3_util.h"
+#include "util/threadpool.h"
+#include "util/time.h"
 
 namespace doris::io {
 
@@ -56,6 +62,73 @@ bvar::PerSecond<bvar::Adder<uint64_t>> s3_read_througthput("s3_file_reader", "s3
 // record successfull request, and s3_get_request_qps will record all request.
 bvar::PerSecond<bvar::Adder<uint64_t>> s3_get_request_qps("s3_file_reader", "s3_get_request",
                                                           &s3_file_reader_read_counter);
+bvar::LatencyRecorder s3_get_latency_us("s3_file_reader", "get_latency_us");
+bvar::Adder<uint64_t> s3_file_reader_hedged_counter("s3_file_reader", "hedged_get_request");
+bvar::Adder<uint64_t> s3_file_reader_hedged_win_counter("s3_file_reader",
+                                                        "hedged_get_request_win");
+
+namespace {
+// Number of the get requests and the hedged ones, used to budget the hedged requests
+std::atomic<int64_t> s_get_request_num {0};
+std::atomic<int64_t> s_hedged_request_num {0};
+
+// The state shared by the original request and the hedged one. Both of them read into their
+// own buffer, since the slower one may still be running after the reader has returned.
+struct HedgedGetState {
+    struct Attempt {
+        std::unique_ptr<char[]> buffer;
+        ObjectStorageResponse resp;
+        size_t bytes_read = 0;
+        bool done = false;
+    };
+    std::mutex mtx;
+    std::condition_variable cv;
+    Attempt attempts[2];
+};
+
+ObjectStorageResponse timed_get_object(ObjStorageClient* client, const std::string& bucket,
+                                       const std::string& key, char* to, size_t offset,
+                                       size_t bytes_req, size_t* bytes_read) {
+    int64_t start_us = MonotonicMicros();
+    // clang-format off
+    auto resp = client->get_object({ .bucket = bucket, .key = key, },
+            to, offset, bytes_req, bytes_read);
+    // clang-format on
+    if (resp.status.code == ErrorCode::OK) {
+        s3_get_latency_us << (MonotonicMicros() - start_us);
+    }
+    return resp;
+}
+
+Status submit_attempt(const std::shared_ptr<HedgedGetState>& state, int idx,
+                      std::shared_ptr<ObjStorageClient> client, std::string bucket,
+                      std::string key, size_t offset, size_t bytes_req) {
+    auto* pool = ExecEnv::GetInstance()->s3_file_system_thread_pool();
+    if (pool == nullptr) {
+        return Status::InternalError("s3 file system thread pool is not initialized");
+    }
+    state->attempts[idx].buffer.reset(new char[bytes_req]);
+    auto st = pool->submit_func([state, idx, client = std::move(client),
+                                 bucket = std::move(bucket), key = std::move(key), offset,
+                                 bytes_req]() {
+        auto& attempt = state->attempts[idx];
+        size_t bytes_read = 0;
+        auto resp = timed_get_object(client.get(), bucket, key, attempt.buffer.get(), offset,
+                                     bytes_req, &bytes_read);
+        {
+            std::lock_guard lock(state->mtx);
+            attempt.resp = std::move(resp);
+            attempt.bytes_read = bytes_read;
+            attempt.done = true;
+        }
+        state->cv.notify_all();
+    });
+    if (!st.ok()) {
+        state->attempts[idx].buffer.reset();
+    }
+    return st;
+}
+} // namespace
 
 Result<FileReaderSPtr> S3FileReader::create(std::shared_ptr<const ObjClientHolder> client,
                                             std::string bucket, std::string key, int64_t file_size,
@@ -134,10 +207,7 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
     while (retry_count <= max_retries) {
         *bytes_read = 0;
         s3_file_reader_read_counter << 1;
-        // clang-format off
-        auto resp = client->get_object( { .bucket = _bucket, .key = _key, },
-                to, offset, bytes_req, bytes_read);
-        // clang-format on
+        auto resp = _get_object(client, to, offset, bytes_req, bytes_read);
         _s3_stats.total_get_request_counter++;
         if (resp.status.code != ErrorCode::OK) {
             if (resp.http_code ==
@@ -183,6 +253,62 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
     return Status::InternalError(msg);
 }
 
+ObjectStorageResponse S3FileReader::_get_object(const std::shared_ptr<ObjStorageClient>& client,
+                                               char* to, size_t offset, size_t bytes_req,
+                                               size_t* bytes_read) {
+    s_get_request_num.fetch_add(1, std::memory_order_relaxed);
+    if (!config::enable_s3_read_hedging) {
+        return timed_get_object(client.get(), _bucket, _key, to, offset, bytes_req, bytes_read);
+    }
+
+    auto state = std::make_shared<HedgedGetState>();
+    if (!submit_attempt(state, 0, client, _bucket, _key, offset, bytes_req).ok()) {
+        return timed_get_object(client.get(), _bucket, _key, to, offset, bytes_req, bytes_read);
+    }
+    int64_t delay_us = std::max<int64_t>(s3_get_latency_us.latency_percentile(0.95),
+                                         config::s3_read_hedge_min_delay_ms * 1000L);
+    std::unique_lock lock(state->mtx);
+    if (!state->cv.wait_for(lock, std::chrono::microseconds(delay_us),
+                            [&] { return state->attempts[0].done; })) {
+        // Only hedge while the hedged requests stay within the budget
+        int64_t hedged_num = s_hedged_request_num.load(std::memory_order_relaxed);
+        if (hedged_num * 100 <
+            s_get_request_num.load(std::memory_order_relaxed) * config::s3_read_hedge_max_percent) {
+            lock.unlock();
+            if (submit_attempt(state, 1, client, _bucket, _key, offset, bytes_req).ok()) {
+                s_hedged_request_num.fetch_add(1, std::memory_order_relaxed);
+                s3_file_reader_hedged_counter << 1;
+                _s3_stats.hedged_get_request_counter++;
+            }
+            lock.lock();
+        }
+    }
+    // Take the first successful attempt, or the original one if none of them succeeds
+    bool hedged = state->attempts[1].buffer != nullptr;
+    int winner = -1;
+    state->cv.wait(lock, [&] {
+        const auto& [original, hedge] = state->attempts;
+        if (original.done && original.resp.status.code == ErrorCode::OK) {
+            winner = 0;
+        } else if (hedged && hedge.done && hedge.resp.status.code == ErrorCode::OK) {
+            winner = 1;
+        } else if (original.done && (!hedged || hedge.done)) {
+            winner = 0;
+        }
+        return winner >= 0;
+    });
+    auto& attempt = state->attempts[winner];
+    if (winner == 1) {
+        s3_file_reader_hedged_win_counter << 1;
+        _s3_stats.hedged_get_request_win_counter++;
+    }
+    *bytes_read = attempt.bytes_read;
+    if (attempt.resp.status.code == ErrorCode::OK) {
+        memcpy(to, attempt.buffer.get(), attempt.bytes_read);
+    }
+    return attempt.resp;
+}
+
 void S3FileReader::_collect_profile_before_close() {
     if (_profile != nullptr) {
         const char* s3_profile_name = "S3Profile";
@@ -195,11 +321,17 @@ void S3FileReader::_collect_profile_before_close() {
                 _profile, "TooManyRequestSleepTime", TUnit::TIME_MS, s3_profile_name);
         RuntimeProfile::Counter* total_bytes_read =
                 ADD_CHILD_COUNTER(_profile, "TotalBytesRead", TUnit::BYTES, s3_profile_name);
+        RuntimeProfile::Counter* hedged_get_request_counter =
+                ADD_CHILD_COUNTER(_profile, "HedgedGetRequest", TUnit::UNIT, s3_profile_name);
+        RuntimeProfile::Counter* hedged_get_request_win_counter =
+                ADD_CHILD_COUNTER(_profile, "HedgedGetRequestWin", TUnit::UNIT, s3_profile_name);
 
         COUNTER_UPDATE(total_get_request_counter, _s3_stats.total_get_request_counter);
         COUNTER_UPDATE(too_many_request_err_counter, _s3_stats.too_many_request_err_counter);
         COUNTER_UPDATE(too_many_request_sleep_time, _s3_stats.too_many_request_sleep_time_ms);
         COUNTER_UPDATE(total_bytes_read, _s3_stats.total_bytes_read);
+        COUNTER_UPDATE(hedged_get_request_counter, _s3_stats.hedged_get_request_counter);
+        COUNTER_UPDATE(hedged_get_request_win_counter, _s3_stats.hedged_get_request_win_counter);
     }
 }
 
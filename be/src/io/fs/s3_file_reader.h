@@ -33,6 +33,7 @@ class RuntimeProfile;
 
 namespace io {
 struct IOContext;
+struct ObjectStorageResponse;
 
 class S3FileReader final : public FileReader {
 public:
@@ -60,11 +61,17 @@ protected:
     void _collect_profile_before_close() override;
 
 private:
+    // Issue the get request, hedged by a duplicate one if it takes too long
+    ObjectStorageResponse _get_object(const std::shared_ptr<ObjStorageClient>& client, char* to,
+                                      size_t offset, size_t bytes_req, size_t* bytes_read);
+
     struct S3Statistics {
         int64_t total_get_request_counter = 0;
         int64_t too_many_request_err_counter = 0;
         int64_t too_many_request_sleep_time_ms = 0;
         int64_t total_bytes_read = 0;
+        int64_t hedged_get_request_counter = 0;
+        int64_t hedged_get_request_win_counter = 0;
     };
     Path _path;
     size_t _file_size;
@@ -50,6 +50,8 @@ bvar::Adder<uint64_t> s3_file_being_written("s3_file_writer_file_being_written")
 bvar::Adder<uint64_t> s3_file_writer_async_close_queuing("s3_file_writer_async_close_queuing");
 bvar::Adder<uint64_t> s3_file_writer_async_close_processing(
         "s3_file_writer_async_close_processing");
+// The initial capacity of the buffer of the first part
+static constexpr size_t s3_first_buffer_capacity = 64 * 1024;
 
 S3FileWriter::S3FileWriter(std::shared_ptr<ObjClientHolder> client, std::string bucket,
                            std::string key, const FileWriterOptions* opts)
@@ -182,6 +184,10 @@ Status S3FileWriter::_build_upload_buffer() {
                 _upload_one_part(part_num, buf);
             })
             .set_file_offset(_bytes_appended)
+            // Most of the files fit in one part, so the first buffer starts small and grows
+            // when more data comes
+            .set_capacity(_cur_part_num == 1 ? s3_first_buffer_capacity
+                                             : config::s3_write_buffer_size)
             .set_sync_after_complete_task([this](auto&& PH1) {
                 return _complete_part_task_callback(std::forward<decltype(PH1)>(PH1));
             })
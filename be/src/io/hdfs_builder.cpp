@@ -197,6 +197,28 @@ THdfsParams parse_properties(const std::map<std::string, std::string>& propertie
     return hdfsParams;
 }
 
+// Apply the BE level defaults of hedged and short-circuit reads, the conf of the file system
+// takes precedence over them.
+static void set_default_read_conf(HDFSCommonBuilder* builder) {
+    auto set_if_absent = [&](const std::string& key, const std::string& val) {
+        if (builder->get_hdfs_conf_value(key, "").empty()) {
+            builder->set_hdfs_conf(key, val);
+            hdfsBuilderConfSetStr(builder->get(), key.c_str(), val.c_str());
+        }
+    };
+    if (config::hdfs_hedged_read_threadpool_size > 0) {
+        set_if_absent("dfs.client.hedged.read.threadpool.size",
+                      std::to_string(config::hdfs_hedged_read_threadpool_size));
+        set_if_absent("dfs.client.hedged.read.threshold.millis",
+                      std::to_string(config::hdfs_hedged_read_threshold_ms));
+    }
+    if (!config::hdfs_short_circuit_domain_socket_path.empty() &&
+        builder->get_hdfs_conf_value("dfs.client.read.shortcircuit", "").empty()) {
+        set_if_absent("dfs.client.read.shortcircuit", "true");
+        set_if_absent("dfs.domain.socket.path", config::hdfs_short_circuit_domain_socket_path);
+    }
+}
+
 Status create_hdfs_builder(const THdfsParams& hdfsParams, const std::string& fs_name,
                            HDFSCommonBuilder* builder) {
     RETURN_IF_ERROR(builder->init_hdfs_builder());
@@ -217,6 +239,7 @@ Status create_hdfs_builder(const THdfsParams& hdfsParams, const std::string& fs_
         }
         builder->set_hdfs_conf_to_hdfs_builder();
     }
+    set_default_read_conf(builder);
 
     if (auth_type == "kerberos") {
         // set kerberos conf
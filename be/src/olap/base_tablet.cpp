@@ -23,6 +23,7 @@
 
 #include <cstdint>
 #include <iterator>
+#include <numeric>
 #include <random>
 #include <shared_mutex>
 
@@ -544,6 +545,120 @@ Status BaseTablet::lookup_row_key(const Slice& encoded_key, TabletSchema* latest
     return Status::Error<ErrorCode::KEY_NOT_FOUND>("can't find key in all rowsets");
 }
 
+Status BaseTablet::lookup_row_keys(const std::vector<Slice>& encoded_keys,
+                                   TabletSchema* latest_schema, bool with_seq_col,
+                                   const std::vector<RowsetSharedPtr>& specified_rowsets,
+                                   uint32_t version,
+                                   std::vector<std::unique_ptr<SegmentCacheHandle>>& segment_caches,
+                                   std::vector<Status>* results,
+                                   std::vector<RowLocation>* row_locations,
+                                   std::vector<RowsetSharedPtr>* rowsets, bool with_rowid,
+                                   OlapReaderStatistics* stats, DeleteBitmapPtr delete_bitmap) {
+    size_t num_keys = encoded_keys.size();
+    results->assign(num_keys,
+                    Status::Error<ErrorCode::KEY_NOT_FOUND, false>("can't find key in all rowsets"));
+    row_locations->assign(num_keys, RowLocation());
+    rowsets->assign(num_keys, nullptr);
+    if (num_keys == 0) {
+        return Status::OK();
+    }
+
+    size_t seq_col_length = 0;
+    // use the latest tablet schema to decide if the tablet has sequence column currently
+    const TabletSchema* schema =
+            (latest_schema == nullptr ? _tablet_meta->tablet_schema().get() : latest_schema);
+    if (schema->has_sequence_col() && with_seq_col) {
+        seq_col_length = schema->column(schema->sequence_col_idx()).length() + 1;
+    }
+    size_t rowid_length = 0;
+    if (with_rowid && !schema->cluster_key_uids().empty()) {
+        rowid_length = PrimaryKeyIndexReader::ROW_ID_LENGTH;
+    }
+    std::vector<Slice> keys_without_seq;
+    keys_without_seq.reserve(num_keys);
+    for (const auto& key : encoded_keys) {
+        keys_without_seq.emplace_back(key.get_data(),
+                                      key.get_size() - seq_col_length - rowid_length);
+    }
+
+    auto tablet_delete_bitmap =
+            delete_bitmap == nullptr ? _tablet_meta->delete_bitmap_ptr() : delete_bitmap;
+    // the keys not found yet, in the order of encoded_keys
+    std::vector<uint32_t> pending(num_keys);
+    std::iota(pending.begin(), pending.end(), 0);
+    // keys found deleted in the current rowset, which skip its remaining segments
+    std::vector<bool> deleted_in_rowset(num_keys, false);
+    std::vector<bool> found(num_keys, false);
+    std::vector<Slice> segment_keys;
+    std::vector<uint32_t> segment_key_ids;
+    std::vector<Status> segment_results;
+    std::vector<RowLocation> segment_locations;
+    for (size_t i = 0; i < specified_rowsets.size() && !pending.empty(); i++) {
+        const auto& rs = specified_rowsets[i];
+        std::vector<KeyBoundsPB> segments_key_bounds;
+        rs->rowset_meta()->get_segments_key_bounds(&segments_key_bounds);
+        int num_segments = cast_set<int>(rs->num_segments());
+        DCHECK_EQ(segments_key_bounds.size(), num_segments);
+        for (int j = num_segments - 1; j >= 0; j--) {
+            segment_keys.clear();
+            segment_key_ids.clear();
+            for (uint32_t id : pending) {
+                if (deleted_in_rowset[id] || found[id] ||
+                    key_is_not_in_segment(keys_without_seq[id], segments_key_bounds[j],
+                                          rs->rowset_meta()->is_segments_key_bounds_truncated())) {
+                    continue;
+                }
+                segment_keys.push_back(encoded_keys[id]);
+                segment_key_ids.push_back(id);
+            }
+            if (segment_keys.empty()) {
+                continue;
+            }
+
+            if (UNLIKELY(segment_caches[i] == nullptr)) {
+                segment_caches[i] = std::make_unique<SegmentCacheHandle>();
+                RETURN_IF_ERROR(SegmentLoader::instance()->load_segments(
+                        std::static_pointer_cast<BetaRowset>(rs), segment_caches[i].get(), true,
+                        true));
+            }
+            auto& segments = segment_caches[i]->get_segments();
+            DCHECK_EQ(segments.size(), num_segments);
+            RETURN_IF_ERROR(segments[j]->lookup_row_keys(segment_keys, schema, with_seq_col,
+                                                         with_rowid, &segment_results,
+                                                         &segment_locations, stats));
+            for (size_t k = 0; k < segment_keys.size(); k++) {
+                const auto& s = segment_results[k];
+                const auto& loc = segment_locations[k];
+                uint32_t id = segment_key_ids[k];
+                if (s.is<KEY_NOT_FOUND>()) {
+                    continue;
+                }
+                if (s.ok() && tablet_delete_bitmap->contains_agg_without_cache(
+                                      {loc.rowset_id, loc.segment_id, version}, loc.row_id)) {
+                    // if has sequence col, we continue to compare the sequence_id of
+                    // all rowsets, util we find an existing key.
+                    if (!schema->has_sequence_col()) {
+                        // The key is deleted, we don't need to search for it in this rowset.
+                        deleted_in_rowset[id] = true;
+                    }
+                    continue;
+                }
+                // `s` is either OK or KEY_ALREADY_EXISTS now.
+                (*results)[id] = s;
+                (*row_locations)[id] = loc;
+                (*rowsets)[id] = rs;
+                found[id] = true;
+            }
+        }
+        std::erase_if(pending, [&](uint32_t id) {
+            deleted_in_rowset[id] = false;
+            return found[id];
+        });
+    }
+    g_tablet_pk_not_found << pending.size();
+    return Status::OK();
+}
+
 // if user pass a token, then all calculation works will submit to a threadpool,
 // user can get all delete bitmaps from that token.
 // if `token` is nullptr, the calculation will run in local, and user can get the result
@@ -661,9 +776,12 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
         if (num_read == batch_size && num_read != remaining) {
             num_read -= 1;
         }
+        std::vector<Slice> keys;
+        std::vector<uint32_t> key_row_ids;
+        keys.reserve(num_read);
+        key_row_ids.reserve(num_read);
         for (size_t i = 0; i < num_read; i++, row_id++) {
             Slice key = Slice(index_column->get_data_at(i).data, index_column->get_data_at(i).size);
-            RowLocation loc;
             // calculate row id
             if (!_tablet_meta->tablet_schema()->cluster_key_uids().empty()) {
                 size_t seq_col_length = 0;
@@ -704,25 +822,29 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
                 }
             });
 
-            RowsetSharedPtr rowset_find;
-            Status st = Status::OK();
-            if (tablet_delete_bitmap == nullptr) {
-                st = lookup_row_key(key, rowset_schema.get(), true, specified_rowsets, &loc,
-                                    cast_set<uint32_t>(dummy_version.first - 1), segment_caches,
-                                    &rowset_find);
-            } else {
-                st = lookup_row_key(key, rowset_schema.get(), true, specified_rowsets, &loc,
-                                    cast_set<uint32_t>(dummy_version.first - 1), segment_caches,
-                                    &rowset_find, true, nullptr, nullptr, tablet_delete_bitmap);
-            }
-            bool expected_st = st.ok() || st.is<KEY_NOT_FOUND>() || st.is<KEY_ALREADY_EXISTS>();
-            // It's a defensive DCHECK, we need to exclude some common errors to avoid core-dump
-            // while stress test
-            DCHECK(expected_st || st.is<MEM_LIMIT_EXCEEDED>())
-                    << "unexpected error status while lookup_row_key:" << st;
-            if (!expected_st) {
-                return st;
-            }
+            keys.push_back(key);
+            key_row_ids.push_back(row_id);
+        }
+
+        // the keys are read in the order of primary key index, so they are sorted and are
+        // looked up in one pass over each segment of the specified rowsets
+        std::vector<Status> lookup_results;
+        std::vector<RowLocation> locations;
+        std::vector<RowsetSharedPtr> rowsets_find;
+        Status lookup_st = lookup_row_keys(keys, rowset_schema.get(), true, specified_rowsets,
+                                           cast_set<uint32_t>(dummy_version.first - 1),
+                                           segment_caches, &lookup_results, &locations,
+                                           &rowsets_find, true, nullptr, tablet_delete_bitmap);
+        // It's a defensive DCHECK, we need to exclude some common errors to avoid core-dump
+        // while stress test
+        DCHECK(lookup_st.ok() || lookup_st.is<MEM_LIMIT_EXCEEDED>())
+                << "unexpected error status while lookup_row_keys:" << lookup_st;
+        RETURN_IF_ERROR(lookup_st);
+        for (size_t k = 0; k < keys.size(); k++) {
+            uint32_t key_row_id = key_row_ids[k];
+            const Status& st = lookup_results[k];
+            const RowLocation& loc = locations[k];
+            const RowsetSharedPtr& rowset_find = rowsets_find[k];
             if (st.is<KEY_NOT_FOUND>()) {
                 continue;
             }
@@ -744,7 +866,7 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
                 //     - Otherwise, we should combine the values of the missing columns in the previous row and the values
                 //       of the including columns in the current row into a new row.
                 delete_bitmap->add({rowset_id, seg->id(), DeleteBitmap::TEMP_VERSION_COMMON},
-                                   row_id);
+                                   key_row_id);
                 continue;
                 // NOTE: for partial update which doesn't specify the sequence column, we can't use the sequence column value filled in flush phase
                 // as its final value. Otherwise it may cause inconsistency between replicas.
@@ -764,7 +886,8 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
                 // and read non sort key columns from previous rowsets to create the final block
                 // So we only need to record rows to read for both mode partial update
                 read_plan_ori.prepare_to_read(loc, pos);
-                read_plan_update.prepare_to_read(RowLocation {rowset_id, seg->id(), row_id}, pos);
+                read_plan_update.prepare_to_read(RowLocation {rowset_id, seg->id(), key_row_id},
+                                                 pos);
 
                 // For flexible partial update, we should use skip bitmap to determine wheather
                 // a row has specified the sequence column. But skip bitmap should be read from the segment.
@@ -789,7 +912,7 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
                         {loc.rowset_id, loc.segment_id, DeleteBitmap::TEMP_VERSION_COMMON},
                         loc.row_id);
                 delete_bitmap->add({rowset_id, seg->id(), DeleteBitmap::TEMP_VERSION_COMMON},
-                                   row_id);
+                                   key_row_id);
                 ++new_generated_rows;
                 continue;
             }
@@ -170,6 +170,19 @@ public:
                           OlapReaderStatistics* stats = nullptr,
                           DeleteBitmapPtr tablet_delete_bitmap = nullptr);
 
+    // Lookup the row locations of a batch of keys like lookup_row_key, (*results)[i] is the
+    // status lookup_row_key returns for encoded_keys[i], and (*row_locations)[i] and
+    // (*rowsets)[i] are set like its row_location and rowset. Keys are expected in ascending
+    // order, each segment is then searched for all of its candidate keys in one pass.
+    Status lookup_row_keys(const std::vector<Slice>& encoded_keys, TabletSchema* latest_schema,
+                           bool with_seq_col, const std::vector<RowsetSharedPtr>& specified_rowsets,
+                           uint32_t version,
+                           std::vector<std::unique_ptr<SegmentCacheHandle>>& segment_caches,
+                           std::vector<Status>* results, std::vector<RowLocation>* row_locations,
+                           std::vector<RowsetSharedPtr>* rowsets, bool with_rowid = true,
+                           OlapReaderStatistics* stats = nullptr,
+                           DeleteBitmapPtr tablet_delete_bitmap = nullptr);
+
     // calc delete bitmap when flush memtable, use a fake version to calc
     // For example, cur max version is 5, and we use version 6 to calc but
     // finally this rowset publish version with 8, we should make up data
@@ -381,6 +394,10 @@ public:
     std::atomic<int64_t> read_block_count = 0;
     std::atomic<int64_t> write_count = 0;
     std::atomic<int64_t> compaction_count = 0;
+    // scans of queries and the rows they merged or dropped by delete bitmap since the last
+    // compaction, the read amplification compaction would remove
+    std::atomic<int64_t> scan_count_since_compaction = 0;
+    std::atomic<int64_t> merged_rows_since_compaction = 0;
 
     CompactionStage compaction_stage = CompactionStage::NOT_SCHEDULED;
     std::mutex sample_info_lock;
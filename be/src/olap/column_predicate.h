@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <roaring/roaring.hh>
 
@@ -26,6 +27,7 @@
 #include "olap/rowset/segment_v2/inverted_index_iterator.h"
 #include "runtime/define_primitive_type.h"
 #include "util/runtime_profile.h"
+#include "util/simd/bits.h"
 #include "vec/columns/column.h"
 #include "vec/exprs/vruntimefilter_wrapper.h"
 
@@ -142,19 +144,44 @@ struct PredicateTypeTraits {
     }
 };
 
-#define EVALUATE_BY_SELECTOR(EVALUATE_IMPL_WITH_NULL_MAP, EVALUATE_IMPL_WITHOUT_NULL_MAP) \
-    const bool is_dense_column = pred_col.size() == size;                                 \
-    for (uint16_t i = 0; i < size; i++) {                                                 \
-        uint16_t idx = is_dense_column ? i : sel[i];                                      \
-        if constexpr (is_nullable) {                                                      \
-            if (EVALUATE_IMPL_WITH_NULL_MAP(idx)) {                                       \
-                sel[new_size++] = idx;                                                    \
-            }                                                                             \
-        } else {                                                                          \
-            if (EVALUATE_IMPL_WITHOUT_NULL_MAP(idx)) {                                    \
-                sel[new_size++] = idx;                                                    \
-            }                                                                             \
-        }                                                                                 \
+// Rows of a dense column are evaluated in batches of this size into a byte mask first.
+constexpr uint16_t DENSE_EVALUATE_BATCH_SIZE = 256;
+
+// For a dense column (no selection yet) the predicate is evaluated without branches into a byte
+// mask, which the compiler can vectorize for fixed width types and dictionary codes, and the mask
+// is then turned into positions with SIMD. Otherwise the positions in `sel` are evaluated one by
+// one.
+#define EVALUATE_BY_SELECTOR(EVALUATE_IMPL_WITH_NULL_MAP, EVALUATE_IMPL_WITHOUT_NULL_MAP)          \
+    const bool is_dense_column = pred_col.size() == size;                                          \
+    if (is_dense_column) {                                                                         \
+        uint8_t evaluate_flags[DENSE_EVALUATE_BATCH_SIZE];                                         \
+        for (uint32_t from = 0; from < size; from += DENSE_EVALUATE_BATCH_SIZE) {                  \
+            const auto batch_size = static_cast<uint16_t>(                                         \
+                    std::min<uint32_t>(DENSE_EVALUATE_BATCH_SIZE, size - from));                   \
+            for (uint16_t j = 0; j < batch_size; j++) {                                            \
+                const auto idx = static_cast<uint16_t>(from + j);                                  \
+                if constexpr (is_nullable) {                                                       \
+                    evaluate_flags[j] = static_cast<uint8_t>(EVALUATE_IMPL_WITH_NULL_MAP(idx));    \
+                } else {                                                                           \
+                    evaluate_flags[j] = static_cast<uint8_t>(EVALUATE_IMPL_WITHOUT_NULL_MAP(idx)); \
+                }                                                                                  \
+            }                                                                                      \
+            new_size += simd::bytes_mask_to_indexes(evaluate_flags, batch_size,                    \
+                                                    static_cast<uint16_t>(from), sel + new_size);  \
+        }                                                                                          \
+    } else {                                                                                       \
+        for (uint16_t i = 0; i < size; i++) {                                                      \
+            uint16_t idx = sel[i];                                                                 \
+            if constexpr (is_nullable) {                                                           \
+                if (EVALUATE_IMPL_WITH_NULL_MAP(idx)) {                                            \
+                    sel[new_size++] = idx;                                                         \
+                }                                                                                  \
+            } else {                                                                               \
+                if (EVALUATE_IMPL_WITHOUT_NULL_MAP(idx)) {                                         \
+                    sel[new_size++] = idx;                                                         \
+                }                                                                                  \
+            }                                                                                      \
+        }                                                                                          \
     }
 
 class ColumnPredicate {
@@ -39,6 +39,7 @@
 #include "cloud/cloud_meta_mgr.h"
 #include "cloud/cloud_storage_engine.h"
 #include "cloud/cloud_tablet.h"
+#include "cloud/cloud_tablet_hotspot.h"
 #include "common/config.h"
 #include "common/status.h"
 #include "cpp/sync_point.h"
@@ -47,6 +48,7 @@
 #include "io/fs/file_writer.h"
 #include "io/fs/remote_file_system.h"
 #include "io/io_common.h"
+#include "olap/compaction_io_limiter.h"
 #include "olap/cumulative_compaction.h"
 #include "olap/cumulative_compaction_policy.h"
 #include "olap/cumulative_compaction_time_series_policy.h"
@@ -458,8 +460,16 @@ Status CompactionMixin::execute_compact() {
         data_dir->disks_compaction_num_increment(-1);
     };
 
-    HANDLE_EXCEPTION_IF_CATCH_EXCEPTION(execute_compact_impl(permits), record_compaction_stats);
+    {
+        CompactionIOLimiter::ScopedIOClass io_class(
+                CompactionIOLimiter::io_class_of(compaction_type()));
+        HANDLE_EXCEPTION_IF_CATCH_EXCEPTION(execute_compact_impl(permits),
+                                            record_compaction_stats);
+    }
     record_compaction_stats(doris::Exception());
+    // the read amplification the reads so far saw is gone
+    _tablet->scan_count_since_compaction.store(0, std::memory_order_relaxed);
+    _tablet->merged_rows_since_compaction.store(0, std::memory_order_relaxed);
 
     if (enable_compaction_checksum) {
         EngineChecksumTask checksum_task(_engine, _tablet->tablet_id(), _tablet->schema_hash(),
@@ -1272,6 +1282,8 @@ Status CompactionMixin::modify_rowsets() {
             tablet()->merge_delete_bitmap(output_rowset_delete_bitmap);
             RETURN_IF_ERROR(tablet()->modify_rowsets(output_rowsets, _input_rowsets, true));
         }
+        // out of the header lock, the output rowset is visible already
+        _tablet->tablet_meta()->delete_bitmap().update_agg_cache(output_rowset_delete_bitmap);
     } else {
         std::lock_guard<std::shared_mutex> wrlock(_tablet->get_header_lock());
         SCOPED_SIMPLE_TRACE_IF_TIMEOUT(TRACE_TABLET_LOCK_THRESHOLD);
@@ -1514,6 +1526,13 @@ Status CloudCompactionMixin::construct_output_rowset_writer(RowsetWriterContext&
     ctx.write_file_cache = (compaction_type() == ReaderType::READER_CUMULATIVE_COMPACTION) ||
                            (config::enable_file_cache_keep_base_compaction_output &&
                             compaction_type() == ReaderType::READER_BASE_COMPACTION);
+    // The output of base compaction replaces cached data of a tablet that is still being
+    // queried, keep it in the cache to avoid running cold after the compaction.
+    if (!ctx.write_file_cache && compaction_type() == ReaderType::READER_BASE_COMPACTION &&
+        config::file_cache_keep_hot_base_compaction_output_sec > 0) {
+        ctx.write_file_cache = _engine.tablet_hotspot().is_recently_accessed(
+                _tablet->tablet_id(), config::file_cache_keep_hot_base_compaction_output_sec);
+    }
     ctx.file_cache_ttl_sec = _tablet->ttl_seconds();
     _output_rs_writer = DORIS_TRY(_tablet->create_rowset_writer(ctx, _is_vertical));
     RETURN_IF_ERROR(
@@ -0,0 +1,158 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/compaction_io_limiter.h"
+
+#include <bvar/bvar.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "common/config.h"
+#include "util/time.h"
+
+namespace doris {
+
+bvar::Adder<int64_t> g_compaction_io_throttle_us("compaction_io_throttle_us");
+
+static thread_local CompactionIOClass tls_compaction_io_class = CompactionIOClass::NONE;
+
+// the part of the bucket a class can not take, indexed by CompactionIOClass
+static constexpr double CLASS_RESERVE_RATIOS[] = {0, 0, 0.25, 0.5};
+static constexpr int64_t ADJUST_INTERVAL_US = 1000 * 1000;
+static constexpr double MIN_RATE_FACTOR = 1.0 / 16;
+static constexpr double RATE_FACTOR_STEP = 1.0 / 8;
+
+CompactionIOLimiter* CompactionIOLimiter::instance() {
+    static CompactionIOLimiter limiter;
+    return &limiter;
+}
+
+int64_t CompactionIOLimiter::config_rate() {
+    return config::compaction_io_bytes_per_second_per_disk;
+}
+
+CompactionIOClass CompactionIOLimiter::current_io_class() {
+    return tls_compaction_io_class;
+}
+
+CompactionIOClass CompactionIOLimiter::io_class_of(ReaderType reader_type) {
+    switch (reader_type) {
+    case ReaderType::READER_CUMULATIVE_COMPACTION:
+        return CompactionIOClass::CUMULATIVE;
+    case ReaderType::READER_BASE_COMPACTION:
+    case ReaderType::READER_FULL_COMPACTION:
+        return CompactionIOClass::BASE;
+    case ReaderType::READER_COLD_DATA_COMPACTION:
+        return CompactionIOClass::COLD_DATA;
+    default:
+        return CompactionIOClass::NONE;
+    }
+}
+
+CompactionIOLimiter::ScopedIOClass::ScopedIOClass(CompactionIOClass io_class)
+        : _prev(tls_compaction_io_class) {
+    tls_compaction_io_class = io_class;
+}
+
+CompactionIOLimiter::ScopedIOClass::~ScopedIOClass() {
+    tls_compaction_io_class = _prev;
+}
+
+CompactionIOLimiter::DiskLimiter* CompactionIOLimiter::_get_disk(const std::string& data_dir) {
+    {
+        std::shared_lock rlock(_disks_lock);
+        auto it = _disks.find(data_dir);
+        if (it != _disks.end()) {
+            return it->second.get();
+        }
+    }
+    std::unique_lock wlock(_disks_lock);
+    auto& disk = _disks[data_dir];
+    if (disk == nullptr) {
+        disk = std::make_unique<DiskLimiter>();
+    }
+    return disk.get();
+}
+
+int64_t CompactionIOLimiter::acquire(const std::string& data_dir, CompactionIOClass io_class,
+                                     int64_t bytes) {
+    int64_t rate = config_rate();
+    if (rate <= 0 || io_class == CompactionIOClass::NONE || data_dir.empty() || bytes <= 0) {
+        return 0;
+    }
+    int64_t sleep_us = _take(_get_disk(data_dir), io_class, bytes, MonotonicMicros(), rate);
+    if (sleep_us > 0) {
+        g_compaction_io_throttle_us << sleep_us;
+        std::this_thread::sleep_for(std::chrono::microseconds(sleep_us));
+    }
+    return sleep_us;
+}
+
+void CompactionIOLimiter::record_query_read(const std::string& data_dir, int64_t latency_us) {
+    if (data_dir.empty()) {
+        return;
+    }
+    auto* disk = _get_disk(data_dir);
+    disk->query_read_us.fetch_add(latency_us, std::memory_order_relaxed);
+    disk->query_reads.fetch_add(1, std::memory_order_relaxed);
+}
+
+int64_t CompactionIOLimiter::_take(DiskLimiter* disk, CompactionIOClass io_class, int64_t bytes,
+                                   int64_t now_us, int64_t rate) {
+    std::lock_guard lock(disk->lock);
+    _adjust_rate(disk, now_us);
+    double cur_rate = static_cast<double>(rate) * disk->rate_factor;
+    // the bucket holds one second of tokens
+    double burst = cur_rate;
+    if (disk->last_refill_us == 0) {
+        disk->tokens = burst;
+    } else if (now_us > disk->last_refill_us) {
+        double elapsed_s = static_cast<double>(now_us - disk->last_refill_us) / 1000 / 1000;
+        disk->tokens = std::min(burst, disk->tokens + cur_rate * elapsed_s);
+    }
+    disk->last_refill_us = std::max(disk->last_refill_us, now_us);
+    disk->tokens -= static_cast<double>(bytes);
+
+    double reserve = burst * CLASS_RESERVE_RATIOS[static_cast<int>(io_class)];
+    if (disk->tokens >= reserve) {
+        return 0;
+    }
+    return static_cast<int64_t>((reserve - disk->tokens) / cur_rate * 1000 * 1000);
+}
+
+void CompactionIOLimiter::_adjust_rate(DiskLimiter* disk, int64_t now_us) {
+    if (disk->last_adjust_us == 0) {
+        disk->last_adjust_us = now_us;
+        return;
+    }
+    if (now_us - disk->last_adjust_us < ADJUST_INTERVAL_US) {
+        return;
+    }
+    disk->last_adjust_us = now_us;
+    int64_t reads = disk->query_reads.exchange(0, std::memory_order_relaxed);
+    int64_t read_us = disk->query_read_us.exchange(0, std::memory_order_relaxed);
+    int64_t threshold_us = config::compaction_io_query_read_latency_threshold_us;
+    if (threshold_us > 0 && reads > 0 && read_us / reads > threshold_us) {
+        disk->rate_factor = std::max(disk->rate_factor / 2, MIN_RATE_FACTOR);
+    } else {
+        disk->rate_factor = std::min(disk->rate_factor + RATE_FACTOR_STEP, 1.0);
+    }
+}
+
+} // namespace doris
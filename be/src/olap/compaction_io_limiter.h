@@ -0,0 +1,107 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "io/io_common.h"
+
+namespace doris {
+
+// The compaction a thread does io for, a higher class gets the bandwidth of a disk first.
+enum class CompactionIOClass : uint8_t {
+    NONE = 0,
+    CUMULATIVE = 1,
+    BASE = 2,
+    COLD_DATA = 3,
+};
+
+/*
+    This class limits the bytes compaction reads from and writes to every data dir, so that
+    compaction does not take the disk from queries. Every data dir has a token bucket filled at
+    config::compaction_io_bytes_per_second_per_disk, holding one second of tokens. An io takes its
+    bytes from the bucket, and sleeps until the bucket is paid back to the reserve of its class:
+    nothing for cumulative compaction, and a part of the bucket for base and cold data compaction,
+    so they slow down first when the disk is busy with compaction.
+    The average latency of the other reads of a data dir is checked every second, the rate of the
+    data dir is halved while it is above config::compaction_io_query_read_latency_threshold_us,
+    and raised back step by step once it is not.
+*/
+class CompactionIOLimiter {
+public:
+    static CompactionIOLimiter* instance();
+
+    // Take `bytes` from the bucket of `data_dir` and sleep if the bucket is in debt,
+    // return the time slept in microseconds.
+    int64_t acquire(const std::string& data_dir, CompactionIOClass io_class, int64_t bytes);
+
+    // Record the latency of a read of `data_dir` done by anything but compaction.
+    void record_query_read(const std::string& data_dir, int64_t latency_us);
+
+    static bool enabled() { return config_rate() > 0; }
+
+    // the class of the compaction the current thread does io for
+    static CompactionIOClass current_io_class();
+
+    static CompactionIOClass io_class_of(ReaderType reader_type);
+
+    // Set the compaction io class of the current thread while in the scope.
+    class ScopedIOClass {
+    public:
+        explicit ScopedIOClass(CompactionIOClass io_class);
+        ~ScopedIOClass();
+
+    private:
+        CompactionIOClass _prev;
+    };
+
+private:
+    struct DiskLimiter {
+        std::mutex lock;
+        // may be negative, the debt is paid by sleeping
+        double tokens = 0;
+        int64_t last_refill_us = 0;
+        // the part of the configured rate in use, lowered while the other reads are slow
+        double rate_factor = 1.0;
+        int64_t last_adjust_us = 0;
+        std::atomic<int64_t> query_read_us {0};
+        std::atomic<int64_t> query_reads {0};
+    };
+
+    static int64_t config_rate();
+
+    DiskLimiter* _get_disk(const std::string& data_dir);
+
+    // Take `bytes` from the bucket at `now_us`, return the time to sleep in microseconds.
+    int64_t _take(DiskLimiter* disk, CompactionIOClass io_class, int64_t bytes, int64_t now_us,
+                  int64_t rate);
+
+    void _adjust_rate(DiskLimiter* disk, int64_t now_us);
+
+    std::shared_mutex _disks_lock;
+    std::unordered_map<std::string, std::unique_ptr<DiskLimiter>> _disks;
+};
+
+} // namespace doris
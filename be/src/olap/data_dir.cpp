@@ -30,12 +30,14 @@
 #include <cstddef>
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <roaring/roaring.hh>
 #include <set>
 #include <sstream>
 #include <string>
 #include <thread>
+#include <tuple>
 #include <utility>
 
 #include "common/config.h"
@@ -61,9 +63,11 @@
 #include "olap/tablet_meta_manager.h"
 #include "olap/txn_manager.h"
 #include "olap/utils.h" // for check_dir_existed
+#include "runtime/thread_context.h"
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
 #include "util/string_util.h"
+#include "util/threadpool.h"
 #include "util/uid_util.h"
 
 namespace doris {
@@ -419,9 +423,10 @@ Status DataDir::load() {
     LOG(INFO) << "begin loading tablet from meta";
     std::set<int64_t> tablet_ids;
     std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](
-                                    int64_t tablet_id, int32_t schema_hash,
-                                    std::string_view value) -> bool {
+    std::mutex tablet_ids_mtx;
+    auto load_one_tablet = [this, &tablet_ids, &failed_tablet_ids, &tablet_ids_mtx](
+                                   int64_t tablet_id, int32_t schema_hash,
+                                   std::string_view value) {
         Status status = _engine.tablet_manager()->load_tablet_from_meta(
                 this, tablet_id, schema_hash, value, false, false, false, false);
         if (!status.ok() && !status.is<TABLE_ALREADY_DELETED_ERROR>() &&
@@ -442,15 +447,61 @@ Status DataDir::load() {
             // failure.
             LOG(WARNING) << "load tablet from header failed. status:" << status
                          << ", tablet=" << tablet_id << "." << schema_hash;
+            std::lock_guard lock(tablet_ids_mtx);
             failed_tablet_ids.insert(tablet_id);
         } else {
+            std::lock_guard lock(tablet_ids_mtx);
             tablet_ids.insert(tablet_id);
         }
+    };
+
+    // Parsing tablet metas and building tablets is cpu bound, so with many tablets in one data
+    // dir they are loaded by a pool in batches while the meta is still being traversed
+    std::unique_ptr<ThreadPool> load_tablet_pool;
+    if (config::load_tablet_meta_threads_per_data_dir > 1) {
+        static_cast<void>(ThreadPoolBuilder("load_tablet_meta")
+                                  .set_min_threads(config::load_tablet_meta_threads_per_data_dir)
+                                  .set_max_threads(config::load_tablet_meta_threads_per_data_dir)
+                                  .build(&load_tablet_pool));
+    }
+    using TabletMetaBatch = std::vector<std::tuple<int64_t, int32_t, std::string>>;
+    constexpr size_t tablet_meta_batch_size = 256;
+    TabletMetaBatch tablet_meta_batch;
+    auto submit_tablet_meta_batch = [&]() {
+        auto batch = std::make_shared<TabletMetaBatch>(std::move(tablet_meta_batch));
+        tablet_meta_batch.clear();
+        auto func = [batch, &load_one_tablet]() {
+            SCOPED_INIT_THREAD_CONTEXT();
+            for (const auto& [tablet_id, schema_hash, value] : *batch) {
+                load_one_tablet(tablet_id, schema_hash, value);
+            }
+        };
+        if (!load_tablet_pool->submit_func(func).ok()) {
+            func();
+        }
+    };
+    auto load_tablet_func = [&](int64_t tablet_id, int32_t schema_hash,
+                                std::string_view value) -> bool {
+        if (load_tablet_pool == nullptr) {
+            load_one_tablet(tablet_id, schema_hash, value);
+            return true;
+        }
+        tablet_meta_batch.emplace_back(tablet_id, schema_hash, std::string(value));
+        if (tablet_meta_batch.size() >= tablet_meta_batch_size) {
+            submit_tablet_meta_batch();
+        }
         return true;
     };
     MonotonicStopWatch tablet_timer;
     tablet_timer.start();
     Status load_tablet_status = TabletMetaManager::traverse_headers(_meta, load_tablet_func);
+    if (load_tablet_pool != nullptr) {
+        if (!tablet_meta_batch.empty()) {
+            submit_tablet_meta_batch();
+        }
+        load_tablet_pool->wait();
+        load_tablet_pool->shutdown();
+    }
     tablet_timer.stop();
     if (!failed_tablet_ids.empty()) {
         LOG(WARNING) << "load tablets from header failed"
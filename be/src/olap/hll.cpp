@@ -17,6 +17,7 @@
 
 #include "olap/hll.h"
 
+#include <array>
 #include <cmath>
 #include <map>
 #include <ostream>
@@ -337,8 +338,18 @@ int64_t HyperLogLog::estimate_cardinality() const {
     float harmonic_mean = 0;
     int num_zero_registers = 0;
 
+    // 2^-r for every possible register value, so the sum below is a table lookup per register
+    // rather than a powf call; the values are produced by powf, so estimates do not change.
+    static const auto inverse_powers_of_two = [] {
+        std::array<float, 256> powers {};
+        for (int r = 0; r < 256; ++r) {
+            powers[r] = powf(2.0F, static_cast<float>(-r));
+        }
+        return powers;
+    }();
+
     for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
-        harmonic_mean += powf(2.0F, -_registers[i]);
+        harmonic_mean += inverse_powers_of_two[_registers[i]];
 
         if (_registers[i] == 0) {
             ++num_zero_registers;
@@ -24,6 +24,7 @@
 #include "io/io_common.h"
 #include "olap/block_column_predicate.h"
 #include "olap/column_predicate.h"
+#include "olap/late_arrival_predicates.h"
 #include "olap/olap_common.h"
 #include "olap/rowset/segment_v2/row_ranges.h"
 #include "olap/tablet_schema.h"
@@ -101,6 +102,8 @@ public:
     bool record_rowids = false;
     std::vector<int> topn_filter_source_node_ids;
     int topn_filter_target_node_id = -1;
+    // used to prune the remaining row ranges when runtime filters arrive late
+    LateArrivalPredicatesSPtr late_arrival_predicates;
     // used for special optimization for query : ORDER BY key DESC LIMIT n
     bool read_orderby_key_reverse = false;
     // columns for orderby keys
@@ -119,6 +122,9 @@ public:
     std::map<std::string, PrimitiveType> target_cast_type_for_variants;
     RowRanges row_ranges;
     size_t topn_limit = 0;
+    // read only the sampled rows of the segment when less than 1, see RowRanges::create_sampled
+    double sample_rate = 1;
+    uint64_t sample_seed = 0;
 };
 
 struct CompactionSampleInfo {
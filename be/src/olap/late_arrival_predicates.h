@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "olap/column_predicate.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+// Column predicates built from runtime filters that arrived after the scanner has
+// already created its segment iterators. The scanner publishes them here and every
+// open segment iterator of that scanner polls `version()` between batches, using the
+// new predicates to prune the row ranges it has not read yet by page zone map.
+//
+// These predicates are only used for pruning. The runtime filter itself is still
+// evaluated row by row as a conjunct, so an iterator that never sees a predicate
+// returns the same result, only slower.
+class LateArrivalPredicates {
+public:
+    LateArrivalPredicates() = default;
+
+    // Takes ownership of `predicates`. Predicates are never removed, so pointers
+    // handed out by `collect` stay valid for the lifetime of this object.
+    void add(std::vector<std::unique_ptr<ColumnPredicate>> predicates) {
+        if (predicates.empty()) {
+            return;
+        }
+        std::lock_guard<std::mutex> l(_lock);
+        for (auto& predicate : predicates) {
+            _predicates.emplace_back(std::move(predicate));
+        }
+        _version.store(_predicates.size(), std::memory_order_release);
+    }
+
+    // Number of predicates published so far, cheap enough to poll once per batch.
+    size_t version() const { return _version.load(std::memory_order_acquire); }
+
+    // Appends the predicates published after `since` to `predicates` and returns the
+    // version they correspond to.
+    size_t collect(size_t since, std::vector<const ColumnPredicate*>* predicates) const {
+        std::lock_guard<std::mutex> l(_lock);
+        for (size_t i = since; i < _predicates.size(); ++i) {
+            predicates->push_back(_predicates[i].get());
+        }
+        return _predicates.size();
+    }
+
+private:
+    mutable std::mutex _lock;
+    std::vector<std::unique_ptr<ColumnPredicate>> _predicates;
+    std::atomic<size_t> _version {0};
+};
+
+using LateArrivalPredicatesSPtr = std::shared_ptr<LateArrivalPredicates>;
+
+#include "common/compile_check_end.h"
+} // namespace doris
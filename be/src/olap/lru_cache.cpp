@@ -4,7 +4,9 @@
 
 #include "olap/lru_cache.h"
 
+#include <algorithm>
 #include <cstdlib>
+#include <limits>
 #include <mutex>
 #include <new>
 #include <sstream>
@@ -27,6 +29,8 @@ DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_lookup_count, MetricUnit::OPERATIONS)
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_hit_count, MetricUnit::OPERATIONS);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_miss_count, MetricUnit::OPERATIONS);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_stampede_count, MetricUnit::OPERATIONS);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_admission_accept_count, MetricUnit::OPERATIONS);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_admission_reject_count, MetricUnit::OPERATIONS);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(cache_hit_ratio, MetricUnit::NOUNIT);
 
 uint32_t CacheKey::hash(const char* data, size_t n, uint32_t seed) const {
@@ -69,6 +73,7 @@ uint32_t CacheKey::hash(const char* data, size_t n, uint32_t seed) const {
 }
 
 HandleTable::~HandleTable() {
+    delete[] _old_list;
     delete[] _list;
 }
 
@@ -78,6 +83,7 @@ LRUHandle* HandleTable::lookup(const CacheKey& key, uint32_t hash) {
 }
 
 LRUHandle* HandleTable::insert(LRUHandle* h) {
+    _migrate(MIGRATE_BUCKETS_PER_OP);
     LRUHandle** ptr = _find_pointer(h->key(), h->hash);
     LRUHandle* old = *ptr;
     h->next_hash = old ? old->next_hash : nullptr;
@@ -96,6 +102,7 @@ LRUHandle* HandleTable::insert(LRUHandle* h) {
 }
 
 LRUHandle* HandleTable::remove(const CacheKey& key, uint32_t hash) {
+    _migrate(MIGRATE_BUCKETS_PER_OP);
     LRUHandle** ptr = _find_pointer(key, hash);
     LRUHandle* result = *ptr;
 
@@ -108,7 +115,8 @@ LRUHandle* HandleTable::remove(const CacheKey& key, uint32_t hash) {
 }
 
 bool HandleTable::remove(const LRUHandle* h) {
-    LRUHandle** ptr = &(_list[h->hash & (_length - 1)]);
+    _migrate(MIGRATE_BUCKETS_PER_OP);
+    LRUHandle** ptr = _bucket(h->hash);
     while (*ptr != nullptr && *ptr != h) {
         ptr = &(*ptr)->next_hash;
     }
@@ -122,8 +130,19 @@ bool HandleTable::remove(const LRUHandle* h) {
     return false;
 }
 
+LRUHandle** HandleTable::_bucket(uint32_t hash) {
+    // the buckets of the old list before `_migrated_buckets` are moved to the new list already
+    if (_old_list != nullptr) {
+        uint32_t old_bucket = hash & (_old_length - 1);
+        if (old_bucket >= _migrated_buckets) {
+            return &_old_list[old_bucket];
+        }
+    }
+    return &_list[hash & (_length - 1)];
+}
+
 LRUHandle** HandleTable::_find_pointer(const CacheKey& key, uint32_t hash) {
-    LRUHandle** ptr = &(_list[hash & (_length - 1)]);
+    LRUHandle** ptr = _bucket(hash);
     while (*ptr != nullptr && ((*ptr)->hash != hash || key != (*ptr)->key())) {
         ptr = &(*ptr)->next_hash;
     }
@@ -131,7 +150,13 @@ LRUHandle** HandleTable::_find_pointer(const CacheKey& key, uint32_t hash) {
     return ptr;
 }
 
+// Only the new list is allocated when the table grows, the entries are moved on by a few
+// buckets in every insert and remove, so no operation rehashes the whole shard under the lock.
 void HandleTable::_resize() {
+    // the table grows again before the last migration is done, which is rare as the new list
+    // is at least 1.5 times of the elements, just finish it
+    _migrate(std::numeric_limits<uint32_t>::max());
+
     uint32_t new_length = 16;
     while (new_length < _elems * 1.5) {
         new_length *= 2;
@@ -140,30 +165,110 @@ void HandleTable::_resize() {
     auto** new_list = new (std::nothrow) LRUHandle*[new_length];
     memset(new_list, 0, sizeof(new_list[0]) * new_length);
 
-    uint32_t count = 0;
-    for (uint32_t i = 0; i < _length; i++) {
-        LRUHandle* h = _list[i];
+    if (_list == nullptr) {
+        _list = new_list;
+        _length = new_length;
+        return;
+    }
+    _old_list = _list;
+    _old_length = _length;
+    _migrated_buckets = 0;
+    _list = new_list;
+    _length = new_length;
+    _migrate(MIGRATE_BUCKETS_PER_OP);
+}
+
+void HandleTable::_migrate(uint32_t max_buckets) {
+    if (_old_list == nullptr) {
+        return;
+    }
+    uint32_t end = _old_length - _migrated_buckets > max_buckets
+                           ? _migrated_buckets + max_buckets
+                           : _old_length;
+    for (; _migrated_buckets < end; ++_migrated_buckets) {
+        LRUHandle* h = _old_list[_migrated_buckets];
         while (h != nullptr) {
             LRUHandle* next = h->next_hash;
-            uint32_t hash = h->hash;
-            LRUHandle** ptr = &new_list[hash & (new_length - 1)];
+            LRUHandle** ptr = &_list[h->hash & (_length - 1)];
             h->next_hash = *ptr;
             *ptr = h;
             h = next;
-            count++;
         }
+        _old_list[_migrated_buckets] = nullptr;
+    }
+    if (_migrated_buckets == _old_length) {
+        delete[] _old_list;
+        _old_list = nullptr;
+        _old_length = 0;
+        _migrated_buckets = 0;
     }
-
-    DCHECK_EQ(_elems, count);
-    delete[] _list;
-    _list = new_list;
-    _length = new_length;
 }
 
 uint32_t HandleTable::element_count() const {
     return _elems;
 }
 
+void FrequencySketch::ensure_capacity(size_t max_entries) {
+    size_t table_size = 16;
+    while (table_size < max_entries && table_size < MAX_TABLE_SIZE) {
+        table_size <<= 1;
+    }
+    if (table_size <= _table.size()) {
+        return;
+    }
+    _table.assign(table_size, 0);
+    _table_mask = table_size - 1;
+    _sample_size = 10 * table_size;
+    _size = 0;
+}
+
+std::pair<size_t, uint32_t> FrequencySketch::_index_of(uint32_t hash, int i) const {
+    static constexpr uint64_t SEEDS[DEPTH] = {0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL,
+                                              0x9ae16a3b2f90404fULL, 0xcbf29ce484222325ULL};
+    // The high bits of `hash` select the shard, they are the same for all keys of a shard,
+    // so mix all bits before picking the word and the counter.
+    uint64_t h = (static_cast<uint64_t>(hash) + SEEDS[i]) * SEEDS[i];
+    h ^= h >> 29;
+    return {static_cast<size_t>(h >> 24) & _table_mask, static_cast<uint32_t>(h >> 60)};
+}
+
+void FrequencySketch::increment(uint32_t hash) {
+    if (_table.empty()) {
+        return;
+    }
+    bool added = false;
+    for (int i = 0; i < DEPTH; ++i) {
+        auto [word, counter] = _index_of(hash, i);
+        const uint32_t shift = counter << 2;
+        if (((_table[word] >> shift) & 0xfULL) != 0xfULL) {
+            _table[word] += 1ULL << shift;
+            added = true;
+        }
+    }
+    if (added && ++_size >= _sample_size) {
+        _reset();
+    }
+}
+
+uint32_t FrequencySketch::frequency(uint32_t hash) const {
+    if (_table.empty()) {
+        return 0;
+    }
+    uint32_t freq = 0xf;
+    for (int i = 0; i < DEPTH; ++i) {
+        auto [word, counter] = _index_of(hash, i);
+        freq = std::min(freq, static_cast<uint32_t>((_table[word] >> (counter << 2)) & 0xfULL));
+    }
+    return freq;
+}
+
+void FrequencySketch::_reset() {
+    for (auto& word : _table) {
+        word = (word >> 1) & 0x7777777777777777ULL;
+    }
+    _size /= 2;
+}
+
 LRUCache::LRUCache(LRUCacheType type, bool is_lru_k) : _type(type), _is_lru_k(is_lru_k) {
     // Make empty circular linked list
     _lru_normal.next = &_lru_normal;
@@ -215,6 +320,16 @@ uint64_t LRUCache::get_stampede_count() {
     return _stampede_count;
 }
 
+uint64_t LRUCache::get_admission_accept_count() {
+    std::lock_guard l(_mutex);
+    return _admission_accept_count;
+}
+
+uint64_t LRUCache::get_admission_reject_count() {
+    std::lock_guard l(_mutex);
+    return _admission_reject_count;
+}
+
 uint64_t LRUCache::get_miss_count() {
     std::lock_guard l(_mutex);
     return _miss_count;
@@ -292,6 +407,9 @@ void LRUCache::_lru_append(LRUHandle* list, LRUHandle* e) {
 Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
     std::lock_guard l(_mutex);
     ++_lookup_count;
+    if (_tiny_lfu_admission) {
+        _frequency_sketch.increment(hash);
+    }
     LRUHandle* e = _table.lookup(key, hash);
     if (e != nullptr) {
         // we get it from _table, so in_cache must be true
@@ -460,6 +578,40 @@ bool LRUCache::_lru_k_insert_visits_list(size_t total_size, visits_lru_cache_key
     return false;
 }
 
+// After cache is full, compare the frequency of the new key with the entry which would be
+// evicted first, a one-off key of a large scan is then rejected instead of pushing a hot entry
+// out of the cache.
+bool LRUCache::_tiny_lfu_reject(size_t total_size, uint32_t hash) {
+    _frequency_sketch.ensure_capacity(_table.element_count() + 1);
+    _frequency_sketch.increment(hash);
+    if (_usage + total_size <= _capacity && !_check_element_count_limit()) {
+        return false;
+    }
+
+    LRUHandle* victim = nullptr;
+    if (_cache_value_check_timestamp) {
+        if (!_sorted_normal_entries_with_timestamp.empty()) {
+            victim = _sorted_normal_entries_with_timestamp.begin()->second;
+        } else if (!_sorted_durable_entries_with_timestamp.empty()) {
+            victim = _sorted_durable_entries_with_timestamp.begin()->second;
+        }
+    } else if (_lru_normal.next != &_lru_normal) {
+        victim = _lru_normal.next;
+    } else if (_lru_durable.next != &_lru_durable) {
+        victim = _lru_durable.next;
+    }
+    // nothing can be evicted, the insert does not push out any entry
+    if (victim == nullptr) {
+        return false;
+    }
+    if (_frequency_sketch.frequency(hash) > _frequency_sketch.frequency(victim->hash)) {
+        ++_admission_accept_count;
+        return false;
+    }
+    ++_admission_reject_count;
+    return true;
+}
+
 Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
                                 CachePriority priority) {
     size_t handle_size = sizeof(LRUHandle) - 1 + key.size();
@@ -483,7 +635,11 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     {
         std::lock_guard l(_mutex);
 
-        if (_is_lru_k && _lru_k_insert_visits_list(e->total_size, hash)) {
+        if (_tiny_lfu_admission) {
+            if (_tiny_lfu_reject(e->total_size, hash)) {
+                return reinterpret_cast<Cache::Handle*>(e);
+            }
+        } else if (_is_lru_k && _lru_k_insert_visits_list(e->total_size, hash)) {
             return reinterpret_cast<Cache::Handle*>(e);
         }
 
@@ -638,6 +794,11 @@ void LRUCache::set_cache_value_check_timestamp(bool cache_value_check_timestamp)
     _cache_value_check_timestamp = cache_value_check_timestamp;
 }
 
+void LRUCache::set_tiny_lfu_admission(bool enable) {
+    std::lock_guard l(_mutex);
+    _tiny_lfu_admission = enable;
+}
+
 inline uint32_t ShardedLRUCache::_hash_slice(const CacheKey& s) {
     return s.hash(s.data(), s.size(), 0);
 }
@@ -676,6 +837,8 @@ ShardedLRUCache::ShardedLRUCache(const std::string& name, size_t capacity, LRUCa
     INT_COUNTER_METRIC_REGISTER(_entity, cache_hit_count);
     INT_COUNTER_METRIC_REGISTER(_entity, cache_stampede_count);
     INT_COUNTER_METRIC_REGISTER(_entity, cache_miss_count);
+    INT_COUNTER_METRIC_REGISTER(_entity, cache_admission_accept_count);
+    INT_COUNTER_METRIC_REGISTER(_entity, cache_admission_reject_count);
     DOUBLE_GAUGE_METRIC_REGISTER(_entity, cache_hit_ratio);
 
     _hit_count_bvar.reset(new bvar::Adder<uint64_t>("doris_cache", _name));
@@ -728,6 +891,12 @@ size_t ShardedLRUCache::get_capacity() {
     return _capacity;
 }
 
+void ShardedLRUCache::set_tiny_lfu_admission(bool enable) {
+    for (int s = 0; s < _num_shards; s++) {
+        _shards[s]->set_tiny_lfu_admission(enable);
+    }
+}
+
 Cache::Handle* ShardedLRUCache::insert(const CacheKey& key, void* value, size_t charge,
                                        CachePriority priority) {
     const uint32_t hash = _hash_slice(key);
@@ -801,6 +970,8 @@ void ShardedLRUCache::update_cache_metrics() const {
     size_t total_element_count = 0;
     size_t total_miss_count = 0;
     size_t total_stampede_count = 0;
+    size_t total_admission_accept_count = 0;
+    size_t total_admission_reject_count = 0;
 
     for (int i = 0; i < _num_shards; i++) {
         capacity += _shards[i]->get_capacity();
@@ -810,6 +981,8 @@ void ShardedLRUCache::update_cache_metrics() const {
         total_element_count += _shards[i]->get_element_count();
         total_miss_count += _shards[i]->get_miss_count();
         total_stampede_count += _shards[i]->get_stampede_count();
+        total_admission_accept_count += _shards[i]->get_admission_accept_count();
+        total_admission_reject_count += _shards[i]->get_admission_reject_count();
     }
 
     cache_capacity->set_value(capacity);
@@ -819,6 +992,8 @@ void ShardedLRUCache::update_cache_metrics() const {
     cache_hit_count->set_value(total_hit_count);
     cache_miss_count->set_value(total_miss_count);
     cache_stampede_count->set_value(total_stampede_count);
+    cache_admission_accept_count->set_value(total_admission_accept_count);
+    cache_admission_reject_count->set_value(total_admission_reject_count);
     cache_usage_ratio->set_value(
             capacity == 0 ? 0 : (static_cast<double>(total_usage) / static_cast<double>(capacity)));
     cache_hit_ratio->set_value(total_lookup_count == 0 ? 0
@@ -19,6 +19,7 @@
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "runtime/memory/lru_cache_value_base.h"
 #include "util/doris_metrics.h"
@@ -214,6 +215,10 @@ public:
 
     virtual size_t get_element_count() = 0;
 
+    // Admit a new entry into a full cache only if it is used more often than the entry it would
+    // evict, see `FrequencySketch`. Default implementation does nothing.
+    virtual void set_tiny_lfu_admission(bool enable) {}
+
 private:
     DISALLOW_COPY_AND_ASSIGN(Cache);
 };
@@ -286,18 +291,61 @@ public:
 private:
     FRIEND_TEST(CacheTest, HandleTableTest);
 
+    // the old buckets moved to the new list by every insert and remove while resizing
+    static constexpr uint32_t MIGRATE_BUCKETS_PER_OP = 16;
+
     // The tablet consists of an array of buckets where each bucket is
     // a linked list of cache entries that hash into the bucket.
     uint32_t _length {};
     uint32_t _elems {};
     LRUHandle** _list = nullptr;
+    // While resizing, the buckets of the list before the resize that are not moved to `_list`
+    // yet, from `_migrated_buckets` on.
+    LRUHandle** _old_list = nullptr;
+    uint32_t _old_length {};
+    uint32_t _migrated_buckets {};
 
     // Return a pointer to slot that points to a cache entry that
     // matches key/hash.  If there is no such cache entry, return a
     // pointer to the trailing slot in the corresponding linked list.
     LRUHandle** _find_pointer(const CacheKey& key, uint32_t hash);
 
+    // the head of the bucket which holds the entries of `hash`
+    LRUHandle** _bucket(uint32_t hash);
+
     void _resize();
+    // move at most `max_buckets` buckets of the old list to the new list
+    void _migrate(uint32_t max_buckets);
+};
+
+// Count-min sketch of the access frequency of cache keys, with 4 bit counters, used for the
+// TinyLFU admission. All counters are halved after every `10 * max entries` increments, so the
+// frequency is of the recent accesses only and a key which was hot long ago does not block
+// the keys which are hot now.
+class FrequencySketch {
+public:
+    // Grow the sketch to count at least `max_entries` keys accurately, drops the history.
+    void ensure_capacity(size_t max_entries);
+
+    void increment(uint32_t hash);
+
+    // The estimated frequency of the key, at most 15.
+    uint32_t frequency(uint32_t hash) const;
+
+private:
+    FRIEND_TEST(CacheTest, FrequencySketch);
+    static constexpr int DEPTH = 4;
+    static constexpr size_t MAX_TABLE_SIZE = 1 << 20;
+
+    // word and counter of the key in the `i` th row
+    std::pair<size_t, uint32_t> _index_of(uint32_t hash, int i) const;
+    void _reset();
+
+    // each word holds 16 counters of 4 bits
+    std::vector<uint64_t> _table;
+    size_t _table_mask = 0;
+    size_t _sample_size = 0;
+    size_t _size = 0;
 };
 
 // pair first is timestatmp, put <timestatmp, LRUHandle*> into asc set,
@@ -336,11 +384,15 @@ public:
 
     void set_cache_value_time_extractor(CacheValueTimeExtractor cache_value_time_extractor);
     void set_cache_value_check_timestamp(bool cache_value_check_timestamp);
+    // Takes precedence over LRU-K when enabled.
+    void set_tiny_lfu_admission(bool enable);
 
     uint64_t get_lookup_count();
     uint64_t get_hit_count();
     uint64_t get_miss_count();
     uint64_t get_stampede_count();
+    uint64_t get_admission_accept_count();
+    uint64_t get_admission_reject_count();
 
     size_t get_usage();
     size_t get_capacity();
@@ -355,6 +407,9 @@ private:
     void _evict_one_entry(LRUHandle* e);
     bool _check_element_count_limit();
     bool _lru_k_insert_visits_list(size_t total_size, visits_lru_cache_key visits_key);
+    // Return true if the cache is full and the new key is not used more often than the next
+    // entry to evict, the key is not inserted then.
+    bool _tiny_lfu_reject(size_t total_size, uint32_t hash);
 
 private:
     LRUCacheType _type;
@@ -392,6 +447,12 @@ private:
     std::unordered_map<visits_lru_cache_key, std::list<visits_lru_cache_pair>::iterator>
             _visits_lru_cache_map;
     size_t _visits_lru_cache_usage = 0;
+
+    bool _tiny_lfu_admission = false;
+    FrequencySketch _frequency_sketch;
+    // decisions of the admission when the cache is full
+    uint64_t _admission_accept_count = 0;
+    uint64_t _admission_reject_count = 0;
 };
 
 class ShardedLRUCache : public Cache {
@@ -410,6 +471,7 @@ public:
     size_t get_element_count() override;
     PrunedInfo set_capacity(size_t capacity) override;
     size_t get_capacity() override;
+    void set_tiny_lfu_admission(bool enable) override;
 
 private:
     // LRUCache can only be created and managed with LRUCachePolicy.
@@ -448,6 +510,8 @@ private:
     IntCounter* cache_hit_count = nullptr;
     IntCounter* cache_miss_count = nullptr;
     IntCounter* cache_stampede_count = nullptr;
+    IntCounter* cache_admission_accept_count = nullptr;
+    IntCounter* cache_admission_reject_count = nullptr;
     DoubleGauge* cache_hit_ratio = nullptr;
     // bvars
     std::unique_ptr<bvar::Adder<uint64_t>> _hit_count_bvar;
@@ -23,11 +23,13 @@
 
 #include <algorithm>
 #include <limits>
+#include <numeric>
 #include <string>
 #include <vector>
 
 #include "bvar/bvar.h"
 #include "common/config.h"
+#include "olap/key_coder.h"
 #include "olap/memtable_memory_limiter.h"
 #include "olap/olap_define.h"
 #include "olap/tablet_schema.h"
@@ -40,6 +42,9 @@
 #include "vec/aggregate_functions/aggregate_function_reader.h"
 #include "vec/aggregate_functions/aggregate_function_simple_factory.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/common/hash_table/hash_map_context.h"
+#include "vec/common/hash_table/ph_hash_map.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -48,6 +53,20 @@ bvar::Adder<int64_t> g_memtable_cnt("memtable_cnt");
 
 using namespace ErrorCode;
 
+using PreAggMethod = vectorized::MethodSerialized<PHHashMap<StringRef, uint32_t>>;
+
+// the pre-aggregation checks if it merges enough rows after this many rows are inserted
+static constexpr int64_t PRE_AGG_CHECK_ROWS = 64 * 1024;
+
+struct MemTable::PreAggHashTable {
+    PreAggMethod method;
+    // the keys in the hash table
+    vectorized::Arena key_arena;
+    // the keys of the rows being inserted
+    vectorized::Arena batch_arena;
+    DorisVector<StringRef> batch_keys;
+};
+
 MemTable::MemTable(int64_t tablet_id, std::shared_ptr<TabletSchema> tablet_schema,
                    const std::vector<SlotDescriptor*>* slot_descs, TupleDescriptor* tuple_desc,
                    bool enable_unique_key_mow, PartialUpdateInfo* partial_update_info,
@@ -82,7 +101,8 @@ MemTable::MemTable(int64_t tablet_id, std::shared_ptr<TabletSchema> tablet_schem
     }
     // TODO: Support ZOrderComparator in the future
     _init_columns_offset_by_slot_descs(slot_descs, tuple_desc);
-    _row_in_blocks = std::make_unique<DorisVector<std::shared_ptr<RowInBlock>>>();
+    _rows = std::make_unique<DorisVector<RowInBlock>>();
+    _row_indexes = std::make_unique<DorisVector<uint32_t>>();
 }
 
 void MemTable::_init_columns_offset_by_slot_descs(const std::vector<SlotDescriptor*>* slot_descs,
@@ -154,8 +174,8 @@ MemTable::~MemTable() {
         SCOPED_CONSUME_MEM_TRACKER(_mem_tracker);
         g_memtable_cnt << -1;
         if (_keys_type != KeysType::DUP_KEYS) {
-            for (auto it = _row_in_blocks->begin(); it != _row_in_blocks->end(); it++) {
-                if (!(*it)->has_init_agg()) {
+            for (auto& row : *_rows) {
+                if (!row.has_init_agg()) {
                     continue;
                 }
                 // We should release agg_places here, because they are not released when a
@@ -163,14 +183,16 @@ MemTable::~MemTable() {
                 for (size_t i = _tablet_schema->num_key_columns(); i < _num_columns; ++i) {
                     auto function = _agg_functions[i];
                     DCHECK(function != nullptr);
-                    function->destroy((*it)->agg_places(i));
+                    function->destroy(row.agg_places(i));
                 }
             }
         }
 
         _arena.clear(true);
         _vec_row_comparator.reset();
-        _row_in_blocks.reset();
+        _rows.reset();
+        _row_indexes.reset();
+        _pre_agg_table.reset();
         _agg_functions.clear();
         _input_mutable_block.clear();
         _output_mutable_block.clear();
@@ -189,6 +211,164 @@ int RowInBlockComparator::operator()(const RowInBlock* left, const RowInBlock* r
                                *_pblock, -1);
 }
 
+int RowInBlockComparator::operator()(size_t left_row_pos, size_t right_row_pos) const {
+    return _pblock->compare_at(left_row_pos, right_row_pos, _tablet_schema->num_key_columns(),
+                               *_pblock, -1);
+}
+
+// the size of a value of a key column whose vectorized value is laid out as the storage value
+// KeyCoder encodes, 0 if it is a string, -1 if it can not be normalized
+static int normalized_value_size(FieldType type) {
+    switch (type) {
+    case FieldType::OLAP_FIELD_TYPE_BOOL:
+    case FieldType::OLAP_FIELD_TYPE_TINYINT:
+        return 1;
+    case FieldType::OLAP_FIELD_TYPE_SMALLINT:
+        return 2;
+    case FieldType::OLAP_FIELD_TYPE_INT:
+    case FieldType::OLAP_FIELD_TYPE_DATEV2:
+    case FieldType::OLAP_FIELD_TYPE_DECIMAL32:
+    case FieldType::OLAP_FIELD_TYPE_IPV4:
+        return 4;
+    case FieldType::OLAP_FIELD_TYPE_BIGINT:
+    case FieldType::OLAP_FIELD_TYPE_DATETIMEV2:
+    case FieldType::OLAP_FIELD_TYPE_DECIMAL64:
+        return 8;
+    case FieldType::OLAP_FIELD_TYPE_LARGEINT:
+    case FieldType::OLAP_FIELD_TYPE_DECIMAL128I:
+    case FieldType::OLAP_FIELD_TYPE_IPV6:
+        return 16;
+    case FieldType::OLAP_FIELD_TYPE_CHAR:
+    case FieldType::OLAP_FIELD_TYPE_VARCHAR:
+    case FieldType::OLAP_FIELD_TYPE_STRING:
+        return 0;
+    default:
+        return -1;
+    }
+}
+
+// ranges with fewer rows are sorted by memcmp of the rest of the keys
+static constexpr size_t RADIX_SORT_MIN_ROWS = 64;
+
+NormalizedKeySorter::NormalizedKeySorter(const std::vector<const vectorized::IColumn*>& columns,
+                                         const std::vector<FieldType>& types) {
+    DCHECK_EQ(columns.size(), types.size());
+    for (size_t i = 0; i < columns.size(); ++i) {
+        int value_size = normalized_value_size(types[i]);
+        if (value_size < 0) {
+            break;
+        }
+        KeyColumn key_column {columns[i], nullptr, nullptr, static_cast<size_t>(value_size),
+                              _key_size};
+        size_t size = key_column.value_size;
+        if (const auto* nullable = check_and_get_column<vectorized::ColumnNullable>(columns[i])) {
+            key_column.column = &nullable->get_nested_column();
+            key_column.null_map = nullable->get_null_map_data().data();
+            // a byte before the value sorts nulls first, as the comparator does
+            size += 1;
+        }
+        if (_key_size + size + (value_size == 0 ? 1 : 0) > MAX_KEY_SIZE) {
+            break;
+        }
+        // a string is cut to the key, so two rows with equal keys may still differ on it
+        // and the columns after it are not encoded
+        key_column.coder = get_key_coder(value_size == 0 ? FieldType::OLAP_FIELD_TYPE_VARCHAR
+                                                         : types[i]);
+        _key_columns.push_back(key_column);
+        if (value_size == 0) {
+            _key_size = MAX_KEY_SIZE;
+            break;
+        }
+        _key_size += size;
+        ++_num_full_columns;
+    }
+}
+
+void NormalizedKeySorter::_encode(size_t row, uint8_t* key, std::string* buf) const {
+    memset(key, 0, _key_size);
+    for (const auto& key_column : _key_columns) {
+        uint8_t* pos = key + key_column.offset;
+        if (key_column.null_map != nullptr) {
+            if (key_column.null_map[row]) {
+                continue;
+            }
+            *pos++ = 1;
+        }
+        StringRef value = key_column.column->get_data_at(row);
+        buf->clear();
+        if (key_column.value_size == 0) {
+            Slice slice(value.data, value.size);
+            key_column.coder->encode_ascending(&slice, static_cast<size_t>(key + _key_size - pos),
+                                               buf);
+        } else {
+            DCHECK_EQ(key_column.value_size, value.size);
+            key_column.coder->full_encode_ascending(value.data, buf);
+        }
+        memcpy(pos, buf->data(), buf->size());
+    }
+}
+
+void NormalizedKeySorter::_radix_sort(uint32_t* indexes, uint32_t* tmp, size_t num,
+                                      size_t depth) const {
+    while (num > 1 && depth < _key_size) {
+        if (num < RADIX_SORT_MIN_ROWS) {
+            pdqsort(indexes, indexes + num, [&](uint32_t lhs, uint32_t rhs) {
+                return memcmp(_key(lhs) + depth, _key(rhs) + depth, _key_size - depth) < 0;
+            });
+            return;
+        }
+        size_t counts[256] = {0};
+        for (size_t i = 0; i < num; ++i) {
+            counts[_key(indexes[i])[depth]]++;
+        }
+        // all the keys have the same byte, go on with the next one
+        if (counts[_key(indexes[0])[depth]] == num) {
+            ++depth;
+            continue;
+        }
+        size_t starts[256];
+        size_t start = 0;
+        for (size_t b = 0; b < 256; ++b) {
+            starts[b] = start;
+            start += counts[b];
+        }
+        size_t next[256];
+        memcpy(next, starts, sizeof(starts));
+        for (size_t i = 0; i < num; ++i) {
+            tmp[next[_key(indexes[i])[depth]]++] = indexes[i];
+        }
+        memcpy(indexes, tmp, num * sizeof(uint32_t));
+        for (size_t b = 0; b < 256; ++b) {
+            _radix_sort(indexes + starts[b], tmp + starts[b], counts[b], depth + 1);
+        }
+        return;
+    }
+}
+
+void NormalizedKeySorter::sort(DorisVector<uint32_t>& rows, size_t begin, size_t end, Tie& tie) {
+    DCHECK_GT(_key_size, 0);
+    size_t num = end - begin;
+    _keys.resize(num * _key_size);
+    std::string buf;
+    DorisVector<uint32_t> indexes(num);
+    for (size_t i = 0; i < num; ++i) {
+        _encode(rows[begin + i], _keys.data() + i * _key_size, &buf);
+        indexes[i] = static_cast<uint32_t>(i);
+    }
+    DorisVector<uint32_t> tmp(num);
+    _radix_sort(indexes.data(), tmp.data(), num, 0);
+
+    // move the rows once by the sorted indexes
+    DorisVector<uint32_t> sorted(num);
+    for (size_t i = 0; i < num; ++i) {
+        sorted[i] = rows[begin + indexes[i]];
+    }
+    for (size_t i = 0; i < num; ++i) {
+        rows[begin + i] = sorted[i];
+        tie[begin + i] = i > 0 && memcmp(_key(indexes[i - 1]), _key(indexes[i]), _key_size) == 0;
+    }
+}
+
 Status MemTable::insert(const vectorized::Block* input_block,
                         const DorisVector<uint32_t>& row_idxs) {
     SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(
@@ -228,14 +408,35 @@ Status MemTable::insert(const vectorized::Block* input_block,
             // we only need columns indicated by column offset in the output
             RETURN_IF_CATCH_EXCEPTION(_init_agg_functions(&clone_block));
         }
+        if (config::enable_memtable_pre_aggregation && _tablet_schema->num_key_columns() > 0 &&
+            (_keys_type == KeysType::AGG_KEYS ||
+             (_keys_type == KeysType::UNIQUE_KEYS && !_enable_unique_key_mow)) &&
+            _partial_update_mode == UniqueKeyUpdateModePB::UPSERT) {
+            _pre_agg_table = std::make_unique<PreAggHashTable>();
+        }
     }
 
     auto num_rows = row_idxs.size();
     size_t cursor_in_mutableblock = _input_mutable_block.rows();
     RETURN_IF_ERROR(_input_mutable_block.add_rows(input_block, row_idxs.data(),
                                                   row_idxs.data() + num_rows, &_column_offset));
-    for (int i = 0; i < num_rows; i++) {
-        _row_in_blocks->emplace_back(std::make_shared<RowInBlock>(cursor_in_mutableblock + i));
+    DCHECK_EQ(cursor_in_mutableblock, _rows->size());
+    for (size_t i = 0; i < num_rows; i++) {
+        _rows->emplace_back(cursor_in_mutableblock + i);
+        _row_indexes->push_back(static_cast<uint32_t>(cursor_in_mutableblock + i));
+    }
+    if (_pre_agg_table != nullptr) {
+        SCOPED_RAW_TIMER(&_stat.agg_ns);
+        RETURN_IF_CATCH_EXCEPTION(
+                _pre_aggregate(cursor_in_mutableblock, cursor_in_mutableblock + num_rows));
+        _pre_agg_input_rows += num_rows;
+        if (_pre_agg_input_rows >= PRE_AGG_CHECK_ROWS &&
+            static_cast<double>(_pre_agg_merged_rows) <
+                    static_cast<double>(_pre_agg_input_rows) *
+                            config::memtable_pre_aggregation_min_merged_ratio) {
+            // the keys do not repeat enough to pay for the hash table, leave them to the sort
+            _pre_agg_table.reset();
+        }
     }
 
     _stat.raw_rows += num_rows;
@@ -288,16 +489,79 @@ void MemTable::_aggregate_two_row_in_block(vectorized::MutableBlock& mutable_blo
         }
     }
 }
+void MemTable::_init_row_agg(RowInBlock* row, vectorized::MutableBlock& mutable_block) {
+    row->init_agg_places(_arena.aligned_alloc(_total_size_of_aggregate_states, 16),
+                         _offsets_of_aggregate_states.data());
+    for (auto cid = _tablet_schema->num_key_columns(); cid < _num_columns; cid++) {
+        auto* col_ptr = mutable_block.mutable_columns()[cid].get();
+        auto* data = row->agg_places(cid);
+        _agg_functions[cid]->create(data);
+        _agg_functions[cid]->add(data, const_cast<const doris::vectorized::IColumn**>(&col_ptr),
+                                 row->_row_pos, _arena);
+    }
+}
+
+void MemTable::_pre_aggregate(size_t begin, size_t end) {
+    auto& method = _pre_agg_table->method;
+    vectorized::ColumnRawPtrs key_columns;
+    for (size_t i = 0; i < _tablet_schema->num_key_columns(); ++i) {
+        key_columns.push_back(_input_mutable_block.get_column_by_position(i).get());
+    }
+    size_t num_rows = end - begin;
+    auto& batch_keys = _pre_agg_table->batch_keys;
+    _pre_agg_table->batch_arena.clear();
+    batch_keys.resize(num_rows);
+    for (size_t i = 0; i < num_rows; ++i) {
+        batch_keys[i] = method.serialize_keys_to_pool_contiguous(
+                begin + i, key_columns.size(), key_columns, _pre_agg_table->batch_arena);
+    }
+    method.keys = batch_keys.data();
+    method.init_hash_values(num_rows);
+
+    PreAggMethod::State state(key_columns);
+    size_t num_left = _row_indexes->size() - num_rows;
+    for (size_t i = 0; i < num_rows; ++i) {
+        auto row_index = static_cast<uint32_t>(begin + i);
+        bool created = false;
+        auto creator = [&](const auto& ctor, auto& key, auto& origin) {
+            PreAggMethod::try_presis_key(key, origin, _pre_agg_table->key_arena);
+            ctor(key, row_index);
+            created = true;
+        };
+        auto creator_for_null_key = [&](auto& mapped) {
+            mapped = row_index;
+            created = true;
+        };
+        uint32_t first_row_index = *method.lazy_emplace(state, i, creator, creator_for_null_key);
+        if (created) {
+            (*_row_indexes)[num_left++] = row_index;
+            continue;
+        }
+        RowInBlock* first_row = &(*_rows)[first_row_index];
+        if (!first_row->has_init_agg()) {
+            _init_row_agg(first_row, _input_mutable_block);
+        }
+        _aggregate_two_row_in_block<false>(_input_mutable_block, &(*_rows)[row_index], first_row);
+        _has_pre_aggregated_rows = true;
+        _pre_agg_merged_rows++;
+        _stat.merged_rows++;
+    }
+    _row_indexes->resize(num_left);
+}
+
+void MemTable::_rebuild_pre_agg_table() {
+    // the rows are moved by the aggregation, map the keys to their new positions
+    _pre_agg_table = std::make_unique<PreAggHashTable>();
+    _pre_aggregate(0, _rows->size());
+}
+
 Status MemTable::_put_into_output(vectorized::Block& in_block) {
     SCOPED_RAW_TIMER(&_stat.put_into_output_ns);
-    DorisVector<uint32_t> row_pos_vec;
     DCHECK(in_block.rows() <= std::numeric_limits<int>::max());
-    row_pos_vec.reserve(in_block.rows());
-    for (int i = 0; i < _row_in_blocks->size(); i++) {
-        row_pos_vec.emplace_back((*_row_in_blocks)[i]->_row_pos);
-    }
-    return _output_mutable_block.add_rows(&in_block, row_pos_vec.data(),
-                                          row_pos_vec.data() + in_block.rows());
+    DCHECK_EQ(in_block.rows(), _row_indexes->size());
+    // the rows are not aggregated, so the index of a row is its position in the block
+    return _output_mutable_block.add_rows(&in_block, _row_indexes->data(),
+                                          _row_indexes->data() + in_block.rows());
 }
 
 size_t MemTable::_sort() {
@@ -305,40 +569,54 @@ size_t MemTable::_sort() {
     _stat.sort_times++;
     size_t same_keys_num = 0;
     // sort new rows
-    Tie tie = Tie(_last_sorted_pos, _row_in_blocks->size());
-    for (size_t i = 0; i < _tablet_schema->num_key_columns(); i++) {
-        auto cmp = [&](RowInBlock* lhs, RowInBlock* rhs) -> int {
-            return _input_mutable_block.compare_one_column(lhs->_row_pos, rhs->_row_pos, i, -1);
+    Tie tie = Tie(_last_sorted_pos, _row_indexes->size());
+    size_t first_tie_column = 0;
+    if (config::enable_memtable_normalized_key_sort &&
+        _row_indexes->size() > _last_sorted_pos + 1) {
+        std::vector<const vectorized::IColumn*> key_columns;
+        std::vector<FieldType> key_types;
+        for (size_t i = 0; i < _tablet_schema->num_key_columns(); i++) {
+            key_columns.push_back(_input_mutable_block.get_column_by_position(i).get());
+            key_types.push_back(_tablet_schema->column(i).type());
+        }
+        NormalizedKeySorter sorter(key_columns, key_types);
+        if (sorter.key_size() > 0) {
+            sorter.sort(*_row_indexes, _last_sorted_pos, _row_indexes->size(), tie);
+            // the rows tied on the normalized key are equal on these columns
+            first_tie_column = sorter.num_full_columns();
+        }
+    }
+    for (size_t i = first_tie_column; i < _tablet_schema->num_key_columns(); i++) {
+        auto cmp = [&](uint32_t lhs, uint32_t rhs) -> int {
+            return _input_mutable_block.compare_one_column(lhs, rhs, i, -1);
         };
-        _sort_one_column(*_row_in_blocks, tie, cmp);
+        _sort_one_column(*_row_indexes, tie, cmp);
     }
     bool is_dup = (_keys_type == KeysType::DUP_KEYS);
     // sort extra round by _row_pos to make the sort stable
     auto iter = tie.iter();
     while (iter.next()) {
-        pdqsort(std::next(_row_in_blocks->begin(), iter.left()),
-                std::next(_row_in_blocks->begin(), iter.right()),
-                [&is_dup](const std::shared_ptr<RowInBlock>& lhs,
-                          const std::shared_ptr<RowInBlock>& rhs) -> bool {
-                    return is_dup ? lhs->_row_pos > rhs->_row_pos : lhs->_row_pos < rhs->_row_pos;
+        pdqsort(std::next(_row_indexes->begin(), iter.left()),
+                std::next(_row_indexes->begin(), iter.right()),
+                [&is_dup](uint32_t lhs, uint32_t rhs) -> bool {
+                    return is_dup ? lhs > rhs : lhs < rhs;
                 });
         same_keys_num += iter.right() - iter.left();
     }
     // merge new rows and old rows
     _vec_row_comparator->set_block(&_input_mutable_block);
-    auto cmp_func = [this, is_dup, &same_keys_num](const std::shared_ptr<RowInBlock>& l,
-                                                   const std::shared_ptr<RowInBlock>& r) -> bool {
-        auto value = (*(this->_vec_row_comparator))(l.get(), r.get());
+    auto cmp_func = [this, is_dup, &same_keys_num](uint32_t l, uint32_t r) -> bool {
+        auto value = (*(this->_vec_row_comparator))(size_t {l}, size_t {r});
         if (value == 0) {
             same_keys_num++;
-            return is_dup ? l->_row_pos > r->_row_pos : l->_row_pos < r->_row_pos;
+            return is_dup ? l > r : l < r;
         } else {
             return value < 0;
         }
     };
-    auto new_row_it = std::next(_row_in_blocks->begin(), _last_sorted_pos);
-    std::inplace_merge(_row_in_blocks->begin(), new_row_it, _row_in_blocks->end(), cmp_func);
-    _last_sorted_pos = _row_in_blocks->size();
+    auto new_row_it = std::next(_row_indexes->begin(), _last_sorted_pos);
+    std::inplace_merge(_row_indexes->begin(), new_row_it, _row_indexes->end(), cmp_func);
+    _last_sorted_pos = _row_indexes->size();
     return same_keys_num;
 }
 
@@ -352,11 +630,8 @@ Status MemTable::_sort_by_cluster_keys() {
     auto clone_block = in_block.clone_without_columns();
     _output_mutable_block = vectorized::MutableBlock::build_mutable_block(&clone_block);
 
-    DorisVector<std::shared_ptr<RowInBlock>> row_in_blocks;
-    row_in_blocks.reserve(mutable_block.rows());
-    for (size_t i = 0; i < mutable_block.rows(); i++) {
-        row_in_blocks.emplace_back(std::make_shared<RowInBlock>(i));
-    }
+    DorisVector<uint32_t> row_indexes(mutable_block.rows());
+    std::iota(row_indexes.begin(), row_indexes.end(), 0U);
     Tie tie = Tie(0, mutable_block.rows());
 
     for (auto cid : _tablet_schema->cluster_key_uids()) {
@@ -365,47 +640,40 @@ Status MemTable::_sort_by_cluster_keys() {
             return Status::InternalError("could not find cluster key column with unique_id=" +
                                          std::to_string(cid) + " in tablet schema");
         }
-        auto cmp = [&](const RowInBlock* lhs, const RowInBlock* rhs) -> int {
-            return mutable_block.compare_one_column(lhs->_row_pos, rhs->_row_pos, index, -1);
+        auto cmp = [&](uint32_t lhs, uint32_t rhs) -> int {
+            return mutable_block.compare_one_column(lhs, rhs, index, -1);
         };
-        _sort_one_column(row_in_blocks, tie, cmp);
+        _sort_one_column(row_indexes, tie, cmp);
     }
 
     // sort extra round by _row_pos to make the sort stable
     auto iter = tie.iter();
     while (iter.next()) {
-        pdqsort(std::next(row_in_blocks.begin(), iter.left()),
-                std::next(row_in_blocks.begin(), iter.right()),
-                [](const std::shared_ptr<RowInBlock>& lhs, const std::shared_ptr<RowInBlock>& rhs)
-                        -> bool { return lhs->_row_pos < rhs->_row_pos; });
+        pdqsort(std::next(row_indexes.begin(), iter.left()),
+                std::next(row_indexes.begin(), iter.right()));
     }
 
     in_block = mutable_block.to_block();
     SCOPED_RAW_TIMER(&_stat.put_into_output_ns);
-    DorisVector<uint32_t> row_pos_vec;
     DCHECK(in_block.rows() <= std::numeric_limits<int>::max());
-    row_pos_vec.reserve(in_block.rows());
-    for (int i = 0; i < row_in_blocks.size(); i++) {
-        row_pos_vec.emplace_back(row_in_blocks[i]->_row_pos);
-    }
     std::vector<int> column_offset;
     for (int i = 0; i < _column_offset.size(); ++i) {
         column_offset.emplace_back(i);
     }
-    return _output_mutable_block.add_rows(&in_block, row_pos_vec.data(),
-                                          row_pos_vec.data() + in_block.rows(), &column_offset);
+    return _output_mutable_block.add_rows(&in_block, row_indexes.data(),
+                                          row_indexes.data() + in_block.rows(), &column_offset);
 }
 
-void MemTable::_sort_one_column(DorisVector<std::shared_ptr<RowInBlock>>& row_in_blocks, Tie& tie,
-                                std::function<int(RowInBlock*, RowInBlock*)> cmp) {
+void MemTable::_sort_one_column(DorisVector<uint32_t>& row_indexes, Tie& tie,
+                                std::function<int(uint32_t, uint32_t)> cmp) {
     auto iter = tie.iter();
     while (iter.next()) {
-        pdqsort(std::next(row_in_blocks.begin(), static_cast<int>(iter.left())),
-                std::next(row_in_blocks.begin(), static_cast<int>(iter.right())),
-                [&cmp](auto lhs, auto rhs) -> bool { return cmp(lhs.get(), rhs.get()) < 0; });
+        pdqsort(std::next(row_indexes.begin(), static_cast<int>(iter.left())),
+                std::next(row_indexes.begin(), static_cast<int>(iter.right())),
+                [&cmp](uint32_t lhs, uint32_t rhs) -> bool { return cmp(lhs, rhs) < 0; });
         tie[iter.left()] = 0;
         for (auto i = iter.left() + 1; i < iter.right(); i++) {
-            tie[i] = (cmp(row_in_blocks[i - 1].get(), row_in_blocks[i].get()) == 0);
+            tie[i] = (cmp(row_indexes[i - 1], row_indexes[i]) == 0);
         }
     }
 }
@@ -466,47 +734,37 @@ void MemTable::_aggregate() {
             vectorized::MutableBlock::build_mutable_block(&in_block);
     _vec_row_comparator->set_block(&mutable_block);
     auto& block_data = in_block.get_columns_with_type_and_name();
-    DorisVector<std::shared_ptr<RowInBlock>> temp_row_in_blocks;
-    temp_row_in_blocks.reserve(_last_sorted_pos);
+    auto& rows = *_rows;
+    // the indexes of the rows left after the aggregation
+    DorisVector<uint32_t> temp_row_indexes;
+    temp_row_indexes.reserve(_last_sorted_pos);
     RowInBlock* prev_row = nullptr;
     int row_pos = -1;
     //only init agg if needed
 
-    auto init_for_agg = [&](RowInBlock* row) {
-        row->init_agg_places(_arena.aligned_alloc(_total_size_of_aggregate_states, 16),
-                             _offsets_of_aggregate_states.data());
-        for (auto cid = _tablet_schema->num_key_columns(); cid < _num_columns; cid++) {
-            auto* col_ptr = mutable_block.mutable_columns()[cid].get();
-            auto* data = prev_row->agg_places(cid);
-            _agg_functions[cid]->create(data);
-            _agg_functions[cid]->add(data, const_cast<const doris::vectorized::IColumn**>(&col_ptr),
-                                     prev_row->_row_pos, _arena);
-        }
-    };
-
     if (!has_skip_bitmap_col || _seq_col_idx_in_block == -1) {
-        for (const auto& cur_row_ptr : *_row_in_blocks) {
-            RowInBlock* cur_row = cur_row_ptr.get();
-            if (!temp_row_in_blocks.empty() && (*_vec_row_comparator)(prev_row, cur_row) == 0) {
+        for (uint32_t cur_row_index : *_row_indexes) {
+            RowInBlock* cur_row = &rows[cur_row_index];
+            if (!temp_row_indexes.empty() && (*_vec_row_comparator)(prev_row, cur_row) == 0) {
                 if (!prev_row->has_init_agg()) {
-                    init_for_agg(prev_row);
+                    _init_row_agg(prev_row, mutable_block);
                 }
                 _stat.merged_rows++;
                 _aggregate_two_row_in_block<has_skip_bitmap_col>(mutable_block, cur_row, prev_row);
             } else {
                 prev_row = cur_row;
-                if (!temp_row_in_blocks.empty()) {
+                if (!temp_row_indexes.empty()) {
                     // no more rows to merge for prev row, finalize it
-                    _finalize_one_row<is_final>(temp_row_in_blocks.back().get(), block_data,
+                    _finalize_one_row<is_final>(&rows[temp_row_indexes.back()], block_data,
                                                 row_pos);
                 }
-                temp_row_in_blocks.push_back(cur_row_ptr);
+                temp_row_indexes.push_back(cur_row_index);
                 row_pos++;
             }
         }
-        if (!temp_row_in_blocks.empty()) {
+        if (!temp_row_indexes.empty()) {
             // finalize the last low
-            _finalize_one_row<is_final>(temp_row_in_blocks.back().get(), block_data, row_pos);
+            _finalize_one_row<is_final>(&rows[temp_row_indexes.back()], block_data, row_pos);
         }
     } else {
         // For flexible partial update and the table has sequence column, considering the following situation:
@@ -532,9 +790,9 @@ void MemTable::_aggregate() {
                 row_without_seq_col = nullptr;
             }
         };
-        auto add_row = [&](const std::shared_ptr<RowInBlock>& row_ptr, bool with_seq_col) {
-            RowInBlock* row = row_ptr.get();
-            temp_row_in_blocks.push_back(row_ptr);
+        auto add_row = [&](uint32_t row_index, bool with_seq_col) {
+            RowInBlock* row = &rows[row_index];
+            temp_row_indexes.push_back(row_index);
             row_pos++;
             if (with_seq_col) {
                 row_with_seq_col = row;
@@ -547,8 +805,8 @@ void MemTable::_aggregate() {
         auto& skip_bitmaps = assert_cast<vectorized::ColumnBitmap*>(
                                      mutable_block.mutable_columns()[_skip_bitmap_col_idx].get())
                                      ->get_data();
-        for (const auto& cur_row_ptr : *_row_in_blocks) {
-            RowInBlock* cur_row = cur_row_ptr.get();
+        for (uint32_t cur_row_index : *_row_indexes) {
+            RowInBlock* cur_row = &rows[cur_row_index];
             const BitmapValue& skip_bitmap = skip_bitmaps[cur_row->_row_pos];
             bool with_seq_col = !skip_bitmap.contains(_seq_col_unique_id);
             // compare keys, the keys of row_with_seq_col and row_with_seq_col is the same,
@@ -557,18 +815,18 @@ void MemTable::_aggregate() {
             if (prev_row != nullptr && (*_vec_row_comparator)(prev_row, cur_row) == 0) {
                 prev_row = (with_seq_col ? row_with_seq_col : row_without_seq_col);
                 if (prev_row == nullptr) {
-                    add_row(cur_row_ptr, with_seq_col);
+                    add_row(cur_row_index, with_seq_col);
                     continue;
                 }
                 if (!prev_row->has_init_agg()) {
-                    init_for_agg(prev_row);
+                    _init_row_agg(prev_row, mutable_block);
                 }
                 _stat.merged_rows++;
                 _aggregate_two_row_in_block<has_skip_bitmap_col>(mutable_block, cur_row, prev_row);
             } else {
                 // no more rows to merge for prev rows, finalize them
                 finalize_rows();
-                add_row(cur_row_ptr, with_seq_col);
+                add_row(cur_row_index, with_seq_col);
             }
         }
         // finalize the last lows
@@ -582,8 +840,21 @@ void MemTable::_aggregate() {
         _output_mutable_block =
                 vectorized::MutableBlock::build_mutable_block(empty_input_block.get());
         _output_mutable_block.clear_column_data();
-        *_row_in_blocks = temp_row_in_blocks;
-        _last_sorted_pos = _row_in_blocks->size();
+        // the rows left make up the new input block in the same order
+        auto left_rows = std::make_unique<DorisVector<RowInBlock>>();
+        left_rows->reserve(temp_row_indexes.size());
+        for (uint32_t row_index : temp_row_indexes) {
+            DCHECK_EQ(rows[row_index]._row_pos, left_rows->size());
+            left_rows->push_back(rows[row_index]);
+        }
+        _rows = std::move(left_rows);
+        _row_indexes->resize(temp_row_indexes.size());
+        std::iota(_row_indexes->begin(), _row_indexes->end(), 0U);
+        _last_sorted_pos = _row_indexes->size();
+        _has_pre_aggregated_rows = false;
+        if (_pre_agg_table != nullptr) {
+            _rebuild_pre_agg_table();
+        }
     }
 }
 
@@ -595,7 +866,7 @@ void MemTable::shrink_memtable_by_agg() {
         return;
     }
     size_t same_keys_num = _sort();
-    if (same_keys_num != 0) {
+    if (same_keys_num != 0 || _has_pre_aggregated_rows) {
         (_skip_bitmap_col_idx == -1) ? _aggregate<false, false>() : _aggregate<false, true>();
     }
 }
@@ -627,8 +898,9 @@ size_t MemTable::get_flush_reserve_memory_size() const {
 }
 
 Status MemTable::_to_block(std::unique_ptr<vectorized::Block>* res) {
+    _pre_agg_table.reset();
     size_t same_keys_num = _sort();
-    if (_keys_type == KeysType::DUP_KEYS || same_keys_num == 0) {
+    if (_keys_type == KeysType::DUP_KEYS || (same_keys_num == 0 && !_has_pre_aggregated_rows)) {
         if (_keys_type == KeysType::DUP_KEYS && _tablet_schema->num_key_columns() == 0) {
             _output_mutable_block.swap(_input_mutable_block);
         } else {
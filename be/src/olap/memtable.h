@@ -23,6 +23,7 @@
 #include <cstring>
 #include <functional>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "common/status.h"
@@ -37,6 +38,7 @@
 
 namespace doris {
 
+class KeyCoder;
 class Schema;
 class SlotDescriptor;
 class TabletSchema;
@@ -128,6 +130,47 @@ private:
     std::vector<uint8_t> _bits;
 };
 
+// Encodes the leading key columns of every row into a fixed-width key with KeyCoder, so that
+// comparing two keys with memcmp orders the rows the same way as comparing their columns, and
+// radix sorts the rows by it. Only the rows with equal keys are left to the column comparator.
+class NormalizedKeySorter {
+public:
+    static constexpr size_t MAX_KEY_SIZE = 32;
+
+    // `columns` are the key columns in order, and `types` the field types of them
+    NormalizedKeySorter(const std::vector<const vectorized::IColumn*>& columns,
+                        const std::vector<FieldType>& types);
+
+    // the size of the normalized key, 0 if the first key column can not be encoded
+    size_t key_size() const { return _key_size; }
+
+    // the number of the leading key columns two rows with equal keys are equal on
+    size_t num_full_columns() const { return _num_full_columns; }
+
+    // Sort the row positions rows[begin, end) by the keys, and set tie[i] to 1 if rows[i] has the
+    // same key as rows[i - 1], 0 if not.
+    void sort(DorisVector<uint32_t>& rows, size_t begin, size_t end, Tie& tie);
+
+private:
+    struct KeyColumn {
+        const vectorized::IColumn* column;
+        const uint8_t* null_map;
+        const KeyCoder* coder;
+        // 0 for a string column, which takes the rest of the key
+        size_t value_size;
+        size_t offset;
+    };
+
+    void _encode(size_t row, uint8_t* key, std::string* buf) const;
+    void _radix_sort(uint32_t* indexes, uint32_t* tmp, size_t num, size_t depth) const;
+    const uint8_t* _key(uint32_t index) const { return _keys.data() + index * _key_size; }
+
+    std::vector<KeyColumn> _key_columns;
+    size_t _key_size = 0;
+    size_t _num_full_columns = 0;
+    DorisVector<uint8_t> _keys;
+};
+
 class RowInBlockComparator {
 public:
     RowInBlockComparator(std::shared_ptr<TabletSchema> tablet_schema)
@@ -137,6 +180,8 @@ public:
     // so can not Comparator of construct to set pblock
     void set_block(vectorized::MutableBlock* pblock) { _pblock = pblock; }
     int operator()(const RowInBlock* left, const RowInBlock* right) const;
+    // compare the rows at the positions of the block
+    int operator()(size_t left_row_pos, size_t right_row_pos) const;
 
 private:
     std::shared_ptr<TabletSchema> _tablet_schema;
@@ -249,8 +294,8 @@ private:
     //return number of same keys
     size_t _sort();
     Status _sort_by_cluster_keys();
-    void _sort_one_column(DorisVector<std::shared_ptr<RowInBlock>>& row_in_blocks, Tie& tie,
-                          std::function<int(RowInBlock*, RowInBlock*)> cmp);
+    void _sort_one_column(DorisVector<uint32_t>& row_indexes, Tie& tie,
+                          std::function<int(uint32_t, uint32_t)> cmp);
     template <bool is_final>
     void _finalize_one_row(RowInBlock* row, const vectorized::ColumnsWithTypeAndName& block_data,
                            int row_pos);
@@ -260,10 +305,30 @@ private:
     bool _is_first_insertion;
 
     void _init_agg_functions(const vectorized::Block* block);
+    void _init_row_agg(RowInBlock* row, vectorized::MutableBlock& mutable_block);
+    // Aggregate the rows [begin, end) of _input_mutable_block, which are the last ones of
+    // _row_indexes, into the rows with the same keys before them, and take them out of
+    // _row_indexes.
+    void _pre_aggregate(size_t begin, size_t end);
+    void _rebuild_pre_agg_table();
     std::vector<vectorized::AggregateFunctionPtr> _agg_functions;
     std::vector<size_t> _offsets_of_aggregate_states;
     size_t _total_size_of_aggregate_states;
-    std::unique_ptr<DorisVector<std::shared_ptr<RowInBlock>>> _row_in_blocks;
+    // _rows[i] is the row at position i of _input_mutable_block, and _row_indexes holds the
+    // indexes of the rows in sort order, sorted up to _last_sorted_pos. The rows are laid out
+    // flat and sorted by 32-bit indexes, instead of a pointer allocated for every row.
+    // The rows pre-aggregated into another one are left out of _row_indexes.
+    std::unique_ptr<DorisVector<RowInBlock>> _rows;
+    std::unique_ptr<DorisVector<uint32_t>> _row_indexes;
+
+    // Maps the keys to the first row with them while rows are pre-aggregated at insert time,
+    // null if it is not enabled or it gave up because too few rows were merged.
+    struct PreAggHashTable;
+    std::unique_ptr<PreAggHashTable> _pre_agg_table;
+    // some rows hold the values of other rows in their agg places, which are not in the block
+    bool _has_pre_aggregated_rows = false;
+    int64_t _pre_agg_input_rows = 0;
+    int64_t _pre_agg_merged_rows = 0;
 
     size_t _num_columns;
     int32_t _seq_col_idx_in_block = -1;
@@ -76,6 +76,8 @@ private:
 std::ostream& operator<<(std::ostream& os, const FlushStatistic& stat) {
     os << "(flush time(ms)=" << stat.flush_time_ns / NANOS_PER_MILLIS
        << ", flush wait time(ms)=" << stat.flush_wait_time_ns / NANOS_PER_MILLIS
+       << ", to block time(ms)=" << stat.flush_to_block_time_ns / NANOS_PER_MILLIS
+       << ", write time(ms)=" << stat.flush_write_time_ns / NANOS_PER_MILLIS
        << ", running flush count=" << stat.flush_running_count
        << ", finish flush count=" << stat.flush_finish_count
        << ", flush bytes: " << stat.flush_size_bytes
@@ -200,8 +202,18 @@ Status FlushToken::_do_flush_memtable(MemTable* memtable, int32_t segment_id, in
             ExecEnv::GetInstance()->storage_engine().memtable_flush_executor()->dec_flushing_task();
         }};
         std::unique_ptr<vectorized::Block> block;
-        RETURN_IF_ERROR(memtable->to_block(&block));
-        RETURN_IF_ERROR(_rowset_writer->flush_memtable(block.get(), segment_id, flush_size));
+        int64_t to_block_time_ns = 0;
+        {
+            SCOPED_RAW_TIMER(&to_block_time_ns);
+            RETURN_IF_ERROR(memtable->to_block(&block));
+        }
+        _stats.flush_to_block_time_ns += to_block_time_ns;
+        int64_t write_time_ns = 0;
+        {
+            SCOPED_RAW_TIMER(&write_time_ns);
+            RETURN_IF_ERROR(_rowset_writer->flush_memtable(block.get(), segment_id, flush_size));
+        }
+        _stats.flush_write_time_ns += write_time_ns;
         memtable->set_flush_success();
     }
     _memtable_stat += memtable->stat();
@@ -291,6 +303,13 @@ void MemTableFlushExecutor::init(int num_disk) {
                               .set_min_threads(min_threads)
                               .set_max_threads(max_threads)
                               .build(&_high_prio_flush_pool));
+
+    if (config::segment_column_encode_thread_num > 0) {
+        static_cast<void>(ThreadPoolBuilder("SegmentColumnEncodeThreadPool")
+                                  .set_min_threads(config::segment_column_encode_thread_num)
+                                  .set_max_threads(config::segment_column_encode_thread_num)
+                                  .build(&_column_encode_pool));
+    }
 }
 
 // NOTE: we use SERIAL mode here to ensure all mem-tables from one tablet are flushed in order.
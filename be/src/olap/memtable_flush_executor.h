@@ -45,6 +45,10 @@ struct FlushStatistic {
     std::atomic_uint64_t flush_size_bytes = 0;
     std::atomic_uint64_t flush_disk_size_bytes = 0;
     std::atomic_uint64_t flush_wait_time_ns = 0;
+    // the time to sort and aggregate the memtables into blocks
+    std::atomic_uint64_t flush_to_block_time_ns = 0;
+    // the time to encode the blocks into segments and write them
+    std::atomic_uint64_t flush_write_time_ns = 0;
 };
 
 std::ostream& operator<<(std::ostream& os, const FlushStatistic& stat);
@@ -132,6 +136,9 @@ public:
     ~MemTableFlushExecutor() {
         _flush_pool->shutdown();
         _high_prio_flush_pool->shutdown();
+        if (_column_encode_pool) {
+            _column_encode_pool->shutdown();
+        }
     }
 
     // init should be called after storage engine is opened,
@@ -160,9 +167,13 @@ public:
 
     ThreadPool* flush_pool() { return _flush_pool.get(); }
 
+    // nullptr if the columns of a segment are encoded one by one
+    ThreadPool* column_encode_pool() { return _column_encode_pool.get(); }
+
 private:
     std::unique_ptr<ThreadPool> _flush_pool;
     std::unique_ptr<ThreadPool> _high_prio_flush_pool;
+    std::unique_ptr<ThreadPool> _column_encode_pool;
     std::atomic<int> _flushing_task_count = 0;
 };
 
@@ -53,6 +53,8 @@ public:
 
     int64_t mem_usage() const { return _mem_usage; }
 
+    int64_t load_soft_mem_limit() const { return _load_soft_mem_limit; }
+
 private:
     // check if the total mem consumption exceeds limit.
     // If yes, it will flush memtable to try to reduce memory consumption.
@@ -291,6 +291,8 @@ void MemTableWriter::_update_profile(RuntimeProfile* profile) {
     auto put_into_output_timer = ADD_TIMER(child, "MemTablePutIntoOutputTime");
     auto delete_bitmap_timer = ADD_TIMER(child, "DeleteBitmapTime");
     auto close_wait_timer = ADD_TIMER(child, "CloseWaitTime");
+    auto to_block_timer = ADD_TIMER(child, "FlushToBlockTime");
+    auto flush_write_timer = ADD_TIMER(child, "FlushWriteTime");
     auto sort_times = ADD_COUNTER(child, "MemTableSortTimes", TUnit::UNIT);
     auto agg_times = ADD_COUNTER(child, "MemTableAggTimes", TUnit::UNIT);
     auto segment_num = ADD_COUNTER(child, "SegmentNum", TUnit::UNIT);
@@ -312,6 +314,9 @@ void MemTableWriter::_update_profile(RuntimeProfile* profile) {
     COUNTER_SET(agg_times, memtable_stat.agg_times);
     COUNTER_SET(raw_rows_num, memtable_stat.raw_rows);
     COUNTER_SET(merged_rows_num, memtable_stat.merged_rows);
+    const auto& flush_stat = _flush_token->get_stats();
+    COUNTER_SET(to_block_timer, static_cast<int64_t>(flush_stat.flush_to_block_time_ns.load()));
+    COUNTER_SET(flush_write_timer, static_cast<int64_t>(flush_stat.flush_write_time_ns.load()));
 }
 
 Status MemTableWriter::cancel() {
@@ -23,6 +23,9 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <iterator>
 #include <memory>
 #include <mutex>
@@ -38,6 +41,7 @@
 #include "common/logging.h"
 #include "common/status.h"
 #include "olap/base_tablet.h"
+#include "olap/compaction_io_limiter.h"
 #include "olap/iterators.h"
 #include "olap/olap_common.h"
 #include "olap/olap_define.h"
@@ -52,7 +56,10 @@
 #include "olap/tablet_meta.h"
 #include "olap/tablet_reader.h"
 #include "olap/utils.h"
+#include "runtime/thread_context.h"
+#include "util/defer_op.h"
 #include "util/slice.h"
+#include "util/threadpool.h"
 #include "vec/core/block.h"
 #include "vec/olap/block_reader.h"
 #include "vec/olap/vertical_block_reader.h"
@@ -240,22 +247,22 @@ void Merger::vertical_split_columns(const TabletSchema& tablet_schema,
     }
 }
 
-Status Merger::vertical_compact_one_group(
-        BaseTabletSPtr tablet, ReaderType reader_type, const TabletSchema& tablet_schema,
-        bool is_key, const std::vector<uint32_t>& column_group,
-        vectorized::RowSourcesBuffer* row_source_buf,
-        const std::vector<RowsetReaderSharedPtr>& src_rowset_readers,
-        RowsetWriter* dst_rowset_writer, int64_t max_rows_per_segment, Statistics* stats_output,
-        std::vector<uint32_t> key_group_cluster_key_idxes, int64_t batch_size,
-        CompactionSampleInfo* sample_info) {
-    // build tablet reader
-    VLOG_NOTICE << "vertical compact one group, max_rows_per_segment=" << max_rows_per_segment;
-    vectorized::VerticalBlockReader reader(row_source_buf);
-    TabletReader::ReaderParams reader_params;
-    reader_params.is_key_column_group = is_key;
-    reader_params.key_group_cluster_key_idxes = key_group_cluster_key_idxes;
-    reader_params.tablet = tablet;
-    reader_params.reader_type = reader_type;
+namespace {
+
+// Init `reader` to merge `column_group` of the source rowsets, it points into `reader_params`.
+Status init_group_reader(const BaseTabletSPtr& tablet, ReaderType reader_type,
+                         const TabletSchema& tablet_schema, bool is_key,
+                         const std::vector<uint32_t>& column_group,
+                         const std::vector<RowsetReaderSharedPtr>& src_rowset_readers,
+                         RowsetWriter* dst_rowset_writer, Merger::Statistics* stats_output,
+                         std::vector<uint32_t> key_group_cluster_key_idxes, int64_t batch_size,
+                         CompactionSampleInfo* sample_info,
+                         TabletReader::ReaderParams* reader_params,
+                         vectorized::VerticalBlockReader* reader) {
+    reader_params->is_key_column_group = is_key;
+    reader_params->key_group_cluster_key_idxes = std::move(key_group_cluster_key_idxes);
+    reader_params->tablet = tablet;
+    reader_params->reader_type = reader_type;
 
     TabletReader::ReadSource read_source;
     read_source.rs_splits.reserve(src_rowset_readers.size());
@@ -263,45 +270,73 @@ Status Merger::vertical_compact_one_group(
         read_source.rs_splits.emplace_back(rs_reader);
     }
     read_source.fill_delete_predicates();
-    reader_params.set_read_source(std::move(read_source));
+    reader_params->set_read_source(std::move(read_source));
 
-    reader_params.version = dst_rowset_writer->version();
+    reader_params->version = dst_rowset_writer->version();
 
     TabletSchemaSPtr merge_tablet_schema = std::make_shared<TabletSchema>();
     merge_tablet_schema->copy_from(tablet_schema);
 
-    for (auto& del_pred_rs : reader_params.delete_predicates) {
+    for (auto& del_pred_rs : reader_params->delete_predicates) {
         merge_tablet_schema->merge_dropped_columns(*del_pred_rs->tablet_schema());
     }
 
-    reader_params.tablet_schema = merge_tablet_schema;
-    bool has_cluster_key = false;
+    reader_params->tablet_schema = merge_tablet_schema;
     if (!tablet->tablet_schema()->cluster_key_uids().empty()) {
-        reader_params.delete_bitmap = &tablet->tablet_meta()->delete_bitmap();
-        has_cluster_key = true;
+        reader_params->delete_bitmap = &tablet->tablet_meta()->delete_bitmap();
     }
 
     if (is_key && stats_output && stats_output->rowid_conversion) {
-        reader_params.record_rowids = true;
-        reader_params.rowid_conversion = stats_output->rowid_conversion;
+        reader_params->record_rowids = true;
+        reader_params->rowid_conversion = stats_output->rowid_conversion;
         stats_output->rowid_conversion->set_dst_rowset_id(dst_rowset_writer->rowset_id());
     }
 
-    reader_params.return_columns = column_group;
-    reader_params.origin_return_columns = &reader_params.return_columns;
-    reader_params.batch_size = batch_size;
-    RETURN_IF_ERROR(reader.init(reader_params, sample_info));
+    reader_params->return_columns = column_group;
+    reader_params->origin_return_columns = &reader_params->return_columns;
+    reader_params->batch_size = batch_size;
+    return reader->init(*reader_params, sample_info);
+}
+
+Status check_merge_state(const BaseTabletSPtr& tablet) {
+    auto tablet_state = tablet->tablet_state();
+    if (tablet_state != TABLET_RUNNING && tablet_state != TABLET_NOTREADY) {
+        tablet->clear_cache();
+        return Status::Error<INTERNAL_ERROR>("tablet {} is not used any more",
+                                             tablet->tablet_id());
+    }
+    if (ExecEnv::GetInstance()->storage_engine().stopped()) {
+        return Status::Error<INTERNAL_ERROR>("tablet {} failed to do compaction, engine stopped",
+                                             tablet->tablet_id());
+    }
+    return Status::OK();
+}
+
+} // namespace
+
+Status Merger::vertical_compact_one_group(
+        BaseTabletSPtr tablet, ReaderType reader_type, const TabletSchema& tablet_schema,
+        bool is_key, const std::vector<uint32_t>& column_group,
+        vectorized::RowSourcesBuffer* row_source_buf,
+        const std::vector<RowsetReaderSharedPtr>& src_rowset_readers,
+        RowsetWriter* dst_rowset_writer, int64_t max_rows_per_segment, Statistics* stats_output,
+        std::vector<uint32_t> key_group_cluster_key_idxes, int64_t batch_size,
+        CompactionSampleInfo* sample_info) {
+    // build tablet reader
+    VLOG_NOTICE << "vertical compact one group, max_rows_per_segment=" << max_rows_per_segment;
+    vectorized::VerticalBlockReader reader(row_source_buf);
+    TabletReader::ReaderParams reader_params;
+    RETURN_IF_ERROR(init_group_reader(tablet, reader_type, tablet_schema, is_key, column_group,
+                                      src_rowset_readers, dst_rowset_writer, stats_output,
+                                      std::move(key_group_cluster_key_idxes), batch_size,
+                                      sample_info, &reader_params, &reader));
+    bool has_cluster_key = !tablet->tablet_schema()->cluster_key_uids().empty();
 
     vectorized::Block block = tablet_schema.create_block(reader_params.return_columns);
     size_t output_rows = 0;
     bool eof = false;
-    while (!eof && !ExecEnv::GetInstance()->storage_engine().stopped()) {
-        auto tablet_state = tablet->tablet_state();
-        if (tablet_state != TABLET_RUNNING && tablet_state != TABLET_NOTREADY) {
-            tablet->clear_cache();
-            return Status::Error<INTERNAL_ERROR>("tablet {} is not used any more",
-                                                 tablet->tablet_id());
-        }
+    while (!eof) {
+        RETURN_IF_ERROR(check_merge_state(tablet));
         // Read one block from block reader
         RETURN_NOT_OK_STATUS_WITH_WARN(reader.next_block_with_aggregation(&block, &eof),
                                        "failed to read next block when merging rowsets of tablet " +
@@ -321,10 +356,6 @@ Status Merger::vertical_compact_one_group(
         output_rows += block.rows();
         block.clear_column_data();
     }
-    if (ExecEnv::GetInstance()->storage_engine().stopped()) {
-        return Status::Error<INTERNAL_ERROR>("tablet {} failed to do compaction, engine stopped",
-                                             tablet->tablet_id());
-    }
 
     if (is_key && stats_output != nullptr) {
         stats_output->output_rows = output_rows;
@@ -456,11 +487,162 @@ int64_t estimate_batch_size(int group_index, BaseTabletSPtr tablet, int64_t way_
     return res;
 }
 
+namespace {
+
+// Merges value column groups in the threads of value_column_group_thread_pool, ahead of the
+// group being written. The columns of a segment are written group by group, so the merged blocks
+// of a group wait in memory until the group is written, and the waiting blocks of a compaction
+// are bounded by vertical_compaction_value_group_prefetch_bytes. The writer merges a group
+// itself if no thread has started it yet, so it never waits for a task queued behind the tasks
+// of other compactions.
+class ValueGroupPrefetcher {
+public:
+    struct Group {
+        // set by the first of the writer and the pool thread to take the group
+        std::atomic<bool> claimed {false};
+        std::unique_ptr<vectorized::RowSourcesBuffer> row_sources;
+        std::vector<RowsetReaderSharedPtr> rs_readers;
+        int64_t batch_size = 0;
+        CompactionSampleInfo sample_info;
+        // protected by _lock
+        std::deque<vectorized::Block> blocks;
+        bool finished = false;
+        Status status;
+    };
+
+    ValueGroupPrefetcher(size_t num_groups, int64_t memory_limit)
+            : _groups(num_groups), _memory_limit(memory_limit) {}
+
+    Group& group(size_t idx) { return _groups[idx]; }
+
+    bool claim(size_t idx) { return !_groups[idx].claimed.exchange(true); }
+
+    // Keep a merged block of group `idx` until it is written, return false if the merge is
+    // cancelled.
+    bool push(size_t idx, vectorized::Block&& block) {
+        std::unique_lock lock(_lock);
+        auto& group = _groups[idx];
+        // the group being written can go over the limit while the writer waits for it
+        _cond.wait(lock, [&]() {
+            return _cancelled || _buffered_bytes < _memory_limit ||
+                   (idx == _writing_group && group.blocks.empty());
+        });
+        if (_cancelled) {
+            return false;
+        }
+        _buffered_bytes += block.allocated_bytes();
+        group.blocks.push_back(std::move(block));
+        _cond.notify_all();
+        return true;
+    }
+
+    void finish(size_t idx, Status st) {
+        std::lock_guard lock(_lock);
+        _groups[idx].finished = true;
+        _groups[idx].status = std::move(st);
+        _cond.notify_all();
+    }
+
+    // Take the next merged block of group `idx` to write, set `eof` after the last one.
+    Status pop(size_t idx, vectorized::Block* block, bool* eof) {
+        std::unique_lock lock(_lock);
+        auto& group = _groups[idx];
+        if (_writing_group != idx) {
+            _writing_group = idx;
+            _cond.notify_all();
+        }
+        _cond.wait(lock, [&]() { return !group.blocks.empty() || group.finished; });
+        if (group.blocks.empty()) {
+            *eof = true;
+            return group.status;
+        }
+        *block = std::move(group.blocks.front());
+        group.blocks.pop_front();
+        _buffered_bytes -= block->allocated_bytes();
+        _cond.notify_all();
+        return Status::OK();
+    }
+
+    void cancel() {
+        std::lock_guard lock(_lock);
+        _cancelled = true;
+        _cond.notify_all();
+    }
+
+private:
+    std::vector<Group> _groups;
+    const int64_t _memory_limit;
+    std::mutex _lock;
+    std::condition_variable _cond;
+    int64_t _buffered_bytes = 0;
+    size_t _writing_group = 0;
+    bool _cancelled = false;
+};
+
+void prefetch_value_group(ValueGroupPrefetcher* prefetcher, size_t idx,
+                          const BaseTabletSPtr& tablet, ReaderType reader_type,
+                          const TabletSchema& tablet_schema,
+                          const std::vector<uint32_t>& column_group,
+                          RowsetWriter* dst_rowset_writer,
+                          const std::vector<uint32_t>& key_group_cluster_key_idxes) {
+    if (!prefetcher->claim(idx)) {
+        return;
+    }
+    auto& group = prefetcher->group(idx);
+    Status st = [&]() -> Status {
+        vectorized::VerticalBlockReader reader(group.row_sources.get());
+        TabletReader::ReaderParams reader_params;
+        RETURN_IF_ERROR(init_group_reader(tablet, reader_type, tablet_schema, false, column_group,
+                                          group.rs_readers, dst_rowset_writer, nullptr,
+                                          key_group_cluster_key_idxes, group.batch_size,
+                                          &group.sample_info, &reader_params, &reader));
+        bool eof = false;
+        while (!eof) {
+            RETURN_IF_ERROR(check_merge_state(tablet));
+            vectorized::Block block = tablet_schema.create_block(reader_params.return_columns);
+            RETURN_NOT_OK_STATUS_WITH_WARN(
+                    reader.next_block_with_aggregation(&block, &eof),
+                    "failed to read next block when merging rowsets of tablet " +
+                            std::to_string(tablet->tablet_id()));
+            if (block.rows() > 0 && !prefetcher->push(idx, std::move(block))) {
+                return Status::Cancelled("merge of value column group {} is cancelled", idx);
+            }
+        }
+        return Status::OK();
+    }();
+    prefetcher->finish(idx, std::move(st));
+}
+
+Status write_prefetched_group(ValueGroupPrefetcher* prefetcher, size_t idx, int64_t tablet_id,
+                              const std::vector<uint32_t>& column_group,
+                              RowsetWriter* dst_rowset_writer, int64_t max_rows_per_segment,
+                              bool has_cluster_key) {
+    VLOG_NOTICE << "write prefetched value column group " << idx << " of tablet " << tablet_id;
+    while (true) {
+        vectorized::Block block;
+        bool eof = false;
+        RETURN_IF_ERROR(prefetcher->pop(idx, &block, &eof));
+        if (eof) {
+            break;
+        }
+        RETURN_NOT_OK_STATUS_WITH_WARN(
+                dst_rowset_writer->add_columns(&block, column_group, false, max_rows_per_segment,
+                                               has_cluster_key),
+                "failed to write block when merging rowsets of tablet " +
+                        std::to_string(tablet_id));
+    }
+    return dst_rowset_writer->flush_columns(false);
+}
+
+} // namespace
+
 // steps to do vertical merge:
 // 1. split columns into column groups
 // 2. compact groups one by one, generate a row_source_buf when compact key group
 // and use this row_source_buf to compact value column groups
 // 3. build output rowset
+// With value_column_group_thread_pool, the value groups after the first one are merged in the
+// pool while the groups before them are written.
 Status Merger::vertical_merge_rowsets(BaseTabletSPtr tablet, ReaderType reader_type,
                                       const TabletSchema& tablet_schema,
                                       const std::vector<RowsetReaderSharedPtr>& src_rowset_readers,
@@ -477,18 +659,69 @@ Status Merger::vertical_merge_rowsets(BaseTabletSPtr tablet, ReaderType reader_t
         std::unique_lock<std::mutex> lock(tablet->sample_info_lock);
         tablet->sample_infos.resize(column_groups.size(), {0, 0, 0});
     }
+    std::vector<int64_t> batch_sizes(column_groups.size());
+    for (auto i = 0; i < column_groups.size(); ++i) {
+        batch_sizes[i] = config::compaction_batch_size != -1
+                                 ? config::compaction_batch_size
+                                 : estimate_batch_size(i, tablet, merge_way_num);
+    }
+    bool has_cluster_key = !tablet->tablet_schema()->cluster_key_uids().empty();
+
+    auto* thread_pool = ExecEnv::GetInstance()->storage_engine().value_column_group_thread_pool();
+    std::unique_ptr<ValueGroupPrefetcher> prefetcher;
+    std::unique_ptr<ThreadPoolToken> token;
+    Defer defer {[&]() {
+        if (token != nullptr) {
+            prefetcher->cancel();
+            token->shutdown();
+        }
+    }};
+    // the first value group is merged by the writer right after the key group, so the pool
+    // starts from the second one
+    auto start_prefetch = [&]() -> Status {
+        prefetcher = std::make_unique<ValueGroupPrefetcher>(
+                column_groups.size(), config::vertical_compaction_value_group_prefetch_bytes);
+        for (size_t i = 2; i < column_groups.size(); ++i) {
+            auto& group = prefetcher->group(i);
+            RETURN_IF_ERROR(row_sources_buf.create_reader(&group.row_sources));
+            for (const auto& rs_reader : src_rowset_readers) {
+                group.rs_readers.push_back(rs_reader->clone());
+            }
+            group.batch_size = batch_sizes[i];
+        }
+        auto mem_tracker = thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker_sptr();
+        auto io_class = CompactionIOLimiter::current_io_class();
+        token = thread_pool->new_token(ThreadPool::ExecutionMode::CONCURRENT);
+        for (size_t i = 2; i < column_groups.size(); ++i) {
+            // a group which can not be submitted is merged by the writer
+            static_cast<void>(token->submit_func([&, mem_tracker, io_class, i]() {
+                SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(mem_tracker);
+                CompactionIOLimiter::ScopedIOClass scoped_io_class(io_class);
+                prefetch_value_group(prefetcher.get(), i, tablet, reader_type, tablet_schema,
+                                     column_groups[i], dst_rowset_writer,
+                                     key_group_cluster_key_idxes);
+            }));
+        }
+        return Status::OK();
+    };
+
     // compact group one by one
     for (auto i = 0; i < column_groups.size(); ++i) {
         VLOG_NOTICE << "row source size: " << row_sources_buf.total_size();
         bool is_key = (i == 0);
-        int64_t batch_size = config::compaction_batch_size != -1
-                                     ? config::compaction_batch_size
-                                     : estimate_batch_size(i, tablet, merge_way_num);
         CompactionSampleInfo sample_info;
-        Status st = vertical_compact_one_group(
-                tablet, reader_type, tablet_schema, is_key, column_groups[i], &row_sources_buf,
-                src_rowset_readers, dst_rowset_writer, max_rows_per_segment, stats_output,
-                key_group_cluster_key_idxes, batch_size, &sample_info);
+        Status st;
+        if (prefetcher != nullptr && !prefetcher->claim(i)) {
+            st = write_prefetched_group(prefetcher.get(), i, tablet->tablet_id(), column_groups[i],
+                                        dst_rowset_writer, max_rows_per_segment,
+                                        has_cluster_key);
+            sample_info = prefetcher->group(i).sample_info;
+        } else {
+            st = vertical_compact_one_group(
+                    tablet, reader_type, tablet_schema, is_key, column_groups[i],
+                    &row_sources_buf, src_rowset_readers, dst_rowset_writer, max_rows_per_segment,
+                    stats_output, key_group_cluster_key_idxes, batch_sizes[i], &sample_info);
+        }
         {
             std::unique_lock<std::mutex> lock(tablet->sample_info_lock);
             tablet->sample_infos[i] = sample_info;
@@ -496,6 +729,9 @@ Status Merger::vertical_merge_rowsets(BaseTabletSPtr tablet, ReaderType reader_t
         RETURN_IF_ERROR(st);
         if (is_key) {
             RETURN_IF_ERROR(row_sources_buf.flush());
+            if (thread_pool != nullptr && column_groups.size() > 2) {
+                RETURN_IF_ERROR(start_prefetch());
+            }
         }
         RETURN_IF_ERROR(row_sources_buf.seek_to_begin());
     }
@@ -327,6 +327,9 @@ struct OlapReaderStatistics {
     int64_t rows_expr_cond_filtered = 0;
     int64_t vec_cond_input_rows = 0;
     int64_t short_circuit_cond_input_rows = 0;
+    // rows of the staged predicate columns, read or skipped since filtered by previous stages
+    int64_t staged_pred_column_read_rows = 0;
+    int64_t staged_pred_column_skipped_rows = 0;
     int64_t expr_cond_input_rows = 0;
     int64_t rows_vec_del_cond_filtered = 0;
     int64_t vec_cond_ns = 0;
@@ -334,8 +337,10 @@ struct OlapReaderStatistics {
     int64_t expr_filter_ns = 0;
     int64_t output_col_ns = 0;
     int64_t rows_key_range_filtered = 0;
+    int64_t rows_sample_filtered = 0;
     int64_t rows_stats_filtered = 0;
     int64_t rows_stats_rp_filtered = 0;
+    int64_t rows_stats_late_rf_filtered = 0;
     int64_t rows_bf_filtered = 0;
     int64_t rows_dict_filtered = 0;
     // Including the number of rows filtered out according to the Delete information in the Tablet,
@@ -357,6 +362,10 @@ struct OlapReaderStatistics {
 
     int64_t total_pages_num = 0;
     int64_t cached_pages_num = 0;
+    int64_t decoded_dict_page_cache_hit = 0;
+    // merged data page reads submitted to prefetch remote segments into the file cache
+    int64_t remote_page_prefetch_ranges = 0;
+    int64_t remote_page_prefetch_bytes = 0;
 
     int64_t rows_bitmap_index_filtered = 0;
     int64_t bitmap_index_filter_timer = 0;
@@ -100,6 +100,8 @@ volatile uint32_t g_schema_change_active_threads = 0;
 
 static const uint64_t DEFAULT_SEED = 104729;
 static const uint64_t MOD_PRIME = 7652413;
+// bounds how long an async publish task holds the rowset update lock of a tablet
+static const size_t MAX_ASYNC_PUBLISH_VERSIONS_PER_TASK = 64;
 
 CompactionSubmitRegistry::CompactionSubmitRegistry(CompactionSubmitRegistry&& r) {
     std::swap(_tablet_submitted_cumu_compaction, r._tablet_submitted_cumu_compaction);
@@ -268,6 +270,18 @@ Status StorageEngine::start_bg_threads(std::shared_ptr<WorkloadGroup> wg_sptr) {
                             .set_min_threads(config::cold_data_compaction_thread_num)
                             .set_max_threads(config::cold_data_compaction_thread_num)
                             .build(&_cold_data_compaction_thread_pool));
+    if (config::index_build_thread_num > 0) {
+        RETURN_IF_ERROR(ThreadPoolBuilder("IndexBuildThreadPool")
+                                .set_min_threads(config::index_build_thread_num)
+                                .set_max_threads(config::index_build_thread_num)
+                                .build(&_index_build_thread_pool));
+    }
+    if (config::vertical_compaction_value_group_thread_num > 0) {
+        RETURN_IF_ERROR(ThreadPoolBuilder("ValueColumnGroupThreadPool")
+                                .set_min_threads(config::vertical_compaction_value_group_thread_num)
+                                .set_max_threads(config::vertical_compaction_value_group_thread_num)
+                                .build(&_value_column_group_thread_pool));
+    }
 
     // compaction tasks producer thread
     RETURN_IF_ERROR(Thread::create(
@@ -1668,6 +1682,7 @@ int64_t StorageEngine::get_pending_publish_min_version(int64_t tablet_id) {
 void StorageEngine::_process_async_publish() {
     // tablet, publish_version
     std::vector<std::pair<TabletSharedPtr, int64_t>> need_removed_tasks;
+    std::vector<std::shared_ptr<AsyncTabletPublishTask>> async_publish_tasks;
     {
         std::unique_lock<std::shared_mutex> wlock(_async_publish_lock);
         for (auto tablet_iter = _async_publish_tasks.begin();
@@ -1687,8 +1702,6 @@ void StorageEngine::_process_async_publish() {
 
             auto task_iter = tablet_iter->second.begin();
             int64_t version = task_iter->first;
-            int64_t transaction_id = task_iter->second.first;
-            int64_t partition_id = task_iter->second.second;
             int64_t max_version = tablet->max_version().second;
 
             if (version <= max_version) {
@@ -1709,12 +1722,18 @@ void StorageEngine::_process_async_publish() {
                 continue;
             }
 
-            auto async_publish_task = std::make_shared<AsyncTabletPublishTask>(
-                    *this, tablet, partition_id, transaction_id, version);
-            static_cast<void>(_tablet_publish_txn_thread_pool->submit_func(
-                    [=]() { async_publish_task->handle(); }));
-            tablet_iter->second.erase(task_iter);
-            need_removed_tasks.emplace_back(tablet, version);
+            // Take the whole run of consecutive versions, so a backlog of a tablet is published
+            // in one task instead of one version per round.
+            AsyncTabletPublishTask::Versions versions;
+            while (task_iter != tablet_iter->second.end() && task_iter->first == version &&
+                   versions.size() < MAX_ASYNC_PUBLISH_VERSIONS_PER_TASK) {
+                versions.emplace(version, task_iter->second);
+                need_removed_tasks.emplace_back(tablet, version);
+                task_iter = tablet_iter->second.erase(task_iter);
+                version++;
+            }
+            async_publish_tasks.push_back(
+                    std::make_shared<AsyncTabletPublishTask>(*this, tablet, std::move(versions)));
             tablet_iter++;
         }
     }
@@ -1722,6 +1741,11 @@ void StorageEngine::_process_async_publish() {
         static_cast<void>(TabletMetaManager::remove_pending_publish_info(
                 tablet->data_dir(), tablet->tablet_id(), publish_version));
     }
+    // submitted after the pending publish infos are removed, a task that fails saves them again
+    for (auto& async_publish_task : async_publish_tasks) {
+        static_cast<void>(_tablet_publish_txn_thread_pool->submit_func(
+                [=]() { async_publish_task->handle(); }));
+    }
 }
 
 void StorageEngine::_async_publish_callback() {
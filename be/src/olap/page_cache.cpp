@@ -74,13 +74,15 @@ MemoryTrackedPageWithPagePtr<T>::~MemoryTrackedPageWithPagePtr() {
 StoragePageCache* StoragePageCache::create_global_cache(size_t capacity,
                                                         int32_t index_cache_percentage,
                                                         int64_t pk_index_cache_capacity,
-                                                        uint32_t num_shards) {
+                                                        uint32_t num_shards,
+                                                        int64_t decoded_page_cache_capacity) {
     return new StoragePageCache(capacity, index_cache_percentage, pk_index_cache_capacity,
-                                num_shards);
+                                num_shards, decoded_page_cache_capacity);
 }
 
 StoragePageCache::StoragePageCache(size_t capacity, int32_t index_cache_percentage,
-                                   int64_t pk_index_cache_capacity, uint32_t num_shards)
+                                   int64_t pk_index_cache_capacity, uint32_t num_shards,
+                                   int64_t decoded_page_cache_capacity)
         : _index_cache_percentage(index_cache_percentage) {
     if (index_cache_percentage == 0) {
         _data_page_cache = std::make_unique<DataPageCache>(capacity, num_shards);
@@ -96,6 +98,10 @@ StoragePageCache::StoragePageCache(size_t capacity, int32_t index_cache_percenta
     }
 
     _pk_index_page_cache = std::make_unique<PKIndexPageCache>(pk_index_cache_capacity, num_shards);
+    if (decoded_page_cache_capacity > 0) {
+        _decoded_page_cache =
+                std::make_unique<DecodedPageCache>(decoded_page_cache_capacity, num_shards);
+    }
 }
 
 bool StoragePageCache::lookup(const CacheKey& key, PageCacheHandle* handle,
@@ -83,6 +83,19 @@ public:
     void set_data(std::shared_ptr<T> data) { this->_data = data; }
 };
 
+// Value of the decoded page cache, the memory of data is tracked by the cache
+// while the entry is in the cache.
+template <typename T>
+class DecodedPage : public LRUCacheValueBase {
+public:
+    explicit DecodedPage(std::shared_ptr<T> data) : _data(std::move(data)) {}
+
+    const std::shared_ptr<T>& data() const { return _data; }
+
+private:
+    std::shared_ptr<T> _data;
+};
+
 using SemgnetFooterPBPage = MemoryTrackedPageWithPagePtr<segment_v2::SegmentFooterPB>;
 using DataPage = MemoryTrackedPageWithPageEntity;
 
@@ -119,6 +132,7 @@ public:
                 : LRUCachePolicy(CachePolicy::CacheType::DATA_PAGE_CACHE, capacity,
                                  LRUCacheType::SIZE, config::data_page_cache_stale_sweep_time_sec,
                                  num_shards, DEFAULT_LRU_CACHE_ELEMENT_COUNT_CAPACITY, true, true) {
+            set_tiny_lfu_admission(config::enable_data_page_cache_tiny_lfu_admission);
         }
     };
 
@@ -127,7 +141,9 @@ public:
         IndexPageCache(size_t capacity, uint32_t num_shards)
                 : LRUCachePolicy(CachePolicy::CacheType::INDEXPAGE_CACHE, capacity,
                                  LRUCacheType::SIZE, config::index_page_cache_stale_sweep_time_sec,
-                                 num_shards) {}
+                                 num_shards) {
+            set_tiny_lfu_admission(config::enable_index_page_cache_tiny_lfu_admission);
+        }
     };
 
     class PKIndexPageCache : public LRUCachePolicy {
@@ -135,7 +151,19 @@ public:
         PKIndexPageCache(size_t capacity, uint32_t num_shards)
                 : LRUCachePolicy(CachePolicy::CacheType::PK_INDEX_PAGE_CACHE, capacity,
                                  LRUCacheType::SIZE,
-                                 config::pk_index_page_cache_stale_sweep_time_sec, num_shards) {}
+                                 config::pk_index_page_cache_stale_sweep_time_sec, num_shards) {
+            set_tiny_lfu_admission(config::enable_pk_index_page_cache_tiny_lfu_admission);
+        }
+    };
+
+    // Holds pages in their decoded form, e.g. the words of a dictionary page, so a hit
+    // skips the decoding as well as the IO.
+    class DecodedPageCache : public LRUCachePolicy {
+    public:
+        DecodedPageCache(size_t capacity, uint32_t num_shards)
+                : LRUCachePolicy(CachePolicy::CacheType::DECODED_PAGE_CACHE, capacity,
+                                 LRUCacheType::SIZE,
+                                 config::decoded_page_cache_stale_sweep_time_sec, num_shards) {}
     };
 
     static constexpr uint32_t kDefaultNumShards = 16;
@@ -143,14 +171,16 @@ public:
     // Create global instance of this class
     static StoragePageCache* create_global_cache(size_t capacity, int32_t index_cache_percentage,
                                                  int64_t pk_index_cache_capacity,
-                                                 uint32_t num_shards = kDefaultNumShards);
+                                                 uint32_t num_shards = kDefaultNumShards,
+                                                 int64_t decoded_page_cache_capacity = 0);
 
     // Return global instance.
     // Client should call create_global_cache before.
     static StoragePageCache* instance() { return ExecEnv::GetInstance()->get_storage_page_cache(); }
 
     StoragePageCache(size_t capacity, int32_t index_cache_percentage,
-                     int64_t pk_index_cache_capacity, uint32_t num_shards);
+                     int64_t pk_index_cache_capacity, uint32_t num_shards,
+                     int64_t decoded_page_cache_capacity = 0);
 
     // Lookup the given page in the cache.
     //
@@ -186,6 +216,31 @@ public:
         return _get_page_cache(page_type)->mem_tracker();
     }
 
+    bool has_decoded_page_cache() const { return _decoded_page_cache != nullptr; }
+
+    // Lookup the decoded form of the page with the given key, return nullptr if not found.
+    // The returned data stays valid after the entry is evicted.
+    template <typename T>
+    std::shared_ptr<T> lookup_decoded(const CacheKey& key) {
+        DCHECK(has_decoded_page_cache());
+        auto* lru_handle = _decoded_page_cache->lookup(key.encode());
+        if (lru_handle == nullptr) {
+            return nullptr;
+        }
+        auto data = ((DecodedPage<T>*)_decoded_page_cache->value(lru_handle))->data();
+        _decoded_page_cache->release(lru_handle);
+        return data;
+    }
+
+    // Insert the decoded form of the page with the given key, size is the memory held by data.
+    template <typename T>
+    void insert_decoded(const CacheKey& key, std::shared_ptr<T> data, size_t size) {
+        DCHECK(has_decoded_page_cache());
+        auto* page = new DecodedPage<T>(std::move(data));
+        _decoded_page_cache->release(
+                _decoded_page_cache->insert(key.encode(), page, size, size, CachePriority::NORMAL));
+    }
+
 private:
     StoragePageCache();
 
@@ -196,6 +251,8 @@ private:
     // page cache to make it for flexible. we need this cache When construct
     // delete bitmap in unique key with mow
     std::unique_ptr<PKIndexPageCache> _pk_index_page_cache;
+    // nullptr if decoded_page_cache_limit is 0
+    std::unique_ptr<DecodedPageCache> _decoded_page_cache;
 
     LRUCachePolicy* _get_page_cache(segment_v2::PageTypePB page_type) {
         switch (page_type) {
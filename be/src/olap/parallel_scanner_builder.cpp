@@ -17,11 +17,13 @@
 
 #include "parallel_scanner_builder.h"
 
+#include <algorithm>
 #include <cstddef>
 
 #include "cloud/cloud_storage_engine.h"
 #include "cloud/cloud_tablet_hotspot.h"
 #include "cloud/config.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "olap/rowset/beta_rowset.h"
 #include "olap/segment_loader.h"
@@ -77,6 +79,9 @@ Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<ScannerSPtr>&
                 const size_t rows_of_segment = segments_rows[i];
                 RowRanges row_ranges;
                 int64_t offset_in_segment = 0;
+                // first ordinals of the data pages of this segment, loaded when it is split
+                std::vector<segment_v2::ordinal_t> page_ordinals;
+                bool page_ordinals_loaded = false;
 
                 // try to split large segments into RowRanges
                 while (offset_in_segment < rows_of_segment) {
@@ -86,6 +91,18 @@ Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<ScannerSPtr>&
                     // 0.9: try to avoid splitting the segments into excessively small parts.
                     if (rows_need >= remaining_rows * 0.9) {
                         rows_need = remaining_rows;
+                    } else {
+                        // The segment is split here. Move the split point forward to the start
+                        // of a data page, so that the two scanners do not both read and decode
+                        // the page across the split point.
+                        if (!page_ordinals_loaded) {
+                            RETURN_IF_ERROR(_get_page_ordinals(rowset, i, &page_ordinals));
+                            page_ordinals_loaded = true;
+                        }
+                        auto it = std::lower_bound(page_ordinals.begin(), page_ordinals.end(),
+                                                   offset_in_segment + rows_need);
+                        rows_need = it == page_ordinals.end() ? remaining_rows
+                                                              : *it - offset_in_segment;
                     }
                     DCHECK_LE(rows_need, remaining_rows);
 
@@ -159,6 +176,30 @@ Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<ScannerSPtr>&
     return Status::OK();
 }
 
+/**
+ * Get the first ordinals of the data pages of the first column in `segment_id` of `rowset`.
+ * The first column is the leading sort key, which most queries read and filter on.
+ */
+Status ParallelScannerBuilder::_get_page_ordinals(const RowsetSharedPtr& rowset,
+                                                  size_t segment_id,
+                                                  std::vector<segment_v2::ordinal_t>* ordinals) {
+    ordinals->clear();
+    if (!config::enable_parallel_scan_page_aligned_split) {
+        return Status::OK();
+    }
+    auto beta_rowset = std::dynamic_pointer_cast<BetaRowset>(rowset);
+    if (beta_rowset == nullptr || rowset->tablet_schema()->num_columns() == 0) {
+        return Status::OK();
+    }
+    SegmentCacheHandle segment_cache_handle;
+    RETURN_IF_ERROR(SegmentLoader::instance()->load_segment(
+            beta_rowset, segment_id, &segment_cache_handle, true));
+    DCHECK_EQ(segment_cache_handle.get_segments().size(), 1);
+    OlapReaderStatistics stats;
+    return segment_cache_handle.get_segments()[0]->get_data_page_first_ordinals(
+            rowset->tablet_schema()->column(0), &stats, ordinals);
+}
+
 /**
  * Load rowsets of each tablet with specified version, segments of each rowset.
  */
@@ -69,6 +69,9 @@ private:
 
     Status _build_scanners_by_rowid(std::list<ScannerSPtr>& scanners);
 
+    Status _get_page_ordinals(const RowsetSharedPtr& rowset, size_t segment_id,
+                              std::vector<segment_v2::ordinal_t>* ordinals);
+
     std::shared_ptr<vectorized::OlapScanner> _build_scanner(
             BaseTabletSPtr tablet, int64_t version, const std::vector<OlapScanRange*>& key_ranges,
             TabletReader::ReadSource&& read_source);
@@ -19,6 +19,8 @@
 
 #include <gen_cpp/olap_file.pb.h>
 
+#include <algorithm>
+
 #include "common/consts.h"
 #include "common/logging.h"
 #include "olap/base_tablet.h"
@@ -316,8 +318,23 @@ Status FixedReadPlan::read_columns_by_plan(
         for (const auto& [segment_id, mappings] : segment_row_mappings) {
             auto rowset_iter = rsid_to_rowset.find(rowset_id);
             CHECK(rowset_iter != rsid_to_rowset.end());
+            // read rows in rowid order, so that each page of the old segment is only decoded once
+            const std::vector<RidAndPos>* ordered_mappings = &mappings;
+            std::vector<RidAndPos> sorted_mappings;
+            if (!std::is_sorted(mappings.begin(), mappings.end(),
+                                [](const RidAndPos& lhs, const RidAndPos& rhs) {
+                                    return lhs.rid < rhs.rid;
+                                })) {
+                sorted_mappings = mappings;
+                std::sort(sorted_mappings.begin(), sorted_mappings.end(),
+                          [](const RidAndPos& lhs, const RidAndPos& rhs) {
+                              return lhs.rid < rhs.rid;
+                          });
+                ordered_mappings = &sorted_mappings;
+            }
             std::vector<uint32_t> rids;
-            for (auto [rid, pos] : mappings) {
+            rids.reserve(ordered_mappings->size());
+            for (auto [rid, pos] : *ordered_mappings) {
                 if (cur_delete_signs && cur_delete_signs[pos]) {
                     continue;
                 }
@@ -374,6 +391,22 @@ Status FixedReadPlan::fill_missing_columns(
             old_value_block, default_value_block));
     auto mutable_default_value_columns = default_value_block.mutate_columns();
 
+    // Rows which take their values from the old rows are gathered into runs and appended
+    // column by column, instead of inserting every cell of every missing column one at a time
+    std::vector<uint32_t> old_rows_to_insert;
+    old_rows_to_insert.reserve(use_default_or_null_flag.size());
+    auto flush_old_rows = [&]() {
+        if (old_rows_to_insert.empty()) {
+            return;
+        }
+        for (auto i = 0; i < missing_cids.size(); ++i) {
+            mutable_full_columns[missing_cids[i]]->insert_indices_from(
+                    *old_value_block.get_by_position(i).column, old_rows_to_insert.data(),
+                    old_rows_to_insert.data() + old_rows_to_insert.size());
+        }
+        old_rows_to_insert.clear();
+    };
+
     // fill all missing value from mutable_old_columns, need to consider default value and null value
     for (auto idx = 0; idx < use_default_or_null_flag.size(); idx++) {
         // `use_default_or_null_flag[idx] == false` doesn't mean that we should read values from the old row
@@ -386,6 +419,7 @@ Status FixedReadPlan::fill_missing_columns(
         auto pos_in_old_block = read_index[segment_pos];
         if (use_default_or_null_flag[idx] ||
             (old_delete_signs != nullptr && old_delete_signs[pos_in_old_block] != 0)) {
+            flush_old_rows();
             for (auto i = 0; i < missing_cids.size(); ++i) {
                 // if the column has default value, fill it with default value
                 // otherwise, if the column is nullable, fill it with null value
@@ -417,11 +451,9 @@ block->get_by_name(BeConsts::PARTIAL_UPDATE_AUTO_INC_COL).column.get())->get_ele
             }
             continue;
         }
-        for (auto i = 0; i < missing_cids.size(); ++i) {
-            mutable_full_columns[missing_cids[i]]->insert_from(
-                    *old_value_block.get_by_position(i).column, pos_in_old_block);
-        }
+        old_rows_to_insert.emplace_back(pos_in_old_block);
     }
+    flush_old_rows();
     full_block.set_columns(std::move(mutable_full_columns));
     return Status::OK();
 }
@@ -20,6 +20,7 @@
 
 #include "io/io_common.h"
 #include "olap/column_predicate.h"
+#include "olap/late_arrival_predicates.h"
 #include "olap/olap_common.h"
 #include "olap/rowid_conversion.h"
 #include "runtime/runtime_state.h"
@@ -39,6 +40,7 @@ struct RowsetReaderContext {
     TabletSchemaSPtr tablet_schema = nullptr;
     std::vector<int> topn_filter_source_node_ids;
     int topn_filter_target_node_id = -1;
+    LateArrivalPredicatesSPtr late_arrival_predicates;
     // whether rowset should return ordered rows.
     bool need_ordered_result = true;
     // used for special optimization for query : ORDER BY key DESC LIMIT n
@@ -47,6 +49,9 @@ struct RowsetReaderContext {
     std::vector<uint32_t>* read_orderby_key_columns = nullptr;
     // limit of rows for read_orderby_key
     size_t read_orderby_key_limit = 0;
+    // sampling of the segments
+    double sample_rate = 1;
+    uint64_t sample_seed = 0;
     // filter_block arguments
     vectorized::VExprContextSPtrs filter_block_conjuncts;
     // projection columns: the set of columns rowset reader should return
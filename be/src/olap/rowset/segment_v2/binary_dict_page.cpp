@@ -24,8 +24,10 @@
 #include <utility>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/status.h"
+#include "olap/rowset/segment_v2/binary_fsst_page.h"
 #include "olap/rowset/segment_v2/bitshuffle_page.h"
 #include "util/coding.h"
 #include "util/slice.h" // for Slice
@@ -153,7 +155,7 @@ Status BinaryDictPageBuilder::finish(OwnedSlice* slice) {
     // TODO(gaodayue) separate page header and content to avoid this copy
     RETURN_IF_CATCH_EXCEPTION(
             { _buffer.append(data_slice.slice().data, data_slice.slice().size); });
-    encode_fixed32_le(&_buffer[0], _encoding_type);
+    encode_fixed32_le(&_buffer[0], _fsst_fallback ? BINARY_DICT_PAGE_FSST_MODE : _encoding_type);
     *slice = _buffer.build();
     return Status::OK();
 }
@@ -166,8 +168,13 @@ Status BinaryDictPageBuilder::reset() {
 
         if (_encoding_type == DICT_ENCODING && _dict_builder->is_page_full()) {
             PageBuilder* data_page_builder_ptr = nullptr;
-            RETURN_IF_ERROR(BinaryPlainPageBuilder<FieldType::OLAP_FIELD_TYPE_VARCHAR>::create(
-                    &data_page_builder_ptr, _options));
+            _fsst_fallback = config::enable_dict_page_fsst_fallback;
+            if (_fsst_fallback) {
+                RETURN_IF_ERROR(BinaryFsstPageBuilder::create(&data_page_builder_ptr, _options));
+            } else {
+                RETURN_IF_ERROR(BinaryPlainPageBuilder<FieldType::OLAP_FIELD_TYPE_VARCHAR>::create(
+                        &data_page_builder_ptr, _options));
+            }
             _data_page_builder.reset(data_page_builder_ptr);
             _encoding_type = PLAIN_ENCODING;
         } else {
@@ -231,7 +238,11 @@ Status BinaryDictPageDecoder::init() {
     size_t type = decode_fixed32_le((const uint8_t*)&_data.data[0]);
     _encoding_type = static_cast<EncodingTypePB>(type);
     _data.remove_prefix(BINARY_DICT_PAGE_HEADER_SIZE);
-    if (_encoding_type == DICT_ENCODING) {
+    if (type == BINARY_DICT_PAGE_FSST_MODE) {
+        // read like a plain page, only the strings are decompressed on the way
+        _encoding_type = PLAIN_ENCODING;
+        _data_page_decoder.reset(new BinaryFsstPageDecoder(_data, _options));
+    } else if (_encoding_type == DICT_ENCODING) {
         _data_page_decoder.reset(
                 _bit_shuffle_ptr =
                         new BitShufflePageDecoder<FieldType::OLAP_FIELD_TYPE_INT>(_data, _options));
@@ -46,6 +46,9 @@ template <FieldType Type>
 class BitShufflePageDecoder;
 
 enum { BINARY_DICT_PAGE_HEADER_SIZE = 4 };
+// Header mode of the pages after the dictionary overflowed, when their strings are compressed by
+// BinaryFsstPageBuilder instead of stored plain. It is kept clear of the EncodingTypePB values.
+enum : uint32_t { BINARY_DICT_PAGE_FSST_MODE = 1024 };
 
 // This type of page use dictionary encoding for strings.
 // There is only one dictionary page for all the data pages within a column.
@@ -54,9 +57,11 @@ enum { BINARY_DICT_PAGE_HEADER_SIZE = 4 };
 // Either header + embedded codeword page, which can be encoded with any
 //        int PageBuilder, when mode_ = DICT_ENCODING.
 // Or     header + embedded BinaryPlainPage, when mode_ = PLAIN_ENCODING.
+// Or     header + embedded BinaryFsstPage, when mode_ = BINARY_DICT_PAGE_FSST_MODE.
 // Data pages start with mode_ = DICT_ENCODING, when the size of dictionary
 // page go beyond the option_->dict_page_size, the subsequent data pages will switch
-// to string plain page automatically.
+// to string plain page automatically, or to BinaryFsstPage when
+// config::enable_dict_page_fsst_fallback is set.
 class BinaryDictPageBuilder : public PageBuilderHelper<BinaryDictPageBuilder> {
 public:
     using Self = BinaryDictPageBuilder;
@@ -94,6 +99,8 @@ private:
             nullptr;
 
     EncodingTypePB _encoding_type;
+    // the pages after the dictionary overflowed are BinaryFsstPage, not BinaryPlainPage
+    bool _fsst_fallback = false;
     struct HashOfSlice {
         size_t operator()(const Slice& slice) const { return crc32_hash(slice.data, slice.size); }
     };
@@ -108,6 +115,17 @@ private:
     uint32_t _empty_code = 0;
 };
 
+// The dictionary page of a column decoded into its words. It is shared by all iterators of
+// the column through the decoded page cache, in which case it owns a copy of the page data.
+struct DecodedDictPage {
+    std::unique_ptr<char[]> page_data;
+    size_t page_size = 0;
+    std::unique_ptr<BinaryPlainPageDecoder<FieldType::OLAP_FIELD_TYPE_VARCHAR>> decoder;
+    std::unique_ptr<StringRef[]> word_info;
+
+    size_t mem_size() const { return page_size + decoder->count() * sizeof(StringRef); }
+};
+
 class BinaryDictPageDecoder : public PageDecoder {
 public:
     BinaryDictPageDecoder(Slice data, const PageDecoderOptions& options);
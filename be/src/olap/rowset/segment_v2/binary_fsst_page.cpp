@@ -0,0 +1,240 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/binary_fsst_page.h"
+
+#include <algorithm>
+
+#include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/logging.h"
+#include "util/coding.h"
+
+namespace doris {
+namespace segment_v2 {
+
+// The symbol table is trained on about this many bytes of the page's strings.
+static constexpr size_t FSST_TRAINING_SAMPLE_SIZE = 16 * 1024;
+
+Status BinaryFsstPageBuilder::add(const uint8_t* vals, size_t* count) {
+    DCHECK(!_finished);
+    DCHECK_GT(*count, 0);
+    size_t i = 0;
+    const auto* src = reinterpret_cast<const Slice*>(vals);
+    while (!is_page_full() && i < *count) {
+        _offsets.push_back(_values.size());
+        RETURN_IF_CATCH_EXCEPTION(_values.append(src->data, src->size));
+        _size_estimate += src->size + sizeof(uint32_t);
+        i++;
+        src++;
+    }
+    *count = i;
+    return Status::OK();
+}
+
+Slice BinaryFsstPageBuilder::_value_at(size_t idx) const {
+    size_t end = idx + 1 < _offsets.size() ? _offsets[idx + 1] : _values.size();
+    return Slice(_values.data() + _offsets[idx], end - _offsets[idx]);
+}
+
+Status BinaryFsstPageBuilder::finish(OwnedSlice* slice) {
+    DCHECK(!_finished);
+    _finished = true;
+    RETURN_IF_CATCH_EXCEPTION({
+        // sample evenly spaced strings, so that a page whose strings drift is still covered
+        size_t stride = std::max<size_t>(1, _values.size() / FSST_TRAINING_SAMPLE_SIZE);
+        std::vector<Slice> samples;
+        for (size_t i = 0; i < _offsets.size(); i += stride) {
+            samples.push_back(_value_at(i));
+        }
+        _symbol_table.train(samples);
+
+        _buffer.clear();
+        _buffer.reserve(_values.size() + _offsets.size() * sizeof(uint32_t) + 1024);
+        _symbol_table.serialize(&_buffer);
+        size_t strings_start = _buffer.size();
+        std::vector<uint32_t> compressed_offsets(_offsets.size());
+        for (size_t i = 0; i < _offsets.size(); ++i) {
+            compressed_offsets[i] = _buffer.size() - strings_start;
+            _symbol_table.compress(_value_at(i), &_buffer);
+        }
+        for (uint32_t offset : compressed_offsets) {
+            put_fixed32_le(&_buffer, offset);
+        }
+        put_fixed32_le(&_buffer, _offsets.size());
+        if (!_offsets.empty()) {
+            Slice first = _value_at(0);
+            Slice last = _value_at(_offsets.size() - 1);
+            _first_value.assign_copy(reinterpret_cast<const uint8_t*>(first.data), first.size);
+            _last_value.assign_copy(reinterpret_cast<const uint8_t*>(last.data), last.size);
+        }
+        *slice = _buffer.build();
+    });
+    return Status::OK();
+}
+
+Status BinaryFsstPageBuilder::reset() {
+    RETURN_IF_CATCH_EXCEPTION({
+        _offsets.clear();
+        _values.clear();
+        _values.reserve(_options.data_page_size == 0 ? 1024 : _options.data_page_size);
+        _buffer.clear();
+        _size_estimate = sizeof(uint32_t);
+        _finished = false;
+    });
+    return Status::OK();
+}
+
+Status BinaryFsstPageBuilder::get_first_value(void* value) const {
+    DCHECK(_finished);
+    if (_offsets.empty()) {
+        return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+    }
+    *reinterpret_cast<Slice*>(value) = Slice(_first_value);
+    return Status::OK();
+}
+
+Status BinaryFsstPageBuilder::get_last_value(void* value) const {
+    DCHECK(_finished);
+    if (_offsets.empty()) {
+        return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+    }
+    *reinterpret_cast<Slice*>(value) = Slice(_last_value);
+    return Status::OK();
+}
+
+Status BinaryFsstPageDecoder::init() {
+    CHECK(!_parsed);
+    const auto* data = reinterpret_cast<const uint8_t*>(_data.data);
+    size_t table_size = 0;
+    if (!_symbol_table.deserialize(data, _data.size, &table_size)) {
+        return Status::Corruption("file corruption: invalid symbol table in BinaryFsstPageDecoder");
+    }
+    if (_data.size < table_size + sizeof(uint32_t)) {
+        return Status::Corruption(
+                "file corruption: not enough bytes for trailer in BinaryFsstPageDecoder, "
+                "data size:{}, symbol table size:{}",
+                _data.size, table_size);
+    }
+    _num_elems = decode_fixed32_le(data + _data.size - sizeof(uint32_t));
+    size_t trailer_size = (static_cast<size_t>(_num_elems) + 1) * sizeof(uint32_t);
+    if (_data.size < table_size + trailer_size) {
+        return Status::Corruption(
+                "file corruption: offsets pos beyonds data_size: {}, num_element: {}, "
+                "symbol table size:{}",
+                _data.size, _num_elems, table_size);
+    }
+    _strings = data + table_size;
+    _strings_size = _data.size - table_size - trailer_size;
+    _offsets_ptr = data + _data.size - trailer_size;
+    _parsed = true;
+    return Status::OK();
+}
+
+Status BinaryFsstPageDecoder::seek_to_position_in_page(size_t pos) {
+    if (_num_elems == 0) [[unlikely]] {
+        if (pos != 0) {
+            return Status::Error<ErrorCode::INTERNAL_ERROR, false>(
+                    "seek pos {} is larger than total elements  {}", pos, _num_elems);
+        }
+    }
+    DCHECK_LE(pos, _num_elems);
+    _cur_idx = pos;
+    return Status::OK();
+}
+
+uint32_t BinaryFsstPageDecoder::_offset(size_t idx) const {
+    if (idx >= _num_elems) {
+        return _strings_size;
+    }
+    return std::min(decode_fixed32_le(_offsets_ptr + idx * sizeof(uint32_t)), _strings_size);
+}
+
+void BinaryFsstPageDecoder::_decompress_value(size_t idx) {
+    uint32_t start = _offset(idx);
+    uint32_t end = std::max(start, _offset(idx + 1));
+    _decoded_size += _symbol_table.decompress(_strings + start, end - start,
+                                              _decoded.data() + _decoded_size);
+    _decoded_offsets.push_back(_decoded_size);
+}
+
+Status BinaryFsstPageDecoder::next_batch(size_t* n, vectorized::MutableColumnPtr& dst) {
+    DCHECK(_parsed);
+    if (*n == 0 || _cur_idx >= _num_elems) [[unlikely]] {
+        *n = 0;
+        return Status::OK();
+    }
+    const size_t max_fetch = std::min(*n, static_cast<size_t>(_num_elems - _cur_idx));
+
+    // the strings are adjacent, so their total size is that of one compressed range
+    uint32_t start = _offset(_cur_idx);
+    uint32_t end = std::max(start, _offset(_cur_idx + max_fetch));
+    _decoded.resize(_symbol_table.decompressed_size(_strings + start, end - start) +
+                    FsstSymbolTable::DECOMPRESS_PADDING);
+    _decoded_size = 0;
+    _decoded_offsets.clear();
+    _decoded_offsets.push_back(0);
+    for (size_t i = 0; i < max_fetch; ++i) {
+        _decompress_value(_cur_idx + i);
+    }
+    dst->insert_many_continuous_binary_data(reinterpret_cast<const char*>(_decoded.data()),
+                                            _decoded_offsets.data(), max_fetch);
+
+    _cur_idx += max_fetch;
+    *n = max_fetch;
+    return Status::OK();
+}
+
+Status BinaryFsstPageDecoder::read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal,
+                                             size_t* n, vectorized::MutableColumnPtr& dst) {
+    DCHECK(_parsed);
+    if (*n == 0) [[unlikely]] {
+        *n = 0;
+        return Status::OK();
+    }
+
+    auto total = *n;
+    _ordinals.clear();
+    size_t decoded_size = 0;
+    for (size_t i = 0; i < total; ++i) {
+        ordinal_t ord = rowids[i] - page_first_ordinal;
+        if (UNLIKELY(ord >= _num_elems)) {
+            break;
+        }
+        uint32_t start = _offset(ord);
+        uint32_t end = std::max(start, _offset(ord + 1));
+        decoded_size += _symbol_table.decompressed_size(_strings + start, end - start);
+        _ordinals.push_back(ord);
+    }
+
+    size_t read_count = _ordinals.size();
+    if (LIKELY(read_count > 0)) {
+        _decoded.resize(decoded_size + FsstSymbolTable::DECOMPRESS_PADDING);
+        _decoded_size = 0;
+        _decoded_offsets.clear();
+        _decoded_offsets.push_back(0);
+        for (rowid_t ord : _ordinals) {
+            _decompress_value(ord);
+        }
+        dst->insert_many_continuous_binary_data(reinterpret_cast<const char*>(_decoded.data()),
+                                                _decoded_offsets.data(), read_count);
+    }
+    *n = read_count;
+    return Status::OK();
+}
+
+} // namespace segment_v2
+} // namespace doris
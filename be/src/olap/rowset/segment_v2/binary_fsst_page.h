@@ -0,0 +1,146 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Page encoding for strings compressed with a per page symbol table, see FsstSymbolTable.
+//
+// The page consists of:
+// SymbolTable:
+//   the serialized symbol table trained on the strings of the page
+// Strings:
+//   compressed strings
+// Trailer
+//  Offsets:
+//    offsets pointing to the beginning of each compressed string, relative to the first one
+//  num_elems (32-bit fixed)
+//
+// Every string is compressed on its own, so reading by rowids decompresses only the strings
+// asked for.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "common/status.h"
+#include "olap/rowset/segment_v2/common.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
+#include "util/faststring.h"
+#include "util/fsst_coding.h"
+#include "util/slice.h"
+#include "vec/columns/column.h"
+
+namespace doris {
+namespace segment_v2 {
+
+class BinaryFsstPageBuilder : public PageBuilderHelper<BinaryFsstPageBuilder> {
+public:
+    using Self = BinaryFsstPageBuilder;
+    friend class PageBuilderHelper<Self>;
+
+    Status init() override { return reset(); }
+
+    bool is_page_full() override {
+        return _options.data_page_size != 0 && _size_estimate > _options.data_page_size;
+    }
+
+    Status add(const uint8_t* vals, size_t* count) override;
+
+    Status finish(OwnedSlice* slice) override;
+
+    Status reset() override;
+
+    size_t count() const override { return _offsets.size(); }
+
+    uint64_t size() const override { return _size_estimate; }
+
+    Status get_first_value(void* value) const override;
+
+    Status get_last_value(void* value) const override;
+
+private:
+    BinaryFsstPageBuilder(const PageBuilderOptions& options) : _options(options) {}
+
+    Slice _value_at(size_t idx) const;
+
+    PageBuilderOptions _options;
+    bool _finished = false;
+    // the raw strings added, compressed when the page is finished
+    faststring _values;
+    std::vector<uint32_t> _offsets;
+    size_t _size_estimate = 0;
+    faststring _buffer;
+    FsstSymbolTable _symbol_table;
+    faststring _first_value;
+    faststring _last_value;
+};
+
+class BinaryFsstPageDecoder : public PageDecoder {
+public:
+    BinaryFsstPageDecoder(Slice data, const PageDecoderOptions& options)
+            : _data(data), _options(options) {}
+
+    Status init() override;
+
+    Status seek_to_position_in_page(size_t pos) override;
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override;
+
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override;
+
+    size_t count() const override {
+        DCHECK(_parsed);
+        return _num_elems;
+    }
+
+    size_t current_index() const override {
+        DCHECK(_parsed);
+        return _cur_idx;
+    }
+
+private:
+    // Return the offset of the compressed string with index 'idx' within the strings.
+    uint32_t _offset(size_t idx) const;
+
+    // Decompress the string with index 'idx' to the end of _decoded, whose capacity must fit it.
+    void _decompress_value(size_t idx);
+
+    Slice _data;
+    PageDecoderOptions _options;
+    bool _parsed = false;
+
+    FsstSymbolTable _symbol_table;
+    const uint8_t* _strings = nullptr;
+    uint32_t _strings_size = 0;
+    uint32_t _num_elems = 0;
+    const uint8_t* _offsets_ptr = nullptr;
+
+    // Index of the currently seeked element in the page.
+    uint32_t _cur_idx = 0;
+
+    std::vector<uint8_t> _decoded;
+    size_t _decoded_size = 0;
+    std::vector<uint32_t> _decoded_offsets;
+    std::vector<rowid_t> _ordinals;
+};
+
+} // namespace segment_v2
+} // namespace doris
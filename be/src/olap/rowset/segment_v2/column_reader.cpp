@@ -21,14 +21,17 @@
 #include <gen_cpp/segment_v2.pb.h>
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <ostream>
 #include <set>
 #include <utility>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "common/exception.h"
 #include "common/status.h"
+#include "io/fs/buffered_reader.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/file_system.h"
 #include "olap/block_column_predicate.h"
@@ -38,6 +41,7 @@
 #include "olap/inverted_index_parser.h"
 #include "olap/iterators.h"
 #include "olap/olap_common.h"
+#include "olap/page_cache.h"
 #include "olap/rowset/segment_v2/binary_dict_page.h" // for BinaryDictPageDecoder
 #include "olap/rowset/segment_v2/binary_plain_page.h"
 #include "olap/rowset/segment_v2/bitmap_index_reader.h"
@@ -707,6 +711,47 @@ Status ColumnReader::seek_at_or_before(ordinal_t ordinal, OrdinalPageIndexIterat
     return Status::OK();
 }
 
+Status ColumnReader::get_data_page_first_ordinals(const ColumnIteratorOptions& iter_opts,
+                                                  std::vector<ordinal_t>* ordinals) {
+    RETURN_IF_ERROR(_load_ordinal_index(_use_index_page_cache, _opts.kept_in_memory, iter_opts));
+    ordinals->clear();
+    ordinals->reserve(_ordinal_index->num_data_pages());
+    for (auto iter = _ordinal_index->begin(); iter.valid(); iter.next()) {
+        ordinals->push_back(iter.first_ordinal());
+    }
+    return Status::OK();
+}
+
+Status ColumnReader::get_data_page_ranges(const ColumnIteratorOptions& iter_opts,
+                                          RowRanges& row_ranges,
+                                          std::vector<io::PrefetchRange>* ranges) {
+    if (row_ranges.is_empty()) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_load_ordinal_index(_use_index_page_cache, _opts.kept_in_memory, iter_opts));
+    auto iter = _ordinal_index->begin();
+    for (size_t i = 0; i < row_ranges.range_size() && iter.valid(); ++i) {
+        auto from = static_cast<ordinal_t>(row_ranges.get_range_from(i));
+        auto to = static_cast<ordinal_t>(row_ranges.get_range_to(i));
+        while (iter.valid() && iter.last_ordinal() < from) {
+            iter.next();
+        }
+        // the last page of a range may also hold the start of the next range, it is
+        // appended once and left for the next range to continue from
+        while (iter.valid() && iter.first_ordinal() < to) {
+            const PagePointer& pp = iter.page();
+            if (ranges->empty() || ranges->back().start_offset != pp.offset) {
+                ranges->emplace_back(pp.offset, pp.offset + pp.size);
+            }
+            if (iter.last_ordinal() >= to - 1) {
+                break;
+            }
+            iter.next();
+        }
+    }
+    return Status::OK();
+}
+
 Status ColumnReader::new_iterator(ColumnIterator** iterator, const TabletColumn* tablet_column) {
     if (is_empty()) {
         *iterator = new EmptyFileColumnIterator();
@@ -1412,12 +1457,12 @@ Status FileColumnIterator::_read_data_page(const OrdinalPageIndexIterator& iter)
     if (_reader->encoding_info()->encoding() == DICT_ENCODING) {
         auto dict_page_decoder = reinterpret_cast<BinaryDictPageDecoder*>(_page.data_decoder.get());
         if (dict_page_decoder->is_dict_encoding()) {
-            if (_dict_decoder == nullptr) {
+            if (_dict == nullptr) {
                 RETURN_IF_ERROR(_read_dict_data());
-                CHECK_NOTNULL(_dict_decoder);
+                CHECK_NOTNULL(_dict);
             }
 
-            dict_page_decoder->set_dict_decoder(_dict_decoder.get(), _dict_word_info.get());
+            dict_page_decoder->set_dict_decoder(_dict->decoder.get(), _dict->word_info.get());
         }
     }
     return Status::OK();
@@ -1425,22 +1470,48 @@ Status FileColumnIterator::_read_data_page(const OrdinalPageIndexIterator& iter)
 
 Status FileColumnIterator::_read_dict_data() {
     CHECK_EQ(_reader->encoding_info()->encoding(), DICT_ENCODING);
+    // the dictionary may have been decoded by another iterator of the column
+    auto* page_cache = StoragePageCache::instance();
+    bool use_decoded_cache = _opts.use_page_cache && !config::disable_storage_page_cache &&
+                             page_cache != nullptr && page_cache->has_decoded_page_cache();
+    StoragePageCache::CacheKey cache_key(_opts.file_reader->path().native(),
+                                         _opts.file_reader->size(),
+                                         _reader->get_dict_page_pointer().offset);
+    if (use_decoded_cache) {
+        _dict = page_cache->lookup_decoded<DecodedDictPage>(cache_key);
+        if (_dict != nullptr) {
+            _opts.stats->decoded_dict_page_cache_hit++;
+            return Status::OK();
+        }
+    }
+
     // read dictionary page
     Slice dict_data;
     PageFooterPB dict_footer;
     _opts.type = INDEX_PAGE;
     RETURN_IF_ERROR(_reader->read_page(_opts, _reader->get_dict_page_pointer(), &_dict_page_handle,
                                        &dict_data, &dict_footer, _compress_codec));
+    auto dict = std::make_shared<DecodedDictPage>();
+    if (use_decoded_cache) {
+        // the cached words must not point into the page held by this iterator
+        dict->page_data.reset(new char[dict_data.size]);
+        memcpy(dict->page_data.get(), dict_data.data, dict_data.size);
+        dict_data = Slice(dict->page_data.get(), dict_data.size);
+        dict->page_size = dict_data.size;
+        _dict_page_handle = PageHandle();
+    }
     // ignore dict_footer.dict_page_footer().encoding() due to only
     // PLAIN_ENCODING is supported for dict page right now
-    _dict_decoder =
+    dict->decoder =
             std::make_unique<BinaryPlainPageDecoder<FieldType::OLAP_FIELD_TYPE_VARCHAR>>(dict_data);
-    RETURN_IF_ERROR(_dict_decoder->init());
+    RETURN_IF_ERROR(dict->decoder->init());
 
-    auto* pd_decoder =
-            (BinaryPlainPageDecoder<FieldType::OLAP_FIELD_TYPE_VARCHAR>*)_dict_decoder.get();
-    _dict_word_info.reset(new StringRef[pd_decoder->_num_elems]);
-    RETURN_IF_ERROR(pd_decoder->get_dict_word_info(_dict_word_info.get()));
+    dict->word_info.reset(new StringRef[dict->decoder->_num_elems]);
+    RETURN_IF_ERROR(dict->decoder->get_dict_word_info(dict->word_info.get()));
+    if (use_decoded_cache) {
+        page_cache->insert_decoded(cache_key, dict, dict->mem_size());
+    }
+    _dict = std::move(dict);
     return Status::OK();
 }
 
@@ -1463,18 +1534,23 @@ Status FileColumnIterator::get_row_ranges_by_bloom_filter(
     return Status::OK();
 }
 
+Status FileColumnIterator::get_data_page_ranges(RowRanges& row_ranges,
+                                                std::vector<io::PrefetchRange>* ranges) {
+    return _reader->get_data_page_ranges(_opts, row_ranges, ranges);
+}
+
 Status FileColumnIterator::get_row_ranges_by_dict(const AndBlockColumnPredicate* col_predicates,
                                                   RowRanges* row_ranges) {
     if (!_is_all_dict_encoding) {
         return Status::OK();
     }
 
-    if (!_dict_decoder) {
+    if (!_dict) {
         RETURN_IF_ERROR(_read_dict_data());
-        CHECK_NOTNULL(_dict_decoder);
+        CHECK_NOTNULL(_dict);
     }
 
-    if (!col_predicates->evaluate_and(_dict_word_info.get(), _dict_decoder->count())) {
+    if (!col_predicates->evaluate_and(_dict->word_info.get(), _dict->decoder->count())) {
         row_ranges->clear();
     }
     return Status::OK();
@@ -62,6 +62,7 @@ class StorageReadOptions;
 
 namespace io {
 class FileReader;
+struct PrefetchRange;
 } // namespace io
 struct Slice;
 struct StringRef;
@@ -70,6 +71,7 @@ namespace segment_v2 {
 
 class EncodingInfo;
 class ColumnIterator;
+struct DecodedDictPage;
 class BloomFilterIndexReader;
 class BitmapIndexIterator;
 class BitmapIndexReader;
@@ -151,6 +153,14 @@ public:
     Status seek_at_or_before(ordinal_t ordinal, OrdinalPageIndexIterator* iter,
                              const ColumnIteratorOptions& iter_opts);
 
+    // get the first ordinal of every data page, in ascending order
+    Status get_data_page_first_ordinals(const ColumnIteratorOptions& iter_opts,
+                                        std::vector<ordinal_t>* ordinals);
+
+    // append the file ranges of the data pages overlapping `row_ranges`, in file order
+    Status get_data_page_ranges(const ColumnIteratorOptions& iter_opts, RowRanges& row_ranges,
+                                std::vector<io::PrefetchRange>* ranges);
+
     // read a page from file into a page handle
     Status read_page(const ColumnIteratorOptions& iter_opts, const PagePointer& pp,
                      PageHandle* handle, Slice* page_body, PageFooterPB* footer,
@@ -345,6 +355,13 @@ public:
 
     virtual bool is_all_dict_encoding() const { return false; }
 
+    // append the file ranges of the data pages to be read for `row_ranges`, used to prefetch
+    // them from remote storage. Iterators without own pages append nothing.
+    virtual Status get_data_page_ranges(RowRanges& row_ranges,
+                                        std::vector<io::PrefetchRange>* ranges) {
+        return Status::OK();
+    }
+
 protected:
     ColumnIteratorOptions _opts;
 };
@@ -390,6 +407,9 @@ public:
 
     bool is_all_dict_encoding() const override { return _is_all_dict_encoding; }
 
+    Status get_data_page_ranges(RowRanges& row_ranges,
+                                std::vector<io::PrefetchRange>* ranges) override;
+
 private:
     Status _seek_to_pos_in_page(ParsedPage* page, ordinal_t offset_in_page) const;
     Status _load_next_page(bool* eos);
@@ -406,8 +426,8 @@ private:
     //    If new seek is issued, the _page will be reset.
     ParsedPage _page;
 
-    // keep dict page decoder
-    std::unique_ptr<PageDecoder> _dict_decoder;
+    // keep dict page decoder and the words of the dictionary
+    std::shared_ptr<DecodedDictPage> _dict;
 
     // keep dict page handle to avoid released
     PageHandle _dict_page_handle;
@@ -420,8 +440,6 @@ private:
     ordinal_t _current_ordinal = 0;
 
     bool _is_all_dict_encoding = false;
-
-    std::unique_ptr<StringRef[]> _dict_word_info;
 };
 
 class EmptyFileColumnIterator final : public ColumnIterator {
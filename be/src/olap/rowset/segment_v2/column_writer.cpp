@@ -21,6 +21,7 @@
 
 #include <algorithm>
 #include <filesystem>
+#include <limits>
 #include <memory>
 
 #include "common/config.h"
@@ -418,13 +419,18 @@ Status ScalarColumnWriter::init() {
 
     PageBuilder* page_builder = nullptr;
 
+    // only the fixed length types encoded by bitshuffle by default have other encodings to choose
+    bool default_encoding = _opts.meta->encoding() == DEFAULT_ENCODING;
     RETURN_IF_ERROR(
             EncodingInfo::get(get_field()->type_info(), _opts.meta->encoding(), &_encoding_info));
     _opts.meta->set_encoding(_encoding_info->encoding());
+    _adaptive_encoding = config::enable_adaptive_column_encoding && default_encoding &&
+                         _encoding_info->encoding() == BIT_SHUFFLE;
     // create page builder
     PageBuilderOptions opts;
     opts.data_page_size = _opts.data_page_size;
     opts.dict_page_size = _opts.dict_page_size;
+    opts.enable_for_min_delta = config::enable_frame_of_reference_min_delta;
     RETURN_IF_ERROR(_encoding_info->create_page_builder(opts, &page_builder));
     if (page_builder == nullptr) {
         return Status::NotSupported("Failed to create page builder for type {} and encoding {}",
@@ -538,6 +544,10 @@ Status ScalarColumnWriter::append_data(const uint8_t** ptr, size_t num_rows) {
 Status ScalarColumnWriter::_internal_append_data_in_current_page(const uint8_t* data,
                                                                  size_t* num_written) {
     RETURN_IF_ERROR(_page_builder->add(data, num_written));
+    if (_adaptive_encoding) {
+        _first_page_values.insert(_first_page_values.end(), data,
+                                  data + get_field()->size() * (*num_written));
+    }
     if (_opts.need_zone_map) {
         _zone_map_index_builder->add_values(data, *num_written);
     }
@@ -662,10 +672,100 @@ Status ScalarColumnWriter::_write_data_page(Page* page) {
     return Status::OK();
 }
 
+// Encode the values of the first page with every encoding of the type, and write the column with
+// the one storing them in the fewest bytes after compression. Frame of reference decodes slower
+// than bitshuffle, so it has to save at least `adaptive_column_encoding_min_space_saving` to be
+// chosen, while plain encoding decodes faster and is taken as soon as it is not larger.
+Status ScalarColumnWriter::_choose_encoding_by_first_page() {
+    _adaptive_encoding = false;
+    std::vector<uint8_t> values;
+    values.swap(_first_page_values);
+    size_t num_values = values.size() / get_field()->size();
+    if (num_values == 0) {
+        return Status::OK();
+    }
+
+    uint64_t default_size = 0;
+    RETURN_IF_ERROR(_encoded_page_size(_encoding_info, values, num_values, &default_size));
+    const EncodingInfo* best_encoding_info = _encoding_info;
+    uint64_t best_size = default_size;
+    for (auto encoding : {FOR_ENCODING, PLAIN_ENCODING}) {
+        const EncodingInfo* encoding_info = nullptr;
+        if (!EncodingInfo::get(get_field()->type_info(), encoding, &encoding_info).ok()) {
+            continue;
+        }
+        uint64_t size = 0;
+        RETURN_IF_ERROR(_encoded_page_size(encoding_info, values, num_values, &size));
+        double max_size_ratio =
+                encoding == PLAIN_ENCODING
+                        ? 1.0
+                        : 1.0 - config::adaptive_column_encoding_min_space_saving;
+        if (size < best_size && static_cast<double>(size) <= default_size * max_size_ratio) {
+            best_encoding_info = encoding_info;
+            best_size = size;
+        }
+    }
+    if (best_encoding_info == _encoding_info) {
+        return Status::OK();
+    }
+
+    PageBuilderOptions opts;
+    opts.data_page_size = _opts.data_page_size;
+    opts.dict_page_size = _opts.dict_page_size;
+    opts.enable_for_min_delta = config::enable_frame_of_reference_min_delta;
+    PageBuilder* page_builder = nullptr;
+    RETURN_IF_ERROR(best_encoding_info->create_page_builder(opts, &page_builder));
+    std::unique_ptr<PageBuilder> builder(page_builder);
+    size_t num_added = num_values;
+    RETURN_IF_ERROR(builder->add(values.data(), &num_added));
+    DCHECK_EQ(num_added, num_values);
+    VLOG_DEBUG << "column " << get_field()->name() << " changes encoding from "
+               << _encoding_info->encoding() << " to " << best_encoding_info->encoding()
+               << ", first page size " << default_size << " -> " << best_size;
+    _page_builder = std::move(builder);
+    _encoding_info = best_encoding_info;
+    _opts.meta->set_encoding(_encoding_info->encoding());
+    return Status::OK();
+}
+
+// `size` is set to the max value if the encoding cannot hold all values in one page
+Status ScalarColumnWriter::_encoded_page_size(const EncodingInfo* encoding_info,
+                                              const std::vector<uint8_t>& values,
+                                              size_t num_values, uint64_t* size) {
+    PageBuilderOptions opts;
+    opts.data_page_size = _opts.data_page_size;
+    opts.dict_page_size = _opts.dict_page_size;
+    opts.enable_for_min_delta = config::enable_frame_of_reference_min_delta;
+    PageBuilder* page_builder = nullptr;
+    RETURN_IF_ERROR(encoding_info->create_page_builder(opts, &page_builder));
+    if (page_builder == nullptr) {
+        *size = std::numeric_limits<uint64_t>::max();
+        return Status::OK();
+    }
+    std::unique_ptr<PageBuilder> builder(page_builder);
+    size_t num_added = num_values;
+    RETURN_IF_ERROR(builder->add(values.data(), &num_added));
+    if (num_added != num_values) {
+        *size = std::numeric_limits<uint64_t>::max();
+        return Status::OK();
+    }
+    OwnedSlice encoded_values;
+    RETURN_IF_ERROR(builder->finish(&encoded_values));
+    OwnedSlice compressed_values;
+    RETURN_IF_ERROR(PageIO::compress_page_body(_compress_codec, _opts.compression_min_space_saving,
+                                               {encoded_values.slice()}, &compressed_values));
+    *size = compressed_values.slice().empty() ? encoded_values.slice().size
+                                              : compressed_values.slice().size;
+    return Status::OK();
+}
+
 Status ScalarColumnWriter::finish_current_page() {
     if (_next_rowid == _first_rowid) {
         return Status::OK();
     }
+    if (_adaptive_encoding) {
+        RETURN_IF_ERROR(_choose_encoding_by_first_page());
+    }
     if (_opts.need_zone_map) {
         if (_next_rowid - _first_rowid < config::zone_map_row_num_threshold) {
             _zone_map_index_builder->reset_page_zone_map();
@@ -229,6 +229,11 @@ public:
 
 private:
     Status _internal_append_data_in_current_page(const uint8_t* ptr, size_t* num_written);
+    // choose the encoding of the column by encoding `_first_page_values` with every candidate
+    Status _choose_encoding_by_first_page();
+    Status _encoded_page_size(const EncodingInfo* encoding_info,
+                              const std::vector<uint8_t>& values, size_t num_values,
+                              uint64_t* size);
 
 private:
     std::unique_ptr<PageBuilder> _page_builder;
@@ -238,6 +243,10 @@ private:
     ColumnWriterOptions _opts;
 
     const EncodingInfo* _encoding_info = nullptr;
+    // the raw values of the first page, kept until the page is finished when the column is left
+    // to the default encoding and `enable_adaptive_column_encoding` is on
+    bool _adaptive_encoding = false;
+    std::vector<uint8_t> _first_page_values;
 
     ordinal_t _next_rowid = 0;
 
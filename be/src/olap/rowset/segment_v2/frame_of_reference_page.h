@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
 #include "olap/rowset/segment_v2/options.h"      // for PageBuilderOptions/PageDecoderOptions
 #include "olap/rowset/segment_v2/page_builder.h" // for PageBuilder
 #include "olap/rowset/segment_v2/page_decoder.h" // for PageDecoder
@@ -33,7 +36,7 @@ public:
     friend class PageBuilderHelper<Self>;
 
     Status init() override {
-        _encoder.reset(new ForEncoder<CppType>(&_buf));
+        _encoder.reset(new ForEncoder<CppType>(&_buf, _options.enable_for_min_delta));
         return Status::OK();
     }
 
@@ -138,7 +141,8 @@ public:
             }
         }
 
-        int32_t skip_num = pos - _cur_index;
+        int32_t skip_num =
+                static_cast<int32_t>(pos) - static_cast<int32_t>(_decoder->current_index());
         _decoder->skip(skip_num);
         _cur_index = pos;
         return Status::OK();
@@ -155,7 +159,53 @@ public:
     }
 
     Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
-        return Status::NotSupported("frame page not implement vec op now");
+        DCHECK(_parsed);
+        if (*n == 0 || _cur_index >= _num_elements) [[unlikely]] {
+            *n = 0;
+            return Status::OK();
+        }
+        size_t max_fetch = std::min(*n, static_cast<size_t>(_num_elements - _cur_index));
+        _buffer.resize(max_fetch);
+        if (!_decoder->get_batch(_buffer.data(), max_fetch)) {
+            return Status::Corruption("failed to read {} values from frame of reference page",
+                                      max_fetch);
+        }
+        dst->insert_many_fix_len_data((char*)_buffer.data(), max_fetch);
+        _cur_index += max_fetch;
+        *n = max_fetch;
+        return Status::OK();
+    }
+
+    // the rowids are ascending, so the values between the first and the last one are decoded
+    // with one batch and picked from it
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed);
+        size_t read_count = 0;
+        while (read_count < *n && rowids[read_count] - page_first_ordinal < _num_elements) {
+            ++read_count;
+        }
+        if (read_count == 0) [[unlikely]] {
+            *n = 0;
+            return Status::OK();
+        }
+
+        size_t first = rowids[0] - page_first_ordinal;
+        size_t num_values = rowids[read_count - 1] - page_first_ordinal - first + 1;
+        RETURN_IF_ERROR(seek_to_position_in_page(first));
+        _buffer.resize(num_values);
+        if (!_decoder->get_batch(_buffer.data(), num_values)) {
+            return Status::Corruption("failed to read {} values from frame of reference page",
+                                      num_values);
+        }
+        _cur_index = first + num_values;
+        _values.resize(read_count);
+        for (size_t i = 0; i < read_count; ++i) {
+            _values[i] = _buffer[rowids[i] - page_first_ordinal - first];
+        }
+        dst->insert_many_fix_len_data((char*)_values.data(), read_count);
+        *n = read_count;
+        return Status::OK();
     }
 
     Status peek_next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
@@ -174,6 +224,8 @@ private:
     uint32_t _num_elements;
     size_t _cur_index;
     std::unique_ptr<ForDecoder<CppType>> _decoder;
+    std::vector<CppType> _buffer;
+    std::vector<CppType> _values;
 };
 
 } // namespace segment_v2
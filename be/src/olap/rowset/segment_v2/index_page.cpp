@@ -20,8 +20,10 @@
 #include <gen_cpp/segment_v2.pb.h>
 
 #include <algorithm>
+#include <cstring>
 #include <ostream>
 
+#include "gutil/endian.h"
 #include "util/coding.h"
 
 namespace doris {
@@ -65,7 +67,8 @@ Status IndexPageBuilder::get_first_key(Slice* key) const {
 ///////////////////////////////////////////////////////////////////////////////
 
 int64_t IndexPageReader::get_metadata_size() const {
-    return sizeof(IndexPageReader) + _footer.ByteSizeLong();
+    return sizeof(IndexPageReader) + _footer.ByteSizeLong() +
+           _key_prefixes.capacity() * sizeof(uint64_t);
 }
 
 Status IndexPageReader::parse(const Slice& body, const IndexPageFooterPB& footer) {
@@ -90,11 +93,52 @@ Status IndexPageReader::parse(const Slice& body, const IndexPageFooterPB& footer
     _parsed = true;
     return Status::OK();
 }
+
+uint64_t IndexPageReader::key_prefix(const Slice& key, size_t offset) {
+    uint8_t bytes[sizeof(uint64_t)] = {0};
+    if (offset < key.size) {
+        memcpy(bytes, key.data + offset, std::min(key.size - offset, sizeof(bytes)));
+    }
+    return BigEndian::Load64(bytes);
+}
+
+void IndexPageReader::build_key_prefixes() {
+    DCHECK(_parsed);
+    _key_prefixes.clear();
+    if (_keys.size() < 2) {
+        return;
+    }
+    // the keys are sorted, the prefix shared by the first and the last one is shared by all
+    const Slice& first = _keys.front();
+    const Slice& last = _keys.back();
+    size_t offset = 0;
+    size_t max_offset = std::min(first.size, last.size);
+    while (offset < max_offset && first.data[offset] == last.data[offset]) {
+        ++offset;
+    }
+    _key_prefix_offset = offset;
+    _key_prefixes.reserve(_keys.size());
+    for (const auto& key : _keys) {
+        _key_prefixes.push_back(key_prefix(key, offset));
+    }
+    update_metadata_size();
+}
 ///////////////////////////////////////////////////////////////////////////////
 
 Status IndexPageIterator::seek_at_or_before(const Slice& search_key) {
     int32_t left = 0;
     int32_t right = _reader->count() - 1;
+    size_t offset = _reader->key_prefix_offset();
+    if (_reader->has_key_prefixes() && search_key.size >= offset &&
+        memcmp(search_key.data, _reader->get_key(0).data, offset) == 0) {
+        // only the entries whose prefix equals to that of search key need whole key compares,
+        // the match or insertion point is among them or right after those with smaller prefix
+        const auto& prefixes = _reader->key_prefixes();
+        uint64_t prefix = IndexPageReader::key_prefix(search_key, offset);
+        auto range = std::equal_range(prefixes.begin(), prefixes.end(), prefix);
+        left = range.first - prefixes.begin();
+        right = range.second - prefixes.begin() - 1;
+    }
     while (left <= right) {
         int32_t mid = left + (right - left) / 2;
         int cmp = search_key.compare(_reader->get_key(mid));
@@ -110,6 +110,20 @@ public:
 
     void reset();
 
+    // Build the fence prefixes of the keys of this page, see _key_prefixes.
+    // Must be called after parse().
+    void build_key_prefixes();
+
+    bool has_key_prefixes() const { return !_key_prefixes.empty(); }
+
+    size_t key_prefix_offset() const { return _key_prefix_offset; }
+
+    const std::vector<uint64_t>& key_prefixes() const { return _key_prefixes; }
+
+    // Return the 8 bytes of 'key' following 'offset' as a big endian integer, padded with
+    // zeros, so that comparing the integers agrees with comparing the keys.
+    static uint64_t key_prefix(const Slice& key, size_t offset);
+
 private:
     int64_t get_metadata_size() const override;
 
@@ -118,6 +132,12 @@ private:
     IndexPageFooterPB _footer;
     std::vector<Slice> _keys;
     std::vector<PagePointer> _values;
+
+    // All keys share their first _key_prefix_offset bytes, and _key_prefixes[i] is
+    // key_prefix(_keys[i], _key_prefix_offset). The keys are sorted, so the prefixes are
+    // too, and a search only compares whole keys among the entries of an equal prefix.
+    size_t _key_prefix_offset = 0;
+    std::vector<uint64_t> _key_prefixes;
 };
 
 class IndexPageIterator {
@@ -21,6 +21,7 @@
 
 #include <algorithm>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "io/io_common.h"
 #include "olap/key_coder.h"
@@ -92,6 +93,10 @@ Status IndexedColumnReader::load(bool use_page_cache, bool kept_in_memory,
                                             &_value_index_page_handle, _value_index_reader.get(),
                                             index_load_stats));
             _has_index_page = true;
+            if (_is_pk_index && config::enable_pk_index_fence_prefixes) {
+                _value_index_reader->build_key_prefixes();
+                _mem_size += _value_index_reader->key_prefixes().size() * sizeof(uint64_t);
+            }
         }
     }
     _num_values = _meta.num_values();
@@ -19,6 +19,9 @@
 
 #include <unicode/unistr.h>
 
+#include "util/simd/lower_upper_impl.h"
+#include "util/sse_util.hpp"
+
 namespace doris::segment_v2 {
 
 #define IS_IN_RANGE(c, start, end) ((uint32_t)((c) - (start)) <= ((end) - (start)))
@@ -64,6 +67,56 @@ void BasicTokenizer::reset(lucene::util::Reader* reader) {
     _data_len = _tokens_text.size();
 }
 
+#if defined(__SSE2__) || defined(__aarch64__)
+// Set the bytes in 'chars' which are ascii letters or digits to 0xFF, others to 0. Bytes >= 0x80
+// are negative, so they match neither range.
+static inline __m128i ascii_alnum_mask(__m128i chars) {
+    const auto is_digit = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)),
+                                        _mm_cmplt_epi8(chars, _mm_set1_epi8('9' + 1)));
+    const auto lower_chars = _mm_or_si128(chars, _mm_set1_epi8('A' ^ 'a'));
+    const auto is_letter = _mm_and_si128(_mm_cmpgt_epi8(lower_chars, _mm_set1_epi8('a' - 1)),
+                                         _mm_cmplt_epi8(lower_chars, _mm_set1_epi8('z' + 1)));
+    return _mm_or_si128(is_digit, is_letter);
+}
+#endif
+
+// Return the position of the first byte from 'i' on which is not an ascii letter or digit.
+static int32_t find_alnum_end(const uint8_t* s, int32_t i, int32_t length) {
+#if defined(__SSE2__) || defined(__aarch64__)
+    for (; i + 16 <= length; i += 16) {
+        const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(ascii_alnum_mask(chars)));
+        if (mask != 0xFFFF) {
+            return i + __builtin_ctz(~mask);
+        }
+    }
+#endif
+    while (i < length && is_alnum(s[i])) {
+        i++;
+    }
+    return i;
+}
+
+// Return the position of the first byte from 'i' on which is an ascii letter or digit, or is not
+// ascii. The bytes skipped can not start a token.
+static int32_t skip_ascii_separators(const uint8_t* s, int32_t i, int32_t length) {
+#if defined(__SSE2__) || defined(__aarch64__)
+    for (; i + 16 <= length; i += 16) {
+        const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        // the sign bit is set for the bytes which are not ascii
+        auto mask = static_cast<uint32_t>(
+                _mm_movemask_epi8(_mm_or_si128(ascii_alnum_mask(chars), chars)));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+#endif
+    while (i < length && s[i] < 0x80 && !is_alnum(s[i])) {
+        i++;
+    }
+    return i;
+}
+
 void BasicTokenizer::cut() {
     auto* s = (uint8_t*)_buffer.data();
     int32_t length = _buffer.size();
@@ -72,21 +125,16 @@ void BasicTokenizer::cut() {
         uint8_t firstByte = s[i];
 
         if (is_alnum(firstByte)) {
+            // ascii words are found and lower cased 16 bytes at a time
             int32_t start = i;
-            while (i < length) {
-                uint8_t nextByte = s[i];
-                if (!is_alnum(nextByte)) {
-                    break;
-                }
-                if (this->lowercase) {
-                    s[i] = to_lower(nextByte);
-                } else {
-                    s[i] = nextByte;
-                }
-                i++;
+            i = find_alnum_end(s, i, length);
+            if (this->lowercase) {
+                simd::LowerUpperImpl<'A', 'Z'>::transfer(s + start, s + i, s + start);
             }
             std::string_view token((const char*)(s + start), i - start);
             _tokens_text.emplace_back(token);
+        } else if (firstByte < 0x80) {
+            i = skip_ascii_separators(s, i, length);
         } else {
             UChar32 c = U_UNASSIGNED;
             const int32_t prev_i = i;
@@ -59,6 +59,10 @@ int32_t DisjunctionOp::doc_id() const {
 int32_t DisjunctionOp::next_doc() const {
     auto* top = _pq.top();
     int32_t doc = top->_doc;
+    if (doc == INT_MAX) {
+        // all children are exhausted
+        return doc;
+    }
     do {
         _pq.pop();
         top->_doc = visit_node(*top->_iter, NextDoc {});
@@ -70,12 +74,14 @@ int32_t DisjunctionOp::next_doc() const {
 
 int32_t DisjunctionOp::advance(int32_t target) const {
     auto* top = _pq.top();
-    do {
+    // only move the children behind target, advancing a child already at or after target
+    // would skip its current doc
+    while (top->_doc < target) {
         _pq.pop();
         top->_doc = visit_node(*top->_iter, Advance {}, target);
         _pq.push(top);
         top = _pq.top();
-    } while (top->_doc < target);
+    }
     return top->_doc;
 }
 
@@ -33,9 +33,9 @@ public:
     int32_t doc_id() const { return _doc; }
 
     int32_t next_doc() const {
-        if (_iter == _end) {
+        if (_doc == -1) {
             _iter = _roaring->begin();
-        } else {
+        } else if (_iter != _end) {
             ++_iter;
         }
         _doc = (_iter != _end) ? *_iter : INT_MAX;
@@ -43,9 +43,14 @@ public:
     }
 
     int32_t advance(int32_t target) const {
-        while (_iter != _end && *_iter < target) {
-            ++_iter;
+        if (_doc >= target) {
+            return _doc;
+        }
+        // seek inside the bitmap instead of stepping through every doc before target
+        if (_doc == -1) {
+            _iter = _roaring->begin();
         }
+        _iter.equalorlarger(target);
         _doc = (_iter != _end) ? *_iter : INT_MAX;
         return _doc;
     }
@@ -79,6 +79,8 @@ enum class InvertedIndexQueryType {
     MATCH_PHRASE_PREFIX_QUERY = 8,
     MATCH_REGEXP_QUERY = 9,
     MATCH_PHRASE_EDGE_QUERY = 10,
+    // the result of a whole compound predicate, only used as a query cache key
+    COMPOUND_QUERY = 11,
 };
 
 inline bool is_range_query(InvertedIndexQueryType query_type) {
@@ -135,6 +137,9 @@ inline std::string query_type_to_string(InvertedIndexQueryType query_type) {
     case InvertedIndexQueryType::MATCH_PHRASE_EDGE_QUERY: {
         return "MPHRASEEDGE";
     }
+    case InvertedIndexQueryType::COMPOUND_QUERY: {
+        return "COMPOUND";
+    }
     default:
         return "";
     }
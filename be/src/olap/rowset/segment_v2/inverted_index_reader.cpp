@@ -103,6 +103,10 @@ std::string InvertedIndexReader::get_index_file_path() {
     return _index_file_reader->get_index_file_path(&_index_meta);
 }
 
+std::string InvertedIndexReader::get_index_file_cache_key() {
+    return _index_file_reader->get_index_file_cache_key(&_index_meta);
+}
+
 Status InvertedIndexReader::read_null_bitmap(const io::IOContext* io_ctx,
                                              OlapReaderStatistics* stats,
                                              InvertedIndexQueryCacheHandle* cache_handle,
@@ -215,6 +215,7 @@ public:
                                          InvertedIndexCacheHandle* inverted_index_cache_handle,
                                          const io::IOContext* io_ctx, OlapReaderStatistics* stats);
     std::string get_index_file_path();
+    std::string get_index_file_cache_key();
     static Status create_index_searcher(IndexSearcherBuilder* index_searcher_builder,
                                         lucene::store::Directory* dir, IndexSearcherPtr* searcher,
                                         size_t& reader_size);
@@ -21,6 +21,7 @@
 #include <glog/logging.h>
 
 #include "absl/strings/substitute.h"
+#include "common/cast_set.h"
 #include "gutil/hash/city.h"
 
 namespace doris::segment_v2 {
@@ -46,6 +47,8 @@ Status NGramBloomFilter::init(const char* buf, size_t size, HashStrategyPB strat
     for (size_t i = 0; i < words; ++i) {
         filter[i] = from[i];
     }
+    _non_zero_words.clear();
+    _non_zero_words_valid = false;
 
     return Status::OK();
 }
@@ -56,12 +59,24 @@ void NGramBloomFilter::add_bytes(const char* data, size_t len) {
 
     for (size_t i = 0; i < HASH_FUNCTIONS; ++i) {
         size_t pos = (hash1 + i * hash2 + i * i) % (8 * _size);
-        filter[pos / (8 * sizeof(UnderType))] |= (1ULL << (pos % (8 * sizeof(UnderType))));
+        size_t word = pos / (8 * sizeof(UnderType));
+        if (filter[word] == 0) {
+            _non_zero_words.push_back(cast_set<uint32_t>(word));
+        }
+        filter[word] |= (1ULL << (pos % (8 * sizeof(UnderType))));
     }
 }
 
 bool NGramBloomFilter::contains(const BloomFilter& bf_) const {
     const auto& bf = static_cast<const NGramBloomFilter&>(bf_);
+    if (bf._non_zero_words_valid && bf.words == words) {
+        for (auto i : bf._non_zero_words) {
+            if ((filter[i] & bf.filter[i]) != bf.filter[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
     for (size_t i = 0; i < words; ++i) {
         if ((filter[i] & bf.filter[i]) != bf.filter[i]) {
             return false;
@@ -62,6 +62,11 @@ private:
 #endif
     size_t words = 0;
     std::vector<uint64_t> filter;
+    // The indexes of the non-zero words of `filter`, so a filter of the few ngrams of a LIKE
+    // pattern is tested against a page filter by only these words instead of the whole filter.
+    // Only valid when the filter is built by add_bytes, a filter read by init leaves it invalid.
+    std::vector<uint32_t> _non_zero_words;
+    bool _non_zero_words_valid = true;
 };
 
 } // namespace segment_v2
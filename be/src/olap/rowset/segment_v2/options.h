@@ -35,6 +35,9 @@ struct PageBuilderOptions {
     bool need_check_bitmap = true;
 
     bool is_dict_page = false; // page used for saving dictionary
+
+    // frame-of-reference pages may use the min-delta frame format, see ForEncoder
+    bool enable_for_min_delta = false;
 };
 
 struct PageDecoderOptions {
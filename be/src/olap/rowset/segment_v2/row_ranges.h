@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <roaring/roaring.hh>
 #include <string>
 #include <vector>
@@ -120,6 +122,31 @@ public:
         return ranges;
     }
 
+    // Creates a new RowRanges object that keeps each granule of `granule_rows` rows of
+    // [0, row_count) with the probability `rate`. The kept granules only depend on `seed`, so
+    // reading with the same seed samples the same rows again.
+    static RowRanges create_sampled(uint64_t row_count, uint64_t granule_rows, double rate,
+                                    uint64_t seed) {
+        DCHECK(granule_rows > 0);
+        if (rate >= 1) {
+            return create_single(row_count);
+        }
+        RowRanges ranges;
+        // compares the top 53 bits of the granule hash, which double represents exactly
+        const double threshold = rate * static_cast<double>(1ULL << 53);
+        for (uint64_t from = 0; from < row_count; from += granule_rows) {
+            // the finalizer of splitmix64
+            uint64_t h = seed + (from / granule_rows + 1) * 0x9e3779b97f4a7c15ULL;
+            h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+            h ^= h >> 31;
+            if (static_cast<double>(h >> 11) < threshold) {
+                ranges.add(RowRange(from, std::min(from + granule_rows, row_count)));
+            }
+        }
+        return ranges;
+    }
+
     // Calculates the union of the two specified RowRanges object. The union of two range is calculated if there are
     // elements between them. Otherwise, the two disjunct ranges are stored separately.
     // For example:
@@ -21,6 +21,7 @@
 #include <gen_cpp/olap_file.pb.h>
 #include <gen_cpp/segment_v2.pb.h>
 
+#include <algorithm>
 #include <cstring>
 #include <memory>
 #include <utility>
@@ -156,7 +157,7 @@ Segment::Segment(uint32_t segment_id, RowsetId rowset_id, TabletSchemaSPtr table
           _idx_file_info(idx_file_info) {}
 
 Segment::~Segment() {
-    g_segment_estimate_mem_bytes << -_tracked_meta_mem_usage;
+    g_segment_estimate_mem_bytes << -_tracked_meta_mem_usage - _lazy_column_readers_mem_usage;
     // if failed, fix `_tracked_meta_mem_usage` accuracy
     DCHECK(_tracked_meta_mem_usage == meta_mem_usage());
 }
@@ -197,7 +198,10 @@ Status Segment::_open(OlapReaderStatistics* stats) {
     }
 
     _meta_mem_usage += sizeof(*this);
-    _meta_mem_usage += _tablet_schema->num_columns() * config::estimated_mem_per_column_reader;
+    _lazy_column_readers = config::enable_segment_lazy_column_reader;
+    if (!_lazy_column_readers) {
+        _meta_mem_usage += _tablet_schema->num_columns() * config::estimated_mem_per_column_reader;
+    }
 
     // 1024 comes from SegmentWriterOptions
     _meta_mem_usage += (_num_rows + 1023) / 1024 * (36 + 4);
@@ -241,9 +245,8 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
             const auto* node = _sub_column_tree[unique_id].find_exact(relative_path);
             reader = node != nullptr ? node->data.reader.get() : nullptr;
         } else {
-            reader = _column_readers.contains(col.unique_id())
-                             ? _column_readers[col.unique_id()].get()
-                             : nullptr;
+            RETURN_IF_ERROR(
+                    _get_column_reader_by_uid(col.unique_id(), read_options.stats, &reader));
         }
         if (!reader || !reader->has_zone_map()) {
             continue;
@@ -271,10 +274,12 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
             AndBlockColumnPredicate and_predicate;
             and_predicate.add_column_predicate(
                     SingleColumnBlockPredicate::create_unique(runtime_predicate.get()));
-            if (_column_readers.contains(uid) &&
+            ColumnReader* reader = nullptr;
+            RETURN_IF_ERROR(_get_column_reader_by_uid(uid, read_options.stats, &reader));
+            if (reader != nullptr &&
                 can_apply_predicate_safely(runtime_predicate->column_id(), runtime_predicate.get(),
                                            *schema, read_options.io_ctx.reader_type) &&
-                !_column_readers.at(uid)->match_condition(&and_predicate)) {
+                !reader->match_condition(&and_predicate)) {
                 // any condition not satisfied, return.
                 *iter = std::make_unique<EmptySegmentIterator>(*schema);
                 read_options.stats->filtered_segment_number++;
@@ -301,10 +306,28 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
         !read_options.column_predicates.empty()) {
         auto pruned_predicates = read_options.column_predicates;
         auto pruned = false;
-        for (auto& it : _column_readers) {
-            const auto uid = it.first;
+        std::vector<std::pair<int32_t, ColumnReader*>> readers;
+        if (_lazy_column_readers) {
+            // only the readers of predicate columns can prune anything, don't create the others
+            for (auto* pred : read_options.column_predicates) {
+                const auto uid = read_options.tablet_schema->column(pred->column_id()).unique_id();
+                ColumnReader* reader = nullptr;
+                RETURN_IF_ERROR(_get_column_reader_by_uid(uid, read_options.stats, &reader));
+                if (reader != nullptr &&
+                    std::find_if(readers.begin(), readers.end(), [uid](const auto& it) {
+                        return it.first == uid;
+                    }) == readers.end()) {
+                    readers.emplace_back(uid, reader);
+                }
+            }
+        } else {
+            for (auto& it : _column_readers) {
+                readers.emplace_back(it.first, it.second.get());
+            }
+        }
+        for (auto [uid, reader] : readers) {
             const auto column_id = read_options.tablet_schema->field_index(uid);
-            if (it.second->prune_predicates_by_zone_map(pruned_predicates, column_id)) {
+            if (reader->prune_predicates_by_zone_map(pruned_predicates, column_id)) {
                 pruned = true;
             }
         }
@@ -638,6 +661,11 @@ Status Segment::_create_column_readers(const SegmentFooterPB& footer) {
         if (iter == column_id_to_footer_ordinal.end()) {
             continue;
         }
+        if (_lazy_column_readers) {
+            // created by _get_column_reader_by_uid() when the column is read
+            _column_uid_to_footer_ordinal.emplace(column.unique_id(), iter->second);
+            continue;
+        }
 
         ColumnReaderOptions opts {
                 .kept_in_memory = _tablet_schema->is_in_memory(),
@@ -888,24 +916,24 @@ Status Segment::new_column_iterator(const TabletColumn& tablet_column,
     if (tablet_column.has_path_info() || tablet_column.is_variant_type()) {
         return new_column_iterator_with_path(tablet_column, iter, opt);
     }
+    ColumnReader* reader = nullptr;
+    RETURN_IF_ERROR(_get_column_reader_by_uid(tablet_column.unique_id(), opt->stats, &reader));
     // init default iterator
-    if (!_column_readers.contains(tablet_column.unique_id())) {
+    if (reader == nullptr) {
         RETURN_IF_ERROR(new_default_iterator(tablet_column, iter));
         return Status::OK();
     }
     // init iterator by unique id
     ColumnIterator* it;
-    RETURN_IF_ERROR(
-            _column_readers.at(tablet_column.unique_id())->new_iterator(&it, &tablet_column));
+    RETURN_IF_ERROR(reader->new_iterator(&it, &tablet_column));
     iter->reset(it);
 
     if (config::enable_column_type_check && !tablet_column.is_agg_state_type() &&
-        tablet_column.type() != _column_readers.at(tablet_column.unique_id())->get_meta_type()) {
+        tablet_column.type() != reader->get_meta_type()) {
         LOG(WARNING) << "different type between schema and column reader,"
                      << " column schema name: " << tablet_column.name()
                      << " column schema type: " << int(tablet_column.type())
-                     << " column reader meta type: "
-                     << int(_column_readers.at(tablet_column.unique_id())->get_meta_type());
+                     << " column reader meta type: " << int(reader->get_meta_type());
         return Status::InternalError("different type between schema and column reader");
     }
     return Status::OK();
@@ -914,14 +942,21 @@ Status Segment::new_column_iterator(const TabletColumn& tablet_column,
 Status Segment::new_column_iterator(int32_t unique_id, const StorageReadOptions* opt,
                                     std::unique_ptr<ColumnIterator>* iter) {
     RETURN_IF_ERROR(_create_column_readers_once(opt->stats));
+    ColumnReader* reader = nullptr;
+    RETURN_IF_ERROR(_get_column_reader_by_uid(unique_id, opt->stats, &reader));
+    if (reader == nullptr) {
+        return Status::InternalError("column reader not found, segment={}, column_uid={}",
+                                     _segment_id, unique_id);
+    }
     ColumnIterator* it;
     TabletColumn tablet_column = _tablet_schema->column_by_uid(unique_id);
-    RETURN_IF_ERROR(_column_readers.at(unique_id)->new_iterator(&it, &tablet_column));
+    RETURN_IF_ERROR(reader->new_iterator(&it, &tablet_column));
     iter->reset(it);
     return Status::OK();
 }
 
-ColumnReader* Segment::_get_column_reader(const TabletColumn& col) {
+Status Segment::_get_column_reader(const TabletColumn& col, OlapReaderStatistics* stats,
+                                   ColumnReader** reader) {
     // init column iterator by path info
     if (col.has_path_info() || col.is_variant_type()) {
         auto relative_path = col.path_info_ptr()->copy_pop_front();
@@ -929,23 +964,81 @@ ColumnReader* Segment::_get_column_reader(const TabletColumn& col) {
         const auto* node = col.has_path_info()
                                    ? _sub_column_tree[unique_id].find_exact(relative_path)
                                    : nullptr;
-        if (node != nullptr) {
-            return node->data.reader.get();
+        *reader = node != nullptr ? node->data.reader.get() : nullptr;
+        return Status::OK();
+    }
+    return _get_column_reader_by_uid(col.unique_id(), stats, reader);
+}
+
+Status Segment::_get_column_reader_by_uid(int32_t unique_id, OlapReaderStatistics* stats,
+                                          ColumnReader** reader) {
+    *reader = nullptr;
+    if (!_lazy_column_readers) {
+        if (auto it = _column_readers.find(unique_id); it != _column_readers.end()) {
+            *reader = it->second.get();
+        }
+        return Status::OK();
+    }
+    auto ordinal_iter = _column_uid_to_footer_ordinal.find(unique_id);
+    if (ordinal_iter == _column_uid_to_footer_ordinal.end()) {
+        return Status::OK();
+    }
+    {
+        std::shared_lock rlock(_column_readers_lock);
+        if (auto it = _column_readers.find(unique_id); it != _column_readers.end()) {
+            *reader = it->second.get();
+            return Status::OK();
         }
-        return nullptr;
     }
-    auto col_unique_id = col.unique_id();
-    if (_column_readers.contains(col_unique_id)) {
-        return _column_readers[col_unique_id].get();
+
+    std::shared_ptr<SegmentFooterPB> footer_pb_shared;
+    RETURN_IF_ERROR(_get_segment_footer(footer_pb_shared, stats));
+    std::lock_guard wlock(_column_readers_lock);
+    if (auto it = _column_readers.find(unique_id); it != _column_readers.end()) {
+        *reader = it->second.get();
+        return Status::OK();
     }
-    return nullptr;
+    ColumnReaderOptions opts {
+            .kept_in_memory = _tablet_schema->is_in_memory(),
+            .be_exec_version = _be_exec_version,
+    };
+    std::unique_ptr<ColumnReader> column_reader;
+    RETURN_IF_ERROR(ColumnReader::create(opts, footer_pb_shared->columns(ordinal_iter->second),
+                                         footer_pb_shared->num_rows(), _file_reader,
+                                         &column_reader));
+    *reader = column_reader.get();
+    _column_readers.emplace(unique_id, std::move(column_reader));
+    _lazy_column_readers_mem_usage += config::estimated_mem_per_column_reader;
+    g_segment_estimate_mem_bytes << config::estimated_mem_per_column_reader;
+    return Status::OK();
+}
+
+Status Segment::get_data_page_first_ordinals(const TabletColumn& tablet_column,
+                                             OlapReaderStatistics* stats,
+                                             std::vector<ordinal_t>* ordinals) {
+    ordinals->clear();
+    RETURN_IF_ERROR(_create_column_readers_once(stats));
+    ColumnReader* reader = nullptr;
+    RETURN_IF_ERROR(_get_column_reader(tablet_column, stats, &reader));
+    if (reader == nullptr || !is_scalar_type(tablet_column.type())) {
+        return Status::OK();
+    }
+    ColumnIteratorOptions iter_opts {
+            .use_page_cache = !config::disable_storage_page_cache,
+            .file_reader = file_reader().get(),
+            .stats = stats,
+            .io_ctx = io::IOContext {.reader_type = ReaderType::READER_QUERY,
+                                     .file_cache_stats = &stats->file_cache_stats},
+    };
+    return reader->get_data_page_first_ordinals(iter_opts, ordinals);
 }
 
 Status Segment::new_bitmap_index_iterator(const TabletColumn& tablet_column,
                                           const StorageReadOptions& read_options,
                                           std::unique_ptr<BitmapIndexIterator>* iter) {
     RETURN_IF_ERROR(_create_column_readers_once(read_options.stats));
-    ColumnReader* reader = _get_column_reader(tablet_column);
+    ColumnReader* reader = nullptr;
+    RETURN_IF_ERROR(_get_column_reader(tablet_column, read_options.stats, &reader));
     if (reader != nullptr && reader->has_bitmap_index()) {
         BitmapIndexIterator* it;
         RETURN_IF_ERROR(reader->new_bitmap_index_iterator(&it));
@@ -962,7 +1055,8 @@ Status Segment::new_index_iterator(const TabletColumn& tablet_column, const Tabl
         _be_exec_version = read_options.runtime_state->be_exec_version();
     }
     RETURN_IF_ERROR(_create_column_readers_once(read_options.stats));
-    ColumnReader* reader = _get_column_reader(tablet_column);
+    ColumnReader* reader = nullptr;
+    RETURN_IF_ERROR(_get_column_reader(tablet_column, read_options.stats, &reader));
     if (reader != nullptr && index_meta) {
         // call DorisCallOnce.call without check if _index_file_reader is nullptr
         // to avoid data race during parallel method calls
@@ -979,6 +1073,45 @@ Status Segment::lookup_row_key(const Slice& key, const TabletSchema* latest_sche
                                bool with_seq_col, bool with_rowid, RowLocation* row_location,
                                OlapReaderStatistics* stats, std::string* encoded_seq_value) {
     RETURN_IF_ERROR(load_pk_index_and_bf(stats));
+    std::unique_ptr<segment_v2::IndexedColumnIterator> index_iterator;
+    RETURN_IF_ERROR(_pk_index_reader->new_iterator(&index_iterator, stats));
+    auto index_type = vectorized::DataTypeFactory::instance().create_data_type(
+            _pk_index_reader->type_info()->type(), 1, 0);
+    auto index_column = index_type->create_column();
+    return _lookup_row_key(key, latest_schema, with_seq_col, with_rowid, index_iterator.get(),
+                           index_column, row_location, encoded_seq_value);
+}
+
+Status Segment::lookup_row_keys(const std::vector<Slice>& keys, const TabletSchema* latest_schema,
+                                bool with_seq_col, bool with_rowid, std::vector<Status>* results,
+                                std::vector<RowLocation>* row_locations,
+                                OlapReaderStatistics* stats) {
+    RETURN_IF_ERROR(load_pk_index_and_bf(stats));
+    results->resize(keys.size());
+    row_locations->resize(keys.size());
+    // the iterator keeps the data page it seeked last, so sorted keys decode each page once
+    std::unique_ptr<segment_v2::IndexedColumnIterator> index_iterator;
+    RETURN_IF_ERROR(_pk_index_reader->new_iterator(&index_iterator, stats));
+    auto index_type = vectorized::DataTypeFactory::instance().create_data_type(
+            _pk_index_reader->type_info()->type(), 1, 0);
+    auto index_column = index_type->create_column();
+    for (size_t i = 0; i < keys.size(); ++i) {
+        (*results)[i] = _lookup_row_key(keys[i], latest_schema, with_seq_col, with_rowid,
+                                        index_iterator.get(), index_column,
+                                        &(*row_locations)[i], nullptr);
+        if (!(*results)[i].ok() && !(*results)[i].is<ErrorCode::KEY_NOT_FOUND>() &&
+            !(*results)[i].is<ErrorCode::KEY_ALREADY_EXISTS>()) {
+            return (*results)[i];
+        }
+    }
+    return Status::OK();
+}
+
+Status Segment::_lookup_row_key(const Slice& key, const TabletSchema* latest_schema,
+                                bool with_seq_col, bool with_rowid,
+                                IndexedColumnIterator* index_iterator,
+                                vectorized::MutableColumnPtr& index_column,
+                                RowLocation* row_location, std::string* encoded_seq_value) {
     bool has_seq_col = latest_schema->has_sequence_col();
     bool has_rowid = !latest_schema->cluster_key_uids().empty();
     size_t seq_col_length = 0;
@@ -996,8 +1129,6 @@ Status Segment::lookup_row_key(const Slice& key, const TabletSchema* latest_sche
         return Status::Error<ErrorCode::KEY_NOT_FOUND>("Can't find key in the segment");
     }
     bool exact_match = false;
-    std::unique_ptr<segment_v2::IndexedColumnIterator> index_iterator;
-    RETURN_IF_ERROR(_pk_index_reader->new_iterator(&index_iterator, stats));
     auto st = index_iterator->seek_at_or_after(&key_without_seq, &exact_match);
     if (!st.ok() && !st.is<ErrorCode::ENTRY_NOT_FOUND>()) {
         return st;
@@ -1010,9 +1141,7 @@ Status Segment::lookup_row_key(const Slice& key, const TabletSchema* latest_sche
     row_location->rowset_id = _rowset_id;
 
     size_t num_to_read = 1;
-    auto index_type = vectorized::DataTypeFactory::instance().create_data_type(
-            _pk_index_reader->type_info()->type(), 1, 0);
-    auto index_column = index_type->create_column();
+    index_column->clear();
     size_t num_read = num_to_read;
     RETURN_IF_ERROR(index_iterator->next_batch(&num_read, index_column));
     DCHECK(num_to_read == num_read);
@@ -1130,6 +1259,15 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
                                        uint32_t row_id, vectorized::MutableColumnPtr& result,
                                        OlapReaderStatistics& stats,
                                        std::unique_ptr<ColumnIterator>& iterator_hint) {
+    return seek_and_read_by_rowids(schema, slot, {row_id}, result, stats, iterator_hint);
+}
+
+Status Segment::seek_and_read_by_rowids(const TabletSchema& schema, SlotDescriptor* slot,
+                                        const std::vector<rowid_t>& row_ids,
+                                        vectorized::MutableColumnPtr& result,
+                                        OlapReaderStatistics& stats,
+                                        std::unique_ptr<ColumnIterator>& iterator_hint) {
+    DCHECK(std::is_sorted(row_ids.begin(), row_ids.end()));
     StorageReadOptions storage_read_opt;
     storage_read_opt.stats = &stats;
     storage_read_opt.io_ctx.reader_type = ReaderType::READER_QUERY;
@@ -1141,7 +1279,6 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
                                      .file_cache_stats = &stats.file_cache_stats},
     };
 
-    std::vector<segment_v2::rowid_t> single_row_loc {row_id};
     if (!slot->column_paths().empty()) {
         vectorized::PathInDataPtr path = std::make_shared<vectorized::PathInData>(
                 schema.column_by_uid(slot->col_unique_id()).name_lower_case(),
@@ -1163,13 +1300,15 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
             RETURN_IF_ERROR(new_column_iterator(column, &iterator_hint, &storage_read_opt));
             RETURN_IF_ERROR(iterator_hint->init(opt));
         }
-        RETURN_IF_ERROR(
-                iterator_hint->read_by_rowids(single_row_loc.data(), 1, file_storage_column));
+        RETURN_IF_ERROR(iterator_hint->read_by_rowids(row_ids.data(), row_ids.size(),
+                                                      file_storage_column));
         // iterator_hint.reset(nullptr);
         // Get it's inner field, for JSONB case
         vectorized::Field field = remove_nullable(storage_type)->get_default();
-        file_storage_column->get(0, field);
-        result->insert(field);
+        for (size_t i = 0; i < row_ids.size(); ++i) {
+            file_storage_column->get(i, field);
+            result->insert(field);
+        }
     } else {
         int index = (slot->col_unique_id() >= 0) ? schema.field_index(slot->col_unique_id())
                                                  : schema.field_index(slot->col_name());
@@ -1185,7 +1324,7 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
                     new_column_iterator(schema.column(index), &iterator_hint, &storage_read_opt));
             RETURN_IF_ERROR(iterator_hint->init(opt));
         }
-        RETURN_IF_ERROR(iterator_hint->read_by_rowids(single_row_loc.data(), 1, result));
+        RETURN_IF_ERROR(iterator_hint->read_by_rowids(row_ids.data(), row_ids.size(), result));
     }
     return Status::OK();
 }
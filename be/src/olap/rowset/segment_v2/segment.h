@@ -25,6 +25,7 @@
 #include <cstdint>
 #include <map>
 #include <memory> // for unique_ptr
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -71,6 +72,7 @@ class Segment;
 class InvertedIndexIterator;
 class IndexFileReader;
 class IndexIterator;
+class IndexedColumnIterator;
 
 using SegmentSharedPtr = std::shared_ptr<Segment>;
 // A Segment is used to represent a segment in memory format. When segment is
@@ -122,6 +124,12 @@ public:
     Status new_column_iterator(int32_t unique_id, const StorageReadOptions* opt,
                                std::unique_ptr<ColumnIterator>* iter);
 
+    // Get the first ordinal of every data page of `tablet_column`, used to split the segment
+    // into page aligned row ranges. `ordinals` is left empty if the column has no own pages.
+    Status get_data_page_first_ordinals(const TabletColumn& tablet_column,
+                                        OlapReaderStatistics* stats,
+                                        std::vector<ordinal_t>* ordinals);
+
     Status new_bitmap_index_iterator(const TabletColumn& tablet_column,
                                      const StorageReadOptions& read_options,
                                      std::unique_ptr<BitmapIndexIterator>* iter);
@@ -144,12 +152,28 @@ public:
                           bool with_rowid, RowLocation* row_location, OlapReaderStatistics* stats,
                           std::string* encoded_seq_value = nullptr);
 
+    // Lookup a batch of keys like lookup_row_key, the status of keys[i] is set to
+    // (*results)[i] and its location to (*row_locations)[i] when found. Keys are expected in
+    // ascending order, successive keys falling in the same primary key index page then share
+    // one read and decode of the page.
+    Status lookup_row_keys(const std::vector<Slice>& keys, const TabletSchema* latest_schema,
+                           bool with_seq_col, bool with_rowid, std::vector<Status>* results,
+                           std::vector<RowLocation>* row_locations, OlapReaderStatistics* stats);
+
     Status read_key_by_rowid(uint32_t row_id, std::string* key);
 
     Status seek_and_read_by_rowid(const TabletSchema& schema, SlotDescriptor* slot, uint32_t row_id,
                                   vectorized::MutableColumnPtr& result, OlapReaderStatistics& stats,
                                   std::unique_ptr<ColumnIterator>& iterator_hint);
 
+    // Reads the rows of `row_ids`, which must be ascending and unique, of the column of `slot`
+    // into `result` in one pass of the column iterator.
+    Status seek_and_read_by_rowids(const TabletSchema& schema, SlotDescriptor* slot,
+                                   const std::vector<rowid_t>& row_ids,
+                                   vectorized::MutableColumnPtr& result,
+                                   OlapReaderStatistics& stats,
+                                   std::unique_ptr<ColumnIterator>& iterator_hint);
+
     Status load_index(OlapReaderStatistics* stats);
 
     Status load_pk_index_and_bf(OlapReaderStatistics* stats);
@@ -234,7 +258,16 @@ private:
     Status _parse_footer(std::shared_ptr<SegmentFooterPB>& footer, OlapReaderStatistics* stats);
     Status _create_column_readers(const SegmentFooterPB& footer);
     Status _load_pk_bloom_filter(OlapReaderStatistics* stats);
-    ColumnReader* _get_column_reader(const TabletColumn& col);
+    Status _lookup_row_key(const Slice& key, const TabletSchema* latest_schema, bool with_seq_col,
+                           bool with_rowid, IndexedColumnIterator* index_iterator,
+                           vectorized::MutableColumnPtr& index_column, RowLocation* row_location,
+                           std::string* encoded_seq_value);
+    Status _get_column_reader(const TabletColumn& col, OlapReaderStatistics* stats,
+                              ColumnReader** reader);
+    // Get the reader of a column by unique id, `*reader` is nullptr if the segment has no
+    // data for that column. With lazy column readers, the reader is created on first access.
+    Status _get_column_reader_by_uid(int32_t unique_id, OlapReaderStatistics* stats,
+                                     ColumnReader** reader);
 
     // Get Iterator which will read variant root column and extract with paths and types info
     Status _new_iterator_with_variant_root(const TabletColumn& tablet_column,
@@ -277,6 +310,16 @@ private:
     // after this segment is generated.
     std::map<int32_t, std::unique_ptr<ColumnReader>> _column_readers;
 
+    // Captured from config::enable_segment_lazy_column_reader when the segment is opened.
+    // If true, `_column_readers` is filled on demand and guarded by `_column_readers_lock`,
+    // `_column_uid_to_footer_ordinal` tells where the meta of each column is in the footer.
+    bool _lazy_column_readers = false;
+    std::shared_mutex _column_readers_lock;
+    std::unordered_map<int32_t, uint32_t> _column_uid_to_footer_ordinal;
+    // estimated memory of lazily created column readers, tracked apart from `_meta_mem_usage`
+    // because it grows after the segment has been charged in segment cache
+    int64_t _lazy_column_readers_mem_usage = 0;
+
     // Init from ColumnMetaPB in SegmentFooterPB
     // map column unique id ---> it's inner data type
     std::map<int32_t, std::shared_ptr<const vectorized::IDataType>> _file_column_types;
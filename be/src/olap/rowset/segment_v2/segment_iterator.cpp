@@ -38,6 +38,8 @@
 #include "common/logging.h"
 #include "common/object_pool.h"
 #include "common/status.h"
+#include "io/cache/cached_remote_file_reader.h"
+#include "io/fs/buffered_reader.h"
 #include "io/fs/file_reader.h"
 #include "io/io_common.h"
 #include "olap/bloom_filter_predicate.h"
@@ -62,12 +64,14 @@
 #include "olap/types.h"
 #include "olap/utils.h"
 #include "runtime/define_primitive_type.h"
+#include "runtime/exec_env.h"
 #include "runtime/query_context.h"
 #include "runtime/runtime_predicate.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
 #include "util/defer_op.h"
 #include "util/doris_metrics.h"
+#include "util/hash_util.hpp"
 #include "util/key_util.h"
 #include "util/simd/bits.h"
 #include "vec/columns/column.h"
@@ -97,6 +101,10 @@ namespace doris {
 using namespace ErrorCode;
 namespace segment_v2 {
 
+// the rows of a sampled granule are read or skipped together, so a kept granule reads whole
+// pages instead of scattered rows
+static constexpr uint64_t SAMPLE_GRANULE_ROWS = 4096;
+
 SegmentIterator::~SegmentIterator() = default;
 
 // A fast range iterator for roaring bitmap. Output ranges use closed-open form, like [from, to).
@@ -376,6 +384,9 @@ Status SegmentIterator::_lazy_init() {
     SCOPED_RAW_TIMER(&_opts.stats->block_init_ns);
     DorisMetrics::instance()->segment_read_total->increment(1);
     _row_bitmap.addRange(0, _segment->num_rows());
+    if (_opts.sample_rate < 1) {
+        _sample_row_bitmap();
+    }
     // z-order can not use prefix index
     if (_segment->_tablet_schema->sort_type() != SortType::ZORDER &&
         _segment->_tablet_schema->cluster_key_uids().empty()) {
@@ -402,9 +413,149 @@ Status SegmentIterator::_lazy_init() {
     } else {
         _range_iter.reset(new BitmapRangeIterator(_row_bitmap));
     }
+    _prefetch_remote_data_pages();
     return Status::OK();
 }
 
+void SegmentIterator::_sample_row_bitmap() {
+    // Every segment gets its own granules from the seed of the query, so a sampled query can be
+    // run again on the same data for the same answer.
+    size_t seed = _opts.sample_seed;
+    HashUtil::hash_combine(seed, _opts.tablet_id);
+    HashUtil::hash_combine(seed, _opts.rowset_id.hi);
+    HashUtil::hash_combine(seed, _opts.rowset_id.mi);
+    HashUtil::hash_combine(seed, _opts.rowset_id.lo);
+    HashUtil::hash_combine(seed, segment_id());
+    size_t pre_size = _row_bitmap.cardinality();
+    _row_bitmap &= RowRanges::ranges_to_roaring(RowRanges::create_sampled(
+            _segment->num_rows(), SAMPLE_GRANULE_ROWS, _opts.sample_rate, seed));
+    _opts.stats->rows_sample_filtered += (pre_size - _row_bitmap.cardinality());
+}
+
+void SegmentIterator::_prefetch_remote_data_pages() {
+    const auto reader_type = _opts.io_ctx.reader_type;
+    // compaction reads all columns of the segment sequentially, so any of their pages is going
+    // to be read, while a query only surely reads the pages of its predicate columns
+    const bool prefetch_for_compaction =
+            config::enable_compaction_remote_page_prefetch &&
+            (reader_type == ReaderType::READER_BASE_COMPACTION ||
+             reader_type == ReaderType::READER_CUMULATIVE_COMPACTION ||
+             reader_type == ReaderType::READER_FULL_COMPACTION ||
+             reader_type == ReaderType::READER_COLD_DATA_COMPACTION);
+    if (_row_bitmap.isEmpty() ||
+        (!prefetch_for_compaction &&
+         (!config::enable_segment_remote_page_prefetch || _predicate_column_ids.empty()))) {
+        return;
+    }
+    io::FileReaderSPtr file_reader = _segment->file_reader();
+    auto* pool = ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool();
+    if (pool == nullptr ||
+        dynamic_cast<io::CachedRemoteFileReader*>(file_reader.get()) == nullptr) {
+        return;
+    }
+
+    RowRanges row_ranges;
+    BitmapRangeIterator range_iter(_row_bitmap);
+    uint32_t from = 0;
+    uint32_t to = 0;
+    while (range_iter.next_range(num_rows(), &from, &to)) {
+        row_ranges.add(RowRange(from, to));
+    }
+
+    std::vector<io::PrefetchRange> page_ranges;
+    if (prefetch_for_compaction) {
+        if (!_get_compaction_prefetch_page_ranges(row_ranges, &page_ranges)) {
+            return;
+        }
+    } else {
+        for (auto cid : _predicate_column_ids) {
+            if (_column_iterators[cid] == nullptr) {
+                continue;
+            }
+            auto st = _column_iterators[cid]->get_data_page_ranges(row_ranges, &page_ranges);
+            if (!st.ok()) {
+                // prefetch is best effort, the pages are read on demand anyway
+                VLOG_DEBUG << "skip prefetching pages of segment " << segment_id() << ": " << st;
+                return;
+            }
+        }
+    }
+    std::sort(page_ranges.begin(), page_ranges.end(),
+              [](const io::PrefetchRange& lhs, const io::PrefetchRange& rhs) {
+                  return lhs.start_offset < rhs.start_offset;
+              });
+    auto merged_ranges = io::PrefetchRange::merge_adjacent_seq_ranges(
+            page_ranges, config::segment_remote_page_prefetch_merge_distance_bytes,
+            config::segment_remote_page_prefetch_max_read_bytes);
+
+    // the query's statistics may be gone when a prefetch finishes, so they are not passed down
+    io::IOContext io_ctx {
+            .reader_type = _opts.io_ctx.reader_type,
+            .is_disposable = _opts.io_ctx.is_disposable,
+            .expiration_time = _opts.io_ctx.expiration_time,
+            .is_dryrun = config::enable_reader_dryrun_when_download_file_cache,
+    };
+    for (const auto& range : merged_ranges) {
+        auto st = pool->submit_func([file_reader, range, io_ctx]() {
+            size_t size = range.end_offset - range.start_offset;
+            std::unique_ptr<char[]> buffer(new char[size]);
+            size_t bytes_read = 0;
+            auto st = file_reader->read_at(range.start_offset, {buffer.get(), size}, &bytes_read,
+                                           &io_ctx);
+            if (!st.ok()) {
+                LOG_EVERY_N(WARNING, 100) << "failed to prefetch pages of " << file_reader->path()
+                                          << ", offset=" << range.start_offset
+                                          << ", size=" << size << ": " << st;
+            }
+        });
+        if (!st.ok()) {
+            // the pool is full, leave the remaining pages to the synchronous reads
+            break;
+        }
+        _opts.stats->remote_page_prefetch_ranges++;
+        _opts.stats->remote_page_prefetch_bytes += range.end_offset - range.start_offset;
+    }
+}
+
+bool SegmentIterator::_get_compaction_prefetch_page_ranges(
+        RowRanges& row_ranges, std::vector<io::PrefetchRange>* page_ranges) {
+    std::vector<std::vector<io::PrefetchRange>> column_page_ranges;
+    for (auto cid : _schema->column_ids()) {
+        if (_column_iterators[cid] == nullptr) {
+            continue;
+        }
+        auto& ranges = column_page_ranges.emplace_back();
+        auto st = _column_iterators[cid]->get_data_page_ranges(row_ranges, &ranges);
+        if (!st.ok()) {
+            // prefetch is best effort, the pages are read on demand anyway
+            VLOG_DEBUG << "skip prefetching pages of segment " << segment_id() << ": " << st;
+            return false;
+        }
+    }
+    // All columns are consumed at the same pace, so take their pages in turn until the budget
+    // runs out, which prefetches the head of every column instead of all of the first one.
+    const auto budget = config::compaction_remote_page_prefetch_bytes_per_segment;
+    int64_t prefetch_bytes = 0;
+    for (size_t page_idx = 0;; ++page_idx) {
+        bool has_more = false;
+        for (const auto& ranges : column_page_ranges) {
+            if (page_idx >= ranges.size()) {
+                continue;
+            }
+            has_more = true;
+            const auto& range = ranges[page_idx];
+            prefetch_bytes += range.end_offset - range.start_offset;
+            if (prefetch_bytes > budget) {
+                return true;
+            }
+            page_ranges->push_back(range);
+        }
+        if (!has_more) {
+            return true;
+        }
+    }
+}
+
 Status SegmentIterator::_get_row_ranges_by_keys() {
     SCOPED_RAW_TIMER(&_opts.stats->generate_row_ranges_by_keys_ns);
     DorisMetrics::instance()->segment_row_total->increment(num_rows());
@@ -712,6 +863,62 @@ Status SegmentIterator::_get_row_ranges_from_conditions(RowRanges* condition_row
     return Status::OK();
 }
 
+// Runtime filters that arrive after `_lazy_init` are evaluated row by row as conjuncts, which
+// saves CPU but not IO. Their column predicates are published to `_opts.late_arrival_predicates`
+// by the scanner, here we use them to drop the pages whose zone map can not match from the rows
+// that have not been read yet.
+Status SegmentIterator::_apply_late_arrival_predicates() {
+    const auto& late_arrival_predicates = _opts.late_arrival_predicates;
+    if (late_arrival_predicates == nullptr ||
+        late_arrival_predicates->version() == _late_arrival_predicates_version) {
+        return Status::OK();
+    }
+    std::vector<const ColumnPredicate*> predicates;
+    _late_arrival_predicates_version =
+            late_arrival_predicates->collect(_late_arrival_predicates_version, &predicates);
+    // the backward range iterator can not be repositioned after `_row_bitmap` changes
+    if (!config::enable_late_arrival_runtime_filter_zone_map_pruning ||
+        _opts.read_orderby_key_reverse || _next_unread_rowid >= num_rows()) {
+        return Status::OK();
+    }
+
+    SCOPED_RAW_TIMER(&_opts.stats->generate_row_ranges_by_zonemap_ns);
+    RowRanges zone_map_row_ranges = RowRanges::create_single(_next_unread_rowid, num_rows());
+    bool applied = false;
+    for (const auto* predicate : predicates) {
+        auto cid = predicate->column_id();
+        if (cid >= _column_iterators.size() || _column_iterators[cid] == nullptr ||
+            _schema->column(cid) == nullptr || !predicate->support_zonemap() ||
+            !_segment->can_apply_predicate_safely(cid, predicate, *_schema,
+                                                  _opts.io_ctx.reader_type)) {
+            continue;
+        }
+        AndBlockColumnPredicate and_predicate;
+        and_predicate.add_column_predicate(SingleColumnBlockPredicate::create_unique(predicate));
+
+        RowRanges column_row_ranges = RowRanges::create_single(num_rows());
+        RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_zone_map(&and_predicate, nullptr,
+                                                                           &column_row_ranges));
+        RowRanges::ranges_intersection(zone_map_row_ranges, column_row_ranges,
+                                       &zone_map_row_ranges);
+        applied = true;
+    }
+    if (!applied) {
+        return Status::OK();
+    }
+
+    // rows before `_next_unread_rowid` have been handed out already, drop them together with
+    // the pruned pages and restart the range iterator from the first unread row.
+    uint64_t unread_rows = _row_bitmap.cardinality();
+    if (_next_unread_rowid > 0) {
+        unread_rows -= _row_bitmap.rank(_next_unread_rowid - 1);
+    }
+    _row_bitmap &= RowRanges::ranges_to_roaring(zone_map_row_ranges);
+    _opts.stats->rows_stats_late_rf_filtered += (unread_rows - _row_bitmap.cardinality());
+    _range_iter.reset(new BitmapRangeIterator(_row_bitmap));
+    return Status::OK();
+}
+
 // filter rows by evaluating column predicates using bitmap indexes.
 // upon return, predicates that've been evaluated by bitmap indexes are removed from _col_predicates.
 Status SegmentIterator::_apply_bitmap_index() {
@@ -1510,9 +1717,55 @@ Status SegmentIterator::_vec_init_lazy_materialization() {
             }
         }
     }
+
+    // Step 5: move the columns only used by short circuit predicates to the staged read
+    _vec_init_staged_predicates(del_cond_id_set);
     return Status::OK();
 }
 
+// A column which is only used by short circuit predicates is read after the other predicate
+// columns are evaluated, and only for the rows they select. The other predicate columns stay in
+// the first read, since vectorized predicates are cheapest on the whole batch, and the delete
+// conditions and the common exprs need their columns for all rows.
+void SegmentIterator::_vec_init_staged_predicates(const std::set<ColumnId>& del_cond_id_set) {
+    if (!config::enable_segment_iterator_staged_predicate_read || !_is_need_short_eval) {
+        return;
+    }
+    std::set<ColumnId> vec_pred_col_id_set(_vec_pred_column_ids.begin(),
+                                           _vec_pred_column_ids.end());
+    std::map<ColumnId, size_t> stage_of_column;
+    for (auto* predicate : _short_cir_eval_predicate) {
+        auto cid = predicate->column_id();
+        if (vec_pred_col_id_set.contains(cid) || del_cond_id_set.contains(cid) ||
+            _is_common_expr_column[cid] ||
+            static_cast<int32_t>(cid) == _schema->version_col_idx()) {
+            continue;
+        }
+        auto [it, inserted] = stage_of_column.emplace(cid, _staged_predicates.size());
+        if (inserted) {
+            _staged_predicates.push_back({.cid = cid});
+        }
+        _staged_predicates[it->second].predicates.push_back(predicate);
+    }
+    // the first stage must read at least one column for the whole batch
+    if (!_staged_predicates.empty() && _staged_predicates.size() == _predicate_column_ids.size()) {
+        _staged_predicates.erase(_staged_predicates.begin());
+    }
+    if (_staged_predicates.empty()) {
+        return;
+    }
+
+    std::set<ColumnId> staged_column_ids;
+    for (const auto& stage : _staged_predicates) {
+        staged_column_ids.insert(stage.cid);
+    }
+    std::erase_if(_short_cir_eval_predicate, [&](const ColumnPredicate* predicate) {
+        return staged_column_ids.contains(predicate->column_id());
+    });
+    std::erase_if(_predicate_column_ids,
+                  [&](ColumnId cid) { return staged_column_ids.contains(cid); });
+}
+
 bool SegmentIterator::_can_evaluated_by_vectorized(ColumnPredicate* predicate) {
     auto cid = predicate->column_id();
     FieldType field_type = _schema->column(cid)->type();
@@ -1702,6 +1955,9 @@ Status SegmentIterator::_read_columns_by_index(uint32_t nrows_read_limit, uint32
     SCOPED_RAW_TIMER(&_opts.stats->predicate_column_read_ns);
 
     nrows_read = _range_iter->read_batch_rowids(_block_rowids.data(), nrows_read_limit);
+    if (nrows_read > 0) {
+        _next_unread_rowid = _block_rowids[nrows_read - 1] + 1;
+    }
     bool is_continuous = (nrows_read > 1) &&
                          (_block_rowids[nrows_read - 1] - _block_rowids[0] == nrows_read - 1);
 
@@ -1910,6 +2166,72 @@ uint16_t SegmentIterator::_evaluate_short_circuit_predicate(uint16_t* vec_sel_ro
     return selected_size;
 }
 
+// Each stage reads its column for the rows selected so far and narrows the selection, the
+// stages are reordered by the observed pass ratio after every batch, so the most selective
+// column is read first and the later columns are read for the fewest rows.
+Status SegmentIterator::_evaluate_staged_predicates(uint16_t* sel_rowid_idx,
+                                                    uint16_t& selected_size) {
+    if (_staged_predicates.empty()) {
+        return Status::OK();
+    }
+    for (auto& stage : _staged_predicates) {
+        stage.read_rows.assign(sel_rowid_idx, sel_rowid_idx + selected_size);
+        _opts.stats->staged_pred_column_skipped_rows += _current_batch_rows_read - selected_size;
+        if (selected_size == 0) {
+            continue;
+        }
+        std::vector<ColumnId> read_column_ids {stage.cid};
+        RETURN_IF_ERROR(_read_columns_by_rowids(read_column_ids, _block_rowids, sel_rowid_idx,
+                                                selected_size, &_current_return_columns));
+        _opts.stats->staged_pred_column_read_rows += selected_size;
+
+        SCOPED_RAW_TIMER(&_opts.stats->short_cond_ns);
+        // the column only holds the selected rows, evaluate on its positions and map the
+        // passed positions back to the rows of the batch
+        auto& column = _current_return_columns[stage.cid];
+        _staged_sel_idx.resize(selected_size);
+        std::iota(_staged_sel_idx.begin(), _staged_sel_idx.end(), 0);
+        uint16_t passed_size = selected_size;
+        for (auto* predicate : stage.predicates) {
+            _convert_dict_code_for_predicate_if_necessary_impl(predicate);
+            passed_size = predicate->evaluate(*column, _staged_sel_idx.data(), passed_size);
+        }
+        for (uint16_t i = 0; i < passed_size; ++i) {
+            sel_rowid_idx[i] = stage.read_rows[_staged_sel_idx[i]];
+        }
+
+        _opts.stats->short_circuit_cond_input_rows += selected_size;
+        _opts.stats->rows_short_circuit_cond_filtered += selected_size - passed_size;
+        stage.input_rows += selected_size;
+        stage.passed_rows += passed_size;
+        selected_size = passed_size;
+    }
+    std::stable_sort(_staged_predicates.begin(), _staged_predicates.end(),
+                     [](const StagedPredicate& lhs, const StagedPredicate& rhs) {
+                         return lhs.pass_ratio() < rhs.pass_ratio();
+                     });
+    return Status::OK();
+}
+
+Status SegmentIterator::_output_staged_predicate_columns(vectorized::Block* block,
+                                                         uint16_t* sel_rowid_idx,
+                                                         uint16_t selected_size) {
+    for (const auto& stage : _staged_predicates) {
+        // the selected rows are a subset of the rows the column is read for, both ascending
+        _staged_sel_idx.resize(selected_size);
+        uint16_t pos = 0;
+        for (uint16_t i = 0; i < selected_size; ++i) {
+            while (stage.read_rows[pos] != sel_rowid_idx[i]) {
+                ++pos;
+            }
+            _staged_sel_idx[i] = pos;
+        }
+        RETURN_IF_ERROR(_output_column_by_sel_idx(block, std::vector<ColumnId> {stage.cid},
+                                                  _staged_sel_idx.data(), selected_size));
+    }
+    return Status::OK();
+}
+
 Status SegmentIterator::_read_columns_by_rowids(std::vector<ColumnId>& read_column_ids,
                                                 std::vector<rowid_t>& rowid_vector,
                                                 uint16_t* sel_rowid_idx, size_t select_size,
@@ -2046,7 +2368,8 @@ Status SegmentIterator::_next_batch_internal(vectorized::Block* block) {
         // If the row bitmap size is smaller than block_row_max, there's no need to reserve that many column rows.
         auto nrows_reserve_limit =
                 std::min(_row_bitmap.cardinality(), uint64_t(_opts.block_row_max));
-        if (_lazy_materialization_read || _opts.record_rowids || _is_need_expr_eval) {
+        if (_lazy_materialization_read || _opts.record_rowids || _is_need_expr_eval ||
+            !_staged_predicates.empty()) {
             _block_rowids.resize(_opts.block_row_max);
         }
         _current_return_columns.resize(_schema->columns().size());
@@ -2102,6 +2425,8 @@ Status SegmentIterator::_next_batch_internal(vectorized::Block* block) {
         }
     }
 
+    RETURN_IF_ERROR(_apply_late_arrival_predicates());
+
     uint32_t nrows_read_limit = _opts.block_row_max;
     if (_can_opt_topn_reads()) {
         nrows_read_limit = std::min(static_cast<uint32_t>(_opts.topn_limit), nrows_read_limit);
@@ -2119,9 +2444,10 @@ Status SegmentIterator::_next_batch_internal(vectorized::Block* block) {
     _converted_column_ids.assign(_schema->columns().size(), 0);
 
     _current_batch_rows_read = 0;
-    RETURN_IF_ERROR(_read_columns_by_index(
-            nrows_read_limit, _current_batch_rows_read,
-            _lazy_materialization_read || _opts.record_rowids || _is_need_expr_eval));
+    RETURN_IF_ERROR(_read_columns_by_index(nrows_read_limit, _current_batch_rows_read,
+                                           _lazy_materialization_read || _opts.record_rowids ||
+                                                   _is_need_expr_eval ||
+                                                   !_staged_predicates.empty()));
     if (std::find(_predicate_column_ids.begin(), _predicate_column_ids.end(),
                   _schema->version_col_idx()) != _predicate_column_ids.end()) {
         _replace_version_col(_current_batch_rows_read);
@@ -2169,6 +2495,9 @@ Status SegmentIterator::_next_batch_internal(vectorized::Block* block) {
             //          In SSB test, it make no difference; So need more scenarios to test
             selected_size = _evaluate_short_circuit_predicate(_sel_rowid_idx.data(), selected_size);
 
+            // step 2.1: read and evaluate the staged predicate columns for the selected rows
+            RETURN_IF_ERROR(_evaluate_staged_predicates(_sel_rowid_idx.data(), selected_size));
+
             if (selected_size > 0) {
                 // step 3.1: output short circuit and predicate column
                 // when lazy materialization enables, _predicate_column_ids = distinct(_short_cir_pred_column_ids + _vec_pred_column_ids)
@@ -2176,6 +2505,8 @@ Status SegmentIterator::_next_batch_internal(vectorized::Block* block) {
                 // todo(wb) need to tell input columnids from output columnids
                 RETURN_IF_ERROR(_output_column_by_sel_idx(block, _predicate_column_ids,
                                                           _sel_rowid_idx.data(), selected_size));
+                RETURN_IF_ERROR(_output_staged_predicate_columns(block, _sel_rowid_idx.data(),
+                                                                 selected_size));
 
                 // step 3.2: read remaining expr column and evaluate it.
                 if (_is_need_expr_eval) {
@@ -144,6 +144,12 @@ public:
     void update_profile(RuntimeProfile* profile) override {
         _update_profile(profile, _short_cir_eval_predicate, "ShortCircuitPredicates");
         _update_profile(profile, _pre_eval_block_predicate, "PreEvaluatePredicates");
+        std::vector<ColumnPredicate*> staged_predicates;
+        for (const auto& stage : _staged_predicates) {
+            staged_predicates.insert(staged_predicates.end(), stage.predicates.begin(),
+                                     stage.predicates.end());
+        }
+        _update_profile(profile, staged_predicates, "StagedPredicates");
 
         if (_opts.delete_condition_predicates != nullptr) {
             std::set<const ColumnPredicate*> delete_predicate_set;
@@ -174,6 +180,14 @@ private:
     }
 
     [[nodiscard]] Status _lazy_init();
+    // keep only the rows of `_row_bitmap` in the sampled granules of the segment
+    void _sample_row_bitmap();
+    // submit merged async reads of the data pages of the first read columns over `_row_bitmap`,
+    // to fill the file cache of a remote segment before the pages are decoded
+    void _prefetch_remote_data_pages();
+    // collect the leading data pages of all read columns, within the per segment budget
+    bool _get_compaction_prefetch_page_ranges(RowRanges& row_ranges,
+                                              std::vector<io::PrefetchRange>* page_ranges);
     [[nodiscard]] Status _init_impl(const StorageReadOptions& opts);
     [[nodiscard]] Status _init_return_column_iterators();
     [[nodiscard]] Status _init_bitmap_index_iterators();
@@ -195,6 +209,9 @@ private:
     // calculate row ranges that satisfy requested column conditions using various column index
     [[nodiscard]] Status _get_row_ranges_by_column_conditions();
     [[nodiscard]] Status _get_row_ranges_from_conditions(RowRanges* condition_row_ranges);
+    // prune the rows not read yet by zone map of the predicates in `_opts.late_arrival_predicates`
+    // that were published after the last check
+    [[nodiscard]] Status _apply_late_arrival_predicates();
     [[nodiscard]] Status _apply_bitmap_index();
     [[nodiscard]] Status _apply_inverted_index();
     [[nodiscard]] Status _apply_inverted_index_on_column_predicate(
@@ -207,6 +224,7 @@ private:
     bool _is_literal_node(const TExprNodeType::type& node_type);
 
     Status _vec_init_lazy_materialization();
+    void _vec_init_staged_predicates(const std::set<ColumnId>& del_cond_id_set);
     // TODO: Fix Me
     // CHAR type in storage layer padding the 0 in length. But query engine need ignore the padding 0.
     // so segment iterator need to shrink char column before output it. only use in vec query engine.
@@ -229,6 +247,11 @@ private:
                                uint32_t nrows_read_limit);
     uint16_t _evaluate_vectorization_predicate(uint16_t* sel_rowid_idx, uint16_t selected_size);
     uint16_t _evaluate_short_circuit_predicate(uint16_t* sel_rowid_idx, uint16_t selected_size);
+    [[nodiscard]] Status _evaluate_staged_predicates(uint16_t* sel_rowid_idx,
+                                                     uint16_t& selected_size);
+    [[nodiscard]] Status _output_staged_predicate_columns(vectorized::Block* block,
+                                                          uint16_t* sel_rowid_idx,
+                                                          uint16_t selected_size);
     void _collect_runtime_filter_predicate();
     void _output_non_pred_columns(vectorized::Block* block);
     [[nodiscard]] Status _read_columns_by_rowids(std::vector<ColumnId>& read_column_ids,
@@ -391,6 +414,10 @@ private:
     roaring::Roaring _row_bitmap;
     // an iterator for `_row_bitmap` that can be used to extract row range to scan
     std::unique_ptr<BitmapRangeIterator> _range_iter;
+    // rowids below it have been handed out by `_range_iter`, only maintained for forward reads
+    rowid_t _next_unread_rowid = 0;
+    // version of `_opts.late_arrival_predicates` already applied to `_row_bitmap`
+    size_t _late_arrival_predicates_version = 0;
     // the next rowid to read
     rowid_t _cur_rowid;
     // members related to lazy materialization read
@@ -418,6 +445,25 @@ private:
     vectorized::MutableColumns _current_return_columns;
     std::vector<ColumnPredicate*> _pre_eval_block_predicate;
     std::vector<ColumnPredicate*> _short_cir_eval_predicate;
+    // A short circuit predicate column which is not read with _predicate_column_ids, but after
+    // the predicates of the previous stages, only for the rows passing them.
+    struct StagedPredicate {
+        ColumnId cid;
+        std::vector<ColumnPredicate*> predicates;
+        // rows of the current batch the column is read for, as indexes of _block_rowids
+        std::vector<uint16_t> read_rows;
+        uint64_t input_rows = 0;
+        uint64_t passed_rows = 0;
+
+        double pass_ratio() const {
+            return input_rows == 0 ? 1.0
+                                   : static_cast<double>(passed_rows) /
+                                             static_cast<double>(input_rows);
+        }
+    };
+    // ordered by the observed pass ratio, the most selective stage first
+    std::vector<StagedPredicate> _staged_predicates;
+    std::vector<uint16_t> _staged_sel_idx;
     std::vector<uint32_t> _delete_range_column_ids;
     std::vector<uint32_t> _delete_bloom_filter_column_ids;
     // when lazy materialization is enabled, segmentIter need to read data at least twice
@@ -288,10 +288,33 @@ Status SegmentWriter::_create_column_writer(uint32_t cid, const TabletColumn& co
     RETURN_IF_ERROR(writer->init());
     _column_writers.push_back(std::move(writer));
 
-    _olap_data_convertor->add_column_data_convertor(column);
+    if (column.is_variant_type() && !column.is_extracted_column() &&
+        config::variant_keep_materialized_subcolumns) {
+        _olap_data_convertor->add_variant_column_data_convertor(
+                column, _materialized_variant_paths(column, schema));
+    } else {
+        _olap_data_convertor->add_column_data_convertor(column);
+    }
     return Status::OK();
 }
 
+// Paths of the variant column already written as typed subcolumns, either in the schema of this
+// rowset or by previous segments of it. They stay subcolumns in this segment too.
+vectorized::ColumnVariant::PathSet SegmentWriter::_materialized_variant_paths(
+        const TabletColumn& column, const TabletSchemaSPtr& tablet_schema) {
+    vectorized::ColumnVariant::PathSet paths;
+    vectorized::schema_util::collect_materialized_paths(*tablet_schema, column.unique_id(), &paths);
+    if (_opts.rowset_ctx == nullptr) {
+        return paths;
+    }
+    std::lock_guard<std::mutex> lock(*(_opts.rowset_ctx->schema_lock));
+    if (_opts.rowset_ctx->merged_tablet_schema != nullptr) {
+        vectorized::schema_util::collect_materialized_paths(
+                *_opts.rowset_ctx->merged_tablet_schema, column.unique_id(), &paths);
+    }
+    return paths;
+}
+
 Status SegmentWriter::init(const std::vector<uint32_t>& col_ids, bool has_key) {
     DCHECK(_column_writers.empty());
     DCHECK(_column_ids.empty());
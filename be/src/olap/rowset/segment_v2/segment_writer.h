@@ -38,6 +38,7 @@
 #include "olap/tablet_schema.h"
 #include "util/faststring.h"
 #include "util/slice.h"
+#include "vec/columns/column_variant.h"
 
 namespace doris {
 namespace vectorized {
@@ -160,6 +161,8 @@ private:
     DISALLOW_COPY_AND_ASSIGN(SegmentWriter);
     Status _create_column_writer(uint32_t cid, const TabletColumn& column,
                                  const TabletSchemaSPtr& schema);
+    vectorized::ColumnVariant::PathSet _materialized_variant_paths(
+            const TabletColumn& column, const TabletSchemaSPtr& tablet_schema);
     Status _create_writers(const TabletSchemaSPtr& tablet_schema,
                            const std::vector<uint32_t>& col_ids);
     Status _write_data();
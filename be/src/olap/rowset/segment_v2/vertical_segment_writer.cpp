@@ -20,8 +20,10 @@
 #include <gen_cpp/segment_v2.pb.h>
 #include <parallel_hashmap/phmap.h>
 
+#include <atomic>
 #include <cassert>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <unordered_map>
@@ -39,6 +41,7 @@
 #include "olap/base_tablet.h"
 #include "olap/data_dir.h"
 #include "olap/key_coder.h"
+#include "olap/memtable_flush_executor.h"
 #include "olap/olap_common.h"
 #include "olap/partial_update_info.h"
 #include "olap/primary_key_index.h"
@@ -52,16 +55,19 @@
 #include "olap/rowset/segment_v2/page_pointer.h"
 #include "olap/segment_loader.h"
 #include "olap/short_key_index.h"
+#include "olap/storage_engine.h"
 #include "olap/tablet_schema.h"
 #include "olap/utils.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker.h"
+#include "runtime/thread_context.h"
 #include "service/point_query_executor.h"
 #include "util/coding.h"
 #include "util/crc32c.h"
 #include "util/debug_points.h"
 #include "util/faststring.h"
 #include "util/key_util.h"
+#include "util/threadpool.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_vector.h"
 #include "vec/common/assert_cast.h"
@@ -288,10 +294,33 @@ Status VerticalSegmentWriter::_create_column_writer(uint32_t cid, const TabletCo
     RETURN_IF_ERROR(writer->init());
     _column_writers.push_back(std::move(writer));
 
-    _olap_data_convertor->add_column_data_convertor(column);
+    if (column.is_variant_type() && !column.is_extracted_column() &&
+        config::variant_keep_materialized_subcolumns) {
+        _olap_data_convertor->add_variant_column_data_convertor(
+                column, _materialized_variant_paths(column, tablet_schema));
+    } else {
+        _olap_data_convertor->add_column_data_convertor(column);
+    }
     return Status::OK();
 };
 
+// Paths of the variant column already written as typed subcolumns, either in the schema of this
+// rowset or by previous segments of it. They stay subcolumns in this segment too.
+vectorized::ColumnVariant::PathSet VerticalSegmentWriter::_materialized_variant_paths(
+        const TabletColumn& column, const TabletSchemaSPtr& tablet_schema) {
+    vectorized::ColumnVariant::PathSet paths;
+    vectorized::schema_util::collect_materialized_paths(*tablet_schema, column.unique_id(), &paths);
+    if (_opts.rowset_ctx == nullptr) {
+        return paths;
+    }
+    std::lock_guard<std::mutex> lock(*(_opts.rowset_ctx->schema_lock));
+    if (_opts.rowset_ctx->merged_tablet_schema != nullptr) {
+        vectorized::schema_util::collect_materialized_paths(
+                *_opts.rowset_ctx->merged_tablet_schema, column.unique_id(), &paths);
+    }
+    return paths;
+}
+
 Status VerticalSegmentWriter::init() {
     DCHECK(_column_writers.empty());
     if (_opts.compression_type == UNKNOWN_COMPRESSION) {
@@ -1177,17 +1206,9 @@ Status VerticalSegmentWriter::write_batch() {
     vectorized::IOlapColumnDataAccessor* seq_column = nullptr;
     // the key is cluster key column unique id
     std::map<uint32_t, vectorized::IOlapColumnDataAccessor*> cid_to_column;
-    for (uint32_t cid = 0; cid < _tablet_schema->num_columns(); ++cid) {
-        RETURN_IF_ERROR(_create_column_writer(cid, _tablet_schema->column(cid), _tablet_schema));
-        for (auto& data : _batched_blocks) {
-            RETURN_IF_ERROR(_olap_data_convertor->set_source_content_with_specifid_columns(
-                    data.block, data.row_pos, data.num_rows, std::vector<uint32_t> {cid}));
-
-            // convert column data from engine format to storage layer format
-            auto [status, column] = _olap_data_convertor->convert_column_data(cid);
-            if (!status.ok()) {
-                return status;
-            }
+    auto collect_columns = [&](uint32_t cid,
+                               const std::vector<vectorized::IOlapColumnDataAccessor*>& columns) {
+        for (auto* column : columns) {
             if (cid < _tablet_schema->num_key_columns()) {
                 key_columns.push_back(column);
             }
@@ -1201,17 +1222,30 @@ Status VerticalSegmentWriter::write_batch() {
                           column_unique_id) != _tablet_schema->cluster_key_uids().end()) {
                 cid_to_column[column_unique_id] = column;
             }
-            RETURN_IF_ERROR(_column_writers[cid]->append(column->get_nullmap(), column->get_data(),
-                                                         data.num_rows));
-            _olap_data_convertor->clear_source_content();
         }
-        if (_data_dir != nullptr &&
-            _data_dir->reach_capacity_limit(_column_writers[cid]->estimate_buffer_size())) {
-            return Status::Error<DISK_REACH_CAPACITY_LIMIT>("disk {} exceed capacity limit.",
-                                                            _data_dir->path_hash());
+    };
+    if (_can_encode_columns_in_parallel()) {
+        for (uint32_t cid = 0; cid < _tablet_schema->num_columns(); ++cid) {
+            RETURN_IF_ERROR(
+                    _create_column_writer(cid, _tablet_schema->column(cid), _tablet_schema));
+        }
+        std::vector<std::vector<vectorized::IOlapColumnDataAccessor*>> columns(
+                _tablet_schema->num_columns());
+        RETURN_IF_ERROR(_encode_columns_in_parallel(&columns));
+        // the columns are written to the file in order
+        for (uint32_t cid = 0; cid < _tablet_schema->num_columns(); ++cid) {
+            collect_columns(cid, columns[cid]);
+            RETURN_IF_ERROR(_column_writers[cid]->write_data());
+        }
+    } else {
+        for (uint32_t cid = 0; cid < _tablet_schema->num_columns(); ++cid) {
+            RETURN_IF_ERROR(
+                    _create_column_writer(cid, _tablet_schema->column(cid), _tablet_schema));
+            std::vector<vectorized::IOlapColumnDataAccessor*> columns;
+            RETURN_IF_ERROR(_encode_column(cid, &columns));
+            collect_columns(cid, columns);
+            RETURN_IF_ERROR(_column_writers[cid]->write_data());
         }
-        RETURN_IF_ERROR(_column_writers[cid]->finish());
-        RETURN_IF_ERROR(_column_writers[cid]->write_data());
     }
 
     for (auto& data : _batched_blocks) {
@@ -1238,6 +1272,85 @@ Status VerticalSegmentWriter::write_batch() {
     return Status::OK();
 }
 
+Status VerticalSegmentWriter::_encode_column(
+        uint32_t cid, std::vector<vectorized::IOlapColumnDataAccessor*>* columns) {
+    for (auto& data : _batched_blocks) {
+        RETURN_IF_ERROR(_olap_data_convertor->set_source_content_with_specifid_columns(
+                data.block, data.row_pos, data.num_rows, std::vector<uint32_t> {cid}));
+
+        // convert column data from engine format to storage layer format
+        auto [status, column] = _olap_data_convertor->convert_column_data(cid);
+        if (!status.ok()) {
+            return status;
+        }
+        columns->push_back(column);
+        RETURN_IF_ERROR(_column_writers[cid]->append(column->get_nullmap(), column->get_data(),
+                                                     data.num_rows));
+        _olap_data_convertor->clear_source_content(cid);
+    }
+    if (_data_dir != nullptr &&
+        _data_dir->reach_capacity_limit(_column_writers[cid]->estimate_buffer_size())) {
+        return Status::Error<DISK_REACH_CAPACITY_LIMIT>("disk {} exceed capacity limit.",
+                                                        _data_dir->path_hash());
+    }
+    return _column_writers[cid]->finish();
+}
+
+static ThreadPool* column_encode_pool() {
+    return ExecEnv::GetInstance()->storage_engine().memtable_flush_executor()->column_encode_pool();
+}
+
+bool VerticalSegmentWriter::_can_encode_columns_in_parallel() {
+    // the index writers and the variant columns share state between the columns
+    return config::segment_column_encode_thread_num > 0 &&
+           config::segment_column_encode_parallelism > 1 &&
+           _opts.write_type == DataWriteType::TYPE_DIRECT && _tablet_schema->num_columns() > 1 &&
+           _index_file_writer == nullptr && _tablet_schema->num_variant_columns() == 0 &&
+           column_encode_pool() != nullptr;
+}
+
+// Every thread takes the next column to encode until all are taken. The flush thread encodes
+// columns too, so the flush goes on even if the pool is busy with other segments.
+Status VerticalSegmentWriter::_encode_columns_in_parallel(
+        std::vector<std::vector<vectorized::IOlapColumnDataAccessor*>>* columns) {
+    auto* pool = column_encode_pool();
+    auto num_columns = static_cast<uint32_t>(_tablet_schema->num_columns());
+    std::atomic<uint32_t> next_cid = 0;
+    std::mutex status_lock;
+    Status status;
+    auto encode_columns = [&]() {
+        for (uint32_t cid = next_cid++; cid < num_columns; cid = next_cid++) {
+            Status st = [&]() -> Status {
+                RETURN_IF_ERROR_OR_CATCH_EXCEPTION(_encode_column(cid, &(*columns)[cid]));
+                return Status::OK();
+            }();
+            if (!st.ok()) {
+                std::lock_guard lock(status_lock);
+                if (status.ok()) {
+                    status = st;
+                }
+                // the columns left are not needed
+                next_cid = num_columns;
+            }
+        }
+    };
+
+    int parallelism = std::min<int>(config::segment_column_encode_parallelism,
+                                    static_cast<int>(num_columns));
+    auto token = pool->new_token(ThreadPool::ExecutionMode::CONCURRENT, parallelism - 1);
+    auto mem_tracker = thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker_sptr();
+    for (int i = 1; i < parallelism; ++i) {
+        static_cast<void>(token->submit_func([&, mem_tracker]() {
+            SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(mem_tracker);
+            encode_columns();
+        }));
+    }
+    encode_columns();
+    // the tasks not started have no column left to encode, drop them and wait for the others
+    token->shutdown();
+    return status;
+}
+
 Status VerticalSegmentWriter::_generate_key_index(
         RowsInBlock& data, std::vector<vectorized::IOlapColumnDataAccessor*>& key_columns,
         vectorized::IOlapColumnDataAccessor* seq_column,
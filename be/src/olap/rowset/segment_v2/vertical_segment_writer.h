@@ -37,6 +37,7 @@
 #include "olap/tablet_schema.h"
 #include "util/faststring.h"
 #include "util/slice.h"
+#include "vec/columns/column_variant.h"
 
 namespace doris {
 namespace vectorized {
@@ -136,6 +137,15 @@ private:
     void _init_column_meta(ColumnMetaPB* meta, uint32_t column_id, const TabletColumn& column);
     Status _create_column_writer(uint32_t cid, const TabletColumn& column,
                                  const TabletSchemaSPtr& schema);
+    vectorized::ColumnVariant::PathSet _materialized_variant_paths(
+            const TabletColumn& column, const TabletSchemaSPtr& tablet_schema);
+    // Convert and append the batched rows of column `cid` and finish its writer, the pages are
+    // kept by the writer until write_data(). `columns` gets the converted data of every block.
+    Status _encode_column(uint32_t cid, std::vector<vectorized::IOlapColumnDataAccessor*>* columns);
+    bool _can_encode_columns_in_parallel();
+    // Encode the columns in the column encode pool and the current thread at the same time.
+    Status _encode_columns_in_parallel(
+            std::vector<std::vector<vectorized::IOlapColumnDataAccessor*>>* columns);
     uint64_t _estimated_remaining_size();
     Status _write_ordinal_index();
     Status _write_zone_map();
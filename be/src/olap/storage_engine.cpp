@@ -753,6 +753,12 @@ void StorageEngine::stop() {
     if (_cold_data_compaction_thread_pool) {
         _cold_data_compaction_thread_pool->shutdown();
     }
+    if (_index_build_thread_pool) {
+        _index_build_thread_pool->shutdown();
+    }
+    if (_value_column_group_thread_pool) {
+        _value_column_group_thread_pool->shutdown();
+    }
 
     if (_cooldown_thread_pool) {
         _cooldown_thread_pool->shutdown();
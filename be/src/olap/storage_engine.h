@@ -133,6 +133,8 @@ public:
     CalcDeleteBitmapExecutor* calc_delete_bitmap_executor() {
         return _calc_delete_bitmap_executor.get();
     }
+    // nullptr if vertical compaction merges value column groups one by one
+    ThreadPool* value_column_group_thread_pool() { return _value_column_group_thread_pool.get(); }
 
     void add_quering_rowset(RowsetSharedPtr rs);
 
@@ -181,6 +183,7 @@ protected:
 
     std::unique_ptr<ThreadPool> _base_compaction_thread_pool;
     std::unique_ptr<ThreadPool> _cumu_compaction_thread_pool;
+    std::unique_ptr<ThreadPool> _value_column_group_thread_pool;
     int _cumu_compaction_thread_pool_used_threads {0};
     int _cumu_compaction_thread_pool_small_tasks_running {0};
 };
@@ -329,6 +332,8 @@ public:
                                       SegCompactionCandidatesSharedPtr segments);
 
     ThreadPool* tablet_publish_txn_thread_pool() { return _tablet_publish_txn_thread_pool.get(); }
+    // nullptr if the indexes are built in the alter index threads
+    ThreadPool* index_build_thread_pool() { return _index_build_thread_pool.get(); }
     bool stopped() override { return _stopped; }
 
     Status process_index_change_task(const TAlterInvertedIndexReq& reqest);
@@ -515,6 +520,8 @@ private:
 
     std::unique_ptr<ThreadPool> _tablet_meta_checkpoint_thread_pool;
 
+    std::unique_ptr<ThreadPool> _index_build_thread_pool;
+
     CompactionPermitLimiter _permit_limiter;
 
     CompactionSubmitRegistry _compaction_submit_registry;
@@ -42,6 +42,7 @@
 #include "common/compiler_util.h" // IWYU pragma: keep
 // IWYU pragma: no_include <bits/chrono.h>
 #include <chrono> // IWYU pragma: keep
+#include <cmath>
 #include <filesystem>
 #include <iterator>
 #include <limits>
@@ -1074,6 +1075,22 @@ uint32_t Tablet::calc_compaction_score() {
     }
 }
 
+uint32_t Tablet::calc_compaction_priority_score(uint32_t compaction_score) const {
+    double weight = config::compaction_read_amplification_weight;
+    int64_t scans = scan_count_since_compaction.load(std::memory_order_relaxed);
+    if (weight <= 0 || scans <= 0) {
+        return compaction_score;
+    }
+    // every scan opens a reader for each rowset the score counts and merges rows of them,
+    // what compaction saves grows with both, damped so that a cold tablet with a high score
+    // is not starved by hot ones
+    int64_t merged_rows = merged_rows_since_compaction.load(std::memory_order_relaxed);
+    double read_cost = static_cast<double>(scans) + static_cast<double>(merged_rows) / 1024;
+    double priority = compaction_score * (1 + weight * std::log2(1 + read_cost));
+    return static_cast<uint32_t>(
+            std::min(priority, static_cast<double>(std::numeric_limits<uint32_t>::max())));
+}
+
 bool Tablet::suitable_for_compaction(
         CompactionType compaction_type,
         std::shared_ptr<CumulativeCompactionPolicy> cumulative_compaction_policy) {
@@ -2582,6 +2599,12 @@ Status Tablet::save_delete_bitmap(const TabletTxnInfo* txn_info, int64_t txn_id,
                                                 bitmap);
         }
     }
+    for (auto& [key, _] : delete_bitmap->delete_bitmap) {
+        if (std::get<1>(key) != DeleteBitmap::INVALID_SEGMENT_ID) {
+            _tablet_meta->delete_bitmap().update_agg_cache(
+                    {std::get<0>(key), std::get<1>(key), cur_version});
+        }
+    }
 
     return Status::OK();
 }
@@ -226,6 +226,10 @@ public:
 
     uint32_t calc_compaction_score();
 
+    // The priority to pick this tablet for compaction, see
+    // config::compaction_read_amplification_weight.
+    uint32_t calc_compaction_priority_score(uint32_t compaction_score) const;
+
     // This function to find max continuous version from the beginning.
     // For example: If there are 1, 2, 3, 5, 6, 7 versions belongs tablet, then 3 is target.
     // 3 will be saved in "version", and 7 will be saved in "max_version", if max_version != nullptr
@@ -737,6 +737,7 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
     const string& compaction_type_str =
             compaction_type == CompactionType::BASE_COMPACTION ? "base" : "cumulative";
     uint32_t highest_score = 0;
+    uint32_t highest_priority_score = 0;
     // find the single compaction tablet
     uint32_t single_compact_highest_score = 0;
     TabletSharedPtr best_tablet;
@@ -798,6 +799,9 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
         if (current_compaction_score < 5) {
             tablet_ptr->set_skip_compaction(true, compaction_type, UnixSeconds());
         }
+        // tablets are ranked by priority, while the scores reported stay compaction scores
+        uint32_t priority_score =
+                tablet_ptr->calc_compaction_priority_score(current_compaction_score);
 
         // tablet should do single compaction
         if (current_compaction_score > single_compact_highest_score &&
@@ -812,10 +816,10 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
 
         if (config::compaction_num_per_round > 1 && !tablet_ptr->should_fetch_from_peer()) {
             TabletScore ts;
-            ts.score = current_compaction_score;
+            ts.score = priority_score;
             ts.tablet_ptr = tablet_ptr;
             if ((top_tablets.size() >= config::compaction_num_per_round &&
-                 current_compaction_score > top_tablets.top().score) ||
+                 priority_score > top_tablets.top().score) ||
                 top_tablets.size() < config::compaction_num_per_round) {
                 bool ret = tablet_ptr->suitable_for_compaction(compaction_type,
                                                                cumulative_compaction_policy);
@@ -830,11 +834,12 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
                 }
             }
         } else {
-            if (current_compaction_score > highest_score && !tablet_ptr->should_fetch_from_peer()) {
+            if (priority_score > highest_priority_score && !tablet_ptr->should_fetch_from_peer()) {
                 bool ret = tablet_ptr->suitable_for_compaction(compaction_type,
                                                                cumulative_compaction_policy);
                 if (ret) {
-                    highest_score = current_compaction_score;
+                    highest_priority_score = priority_score;
+                    highest_score = std::max(highest_score, current_compaction_score);
                     best_tablet = tablet_ptr;
                 }
             }
@@ -1447,6 +1447,14 @@ std::shared_ptr<roaring::Roaring> DeleteBitmap::get_agg(const BitmapKey& bmk) co
             });
             if (handle2 == nullptr || start_version > std::get<2>(bmk)) {
                 start_version = 0;
+            } else if (!_has_bitmap_after(bmk, start_version)) {
+                // nothing is deleted since the cached version, share its bitmap
+                delete val;
+                auto* cached = reinterpret_cast<DeleteBitmapAggCache::Value*>(
+                        DeleteBitmapAggCache::instance()->value(handle2));
+                return std::shared_ptr<roaring::Roaring>(&cached->bitmap, [handle2](...) {
+                    DeleteBitmapAggCache::instance()->release(handle2);
+                });
             } else {
                 val->bitmap |= reinterpret_cast<DeleteBitmapAggCache::Value*>(
                                        DeleteBitmapAggCache::instance()->value(handle2))
@@ -1505,6 +1513,84 @@ std::shared_ptr<roaring::Roaring> DeleteBitmap::get_agg(const BitmapKey& bmk) co
             &val->bitmap, [handle](...) { DeleteBitmapAggCache::instance()->release(handle); });
 }
 
+bool DeleteBitmap::_has_bitmap_after(const BitmapKey& bmk, Version start_version) const {
+    std::shared_lock l(lock);
+    auto it = delete_bitmap.lower_bound({std::get<0>(bmk), std::get<1>(bmk), start_version + 1});
+    return it != delete_bitmap.end() && std::get<0>(it->first) == std::get<0>(bmk) &&
+           std::get<1>(it->first) == std::get<1>(bmk) && std::get<2>(it->first) <= std::get<2>(bmk);
+}
+
+void DeleteBitmap::update_agg_cache(const DeleteBitmap& delta) const {
+    if (!config::enable_mow_get_agg_by_cache || !config::enable_mow_update_agg_cache_on_commit) {
+        return;
+    }
+    std::vector<BitmapKey> keys;
+    {
+        std::shared_lock l(delta.lock);
+        for (const auto& [k, _] : delta.delete_bitmap) {
+            if (std::get<1>(k) == INVALID_SEGMENT_ID) {
+                continue;
+            }
+            // the map is ordered, the last bitmap of a segment has its max version
+            if (!keys.empty() && std::get<0>(keys.back()) == std::get<0>(k) &&
+                std::get<1>(keys.back()) == std::get<1>(k)) {
+                keys.back() = k;
+            } else {
+                keys.push_back(k);
+            }
+        }
+    }
+    for (const auto& bmk : keys) {
+        update_agg_cache(bmk);
+    }
+}
+
+void DeleteBitmap::update_agg_cache(const BitmapKey& bmk) const {
+    if (!config::enable_mow_get_agg_by_cache || !config::enable_mow_update_agg_cache_on_commit) {
+        return;
+    }
+    Version cache_version = _get_rowset_cache_version(bmk);
+    if (cache_version >= std::get<2>(bmk)) {
+        return;
+    }
+    auto* cache = DeleteBitmapAggCache::instance();
+    auto* val = new DeleteBitmapAggCache::Value();
+    Version start_version = 0;
+    if (cache_version > 0) {
+        Cache::Handle* handle = cache->lookup(
+                agg_cache_key(_tablet_id, {std::get<0>(bmk), std::get<1>(bmk), cache_version}));
+        if (handle != nullptr) {
+            val->bitmap =
+                    reinterpret_cast<DeleteBitmapAggCache::Value*>(cache->value(handle))->bitmap;
+            cache->release(handle);
+            start_version = cache_version + 1;
+        }
+    }
+    {
+        std::shared_lock l(lock);
+        DeleteBitmap::BitmapKey start {std::get<0>(bmk), std::get<1>(bmk), start_version};
+        for (auto it = delete_bitmap.lower_bound(start); it != delete_bitmap.end(); ++it) {
+            auto& [k, bm] = *it;
+            if (std::get<0>(k) != std::get<0>(bmk) || std::get<1>(k) != std::get<1>(bmk) ||
+                std::get<2>(k) > std::get<2>(bmk)) {
+                break;
+            }
+            val->bitmap |= bm;
+        }
+    }
+    bool is_empty = val->bitmap.isEmpty();
+    size_t charge = val->bitmap.getSizeInBytes() + sizeof(DeleteBitmapAggCache::Value);
+    std::string key_str = agg_cache_key(_tablet_id, bmk);
+    cache->release(cache->insert(CacheKey(key_str), val, charge, charge, CachePriority::NORMAL));
+    if (!is_empty) {
+        std::lock_guard l(_rowset_cache_version_lock);
+        _rowset_cache_version[std::get<0>(bmk)][std::get<1>(bmk)] = std::get<2>(bmk);
+        VLOG_DEBUG << "update agg cache version=" << std::get<2>(bmk)
+                   << " for tablet=" << _tablet_id << ", rowset=" << std::get<0>(bmk).to_string()
+                   << ", segment=" << std::get<1>(bmk);
+    }
+}
+
 std::shared_ptr<roaring::Roaring> DeleteBitmap::get_agg_without_cache(
         const BitmapKey& bmk, const int64_t start_version) const {
     std::shared_ptr<roaring::Roaring> bitmap = std::make_shared<roaring::Roaring>();
@@ -563,6 +563,14 @@ public:
     std::shared_ptr<roaring::Roaring> get_agg_without_cache(const BitmapKey& bmk,
                                                             const int64_t start_version = 0) const;
 
+    /**
+     * Updates the aggregation cache of the segments in `delta` to the max version of
+     * their bitmaps in `delta`, which must have been merged into *this. The cached
+     * aggregation of an older version is extended, so a commit costs what it adds.
+     */
+    void update_agg_cache(const DeleteBitmap& delta) const;
+    void update_agg_cache(const BitmapKey& bmk) const;
+
     void remove_sentinel_marks();
 
     uint64_t get_delete_bitmap_count();
@@ -581,6 +589,9 @@ public:
 
 private:
     DeleteBitmap::Version _get_rowset_cache_version(const BitmapKey& bmk) const;
+    // Returns true if there is a bitmap of the segment in bmk with a version in
+    // (start_version, version of bmk]
+    bool _has_bitmap_after(const BitmapKey& bmk, Version start_version) const;
 
     int64_t _tablet_id;
     mutable std::shared_mutex _rowset_cache_version_lock;
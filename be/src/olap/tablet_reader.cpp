@@ -233,9 +233,19 @@ Status TabletReader::_capture_rs_readers(const ReaderParams& read_params) {
     _reader_context.tablet_schema = _tablet_schema;
     _reader_context.need_ordered_result = need_ordered_result;
     _reader_context.topn_filter_source_node_ids = read_params.topn_filter_source_node_ids;
+    _reader_context.late_arrival_predicates = read_params.late_arrival_predicates;
     _reader_context.topn_filter_target_node_id = read_params.topn_filter_target_node_id;
     _reader_context.read_orderby_key_reverse = read_params.read_orderby_key_reverse;
     _reader_context.read_orderby_key_limit = read_params.read_orderby_key_limit;
+    // The rowsets are sampled independently of each other, so a key whose versions are merged
+    // across rowsets may lose its newest version. Only sample when every row stands alone.
+    if (read_params.reader_type == ReaderType::READER_QUERY &&
+        (_tablet_schema->keys_type() == DUP_KEYS ||
+         (_tablet_schema->keys_type() == UNIQUE_KEYS &&
+          _tablet->enable_unique_key_merge_on_write()))) {
+        _reader_context.sample_rate = read_params.sample_rate;
+        _reader_context.sample_seed = read_params.sample_seed;
+    }
     _reader_context.filter_block_conjuncts = read_params.filter_block_conjuncts;
     _reader_context.return_columns = &_return_columns;
     _reader_context.read_orderby_key_columns =
@@ -170,6 +170,8 @@ public:
         RowIdConversion* rowid_conversion = nullptr;
         std::vector<int> topn_filter_source_node_ids;
         int topn_filter_target_node_id = -1;
+        // predicates of runtime filters arrived after the reader is created
+        LateArrivalPredicatesSPtr late_arrival_predicates;
         // used for special optimization for query : ORDER BY key LIMIT n
         bool read_orderby_key = false;
         // used for special optimization for query : ORDER BY key DESC LIMIT n
@@ -178,6 +180,9 @@ public:
         size_t read_orderby_key_num_prefix_columns = 0;
         // limit of rows for read_orderby_key
         size_t read_orderby_key_limit = 0;
+        // approximate query: the fraction of the rows to read and the seed of the sampling
+        double sample_rate = 1;
+        uint64_t sample_seed = 0;
         // filter_block arguments
         vectorized::VExprContextSPtrs filter_block_conjuncts;
 
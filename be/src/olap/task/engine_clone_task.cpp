@@ -29,6 +29,7 @@
 #include <gen_cpp/Types_constants.h>
 #include <sys/stat.h>
 
+#include <algorithm>
 #include <filesystem>
 #include <memory>
 #include <mutex>
@@ -66,6 +67,7 @@
 #include "util/network_util.h"
 #include "util/security.h"
 #include "util/stopwatch.hpp"
+#include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
 #include "util/trace.h"
 
@@ -677,8 +679,10 @@ Status EngineCloneTask::_batch_download_files(DataDir* data_dir, const std::stri
 
     size_t total_file_size = 0;
     size_t total_files = file_info_list.size();
-    std::vector<std::pair<std::string, size_t>> batch_files;
+    std::vector<std::vector<std::pair<std::string, size_t>>> batches;
+    std::vector<size_t> batch_sizes;
     for (size_t i = 0; i < total_files;) {
+        std::vector<std::pair<std::string, size_t>> batch_files;
         size_t batch_file_size = 0;
         for (size_t j = i; j < total_files; j++) {
             // Split batchs by file number and file size,
@@ -690,19 +694,70 @@ Status EngineCloneTask::_batch_download_files(DataDir* data_dir, const std::stri
             batch_files.push_back(file_info_list[j]);
             batch_file_size += file_info_list[j].second;
         }
+        i += batch_files.size();
+        batches.push_back(std::move(batch_files));
+        batch_sizes.push_back(batch_file_size);
+    }
 
+    // All batches except the last one (the .hdr file) can be downloaded concurrently
+    const int parallelism = config::clone_download_batch_parallelism;
+    if (parallelism > 1 && batches.size() > 2) {
+        size_t data_file_size = 0;
+        for (size_t i = 0; i + 1 < batches.size(); ++i) {
+            data_file_size += batch_sizes[i];
+        }
         // check disk capacity
-        if (data_dir->reach_capacity_limit(batch_file_size)) {
+        if (data_dir->reach_capacity_limit(data_file_size)) {
             return Status::Error<EXCEEDED_LIMIT>(
                     "reach the capacity limit of path {}, file_size={}", data_dir->path(),
-                    batch_file_size);
+                    data_file_size);
         }
 
-        RETURN_IF_ERROR(download_files_v2(address, token, remote_dir, local_dir, batch_files));
+        std::unique_ptr<ThreadPool> pool;
+        RETURN_IF_ERROR(ThreadPoolBuilder("clone_download")
+                                .set_min_threads(1)
+                                .set_max_threads(std::min<int>(parallelism, batches.size() - 1))
+                                .build(&pool));
+        std::mutex result_mtx;
+        Status result;
+        for (size_t i = 0; i + 1 < batches.size(); ++i) {
+            auto st = pool->submit_func([&, i] {
+                SCOPED_INIT_THREAD_CONTEXT();
+                {
+                    std::lock_guard lock(result_mtx);
+                    if (!result.ok()) { // Some batch has failed
+                        return;
+                    }
+                }
+                auto st = download_files_v2(address, token, remote_dir, local_dir, batches[i]);
+                if (!st.ok()) {
+                    std::lock_guard lock(result_mtx);
+                    result = std::move(st);
+                }
+            });
+            if (!st.ok()) {
+                pool->wait();
+                return st;
+            }
+        }
+        pool->wait();
+        RETURN_IF_ERROR(result);
+        total_file_size += data_file_size;
+        batches.erase(batches.begin(), batches.end() - 1);
+        batch_sizes.erase(batch_sizes.begin(), batch_sizes.end() - 1);
+    }
 
-        total_file_size += batch_file_size;
-        i += batch_files.size();
-        batch_files.clear();
+    for (size_t i = 0; i < batches.size(); ++i) {
+        // check disk capacity
+        if (data_dir->reach_capacity_limit(batch_sizes[i])) {
+            return Status::Error<EXCEEDED_LIMIT>(
+                    "reach the capacity limit of path {}, file_size={}", data_dir->path(),
+                    batch_sizes[i]);
+        }
+
+        RETURN_IF_ERROR(download_files_v2(address, token, remote_dir, local_dir, batches[i]));
+
+        total_file_size += batch_sizes[i];
     }
 
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
@@ -22,6 +22,7 @@
 #include <util/defer_op.h>
 // IWYU pragma: no_include <bits/chrono.h>
 #include <chrono> // IWYU pragma: keep
+#include <iterator>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -496,30 +497,54 @@ void TabletPublishTxnTask::handle() {
 }
 
 void AsyncTabletPublishTask::handle() {
-    std::shared_lock migration_rlock(_tablet->get_migration_lock(), std::chrono::seconds(5));
-    SCOPED_ATTACH_TASK(_mem_tracker);
-    if (!migration_rlock.owns_lock()) {
-        LOG(WARNING) << "failed to publish version. tablet_id=" << _tablet->tablet_id()
-                     << ", txn_id=" << _transaction_id << ", got migration_rlock failed";
-        return;
+    auto failed = _versions.begin();
+    {
+        std::shared_lock migration_rlock(_tablet->get_migration_lock(), std::chrono::seconds(5));
+        SCOPED_ATTACH_TASK(_mem_tracker);
+        if (!migration_rlock.owns_lock()) {
+            LOG(WARNING) << "failed to publish version. tablet_id=" << _tablet->tablet_id()
+                         << ", txn_id=" << failed->second.first
+                         << ", got migration_rlock failed";
+        } else {
+            std::lock_guard<std::mutex> wrlock(_tablet->get_rowset_update_lock());
+            _stats.schedule_time_us = MonotonicMicros() - _stats.submit_time_us;
+            while (failed != _versions.end() &&
+                   _publish(failed->first, failed->second.first, failed->second.second)) {
+                ++failed;
+            }
+        }
     }
-    std::lock_guard<std::mutex> wrlock(_tablet->get_rowset_update_lock());
-    _stats.schedule_time_us = MonotonicMicros() - _stats.submit_time_us;
+    // The versions after a failed one are not continuous either, queue them again. The failed
+    // one is dropped as it was before the batching, FE retries the publish of its txn.
+    if (failed != _versions.end()) {
+        for (auto it = std::next(failed); it != _versions.end(); ++it) {
+            _engine.add_async_publish_task(it->second.second, _tablet->tablet_id(), it->first,
+                                           it->second.first, false);
+        }
+    }
+}
+
+bool AsyncTabletPublishTask::_publish(int64_t version, int64_t transaction_id,
+                                      int64_t partition_id) {
+    // the times of the versions published before in the batch are not part of this one
+    _stats = TabletPublishStatistics {.submit_time_us = _stats.submit_time_us,
+                                      .schedule_time_us = _stats.schedule_time_us};
     std::map<TabletInfo, RowsetSharedPtr> tablet_related_rs;
-    _engine.txn_manager()->get_txn_related_tablets(_transaction_id, _partition_id,
+    _engine.txn_manager()->get_txn_related_tablets(transaction_id, partition_id,
                                                    &tablet_related_rs);
     auto iter = tablet_related_rs.find(TabletInfo(_tablet->tablet_id(), _tablet->tablet_uid()));
     if (iter == tablet_related_rs.end()) {
-        return;
+        return false;
     }
     RowsetSharedPtr rowset = iter->second;
-    Version version(_version, _version);
+    Version publish_version(version, version);
 
-    auto publish_status = publish_version_and_add_rowset(_engine, _partition_id, _tablet, rowset,
-                                                         _transaction_id, version, nullptr, _stats);
+    auto publish_status = publish_version_and_add_rowset(
+            _engine, partition_id, _tablet, rowset, transaction_id, publish_version, nullptr,
+            _stats);
 
     if (!publish_status.ok()) {
-        return;
+        return false;
     }
 
     int64_t cost_us = MonotonicMicros() - _stats.submit_time_us;
@@ -527,10 +552,11 @@ void AsyncTabletPublishTask::handle() {
     g_tablet_publish_latency << cost_us;
     _stats.record_in_bvar();
     LOG(INFO) << "async publish version successfully on tablet, table_id=" << _tablet->table_id()
-              << ", tablet=" << _tablet->tablet_id() << ", transaction_id=" << _transaction_id
-              << ", version=" << _version << ", num_rows=" << rowset->num_rows()
+              << ", tablet=" << _tablet->tablet_id() << ", transaction_id=" << transaction_id
+              << ", version=" << version << ", num_rows=" << rowset->num_rows()
               << ", res=" << publish_status << ", cost: " << cost_us << "(us) "
               << (cost_us > 500 * 1000 ? _stats.to_string() : "");
+    return true;
 }
 
 } // namespace doris
@@ -114,15 +114,17 @@ private:
             nullptr;
 };
 
+// Publishes a run of consecutive versions of a tablet that were not continuous when their txns
+// were published, one after another under a single hold of the locks of the tablet.
 class AsyncTabletPublishTask {
 public:
-    AsyncTabletPublishTask(StorageEngine& engine, TabletSharedPtr tablet, int64_t partition_id,
-                           int64_t transaction_id, int64_t version)
+    // version -> (transaction id, partition id)
+    using Versions = std::map<int64_t, std::pair<int64_t, int64_t>>;
+
+    AsyncTabletPublishTask(StorageEngine& engine, TabletSharedPtr tablet, Versions versions)
             : _engine(engine),
               _tablet(std::move(tablet)),
-              _partition_id(partition_id),
-              _transaction_id(transaction_id),
-              _version(version),
+              _versions(std::move(versions)),
               _mem_tracker(MemTrackerLimiter::create_shared(MemTrackerLimiter::Type::OTHER,
                                                             "AsyncTabletPublishTask")) {
         _stats.submit_time_us = MonotonicMicros();
@@ -132,11 +134,11 @@ public:
     void handle();
 
 private:
+    bool _publish(int64_t version, int64_t transaction_id, int64_t partition_id);
+
     StorageEngine& _engine;
     TabletSharedPtr _tablet;
-    int64_t _partition_id;
-    int64_t _transaction_id;
-    int64_t _version;
+    Versions _versions;
     TabletPublishStatistics _stats;
     std::shared_ptr<MemTrackerLimiter> _mem_tracker;
 };
@@ -30,7 +30,11 @@
 #include "olap/segment_loader.h"
 #include "olap/storage_engine.h"
 #include "olap/tablet_schema.h"
+#include "runtime/thread_context.h"
 #include "util/debug_points.h"
+#include "util/doris_metrics.h"
+#include "util/stopwatch.hpp"
+#include "util/threadpool.h"
 #include "util/trace.h"
 
 namespace doris {
@@ -475,6 +479,9 @@ Status IndexBuilder::handle_single_rowset(RowsetMetaSharedPtr output_rowset_meta
                 return Status::Error<ErrorCode::ROWSET_READER_INIT>(res.to_string());
             }
 
+            MonotonicStopWatch segment_watch;
+            segment_watch.start();
+            int64_t segment_rows = 0;
             auto block = vectorized::Block::create_unique(
                     output_rowset_schema->create_block(return_columns));
             while (true) {
@@ -506,26 +513,47 @@ Status IndexBuilder::handle_single_rowset(RowsetMetaSharedPtr output_rowset_meta
                     return Status::Error<ErrorCode::SCHEMA_CHANGE_INFO_INVALID>(
                             "failed to write block.");
                 }
+                segment_rows += block->rows();
+                DorisMetrics::instance()->alter_inverted_index_rows_total->increment(
+                        block->rows());
                 block->clear_column_data();
             }
 
             // finish write inverted index, flush data to compound file
+            std::vector<std::function<Status()>> finish_tasks;
             for (auto& writer_sign : inverted_index_writer_signs) {
-                try {
-                    if (_inverted_index_builders[writer_sign]) {
-                        RETURN_IF_ERROR(_inverted_index_builders[writer_sign]->finish());
-                    }
-                    DBUG_EXECUTE_IF("IndexBuilder::handle_single_rowset_index_build_finish_error", {
-                        _CLTHROWA(CL_ERR_IO,
-                                  "debug point: handle_single_rowset_index_build_finish_error");
-                    })
-                } catch (const std::exception& e) {
-                    return Status::Error<ErrorCode::INVERTED_INDEX_CLUCENE_ERROR>(
-                            "CLuceneError occured: {}", e.what());
+                auto* builder = _inverted_index_builders[writer_sign].get();
+                if (builder == nullptr) {
+                    continue;
                 }
+                finish_tasks.emplace_back([builder]() -> Status {
+                    try {
+                        RETURN_IF_ERROR(builder->finish());
+                        DBUG_EXECUTE_IF(
+                                "IndexBuilder::handle_single_rowset_index_build_finish_error", {
+                                    _CLTHROWA(CL_ERR_IO,
+                                              "debug point: "
+                                              "handle_single_rowset_index_build_finish_error");
+                                })
+                    } catch (const std::exception& e) {
+                        return Status::Error<ErrorCode::INVERTED_INDEX_CLUCENE_ERROR>(
+                                "CLuceneError occured: {}", e.what());
+                    }
+                    return Status::OK();
+                });
             }
+            RETURN_IF_ERROR(_run_index_build_tasks(finish_tasks));
 
             _olap_data_convertor->reset();
+            _num_built_segments++;
+            _num_built_rows += segment_rows;
+            LOG(INFO) << "finish building inverted index of segment, tablet="
+                      << _tablet->tablet_id()
+                      << ", rowset=" << output_rowset_meta->rowset_id().to_string()
+                      << ", segment=" << seg_ptr->id() << ", indexes=" << finish_tasks.size()
+                      << ", rows=" << segment_rows
+                      << ", cost=" << segment_watch.elapsed_time() / 1000000 << "ms"
+                      << ", progress=" << _num_built_segments << "/" << _num_segments_to_build;
         }
         for (auto&& [seg_id, index_file_writer] : _index_file_writers) {
             auto st = index_file_writer->close();
@@ -557,6 +585,8 @@ Status IndexBuilder::_write_inverted_index_data(TabletSchemaSPtr tablet_schema,
     VLOG_DEBUG << "begin to write inverted index";
     // converter block data
     _olap_data_convertor->set_source_content(block, 0, block->rows());
+    // every index has its own convertor and column writer, so they are written in parallel
+    std::vector<std::function<Status()>> tasks;
     for (auto i = 0; i < _alter_inverted_indexes.size(); ++i) {
         auto inverted_index = _alter_inverted_indexes[i];
         auto index_id = inverted_index.index_id;
@@ -576,32 +606,63 @@ Status IndexBuilder::_write_inverted_index_data(TabletSchemaSPtr tablet_schema,
                 continue;
             }
         }
-        auto column = tablet_schema->column(column_idx);
+        const auto* column = &tablet_schema->column(column_idx);
         auto writer_sign = std::make_pair(segment_idx, index_id);
-        std::unique_ptr<Field> field(FieldFactory::create(column));
-        auto converted_result = _olap_data_convertor->convert_column_data(i);
-        DBUG_EXECUTE_IF("IndexBuilder::_write_inverted_index_data_convert_column_data_error", {
-            converted_result.first = Status::Error<ErrorCode::INTERNAL_ERROR>(
-                    "debug point: _write_inverted_index_data_convert_column_data_error");
-        })
-        if (converted_result.first != Status::OK()) {
-            LOG(WARNING) << "failed to convert block, errcode: " << converted_result.first;
-            return converted_result.first;
-        }
-        const auto* ptr = (const uint8_t*)converted_result.second->get_data();
-        const auto* null_map = converted_result.second->get_nullmap();
-        if (null_map) {
-            RETURN_IF_ERROR(_add_nullable(column_name, writer_sign, field.get(), null_map, &ptr,
-                                          block->rows()));
-        } else {
-            RETURN_IF_ERROR(_add_data(column_name, writer_sign, field.get(), &ptr, block->rows()));
-        }
+        tasks.emplace_back([this, i, column, column_name, writer_sign, block]() -> Status {
+            std::unique_ptr<Field> field(FieldFactory::create(*column));
+            auto converted_result = _olap_data_convertor->convert_column_data(i);
+            DBUG_EXECUTE_IF("IndexBuilder::_write_inverted_index_data_convert_column_data_error", {
+                converted_result.first = Status::Error<ErrorCode::INTERNAL_ERROR>(
+                        "debug point: _write_inverted_index_data_convert_column_data_error");
+            })
+            if (converted_result.first != Status::OK()) {
+                LOG(WARNING) << "failed to convert block, errcode: " << converted_result.first;
+                return converted_result.first;
+            }
+            const auto* ptr = (const uint8_t*)converted_result.second->get_data();
+            const auto* null_map = converted_result.second->get_nullmap();
+            if (null_map) {
+                return _add_nullable(column_name, writer_sign, field.get(), null_map, &ptr,
+                                     block->rows());
+            }
+            return _add_data(column_name, writer_sign, field.get(), &ptr, block->rows());
+        });
     }
+    RETURN_IF_ERROR(_run_index_build_tasks(tasks));
     _olap_data_convertor->clear_source_content();
 
     return Status::OK();
 }
 
+Status IndexBuilder::_run_index_build_tasks(const std::vector<std::function<Status()>>& tasks) {
+    auto* thread_pool = _engine.index_build_thread_pool();
+    if (thread_pool == nullptr || tasks.size() <= 1) {
+        for (const auto& task : tasks) {
+            RETURN_IF_ERROR(task());
+        }
+        return Status::OK();
+    }
+
+    std::vector<Status> statuses(tasks.size());
+    auto resource_ctx = thread_context()->resource_ctx();
+    auto token = thread_pool->new_token(ThreadPool::ExecutionMode::CONCURRENT);
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        auto st = token->submit_func([&tasks, &statuses, resource_ctx, i]() {
+            SCOPED_ATTACH_TASK(resource_ctx);
+            statuses[i] = tasks[i]();
+        });
+        if (!st.ok()) {
+            // the pool is shutting down or full, build this index in the current thread
+            statuses[i] = tasks[i]();
+        }
+    }
+    token->wait();
+    for (auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+    return Status::OK();
+}
+
 Status IndexBuilder::_add_nullable(const std::string& column_name,
                                    const std::pair<int64_t, int64_t>& index_writer_sign,
                                    Field* field, const uint8_t* null_map, const uint8_t** ptr,
@@ -617,14 +678,14 @@ Status IndexBuilder::_add_nullable(const std::string& column_name,
         try {
             auto data = *(data_ptr + 2);
             auto nested_null_map = *(data_ptr + 3);
-            RETURN_IF_ERROR(_inverted_index_builders[index_writer_sign]->add_array_values(
+            RETURN_IF_ERROR(_inverted_index_builders.at(index_writer_sign)->add_array_values(
                     field->get_sub_field(0)->size(), reinterpret_cast<const void*>(data),
                     reinterpret_cast<const uint8_t*>(nested_null_map), offsets_ptr, num_rows));
             DBUG_EXECUTE_IF("IndexBuilder::_add_nullable_add_array_values_error", {
                 _CLTHROWA(CL_ERR_IO, "debug point: _add_nullable_add_array_values_error");
             })
-            RETURN_IF_ERROR(_inverted_index_builders[index_writer_sign]->add_array_nulls(null_map,
-                                                                                         num_rows));
+            RETURN_IF_ERROR(_inverted_index_builders.at(index_writer_sign)
+                                    ->add_array_nulls(null_map, num_rows));
         } catch (const std::exception& e) {
             return Status::Error<ErrorCode::INVERTED_INDEX_CLUCENE_ERROR>(
                     "CLuceneError occured: {}", e.what());
@@ -648,9 +709,9 @@ Status IndexBuilder::_add_nullable(const std::string& column_name,
         do {
             auto step = next_run_step();
             if (null_map[offset]) {
-                RETURN_IF_ERROR(_inverted_index_builders[index_writer_sign]->add_nulls(step));
+                RETURN_IF_ERROR(_inverted_index_builders.at(index_writer_sign)->add_nulls(step));
             } else {
-                RETURN_IF_ERROR(_inverted_index_builders[index_writer_sign]->add_values(
+                RETURN_IF_ERROR(_inverted_index_builders.at(index_writer_sign)->add_values(
                         column_name, *ptr, step));
             }
             *ptr += field->size() * step;
@@ -681,12 +742,12 @@ Status IndexBuilder::_add_data(const std::string& column_name,
             if (element_cnt > 0) {
                 auto data = *(data_ptr + 2);
                 auto nested_null_map = *(data_ptr + 3);
-                RETURN_IF_ERROR(_inverted_index_builders[index_writer_sign]->add_array_values(
+                RETURN_IF_ERROR(_inverted_index_builders.at(index_writer_sign)->add_array_values(
                         field->get_sub_field(0)->size(), reinterpret_cast<const void*>(data),
                         reinterpret_cast<const uint8_t*>(nested_null_map), offsets_ptr, num_rows));
             }
         } else {
-            RETURN_IF_ERROR(_inverted_index_builders[index_writer_sign]->add_values(
+            RETURN_IF_ERROR(_inverted_index_builders.at(index_writer_sign)->add_values(
                     column_name, *ptr, num_rows));
         }
         DBUG_EXECUTE_IF("IndexBuilder::_add_data_throw_exception",
@@ -702,6 +763,10 @@ Status IndexBuilder::_add_data(const std::string& column_name,
 Status IndexBuilder::handle_inverted_index_data() {
     LOG(INFO) << "begin to handle_inverted_index_data";
     DCHECK(_input_rowsets.size() == _output_rowsets.size());
+    _num_segments_to_build = 0;
+    for (auto& output_rowset : _output_rowsets) {
+        _num_segments_to_build += output_rowset->num_segments();
+    }
     for (auto& _output_rowset : _output_rowsets) {
         SegmentCacheHandle segment_cache_handle;
         RETURN_IF_ERROR(SegmentLoader::instance()->load_segments(
@@ -783,6 +848,8 @@ Status IndexBuilder::do_build_inverted_index() {
     }
 
     // create inverted index file for output rowset
+    MonotonicStopWatch watch;
+    watch.start();
     st = handle_inverted_index_data();
     if (!st.ok()) {
         LOG(WARNING) << "failed to handle_inverted_index_data. "
@@ -790,6 +857,13 @@ Status IndexBuilder::do_build_inverted_index() {
         gc_output_rowset();
         return st;
     }
+    if (!_is_drop_op) {
+        auto cost_ms = std::max<int64_t>(watch.elapsed_time() / 1000000, 1);
+        LOG(INFO) << "finish building inverted index, tablet=" << _tablet->tablet_id()
+                  << ", segments=" << _num_built_segments << ", rows=" << _num_built_rows
+                  << ", cost=" << cost_ms << "ms"
+                  << ", throughput=" << _num_built_rows * 1000 / cost_ms << " rows/s";
+    }
 
     // modify rowsets in memory
     st = modify_rowsets();
@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <functional>
+#include <vector>
+
 #include "olap/merger.h"
 #include "olap/olap_common.h"
 #include "olap/olap_define.h"
@@ -67,6 +70,9 @@ private:
     Status _add_nullable(const std::string& column_name,
                          const std::pair<int64_t, int64_t>& index_writer_sign, Field* field,
                          const uint8_t* null_map, const uint8_t** ptr, size_t num_rows);
+    // Run the tasks, each of which builds one index of a segment, on the index build thread
+    // pool if there is one, otherwise one by one. Return the first error.
+    Status _run_index_build_tasks(const std::vector<std::function<Status()>>& tasks);
 
 private:
     StorageEngine& _engine;
@@ -89,6 +95,10 @@ private:
     // <rowset_id, segment_id>
     std::unordered_map<std::pair<std::string, int64_t>, std::unique_ptr<IndexFileReader>>
             _index_file_readers;
+    // progress of the build, logged for each segment
+    int64_t _num_segments_to_build = 0;
+    int64_t _num_built_segments = 0;
+    int64_t _num_built_rows = 0;
 };
 
 using IndexBuilderSharedPtr = std::shared_ptr<IndexBuilder>;
@@ -73,6 +73,9 @@ void WalManager::stop() {
         if (_update_wal_dirs_info_thread) {
             _update_wal_dirs_info_thread->join();
         }
+        for (auto& wal_syncer : _wal_syncers) {
+            wal_syncer->stop();
+        }
         _thread_pool->shutdown();
         LOG(INFO) << "WalManager is stopped";
     }
@@ -82,6 +85,11 @@ Status WalManager::init() {
     RETURN_IF_ERROR(_init_wal_dirs_conf());
     RETURN_IF_ERROR(_init_wal_dirs());
     RETURN_IF_ERROR(_init_wal_dirs_info());
+    for (const auto& wal_dir : _wal_dirs) {
+        auto wal_syncer = std::make_unique<WalSyncer>(wal_dir);
+        RETURN_IF_ERROR(wal_syncer->start());
+        _wal_syncers.push_back(std::move(wal_syncer));
+    }
     return Thread::create(
             "WalMgr", "replay_wal", [this]() { static_cast<void>(this->_replay_background()); },
             &_replay_thread);
@@ -230,6 +238,17 @@ Status WalManager::create_wal_path(int64_t db_id, int64_t table_id, int64_t wal_
     return Status::OK();
 }
 
+WalSyncer* WalManager::get_wal_syncer(const std::string& wal_path) {
+    for (auto& wal_syncer : _wal_syncers) {
+        const auto& wal_dir = wal_syncer->wal_dir();
+        if (wal_path.size() > wal_dir.size() && wal_path.starts_with(wal_dir) &&
+            wal_path[wal_dir.size()] == '/') {
+            return wal_syncer.get();
+        }
+    }
+    return nullptr;
+}
+
 Status WalManager::get_wal_path(int64_t wal_id, std::string& wal_path) {
     std::shared_lock rdlock(_wal_path_lock);
     auto it = _wal_path_map.find(wal_id);
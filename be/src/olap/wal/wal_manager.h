@@ -35,6 +35,7 @@
 #include "gen_cpp/HeartbeatService_types.h"
 #include "olap/wal/wal_dirs_info.h"
 #include "olap/wal/wal_reader.h"
+#include "olap/wal/wal_syncer.h"
 #include "olap/wal/wal_table.h"
 #include "olap/wal/wal_writer.h"
 #include "runtime/exec_env.h"
@@ -100,6 +101,9 @@ public:
     Status notify_relay_wal(int64_t wal_id);
     static std::string get_base_wal_path(const std::string& wal_path_str);
 
+    // the syncer of the wal dir `wal_path` is in, nullptr if not found
+    WalSyncer* get_wal_syncer(const std::string& wal_path);
+
 private:
     // wal back pressure
     Status _init_wal_dirs_conf();
@@ -129,6 +133,7 @@ private:
     std::vector<std::string> _wal_dirs;
     scoped_refptr<Thread> _update_wal_dirs_info_thread;
     std::unique_ptr<WalDirsInfo> _wal_dirs_info;
+    std::vector<std::unique_ptr<WalSyncer>> _wal_syncers;
 
     // replay wal
     scoped_refptr<Thread> _replay_thread;
@@ -0,0 +1,115 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/wal/wal_syncer.h"
+
+#include <bvar/bvar.h>
+
+#include <unordered_map>
+
+#include "olap/wal/wal_writer.h"
+#include "util/time.h"
+
+namespace doris {
+
+bvar::Adder<int64_t> g_wal_sync_requests("wal_sync_requests");
+bvar::Adder<int64_t> g_wal_sync_groups("wal_sync_groups");
+bvar::LatencyRecorder g_wal_sync_latency_us("wal_sync_latency_us");
+
+WalSyncer::WalSyncer(std::string wal_dir) : _wal_dir(std::move(wal_dir)) {}
+
+WalSyncer::~WalSyncer() {
+    stop();
+}
+
+Status WalSyncer::start() {
+    return Thread::create(
+            "WalMgr", "sync_wal", [this]() { _sync_thread_callback(); }, &_sync_thread);
+}
+
+void WalSyncer::stop() {
+    {
+        std::lock_guard l(_lock);
+        if (_stopped) {
+            return;
+        }
+        _stopped = true;
+    }
+    _request_cv.notify_all();
+    if (_sync_thread) {
+        _sync_thread->join();
+    }
+}
+
+Status WalSyncer::sync(const std::shared_ptr<WalWriter>& wal_writer) {
+    g_wal_sync_requests << 1;
+    auto request = std::make_shared<SyncRequest>();
+    request->wal_writer = wal_writer;
+    std::unique_lock l(_lock);
+    if (_stopped || _sync_thread == nullptr) {
+        l.unlock();
+        return wal_writer->sync();
+    }
+    _requests.push_back(request);
+    _request_cv.notify_one();
+    _done_cv.wait(l, [&request]() { return request->done; });
+    return request->status;
+}
+
+void WalSyncer::_sync_thread_callback() {
+    std::vector<std::shared_ptr<SyncRequest>> group;
+    while (true) {
+        {
+            std::unique_lock l(_lock);
+            _request_cv.wait(l, [this]() { return _stopped || !_requests.empty(); });
+            if (_requests.empty()) {
+                return;
+            }
+            group.swap(_requests);
+        }
+        _sync_group(group);
+        {
+            std::lock_guard l(_lock);
+            for (auto& request : group) {
+                request->done = true;
+            }
+        }
+        _done_cv.notify_all();
+        group.clear();
+    }
+}
+
+void WalSyncer::_sync_group(std::vector<std::shared_ptr<SyncRequest>>& group) {
+    int64_t start_us = MonotonicMicros();
+    // the loads of a group commit queue write to the same wal
+    std::unordered_map<WalWriter*, Status> synced;
+    for (auto& request : group) {
+        auto it = synced.find(request->wal_writer.get());
+        if (it == synced.end()) {
+            it = synced.emplace(request->wal_writer.get(), request->wal_writer->sync()).first;
+            if (!it->second.ok()) {
+                LOG(WARNING) << "failed to sync wal " << request->wal_writer->file_name()
+                             << ", st=" << it->second;
+            }
+        }
+        request->status = it->second;
+    }
+    g_wal_sync_groups << 1;
+    g_wal_sync_latency_us << MonotonicMicros() - start_us;
+}
+
+} // namespace doris
@@ -0,0 +1,68 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "util/thread.h"
+
+namespace doris {
+
+class WalWriter;
+
+// Syncs the wals of a wal dir in groups. A load queues its wal after appending to it and waits,
+// the thread of the dir takes all the queued wals at once and syncs every one of them once, so
+// the loads appending to the wals of a dir while a sync is running share the next one.
+class WalSyncer {
+public:
+    explicit WalSyncer(std::string wal_dir);
+    ~WalSyncer();
+
+    Status start();
+    void stop();
+
+    // Return once the blocks appended to `wal_writer` before the call are durable.
+    Status sync(const std::shared_ptr<WalWriter>& wal_writer);
+
+    const std::string& wal_dir() const { return _wal_dir; }
+
+private:
+    struct SyncRequest {
+        std::shared_ptr<WalWriter> wal_writer;
+        Status status;
+        bool done = false;
+    };
+
+    void _sync_thread_callback();
+    void _sync_group(std::vector<std::shared_ptr<SyncRequest>>& group);
+
+    std::string _wal_dir;
+    std::mutex _lock;
+    std::condition_variable _request_cv;
+    std::condition_variable _done_cv;
+    std::vector<std::shared_ptr<SyncRequest>> _requests;
+    bool _stopped = false;
+    scoped_refptr<Thread> _sync_thread;
+};
+
+} // namespace doris
@@ -20,6 +20,7 @@
 #include "common/config.h"
 #include "io/fs/file_writer.h"
 #include "io/fs/local_file_system.h"
+#include "io/fs/local_file_writer.h"
 #include "io/fs/path.h"
 #include "olap/storage_engine.h"
 #include "olap/wal/wal_manager.h"
@@ -48,6 +49,7 @@ Status WalWriter::init() {
 }
 
 Status WalWriter::finalize() {
+    std::lock_guard l(_lock);
     if (!_file_writer) {
         return Status::InternalError("wal writer is null,fail to close file={}", _file_name);
     }
@@ -58,7 +60,20 @@ Status WalWriter::finalize() {
     return Status::OK();
 }
 
+Status WalWriter::sync() {
+    std::lock_guard l(_lock);
+    if (!_file_writer) {
+        return Status::InternalError("wal writer is null,fail to sync file={}", _file_name);
+    }
+    if (_file_writer->state() != io::FileWriter::State::OPENED) {
+        return Status::OK();
+    }
+    // a wal is always created on the local filesystem
+    return static_cast<io::LocalFileWriter*>(_file_writer.get())->sync_data();
+}
+
 Status WalWriter::append_blocks(const PBlockArray& blocks) {
+    std::lock_guard l(_lock);
     if (!_file_writer) {
         return Status::InternalError("wal writer is null,fail to write file={}", _file_name);
     }
@@ -91,6 +106,7 @@ Status WalWriter::append_blocks(const PBlockArray& blocks) {
 }
 
 Status WalWriter::append_header(std::string col_ids) {
+    std::lock_guard l(_lock);
     if (!_file_writer) {
         return Status::InternalError("wal writer is null,fail to write file={}", _file_name);
     }
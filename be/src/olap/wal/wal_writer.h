@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <mutex>
+
 #include "common/status.h"
 #include "gen_cpp/internal_service.pb.h"
 #include "io/fs/file_reader_writer_fwd.h"
@@ -37,6 +39,8 @@ public:
 
     Status append_blocks(const PBlockArray& blocks);
     Status append_header(std::string col_ids);
+    // Make the blocks appended so far durable, do nothing once the wal is finalized.
+    Status sync();
 
     std::string file_name() { return _file_name; };
 
@@ -47,6 +51,8 @@ public:
 
 private:
     std::string _file_name;
+    // the wal may be synced by the thread of a WalSyncer while being appended or finalized
+    std::mutex _lock;
     io::FileWriterPtr _file_writer;
 };
 
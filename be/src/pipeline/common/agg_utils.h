@@ -25,6 +25,7 @@
 #include "vec/common/hash_table/hash_map_util.h"
 #include "vec/common/hash_table/ph_hash_map.h"
 #include "vec/common/hash_table/string_hash_map.h"
+#include "vec/common/hash_table/two_level_ph_hash_map.h"
 
 namespace doris {
 
@@ -34,7 +35,7 @@ template <typename T>
 using AggDataNullable = vectorized::DataWithNullKey<AggData<T>>;
 
 using AggregatedDataWithoutKey = vectorized::AggregateDataPtr;
-using AggregatedDataWithStringKey = PHHashMap<StringRef, vectorized::AggregateDataPtr>;
+using AggregatedDataWithStringKey = TwoLevelPHHashMap<StringRef, vectorized::AggregateDataPtr>;
 using AggregatedDataWithShortStringKey = StringHashMap<vectorized::AggregateDataPtr>;
 
 using AggregatedDataWithUInt32KeyPhase2 =
@@ -17,6 +17,7 @@
 
 #include "dependency.h"
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 
@@ -148,38 +149,59 @@ bool RuntimeFilterTimer::should_be_check_timeout() {
 }
 
 void RuntimeFilterTimerQueue::start() {
+    // the timer is released by its consumer, or the runtime filter arrived in time
+    auto is_done = [](const std::shared_ptr<pipeline::RuntimeFilterTimer>& timer) {
+        return timer.use_count() == 1 ||
+               (!timer->force_wait_timeout() && !timer->_parent->is_blocked_by());
+    };
+    int64_t last_sweep_time = MonotonicMillis();
+    std::vector<std::shared_ptr<pipeline::RuntimeFilterTimer>> timeout_timers;
+    std::unique_lock<std::mutex> lc(_que_lock);
     while (!_stop) {
-        std::unique_lock<std::mutex> lk(cv_m);
+        for (auto it = _que.begin(); it != _que.end();) {
+            if (it->use_count() == 1) {
+                // `use_count == 1` means this runtime filter has been released
+                it = _que.erase(it);
+            } else if ((*it)->should_be_check_timeout()) {
+                auto deadline = (*it)->registration_time() + (*it)->wait_time_ms();
+                _deadlines.emplace(deadline, std::move(*it));
+                it = _que.erase(it);
+            } else {
+                ++it;
+            }
+        }
 
-        while (_que.empty() && !_stop) {
-            cv.wait_for(lk, std::chrono::seconds(3), [this] { return !_que.empty() || _stop; });
+        int64_t now = MonotonicMillis();
+        while (!_deadlines.empty() && _deadlines.begin()->first < now) {
+            auto timer = std::move(_deadlines.begin()->second);
+            _deadlines.erase(_deadlines.begin());
+            if (!is_done(timer)) {
+                timeout_timers.push_back(std::move(timer));
+            }
         }
-        if (_stop) {
-            break;
+        if (now - last_sweep_time >= sweep_interval) {
+            last_sweep_time = now;
+            std::erase_if(_deadlines, [&](const auto& item) { return is_done(item.second); });
         }
-        {
-            std::unique_lock<std::mutex> lc(_que_lock);
-            std::list<std::shared_ptr<pipeline::RuntimeFilterTimer>> new_que;
-            for (auto& it : _que) {
-                if (it.use_count() == 1) {
-                    // `use_count == 1` means this runtime filter has been released
-                } else if (it->should_be_check_timeout()) {
-                    if (it->force_wait_timeout() || it->_parent->is_blocked_by()) {
-                        // This means runtime filter is not ready, so we call timeout or continue to poll this timer.
-                        int64_t ms_since_registration = MonotonicMillis() - it->registration_time();
-                        if (ms_since_registration > it->wait_time_ms()) {
-                            it->call_timeout();
-                        } else {
-                            new_que.push_back(std::move(it));
-                        }
-                    }
-                } else {
-                    new_que.push_back(std::move(it));
-                }
+        if (!timeout_timers.empty()) {
+            // `call_timeout` wakes up the blocked tasks, do not block `push_filter_timer` meanwhile
+            lc.unlock();
+            for (auto& timer : timeout_timers) {
+                timer->call_timeout();
             }
-            new_que.swap(_que);
+            timeout_timers.clear();
+            lc.lock();
+            continue;
+        }
+
+        int64_t wait_ms = _que.empty() ? 3000 : interval;
+        if (!_deadlines.empty()) {
+            wait_ms = std::min(wait_ms, sweep_interval);
+            wait_ms = std::min(wait_ms, std::max<int64_t>(_deadlines.begin()->first - now + 1, 1));
         }
-        std::this_thread::sleep_for(std::chrono::milliseconds(interval));
+        _has_new_timer = false;
+        cv.wait_for(lc, std::chrono::milliseconds(wait_ms),
+                    [this] { return _has_new_timer || _stop; });
     }
     _shutdown = true;
 }
@@ -22,6 +22,7 @@
 
 #include <atomic>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -241,13 +242,20 @@ private:
     bool _force_wait_timeout;
 };
 
+// Timers whose waiting has started are kept ordered by deadline and the thread sleeps until the
+// earliest one, only the timers still waiting for local runtime filters are polled.
 struct RuntimeFilterTimerQueue {
     constexpr static int64_t interval = 10;
+    // How often the timers already ready or released are dropped before their deadline.
+    constexpr static int64_t sweep_interval = 1000;
     void run() { _thread.detach(); }
     void start();
 
     void stop() {
-        _stop = true;
+        {
+            std::unique_lock<std::mutex> lc(_que_lock);
+            _stop = true;
+        }
         cv.notify_all();
         wait_for_shutdown();
     }
@@ -263,16 +271,21 @@ struct RuntimeFilterTimerQueue {
     void push_filter_timer(std::vector<std::shared_ptr<pipeline::RuntimeFilterTimer>>&& filter) {
         std::unique_lock<std::mutex> lc(_que_lock);
         _que.insert(_que.end(), filter.begin(), filter.end());
+        _has_new_timer = true;
         cv.notify_all();
     }
 
     std::thread _thread;
     std::condition_variable cv;
-    std::mutex cv_m;
+    // protects `_que`, `_deadlines` and `_has_new_timer`
     std::mutex _que_lock;
     std::atomic_bool _stop = false;
     std::atomic_bool _shutdown = false;
+    bool _has_new_timer = false;
+    // Timers not started yet, because their local runtime filter dependencies are not ready.
     std::list<std::shared_ptr<pipeline::RuntimeFilterTimer>> _que;
+    // Started timers by deadline in ms.
+    std::multimap<int64_t, std::shared_ptr<pipeline::RuntimeFilterTimer>> _deadlines;
 };
 
 struct AggSharedState : public BasicSharedState {
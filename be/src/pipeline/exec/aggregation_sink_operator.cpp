@@ -564,10 +564,8 @@ void AggSinkLocalState::_emplace_into_hash_table(vectorized::AggregateDataPtr* p
                            };
 
                            SCOPED_TIMER(_hash_table_emplace_timer);
-                           for (size_t i = 0; i < num_rows; ++i) {
-                               places[i] = *agg_method.lazy_emplace(state, i, creator,
-                                                                    creator_for_null_key);
-                           }
+                           vectorized::lazy_emplace_batch(agg_method, state, num_rows, creator,
+                                                          creator_for_null_key, places);
 
                            COUNTER_UPDATE(_hash_table_input_counter, num_rows);
                        }},
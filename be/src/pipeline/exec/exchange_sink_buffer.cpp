@@ -100,11 +100,14 @@ ExchangeSinkBuffer::ExchangeSinkBuffer(PUniqueId query_id, PlanNodeId dest_node_
           _node_id(node_id),
           _state(state),
           _context(state->get_query_ctx()),
-          _exchange_sink_num(sender_ins_ids.size()),
-          _send_multi_blocks(state->query_options().__isset.exchange_multi_blocks_byte_size &&
-                             state->query_options().exchange_multi_blocks_byte_size > 0) {
-    if (_send_multi_blocks) {
+          _exchange_sink_num(sender_ins_ids.size()) {
+    if (state->query_options().__isset.exchange_multi_blocks_byte_size) {
+        _send_multi_blocks = state->query_options().exchange_multi_blocks_byte_size > 0;
         _send_multi_blocks_byte_size = state->query_options().exchange_multi_blocks_byte_size;
+    } else if (config::exchange_multi_blocks_byte_size > 0) {
+        // Queued small blocks of one channel are sent in one rpc instead of one rpc each.
+        _send_multi_blocks = true;
+        _send_multi_blocks_byte_size = config::exchange_multi_blocks_byte_size;
     }
 }
 
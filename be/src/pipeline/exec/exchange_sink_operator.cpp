@@ -555,6 +555,7 @@ Status ExchangeSinkLocalState::close(RuntimeState* state, Status exec_status) {
     SCOPED_TIMER(exec_time_counter());
     if (_partitioner) {
         RETURN_IF_ERROR(_partitioner->close(state));
+        _update_partition_skew_profile();
     }
     SCOPED_TIMER(_close_timer);
     if (_queue_dependency) {
@@ -573,6 +574,27 @@ Status ExchangeSinkLocalState::close(RuntimeState* state, Status exec_status) {
     return Base::close(state, exec_status);
 }
 
+void ExchangeSinkLocalState::_update_partition_skew_profile() {
+    if (channels.size() <= 1) {
+        return;
+    }
+    int64_t total_rows = 0;
+    int64_t max_rows = 0;
+    for (const auto& channel : channels) {
+        total_rows += channel->num_rows_added();
+        max_rows = std::max(max_rows, channel->num_rows_added());
+    }
+    if (total_rows == 0) {
+        return;
+    }
+    // 100 means the rows are spread evenly, channels.size() * 100 means all rows went to
+    // one channel, which is what a few hot partition keys look like.
+    auto* max_rows_counter = ADD_COUNTER(custom_profile(), "MaxChannelRows", TUnit::UNIT);
+    auto* skew_counter = ADD_COUNTER(custom_profile(), "ChannelRowsSkewPercent", TUnit::UNIT);
+    COUNTER_SET(max_rows_counter, max_rows);
+    COUNTER_SET(skew_counter, max_rows * 100 * cast_set<int64_t>(channels.size()) / total_rows);
+}
+
 std::shared_ptr<ExchangeSinkBuffer> ExchangeSinkOperatorX::_create_buffer(
         RuntimeState* state, const std::vector<InstanceLoId>& sender_ins_ids) {
     PUniqueId id;
@@ -116,6 +116,7 @@ private:
     friend class vectorized::BlockSerializer;
 
     MOCK_FUNCTION void _create_channels();
+    void _update_partition_skew_profile();
 
     std::shared_ptr<ExchangeSinkBuffer> _sink_buffer = nullptr;
     RuntimeProfile::Counter* _serialize_batch_timer = nullptr;
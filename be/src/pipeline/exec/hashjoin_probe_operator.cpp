@@ -286,7 +286,7 @@ Status HashJoinProbeOperatorX::pull(doris::RuntimeState* state, vectorized::Bloc
     RETURN_IF_ERROR(
             local_state.filter_data_and_build_output(state, output_block, eos, &temp_block));
     // Here make _join_block release the columns' ptr
-    local_state._join_block.set_columns(local_state._join_block.clone_empty_columns());
+    local_state._reset_join_block_columns(&temp_block);
     mutable_join_block.clear();
     return Status::OK();
 }
@@ -82,6 +82,28 @@ Status JoinProbeLocalState<SharedStateArg, Derived>::_build_output_block(
     return Status::OK();
 }
 
+template <typename SharedStateArg, typename Derived>
+void JoinProbeLocalState<SharedStateArg, Derived>::_reset_join_block_columns(
+        vectorized::Block* spare_block) {
+    // `spare_block` holds the columns the previous output handed back. When they still match the
+    // join block and nothing else references them, clear and reuse them so the next batch keeps
+    // their capacity; otherwise fall back to empty clones, `_join_block` may share its columns
+    // with the output.
+    bool reusable = spare_block->columns() == _join_block.columns();
+    for (size_t i = 0; reusable && i < _join_block.columns(); ++i) {
+        const auto& spare = spare_block->get_by_position(i);
+        reusable = spare.column && spare.column->is_exclusive() &&
+                   !is_column_const(*spare.column) &&
+                   spare.type->equals(*_join_block.get_by_position(i).type);
+    }
+    if (reusable) {
+        spare_block->clear_column_data();
+        _join_block.set_columns(spare_block->mutate_columns());
+    } else {
+        _join_block.set_columns(_join_block.clone_empty_columns());
+    }
+}
+
 template <typename LocalStateType>
 JoinProbeOperatorX<LocalStateType>::JoinProbeOperatorX(ObjectPool* pool, const TPlanNode& tnode,
                                                        int operator_id, const DescriptorTbl& descs)
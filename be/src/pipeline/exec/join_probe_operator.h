@@ -38,6 +38,8 @@ protected:
     ~JoinProbeLocalState() override = default;
     void _construct_mutable_join_block();
     Status _build_output_block(vectorized::Block* origin_block, vectorized::Block* output_block);
+    // Give `_join_block` fresh columns once its current ones were handed to the output.
+    void _reset_join_block_columns(vectorized::Block* spare_block);
     // output expr
     vectorized::Block _join_block;
 
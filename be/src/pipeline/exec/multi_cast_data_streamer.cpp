@@ -170,6 +170,9 @@ Status MultiCastDataStreamer::_copy_block(RuntimeState* state, int32_t sender_id
     if (multi_cast_block._un_finish_copy == 0) {
         DCHECK_EQ(_multi_cast_blocks.front()._un_finish_copy, 0);
         DCHECK_EQ(&(_multi_cast_blocks.front()), &multi_cast_block);
+        // the buffered bytes are what the slowest consumer has not read yet, so that the spill
+        // is only triggered by a consumer that lags behind
+        _cumulative_mem_size -= multi_cast_block._mem_size;
         _multi_cast_blocks.pop_front();
         _write_dependency->set_ready();
     } else if (copying_count == 0) {
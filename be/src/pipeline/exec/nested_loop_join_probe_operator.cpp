@@ -20,9 +20,12 @@
 #include <memory>
 
 #include "common/cast_set.h"
+#include "common/config.h"
 #include "common/exception.h"
 #include "pipeline/exec/operator.h"
+#include "vec/columns/column_const.h"
 #include "vec/columns/column_filter_helper.h"
+#include "vec/columns/column_nullable.h"
 #include "vec/core/block.h"
 
 namespace doris {
@@ -59,6 +62,10 @@ Status NestedLoopJoinProbeLocalState::open(RuntimeState* state) {
     for (size_t i = 0; i < _join_conjuncts.size(); i++) {
         RETURN_IF_ERROR(p._join_conjuncts[i]->clone(state, _join_conjuncts[i]));
     }
+    _filter_before_materialize = config::enable_nested_loop_join_filter_before_materialize &&
+                                 !_join_conjuncts.empty() && !p._is_mark_join &&
+                                 (p._join_op == TJoinOp::INNER_JOIN ||
+                                  p._join_op == TJoinOp::CROSS_JOIN);
     _construct_mutable_join_block();
     return Status::OK();
 }
@@ -104,7 +111,11 @@ Status NestedLoopJoinProbeLocalState::generate_join_block_data(RuntimeState* sta
         // We should try to join rows if there still are some rows from probe side.
         // _probe_offset_stack and _build_offset_stack use u16 for storage
         // because on the FE side, it is guaranteed that the batch size will not exceed 65535 (the maximum value for u16).s
-        while (_join_block.rows() < state->batch_size()) {
+        // the build rows joined with the probe rows in this call, it bounds the work of a call
+        // when the join conjuncts filter the pairs before they are added to _join_block
+        size_t joined_build_rows = 0;
+        while (_join_block.rows() < state->batch_size() &&
+               joined_build_rows < state->batch_size()) {
             while (_current_build_pos == _shared_state->build_blocks.size() ||
                    _left_block_pos == _child_block->rows()) {
                 // if left block is empty(), do not need disprocess the left block rows
@@ -137,6 +148,14 @@ Status NestedLoopJoinProbeLocalState::generate_join_block_data(RuntimeState* sta
             if constexpr (set_build_side_flag) {
                 _build_offset_stack.push(cast_set<uint16_t, size_t, false>(_join_block.rows()));
             }
+            if constexpr (!set_build_side_flag && !set_probe_side_flag) {
+                if (_filter_before_materialize) {
+                    RETURN_IF_ERROR(_process_left_child_block_with_join_conjuncts(
+                            _join_block, now_process_build_block));
+                    joined_build_rows += now_process_build_block.rows();
+                    continue;
+                }
+            }
             _process_left_child_block(_join_block, now_process_build_block);
         }
 
@@ -164,9 +183,12 @@ Status NestedLoopJoinProbeLocalState::generate_join_block_data(RuntimeState* sta
     }
 
     if constexpr (!set_probe_side_flag) {
-        RETURN_IF_ERROR((_do_filtering_and_update_visited_flags<set_build_side_flag,
-                                                                set_probe_side_flag, ignore_null>(
-                &_join_block, !p._is_right_semi_anti)));
+        if (!_filter_before_materialize) {
+            RETURN_IF_ERROR(
+                    (_do_filtering_and_update_visited_flags<set_build_side_flag,
+                                                            set_probe_side_flag, ignore_null>(
+                            &_join_block, !p._is_right_semi_anti)));
+        }
         _update_additional_flags(&_join_block);
     }
 
@@ -383,6 +405,70 @@ void NestedLoopJoinProbeLocalState::_process_left_child_block(
     block.set_columns(std::move(dst_columns));
 }
 
+Status NestedLoopJoinProbeLocalState::_process_left_child_block_with_join_conjuncts(
+        vectorized::Block& block, const vectorized::Block& now_process_build_block) {
+    auto& p = _parent->cast<NestedLoopJoinProbeOperatorX>();
+    const size_t build_rows = now_process_build_block.rows();
+    if (build_rows == 0) {
+        return Status::OK();
+    }
+
+    vectorized::Block filter_block;
+    vectorized::Columns probe_columns(p._num_probe_side_columns);
+    for (size_t i = 0; i < p._num_probe_side_columns; ++i) {
+        const auto& dst_column = block.get_by_position(i);
+        auto column = _child_block->get_by_position(i).column->cut(_left_block_pos, 1);
+        if (dst_column.type->is_nullable() && !column->is_nullable()) {
+            column = make_nullable(column);
+        }
+        probe_columns[i] = column;
+        filter_block.insert({vectorized::ColumnConst::create(column, build_rows), dst_column.type,
+                             dst_column.name});
+    }
+    for (size_t i = 0; i < p._num_build_side_columns; ++i) {
+        const auto& dst_column = block.get_by_position(p._num_probe_side_columns + i);
+        auto column = now_process_build_block.get_by_position(i).column;
+        if (dst_column.type->is_nullable() && !column->is_nullable()) {
+            column = make_nullable(column);
+        }
+        filter_block.insert({column, dst_column.type, dst_column.name});
+    }
+
+    vectorized::IColumn::Filter filter(build_rows, 1);
+    bool can_filter_all = false;
+    {
+        SCOPED_TIMER(_join_conjuncts_evaluation_timer);
+        RETURN_IF_ERROR(vectorized::VExprContext::execute_conjuncts(
+                _join_conjuncts, nullptr, false, &filter_block, &filter, &can_filter_all));
+    }
+    if (can_filter_all) {
+        return Status::OK();
+    }
+
+    SCOPED_TIMER(_filtered_by_join_conjuncts_timer);
+    std::vector<uint32_t> selector;
+    selector.reserve(build_rows);
+    for (uint32_t j = 0; j < build_rows; ++j) {
+        if (filter[j]) {
+            selector.push_back(j);
+        }
+    }
+    if (selector.empty()) {
+        return Status::OK();
+    }
+    auto dst_columns = block.mutate_columns();
+    for (size_t i = 0; i < p._num_probe_side_columns; ++i) {
+        dst_columns[i]->insert_many_from(*probe_columns[i], 0, selector.size());
+    }
+    for (size_t i = 0; i < p._num_build_side_columns; ++i) {
+        dst_columns[p._num_probe_side_columns + i]->insert_indices_from(
+                *filter_block.get_by_position(p._num_probe_side_columns + i).column,
+                selector.data(), selector.data() + selector.size());
+    }
+    block.set_columns(std::move(dst_columns));
+    return Status::OK();
+}
+
 NestedLoopJoinProbeOperatorX::NestedLoopJoinProbeOperatorX(ObjectPool* pool, const TPlanNode& tnode,
                                                            int operator_id,
                                                            const DescriptorTbl& descs)
@@ -60,6 +60,11 @@ private:
     void _append_left_data_with_null(vectorized::Block& block) const;
     void _process_left_child_block(vectorized::Block& block,
                                    const vectorized::Block& now_process_build_block) const;
+    // Joins the current probe row with `now_process_build_block` and appends the pairs that
+    // pass the join conjuncts to `block`. The conjuncts run on the build columns and the probe
+    // row as const columns, the pairs that do not match are never materialized.
+    Status _process_left_child_block_with_join_conjuncts(
+            vectorized::Block& block, const vectorized::Block& now_process_build_block);
     template <typename Filter, bool SetBuildSideFlag, bool SetProbeSideFlag>
     void _do_filtering_and_update_visited_flags_impl(vectorized::Block* block,
                                                      uint32_t column_to_keep,
@@ -190,6 +195,9 @@ private:
     std::stack<uint16_t> _probe_offset_stack;
     uint64_t _output_null_idx_build_side = 0;
     vectorized::VExprContextSPtrs _join_conjuncts;
+    // whether the join conjuncts are evaluated before materializing the joined rows, only for
+    // inner and cross joins, which need no visited flags
+    bool _filter_before_materialize = false;
 
     RuntimeProfile::Counter* _loop_join_timer = nullptr;
     RuntimeProfile::Counter* _output_temp_blocks_timer = nullptr;
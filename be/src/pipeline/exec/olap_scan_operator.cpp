@@ -125,6 +125,10 @@ Status OlapScanLocalState::_init_profile() {
             ADD_COUNTER(_segment_profile, "RowsVectorPredInput", TUnit::UNIT);
     _rows_short_circuit_cond_input_counter =
             ADD_COUNTER(_segment_profile, "RowsShortCircuitPredInput", TUnit::UNIT);
+    _staged_pred_column_read_rows_counter =
+            ADD_COUNTER(_segment_profile, "StagedPredicateColumnReadRows", TUnit::UNIT);
+    _staged_pred_column_skipped_rows_counter =
+            ADD_COUNTER(_segment_profile, "StagedPredicateColumnSkippedRows", TUnit::UNIT);
     _rows_expr_cond_input_counter = ADD_COUNTER(_segment_profile, "RowsExprPredInput", TUnit::UNIT);
     _vec_cond_timer = ADD_TIMER(_segment_profile, "VectorPredEvalTime");
     _short_cond_timer = ADD_TIMER(_segment_profile, "ShortPredEvalTime");
@@ -144,6 +148,8 @@ Status OlapScanLocalState::_init_profile() {
     _stats_filtered_counter = ADD_COUNTER(_segment_profile, "RowsStatsFiltered", TUnit::UNIT);
     _stats_rp_filtered_counter =
             ADD_COUNTER(_segment_profile, "RowsZoneMapRuntimePredicateFiltered", TUnit::UNIT);
+    _stats_late_rf_filtered_counter =
+            ADD_COUNTER(_segment_profile, "RowsZoneMapLateRuntimeFilterFiltered", TUnit::UNIT);
     _bf_filtered_counter = ADD_COUNTER(_segment_profile, "RowsBloomFilterFiltered", TUnit::UNIT);
     _dict_filtered_counter = ADD_COUNTER(_segment_profile, "RowsDictFiltered", TUnit::UNIT);
     _del_filtered_counter = ADD_COUNTER(_scanner_profile, "RowsDelFiltered", TUnit::UNIT);
@@ -151,12 +157,19 @@ Status OlapScanLocalState::_init_profile() {
             ADD_COUNTER(_segment_profile, "RowsConditionsFiltered", TUnit::UNIT);
     _key_range_filtered_counter =
             ADD_COUNTER(_segment_profile, "RowsKeyRangeFiltered", TUnit::UNIT);
+    _sample_filtered_counter = ADD_COUNTER(_segment_profile, "RowsSampleFiltered", TUnit::UNIT);
 
     _io_timer = ADD_TIMER(_segment_profile, "IOTimer");
     _decompressor_timer = ADD_TIMER(_segment_profile, "DecompressorTimer");
 
     _total_pages_num_counter = ADD_COUNTER(_segment_profile, "TotalPagesNum", TUnit::UNIT);
     _cached_pages_num_counter = ADD_COUNTER(_segment_profile, "CachedPagesNum", TUnit::UNIT);
+    _decoded_dict_page_cache_hit_counter =
+            ADD_COUNTER(_segment_profile, "DecodedDictPageCacheHit", TUnit::UNIT);
+    _remote_page_prefetch_ranges_counter =
+            ADD_COUNTER(_segment_profile, "RemotePagePrefetchRanges", TUnit::UNIT);
+    _remote_page_prefetch_bytes_counter =
+            ADD_COUNTER(_segment_profile, "RemotePagePrefetchBytes", TUnit::BYTES);
 
     _bitmap_index_filter_counter =
             ADD_COUNTER(_segment_profile, "RowsBitmapIndexFiltered", TUnit::UNIT);
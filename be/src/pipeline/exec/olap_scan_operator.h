@@ -115,6 +115,8 @@ private:
     RuntimeProfile::Counter* _rows_expr_cond_filtered_counter = nullptr;
     RuntimeProfile::Counter* _rows_vec_cond_input_counter = nullptr;
     RuntimeProfile::Counter* _rows_short_circuit_cond_input_counter = nullptr;
+    RuntimeProfile::Counter* _staged_pred_column_read_rows_counter = nullptr;
+    RuntimeProfile::Counter* _staged_pred_column_skipped_rows_counter = nullptr;
     RuntimeProfile::Counter* _rows_expr_cond_input_counter = nullptr;
     RuntimeProfile::Counter* _vec_cond_timer = nullptr;
     RuntimeProfile::Counter* _short_cond_timer = nullptr;
@@ -123,11 +125,13 @@ private:
 
     RuntimeProfile::Counter* _stats_filtered_counter = nullptr;
     RuntimeProfile::Counter* _stats_rp_filtered_counter = nullptr;
+    RuntimeProfile::Counter* _stats_late_rf_filtered_counter = nullptr;
     RuntimeProfile::Counter* _bf_filtered_counter = nullptr;
     RuntimeProfile::Counter* _dict_filtered_counter = nullptr;
     RuntimeProfile::Counter* _del_filtered_counter = nullptr;
     RuntimeProfile::Counter* _conditions_filtered_counter = nullptr;
     RuntimeProfile::Counter* _key_range_filtered_counter = nullptr;
+    RuntimeProfile::Counter* _sample_filtered_counter = nullptr;
 
     RuntimeProfile::Counter* _block_fetch_timer = nullptr;
     RuntimeProfile::Counter* _delete_bitmap_get_agg_timer = nullptr;
@@ -170,6 +174,10 @@ private:
     // page read from cache
     // used by segment v2
     RuntimeProfile::Counter* _cached_pages_num_counter = nullptr;
+    RuntimeProfile::Counter* _decoded_dict_page_cache_hit_counter = nullptr;
+    // merged data page reads prefetched from remote storage
+    RuntimeProfile::Counter* _remote_page_prefetch_ranges_counter = nullptr;
+    RuntimeProfile::Counter* _remote_page_prefetch_bytes_counter = nullptr;
 
     // row count filtered by bitmap inverted index
     RuntimeProfile::Counter* _bitmap_index_filter_counter = nullptr;
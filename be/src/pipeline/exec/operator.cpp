@@ -17,6 +17,10 @@
 
 #include "operator.h"
 
+#include <algorithm>
+#include <string>
+#include <unordered_set>
+
 #include "common/status.h"
 #include "pipeline/dependency.h"
 #include "pipeline/exec/aggregation_sink_operator.h"
@@ -224,6 +228,33 @@ Status OperatorXBase::init(const TPlanNode& tnode, RuntimeState* /*state*/) {
     return Status::OK();
 }
 
+// Functions that may return a different value on every call, so that two occurrences of them
+// must never share one result.
+static bool is_deterministic_expr(const vectorized::VExprSPtr& expr) {
+    static const std::unordered_set<std::string> non_deterministic_functions = {
+            "random", "rand", "uuid", "uuid_numeric", "random_bytes", "sleep"};
+    if (non_deterministic_functions.contains(expr->fn().name.function_name)) {
+        return false;
+    }
+    return std::all_of(expr->children().begin(), expr->children().end(), is_deterministic_expr);
+}
+
+void OperatorXBase::_init_projection_reuse_ids() {
+    _projection_reuse_ids.assign(_projections.size(), -1);
+    for (int i = 1; i < _projections.size(); i++) {
+        const auto& root = _projections[i]->root();
+        if (!is_deterministic_expr(root)) {
+            continue;
+        }
+        for (int j = 0; j < i; j++) {
+            if (_projection_reuse_ids[j] == -1 && root->equals(*_projections[j]->root())) {
+                _projection_reuse_ids[i] = j;
+                break;
+            }
+        }
+    }
+}
+
 Status OperatorXBase::prepare(RuntimeState* state) {
     for (auto& conjunct : _conjuncts) {
         RETURN_IF_ERROR(conjunct->prepare(state, intermediate_row_desc()));
@@ -233,6 +264,7 @@ Status OperatorXBase::prepare(RuntimeState* state) {
                                                    intermediate_row_desc(i)));
     }
     RETURN_IF_ERROR(vectorized::VExpr::prepare(_projections, state, projections_row_desc()));
+    _init_projection_reuse_ids();
 
     if (has_output_row_desc()) {
         RETURN_IF_ERROR(
@@ -338,9 +370,18 @@ Status OperatorXBase::do_projections(RuntimeState* state, vectorized::Block* ori
         auto& mutable_columns = mutable_block.mutable_columns();
         const size_t origin_columns_count = input_block.columns();
         DCHECK_EQ(mutable_columns.size(), local_state->_projections.size()) << debug_string();
+        std::vector<int> projection_column_ids(mutable_columns.size(), -1);
         for (int i = 0; i < mutable_columns.size(); ++i) {
             auto result_column_id = -1;
-            RETURN_IF_ERROR(local_state->_projections[i]->execute(&input_block, &result_column_id));
+            if (const int reuse_id = _projection_reuse_ids[i]; reuse_id != -1) {
+                // an identical expr was already evaluated on this block
+                result_column_id = projection_column_ids[reuse_id];
+                COUNTER_UPDATE(local_state->_projection_reused_exprs_counter, 1);
+            } else {
+                RETURN_IF_ERROR(
+                        local_state->_projections[i]->execute(&input_block, &result_column_id));
+            }
+            projection_column_ids[i] = result_column_id;
             auto column_ptr = input_block.get_by_position(result_column_id)
                                       .column->convert_to_full_column_if_const();
             if (result_column_id >= origin_columns_count) {
@@ -543,6 +584,8 @@ Status PipelineXLocalState<SharedStateArg>::init(RuntimeState* state, LocalState
     _blocks_returned_counter =
             ADD_COUNTER_WITH_LEVEL(_common_profile, "BlocksProduced", TUnit::UNIT, 1);
     _projection_timer = ADD_TIMER_WITH_LEVEL(_common_profile, "ProjectionTime", 2);
+    _projection_reused_exprs_counter =
+            ADD_COUNTER_WITH_LEVEL(_common_profile, "ProjectionReusedExprs", TUnit::UNIT, 2);
     _init_timer = ADD_TIMER_WITH_LEVEL(_common_profile, "InitTime", 2);
     _open_timer = ADD_TIMER_WITH_LEVEL(_common_profile, "OpenTime", 2);
     _close_timer = ADD_TIMER_WITH_LEVEL(_common_profile, "CloseTime", 2);
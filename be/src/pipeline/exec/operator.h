@@ -259,6 +259,7 @@ protected:
     // Account for current memory and peak memory used by this node
     RuntimeProfile::HighWaterMarkCounter* _memory_used_counter = nullptr;
     RuntimeProfile::Counter* _projection_timer = nullptr;
+    RuntimeProfile::Counter* _projection_reused_exprs_counter = nullptr;
     RuntimeProfile::Counter* _exec_timer = nullptr;
     RuntimeProfile::Counter* _init_timer = nullptr;
     RuntimeProfile::Counter* _open_timer = nullptr;
@@ -970,10 +971,15 @@ protected:
     std::vector<TupleId> _tuple_ids;
 
 private:
+    void _init_projection_reuse_ids();
+
     // The expr of operator set to private permissions, as cannot be executed concurrently,
     // should use local state's expr.
     vectorized::VExprContextSPtrs _conjuncts;
     vectorized::VExprContextSPtrs _projections;
+    // For each projection, the index of an earlier projection with an identical expr tree whose
+    // result column is reused, or -1 if the projection has to be executed.
+    std::vector<int> _projection_reuse_ids;
     // Used in common subexpression elimination to compute intermediate results.
     std::vector<vectorized::VExprContextSPtrs> _intermediate_projections;
 
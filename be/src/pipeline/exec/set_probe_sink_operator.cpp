@@ -73,7 +73,9 @@ Status SetProbeSinkOperatorX<is_intersect>::sink(RuntimeState* state, vectorized
     SCOPED_PEAK_MEM(&local_state._estimate_memory_usage);
 
     const auto probe_rows = cast_set<uint32_t>(in_block->rows());
-    if (probe_rows > 0) {
+    if (probe_rows > 0 && _is_result_settled(local_state)) {
+        COUNTER_UPDATE(local_state._skipped_probe_rows, probe_rows);
+    } else if (probe_rows > 0) {
         {
             SCOPED_TIMER(local_state._extract_probe_data_timer);
             RETURN_IF_ERROR(_extract_probe_column(local_state, *in_block,
@@ -109,6 +111,7 @@ Status SetProbeSinkLocalState<is_intersect>::init(RuntimeState* state, LocalSink
 
     _probe_timer = ADD_TIMER(Base::custom_profile(), "ProbeTime");
     _extract_probe_data_timer = ADD_TIMER(Base::custom_profile(), "ExtractProbeDataTime");
+    _skipped_probe_rows = ADD_COUNTER(Base::custom_profile(), "SkippedProbeRows", TUnit::UNIT);
     Parent& parent = _parent->cast<Parent>();
     _shared_state->probe_finished_children_dependency[parent._cur_child_id] = _dependency;
     _dependency->block();
@@ -195,6 +198,21 @@ void SetProbeSinkOperatorX<is_intersect>::_finalize_probe(
     }
 }
 
+template <bool is_intersect>
+bool SetProbeSinkOperatorX<is_intersect>::_is_result_settled(
+        SetProbeSinkLocalState<is_intersect>& local_state) {
+    // INTERSECT keeps only the rows every child has seen, once the table is empty none of the
+    // following rows can bring a row back. EXCEPT removes a row on its first match, once every
+    // row is matched the rest of the probe can not remove anything more. The counter of EXCEPT
+    // may include the rows visited by the former children if the table is not shrunk, so it
+    // only reaches 0 when all rows are visited.
+    if constexpr (is_intersect) {
+        return local_state._shared_state->get_hash_table_size() == 0;
+    } else {
+        return local_state._shared_state->valid_element_in_hash_tbl <= 0;
+    }
+}
+
 template <bool is_intersect>
 size_t SetProbeSinkOperatorX<is_intersect>::get_reserve_mem_size(RuntimeState* state, bool eos) {
     auto& local_state = get_local_state(state);
@@ -66,6 +66,7 @@ private:
 
     RuntimeProfile::Counter* _extract_probe_data_timer = nullptr;
     RuntimeProfile::Counter* _probe_timer = nullptr;
+    RuntimeProfile::Counter* _skipped_probe_rows = nullptr;
 };
 
 template <bool is_intersect>
@@ -117,6 +118,8 @@ private:
                                  vectorized::Block& block, vectorized::ColumnRawPtrs& raw_ptrs,
                                  int child_id);
     void _refresh_hash_table(SetProbeSinkLocalState<is_intersect>& local_state);
+    // whether the rows of this child can not change the result of the set operation anymore
+    bool _is_result_settled(SetProbeSinkLocalState<is_intersect>& local_state);
     const int _cur_child_id;
     // every child has its result expr list
     vectorized::VExprContextSPtrs _child_exprs;
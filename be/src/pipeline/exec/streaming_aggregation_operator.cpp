@@ -24,6 +24,7 @@
 
 #include "common/cast_set.h"
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "pipeline/exec/operator.h"
 #include "vec/exprs/vectorized_agg_fn.h"
 #include "vec/exprs/vslot_ref.h"
@@ -77,6 +78,16 @@ static constexpr StreamingHtMinReductionEntry STREAMING_HT_MIN_REDUCTION[] = {
 static constexpr int STREAMING_HT_MIN_REDUCTION_SIZE =
         sizeof(STREAMING_HT_MIN_REDUCTION) / sizeof(STREAMING_HT_MIN_REDUCTION[0]);
 
+// Find the appropriate reduction factor in our table for the given hash table size.
+static double get_streaming_ht_min_reduction(size_t ht_mem) {
+    int cache_level = 0;
+    while (cache_level + 1 < STREAMING_HT_MIN_REDUCTION_SIZE &&
+           ht_mem >= STREAMING_HT_MIN_REDUCTION[cache_level + 1].min_ht_mem) {
+        ++cache_level;
+    }
+    return STREAMING_HT_MIN_REDUCTION[cache_level].streaming_ht_min_reduction;
+}
+
 StreamingAggLocalState::StreamingAggLocalState(RuntimeState* state, OperatorXBase* parent)
         : Base(state, parent),
           _agg_data(std::make_unique<AggregatedDataVariants>()),
@@ -109,6 +120,9 @@ Status StreamingAggLocalState::init(RuntimeState* state, LocalStateInfo& info) {
     _get_results_timer = ADD_TIMER(custom_profile(), "GetResultsTime");
     _hash_table_iterate_timer = ADD_TIMER(custom_profile(), "HashTableIterateTime");
     _insert_keys_to_column_timer = ADD_TIMER(custom_profile(), "InsertKeysToColumnTime");
+    _adaptive_passthrough_counter =
+            ADD_COUNTER(custom_profile(), "AdaptivePassthroughCount", TUnit::UNIT);
+    _hash_table_reset_counter = ADD_COUNTER(custom_profile(), "HashTableResetCount", TUnit::UNIT);
 
     return Status::OK();
 }
@@ -134,7 +148,25 @@ Status StreamingAggLocalState::open(RuntimeState* state) {
     DCHECK(!_probe_expr_ctxs.empty());
 
     RETURN_IF_ERROR(_init_hash_method(_probe_expr_ctxs));
+    _init_aggregate_data_container();
+    _passthrough_retry_rows = cast_set<size_t>(config::streaming_agg_passthrough_retry_rows);
+
+    if (p._is_merge || p._needs_finalize) {
+        return Status::InvalidArgument(
+                "StreamingAggLocalState only support no merge and no finalize, "
+                "but got is_merge={}, needs_finalize={}",
+                p._is_merge, p._needs_finalize);
+    }
+
+    _should_limit_output = p._limit != -1 &&       // has limit
+                           (!p._have_conjuncts) && // no having conjunct
+                           p._needs_finalize;      // agg's finalize step
+
+    return Status::OK();
+}
 
+void StreamingAggLocalState::_init_aggregate_data_container() {
+    auto& p = Base::_parent->template cast<StreamingAggOperatorX>();
     std::visit(vectorized::Overload {
                        [&](std::monostate& arg) -> void {
                            throw doris::Exception(ErrorCode::INTERNAL_ERROR, "uninited hash table");
@@ -151,19 +183,6 @@ Status StreamingAggLocalState::open(RuntimeState* state) {
                                                             p._align_aggregate_states);
                        }},
                _agg_data->method_variant);
-
-    if (p._is_merge || p._needs_finalize) {
-        return Status::InvalidArgument(
-                "StreamingAggLocalState only support no merge and no finalize, "
-                "but got is_merge={}, needs_finalize={}",
-                p._is_merge, p._needs_finalize);
-    }
-
-    _should_limit_output = p._limit != -1 &&       // has limit
-                           (!p._have_conjuncts) && // no having conjunct
-                           p._needs_finalize;      // agg's finalize step
-
-    return Status::OK();
 }
 
 size_t StreamingAggLocalState::_get_hash_table_size() {
@@ -240,13 +259,6 @@ bool StreamingAggLocalState::_should_expand_preagg_hash_tables() {
                             return true;
                         }
 
-                        // Find the appropriate reduction factor in our table for the current hash table sizes.
-                        int cache_level = 0;
-                        while (cache_level + 1 < STREAMING_HT_MIN_REDUCTION_SIZE &&
-                               ht_mem >= STREAMING_HT_MIN_REDUCTION[cache_level + 1].min_ht_mem) {
-                            ++cache_level;
-                        }
-
                         // Compare the number of rows in the hash table with the number of input rows that
                         // were aggregated into it. Exclude passed through rows from this calculation since
                         // they were not in hash tables.
@@ -272,8 +284,7 @@ bool StreamingAggLocalState::_should_expand_preagg_hash_tables() {
                         //  double estimated_reduction = aggregated_input_rows >= expected_input_rows
                         //      ? current_reduction
                         //      : 1 + (expected_input_rows / aggregated_input_rows) * (current_reduction - 1);
-                        double min_reduction =
-                                STREAMING_HT_MIN_REDUCTION[cache_level].streaming_ht_min_reduction;
+                        double min_reduction = get_streaming_ht_min_reduction(ht_mem);
 
                         //  COUNTER_SET(preagg_estimated_reduction_, estimated_reduction);
                         //    COUNTER_SET(preagg_streaming_ht_min_reduction_, min_reduction);
@@ -311,6 +322,9 @@ bool StreamingAggLocalState::_should_not_do_pre_agg(size_t rows) {
     // pressure. In either case we should always use the remaining space in the hash table
     // to avoid wasting memory.
     // But for fixed hash map, it never need to expand
+    if (_adaptive_passthrough) {
+        return true;
+    }
     auto& p = Base::_parent->template cast<StreamingAggOperatorX>();
     bool ret_flag = false;
     const auto spill_streaming_agg_mem_limit = p._spill_streaming_agg_mem_limit;
@@ -402,7 +416,9 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
                         ->insert_range_from(*key_columns[i], 0, rows);
             }
         }
+        _update_passthrough_retry(rows);
     } else {
+        const auto ht_size_before = _get_hash_table_size();
         _emplace_into_hash_table(_places.data(), key_columns, rows);
 
         for (int i = 0; i < _aggregate_evaluators.size(); ++i) {
@@ -410,8 +426,92 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
                     in_block, p._offsets_of_aggregate_states[i], _places.data(), _agg_arena_pool,
                     _should_expand_hash_table));
         }
+        _update_adaptive_passthrough(rows, _get_hash_table_size() - ht_size_before);
+    }
+
+    return Status::OK();
+}
+
+void StreamingAggLocalState::_update_adaptive_passthrough(size_t rows, size_t new_groups) {
+    if (!config::enable_streaming_agg_adaptive_passthrough) {
+        return;
+    }
+    // A single small block says little about the reduction, sample at least one batch of rows.
+    _window_input_rows += rows;
+    _window_new_groups += new_groups;
+    if (_window_input_rows < static_cast<size_t>(_state->batch_size())) {
+        return;
+    }
+    const double reduction = static_cast<double>(_window_input_rows) /
+                             static_cast<double>(std::max<size_t>(_window_new_groups, 1));
+    _window_input_rows = 0;
+    _window_new_groups = 0;
+
+    // Same thresholds as `_should_expand_preagg_hash_tables`: while the hash table fits in L2
+    // it is always worth aggregating.
+    size_t ht_mem = 0;
+    std::visit(vectorized::Overload {[&](std::monostate& arg) -> void {
+                                         throw doris::Exception(ErrorCode::INTERNAL_ERROR,
+                                                                "uninited hash table");
+                                     },
+                                     [&](auto& agg_method) {
+                                         ht_mem = agg_method.hash_table->get_buffer_size_in_bytes();
+                                     }},
+               _agg_data->method_variant);
+
+    if (reduction > get_streaming_ht_min_reduction(ht_mem)) {
+        _low_reduction_windows = 0;
+        _retrying_aggregation = false;
+        _passthrough_retry_rows = cast_set<size_t>(config::streaming_agg_passthrough_retry_rows);
+        return;
+    }
+
+    // Hysteresis: one bad window (e.g. a run of new keys) does not stop the aggregation.
+    if (++_low_reduction_windows < config::streaming_agg_adaptive_hysteresis_windows) {
+        return;
+    }
+    if (_retrying_aggregation) {
+        // The retry did not pay off, back off before trying again.
+        const size_t max_retry_rows =
+                cast_set<size_t>(config::streaming_agg_passthrough_retry_rows) * 16;
+        _passthrough_retry_rows = std::min(_passthrough_retry_rows * 2, max_retry_rows);
+    }
+    _adaptive_passthrough = true;
+    _retrying_aggregation = false;
+    _low_reduction_windows = 0;
+    _passthrough_rows = 0;
+    COUNTER_UPDATE(_adaptive_passthrough_counter, 1);
+}
+
+void StreamingAggLocalState::_update_passthrough_retry(size_t rows) {
+    if (!_adaptive_passthrough) {
+        return;
+    }
+    _passthrough_rows += rows;
+    if (_passthrough_rows < _passthrough_retry_rows) {
+        return;
     }
+    // The keys seen before are probably gone, flush them out so the retry measures the
+    // reduction of the current input instead of being diluted by a full hash table.
+    _adaptive_passthrough = false;
+    _retrying_aggregation = true;
+    _passthrough_rows = 0;
+    _need_reset_hash_table = _get_hash_table_size() > 0;
+}
+
+Status StreamingAggLocalState::_reset_hash_table() {
+    _close_with_serialized_key();
+    _agg_data = std::make_unique<AggregatedDataVariants>();
+    RETURN_IF_ERROR(_init_hash_method(_probe_expr_ctxs));
+    _init_aggregate_data_container();
+    _agg_arena_pool.clear();
 
+    _should_expand_hash_table = true;
+    _input_num_rows = 0;
+    _cur_num_rows_returned = 0;
+    _need_reset_hash_table = false;
+    _update_memusage_with_serialized_key();
+    COUNTER_UPDATE(_hash_table_reset_counter, 1);
     return Status::OK();
 }
 
@@ -598,10 +698,8 @@ void StreamingAggLocalState::_emplace_into_hash_table(vectorized::AggregateDataP
                            };
 
                            SCOPED_TIMER(_hash_table_emplace_timer);
-                           for (size_t i = 0; i < num_rows; ++i) {
-                               places[i] = *agg_method.lazy_emplace(state, i, creator,
-                                                                    creator_for_null_key);
-                           }
+                           vectorized::lazy_emplace_batch(agg_method, state, num_rows, creator,
+                                                          creator_for_null_key, places);
 
                            COUNTER_UPDATE(_hash_table_input_counter, num_rows);
                        }},
@@ -767,6 +865,15 @@ Status StreamingAggOperatorX::pull(RuntimeState* state, vectorized::Block* block
     SCOPED_PEAK_MEM(&local_state._estimate_memory_usage);
     if (!local_state._pre_aggregated_block->empty()) {
         local_state._pre_aggregated_block->swap(*block);
+    } else if (local_state._need_reset_hash_table) {
+        // Flush the hash table before retrying the aggregation, this is not the end of output.
+        bool flushed = false;
+        RETURN_IF_ERROR(local_state._get_results_with_serialized_key(state, block, &flushed));
+        local_state.make_nullable_output_key(block);
+        RETURN_IF_ERROR(local_state.filter_block(local_state._conjuncts, block, block->columns()));
+        if (flushed) {
+            RETURN_IF_ERROR(local_state._reset_hash_table());
+        }
     } else {
         RETURN_IF_ERROR(local_state._get_results_with_serialized_key(state, block, eos));
         local_state.make_nullable_output_key(block);
@@ -794,7 +901,8 @@ Status StreamingAggOperatorX::push(RuntimeState* state, vectorized::Block* in_bl
 
 bool StreamingAggOperatorX::need_more_input_data(RuntimeState* state) const {
     auto& local_state = get_local_state(state);
-    return local_state._pre_aggregated_block->empty() && !local_state._child_eos;
+    return local_state._pre_aggregated_block->empty() && !local_state._need_reset_hash_table &&
+           !local_state._child_eos;
 }
 
 #include "common/compile_check_end.h"
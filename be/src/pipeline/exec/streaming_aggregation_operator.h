@@ -60,6 +60,14 @@ private:
     bool _should_expand_preagg_hash_tables();
 
     MOCK_FUNCTION bool _should_not_do_pre_agg(size_t rows);
+    // Feed the reduction of an aggregated block back into the adaptive passthrough decision.
+    void _update_adaptive_passthrough(size_t rows, size_t new_groups);
+    // Called for every passed through block, decides when to flush the hash table and retry.
+    void _update_passthrough_retry(size_t rows);
+    // Destroy the aggregated states and start over with an empty hash table. The content must
+    // have been emitted already.
+    Status _reset_hash_table();
+    void _init_aggregate_data_container();
 
     Status _execute_with_serialized_key(vectorized::Block* block);
     void _update_memusage_with_serialized_key();
@@ -86,8 +94,23 @@ private:
     RuntimeProfile::Counter* _get_results_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_iterate_timer = nullptr;
     RuntimeProfile::Counter* _insert_keys_to_column_timer = nullptr;
+    RuntimeProfile::Counter* _adaptive_passthrough_counter = nullptr;
+    RuntimeProfile::Counter* _hash_table_reset_counter = nullptr;
 
     bool _should_expand_hash_table = true;
+    // Adaptive passthrough: the reduction is sampled over windows of at least one batch of
+    // aggregated rows, see `_update_adaptive_passthrough`.
+    bool _adaptive_passthrough = false;
+    // Set when a retry is due, the hash table is flushed by `pull` before taking more input.
+    bool _need_reset_hash_table = false;
+    // Whether the current aggregating phase is a retry after a passthrough phase.
+    bool _retrying_aggregation = false;
+    size_t _window_input_rows = 0;
+    size_t _window_new_groups = 0;
+    int _low_reduction_windows = 0;
+    size_t _passthrough_rows = 0;
+    // Passed through rows before the next retry, doubled by every retry which did not pay off.
+    size_t _passthrough_retry_rows = 0;
     int64_t _cur_num_rows_returned = 0;
     vectorized::Arena _agg_arena_pool;
     AggregatedDataVariantsUPtr _agg_data = nullptr;
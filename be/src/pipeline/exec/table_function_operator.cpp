@@ -165,6 +165,9 @@ Status TableFunctionLocalState::get_expanded_block(RuntimeState* state,
         }
     }
     SCOPED_TIMER(_process_rows_timer);
+    if (p._fn_num == 1 && _fns[0]->support_get_value_batch()) {
+        RETURN_IF_ERROR(_get_expanded_block_batch(state, columns));
+    }
     while (columns[p._child_slots.size()]->size() < state->batch_size()) {
         RETURN_IF_CANCELLED(state);
 
@@ -226,6 +229,34 @@ Status TableFunctionLocalState::get_expanded_block(RuntimeState* state,
     return Status::OK();
 }
 
+// The results of many child rows are output by one call of the function, and the other output
+// columns are replicated by gathering the child rows of the results.
+Status TableFunctionLocalState::_get_expanded_block_batch(RuntimeState* state,
+                                                          vectorized::MutableColumns& columns) {
+    auto& p = _parent->cast<TableFunctionOperatorX>();
+    auto& fn_column = columns[p._child_slots.size()];
+    while (fn_column->size() < state->batch_size() && _child_block->rows() != 0) {
+        RETURN_IF_CANCELLED(state);
+        const auto num_rows = cast_set<int64_t>(_child_block->rows());
+        _child_row_indices.clear();
+        _cur_child_offset = _fns[0]->get_value_batch(
+                fn_column, _cur_child_offset, num_rows,
+                state->batch_size() - cast_set<int>(fn_column->size()), _child_row_indices);
+        for (auto index : p._output_slot_indexs) {
+            columns[index]->insert_indices_from(*_child_block->get_by_position(index).column,
+                                                _child_row_indices.data(),
+                                                _child_row_indices.data() +
+                                                        _child_row_indices.size());
+        }
+        if (_cur_child_offset == num_rows) {
+            // close the functions and release the child block
+            _cur_child_offset = num_rows - 1;
+            process_next_child_row();
+        }
+    }
+    return Status::OK();
+}
+
 void TableFunctionLocalState::process_next_child_row() {
     _cur_child_offset++;
 
@@ -56,6 +56,7 @@ private:
 
     MOCK_FUNCTION Status _clone_table_function(RuntimeState* state);
 
+    Status _get_expanded_block_batch(RuntimeState* state, vectorized::MutableColumns& columns);
     void _copy_output_slots(std::vector<vectorized::MutableColumnPtr>& columns);
     bool _roll_table_functions(int last_eos_idx);
     // return:
@@ -70,6 +71,8 @@ private:
     int64_t _cur_child_offset = -1;
     std::unique_ptr<vectorized::Block> _child_block;
     int _current_row_insert_times = 0;
+    // the child row of every result of get_value_batch
+    std::vector<uint32_t> _child_row_indices;
     bool _child_eos = false;
 
     RuntimeProfile::Counter* _init_function_timer = nullptr;
@@ -34,6 +34,8 @@ Status LocalExchangeSourceLocalState::init(RuntimeState* state, LocalStateInfo&
     if (_exchanger->get_type() == ExchangeType::HASH_SHUFFLE ||
         _exchanger->get_type() == ExchangeType::BUCKET_HASH_SHUFFLE) {
         _copy_data_timer = ADD_TIMER(custom_profile(), "CopyDataTime");
+        _passthrough_blocks_counter =
+                ADD_COUNTER_WITH_LEVEL(custom_profile(), "PassthroughBlocks", TUnit::UNIT, 1);
     }
 
     return Status::OK();
@@ -94,7 +96,9 @@ Status LocalExchangeSourceOperatorX::get_block(RuntimeState* state, vectorized::
     auto& local_state = get_local_state(state);
     SCOPED_TIMER(local_state.exec_time_counter());
     RETURN_IF_ERROR(local_state._exchanger->get_block(
-            state, block, eos, {nullptr, nullptr, local_state._copy_data_timer},
+            state, block, eos,
+            {nullptr, nullptr, local_state._copy_data_timer,
+             local_state._passthrough_blocks_counter},
             {local_state._channel_id, &local_state}));
     local_state.reached_limit(block, eos);
     return Status::OK();
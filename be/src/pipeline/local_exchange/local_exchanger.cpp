@@ -37,7 +37,6 @@ void Exchanger<BlockType>::_enqueue_data_and_set_ready(int channel_id,
     // PartitionedBlock will be push into multiple queues with different row ranges, so it will be
     // referenced multiple times. Otherwise, we only ref the block once because it is only push into
     // one queue.
-    std::unique_lock l(*_m[channel_id]);
     if constexpr (std::is_same_v<PartitionedBlock, BlockType> ||
                   std::is_same_v<BroadcastBlock, BlockType>) {
         block.first->record_channel_id(channel_id);
@@ -45,8 +44,15 @@ void Exchanger<BlockType>::_enqueue_data_and_set_ready(int channel_id,
         block->record_channel_id(channel_id);
     }
 
+    // Enqueue without holding `_m[channel_id]` and only wake up the source if it is blocked, so
+    // a burst of blocks into a queue which is being consumed costs one signal instead of N.
+    // The fence pairs with the one in `_dequeue_data`: either the source sees this block when it
+    // re-checks the queue after blocking itself, or we see the blocked dependency here.
     if (_data_queue[channel_id].enqueue(std::move(block))) {
-        local_state->_shared_state->set_ready_to_read(channel_id);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!local_state->_shared_state->source_deps[channel_id]->ready()) {
+            local_state->_shared_state->set_ready_to_read(channel_id);
+        }
     }
 }
 
@@ -84,6 +90,12 @@ bool Exchanger<BlockType>::_dequeue_data(LocalExchangeSourceLocalState* local_st
         }
         COUNTER_UPDATE(local_state->_get_block_failed_counter, 1);
         local_state->_dependency->block();
+        // Sinks enqueue without the lock, re-check after blocking so a block enqueued
+        // concurrently is never missed. See `_enqueue_data_and_set_ready`.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_data_queue[channel_id].data_queue.size_approx() > 0) {
+            local_state->_dependency->set_ready();
+        }
     }
     return false;
 }
@@ -151,9 +163,14 @@ Status ShuffleExchanger::get_block(RuntimeState* state, vectorized::Block* block
 
     auto get_data = [&]() -> Status {
         do {
+            auto block_wrapper = partitioned_block.first;
+            if (partitioned_block.second.row_idxs == nullptr) {
+                RETURN_IF_ERROR(mutable_block.add_rows(&block_wrapper->_data_block, 0,
+                                                       partitioned_block.second.length));
+                continue;
+            }
             const auto* offset_start = partitioned_block.second.row_idxs->data() +
                                        partitioned_block.second.offset_start;
-            auto block_wrapper = partitioned_block.first;
             RETURN_IF_ERROR(mutable_block.add_rows(&block_wrapper->_data_block, offset_start,
                                                    offset_start + partitioned_block.second.length));
         } while (mutable_block.rows() < state->batch_size() && !*eos &&
@@ -164,6 +181,14 @@ Status ShuffleExchanger::get_block(RuntimeState* state, vectorized::Block* block
 
     if (_dequeue_data(source_info.local_state, partitioned_block, eos, block,
                       source_info.channel_id)) {
+        if (partitioned_block.second.row_idxs == nullptr &&
+            partitioned_block.first->_data_block.rows() >= size_t(state->batch_size() / 2)) {
+            // The whole block was routed to this channel and is referenced only by this queue,
+            // so hand it over like `PassthroughExchanger` does instead of copying its rows.
+            block->swap(partitioned_block.first->_data_block);
+            COUNTER_UPDATE(profile.passthrough_blocks_counter, 1);
+            return Status::OK();
+        }
         SCOPED_TIMER(profile.copy_data_timer);
         mutable_block = vectorized::VectorizedUtils::build_mutable_mem_reuse_block(
                 block, partitioned_block.first->_data_block);
@@ -180,13 +205,25 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
         return _split_rows(state, channel_ids, block, channel_id);
     }
     const auto rows = cast_set<int32_t>(block->rows());
-    auto row_idx = std::make_shared<vectorized::PODArray<uint32_t>>(rows);
     auto& partition_rows_histogram = _partition_rows_histogram[channel_id];
-    {
-        partition_rows_histogram.assign(_num_partitions + 1, 0);
-        for (int32_t i = 0; i < rows; ++i) {
-            partition_rows_histogram[channel_ids[i]]++;
+    partition_rows_histogram.assign(_num_partitions + 1, 0);
+    for (int32_t i = 0; i < rows; ++i) {
+        partition_rows_histogram[channel_ids[i]]++;
+    }
+    // If upstream is already distributed by the same keys, every row of the block goes to
+    // the same partition. Skip building row indexes so the source can take the whole block.
+    const bool single_partition =
+            rows > 0 && partition_rows_histogram[channel_ids[0]] == uint32_t(rows);
+    std::shared_ptr<vectorized::PODArray<uint32_t>> row_idx;
+    if (single_partition) {
+        for (auto p = channel_ids[0] + 1; p <= uint32_t(_num_partitions); ++p) {
+            partition_rows_histogram[p] = uint32_t(rows);
+        }
+        for (uint32_t p = 0; p <= channel_ids[0]; ++p) {
+            partition_rows_histogram[p] = 0;
         }
+    } else {
+        row_idx = std::make_shared<vectorized::PODArray<uint32_t>>(rows);
         for (int32_t i = 1; i <= _num_partitions; ++i) {
             partition_rows_histogram[i] += partition_rows_histogram[i - 1];
         }
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "common/compiler_util.h"
 #include "pipeline/dependency.h"
 #include "pipeline/exec/operator.h"
 
@@ -37,6 +38,8 @@ struct Profile {
     RuntimeProfile::Counter* compute_hash_value_timer = nullptr;
     RuntimeProfile::Counter* distribute_timer = nullptr;
     RuntimeProfile::Counter* copy_data_timer = nullptr;
+    // Blocks handed over to downstream without partitioning and copying rows.
+    RuntimeProfile::Counter* passthrough_blocks_counter = nullptr;
 };
 
 struct SinkInfo {
@@ -175,6 +178,7 @@ protected:
 };
 
 struct PartitionedRowIdxs {
+    // nullptr means all rows of the block belong to one channel, in their original order.
     std::shared_ptr<vectorized::PODArray<uint32_t>> row_idxs;
     uint32_t offset_start;
     uint32_t length;
@@ -189,8 +193,10 @@ struct RowRange {
 };
 using BroadcastBlock = std::pair<std::shared_ptr<ExchangerBase::BlockWrapper>, RowRange>;
 
+// Padded to a cache line so that queues of neighbouring channels, written by different sinks
+// and read by different sources, do not share cache lines.
 template <typename BlockType>
-struct BlockQueue {
+struct alignas(CACHE_LINE_SIZE) BlockQueue {
     std::atomic<bool> eos = false;
     moodycamel::ConcurrentQueue<BlockType> data_queue;
     moodycamel::ProducerToken ptok {data_queue};
@@ -21,6 +21,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -140,6 +141,25 @@ public:
     int num_tasks_of_parent() const { return _num_tasks_of_parent; }
     std::string& name() { return _name; }
 
+    // Time breakdown of a finished task. The pipeline keeps the one of its task finished last,
+    // which is the task the pipeline waited for.
+    struct FinishedTaskStats {
+        int64_t finish_time_ns = 0;
+        int64_t exec_time_ns = 0;
+        int64_t wait_worker_time_ns = 0;
+        int64_t blocked_time_ns = 0;
+    };
+    void on_task_finished(const FinishedTaskStats& stats) {
+        std::lock_guard<std::mutex> l(_last_finished_task_lock);
+        if (stats.finish_time_ns > _last_finished_task.finish_time_ns) {
+            _last_finished_task = stats;
+        }
+    }
+    FinishedTaskStats last_finished_task() {
+        std::lock_guard<std::mutex> l(_last_finished_task_lock);
+        return _last_finished_task;
+    }
+
 private:
     void _init_profile();
 
@@ -178,6 +198,9 @@ private:
     std::vector<PipelineTask*> _tasks;
     // Parallelism of parent pipeline.
     const int _num_tasks_of_parent;
+
+    std::mutex _last_finished_task_lock;
+    FinishedTaskStats _last_finished_task;
 };
 #include "common/compile_check_end.h"
 } // namespace doris::pipeline
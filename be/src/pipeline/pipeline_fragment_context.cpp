@@ -31,6 +31,7 @@
 #include <map>
 #include <memory>
 #include <ostream>
+#include <set>
 #include <utility>
 
 #include "cloud/config.h"
@@ -114,6 +115,7 @@
 #include "util/container_util.hpp"
 #include "util/countdown_latch.h"
 #include "util/debug_util.h"
+#include "util/time.h"
 #include "util/uid_util.h"
 #include "vec/common/sort/heap_sorter.h"
 #include "vec/common/sort/topn_sorter.h"
@@ -1779,6 +1781,7 @@ void PipelineFragmentContext::_close_fragment_instance() {
     }
     Defer defer_op {[&]() { _is_fragment_instance_closed = true; }};
     _fragment_level_profile->total_time_counter()->update(_fragment_watcher.elapsed_time());
+    _add_critical_path_info();
     static_cast<void>(send_report(true));
     // Print profile content in info log is a tempoeray solution for stream load and external_connector.
     // Since stream load does not have someting like coordinator on FE, so
@@ -1816,6 +1819,56 @@ void PipelineFragmentContext::_close_fragment_instance() {
     _exec_env->fragment_mgr()->remove_pipeline_context({_query_id, _fragment_id});
 }
 
+// A pipeline can not finish before its upstream pipelines (children), so starting from the
+// pipeline finished last, the chain of the upstream pipeline finished last is the critical path
+// of the fragment. Each hop shows how its last finished task spent its time.
+void PipelineFragmentContext::_add_critical_path_info() {
+    std::set<PipelineId> child_ids;
+    for (const auto& pipeline : _pipelines) {
+        for (const auto& child : pipeline->children()) {
+            child_ids.insert(child->id());
+        }
+    }
+    auto finish_time = [](Pipeline* pipeline) {
+        return pipeline->last_finished_task().finish_time_ns;
+    };
+    Pipeline* current = nullptr;
+    for (const auto& pipeline : _pipelines) {
+        if (!child_ids.contains(pipeline->id()) &&
+            (current == nullptr || finish_time(pipeline.get()) > finish_time(current))) {
+            current = pipeline.get();
+        }
+    }
+
+    const int64_t now = MonotonicNanos();
+    const auto fragment_elapsed = cast_set<int64_t>(_fragment_watcher.elapsed_time());
+    std::set<PipelineId> visited;
+    fmt::memory_buffer buffer;
+    while (current != nullptr && visited.insert(current->id()).second) {
+        auto stats = current->last_finished_task();
+        if (stats.finish_time_ns == 0) {
+            break;
+        }
+        fmt::format_to(buffer, "{}Pipeline {}(finish: {}, exec: {}, wait worker: {}, blocked: {})",
+                       buffer.size() > 0 ? " <- " : "", current->id(),
+                       PrettyPrinter::print(fragment_elapsed - (now - stats.finish_time_ns),
+                                            TUnit::TIME_NS),
+                       PrettyPrinter::print(stats.exec_time_ns, TUnit::TIME_NS),
+                       PrettyPrinter::print(stats.wait_worker_time_ns, TUnit::TIME_NS),
+                       PrettyPrinter::print(stats.blocked_time_ns, TUnit::TIME_NS));
+        Pipeline* next = nullptr;
+        for (const auto& child : current->children()) {
+            if (next == nullptr || finish_time(child.get()) > finish_time(next)) {
+                next = child.get();
+            }
+        }
+        current = next;
+    }
+    if (buffer.size() > 0) {
+        _fragment_level_profile->add_info_string("CriticalPath", fmt::to_string(buffer));
+    }
+}
+
 void PipelineFragmentContext::decrement_running_task(PipelineId pipeline_id) {
     // If all tasks of this pipeline has been closed, upstream tasks is never needed, and we just make those runnable here
     DCHECK(_pip_id_to_pipeline.contains(pipeline_id));
@@ -173,6 +173,8 @@ private:
     Status _build_pipeline_tasks(const doris::TPipelineFragmentParams& request,
                                  ThreadPool* thread_pool);
     void _close_fragment_instance();
+    // Adds the "CriticalPath" info string to the fragment level profile.
+    void _add_critical_path_info();
     void _init_next_report_time();
 
     // Id of this query
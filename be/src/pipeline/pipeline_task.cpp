@@ -42,7 +42,9 @@
 #include "util/container_util.hpp"
 #include "util/defer_op.h"
 #include "util/mem_info.h"
+#include "util/perf_counters.h"
 #include "util/runtime_profile.h"
+#include "util/time.h"
 #include "util/uid_util.h"
 #include "vec/core/block.h"
 #include "vec/spill/spill_stream.h"
@@ -212,6 +214,7 @@ bool PipelineTask::inject_shared_state(std::shared_ptr<BasicSharedState> shared_
 }
 
 void PipelineTask::_init_profile() {
+    _create_time_ns = MonotonicNanos();
     _task_profile = std::make_unique<RuntimeProfile>(fmt::format("PipelineTask(index={})", _index));
     _parent_profile->add_child(_task_profile.get(), true, nullptr);
     _task_cpu_timer = ADD_TIMER(_task_profile, "TaskCpuTime");
@@ -226,13 +229,26 @@ void PipelineTask::_init_profile() {
     _close_timer = ADD_CHILD_TIMER(_task_profile, "CloseTime", exec_time);
 
     _wait_worker_timer = ADD_TIMER_WITH_LEVEL(_task_profile, "WaitWorkerTime", 1);
+    _blocked_timer = ADD_TIMER_WITH_LEVEL(_task_profile, "BlockedTime", 1);
 
     _schedule_counts = ADD_COUNTER(_task_profile, "NumScheduleTimes", TUnit::UNIT);
     _yield_counts = ADD_COUNTER(_task_profile, "NumYieldTimes", TUnit::UNIT);
+    _spurious_wakeup_counts = ADD_COUNTER(_task_profile, "NumSpuriousWakeups", TUnit::UNIT);
     _core_change_times = ADD_COUNTER(_task_profile, "CoreChangeTimes", TUnit::UNIT);
     _memory_reserve_times = ADD_COUNTER(_task_profile, "MemoryReserveTimes", TUnit::UNIT);
     _memory_reserve_failed_times =
             ADD_COUNTER(_task_profile, "MemoryReserveFailedTimes", TUnit::UNIT);
+
+    if (config::enable_pipeline_task_hw_counters) {
+        _hw_cpu_cycles_counter =
+                ADD_COUNTER_WITH_LEVEL(_task_profile, "HwCpuCycles", TUnit::UNIT, 1);
+        _hw_instructions_counter =
+                ADD_COUNTER_WITH_LEVEL(_task_profile, "HwInstructions", TUnit::UNIT, 1);
+        _hw_cache_misses_counter =
+                ADD_COUNTER_WITH_LEVEL(_task_profile, "HwCacheMisses", TUnit::UNIT, 1);
+        _hw_branch_misses_counter =
+                ADD_COUNTER_WITH_LEVEL(_task_profile, "HwBranchMisses", TUnit::UNIT, 1);
+    }
 }
 
 void PipelineTask::_fresh_profile_counter() {
@@ -358,17 +374,40 @@ Status PipelineTask::execute(bool* done) {
     auto fragment_context = _fragment_context.lock();
     DCHECK(fragment_context);
     int64_t time_spent = 0;
+    const auto time_slice = _current_time_slice();
     ThreadCpuStopWatch cpu_time_stop_watch;
     cpu_time_stop_watch.start();
+    // a task runs on one thread until execute() returns, so the delta of the thread's hardware
+    // counters belongs to this task
+    PerfCounters::ThreadHwCounters hw_counters_at_start;
+    const bool collect_hw_counters = _hw_cpu_cycles_counter != nullptr &&
+                                     PerfCounters::get_thread_hw_counters(&hw_counters_at_start);
     SCOPED_ATTACH_TASK(_state);
     Defer running_defer {[&]() {
         if (_task_queue) {
             _task_queue->update_statistics(this, time_spent);
         }
+        if (PerfCounters::ThreadHwCounters hw_counters;
+            collect_hw_counters && PerfCounters::get_thread_hw_counters(&hw_counters)) {
+            COUNTER_UPDATE(_hw_cpu_cycles_counter,
+                           hw_counters[PerfCounters::THREAD_HW_CPU_CYCLES] -
+                                   hw_counters_at_start[PerfCounters::THREAD_HW_CPU_CYCLES]);
+            COUNTER_UPDATE(_hw_instructions_counter,
+                           hw_counters[PerfCounters::THREAD_HW_INSTRUCTIONS] -
+                                   hw_counters_at_start[PerfCounters::THREAD_HW_INSTRUCTIONS]);
+            COUNTER_UPDATE(_hw_cache_misses_counter,
+                           hw_counters[PerfCounters::THREAD_HW_CACHE_MISSES] -
+                                   hw_counters_at_start[PerfCounters::THREAD_HW_CACHE_MISSES]);
+            COUNTER_UPDATE(_hw_branch_misses_counter,
+                           hw_counters[PerfCounters::THREAD_HW_BRANCH_MISSES] -
+                                   hw_counters_at_start[PerfCounters::THREAD_HW_BRANCH_MISSES]);
+        }
         int64_t delta_cpu_time = cpu_time_stop_watch.elapsed_time();
         _task_cpu_timer->update(delta_cpu_time);
-        fragment_context->get_query_ctx()->resource_ctx()->cpu_context()->update_cpu_cost_ms(
-                delta_cpu_time);
+        auto* cpu_context = fragment_context->get_query_ctx()->resource_ctx()->cpu_context();
+        cpu_context->update_cpu_cost_ms(delta_cpu_time);
+        // The counter accumulates the nanoseconds measured by ThreadCpuStopWatch.
+        _query_cpu_time_ns = static_cast<uint64_t>(cpu_context->cpu_cost_ms());
 
         // If task is woke up early, we should terminate all operators, and this task could be closed immediately.
         if (_wake_up_early) {
@@ -411,6 +450,7 @@ Status PipelineTask::execute(bool* done) {
         return Status::OK();
     }
 
+    const bool opened_at_start = _opened;
     // The status must be runnable
     if (!_opened && !fragment_context->is_canceled()) {
         DBUG_EXECUTE_IF("PipelineTask::execute.open_sleep", {
@@ -429,6 +469,7 @@ Status PipelineTask::execute(bool* done) {
         RETURN_IF_ERROR(_open());
     }
 
+    const auto get_block_counts_at_start = _get_block_counter->value();
     while (!fragment_context->is_canceled()) {
         SCOPED_RAW_TIMER(&time_spent);
         Defer defer {[&]() {
@@ -439,6 +480,10 @@ Status PipelineTask::execute(bool* done) {
         }};
         // `_wake_up_early` must be after `_is_blocked()`
         if (_is_blocked() || _wake_up_early) {
+            if (opened_at_start && !_wake_up_early &&
+                _get_block_counter->value() == get_block_counts_at_start) {
+                COUNTER_UPDATE(_spurious_wakeup_counts, 1);
+            }
             return Status::OK();
         }
 
@@ -449,7 +494,7 @@ Status PipelineTask::execute(bool* done) {
             break;
         }
 
-        if (time_spent > _exec_time_slice) {
+        if (time_spent > time_slice) {
             COUNTER_UPDATE(_yield_counts, 1);
             break;
         }
@@ -682,6 +727,12 @@ Status PipelineTask::close(Status exec_status, bool close_sink) {
     }
     if (close_sink) {
         RETURN_IF_ERROR(_state_transition(State::FINISHED));
+        _pipeline->on_task_finished({MonotonicNanos(), _exec_timer->value(),
+                                     (int64_t)_wait_worker_watcher.elapsed_time(),
+                                     _blocked_time_ns});
+        if (!_state_timeline.empty()) {
+            _task_profile->add_info_string("StateTimeline", _state_timeline_string());
+        }
     }
     return s;
 }
@@ -759,6 +810,25 @@ std::string PipelineTask::debug_string() {
     return fmt::to_string(debug_string_buffer);
 }
 
+unsigned long long PipelineTask::_current_time_slice() const {
+    if (!config::enable_adaptive_pipeline_task_time_slice || !_task_queue || _core_id < 0) {
+        return _exec_time_slice;
+    }
+    // Nobody waits on this core: keep running and save the switches. The more tasks wait,
+    // the sooner this one yields to them, down to a quarter of the configured slice.
+    const auto waiting = _task_queue->num_waiting_tasks(_core_id);
+    if (waiting == 0) {
+        return _exec_time_slice * 2;
+    }
+    if (waiting <= 1) {
+        return _exec_time_slice;
+    }
+    if (waiting <= 4) {
+        return _exec_time_slice / 2;
+    }
+    return _exec_time_slice / 4;
+}
+
 size_t PipelineTask::get_revocable_size() const {
     if (is_finalized() || _running || (_eos && !_spilling)) {
         return 0;
@@ -800,8 +870,19 @@ Status PipelineTask::wake_up(Dependency* dep) {
 
 Status PipelineTask::_state_transition(State new_state) {
     if (_exec_state != new_state) {
+        if (_exec_state == State::BLOCKED) {
+            _blocked_time_ns += _state_change_watcher.elapsed_time();
+            COUNTER_SET(_blocked_timer, _blocked_time_ns);
+        }
         _state_change_watcher.reset();
         _state_change_watcher.start();
+        if (config::enable_pipeline_task_state_timeline &&
+            _state_timeline.size() <
+                    static_cast<size_t>(config::pipeline_task_state_timeline_max_transitions)) {
+            _state_timeline.push_back(
+                    {new_state, MonotonicNanos() - _create_time_ns,
+                     new_state == State::BLOCKED && _blocked_dep ? _blocked_dep->name() : ""});
+        }
     }
     _task_profile->add_info_string("TaskState", _to_string(new_state));
     _task_profile->add_info_string("BlockedByDependency", _blocked_dep ? _blocked_dep->name() : "");
@@ -814,4 +895,20 @@ Status PipelineTask::_state_transition(State new_state) {
     return Status::OK();
 }
 
+// e.g. "RUNNABLE@1.2ms BLOCKED(HASH_JOIN_BUILD_DEPENDENCY)@1.5ms RUNNABLE@35ms FINISHED@40ms"
+std::string PipelineTask::_state_timeline_string() const {
+    fmt::memory_buffer buffer;
+    for (const auto& transition : _state_timeline) {
+        if (buffer.size() > 0) {
+            fmt::format_to(buffer, " ");
+        }
+        fmt::format_to(buffer, "{}", _to_string(transition.state));
+        if (!transition.blocked_by.empty()) {
+            fmt::format_to(buffer, "({})", transition.blocked_by);
+        }
+        fmt::format_to(buffer, "@{}", PrettyPrinter::print(transition.time_ns, TUnit::TIME_NS));
+    }
+    return fmt::to_string(buffer);
+}
+
 } // namespace doris::pipeline
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -116,6 +117,7 @@ public:
     DataSinkOperatorPtr sink() const { return _sink; }
 
     int task_id() const { return _index; };
+    const TUniqueId& query_id() const { return _query_id; }
     bool is_finalized() const { return _exec_state == State::FINALIZED; }
 
     void set_wake_up_early() { _wake_up_early = true; }
@@ -134,6 +136,13 @@ public:
     // 1.1 pipeline task
     void inc_runtime_ns(uint64_t delta_time) { this->_runtime += delta_time; }
     uint64_t get_runtime_ns() const { return this->_runtime; }
+    // The runtime the priority queue levels this task by: its own runtime, or, with
+    // `pipeline_task_queue_level_by_query`, the CPU time its whole query has used so far, so
+    // a wide query cannot keep every one of its tasks on the top level.
+    uint64_t get_queue_runtime_ns() const {
+        return config::pipeline_task_queue_level_by_query ? std::max(_runtime, _query_cpu_time_ns)
+                                                          : _runtime;
+    }
 
     // 1.2 priority queue's queue level
     void update_queue_level(int queue_level) { this->_queue_level = queue_level; }
@@ -203,6 +212,8 @@ private:
     // it may be visited by different thread but there is no race condition
     // so no need to add lock
     uint64_t _runtime = 0;
+    // Snapshot of the query's CPU time taken after this task's last run.
+    uint64_t _query_cpu_time_ns = 0;
     // it's visited in one thread, so no need to thread synchronization
     // 1 get task, (set _queue_level/_core_id)
     // 2 exe task
@@ -212,6 +223,11 @@ private:
     RuntimeProfile* _parent_profile = nullptr;
     std::unique_ptr<RuntimeProfile> _task_profile;
     RuntimeProfile::Counter* _task_cpu_timer = nullptr;
+    // only created when config::enable_pipeline_task_hw_counters is on
+    RuntimeProfile::Counter* _hw_cpu_cycles_counter = nullptr;
+    RuntimeProfile::Counter* _hw_instructions_counter = nullptr;
+    RuntimeProfile::Counter* _hw_cache_misses_counter = nullptr;
+    RuntimeProfile::Counter* _hw_branch_misses_counter = nullptr;
     RuntimeProfile::Counter* _prepare_timer = nullptr;
     RuntimeProfile::Counter* _open_timer = nullptr;
     RuntimeProfile::Counter* _exec_timer = nullptr;
@@ -222,8 +238,11 @@ private:
     RuntimeProfile::Counter* _schedule_counts = nullptr;
     MonotonicStopWatch _wait_worker_watcher;
     RuntimeProfile::Counter* _wait_worker_timer = nullptr;
+    RuntimeProfile::Counter* _blocked_timer = nullptr;
     // TODO we should calculate the time between when really runnable and runnable
     RuntimeProfile::Counter* _yield_counts = nullptr;
+    // Times the task was scheduled but blocked again before getting any block.
+    RuntimeProfile::Counter* _spurious_wakeup_counts = nullptr;
     RuntimeProfile::Counter* _core_change_times = nullptr;
     RuntimeProfile::Counter* _memory_reserve_times = nullptr;
     RuntimeProfile::Counter* _memory_reserve_failed_times = nullptr;
@@ -251,6 +270,9 @@ private:
     bool _dry_run = false;
     MOCK_REMOVE(const)
     unsigned long long _exec_time_slice = config::pipeline_task_exec_time_slice * NANOS_PER_MILLIS;
+    // The time slice of the current run, `_exec_time_slice` scaled by how many tasks wait on the
+    // same core when `enable_adaptive_pipeline_task_time_slice` is on.
+    unsigned long long _current_time_slice() const;
     Dependency* _blocked_dep = nullptr;
 
     Dependency* _execution_dep = nullptr;
@@ -300,8 +322,19 @@ private:
     }
 
     Status _state_transition(State new_state);
+    std::string _state_timeline_string() const;
     std::atomic<State> _exec_state = State::INITED;
     MonotonicStopWatch _state_change_watcher;
+    int64_t _blocked_time_ns = 0;
+    struct StateTransition {
+        State state;
+        // since the task is created
+        int64_t time_ns;
+        std::string blocked_by;
+    };
+    int64_t _create_time_ns = 0;
+    // only recorded when config::enable_pipeline_task_state_timeline is on
+    std::vector<StateTransition> _state_timeline;
     std::atomic<bool> _spilling = false;
     const std::string _pipeline_name;
 };
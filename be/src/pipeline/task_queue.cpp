@@ -19,12 +19,19 @@
 
 // IWYU pragma: no_include <bits/chrono.h>
 #include <chrono> // IWYU pragma: keep
+#include <functional>
 #include <memory>
 #include <string>
+#include <thread>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "pipeline/pipeline_task.h"
 #include "runtime/workload_group/workload_group.h"
+#include "util/cpu_info.h"
+#include "util/doris_metrics.h"
+#include "util/uid_util.h"
+#include "util/random.h"
 
 namespace doris::pipeline {
 #include "common/compile_check_begin.h"
@@ -93,7 +100,18 @@ int PriorityTaskQueue::_compute_level(uint64_t runtime) {
 }
 
 PipelineTaskSPtr PriorityTaskQueue::try_take(bool is_steal) {
-    // TODO other efficient lock? e.g. if get lock fail, return null_ptr
+    if (is_steal) {
+        // A thief should never wait for the owner of the queue, if the victim is busy
+        // just move on to the next one.
+        if (_total_task_size == 0) {
+            return nullptr;
+        }
+        std::unique_lock<std::mutex> lock(_work_size_mutex, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            return nullptr;
+        }
+        return _try_take_unprotected(is_steal);
+    }
     std::unique_lock<std::mutex> lock(_work_size_mutex);
     return _try_take_unprotected(is_steal);
 }
@@ -117,7 +135,7 @@ Status PriorityTaskQueue::push(PipelineTaskSPtr task) {
     if (_closed) {
         return Status::InternalError("WorkTaskQueue closed");
     }
-    auto level = _compute_level(task->get_runtime_ns());
+    auto level = _compute_level(task->get_queue_runtime_ns());
     std::unique_lock<std::mutex> lock(_work_size_mutex);
 
     // update empty queue's  runtime, to avoid too high priority
@@ -136,7 +154,45 @@ Status PriorityTaskQueue::push(PipelineTaskSPtr task) {
 MultiCoreTaskQueue::~MultiCoreTaskQueue() = default;
 
 MultiCoreTaskQueue::MultiCoreTaskQueue(int core_size)
-        : _prio_task_queues(core_size), _closed(false), _core_size(core_size) {}
+        : _prio_task_queues(core_size), _closed(false), _core_size(core_size) {
+    if (config::enable_numa_aware_pipeline_scheduling) {
+        _init_numa_groups();
+    }
+}
+
+void MultiCoreTaskQueue::_init_numa_groups() {
+    int numa_nodes = CpuInfo::get_max_num_numa_nodes();
+    if (numa_nodes <= 1 || _core_size < numa_nodes) {
+        return;
+    }
+    _numa_node_num = numa_nodes;
+    _core_to_numa_node.resize(_core_size);
+    _numa_node_to_cores.resize(numa_nodes);
+    // Split the worker cores into contiguous groups, one group per NUMA node.
+    for (int core_id = 0; core_id < _core_size; ++core_id) {
+        int node = static_cast<int>(int64_t(core_id) * numa_nodes / _core_size);
+        _core_to_numa_node[core_id] = node;
+        _numa_node_to_cores[node].push_back(core_id);
+    }
+    _steal_victims.resize(_core_size);
+    for (int core_id = 0; core_id < _core_size; ++core_id) {
+        int node = _core_to_numa_node[core_id];
+        auto& victims = _steal_victims[core_id];
+        for (int i = 0; i < numa_nodes; ++i) {
+            for (int victim : _numa_node_to_cores[(node + i) % numa_nodes]) {
+                if (victim != core_id) {
+                    victims.push_back(victim);
+                }
+            }
+        }
+    }
+    _next_core_of_numa_node = std::make_unique<std::atomic<uint32_t>[]>(numa_nodes);
+    for (int i = 0; i < numa_nodes; ++i) {
+        _next_core_of_numa_node[i] = 0;
+    }
+    LOG(INFO) << "MultiCoreTaskQueue is NUMA aware, cores: " << _core_size
+              << ", numa nodes: " << numa_nodes;
+}
 
 void MultiCoreTaskQueue::close() {
     if (_closed) {
@@ -175,25 +231,76 @@ PipelineTaskSPtr MultiCoreTaskQueue::take(int core_id) {
 
 PipelineTaskSPtr MultiCoreTaskQueue::_steal_take(int core_id) {
     DCHECK(core_id < _core_size);
-    int next_id = core_id;
-    for (int i = 1; i < _core_size; ++i) {
-        ++next_id;
-        if (next_id == _core_size) {
-            next_id = 0;
+    if (numa_aware()) {
+        return _steal_take_from(core_id, _steal_victims[core_id]);
+    }
+    const int victim_num = _core_size - 1;
+    if (victim_num <= 0) {
+        return nullptr;
+    }
+    int offset = 0;
+    if (config::enable_pipeline_task_random_steal) {
+        // Start from a random victim, so that idle cores do not all hammer the
+        // queue right after them when only a few cores hold the backlog.
+        static thread_local Random rand(static_cast<uint32_t>(
+                std::hash<std::thread::id>()(std::this_thread::get_id())));
+        offset = static_cast<int>(rand.Uniform(victim_num));
+    }
+    for (int i = 0; i < victim_num; ++i) {
+        int next_id = (core_id + 1 + (offset + i) % victim_num) % _core_size;
+        DCHECK(next_id < _core_size && next_id != core_id);
+        if (_prio_task_queues[next_id].size() == 0) {
+            continue;
         }
-        DCHECK(next_id < _core_size);
         auto task = _prio_task_queues[next_id].try_take(true);
         if (task) {
+            _steal_count.fetch_add(1, std::memory_order_relaxed);
+            DorisMetrics::instance()->pipeline_task_steal_count->increment(1);
             return task;
         }
     }
+    _steal_miss_count.fetch_add(1, std::memory_order_relaxed);
     return nullptr;
 }
 
+PipelineTaskSPtr MultiCoreTaskQueue::_steal_take_from(int core_id,
+                                                      const std::vector<int>& victims) {
+    // Victims are ordered by distance, so only the local node is scanned while it has work.
+    for (int victim : victims) {
+        if (_prio_task_queues[victim].size() == 0) {
+            continue;
+        }
+        auto task = _prio_task_queues[victim].try_take(true);
+        if (task) {
+            _steal_count.fetch_add(1, std::memory_order_relaxed);
+            DorisMetrics::instance()->pipeline_task_steal_count->increment(1);
+            if (_core_to_numa_node[victim] != _core_to_numa_node[core_id]) {
+                DorisMetrics::instance()->pipeline_task_remote_numa_steal_count->increment(1);
+            }
+            return task;
+        }
+    }
+    _steal_miss_count.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+}
+
+int MultiCoreTaskQueue::_next_core_of_task(PipelineTask* task) {
+    if (!numa_aware()) {
+        return _next_core.fetch_add(1) % _core_size;
+    }
+    // All tasks of a query go to the same node, so the hash tables and arenas they build
+    // are touched by the cores local to the memory they were first allocated on.
+    const auto& query_id = task->query_id();
+    auto node = static_cast<int>(hash_value(query_id) % size_t(_numa_node_num));
+    const auto& cores = _numa_node_to_cores[node];
+    auto idx = _next_core_of_numa_node[node].fetch_add(1) % cores.size();
+    return cores[idx];
+}
+
 Status MultiCoreTaskQueue::push_back(PipelineTaskSPtr task) {
     int core_id = task->get_core_id();
     if (core_id < 0) {
-        core_id = _next_core.fetch_add(1) % _core_size;
+        core_id = _next_core_of_task(task.get());
     }
     return push_back(task, core_id);
 }
@@ -82,6 +82,9 @@ public:
         _sub_queues[level].inc_runtime(runtime);
     }
 
+    // Lock free hint used by thieves to skip empty victims without touching the mutex.
+    size_t size() const { return _total_task_size.load(std::memory_order_relaxed); }
+
 private:
     PipelineTaskSPtr _try_take_unprotected(bool is_steal);
     static constexpr auto LEVEL_QUEUE_TIME_FACTOR = 2;
@@ -102,7 +105,9 @@ private:
     int _compute_level(uint64_t real_runtime);
 };
 
-// Need consider NUMA architecture
+// When `enable_numa_aware_pipeline_scheduling` is on and the host has more than one NUMA
+// node, cores are grouped by node: tasks of one query are placed on the cores of a single
+// node and idle cores steal from their own node before crossing the socket.
 class MultiCoreTaskQueue {
 public:
     explicit MultiCoreTaskQueue(int core_size);
@@ -124,15 +129,44 @@ public:
 
     void update_statistics(PipelineTask* task, int64_t time_spent);
 
+    // Number of runnable tasks waiting on the queue of `core_id`, lock free hint.
+    size_t num_waiting_tasks(int core_id) const { return _prio_task_queues[core_id].size(); }
+
     int cores() const { return _core_size; }
 
+    bool numa_aware() const { return _numa_node_num > 1; }
+
+    // NUMA node the worker core `core_id` is grouped into, 0 if not NUMA aware.
+    int numa_node_of_core(int core_id) const {
+        return numa_aware() ? _core_to_numa_node[core_id] : 0;
+    }
+
+    // Number of tasks taken by a core other than the one they were queued on.
+    uint64_t steal_count() const { return _steal_count.load(std::memory_order_relaxed); }
+    // Number of steal rounds that visited every victim without getting a task.
+    uint64_t steal_miss_count() const { return _steal_miss_count.load(std::memory_order_relaxed); }
+
 private:
     PipelineTaskSPtr _steal_take(int core_id);
+    PipelineTaskSPtr _steal_take_from(int core_id, const std::vector<int>& victims);
+    void _init_numa_groups();
+    int _next_core_of_task(PipelineTask* task);
 
     std::vector<PriorityTaskQueue> _prio_task_queues;
     std::atomic<uint32_t> _next_core = 0;
     std::atomic<bool> _closed;
 
+    // NUMA grouping of the worker cores, only built when `numa_aware()`.
+    int _numa_node_num = 1;
+    std::vector<int> _core_to_numa_node;
+    std::vector<std::vector<int>> _numa_node_to_cores;
+    // Steal order for each core: same node first, then the remote nodes.
+    std::vector<std::vector<int>> _steal_victims;
+    std::unique_ptr<std::atomic<uint32_t>[]> _next_core_of_numa_node;
+
+    std::atomic<uint64_t> _steal_count = 0;
+    std::atomic<uint64_t> _steal_miss_count = 0;
+
     int _core_size;
     static constexpr auto WAIT_CORE_TASK_TIMEOUT_MS = 100;
 };
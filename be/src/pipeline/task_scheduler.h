@@ -57,6 +57,10 @@ public:
 
     std::vector<int> thread_debug_info() { return _fix_thread_pool->debug_info(); }
 
+    uint64_t task_steal_count() const { return _task_queue.steal_count(); }
+
+    uint64_t task_steal_miss_count() const { return _task_queue.steal_miss_count(); }
+
 private:
     std::unique_ptr<ThreadPool> _fix_thread_pool;
 
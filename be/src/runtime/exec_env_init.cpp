@@ -41,6 +41,7 @@
 #include "common/kerberos/kerberos_ticket_mgr.h"
 #include "common/logging.h"
 #include "common/status.h"
+#include "exprs/regexp_cache.h"
 #include "io/cache/block_file_cache.h"
 #include "io/cache/block_file_cache_downloader.h"
 #include "io/cache/block_file_cache_factory.h"
@@ -257,6 +258,18 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths,
                               .set_min_threads(config::min_s3_file_system_thread_num)
                               .set_max_threads(config::max_s3_file_system_thread_num)
                               .build(&_s3_file_system_thread_pool));
+    if (config::csv_parse_thread_num > 0) {
+        static_cast<void>(ThreadPoolBuilder("CsvParseThreadPool")
+                                  .set_min_threads(config::csv_parse_thread_num)
+                                  .set_max_threads(config::csv_parse_thread_num)
+                                  .build(&_csv_parse_thread_pool));
+    }
+    if (config::sort_merge_thread_num > 0) {
+        static_cast<void>(ThreadPoolBuilder("SortMergeThreadPool")
+                                  .set_min_threads(config::sort_merge_thread_num)
+                                  .set_max_threads(config::sort_merge_thread_num)
+                                  .build(&_sort_merge_thread_pool));
+    }
     RETURN_IF_ERROR(_init_mem_env());
 
     // NOTE: runtime query statistics mgr could be visited by query and daemon thread
@@ -491,8 +504,12 @@ Status ExecEnv::_init_mem_env() {
     while (!is_percent && pk_storage_page_cache_limit > MemInfo::mem_limit() / 2) {
         pk_storage_page_cache_limit = storage_cache_limit / 2;
     }
+    int64_t decoded_page_cache_limit =
+            ParseUtil::parse_mem_spec(config::decoded_page_cache_limit, MemInfo::mem_limit(),
+                                      MemInfo::physical_mem(), &is_percent);
     _storage_page_cache = StoragePageCache::create_global_cache(
-            storage_cache_limit, index_percentage, pk_storage_page_cache_limit, num_shards);
+            storage_cache_limit, index_percentage, pk_storage_page_cache_limit, num_shards,
+            decoded_page_cache_limit);
     LOG(INFO) << "Storage page cache memory limit: "
               << PrettyPrinter::print(storage_cache_limit, TUnit::BYTES)
               << ", origin config value: " << config::storage_page_cache_limit;
@@ -546,6 +563,7 @@ Status ExecEnv::_init_mem_env() {
     config::file_cache_max_file_reader_cache_size = block_file_cache_fd_cache_size;
 
     _file_meta_cache = new FileMetaCache(config::max_external_file_meta_cache_num);
+    _regexp_cache = RegexpCache::create_global_cache(config::regexp_cache_capacity);
 
     _lookup_connection_cache =
             LookupConnectionCache::create_global_instance(config::lookup_connection_cache_capacity);
@@ -752,6 +770,8 @@ void ExecEnv::destroy() {
     SAFE_SHUTDOWN(_lazy_release_obj_pool);
     SAFE_SHUTDOWN(_non_block_close_thread_pool);
     SAFE_SHUTDOWN(_s3_file_system_thread_pool);
+    SAFE_SHUTDOWN(_csv_parse_thread_pool);
+    SAFE_SHUTDOWN(_sort_merge_thread_pool);
     SAFE_SHUTDOWN(_send_batch_thread_pool);
     SAFE_SHUTDOWN(_send_table_stats_thread_pool);
 
@@ -781,6 +801,7 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_load_path_mgr);
     SAFE_DELETE(_result_mgr);
     SAFE_DELETE(_file_meta_cache);
+    SAFE_DELETE(_regexp_cache);
     SAFE_DELETE(_group_commit_mgr);
     SAFE_DELETE(_routine_load_task_executor);
     // _stream_load_executor
@@ -804,6 +825,8 @@ void ExecEnv::destroy() {
     _lazy_release_obj_pool.reset(nullptr);
     _non_block_close_thread_pool.reset(nullptr);
     _s3_file_system_thread_pool.reset(nullptr);
+    _csv_parse_thread_pool.reset(nullptr);
+    _sort_merge_thread_pool.reset(nullptr);
     _send_table_stats_thread_pool.reset(nullptr);
     _buffered_reader_prefetch_thread_pool.reset(nullptr);
     _s3_file_upload_thread_pool.reset(nullptr);
@@ -20,6 +20,7 @@
 #include <gen_cpp/Types_types.h>
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <chrono>
 
 #include "client_cache.h"
@@ -27,15 +28,68 @@
 #include "common/compiler_util.h"
 #include "common/config.h"
 #include "common/status.h"
+#include "olap/memtable_memory_limiter.h"
 #include "pipeline/dependency.h"
 #include "runtime/exec_env.h"
 #include "runtime/fragment_mgr.h"
 #include "util/debug_points.h"
 #include "util/thrift_rpc_helper.h"
+#include "util/time.h"
 
 namespace doris {
 
 bvar::Adder<uint64_t> group_commit_block_by_memory_counter("group_commit_block_by_memory_counter");
+bvar::IntRecorder g_group_commit_adaptive_interval_ms("group_commit_adaptive_interval_ms");
+bvar::IntRecorder g_group_commit_adaptive_data_bytes("group_commit_adaptive_data_bytes");
+bvar::LatencyRecorder g_group_commit_commit_latency_ms("group_commit_commit_latency_ms");
+
+// the weight of the last group commit in the averages of GroupCommitController
+static constexpr double GROUP_COMMIT_HISTORY_WEIGHT = 0.3;
+// a fast load commits at most this many times group_commit_data_bytes at once
+static constexpr int64_t GROUP_COMMIT_MAX_DATA_BYTES_FACTOR = 8;
+// the base is used once this part of the memory limits of loads is in use
+static constexpr double GROUP_COMMIT_MEMORY_PRESSURE = 0.5;
+
+GroupCommitController::Decision GroupCommitController::decide(int64_t base_interval_ms,
+                                                              int64_t base_data_bytes,
+                                                              double memory_pressure) {
+    Decision decision {base_interval_ms, base_data_bytes};
+    if (!config::enable_group_commit_adaptive_batching ||
+        memory_pressure >= GROUP_COMMIT_MEMORY_PRESSURE) {
+        return decision;
+    }
+    std::lock_guard l(_lock);
+    if (!_has_history) {
+        return decision;
+    }
+    int64_t max_interval_ms =
+            std::max(base_interval_ms, config::group_commit_adaptive_max_interval_ms);
+    // the time to collect the base data bytes at the current rate
+    double fill_ms = _bytes_per_ms > 0 ? static_cast<double>(base_data_bytes) / _bytes_per_ms
+                                       : static_cast<double>(max_interval_ms);
+    auto interval_ms = static_cast<int64_t>(std::max(fill_ms, _commit_ms));
+    decision.interval_ms = std::clamp(interval_ms, base_interval_ms, max_interval_ms);
+    auto data_bytes =
+            static_cast<int64_t>(_bytes_per_ms * static_cast<double>(decision.interval_ms));
+    decision.data_bytes = std::clamp(data_bytes, base_data_bytes,
+                                     base_data_bytes * GROUP_COMMIT_MAX_DATA_BYTES_FACTOR);
+    return decision;
+}
+
+void GroupCommitController::update(int64_t data_bytes, int64_t duration_ms, int64_t commit_ms) {
+    g_group_commit_commit_latency_ms << commit_ms;
+    double bytes_per_ms = static_cast<double>(data_bytes) /
+                          static_cast<double>(std::max<int64_t>(duration_ms, 1));
+    std::lock_guard l(_lock);
+    if (!_has_history) {
+        _bytes_per_ms = bytes_per_ms;
+        _commit_ms = static_cast<double>(commit_ms);
+        _has_history = true;
+        return;
+    }
+    _bytes_per_ms += GROUP_COMMIT_HISTORY_WEIGHT * (bytes_per_ms - _bytes_per_ms);
+    _commit_ms += GROUP_COMMIT_HISTORY_WEIGHT * (static_cast<double>(commit_ms) - _commit_ms);
+}
 
 std::string LoadBlockQueue::_get_load_ids() {
     std::stringstream ss;
@@ -61,6 +115,7 @@ Status LoadBlockQueue::add_block(RuntimeState* runtime_state,
     LOG(INFO) << "query_id: " << print_id(runtime_state->query_id())
               << ", add block rows=" << block->rows() << ", use group_commit label=" << label;
     DBUG_EXECUTE_IF("LoadBlockQueue.add_block.block", DBUG_BLOCK);
+    bool wal_written = false;
     if (block->rows() > 0) {
         if (!config::group_commit_wait_replay_wal_finish) {
             _block_queue.emplace_back(block);
@@ -80,6 +135,7 @@ Status LoadBlockQueue::add_block(RuntimeState* runtime_state,
                 _cancel_without_lock(st);
                 return st;
             }
+            wal_written = true;
         }
         if (!runtime_state->is_cancelled() && status.ok() &&
             _all_block_queues_bytes->load(std::memory_order_relaxed) >=
@@ -111,6 +167,17 @@ Status LoadBlockQueue::add_block(RuntimeState* runtime_state,
         read_dep->set_ready();
         VLOG_DEBUG << "set ready for inner load_id=" << load_instance_id;
     }
+    if (wal_written) {
+        // wait out of the lock, so the loads of the queue share the sync of the wal
+        auto v_wal_writer = _v_wal_writer;
+        l.unlock();
+        auto st = v_wal_writer->sync_wal();
+        if (!st.ok()) {
+            l.lock();
+            _cancel_without_lock(st);
+            return st;
+        }
+    }
     return Status::OK();
 }
 
@@ -385,10 +452,24 @@ Status GroupCommitTable::_create_group_commit_load(int be_exe_version,
                    << ", label=" << label << ", txn_id=" << txn_id
                    << ", instance_id=" << print_id(instance_id);
         {
+            double memory_pressure =
+                    static_cast<double>(_all_block_queues_bytes->load()) /
+                    static_cast<double>(std::max(config::group_commit_queue_mem_limit, 1));
+            auto* memtable_limiter = _exec_env->memtable_memory_limiter();
+            if (memtable_limiter != nullptr && memtable_limiter->load_soft_mem_limit() > 0) {
+                memory_pressure = std::max(
+                        memory_pressure,
+                        static_cast<double>(memtable_limiter->mem_usage()) /
+                                static_cast<double>(memtable_limiter->load_soft_mem_limit()));
+            }
+            auto decision = _controller.decide(result.group_commit_interval_ms,
+                                               result.group_commit_data_bytes, memory_pressure);
+            g_group_commit_adaptive_interval_ms << decision.interval_ms;
+            g_group_commit_adaptive_data_bytes << decision.data_bytes;
             auto load_block_queue = std::make_shared<LoadBlockQueue>(
                     instance_id, label, txn_id, schema_version, index_size, _all_block_queues_bytes,
-                    result.wait_internal_group_commit_finish, result.group_commit_interval_ms,
-                    result.group_commit_data_bytes);
+                    result.wait_internal_group_commit_finish, decision.interval_ms,
+                    decision.data_bytes);
             RETURN_IF_ERROR(load_block_queue->create_wal(
                     _db_id, _table_id, txn_id, label, _exec_env->wal_mgr(),
                     pipeline_params.fragment.output_sink.olap_table_sink.schema.slot_descs,
@@ -432,6 +513,7 @@ Status GroupCommitTable::_finish_group_commit_load(int64_t db_id, int64_t table_
                                                    RuntimeState* state) {
     Status st;
     Status result_status;
+    int64_t commit_ms = 0;
     DBUG_EXECUTE_IF("LoadBlockQueue._finish_group_commit_load.err_status",
                     { status = Status::InternalError(""); });
     DBUG_EXECUTE_IF("LoadBlockQueue._finish_group_commit_load.load_error",
@@ -461,6 +543,7 @@ Status GroupCommitTable::_finish_group_commit_load(int64_t db_id, int64_t table_
         TLoadTxnCommitResult result;
         TNetworkAddress master_addr = _exec_env->cluster_info()->master_fe_addr;
         int retry_times = 0;
+        int64_t commit_start_ms = MonotonicMillis();
         while (retry_times < config::mow_stream_load_commit_retry_times) {
             st = ThriftRpcHelper::rpc<FrontendServiceClient>(
                     master_addr.hostname, master_addr.port,
@@ -480,6 +563,7 @@ Status GroupCommitTable::_finish_group_commit_load(int64_t db_id, int64_t table_
                     .error(result_status);
             retry_times++;
         }
+        commit_ms = MonotonicMillis() - commit_start_ms;
         DBUG_EXECUTE_IF("LoadBlockQueue._finish_group_commit_load.commit_success_and_rpc_error",
                         { result_status = Status::InternalError("commit_success_and_rpc_error"); });
     } else {
@@ -514,6 +598,9 @@ Status GroupCommitTable::_finish_group_commit_load(int64_t db_id, int64_t table_
             load_block_queue = it->second;
             if (!status.ok()) {
                 load_block_queue->cancel(status);
+            } else if (st.ok() && result_status.ok()) {
+                _controller.update(load_block_queue->data_bytes(),
+                                   load_block_queue->age_ms() - commit_ms, commit_ms);
             }
             //close wal
             RETURN_IF_ERROR(load_block_queue->close_wal());
@@ -20,6 +20,7 @@
 #include <gen_cpp/PaloInternalService_types.h>
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <future>
@@ -52,6 +53,33 @@ struct BlockData {
     size_t block_bytes;
 };
 
+// Decides the commit interval and data size of the group commits of a table. The table
+// properties are the base. A slow load waits up to group_commit_adaptive_max_interval_ms to
+// collect group_commit_data_bytes, so that it does not commit tiny rowsets. A fast load commits
+// about what arrives in an interval at once, so that it does not commit more often than the
+// interval. The commits are not started faster than they finish, and the base is used as it is
+// while the loads are short of memory.
+class GroupCommitController {
+public:
+    struct Decision {
+        int64_t interval_ms;
+        int64_t data_bytes;
+    };
+
+    // `memory_pressure` is the part of the memory limits of the loads in use
+    Decision decide(int64_t base_interval_ms, int64_t base_data_bytes, double memory_pressure);
+
+    // A group commit collected `data_bytes` in `duration_ms` and took `commit_ms` to commit.
+    void update(int64_t data_bytes, int64_t duration_ms, int64_t commit_ms);
+
+private:
+    std::mutex _lock;
+    bool _has_history = false;
+    // exponentially weighted averages of the group commits
+    double _bytes_per_ms = 0;
+    double _commit_ms = 0;
+};
+
 class LoadBlockQueue {
 public:
     LoadBlockQueue(const UniqueId& load_instance_id, std::string& label, int64_t txn_id,
@@ -90,6 +118,15 @@ public:
     void append_dependency(std::shared_ptr<pipeline::Dependency> finish_dep);
     void append_read_dependency(std::shared_ptr<pipeline::Dependency> read_dep);
     int64_t get_group_commit_interval_ms() { return _group_commit_interval_ms; };
+    int64_t data_bytes() {
+        std::unique_lock l(mutex);
+        return _data_bytes;
+    }
+    int64_t age_ms() const {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+                       std::chrono::steady_clock::now() - _start_time)
+                .count();
+    }
 
     std::string debug_string() const {
         fmt::memory_buffer debug_string_buffer;
@@ -197,6 +234,7 @@ private:
                                   std::shared_ptr<pipeline::Dependency>, int64_t, int64_t>>
             _create_plan_deps;
     std::string _create_plan_failed_reason;
+    GroupCommitController _controller;
 };
 
 class GroupCommitMgr {
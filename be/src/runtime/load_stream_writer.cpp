@@ -27,6 +27,7 @@
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "bvar/bvar.h"
 #include "cloud/config.h"
@@ -72,6 +73,8 @@ using namespace ErrorCode;
 
 bvar::Adder<int64_t> g_load_stream_writer_cnt("load_stream_writer_count");
 bvar::Adder<int64_t> g_load_stream_file_writer_cnt("load_stream_file_writer_count");
+bvar::Adder<int64_t> g_load_stream_append_bytes("load_stream_append_bytes");
+bvar::Adder<int64_t> g_load_stream_append_blocks("load_stream_append_blocks");
 
 LoadStreamWriter::LoadStreamWriter(WriteRequest* context, RuntimeProfile* profile)
         : _req(*context), _rowset_writer(nullptr) {
@@ -123,7 +126,6 @@ Status LoadStreamWriter::append_data(uint32_t segid, uint64_t offset, butil::IOB
             }
         }
 
-        // TODO: IOBuf to Slice
         file_writer = file_writers[segid].get();
     }
     DBUG_EXECUTE_IF("LoadStreamWriter.append_data.null_file_writer", { file_writer = nullptr; });
@@ -137,7 +139,16 @@ Status LoadStreamWriter::append_data(uint32_t segid, uint64_t offset, butil::IOB
                 "append_data out-of-order in segment={}, expected offset={}, actual={}",
                 file_writer->path().native(), offset, file_writer->bytes_appended());
     }
-    return file_writer->append(buf.to_string());
+    // pass the blocks of the buf to the file writer as they are, without flattening them
+    std::vector<Slice> slices;
+    slices.reserve(buf.backing_block_num());
+    for (size_t i = 0; i < buf.backing_block_num(); ++i) {
+        auto block = buf.backing_block(i);
+        slices.emplace_back(block.data(), block.size());
+    }
+    g_load_stream_append_bytes << static_cast<int64_t>(buf.size());
+    g_load_stream_append_blocks << static_cast<int64_t>(slices.size());
+    return file_writer->appendv(slices.data(), slices.size());
 }
 
 Status LoadStreamWriter::close_writer(uint32_t segid, FileType file_type) {
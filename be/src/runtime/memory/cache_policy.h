@@ -56,6 +56,8 @@ public:
         QUERY_CACHE = 20,
         TABLET_COLUMN_OBJECT_POOL = 21,
         SCHEMA_CLOUD_DICTIONARY_CACHE = 22,
+        DECODED_PAGE_CACHE = 23,
+        REGEXP_CACHE = 24,
     };
 
     static std::string type_string(CacheType type) {
@@ -104,6 +106,10 @@ public:
             return "TabletColumnObjectPool";
         case CacheType::SCHEMA_CLOUD_DICTIONARY_CACHE:
             return "SchemaCloudDictionaryCache";
+        case CacheType::DECODED_PAGE_CACHE:
+            return "DecodedPageCache";
+        case CacheType::REGEXP_CACHE:
+            return "RegexpCache";
         default:
             throw Exception(Status::FatalError("not match type of cache policy :{}",
                                                static_cast<int>(type)));
@@ -134,6 +140,8 @@ public:
             {"QueryCache", CacheType::QUERY_CACHE},
             {"TabletColumnObjectPool", CacheType::TABLET_COLUMN_OBJECT_POOL},
             {"SchemaCloudDictionaryCache", CacheType::SCHEMA_CLOUD_DICTIONARY_CACHE},
+            {"DecodedPageCache", CacheType::DECODED_PAGE_CACHE},
+            {"RegexpCache", CacheType::REGEXP_CACHE},
     };
 
     static CacheType string_to_type(std::string type) {
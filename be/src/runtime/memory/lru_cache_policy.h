@@ -73,6 +73,8 @@ public:
 
     void reset_cache() { _cache.reset(); }
 
+    void set_tiny_lfu_admission(bool enable) { _cache->set_tiny_lfu_admission(enable); }
+
     bool check_capacity(size_t capacity, uint32_t num_shards) {
         if (capacity < num_shards) {
             LOG(INFO) << fmt::format(
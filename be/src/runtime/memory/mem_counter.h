@@ -42,7 +42,10 @@ public:
             return;
         }
         int64_t value = _current_value.fetch_add(delta, std::memory_order_relaxed) + delta;
-        update_peak(value);
+        // A release can never raise the peak, skip touching its cache line.
+        if (delta > 0) {
+            update_peak(value);
+        }
     }
 
     void add_no_update_peak(int64_t delta) { // need extreme fast
@@ -85,7 +88,10 @@ public:
 
 private:
     std::atomic<int64_t> _current_value {0};
-    std::atomic<int64_t> _peak_value {0};
+    // Every thread that flushes into a shared tracker writes `_current_value`, while the peak is
+    // mostly read. Keep them on separate cache lines so reading the peak does not keep pulling
+    // the line being written by other cores.
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> _peak_value {0};
 };
 
 #include "common/compile_check_end.h"
@@ -24,6 +24,7 @@
 #include <string>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "librdkafka/rdkafkacpp.h"
 #include "runtime/routine_load/data_consumer.h"
@@ -114,7 +115,10 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx,
 
     //improve performance
     Status (io::KafkaConsumerPipe::*append_data)(const char* data, size_t size);
-    if (ctx->format == TFileFormatType::FORMAT_JSON) {
+    if (ctx->format == TFileFormatType::FORMAT_JSON &&
+        !(ctx->read_json_by_line && !ctx->is_multi_table &&
+          config::enable_routine_load_json_batching_by_line)) {
+        // the json reader reads one message per buffer
         append_data = &io::KafkaConsumerPipe::append_json;
     } else {
         append_data = &io::KafkaConsumerPipe::append_with_line_delimiter;
@@ -289,6 +289,15 @@ Status RoutineLoadTaskExecutor::submit_task(const TRoutineLoadTask& task) {
     if (task.__isset.format) {
         ctx->format = task.format;
     }
+    if (task.__isset.pipeline_params && task.pipeline_params.__isset.file_scan_params) {
+        for (const auto& [_, scan_params] : task.pipeline_params.file_scan_params) {
+            if (scan_params.__isset.file_attributes &&
+                scan_params.file_attributes.__isset.read_json_by_line &&
+                scan_params.file_attributes.read_json_by_line) {
+                ctx->read_json_by_line = true;
+            }
+        }
+    }
     // the routine load task'txn has already began in FE.
     // so it need to rollback if encounter error.
     ctx->need_rollback = true;
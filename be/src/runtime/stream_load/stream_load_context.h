@@ -192,6 +192,8 @@ public:
     bool use_streaming = false;
     TFileFormatType::type format = TFileFormatType::FORMAT_CSV_PLAIN;
     TFileCompressType::type compress_type = TFileCompressType::UNKNOWN;
+    // whether the scan of a routine load plan reads json by line
+    bool read_json_by_line = false;
     bool group_commit = false;
 
     std::shared_ptr<MessageBodySink> body_sink;
@@ -48,6 +48,8 @@ public:
                                                   vectorized::VExprContextSPtrs& conjuncts,
                                                   const RowDescriptor& row_descriptor);
 
+    size_t runtime_filter_nums() const { return _runtime_filter_descs.size(); }
+
     // Called by XXXLocalState::close()
     // parent_operator_profile is owned by LocalState so update it is safe at here.
     void collect_realtime_profile(RuntimeProfile* parent_operator_profile);
@@ -303,18 +303,27 @@ Status RuntimeFilterMergeControllerEntity::merge(std::shared_ptr<QueryContext> q
     }
     auto& cnt_val = iter->second;
     bool is_ready = false;
+    // Skip the other broadcast join runtime filter
+    auto skip_filter = [&]() {
+        return cnt_val.arrive_id.size() == 1 && cnt_val.runtime_filter_desc.is_broadcast_join;
+    };
     {
         std::lock_guard<std::mutex> l(iter->second.mtx);
-        // Skip the other broadcast join runtime filter
-        if (cnt_val.arrive_id.size() == 1 && cnt_val.runtime_filter_desc.is_broadcast_join) {
+        if (skip_filter()) {
+            return Status::OK();
+        }
+    }
+    // Deserialize the arriving filter outside the lock, with many producers the merge node
+    // would otherwise copy every bloom filter while the other arriving rpcs wait.
+    std::shared_ptr<RuntimeFilterProducer> tmp_filter;
+    RETURN_IF_ERROR(RuntimeFilterProducer::create(query_ctx.get(), &cnt_val.runtime_filter_desc,
+                                                  &tmp_filter));
+    RETURN_IF_ERROR(tmp_filter->assign(*request, attach_data));
+    {
+        std::lock_guard<std::mutex> l(iter->second.mtx);
+        if (skip_filter()) {
             return Status::OK();
         }
-        std::shared_ptr<RuntimeFilterProducer> tmp_filter;
-        RETURN_IF_ERROR(RuntimeFilterProducer::create(query_ctx.get(), &cnt_val.runtime_filter_desc,
-                                                      &tmp_filter));
-
-        RETURN_IF_ERROR(tmp_filter->assign(*request, attach_data));
-
         RETURN_IF_ERROR(cnt_val.merger->merge_from(tmp_filter.get()));
 
         cnt_val.arrive_id.insert(UniqueId(request->fragment_instance_id()));
@@ -246,7 +246,12 @@ void RuntimeFilterProducer::set_synced_size(uint64_t global_size) {
 }
 
 Status RuntimeFilterProducer::init(size_t local_size) {
-    return _wrapper->init(_synced_size != -1 ? _synced_size : local_size);
+    // A synced size is shared by all producers of a global filter, which must agree on the
+    // filter type and bloom size, so only the local size may be refined by the actual ndv.
+    if (_synced_size != -1) {
+        return _wrapper->init(_synced_size);
+    }
+    return _wrapper->init(local_size, true);
 }
 
 } // namespace doris
@@ -71,8 +71,14 @@ Status RuntimeFilterWrapper::_change_to_bloom_filter() {
     return Status::OK();
 }
 
-Status RuntimeFilterWrapper::init(const size_t real_size) {
-    if (_filter_type == RuntimeFilterType::IN_OR_BLOOM_FILTER && real_size > _max_in_num) {
+Status RuntimeFilterWrapper::init(const size_t real_size, bool decide_by_ndv) {
+    // Build sides with many duplicated keys often have fewer distinct values than max_in_num,
+    // an in filter is more selective and can be pushed down to the storage layer.
+    // The limit bounds the memory of the hybrid set before it is known to be too large.
+    static constexpr size_t max_rows_per_in_num_to_decide_by_ndv = 8;
+    if (_filter_type == RuntimeFilterType::IN_OR_BLOOM_FILTER && real_size > _max_in_num &&
+        !(decide_by_ndv &&
+          real_size <= max_rows_per_in_num_to_decide_by_ndv * std::max(_max_in_num, 0))) {
         RETURN_IF_ERROR(_change_to_bloom_filter());
     }
     if (get_real_type() == RuntimeFilterType::IN_FILTER && real_size > _max_in_num) {
@@ -113,6 +119,10 @@ Status RuntimeFilterWrapper::insert(const vectorized::ColumnPtr& column, size_t
             _bloom_filter_func->insert_fixed_len(column, start);
         } else {
             _hybrid_set->insert_fixed_len(column, start);
+            if (_max_in_num >= 0 && _hybrid_set->size() > _max_in_num) {
+                // The measured ndv is too large for an in filter.
+                RETURN_IF_ERROR(_change_to_bloom_filter());
+            }
         }
         break;
     }
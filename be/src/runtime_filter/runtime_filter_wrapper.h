@@ -53,7 +53,10 @@ public:
               _max_in_num(max_in_num),
               _state(state) {}
 
-    Status init(const size_t runtime_size);
+    // `runtime_size` is the number of build rows. If `decide_by_ndv` is true and it is not far
+    // above max_in_num, an IN_OR_BLOOM_FILTER stays an in filter and only changes to a bloom
+    // filter when the distinct values inserted exceed max_in_num.
+    Status init(const size_t runtime_size, bool decide_by_ndv = false);
     Status insert(const vectorized::ColumnPtr& column, size_t start);
     Status merge(const RuntimeFilterWrapper* wrapper);
     template <class T>
@@ -26,8 +26,12 @@
 #include <google/protobuf/extension_set.h>
 #include <stdlib.h>
 
+#include <algorithm>
 #include <climits>
+#include <map>
 #include <memory>
+#include <numeric>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -134,11 +138,11 @@ Status Reusable::init(const TDescriptorTable& t_desc_tbl, const std::vector<TExp
     _runtime_state->set_query_options(query_options);
     RETURN_IF_ERROR(DescriptorTbl::create(_runtime_state->obj_pool(), t_desc_tbl, &_desc_tbl));
     _runtime_state->set_desc_tbl(_desc_tbl);
-    _block_pool.resize(block_size);
-    for (auto& i : _block_pool) {
-        i = vectorized::Block::create_unique(tuple_desc()->slots(), 2);
+    for (size_t i = 0; i < block_size; ++i) {
+        auto block = vectorized::Block::create_unique(tuple_desc()->slots(), 2);
         // Name is useless but cost space
-        i->clear_names();
+        block->clear_names();
+        _block_pool[i % kBlockPoolShards].blocks.push_back(std::move(block));
     }
 
     RETURN_IF_ERROR(vectorized::VExpr::create_expr_trees(output_exprs, _output_exprs_ctxs));
@@ -180,29 +184,42 @@ Status Reusable::init(const TDescriptorTable& t_desc_tbl, const std::vector<TExp
     return Status::OK();
 }
 
+Reusable::BlockPoolShard& Reusable::_current_shard() {
+    return _block_pool[std::hash<std::thread::id> {}(std::this_thread::get_id()) %
+                       kBlockPoolShards];
+}
+
 std::unique_ptr<vectorized::Block> Reusable::get_block() {
-    std::lock_guard lock(_block_mutex);
-    if (_block_pool.empty()) {
-        auto block = vectorized::Block::create_unique(tuple_desc()->slots(), 2);
-        // Name is useless but cost space
-        block->clear_names();
-        return block;
+    auto& shard = _current_shard();
+    {
+        std::lock_guard lock(shard.mutex);
+        if (!shard.blocks.empty()) {
+            auto block = std::move(shard.blocks.back());
+            CHECK(block != nullptr);
+            shard.blocks.pop_back();
+            return block;
+        }
     }
-    auto block = std::move(_block_pool.back());
-    CHECK(block != nullptr);
-    _block_pool.pop_back();
+    auto block = vectorized::Block::create_unique(tuple_desc()->slots(), 2);
+    // Name is useless but cost space
+    block->clear_names();
     return block;
 }
 
 void Reusable::return_block(std::unique_ptr<vectorized::Block>& block) {
-    std::lock_guard lock(_block_mutex);
     if (block == nullptr) {
         return;
     }
+    // Clear outside the lock, it touches every column of the block
     block->clear_column_data();
-    _block_pool.push_back(std::move(block));
-    if (_block_pool.size() > s_preallocted_blocks_num) {
-        _block_pool.resize(s_preallocted_blocks_num);
+    constexpr size_t max_blocks_per_shard =
+            std::max<size_t>(1, s_preallocted_blocks_num / kBlockPoolShards);
+    auto& shard = _current_shard();
+    std::lock_guard lock(shard.mutex);
+    if (shard.blocks.size() < max_blocks_per_shard) {
+        shard.blocks.push_back(std::move(block));
+    } else {
+        block.reset();
     }
 }
 
@@ -418,7 +435,16 @@ Status PointQueryExecutor::_lookup_row_key() {
         specified_rowsets = _tablet->get_rowset_by_ids(nullptr);
     }
     std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(specified_rowsets.size());
-    for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
+    // Look up the keys in sorted order, so that consecutive seeks in the primary key indexes hit
+    // the same or adjacent pages. Results stay in the request's order in `_row_read_ctxs`.
+    std::vector<size_t> lookup_order(_row_read_ctxs.size());
+    std::iota(lookup_order.begin(), lookup_order.end(), 0);
+    if (lookup_order.size() > 1) {
+        std::sort(lookup_order.begin(), lookup_order.end(), [this](size_t lhs, size_t rhs) {
+            return _row_read_ctxs[lhs]._primary_key < _row_read_ctxs[rhs]._primary_key;
+        });
+    }
+    for (size_t i : lookup_order) {
         RowLocation location;
         if (!config::disable_storage_row_cache) {
             RowCache::CacheHandle cache_handle;
@@ -454,6 +480,8 @@ Status PointQueryExecutor::_lookup_row_key() {
 Status PointQueryExecutor::_lookup_row_data() {
     // 3. get values
     SCOPED_TIMER(&_profile_metrics.lookup_data_ns);
+    // Segments loaded for the column store reads, shared by the keys of the same rowset
+    std::map<RowsetId, SegmentCacheHandle> segment_caches;
     for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
         if (_row_read_ctxs[i]._cached_row_data.valid()) {
             RETURN_IF_ERROR(vectorized::JsonbSerializeUtil::jsonb_to_block(
@@ -495,13 +523,17 @@ Status PointQueryExecutor::_lookup_row_data() {
             }
             // fill missing columns by column store
             RowLocation row_loc = _row_read_ctxs[i]._row_location.value();
-            BetaRowsetSharedPtr rowset =
-                    std::static_pointer_cast<BetaRowset>(_tablet->get_rowset(row_loc.rowset_id));
-            SegmentCacheHandle segment_cache;
-            {
+            auto [cache_it, inserted] = segment_caches.try_emplace(row_loc.rowset_id);
+            SegmentCacheHandle& segment_cache = cache_it->second;
+            if (inserted) {
+                BetaRowsetSharedPtr rowset = std::static_pointer_cast<BetaRowset>(
+                        _tablet->get_rowset(row_loc.rowset_id));
                 SCOPED_TIMER(&_profile_metrics.load_segment_data_stage_ns);
-                RETURN_IF_ERROR(
-                        SegmentLoader::instance()->load_segments(rowset, &segment_cache, true));
+                Status st = SegmentLoader::instance()->load_segments(rowset, &segment_cache, true);
+                if (!st.ok()) {
+                    segment_caches.erase(cache_it);
+                    return st;
+                }
             }
             // find segment
             auto it = std::find_if(segment_cache.get_segments().cbegin(),
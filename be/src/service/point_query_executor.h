@@ -26,6 +26,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <array>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -93,9 +94,9 @@ public:
 
     int32_t rs_column_uid() const { return _row_store_column_ids; }
 
-    const std::unordered_set<int32_t> missing_col_uids() const { return _missing_col_uids; }
+    const std::unordered_set<int32_t>& missing_col_uids() const { return _missing_col_uids; }
 
-    const std::unordered_set<int32_t> include_col_uids() const { return _include_col_uids; }
+    const std::unordered_set<int32_t>& include_col_uids() const { return _include_col_uids; }
 
     RuntimeState* runtime_state() { return _runtime_state.get(); }
 
@@ -103,12 +104,21 @@ public:
     int32_t delete_sign_idx() const { return _delete_sign_idx; }
 
 private:
+    // Blocks are pooled in several shards picked by the calling thread, so concurrent
+    // lookups of the same prepared statement rarely contend on one mutex
+    static constexpr size_t kBlockPoolShards = 8;
+    struct BlockPoolShard {
+        std::mutex mutex;
+        // prevent from allocte too many tmp blocks
+        std::vector<std::unique_ptr<vectorized::Block>> blocks;
+    };
+
+    BlockPoolShard& _current_shard();
+
     // caching TupleDescriptor, output_expr, etc...
     std::unique_ptr<RuntimeState> _runtime_state;
     DescriptorTbl* _desc_tbl = nullptr;
-    std::mutex _block_mutex;
-    // prevent from allocte too many tmp blocks
-    std::vector<std::unique_ptr<vectorized::Block>> _block_pool;
+    std::array<BlockPoolShard, kBlockPoolShards> _block_pool;
     vectorized::VExprContextSPtrs _output_exprs_ctxs;
     int64_t _create_timestamp = 0;
     vectorized::DataTypeSerDeSPtrs _data_type_serdes;
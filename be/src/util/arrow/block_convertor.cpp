@@ -22,6 +22,10 @@
 #include <arrow/array/builder_decimal.h>
 #include <arrow/array/builder_nested.h>
 #include <arrow/array/builder_primitive.h>
+#include <arrow/array/data.h>
+#include <arrow/array/util.h>
+#include <arrow/buffer.h>
+#include <arrow/memory_pool.h>
 #include <arrow/record_batch.h>
 #include <arrow/status.h>
 #include <arrow/type.h>
@@ -31,7 +35,9 @@
 #include <cctz/time_zone.h>
 #include <glog/logging.h>
 
+#include <cstring>
 #include <ctime>
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -39,7 +45,10 @@
 #include "common/status.h"
 #include "util/arrow/row_batch.h"
 #include "util/arrow/utils.h"
+#include "util/simd/bits.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/data_types/data_type.h"
 #include "vec/data_types/data_type_array.h"
@@ -52,6 +61,17 @@ class Array;
 
 namespace doris {
 
+// Arrow buffer that points into the memory of a doris column and keeps the column alive,
+// so fixed-width and string columns can be handed to arrow without copying their values.
+class ColumnDataBuffer : public arrow::Buffer {
+public:
+    ColumnDataBuffer(vectorized::ColumnPtr column, const uint8_t* data, int64_t size)
+            : arrow::Buffer(data, size), _column(std::move(column)) {}
+
+private:
+    vectorized::ColumnPtr _column;
+};
+
 class FromBlockConverter {
 public:
     FromBlockConverter(const vectorized::Block& block, const std::shared_ptr<arrow::Schema>& schema,
@@ -67,6 +87,12 @@ public:
     Status convert(std::shared_ptr<arrow::RecordBatch>* out);
 
 private:
+    // Builds the arrow array directly on top of the column memory when the doris and arrow
+    // layouts are identical. Returns false if the column has to go through the serde.
+    bool _try_zero_copy(const vectorized::ColumnPtr& column,
+                        const std::shared_ptr<arrow::DataType>& arrow_type,
+                        std::shared_ptr<arrow::Array>* out);
+
     const vectorized::Block& _block;
     const std::shared_ptr<arrow::Schema>& _schema;
     arrow::MemoryPool* _pool;
@@ -83,6 +109,110 @@ private:
     std::vector<std::shared_ptr<arrow::Array>> _arrays;
 };
 
+bool FromBlockConverter::_try_zero_copy(const vectorized::ColumnPtr& column,
+                                        const std::shared_ptr<arrow::DataType>& arrow_type,
+                                        std::shared_ptr<arrow::Array>* out) {
+    bool is_string = false;
+    switch (arrow_type->id()) {
+    case arrow::Type::INT8:
+    case arrow::Type::INT16:
+    case arrow::Type::INT32:
+    case arrow::Type::INT64:
+    case arrow::Type::FLOAT:
+    case arrow::Type::DOUBLE:
+        break;
+    case arrow::Type::STRING:
+        is_string = true;
+        break;
+    default:
+        return false;
+    }
+    switch (vectorized::remove_nullable(_cur_type)->get_primitive_type()) {
+    case TYPE_TINYINT:
+    case TYPE_SMALLINT:
+    case TYPE_INT:
+    case TYPE_BIGINT:
+    case TYPE_FLOAT:
+    case TYPE_DOUBLE:
+        if (is_string) {
+            return false;
+        }
+        break;
+    case TYPE_CHAR:
+    case TYPE_VARCHAR:
+    case TYPE_STRING:
+        if (!is_string) {
+            return false;
+        }
+        break;
+    default:
+        return false;
+    }
+
+    const vectorized::IColumn* data_column = column.get();
+    const vectorized::NullMap* null_map = nullptr;
+    if (const auto* nullable = vectorized::check_and_get_column<vectorized::ColumnNullable>(
+                column.get())) {
+        data_column = &nullable->get_nested_column();
+        null_map = &nullable->get_null_map_data();
+    }
+    const auto rows = static_cast<int64_t>(column->size());
+    std::vector<std::shared_ptr<arrow::Buffer>> buffers;
+    if (is_string) {
+        const auto* string_column =
+                vectorized::check_and_get_column<vectorized::ColumnString>(data_column);
+        if (string_column == nullptr) {
+            return false;
+        }
+        const auto& offsets = string_column->get_offsets();
+        const auto& chars = string_column->get_chars();
+        if (chars.size() > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+            return false;
+        }
+        // doris keeps the end offset of each row, and a zero before the first one in the left
+        // padding of the array, which are the rows + 1 int32 offsets arrow wants.
+        buffers.push_back(std::make_shared<ColumnDataBuffer>(
+                column, reinterpret_cast<const uint8_t*>(offsets.data() - 1),
+                (rows + 1) * static_cast<int64_t>(sizeof(int32_t))));
+        buffers.push_back(std::make_shared<ColumnDataBuffer>(
+                column, chars.data(), static_cast<int64_t>(chars.size())));
+    } else {
+        const auto byte_width =
+                static_cast<const arrow::FixedWidthType&>(*arrow_type).bit_width() / 8;
+        const auto raw_data = data_column->get_raw_data();
+        if (raw_data.size != static_cast<size_t>(rows * byte_width)) {
+            return false;
+        }
+        buffers.push_back(std::make_shared<ColumnDataBuffer>(
+                column, reinterpret_cast<const uint8_t*>(raw_data.data), rows * byte_width));
+    }
+
+    std::shared_ptr<arrow::Buffer> validity;
+    int64_t null_count = 0;
+    if (null_map != nullptr && simd::contain_byte(null_map->data(), null_map->size(), 1)) {
+        // doris keeps one byte per row for nulls while arrow wants a bitmap, so only the
+        // validity bitmap is materialized; the values are still shared.
+        auto bitmap = arrow::AllocateBuffer((rows + 7) / 8, _pool);
+        if (!bitmap.ok()) {
+            return false;
+        }
+        validity = std::move(bitmap).ValueUnsafe();
+        uint8_t* bits = validity->mutable_data();
+        memset(bits, 0, validity->size());
+        for (int64_t i = 0; i < rows; ++i) {
+            if ((*null_map)[i]) {
+                ++null_count;
+            } else {
+                bits[i >> 3] |= static_cast<uint8_t>(1U << (i & 7));
+            }
+        }
+    }
+    buffers.insert(buffers.begin(), std::move(validity));
+    *out = arrow::MakeArray(
+            arrow::ArrayData::Make(arrow_type, rows, std::move(buffers), null_count));
+    return true;
+}
+
 Status FromBlockConverter::convert(std::shared_ptr<arrow::RecordBatch>* out) {
     size_t num_fields = _schema->num_fields();
     if (_block.columns() != num_fields) {
@@ -102,6 +232,9 @@ Status FromBlockConverter::convert(std::shared_ptr<arrow::RecordBatch>* out) {
         if (arrow_type->name() == "utf8" && column->byte_size() >= MAX_ARROW_UTF8) {
             arrow_type = arrow::large_utf8();
         }
+        if (_try_zero_copy(column, arrow_type, &_arrays[_cur_field_idx])) {
+            continue;
+        }
         std::unique_ptr<arrow::ArrayBuilder> builder;
         auto arrow_st = arrow::MakeBuilder(_pool, arrow_type, &builder);
         if (!arrow_st.ok()) {
@@ -21,6 +21,8 @@
 #include <gen_cpp/parquet_types.h>
 
 #include <cstddef>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "common/status.h"
@@ -87,6 +89,17 @@ Status get_block_compression_codec(segment_v2::CompressionTypePB type,
 Status get_block_compression_codec(tparquet::CompressionCodec::type parquet_codec,
                                    BlockCompressionCodec** codec);
 
+// Trains a ZSTD dictionary of at most `max_dict_size` bytes from `samples`, e.g. the small
+// pages of a column. It fails when the samples are too few or too small to train from, the
+// caller should fall back to the plain codec then.
+Status train_zstd_dictionary(const std::vector<Slice>& samples, size_t max_dict_size,
+                             std::string* dict);
+
+// Creates a ZSTD codec which compresses and decompresses with `dict`. Unlike the codecs of
+// get_block_compression_codec it is owned by the caller. The data compressed by it can only be
+// decompressed by a codec of the same dict.
+Status create_zstd_dict_codec(const Slice& dict, std::unique_ptr<BlockCompressionCodec>* codec);
+
 // TODO: refactor code as CompressionOutputStream and CompressionInputStream
 Status get_block_compression_codec(TFileCompressType::type type, BlockCompressionCodec** codec);
 
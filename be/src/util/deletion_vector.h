@@ -21,6 +21,8 @@
 #include <cstdint>
 #include <cstring>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include "common/status.h"
 #include "roaring/roaring.hh"
@@ -42,6 +44,17 @@ public:
 
     uint32_t minimum() const { return _roaring_bitmap.minimum(); }
 
+    // Append the deleted positions in ascending order, without probing every position
+    // between the minimum and the maximum.
+    void to_sorted_rows(std::vector<int64_t>* rows) const {
+        size_t origin_size = rows->size();
+        rows->resize(origin_size + _roaring_bitmap.cardinality());
+        int64_t* dst = rows->data() + origin_size;
+        for (uint32_t position : _roaring_bitmap) {
+            *dst++ = position;
+        }
+    }
+
     static Result<DeletionVector> deserialize(const char* buf, size_t length) {
         uint32_t actual_length;
         std::memcpy(reinterpret_cast<char*>(&actual_length), buf, 4);
@@ -67,12 +80,12 @@ public:
         }
         roaring::Roaring roaring_bitmap;
         try {
-            roaring_bitmap = roaring::Roaring::readSafe(buf, length);
+            roaring_bitmap = roaring::Roaring::readSafe(buf, length - 8);
         } catch (std::runtime_error&) {
             return ResultError(Status::RuntimeError(
                     "DeletionVector deserialize error: failed to deserialize roaring bitmap"));
         }
-        return DeletionVector(roaring_bitmap);
+        return DeletionVector(std::move(roaring_bitmap));
     }
 
 private:
@@ -78,6 +78,7 @@ public:
     IntCounter* clone_requests_failed = nullptr;
     IntCounter* alter_inverted_index_requests_total = nullptr;
     IntCounter* alter_inverted_index_requests_failed = nullptr;
+    IntCounter* alter_inverted_index_rows_total = nullptr;
 
     IntCounter* finish_task_requests_total = nullptr;
     IntCounter* finish_task_requests_failed = nullptr;
@@ -249,6 +250,8 @@ public:
     IntCounter* scanner_cnt = nullptr;
     IntCounter* scanner_task_cnt = nullptr;
     IntCounter* pipeline_task_queue_size = nullptr;
+    IntCounter* pipeline_task_steal_count = nullptr;
+    IntCounter* pipeline_task_remote_numa_steal_count = nullptr;
 
     IntGauge* runtime_filter_consumer_num = nullptr;
     IntGauge* runtime_filter_consumer_ready_num = nullptr;
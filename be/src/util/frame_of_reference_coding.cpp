@@ -271,6 +271,8 @@ void ForEncoder<T>::bit_packing_one_frame_value(const T* input) {
     uint8_t bit_width = 0;
     T half_max_delta = numeric_limits_max() >> 1;
     bool is_keep_original_value = false;
+    T min_delta = numeric_limits_max();
+    T max_delta = 0;
 
     // 1. make sure order_flag, save_original_value, and find max&min.
     for (uint8_t i = 1; i < _buffered_values_num; ++i) {
@@ -281,7 +283,10 @@ void ForEncoder<T>::bit_packing_one_frame_value(const T* input) {
                 if ((input[i] >> 1) - (input[i - 1] >> 1) > half_max_delta) { // overflow
                     is_keep_original_value = true;
                 } else {
-                    bit_width = std::max(bit_width, bits(input[i] - input[i - 1]));
+                    T delta = input[i] - input[i - 1];
+                    bit_width = std::max(bit_width, bits(delta));
+                    min_delta = std::min(min_delta, delta);
+                    max_delta = std::max(max_delta, delta);
                 }
             }
         }
@@ -301,13 +306,23 @@ void ForEncoder<T>::bit_packing_one_frame_value(const T* input) {
         }
     }
 
-    // 2. save min value.
-    if (sizeof(T) == 16) {
-        put_fixed128_le(_buffer, min);
-    } else if (sizeof(T) == 8) {
-        put_fixed64_le(_buffer, min);
-    } else {
-        put_fixed32_le(_buffer, min);
+    // For ascending input whose deltas stay close to each other, e.g. timestamps sampled at a
+    // roughly fixed interval, packing (delta - MinDelta) instead of delta saves bits. It is only
+    // worth it when the saved bits pay for the extra MinDelta stored in the frame header.
+    bool is_min_delta = false;
+    if (_enable_min_delta && is_ascending && !is_keep_original_value && _buffered_values_num > 1) {
+        uint8_t min_delta_bit_width = bits(static_cast<T>(max_delta - min_delta));
+        is_min_delta = (bit_width - min_delta_bit_width) * (_buffered_values_num - 1) >=
+                       frame_header_size() * 8;
+        if (is_min_delta) {
+            bit_width = min_delta_bit_width;
+        }
+    }
+
+    // 2. save min value, and min delta for the min-delta format.
+    put_frame_header(min);
+    if (is_min_delta) {
+        put_frame_header(min_delta);
     }
 
     // 3.1 save original value.
@@ -322,7 +337,12 @@ void ForEncoder<T>::bit_packing_one_frame_value(const T* input) {
         // 3.2 bit pack.
         // improve for ascending order input, we could use fewer bit
         T delta_values[FRAME_VALUE_NUM];
-        if (is_ascending) {
+        if (is_min_delta) {
+            delta_values[0] = 0;
+            for (uint8_t i = 1; i < _buffered_values_num; ++i) {
+                delta_values[i] = input[i] - input[i - 1] - min_delta;
+            }
+        } else if (is_ascending) {
             delta_values[0] = 0;
             for (uint8_t i = 1; i < _buffered_values_num; ++i) {
                 delta_values[i] = input[i] - input[i - 1];
@@ -344,6 +364,8 @@ void ForEncoder<T>::bit_packing_one_frame_value(const T* input) {
     uint8_t storage_format = 0;
     if (is_keep_original_value) {
         storage_format = 2;
+    } else if (is_min_delta) {
+        storage_format = 3;
     } else if (is_ascending) {
         storage_format = 1;
     }
@@ -375,6 +397,17 @@ uint32_t ForEncoder<T>::flush() {
     return _buffer->size();
 }
 
+template <typename T>
+void ForEncoder<T>::put_frame_header(T value) {
+    if (sizeof(T) == 16) {
+        put_fixed128_le(_buffer, value);
+    } else if (sizeof(T) == 8) {
+        put_fixed64_le(_buffer, value);
+    } else {
+        put_fixed32_le(_buffer, value);
+    }
+}
+
 template <typename T>
 const T ForEncoder<T>::numeric_limits_max() {
     return std::numeric_limits<T>::max();
@@ -411,13 +444,12 @@ bool ForDecoder<T>::init() {
         bit_width_offset += 2;
 
         _frame_offsets.push_back(frame_start_offset);
-        if (sizeof(T) == 16) {
-            frame_start_offset += bit_width * _max_frame_size / 8 + 16;
-        } else if (sizeof(T) == 8) {
-            frame_start_offset += bit_width * _max_frame_size / 8 + 8;
-        } else {
-            frame_start_offset += bit_width * _max_frame_size / 8 + 4;
+        uint32_t header_size = sizeof(T) == 16 ? 16 : (sizeof(T) == 8 ? 8 : 4);
+        // the min-delta format stores MinDelta after MinValue
+        if (order_flag == 3) {
+            header_size *= 2;
         }
+        frame_start_offset += bit_width * _max_frame_size / 8 + header_size;
     }
 
     _out_buffer.resize(_max_frame_size);
@@ -426,7 +458,6 @@ bool ForDecoder<T>::init() {
     return true;
 }
 
-// todo(kks): improve this method by SIMD instructions
 // The reverse of bit_pack method, get original integer data list from packed bits
 // param[in] input: the packed bits need to unpack
 // param[in] in_num: the integer number in packed bits
@@ -434,6 +465,27 @@ bool ForDecoder<T>::init() {
 // param[out] output: the original integer data list
 template <typename T>
 void ForDecoder<T>::bit_unpack(const uint8_t* input, uint8_t in_num, int bit_width, T* output) {
+    if (bit_width == 0) {
+        std::fill(output, output + in_num, static_cast<T>(0));
+        return;
+    }
+    if (bit_width <= 56) {
+        // The bits are packed MSB first, so shift whole bytes into a 64 bit buffer and cut
+        // values off its top. Never reads past the last packed byte.
+        uint64_t buffer = 0;
+        int buffered_bits = 0;
+        const uint64_t mask = (1ULL << bit_width) - 1;
+        for (uint8_t i = 0; i < in_num; ++i) {
+            while (buffered_bits < bit_width) {
+                buffer = (buffer << 8) | *input++;
+                buffered_bits += 8;
+            }
+            buffered_bits -= bit_width;
+            output[i] = static_cast<T>((buffer >> buffered_bits) & mask);
+        }
+        return;
+    }
+
     unsigned char in_mask = 0x80;
     int bit_index = 0;
     while (in_num > 0) {
@@ -477,9 +529,26 @@ void ForDecoder<T>::decode_current_frame(T* output) {
 
     uint8_t bit_width = _bit_widths[_current_decoded_frame];
 
-    bool is_original_value = _storage_formats[_current_decoded_frame] == 2;
-    if (is_original_value) {
+    uint8_t storage_format = _storage_formats[_current_decoded_frame];
+    if (storage_format == 2) {
+        bit_unpack(_buffer + delta_offset, current_frame_size, bit_width, output);
+    } else if (storage_format == 3) {
+        T min_delta = 0;
+        if (sizeof(T) == 16) {
+            min_delta = decode_fixed128_le(_buffer + delta_offset);
+            delta_offset += 16;
+        } else if (sizeof(T) == 8) {
+            min_delta = decode_fixed64_le(_buffer + delta_offset);
+            delta_offset += 8;
+        } else {
+            min_delta = decode_fixed32_le(_buffer + delta_offset);
+            delta_offset += 4;
+        }
         bit_unpack(_buffer + delta_offset, current_frame_size, bit_width, output);
+        output[0] += min;
+        for (uint8_t i = 1; i < current_frame_size; i++) {
+            output[i] += output[i - 1] + min_delta;
+        }
     } else {
         bool is_ascending = _storage_formats[_current_decoded_frame] == 1;
         std::vector<T> delta_values(current_frame_size);
@@ -546,6 +615,10 @@ bool ForDecoder<T>::get_batch(T* val, size_t count) {
         _current_index += _max_frame_size;
         val += _max_frame_size;
     }
+    if (frame_count > 0) {
+        // the frames above were decoded into `val` rather than `_out_buffer`
+        _current_decoded_frame = -1;
+    }
 
     // 3. process remaining value
     size_t remaining_num = (count - padding_num) % _max_frame_size;
@@ -559,7 +632,7 @@ bool ForDecoder<T>::get_batch(T* val, size_t count) {
 
 template <typename T>
 bool ForDecoder<T>::skip(int32_t skip_num) {
-    if (_current_index + skip_num >= _values_num) {
+    if (_current_index + skip_num > _values_num) {
         return false;
     }
     _current_index = _current_index + skip_num;
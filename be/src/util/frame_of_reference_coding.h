@@ -76,7 +76,7 @@ uint8_t bits(const T v) {
 //       8 bit FrameValueNum
 //      32 bit ValuesNum
 //
-// There are currently three storage formats
+// There are currently four storage formats
 // (1) if the StorageFormat == 0: When input data order is not ascending and the BitPackingFrame format is:
 //          MinValue, (Value[i] - MinVale) * FrameValueNum
 //
@@ -86,6 +86,12 @@ uint8_t bits(const T v) {
 // (3) if the StorageFormat == 2:  When overflow occurs when using (1) or (2) and save original values:
 //      MinValue, (Value[i]) * FrameValueNum
 //
+// (4) if the StorageFormat == 3: When input data order is ascending and the deltas are close to each
+//      other, e.g. timestamps with a nearly fixed interval, the BitPackingFrame format is:
+//      MinValue, MinDelta, 0, (Value[i] - Value[i - 1] - MinDelta) * (FrameValueNum - 1)
+//      A constant interval costs 0 bit per value. Only written when the encoder is created with
+//      enable_min_delta, because readers without this format would misread it.
+//
 // len(MinValue) can be 32(uint32_t), 64(uint64_t), 128(uint128_t)
 //
 // The OrderFlag is 1 represents ascending order, 0 represents  not ascending order
@@ -93,7 +99,8 @@ uint8_t bits(const T v) {
 template <typename T>
 class ForEncoder {
 public:
-    explicit ForEncoder(faststring* buffer) : _buffer(buffer) {}
+    explicit ForEncoder(faststring* buffer, bool enable_min_delta = false)
+            : _buffer(buffer), _enable_min_delta(enable_min_delta) {}
 
     void put(const T value) { return put_batch(&value, 1); }
 
@@ -126,6 +133,12 @@ private:
 
     void bit_packing_one_frame_value(const T* input);
 
+    static constexpr uint32_t frame_header_size() {
+        return sizeof(T) == 16 ? 16 : (sizeof(T) == 8 ? 8 : 4);
+    }
+
+    void put_frame_header(T value);
+
     const T* copy_value(const T* val, size_t count);
 
     const T numeric_limits_max();
@@ -136,6 +149,7 @@ private:
     T _buffered_values[FRAME_VALUE_NUM];
 
     faststring* _buffer = nullptr;
+    bool _enable_min_delta = false;
     std::vector<uint8_t> _storage_formats;
     std::vector<uint8_t> _bit_widths;
 };
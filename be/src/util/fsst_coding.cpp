@@ -0,0 +1,270 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/fsst_coding.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <unordered_map>
+#include <utility>
+
+namespace doris {
+
+namespace {
+
+// Training works on "pseudo codes": 0 ~ 254 are the codes of the current symbols, and
+// PSEUDO_CODE_BYTE + b stands for the escaped byte b.
+constexpr uint32_t PSEUDO_CODE_BYTE = 256;
+constexpr uint32_t PSEUDO_CODE_NUM = PSEUDO_CODE_BYTE + 256;
+constexpr int TRAINING_ROUNDS = 5;
+
+uint64_t length_mask(size_t len) {
+    return len >= 8 ? ~0ULL : (1ULL << (len * 8)) - 1;
+}
+
+} // namespace
+
+void FsstSymbolTable::clear() {
+    _num_symbols = 0;
+    memset(_symbols, 0, sizeof(_symbols));
+    memset(_lengths, 0, sizeof(_lengths));
+    _lengths[ESCAPE_CODE] = 1;
+    for (auto& codes : _codes_by_first_byte) {
+        codes.clear();
+    }
+}
+
+void FsstSymbolTable::_build_index() {
+    for (auto& codes : _codes_by_first_byte) {
+        codes.clear();
+    }
+    for (size_t code = 0; code < _num_symbols; ++code) {
+        _codes_by_first_byte[_symbols[code] & 0xFF].push_back(static_cast<uint8_t>(code));
+    }
+    for (auto& codes : _codes_by_first_byte) {
+        std::stable_sort(codes.begin(), codes.end(),
+                         [this](uint8_t a, uint8_t b) { return _lengths[a] > _lengths[b]; });
+    }
+}
+
+uint8_t FsstSymbolTable::_find_longest_symbol(const uint8_t* data, size_t size) const {
+    const auto& codes = _codes_by_first_byte[data[0]];
+    if (codes.empty()) {
+        return ESCAPE_CODE;
+    }
+    uint64_t word = 0;
+    memcpy(&word, data, std::min(size, MAX_SYMBOL_LENGTH));
+    for (uint8_t code : codes) {
+        size_t len = _lengths[code];
+        if (len <= size && (word & length_mask(len)) == _symbols[code]) {
+            return code;
+        }
+    }
+    return ESCAPE_CODE;
+}
+
+void FsstSymbolTable::train(const std::vector<Slice>& samples) {
+    clear();
+    size_t raw_size = 0;
+    for (const auto& sample : samples) {
+        raw_size += sample.size;
+    }
+    if (raw_size == 0) {
+        return;
+    }
+
+    // Each round compresses the samples with the current table, then keeps the symbols, and
+    // the concatenations of adjacent symbols, which cover the most bytes. Symbols can double
+    // in length every round.
+    std::vector<uint64_t> counts(PSEUDO_CODE_NUM);
+    std::unordered_map<uint32_t, uint64_t> pair_counts;
+    size_t compressed_size = 0;
+    for (int round = 0; round <= TRAINING_ROUNDS; ++round) {
+        std::fill(counts.begin(), counts.end(), 0);
+        pair_counts.clear();
+        compressed_size = 0;
+        for (const auto& sample : samples) {
+            const auto* data = reinterpret_cast<const uint8_t*>(sample.data);
+            size_t pos = 0;
+            uint32_t prev = PSEUDO_CODE_NUM;
+            while (pos < sample.size) {
+                uint8_t code = _find_longest_symbol(data + pos, sample.size - pos);
+                uint32_t pseudo_code = code;
+                if (code == ESCAPE_CODE) {
+                    pseudo_code = PSEUDO_CODE_BYTE + data[pos];
+                    pos += 1;
+                    compressed_size += 2;
+                } else {
+                    pos += _lengths[code];
+                    compressed_size += 1;
+                }
+                counts[pseudo_code]++;
+                if (prev != PSEUDO_CODE_NUM) {
+                    pair_counts[prev * PSEUDO_CODE_NUM + pseudo_code]++;
+                }
+                prev = pseudo_code;
+            }
+        }
+        if (round == TRAINING_ROUNDS) {
+            // the last round only measures the final table
+            break;
+        }
+
+        auto symbol_of = [this](uint32_t pseudo_code) -> std::pair<uint64_t, size_t> {
+            if (pseudo_code >= PSEUDO_CODE_BYTE) {
+                return {pseudo_code - PSEUDO_CODE_BYTE, 1};
+            }
+            return {_symbols[pseudo_code], _lengths[pseudo_code]};
+        };
+        // (symbol, length) -> number of bytes it would have covered
+        std::map<std::pair<uint64_t, size_t>, uint64_t> gains;
+        for (uint32_t pseudo_code = 0; pseudo_code < PSEUDO_CODE_NUM; ++pseudo_code) {
+            if (counts[pseudo_code] > 0) {
+                auto symbol = symbol_of(pseudo_code);
+                gains[symbol] += counts[pseudo_code] * symbol.second;
+            }
+        }
+        for (const auto& [key, count] : pair_counts) {
+            auto first = symbol_of(key / PSEUDO_CODE_NUM);
+            auto second = symbol_of(key % PSEUDO_CODE_NUM);
+            size_t len = first.second + second.second;
+            if (len > MAX_SYMBOL_LENGTH) {
+                continue;
+            }
+            uint64_t symbol = first.first | (second.first << (first.second * 8));
+            gains[{symbol, len}] += count * len;
+        }
+
+        std::vector<std::pair<uint64_t, std::pair<uint64_t, size_t>>> candidates;
+        candidates.reserve(gains.size());
+        for (const auto& [symbol, gain] : gains) {
+            candidates.emplace_back(gain, symbol);
+        }
+        size_t num_symbols = std::min(candidates.size(), MAX_SYMBOLS);
+        std::partial_sort(candidates.begin(), candidates.begin() + num_symbols, candidates.end(),
+                          [](const auto& a, const auto& b) { return a.first > b.first; });
+        _num_symbols = num_symbols;
+        for (size_t code = 0; code < num_symbols; ++code) {
+            _symbols[code] = candidates[code].second.first;
+            _lengths[code] = static_cast<uint8_t>(candidates[code].second.second);
+        }
+        _build_index();
+    }
+
+    size_t table_size = 1 + _num_symbols;
+    for (size_t code = 0; code < _num_symbols; ++code) {
+        table_size += _lengths[code];
+    }
+    if (compressed_size + table_size >= raw_size) {
+        clear();
+    }
+}
+
+void FsstSymbolTable::compress(const Slice& value, faststring* output) const {
+    if (_num_symbols == 0) {
+        output->append(value.data, value.size);
+        return;
+    }
+    size_t origin_size = output->size();
+    output->resize(origin_size + max_compressed_size(value.size));
+    uint8_t* out = output->data() + origin_size;
+    const auto* data = reinterpret_cast<const uint8_t*>(value.data);
+    size_t pos = 0;
+    while (pos < value.size) {
+        uint8_t code = _find_longest_symbol(data + pos, value.size - pos);
+        *out++ = code;
+        if (code == ESCAPE_CODE) {
+            *out++ = data[pos];
+            pos += 1;
+        } else {
+            pos += _lengths[code];
+        }
+    }
+    output->resize(out - output->data());
+}
+
+size_t FsstSymbolTable::decompressed_size(const uint8_t* input, size_t size) const {
+    if (_num_symbols == 0) {
+        return size;
+    }
+    size_t len = 0;
+    for (size_t i = 0; i < size; ++i) {
+        uint8_t code = input[i];
+        len += _lengths[code];
+        i += code == ESCAPE_CODE;
+    }
+    return len;
+}
+
+size_t FsstSymbolTable::decompress(const uint8_t* input, size_t size, uint8_t* output) const {
+    if (_num_symbols == 0) {
+        memcpy(output, input, size);
+        return size;
+    }
+    uint8_t* out = output;
+    for (size_t i = 0; i < size; ++i) {
+        uint8_t code = input[i];
+        if (code == ESCAPE_CODE) {
+            if (++i == size) {
+                break;
+            }
+            *out++ = input[i];
+        } else {
+            // copy the whole padded symbol, the bytes past its length are overwritten next
+            memcpy(out, &_symbols[code], MAX_SYMBOL_LENGTH);
+            out += _lengths[code];
+        }
+    }
+    return out - output;
+}
+
+void FsstSymbolTable::serialize(faststring* output) const {
+    output->push_back(static_cast<char>(_num_symbols));
+    output->append(_lengths, _num_symbols);
+    for (size_t code = 0; code < _num_symbols; ++code) {
+        output->append(&_symbols[code], _lengths[code]);
+    }
+}
+
+bool FsstSymbolTable::deserialize(const uint8_t* data, size_t size, size_t* consumed) {
+    clear();
+    if (size < 1) {
+        return false;
+    }
+    size_t num_symbols = data[0];
+    if (num_symbols > MAX_SYMBOLS || size < 1 + num_symbols) {
+        return false;
+    }
+    size_t pos = 1 + num_symbols;
+    for (size_t code = 0; code < num_symbols; ++code) {
+        size_t len = data[1 + code];
+        if (len == 0 || len > MAX_SYMBOL_LENGTH || pos + len > size) {
+            clear();
+            return false;
+        }
+        _lengths[code] = static_cast<uint8_t>(len);
+        memcpy(&_symbols[code], data + pos, len);
+        pos += len;
+    }
+    _num_symbols = num_symbols;
+    _build_index();
+    *consumed = pos;
+    return true;
+}
+
+} // namespace doris
@@ -0,0 +1,98 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "util/faststring.h"
+#include "util/slice.h"
+
+namespace doris {
+
+// A static symbol table string compressor, following FSST
+// (Boncz, Neumann, Leis. FSST: Fast Random Access String Compression. VLDB 2020).
+//
+// The table maps up to 255 one byte codes to symbols of 1 to 8 bytes, trained on a sample of
+// the strings to compress. A string is compressed into a sequence of codes, bytes covered by no
+// symbol are written as the escape code followed by the byte. Every string is compressed on its
+// own, so any single string can be decompressed without touching its neighbours.
+//
+// The serialized table is:
+//      8 bit NumSymbols
+//      8 bit SymbolLength * NumSymbols
+//      SymbolBytes
+//
+// A table without symbols means the strings are stored as they are, which the trainer falls
+// back to when the symbols would not save any space.
+class FsstSymbolTable {
+public:
+    static constexpr uint8_t ESCAPE_CODE = 255;
+    static constexpr size_t MAX_SYMBOLS = 255;
+    static constexpr size_t MAX_SYMBOL_LENGTH = 8;
+    // decompress() may write this many bytes past the end of the decompressed data
+    static constexpr size_t DECOMPRESS_PADDING = MAX_SYMBOL_LENGTH;
+
+    FsstSymbolTable() { clear(); }
+
+    // Build the table from the sample strings, replacing the current symbols.
+    void train(const std::vector<Slice>& samples);
+
+    void clear();
+
+    size_t num_symbols() const { return _num_symbols; }
+
+    // Append the compressed bytes of value to output.
+    void compress(const Slice& value, faststring* output) const;
+
+    // Upper bound of the compressed size of a string of raw_size bytes.
+    size_t max_compressed_size(size_t raw_size) const {
+        return _num_symbols == 0 ? raw_size : raw_size * 2;
+    }
+
+    // Size of the string compressed into input[0, size).
+    size_t decompressed_size(const uint8_t* input, size_t size) const;
+
+    // Decompress input[0, size) into output, returning the decompressed size. output must
+    // have room for decompressed_size() + DECOMPRESS_PADDING bytes.
+    size_t decompress(const uint8_t* input, size_t size, uint8_t* output) const;
+
+    void serialize(faststring* output) const;
+
+    // Parse a table serialized at data, setting the serialized size to *consumed.
+    // Returns false if data is not a valid table.
+    bool deserialize(const uint8_t* data, size_t size, size_t* consumed);
+
+private:
+    // Rebuild _codes_by_first_byte after the symbols changed.
+    void _build_index();
+
+    // The longest symbol matching the start of data, or ESCAPE_CODE if there is none.
+    uint8_t _find_longest_symbol(const uint8_t* data, size_t size) const;
+
+    size_t _num_symbols = 0;
+    // symbol bytes in little endian order, padded with zero
+    uint64_t _symbols[MAX_SYMBOLS];
+    uint8_t _lengths[MAX_SYMBOLS + 1];
+    // codes of the symbols starting with a byte, longest first
+    std::vector<uint8_t> _codes_by_first_byte[256];
+};
+
+} // namespace doris
@@ -199,6 +199,69 @@ static std::string get_counter_name(PerfCounters::Counter counter) {
     }
 }
 
+namespace {
+// perf_event group of the hardware counters of one thread
+class ThreadHwCounterGroup {
+public:
+    ThreadHwCounterGroup() {
+        static constexpr PerfCounters::Counter counters[PerfCounters::THREAD_HW_COUNTER_NUM] = {
+                PerfCounters::PERF_COUNTER_HW_CPU_CYCLES,
+                PerfCounters::PERF_COUNTER_HW_INSTRUCTIONS,
+                PerfCounters::PERF_COUNTER_HW_CACHE_MISSES,
+                PerfCounters::PERF_COUNTER_HW_BRANCH_MISSES,
+        };
+        for (int i = 0; i < PerfCounters::THREAD_HW_COUNTER_NUM; ++i) {
+            perf_event_attr attr;
+            init_event_attr(&attr, counters[i]);
+            attr.read_format = PERF_FORMAT_GROUP;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            // pid 0 and cpu -1: count the calling thread on any cpu
+            _fds[i] = sys_perf_event_open(&attr, 0, -1, i == 0 ? -1 : _fds[0], 0);
+            if (_fds[i] < 0) {
+                return;
+            }
+        }
+        _available = true;
+    }
+
+    ~ThreadHwCounterGroup() {
+        for (int fd : _fds) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+
+    bool read_values(PerfCounters::ThreadHwCounters* values) const {
+        if (!_available) {
+            return false;
+        }
+        struct {
+            uint64_t nr;
+            uint64_t values[PerfCounters::THREAD_HW_COUNTER_NUM];
+        } buffer;
+        if (read(_fds[0], &buffer, sizeof(buffer)) != sizeof(buffer) ||
+            buffer.nr != PerfCounters::THREAD_HW_COUNTER_NUM) {
+            return false;
+        }
+        for (int i = 0; i < PerfCounters::THREAD_HW_COUNTER_NUM; ++i) {
+            (*values)[i] = static_cast<int64_t>(buffer.values[i]);
+        }
+        return true;
+    }
+
+private:
+    int _fds[PerfCounters::THREAD_HW_COUNTER_NUM] = {-1, -1, -1, -1};
+    bool _available = false;
+};
+} // namespace
+
+bool PerfCounters::get_thread_hw_counters(ThreadHwCounters* values) {
+    static thread_local ThreadHwCounterGroup group;
+    return group.read_values(values);
+}
+
 bool PerfCounters::init_sys_counter(Counter counter) {
     CounterData data;
     data.counter = counter;
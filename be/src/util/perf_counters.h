@@ -23,6 +23,7 @@
 #include <gen_cpp/Metrics_types.h>
 #include <stdint.h>
 
+#include <array>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -123,6 +124,20 @@ public:
     static inline int64_t get_vm_size() { return _vm_size; }
     static inline int64_t get_vm_peak() { return _vm_peak; }
 
+    // Hardware counters of the calling thread. They are opened on first use and kept open for
+    // the lifetime of the thread as one perf_event group, so reading all of them is one syscall.
+    enum ThreadHwCounter {
+        THREAD_HW_CPU_CYCLES = 0,
+        THREAD_HW_INSTRUCTIONS,
+        THREAD_HW_CACHE_MISSES,
+        THREAD_HW_BRANCH_MISSES,
+        THREAD_HW_COUNTER_NUM,
+    };
+    using ThreadHwCounters = std::array<int64_t, THREAD_HW_COUNTER_NUM>;
+    // Return false if the counters are not available, e.g. not allowed by perf_event_paranoid
+    // or not supported in a virtual machine.
+    static bool get_thread_hw_counters(ThreadHwCounters* values);
+
 private:
     // Copy constructor and assignment not allowed
     PerfCounters(const PerfCounters&);
@@ -198,4 +198,36 @@ Status PprofUtils::generate_flamegraph(int32_t sample_seconds,
     return Status::OK();
 }
 
+Status PprofUtils::generate_flamegraph_from_folded(const std::string& folded_stacks,
+                                                   const std::string& flame_graph_tool_dir,
+                                                   std::string* svg_content) {
+    std::string flamegraph_pl = flame_graph_tool_dir + "/flamegraph.pl";
+    bool exists = false;
+    RETURN_IF_ERROR(io::global_local_filesystem()->exists(flamegraph_pl, &exists));
+    if (!exists) {
+        return Status::InternalError("Missing flamegraph.pl in FlameGraph");
+    }
+
+    std::stringstream tmp_file;
+    tmp_file << config::pprof_profile_dir << "/cpu_folded." << getpid() << "." << rand();
+    {
+        std::ofstream out(tmp_file.str());
+        if (!out.is_open()) {
+            return Status::InternalError("Failed to open {}", tmp_file.str());
+        }
+        out << folded_stacks;
+    }
+
+    std::stringstream gen_cmd;
+    gen_cmd << flamegraph_pl << " " << tmp_file.str();
+    AgentUtils util;
+    LOG(INFO) << "begin to run command: " << gen_cmd.str();
+    bool rc = util.exec_cmd(gen_cmd.str(), svg_content, false);
+    static_cast<void>(io::global_local_filesystem()->delete_file(tmp_file.str()));
+    if (!rc) {
+        return Status::InternalError("Failed to execute flamegraph command: {}", *svg_content);
+    }
+    return Status::OK();
+}
+
 } // namespace doris
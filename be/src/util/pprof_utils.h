@@ -50,6 +50,12 @@ public:
     static Status generate_flamegraph(int32_t sample_seconds,
                                       const std::string& flame_graph_tool_dir, bool return_file,
                                       std::string* svg_file_or_content);
+
+    /// generate flame graph svg content from stacks in the folded format of stackcollapse
+    /// scripts, e.g. the output of QueryCpuProfiler.
+    static Status generate_flamegraph_from_folded(const std::string& folded_stacks,
+                                                  const std::string& flame_graph_tool_dir,
+                                                  std::string* svg_content);
 };
 
 } // namespace doris
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <brpc/http_method.h>
+#include <butil/iobuf.h>
 #include <gen_cpp/internal_service.pb.h>
 
 #include "common/config.h"
@@ -107,14 +108,15 @@ Status request_embed_attachmentv2(Params* brpc_request, const std::string& data,
                                   std::unique_ptr<Closure>& closure) {
     butil::IOBuf attachment;
 
-    // step1: serialize brpc_request to string, and append to attachment.
-    std::string req_str;
-    if (!brpc_request->SerializeToString(&req_str)) {
-        return Status::InternalError("failed to serialize the request");
-    }
-    int64_t req_str_size = req_str.size();
+    // step1: serialize brpc_request into the attachment directly, without an intermediate string.
+    int64_t req_str_size = brpc_request->ByteSizeLong();
     attachment.append(&req_str_size, sizeof(req_str_size));
-    attachment.append(req_str);
+    {
+        butil::IOBufAsZeroCopyOutputStream req_stream(&attachment);
+        if (!brpc_request->SerializeToZeroCopyStream(&req_stream)) {
+            return Status::InternalError("failed to serialize the request");
+        }
+    }
 
     // step2: append data to attachment and put it in the closure.
     int64_t data_size = data.size();
@@ -147,13 +149,17 @@ Status attachment_extract_request(const Params* brpc_request, brpc::Controller*
                                   std::string* data) {
     const butil::IOBuf& io_buf = cntl->request_attachment();
 
-    // step1: deserialize request string to brpc_request from attachment.
+    // step1: deserialize brpc_request from the attachment. The request bytes are shared with
+    // the attachment instead of being copied into a string first.
     int64_t req_str_size;
     io_buf.copy_to(&req_str_size, sizeof(req_str_size), 0);
-    std::string req_str;
-    io_buf.copy_to(&req_str, req_str_size, sizeof(req_str_size));
+    butil::IOBuf req_buf;
+    io_buf.append_to(&req_buf, req_str_size, sizeof(req_str_size));
+    butil::IOBufAsZeroCopyInputStream req_stream(req_buf);
     Params* req = const_cast<Params*>(brpc_request);
-    req->ParseFromString(req_str);
+    if (!req->ParseFromZeroCopyStream(&req_stream)) {
+        return Status::InternalError("failed to parse the request from attachment");
+    }
 
     // step2: extract data from attachment.
     int64_t data_size;
@@ -0,0 +1,190 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/query_cpu_profiler.h"
+
+#include <common/symbol_index.h>
+#include <fmt/format.h>
+#include <sys/time.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "common/signal_handler.h"
+#include "common/stack_trace.h"
+#include "util/uid_util.h"
+#include "vec/common/demangle.h"
+
+namespace doris {
+
+namespace {
+
+// 30s at 1000Hz of a query that keeps one core busy.
+constexpr size_t kMaxSamples = 32768;
+
+struct Sample {
+    size_t size = 0;
+    void* frames[StackTrace::capacity];
+};
+
+// The state shared with the signal handler. Everything but the atomics is written before
+// `g_sampling` is set and read after the handlers have drained.
+std::atomic<bool> g_sampling {false};
+std::atomic<int32_t> g_running_handlers {0};
+std::atomic<size_t> g_num_samples {0};
+uint64_t g_target_query_id_hi = 0;
+uint64_t g_target_query_id_lo = 0;
+Sample* g_samples = nullptr;
+
+void sample_handler(int, siginfo_t*, void* context) {
+    int saved_errno = errno;
+    g_running_handlers.fetch_add(1);
+    if (g_sampling.load() && signal::query_id_hi == g_target_query_id_hi &&
+        signal::query_id_lo == g_target_query_id_lo) {
+        size_t idx = g_num_samples.fetch_add(1, std::memory_order_relaxed);
+        if (idx < kMaxSamples) {
+            StackTrace trace(*reinterpret_cast<ucontext_t*>(context));
+            const auto& frame_pointers = trace.getFramePointers();
+            Sample& sample = g_samples[idx];
+            sample.size = 0;
+            for (size_t i = trace.getOffset(); i < trace.getSize(); ++i) {
+                sample.frames[sample.size++] = frame_pointers[i];
+            }
+        }
+    }
+    g_running_handlers.fetch_sub(1);
+    errno = saved_errno;
+}
+
+// The handler stays installed once the first profiling starts, a SIGPROF still pending when the
+// timer is disarmed must not fall back to the default action, which terminates the process.
+Status install_sample_handler() {
+    static std::once_flag once;
+    static int install_errno = 0;
+    std::call_once(once, [] {
+        struct sigaction action;
+        memset(&action, 0, sizeof(action));
+        action.sa_sigaction = sample_handler;
+        action.sa_flags = SA_SIGINFO | SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        if (sigaction(SIGPROF, &action, nullptr) != 0) {
+            install_errno = errno;
+        }
+    });
+    if (install_errno != 0) {
+        return Status::InternalError("failed to install SIGPROF handler: {}",
+                                     strerror(install_errno));
+    }
+    return Status::OK();
+}
+
+std::string symbol_name(void* address) {
+#if defined(__ELF__) && !defined(__FreeBSD__)
+    auto symbol_index = SymbolIndex::instance();
+    if (const auto* symbol = symbol_index->findSymbol(address)) {
+        std::string name = demangle(symbol->name);
+        // ';' separates the frames of a folded stack
+        std::replace(name.begin(), name.end(), ';', ':');
+        return name;
+    }
+#endif
+    return fmt::format("{}", address);
+}
+
+} // namespace
+
+Status QueryCpuProfiler::profile(const TUniqueId& query_id, int32_t seconds, int32_t frequency,
+                                 std::string* folded_stacks) {
+    if (seconds <= 0 || frequency <= 0 || frequency > 1000) {
+        return Status::InvalidArgument(
+                "invalid seconds {} or frequency {}, frequency should be in (0, 1000]", seconds,
+                frequency);
+    }
+    static std::mutex profile_lock;
+    std::unique_lock<std::mutex> l(profile_lock, std::try_to_lock);
+    if (!l.owns_lock()) {
+        return Status::InternalError("another query cpu profiling is running");
+    }
+    RETURN_IF_ERROR(install_sample_handler());
+
+    std::vector<Sample> samples(kMaxSamples);
+    // the first unwinding of a process may allocate, do it outside of the signal handler
+    StackTrace warm_up;
+    g_samples = samples.data();
+    g_target_query_id_hi = query_id.hi;
+    g_target_query_id_lo = query_id.lo;
+    g_num_samples = 0;
+    g_sampling = true;
+
+    struct itimerval timer;
+    memset(&timer, 0, sizeof(timer));
+    timer.it_interval.tv_usec = 1000000 / frequency;
+    timer.it_value = timer.it_interval;
+    Status st = Status::OK();
+    if (setitimer(ITIMER_PROF, &timer, nullptr) != 0) {
+        st = Status::InternalError("failed to arm ITIMER_PROF: {}", strerror(errno));
+    } else {
+        std::this_thread::sleep_for(std::chrono::seconds(seconds));
+        memset(&timer, 0, sizeof(timer));
+        static_cast<void>(setitimer(ITIMER_PROF, &timer, nullptr));
+    }
+    g_sampling = false;
+    while (g_running_handlers.load() > 0) {
+        std::this_thread::yield();
+    }
+    RETURN_IF_ERROR(st);
+
+    size_t total_samples = g_num_samples.load();
+    size_t num_samples = std::min(total_samples, kMaxSamples);
+    std::map<std::vector<void*>, int64_t> stacks;
+    for (size_t i = 0; i < num_samples; ++i) {
+        const Sample& sample = samples[i];
+        stacks[std::vector<void*>(sample.frames, sample.frames + sample.size)]++;
+    }
+
+    std::unordered_map<void*, std::string> symbols;
+    folded_stacks->clear();
+    for (const auto& [frames, count] : stacks) {
+        // frames are leaf first, folded stacks are root first
+        for (auto it = frames.rbegin(); it != frames.rend(); ++it) {
+            auto [symbol, inserted] = symbols.try_emplace(*it);
+            if (inserted) {
+                symbol->second = symbol_name(*it);
+            }
+            if (it != frames.rbegin()) {
+                folded_stacks->push_back(';');
+            }
+            folded_stacks->append(symbol->second);
+        }
+        folded_stacks->append(fmt::format(" {}\n", count));
+    }
+    LOG(INFO) << "query cpu profiling of " << print_id(query_id) << " finished, " << seconds
+              << "s at " << frequency << "Hz, got " << total_samples << " samples, "
+              << total_samples - num_samples << " dropped, " << stacks.size() << " distinct stacks";
+    return Status::OK();
+}
+
+} // namespace doris
@@ -0,0 +1,48 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/Types_types.h>
+
+#include <cstdint>
+#include <string>
+
+#include "common/status.h"
+
+namespace doris {
+
+// CPU sampling of a single query.
+//
+// A SIGPROF timer on the process CPU time is armed for the duration of the profiling, the
+// signal is delivered to the thread that consumed the CPU. The handler only records the stack
+// when the thread is attached to the target query, which is checked with the query id the
+// thread context tags into `signal::query_id_hi/lo` on SCOPED_ATTACH_TASK. So the samples of a
+// query are proportional to the CPU it used even on a busy BE.
+//
+// It uses SIGPROF like the gperftools CPU profiler, the caller must make sure they do not run
+// at the same time.
+class QueryCpuProfiler {
+public:
+    // Samples the query for `seconds` at `frequency` samples per second of CPU time, and returns
+    // the stacks in the folded format of FlameGraph's stackcollapse scripts, one
+    // "root;...;leaf count" per line.
+    static Status profile(const TUniqueId& query_id, int32_t seconds, int32_t frequency,
+                          std::string* folded_stacks);
+};
+
+} // namespace doris
@@ -125,6 +125,36 @@ void iterate_through_bits_mask(Func func, decltype(bytes_mask_to_bits_mask(nullp
 #endif
 }
 
+// Writes `offset + i` for every i in [0, size) with data[i] != 0 to `indexes` and returns how
+// many were written. `data` must only contain 0 or 1, e.g. the flags of a predicate, and
+// `indexes` must have room for `size` elements.
+template <typename T>
+inline size_t bytes_mask_to_indexes(const uint8_t* __restrict data, size_t size, T offset,
+                                    T* __restrict indexes) {
+    size_t count = 0;
+    size_t pos = 0;
+    for (; pos + bits_mask_length() <= size; pos += bits_mask_length()) {
+        const auto mask = bytes_mask_to_bits_mask(data + pos);
+        if (mask == 0) {
+            continue;
+        }
+        if (mask == bits_mask_all()) {
+            for (size_t i = 0; i < bits_mask_length(); ++i) {
+                indexes[count++] = static_cast<T>(offset + pos + i);
+            }
+            continue;
+        }
+        iterate_through_bits_mask(
+                [&](auto bit_pos) { indexes[count++] = static_cast<T>(offset + pos + bit_pos); },
+                mask);
+    }
+    for (; pos < size; ++pos) {
+        indexes[count] = static_cast<T>(offset + pos);
+        count += data[pos];
+    }
+    return count;
+}
+
 template <typename T>
     requires requires { std::is_unsigned_v<T>; }
 inline T count_zero_num(const int8_t* __restrict data, T size) {
@@ -25,6 +25,7 @@
 #include <glog/logging.h>
 
 #include <cstdlib>
+#include <cstring>
 // IWYU pragma: no_include <bits/std_abs.h>
 #include <cmath> // IWYU pragma: keep
 #include <cstdint>
@@ -249,6 +250,26 @@ private:
         return (s[0] == '.' && is_all_digit(s + 1, len - 1));
     }
 
+    // Returns true if the 8 bytes at s are all ascii digits, checked at once in a word.
+    static inline bool is_eight_digits(const char* __restrict s) {
+        uint64_t word;
+        memcpy(&word, s, sizeof(word));
+        // A byte is in ['0', '9'] iff its high nibble is 3 and adding 6 does not carry into it.
+        return ((word & 0xF0F0F0F0F0F0F0F0ULL) |
+                (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+               0x3333333333333333ULL;
+    }
+
+    // Returns the value of the 8 ascii digits at s, the multiply-accumulate of simdjson/
+    // fast_float combines the adjacent digits, then pairs, then quads of the little endian word.
+    static inline uint32_t parse_eight_digits(const char* __restrict s) {
+        uint64_t word;
+        memcpy(&word, s, sizeof(word));
+        word = (word & 0x0F0F0F0F0F0F0F0FULL) * 2561 >> 8;
+        word = (word & 0x00FF00FF00FF00FFULL) * 6553601 >> 16;
+        return static_cast<uint32_t>((word & 0x0000FFFF0000FFFFULL) * 42949672960001ULL >> 32);
+    }
+
     static inline bool is_all_digit(const char* __restrict s, int len) {
         for (int i = 0; i < len; ++i) {
             if (!LIKELY(s[i] >= '0' && s[i] <= '9')) {
@@ -459,7 +480,15 @@ T StringParser::string_to_int_no_overflow(const char* __restrict s, int len, Par
         *result = PARSE_FAILURE;
         return 0;
     }
-    for (int i = 1; i < len; ++i) {
+    int i = 1;
+    if constexpr (sizeof(T) >= sizeof(uint32_t)) {
+        // The caller guarantees that the digits cannot overflow T, so 8 of them could only be
+        // there if T is wide enough to take val * 10^8.
+        for (; i + 8 <= len && is_eight_digits(s + i); i += 8) {
+            val = val * 100000000 + parse_eight_digits(s + i);
+        }
+    }
+    for (; i < len; ++i) {
         if (LIKELY(s[i] >= '0' && s[i] <= '9')) {
             T digit = s[i] - '0';
             val = val * 10 + digit;
@@ -423,6 +423,12 @@ Status ThreadPool::submit_func(std::function<void()> f) {
 Status ThreadPool::do_submit(std::shared_ptr<Runnable> r, ThreadPoolToken* token) {
     DCHECK(token);
 
+    // Build the task before taking the lock, the lock is contended by all submitters and workers
+    // of a busy pool, and so are the other steps moved out of it.
+    Task task;
+    task.runnable = std::move(r);
+    task.submit_time_wather.start();
+
     std::unique_lock<std::mutex> l(_lock);
     if (!_pool_status.ok()) [[unlikely]] {
         return _pool_status;
@@ -470,10 +476,6 @@ Status ThreadPool::do_submit(std::shared_ptr<Runnable> r, ThreadPoolToken* token
         _num_threads_pending_start++;
     }
 
-    Task task;
-    task.runnable = std::move(r);
-    task.submit_time_wather.start();
-
     // Add the task to the token's queue.
     ThreadPoolToken::State state = token->state();
     DCHECK(state == ThreadPoolToken::State::IDLE || state == ThreadPoolToken::State::RUNNING);
@@ -601,15 +603,15 @@ void ThreadPool::dispatch_thread() {
         DCHECK_EQ(ThreadPoolToken::State::RUNNING, token->state());
         DCHECK(!token->_entries.empty());
         Task task = std::move(token->_entries.front());
-        thread_pool_task_wait_worker_time_ns_total->increment(
-                task.submit_time_wather.elapsed_time());
-        thread_pool_task_wait_worker_count_total->increment(1);
+        auto wait_worker_time_ns = task.submit_time_wather.elapsed_time();
         token->_entries.pop_front();
         token->_active_threads++;
         --_total_queued_tasks;
         ++_active_threads;
 
         l.unlock();
+        thread_pool_task_wait_worker_time_ns_total->increment(wait_worker_time_ns);
+        thread_pool_task_wait_worker_count_total->increment(1);
 
         // Execute the task
         task.runnable->run();
@@ -620,10 +622,10 @@ void ThreadPool::dispatch_thread() {
         // In the worst case, the destructor might even try to do something
         // with this threadpool, and produce a deadlock.
         task.runnable.reset();
-        l.lock();
         thread_pool_task_execution_time_ns_total->increment(
                 task_execution_time_watch.elapsed_time());
         thread_pool_task_execution_count_total->increment(1);
+        l.lock();
         // Possible states:
         // 1. The token was shut down while we ran its task. Transition to QUIESCED.
         // 2. The token has no more queued tasks. Transition back to IDLE.
@@ -30,6 +30,8 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/case_conv.hpp>
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <filesystem>
 #include <memory>
@@ -179,5 +181,73 @@ bool TimezoneUtils::parse_tz_offset_string(const std::string& timezone, cctz::ti
     return false;
 }
 
+namespace {
+
+const cctz::civil_second civil_epoch(1970, 1, 1, 0, 0, 0);
+// bound of the ranges of a zone without transitions, far beyond any supported date
+constexpr int64_t no_transition = int64_t(1) << 62;
+
+cctz::time_point<cctz::seconds> to_time_point(int64_t seconds) {
+    return cctz::time_point<cctz::seconds>(cctz::seconds(seconds));
+}
+
+int64_t to_seconds(const cctz::time_point<cctz::seconds>& tp) {
+    return tp.time_since_epoch().count();
+}
+
+} // namespace
+
+bool TimezoneConverter::_lookup(int64_t seconds) {
+    const auto tp = to_time_point(seconds);
+    _offset = _ctz.lookup(tp).offset;
+    int64_t prev_offset = _offset;
+    int64_t next_offset = _offset;
+    _begin = -no_transition;
+    _end = no_transition;
+    cctz::time_zone::civil_transition trans;
+    // the latest transition at or before tp
+    bool has_prev = _ctz.prev_transition(tp + cctz::seconds(1), &trans);
+    if (has_prev) {
+        _begin = to_seconds(_ctz.lookup(trans.to).trans);
+        prev_offset = _ctz.lookup(to_time_point(_begin - 1)).offset;
+    }
+    // the earliest transition after tp
+    bool has_next = _ctz.next_transition(tp, &trans);
+    if (has_next) {
+        _end = to_seconds(_ctz.lookup(trans.to).trans);
+        next_offset = _ctz.lookup(to_time_point(_end)).offset;
+    }
+    // cctz stops enumerating the transitions some centuries ahead, while its lookups still
+    // follow the rule of the zone, so no next transition after a previous one means unknown.
+    if ((has_prev && !has_next) || seconds < _begin || seconds >= _end) [[unlikely]] {
+        _begin = _end = _civil_begin = _civil_end = 0;
+        return false;
+    }
+    // A transition to a smaller offset repeats the civil times just before it, and one to a larger
+    // offset skips the civil times just after it. Keep only the civil times unique to this range.
+    _civil_begin = _begin + std::max(_offset, prev_offset);
+    _civil_end = _end + std::min(_offset, next_offset);
+    if (_civil_begin > _civil_end) [[unlikely]] {
+        _civil_begin = _civil_end = 0;
+    }
+    return true;
+}
+
+int64_t TimezoneConverter::to_unix_seconds(int64_t civil_seconds) {
+    if (civil_seconds >= _civil_begin && civil_seconds < _civil_end) [[likely]] {
+        return civil_seconds - _offset;
+    }
+    const int64_t seconds = to_seconds(cctz::convert(civil_epoch + civil_seconds, _ctz));
+    _lookup(seconds);
+    return seconds;
+}
+
+int64_t TimezoneConverter::to_civil_seconds(int64_t seconds) {
+    if ((seconds < _begin || seconds >= _end) && !_lookup(seconds)) [[unlikely]] {
+        return cctz::convert(to_time_point(seconds), _ctz) - civil_epoch;
+    }
+    return seconds + _offset;
+}
+
 #include "common/compile_check_end.h"
 } // namespace doris
@@ -18,11 +18,10 @@
 
 #pragma once
 
-#include <string>
+#include <cctz/time_zone.h>
 
-namespace cctz {
-class time_zone;
-} // namespace cctz
+#include <cstdint>
+#include <string>
 
 namespace doris {
 
@@ -47,4 +46,35 @@ private:
 
     static bool parse_tz_offset_string(const std::string& timezone, cctz::time_zone& ctz);
 };
+
+// Converts between the civil times of a time zone and seconds since epoch as cctz::convert does,
+// but remembers the range around the last conversion in which the UTC offset of the zone does not
+// change. Converting the rows of a block that does not span a transition of the zone then costs
+// one search of the transitions instead of one per row, and no normalization of cctz civil times.
+// Civil times are given in seconds since 1970-01-01 00:00:00. Not thread safe, use one per thread.
+class TimezoneConverter {
+public:
+    explicit TimezoneConverter(const cctz::time_zone& ctz) : _ctz(ctz) {}
+
+    // as cctz::convert(civil_second, ctz), a skipped civil time is at the transition, and a
+    // repeated one uses the offset before the transition
+    int64_t to_unix_seconds(int64_t civil_seconds);
+
+    // as cctz::convert(time_point, ctz)
+    int64_t to_civil_seconds(int64_t seconds);
+
+private:
+    // Fills the ranges around `seconds`, returns false if the transitions around it are unknown.
+    bool _lookup(int64_t seconds);
+
+    cctz::time_zone _ctz;
+    int64_t _offset = 0;
+    // seconds since epoch in [_begin, _end) are at `_offset`
+    int64_t _begin = 0;
+    int64_t _end = 0;
+    // civil times in [_civil_begin, _civil_end) are neither skipped nor repeated and are at
+    // `_offset`
+    int64_t _civil_begin = 0;
+    int64_t _civil_end = 0;
+};
 } // namespace doris
@@ -259,8 +259,26 @@ public:
         bool has_null = column->has_null();
 
         if (has_null) {
-            for (size_t i = 0; i < batch_size; ++i) {
-                this->add(place, columns, i, arena);
+            // add every run of not null rows by one call of the nested function instead of a
+            // virtual call per row, an all null batch does not reach the nested function at all
+            const auto* __restrict null_map_data = column->get_null_map_data().data();
+            const IColumn* nested_column = &column->get_nested_column();
+            size_t i = 0;
+            while (i < batch_size) {
+                size_t run_begin = i;
+                while (i < batch_size && !null_map_data[i]) {
+                    ++i;
+                }
+                if (i > run_begin) {
+                    this->set_flag(place);
+                    this->nested_function->add_batch_range(
+                            run_begin, i - 1, this->nested_place(place), &nested_column, arena);
+                }
+                run_begin = i;
+                while (i < batch_size && null_map_data[i]) {
+                    ++i;
+                }
+                this->null_count += i - run_begin;
             }
         } else {
             this->set_flag(place);
@@ -100,6 +100,35 @@ public:
                 typename PrimitiveTypeTraits<TResult>::ColumnItemType(column.get_data()[row_num]));
     }
 
+    // The generic helpers go through add() once per row, which re-reads the column from
+    // `columns` on every iteration because it may alias the states. Hoist the input once and
+    // scatter into the states directly.
+    void add_batch(size_t batch_size, AggregateDataPtr* places, size_t place_offset,
+                   const IColumn** columns, Arena&, bool /*agg_many*/) const override {
+        const auto* __restrict input =
+                assert_cast<const ColVecType&, TypeCheckOnRelease::DISABLE>(*columns[0])
+                        .get_data()
+                        .data();
+        for (size_t i = 0; i < batch_size; ++i) {
+            this->data(places[i] + place_offset)
+                    .add(typename PrimitiveTypeTraits<TResult>::ColumnItemType(input[i]));
+        }
+    }
+
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena&) const override {
+        const auto* __restrict input =
+                assert_cast<const ColVecType&, TypeCheckOnRelease::DISABLE>(*columns[0])
+                        .get_data()
+                        .data();
+        // Accumulate in a local so the loop can stay in registers and vectorize.
+        Data local;
+        for (size_t i = 0; i < batch_size; ++i) {
+            local.add(typename PrimitiveTypeTraits<TResult>::ColumnItemType(input[i]));
+        }
+        this->data(place).merge(local);
+    }
+
     void reset(AggregateDataPtr place) const override { this->data(place).sum = {}; }
 
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
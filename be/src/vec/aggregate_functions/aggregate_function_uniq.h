@@ -179,6 +179,12 @@ public:
         if (rhs_set.size() == 0) return;
 
         auto& set = this->data(place).set;
+        if (set.empty()) {
+            // The first merge into a fresh state (the usual case on the final phase) needs no
+            // duplicate checks: copying lays the elements out without probing for each one.
+            set = rhs_set;
+            return;
+        }
         set.rehash(set.size() + rhs_set.size());
 
         for (auto elem : rhs_set) {
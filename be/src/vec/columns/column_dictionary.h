@@ -299,11 +299,9 @@ public:
 
         auto res = create_column();
         res->reserve(_codes.capacity());
-        for (size_t i = 0; i < _codes.size(); ++i) {
-            auto& code = reinterpret_cast<Int32&>(_codes[i]);
-            auto value = _dict.get_value(code);
-            res->insert_data(value.data, value.size);
-        }
+        // resolve all codes in one call, the predicate column only keeps references to dict values
+        res->insert_many_dict_data(_codes.data(), 0, _dict.data(), _codes.size(),
+                                   static_cast<uint32_t>(_dict.size()));
         clear();
         _dict.clear();
         return res;
@@ -350,6 +348,8 @@ public:
 
         inline const StringRef& get_value(Int32 code) const { return (*_dict_data)[code]; }
 
+        const StringRef* data() const { return _dict_data->data(); }
+
         // The function is only used in the runtime filter feature
         inline void initialize_hash_values_for_runtime_filter() {
             if (_hash_values.empty()) {
@@ -112,7 +112,10 @@ void ColumnNullable::update_crcs_with_value(uint32_t* __restrict hashes, doris::
                 hashes[i] = HashUtil::zlib_crc_hash_null(hashes[i]);
             }
         }
-        nested_column->update_crcs_with_value(hashes, type, rows, offset, real_null_data);
+        // the nested column skips every row of an all null column
+        if (simd::contain_byte(real_null_data, s, 0)) {
+            nested_column->update_crcs_with_value(hashes, type, rows, offset, real_null_data);
+        }
     }
 }
 
@@ -130,7 +133,10 @@ void ColumnNullable::update_hashes_with_value(uint64_t* __restrict hashes,
                 hashes[i] = HashUtil::xxHash64NullWithSeed(hashes[i]);
             }
         }
-        nested_column->update_hashes_with_value(hashes, real_null_data);
+        // the nested column skips every row of an all null column
+        if (simd::contain_byte(real_null_data, s, 0)) {
+            nested_column->update_hashes_with_value(hashes, real_null_data);
+        }
     }
 }
 
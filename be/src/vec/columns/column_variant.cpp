@@ -1617,6 +1617,10 @@ void ColumnVariant::unnest(Subcolumns::NodePtr& entry, Subcolumns& arg_subcolumn
 }
 
 void ColumnVariant::finalize(FinalizeMode mode) {
+    finalize(mode, {});
+}
+
+void ColumnVariant::finalize(FinalizeMode mode, const PathSet& materialized_paths) {
     Subcolumns new_subcolumns;
     // finalize root first
     if (mode == FinalizeMode::WRITE_MODE || !is_null_root()) {
@@ -1646,7 +1650,7 @@ void ColumnVariant::finalize(FinalizeMode mode) {
 
         // Check and spilit sparse subcolumns, not support nested array at present
         if (mode == FinalizeMode::WRITE_MODE && (entry->data.check_if_sparse_column(num_rows)) &&
-            !entry->path.has_nested_part()) {
+            !entry->path.has_nested_part() && !materialized_paths.contains(entry->path)) {
             // TODO seperate ambiguous path
             sparse_columns.add(entry->path, entry->data);
             continue;
@@ -239,6 +239,7 @@ public:
         bool is_root = false;
     };
     using Subcolumns = SubcolumnsTree<Subcolumn, false>;
+    using PathSet = std::unordered_set<PathInData, PathInData::Hash>;
 
 private:
     /// If true then all subcolumns are nullable.
@@ -361,6 +362,11 @@ public:
     // use sparse_subcolumns_schema to record sparse column's path info and type
     void finalize(FinalizeMode mode);
 
+    // Same as finalize(mode), but paths in materialized_paths are never split into sparse
+    // columns in write mode, so a path that was already stored as a typed subcolumn keeps
+    // its layout instead of flipping between subcolumn and sparse from block to block.
+    void finalize(FinalizeMode mode, const PathSet& materialized_paths);
+
     /// Finalizes all subcolumns.
     void finalize() override;
 
@@ -17,7 +17,9 @@
 
 #include "vec/common/allocator.h"
 
+#include <bvar/bvar.h>
 #include <glog/logging.h>
+#include <sys/mman.h>
 
 #include <atomic>
 // IWYU pragma: no_include <bits/chrono.h>
@@ -45,6 +47,29 @@ namespace doris {
 std::unordered_map<void*, size_t> RecordSizeMemoryAllocator::_allocated_sizes;
 std::mutex RecordSizeMemoryAllocator::_mutex;
 
+namespace {
+constexpr size_t HUGE_PAGE_SIZE = 2UL * 1024 * 1024;
+
+bvar::Adder<int64_t> g_allocator_huge_page_advised_bytes("allocator_huge_page_advised_bytes");
+
+// Ask the kernel to back the 2M-aligned interior of a large buffer with transparent huge pages,
+// hash table buckets and arena chunks are probed randomly and suffer from dTLB misses otherwise.
+// It is only advice: with THP disabled or no huge page available the kernel keeps 4K pages.
+void advise_huge_pages(void* buf, size_t size) {
+#if defined(OS_LINUX) && defined(MADV_HUGEPAGE)
+    if (!config::enable_huge_page_for_large_alloc || size < HUGE_PAGE_SIZE) {
+        return;
+    }
+    auto begin = (reinterpret_cast<uintptr_t>(buf) + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+    auto end = (reinterpret_cast<uintptr_t>(buf) + size) & ~(HUGE_PAGE_SIZE - 1);
+    if (end > begin &&
+        madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE) == 0) {
+        g_allocator_huge_page_advised_bytes << static_cast<int64_t>(end - begin);
+    }
+#endif
+}
+} // namespace
+
 template <bool clear_memory_, bool mmap_populate, bool use_mmap, typename MemoryAllocator>
 bool Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::sys_memory_exceed(
         size_t size, std::string* err_msg) const {
@@ -233,6 +258,12 @@ void Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::memory_
         size_t size) const {
     if (MemoryAllocator::need_check_and_tracking_memory()) {
         alloc_fault_probability();
+        // Small buffers (filters, offsets, selection vectors of a batch) are still tracked by
+        // consume_memory, they only skip the limit checks, which read the shared process and
+        // query counters. The next larger allocation of the thread sees their consumption.
+        if (size < static_cast<size_t>(doris::config::allocator_check_limit_min_bytes)) {
+            return;
+        }
         sys_memory_check(size);
         memory_tracker_check(size);
     }
@@ -311,6 +342,7 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::alloc(
         if constexpr (MemoryAllocator::need_record_actual_size()) {
             record_size = MemoryAllocator::allocated_size(buf);
         }
+        advise_huge_pages(buf, size);
 
         /// No need for zero-fill, because mmap guarantees it.
     } else {
@@ -347,6 +379,7 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::alloc(
             }
             add_address_sanitizers(buf, record_size);
         }
+        advise_huge_pages(buf, size);
     }
     if constexpr (MemoryAllocator::need_record_actual_size()) {
         consume_memory(record_size - size);
@@ -397,6 +430,9 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::reallo
         }
         // usually, buf addr = new_buf addr, asan maybe not equal.
         add_address_sanitizers(new_buf, new_size);
+        if (new_size > old_size) {
+            advise_huge_pages(new_buf, new_size);
+        }
 
         buf = new_buf;
         release_memory(old_size);
@@ -417,6 +453,9 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::reallo
                                         old_size, new_size));
         }
         release_memory(old_size);
+        if (new_size > old_size) {
+            advise_huge_pages(buf, new_size);
+        }
 
         /// No need for zero-fill, because mmap guarantees it.
 
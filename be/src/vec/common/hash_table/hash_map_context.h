@@ -53,6 +53,10 @@ struct MethodBaseInner {
     // use in join case
     DorisVector<uint32_t> bucket_nums;
 
+    // whether the rows with equal keys are always the same entry of the hash table, false if
+    // the keys of the rows with null keys are not set
+    static constexpr bool reuse_adjacent_keys = false;
+
     MethodBaseInner() { hash_table.reset(new HashMap()); }
     virtual ~MethodBaseInner() = default;
 
@@ -190,6 +194,8 @@ struct MethodSerialized : public MethodBase<TData> {
     using Base::init_iterator;
     using State = ColumnsHashing::HashMethodSerialized<typename Base::Value, typename Base::Mapped>;
     using Base::try_presis_key;
+    // the serialized keys carry the null flags of the columns
+    static constexpr bool reuse_adjacent_keys = true;
     // need keep until the hash probe end.
     DorisVector<StringRef> build_stored_keys;
     Arena build_arena;
@@ -297,6 +303,8 @@ struct MethodStringNoCache : public MethodBase<TData> {
     using Base::hash_table;
     using State =
             ColumnsHashing::HashMethodString<typename Base::Value, typename Base::Mapped, true>;
+    // nullable keys go through MethodSingleNullableColumn, which opts out
+    static constexpr bool reuse_adjacent_keys = true;
 
     // need keep until the hash probe end.
     DorisVector<StringRef> _build_stored_keys;
@@ -374,6 +382,7 @@ struct MethodOneNumber : public MethodBase<TData> {
     using Base::hash_table;
     using State = ColumnsHashing::HashMethodOneNumber<typename Base::Value, typename Base::Mapped,
                                                       FieldType>;
+    static constexpr bool reuse_adjacent_keys = true;
 
     size_t estimated_size(const ColumnRawPtrs& key_columns, size_t num_rows, bool is_join,
                           bool is_build, uint32_t bucket_size) override {
@@ -420,6 +429,8 @@ struct MethodKeysFixed : public MethodBase<TData> {
     using Base::hash_table;
 
     using State = ColumnsHashing::HashMethodKeysFixed<typename Base::Value, Key, Mapped>;
+    // the null bitmap of the keys is packed into the keys
+    static constexpr bool reuse_adjacent_keys = true;
 
     // need keep until the hash probe end. use only in join
     DorisVector<Key> build_stored_keys;
@@ -701,6 +712,7 @@ struct MethodSingleNullableColumn : public SingleColumnMethod {
     using Base = SingleColumnMethod;
     using State = ColumnsHashing::HashMethodSingleLowNullableColumn<typename Base::State,
                                                                     typename Base::Mapped>;
+    static constexpr bool reuse_adjacent_keys = false;
     void insert_keys_into_columns(std::vector<typename Base::Key>& input_keys,
                                   MutableColumns& key_columns, const size_t num_rows) override {
         auto* col = key_columns[0].get();
@@ -717,4 +729,25 @@ struct MethodSingleNullableColumn : public SingleColumnMethod {
     }
 };
 
+// Emplaces the keys of all the rows, the row with the same key as the row before it takes the
+// mapped value of that row instead of probing the hash table again, which saves most of the
+// probes when the input is clustered on the keys.
+template <typename HashMethod, typename State, typename F, typename FF, typename MappedPtr>
+ALWAYS_INLINE void lazy_emplace_batch(HashMethod& method, State& state, size_t num_rows,
+                                      F&& creator, FF&& creator_for_null_key, MappedPtr* places) {
+    if constexpr (HashMethod::reuse_adjacent_keys) {
+        for (size_t i = 0; i < num_rows; ++i) {
+            if (i > 0 && method.keys[i] == method.keys[i - 1]) {
+                places[i] = places[i - 1];
+                continue;
+            }
+            places[i] = *method.lazy_emplace(state, i, creator, creator_for_null_key);
+        }
+    } else {
+        for (size_t i = 0; i < num_rows; ++i) {
+            places[i] = *method.lazy_emplace(state, i, creator, creator_for_null_key);
+        }
+    }
+}
+
 } // namespace doris::vectorized
\ No newline at end of file
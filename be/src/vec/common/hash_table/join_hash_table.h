@@ -21,6 +21,8 @@
 
 #include <limits>
 
+#include "common/compiler_util.h"
+#include "common/config.h"
 #include "common/exception.h"
 #include "common/status.h"
 #include "vec/columns/column_filter_helper.h"
@@ -44,7 +46,8 @@ public:
 
     size_t get_byte_size() const {
         auto cal_vector_mem = [](const auto& vec) { return vec.capacity() * sizeof(vec[0]); };
-        return cal_vector_mem(visited) + cal_vector_mem(first) + cal_vector_mem(next);
+        return cal_vector_mem(visited) + cal_vector_mem(first) + cal_vector_mem(next) +
+               cal_vector_mem(_clustered_keys) + cal_vector_mem(_row_ids);
     }
 
     template <int JoinOpType>
@@ -64,6 +67,9 @@ public:
                       JoinOpType == TJoinOp::RIGHT_SEMI_JOIN) {
             visited.resize(num_elem);
         }
+        // A small hash table stays in cache, prefetching would only cost instructions.
+        _enable_probe_prefetch = config::enable_hash_join_probe_prefetch &&
+                                 bucket_size >= PROBE_PREFETCH_MIN_BUCKET_SIZE;
     }
 
     uint32_t get_bucket_size() const { return bucket_size; }
@@ -76,6 +82,11 @@ public:
 
     void build(const Key* __restrict keys, const uint32_t* __restrict bucket_nums, size_t num_elem,
                bool keep_null_key) {
+        if (config::enable_hash_join_clustered_build &&
+            num_elem >= size_t(config::hash_join_clustered_build_min_rows)) {
+            _build_clustered(keys, bucket_nums, num_elem, keep_null_key);
+            return;
+        }
         build_keys = keys;
         for (size_t i = 1; i < num_elem; i++) {
             uint32_t bucket_num = bucket_nums[i];
@@ -209,13 +220,93 @@ public:
 
     bool keep_null_key() { return _keep_null_key; }
 
+    bool enable_probe_prefetch() const { return _enable_probe_prefetch; }
+
     void pre_build_idxs(DorisVector<uint32_t>& buckets) const {
+        if (_enable_probe_prefetch) {
+            const size_t num = buckets.size();
+            for (size_t i = 0; i < num; i++) {
+                if (LIKELY(i + HASH_MAP_PREFETCH_DIST < num)) {
+                    __builtin_prefetch(&first[buckets[i + HASH_MAP_PREFETCH_DIST]], 0, 1);
+                }
+                buckets[i] = first[buckets[i]];
+            }
+            return;
+        }
         for (unsigned int& bucket : buckets) {
             bucket = first[bucket];
         }
     }
 
+    bool is_clustered() const { return _clustered; }
+
 private:
+    static constexpr uint32_t PROBE_PREFETCH_MIN_BUCKET_SIZE = 1 << 16;
+
+    /**
+     * For a very large build side, radix sort the build rows by bucket so that the rows of one
+     * bucket are stored contiguously (positions in `[first[bucket], first[bucket] + count)`).
+     * A chain walk then reads `build_keys` and `next` sequentially instead of jumping around the
+     * whole build side. Positions are mapped back to build rows by `_row_ids`, `visited` and all
+     * emitted build indexes stay in build row space.
+     */
+    void _build_clustered(const Key* __restrict keys, const uint32_t* __restrict bucket_nums,
+                          size_t num_elem, bool keep_null_key) {
+        _clustered = true;
+        _clustered_keys.resize(num_elem);
+        _row_ids.resize(num_elem);
+        // the first row is mocked, keep it at position 0 so that 0 still means end of chain
+        _clustered_keys[0] = keys[0];
+        _row_ids[0] = 0;
+
+        for (size_t i = 1; i < num_elem; i++) {
+            first[bucket_nums[i]]++;
+        }
+        DorisVector<uint32_t> cursor(first.size());
+        uint32_t pos = 1;
+        for (size_t b = 0; b < first.size(); b++) {
+            auto count = first[b];
+            first[b] = count ? pos : 0;
+            cursor[b] = pos;
+            pos += count;
+        }
+        for (size_t i = 1; i < num_elem; i++) {
+            auto p = cursor[bucket_nums[i]]++;
+            _clustered_keys[p] = keys[i];
+            _row_ids[p] = uint32_t(i);
+        }
+        for (size_t b = 0; b < first.size(); b++) {
+            if (!first[b]) {
+                continue;
+            }
+            const uint32_t end = cursor[b];
+            for (uint32_t p = first[b]; p < end; p++) {
+                next[p] = p + 1 < end ? p + 1 : 0;
+            }
+        }
+        build_keys = _clustered_keys.data();
+        if (!keep_null_key) {
+            first[bucket_size] = 0; // index = bucket_size means null
+        }
+        _keep_null_key = keep_null_key;
+    }
+
+    // Map a position in the chains to the build row.
+    uint32_t _row_id(uint32_t build_idx) const {
+        return _clustered ? _row_ids[build_idx] : build_idx;
+    }
+
+    // Bring the chain head of the row `HASH_MAP_PREFETCH_DIST` ahead into cache, so the chain
+    // walk of that row does not stall on the random access to `build_keys` and `next`.
+    void _prefetch_chain_head(const uint32_t* __restrict build_idx_map, int probe_idx,
+                              int probe_rows) const {
+        if (_enable_probe_prefetch && probe_idx + int(HASH_MAP_PREFETCH_DIST) < probe_rows) {
+            auto head = build_idx_map[probe_idx + HASH_MAP_PREFETCH_DIST];
+            __builtin_prefetch(&build_keys[head], 0, 1);
+            __builtin_prefetch(&next[head], 0, 1);
+        }
+    }
+
     template <int JoinOpType>
     auto _process_null_aware_left_half_join_for_empty_build_side(int probe_idx, int probe_rows,
                                                                  uint32_t* __restrict probe_idxs,
@@ -242,11 +333,13 @@ private:
                                      const uint32_t* __restrict build_idx_map, int probe_idx,
                                      int probe_rows) {
         while (probe_idx < probe_rows) {
+            _prefetch_chain_head(build_idx_map, probe_idx, probe_rows);
             auto build_idx = build_idx_map[probe_idx];
 
             while (build_idx) {
-                if (!visited[build_idx] && keys[probe_idx] == build_keys[build_idx]) {
-                    visited[build_idx] = 1;
+                const auto build_row = _row_id(build_idx);
+                if (!visited[build_row] && keys[probe_idx] == build_keys[build_idx]) {
+                    visited[build_row] = 1;
                 }
                 build_idx = next[build_idx];
             }
@@ -271,6 +364,7 @@ private:
                 }
             }
 
+            _prefetch_chain_head(build_idx_map, probe_idx, probe_rows);
             auto build_idx = build_idx_map[probe_idx];
 
             while (build_idx && keys[probe_idx] != build_keys[build_idx]) {
@@ -293,7 +387,7 @@ private:
         auto do_the_probe = [&]() {
             while (build_idx && matched_cnt < batch_size) {
                 if (keys[probe_idx] == build_keys[build_idx]) {
-                    build_idxs[matched_cnt] = build_idx;
+                    build_idxs[matched_cnt] = _row_id(build_idx);
                     probe_idxs[matched_cnt] = probe_idx;
                     matched_cnt++;
 
@@ -347,13 +441,14 @@ private:
         auto do_the_probe = [&]() {
             while (build_idx && matched_cnt < batch_size) {
                 if (keys[probe_idx] == build_keys[build_idx]) {
+                    const auto build_row = _row_id(build_idx);
                     probe_idxs[matched_cnt] = probe_idx;
-                    build_idxs[matched_cnt] = build_idx;
+                    build_idxs[matched_cnt] = build_row;
                     matched_cnt++;
                     if constexpr (JoinOpType == TJoinOp::RIGHT_OUTER_JOIN ||
                                   JoinOpType == TJoinOp::FULL_OUTER_JOIN) {
-                        if (!visited[build_idx]) {
-                            visited[build_idx] = 1;
+                        if (!visited[build_row]) {
+                            visited[build_row] = 1;
                         }
                     }
                 }
@@ -381,6 +476,7 @@ private:
         }
 
         while (probe_idx < probe_rows && matched_cnt < batch_size) {
+            _prefetch_chain_head(build_idx_map, probe_idx, probe_rows);
             build_idx = build_idx_map[probe_idx];
             do_the_probe();
         }
@@ -408,7 +504,7 @@ private:
 
             while (build_idx && matched_cnt < batch_size) {
                 if (picking_null_keys || keys[probe_idx] == build_keys[build_idx]) {
-                    build_idxs[matched_cnt] = build_idx;
+                    build_idxs[matched_cnt] = _row_id(build_idx);
                     probe_idxs[matched_cnt] = probe_idx;
                     null_flags[matched_cnt] = picking_null_keys;
                     matched_cnt++;
@@ -473,6 +569,12 @@ private:
     bool _has_null_key = false;
     bool _keep_null_key = false;
     bool _empty_build_side = true;
+    bool _enable_probe_prefetch = false;
+
+    // Only used by the clustered layout, see `_build_clustered`.
+    bool _clustered = false;
+    DorisVector<Key> _clustered_keys;
+    DorisVector<uint32_t> _row_ids;
 };
 
 template <typename Key, typename Hash = DefaultHash<Key>>
@@ -0,0 +1,329 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <boost/noncopyable.hpp>
+#include <limits>
+#include <vector>
+
+#include "common/config.h"
+#include "vec/common/hash_table/ph_hash_map.h"
+
+/**
+ * A hash map which starts as a single `PHHashMap` and, once it holds more than
+ * `config::agg_two_level_hash_table_threshold` elements, splits itself into `NUM_BUCKETS`
+ * sub maps selected by hash bits.
+ *
+ * A single huge table has to rehash all of its elements at once when it grows, which stalls
+ * the aggregation for seconds with 100M+ groups and needs twice the memory during the rehash.
+ * Sub maps grow independently, 1/NUM_BUCKETS of the elements at a time.
+ *
+ * The interface is the same as `PHHashMap` so it can be used by `MethodSerialized` directly.
+ */
+template <typename Key, typename Mapped, typename HashMethod = DefaultHash<Key>,
+          size_t BUCKET_BITS = 8>
+class TwoLevelPHHashMap : private boost::noncopyable {
+public:
+    using Self = TwoLevelPHHashMap;
+    using SubMap = PHHashMap<Key, Mapped, HashMethod>;
+    using Hash = HashMethod;
+    using cell_type = typename SubMap::cell_type;
+
+    using key_type = Key;
+    using mapped_type = Mapped;
+    using Value = Mapped;
+    using value_type = typename SubMap::value_type;
+
+    using LookupResult = typename SubMap::LookupResult;
+    using ConstLookupResult = typename SubMap::ConstLookupResult;
+
+    static constexpr size_t NUM_BUCKETS = 1ULL << BUCKET_BITS;
+    static constexpr size_t BUCKET_MASK = NUM_BUCKETS - 1;
+
+    TwoLevelPHHashMap() : _buckets(1) {
+        auto threshold = doris::config::agg_two_level_hash_table_threshold;
+        _convert_threshold = threshold > 0 ? size_t(threshold) : std::numeric_limits<size_t>::max();
+    }
+
+    TwoLevelPHHashMap(TwoLevelPHHashMap&& other) { *this = std::move(other); }
+
+    TwoLevelPHHashMap& operator=(TwoLevelPHHashMap&& rhs) {
+        _buckets = std::move(rhs._buckets);
+        _convert_threshold = rhs._convert_threshold;
+        rhs._buckets.clear();
+        rhs._buckets.resize(1);
+        return *this;
+    }
+
+    template <typename Derived, bool is_const>
+    class iterator_base {
+        using Container = std::conditional_t<is_const, const Self, Self>;
+        using SubIterator = std::conditional_t<is_const, typename SubMap::const_iterator,
+                                               typename SubMap::iterator>;
+
+        Container* container = nullptr;
+        size_t bucket = 0;
+        SubIterator sub_iterator;
+        friend class TwoLevelPHHashMap;
+
+        void skip_empty_buckets() {
+            while (bucket + 1 < container->_buckets.size() &&
+                   sub_iterator == container->_buckets[bucket].end()) {
+                ++bucket;
+                sub_iterator = container->_buckets[bucket].begin();
+            }
+        }
+
+    public:
+        iterator_base() = default;
+        iterator_base(Container* container_, size_t bucket_, SubIterator it)
+                : container(container_), bucket(bucket_), sub_iterator(it) {}
+
+        bool operator==(const iterator_base& rhs) const {
+            return bucket == rhs.bucket && sub_iterator == rhs.sub_iterator;
+        }
+        bool operator!=(const iterator_base& rhs) const { return !(*this == rhs); }
+
+        Derived& operator++() {
+            ++sub_iterator;
+            skip_empty_buckets();
+            return static_cast<Derived&>(*this);
+        }
+
+        auto& operator*() const { return *this; }
+        auto* operator->() const { return this; }
+
+        auto& operator*() { return *this; }
+        auto* operator->() { return this; }
+
+        const auto& get_first() const { return sub_iterator->get_first(); }
+
+        const auto& get_second() const { return sub_iterator->get_second(); }
+
+        auto& get_second() { return sub_iterator->get_second(); }
+
+        auto get_ptr() const { return this; }
+        size_t get_hash() const { return sub_iterator->get_hash(); }
+    };
+
+    class iterator : public iterator_base<iterator, false> {
+    public:
+        using iterator_base<iterator, false>::iterator_base;
+    };
+
+    class const_iterator : public iterator_base<const_iterator, true> {
+    public:
+        using iterator_base<const_iterator, true>::iterator_base;
+    };
+
+    const_iterator begin() const {
+        const_iterator it(this, 0, _buckets[0].begin());
+        it.skip_empty_buckets();
+        return it;
+    }
+
+    const_iterator cbegin() const { return begin(); }
+
+    iterator begin() {
+        iterator it(this, 0, _buckets[0].begin());
+        it.skip_empty_buckets();
+        return it;
+    }
+
+    const_iterator end() const {
+        return const_iterator(this, _buckets.size() - 1, _buckets.back().end());
+    }
+    const_iterator cend() const { return end(); }
+    iterator end() { return iterator(this, _buckets.size() - 1, _buckets.back().end()); }
+
+    template <typename KeyHolder>
+    void ALWAYS_INLINE emplace(KeyHolder&& key_holder, LookupResult& it, bool& inserted) {
+        emplace(key_holder, it, inserted, hash(key_holder));
+    }
+
+    template <typename KeyHolder, typename Func>
+    void ALWAYS_INLINE lazy_emplace(KeyHolder&& key_holder, LookupResult& it, Func&& f) {
+        auto hash_value = hash(key_holder);
+        _try_convert_to_two_level();
+        _buckets[_bucket_of(hash_value)].lazy_emplace(key_holder, it, hash_value,
+                                                      [&](const auto& ctor, auto& key, auto&) {
+                                                          f(ctor, key);
+                                                      });
+    }
+
+    template <typename KeyHolder>
+    void ALWAYS_INLINE emplace(KeyHolder&& key, LookupResult& it, bool& inserted,
+                               size_t hash_value) {
+        _try_convert_to_two_level();
+        _buckets[_bucket_of(hash_value)].emplace(key, it, inserted, hash_value);
+    }
+
+    template <typename KeyHolder, typename Func>
+    void ALWAYS_INLINE lazy_emplace(KeyHolder&& key, LookupResult& it, size_t hash_value,
+                                    Func&& f) {
+        _try_convert_to_two_level();
+        _buckets[_bucket_of(hash_value)].lazy_emplace(key, it, hash_value, std::forward<Func>(f));
+    }
+
+    void ALWAYS_INLINE insert(const Key& key, const Mapped& value) {
+        LookupResult it;
+        lazy_emplace(key, it, hash(key), [&](const auto& ctor, auto&, auto&) { ctor(key, value); });
+    }
+
+    void insert(const iterator& other_iter) {
+        insert(other_iter->get_first(), other_iter->get_second());
+    }
+
+    template <typename KeyHolder>
+    LookupResult ALWAYS_INLINE find(KeyHolder&& key) {
+        return find(key, hash(key));
+    }
+
+    template <typename KeyHolder>
+    LookupResult ALWAYS_INLINE find(KeyHolder&& key, size_t hash_value) {
+        return _buckets[_bucket_of(hash_value)].find(key, hash_value);
+    }
+
+    size_t hash(const Key& x) const { return _buckets[0].hash(x); }
+
+    template <bool read>
+    void ALWAYS_INLINE prefetch(const Key& key, size_t hash_value) {
+        _buckets[_bucket_of(hash_value)].template prefetch<read>(key, hash_value);
+    }
+
+    /// Call func(Mapped &) for each hash map element.
+    template <typename Func>
+    void for_each_mapped(Func&& func) {
+        for (auto& bucket : _buckets) {
+            bucket.for_each_mapped(func);
+        }
+    }
+
+    size_t get_buffer_size_in_bytes() const {
+        size_t bytes = 0;
+        for (const auto& bucket : _buckets) {
+            bytes += bucket.get_buffer_size_in_bytes();
+        }
+        return bytes;
+    }
+
+    bool add_elem_size_overflow(size_t row) const {
+        if (!is_two_level()) {
+            return _buckets[0].add_elem_size_overflow(row);
+        }
+        const auto row_per_bucket = row / NUM_BUCKETS + 1;
+        for (const auto& bucket : _buckets) {
+            if (bucket.add_elem_size_overflow(row_per_bucket)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t estimate_memory(size_t num_elem) const {
+        if (!is_two_level()) {
+            if (size() + num_elem > _convert_threshold) {
+                // converting allocates all the sub maps at once
+                return get_buffer_size_in_bytes() * 2;
+            }
+            return _buckets[0].estimate_memory(num_elem);
+        }
+        size_t bytes = 0;
+        const auto row_per_bucket = num_elem / NUM_BUCKETS + 1;
+        for (const auto& bucket : _buckets) {
+            bytes += bucket.estimate_memory(row_per_bucket);
+        }
+        return bytes;
+    }
+
+    size_t size() const {
+        size_t count = 0;
+        for (const auto& bucket : _buckets) {
+            count += bucket.size();
+        }
+        return count;
+    }
+
+    template <typename MappedType>
+    char* get_null_key_data() {
+        return nullptr;
+    }
+    bool has_null_key_data() const { return false; }
+
+    bool empty() const { return size() == 0; }
+
+    void clear_and_shrink() {
+        _buckets.clear();
+        _buckets.resize(1);
+    }
+
+    void reserve(size_t num_elem) {
+        if (!is_two_level() && num_elem > _convert_threshold) {
+            _convert_to_two_level();
+        }
+        if (!is_two_level()) {
+            _buckets[0].reserve(num_elem);
+            return;
+        }
+        for (auto& bucket : _buckets) {
+            bucket.reserve(num_elem / NUM_BUCKETS + 1);
+        }
+    }
+
+    bool is_two_level() const { return _buckets.size() > 1; }
+
+private:
+    size_t ALWAYS_INLINE _bucket_of(size_t hash_value) const {
+        // Same bits as phmap's parallel hash map, they are not used by phmap to pick the slot.
+        return is_two_level() ? ((hash_value >> 8) ^ (hash_value >> 16) ^ (hash_value >> 24)) &
+                                        BUCKET_MASK
+                              : 0;
+    }
+
+    void ALWAYS_INLINE _try_convert_to_two_level() {
+        if (UNLIKELY(!is_two_level() && _buckets[0].size() >= _convert_threshold)) {
+            _convert_to_two_level();
+        }
+    }
+
+    // Move the elements of the single level map into the sub maps. Keys are only copied, for
+    // StringRef keys the data is kept in the arena of the caller.
+    void _convert_to_two_level() {
+        std::vector<SubMap> buckets(NUM_BUCKETS);
+        const auto reserve_per_bucket = _buckets[0].size() / NUM_BUCKETS * 2;
+        for (auto& bucket : buckets) {
+            bucket.reserve(reserve_per_bucket);
+        }
+        SubMap& single = _buckets[0];
+        for (auto it = single.begin(); it != single.end(); ++it) {
+            const auto& key = it->get_first();
+            const auto hash_value = single.hash(key);
+            const auto bucket =
+                    ((hash_value >> 8) ^ (hash_value >> 16) ^ (hash_value >> 24)) & BUCKET_MASK;
+            LookupResult result;
+            auto& value = it->get_second();
+            buckets[bucket].lazy_emplace(key, result, hash_value,
+                                         [&](const auto& ctor, auto&, auto&) { ctor(key, value); });
+        }
+        _buckets = std::move(buckets);
+    }
+
+    // One map when single level, `NUM_BUCKETS` maps when two level.
+    std::vector<SubMap> _buckets;
+    size_t _convert_threshold = std::numeric_limits<size_t>::max();
+};
@@ -546,6 +546,17 @@ Status encode_variant_sparse_subcolumns(ColumnVariant& column) {
 }
 
 // sort by paths in lexicographical order
+void collect_materialized_paths(const TabletSchema& schema, int32_t variant_col_unique_id,
+                                vectorized::ColumnVariant::PathSet* paths) {
+    for (const TabletColumnPtr& col : schema.columns()) {
+        if (col->has_path_info() && col->parent_unique_id() > 0 &&
+            col->parent_unique_id() == variant_col_unique_id) {
+            // path info of extracted column starts with the variant column name
+            paths->emplace(col->path_info_ptr()->copy_pop_front());
+        }
+    }
+}
+
 vectorized::ColumnVariant::Subcolumns get_sorted_subcolumns(
         const vectorized::ColumnVariant::Subcolumns& subcolumns) {
     // sort by paths in lexicographical order
@@ -113,6 +113,11 @@ void inherit_column_attributes(TabletSchemaSPtr& schema);
 void inherit_column_attributes(const TabletColumn& source, TabletColumn& target,
                                TabletSchemaSPtr& target_schema);
 
+// Collect the paths of variant column `variant_col_unique_id` that are stored as extracted
+// subcolumns in `schema`
+void collect_materialized_paths(const TabletSchema& schema, int32_t variant_col_unique_id,
+                                vectorized::ColumnVariant::PathSet* paths);
+
 // get sorted subcolumns of variant
 vectorized::ColumnVariant::Subcolumns get_sorted_subcolumns(
         const vectorized::ColumnVariant::Subcolumns& subcolumns);
@@ -20,16 +20,20 @@
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <functional>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <utility>
 
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "runtime/exec_env.h"
 #include "runtime/thread_context.h"
 #include "util/runtime_profile.h"
+#include "util/threadpool.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/core/block.h"
@@ -63,6 +67,10 @@ void MergeSorterState::reset() {
     _sorted_blocks.swap(empty_blocks);
     unsorted_block() = Block::create_unique(unsorted_block()->clone_empty());
     _in_mem_sorted_bocks_size = 0;
+    _range_cursors.clear();
+    _merge_ranges.clear();
+    _next_merge_range = 0;
+    _range_merged_blocks.clear();
 }
 
 void MergeSorterState::add_sorted_block(std::shared_ptr<Block> block) {
@@ -75,7 +83,12 @@ void MergeSorterState::add_sorted_block(std::shared_ptr<Block> block) {
     _num_rows += rows;
 }
 
-Status MergeSorterState::build_merge_tree(const SortDescription& sort_description) {
+Status MergeSorterState::build_merge_tree(const SortDescription& sort_description,
+                                          bool parallel_merge) {
+    if (parallel_merge && _build_merge_ranges(sort_description)) {
+        _sorted_blocks.clear();
+        return Status::OK();
+    }
     std::vector<MergeSortCursor> cursors;
     for (auto& block : _sorted_blocks) {
         cursors.emplace_back(
@@ -87,10 +100,201 @@ Status MergeSorterState::build_merge_tree(const SortDescription& sort_descriptio
     return Status::OK();
 }
 
+// every merge task merges a key range with at least this many rows
+static constexpr size_t MIN_ROWS_PER_MERGE_RANGE = 64 * 1024;
+// the key ranges merged at the same time are a part of all the ranges, so that the merged rows
+// waiting to be read are a part of the sorted rows
+static constexpr size_t MERGE_RANGES_PER_TASK = 8;
+// the rows sampled from every block for each key range to pick the splitters
+static constexpr size_t SAMPLES_PER_MERGE_RANGE = 4;
+
+// Splits the sorted blocks into key ranges by splitters picked from the rows sampled from the
+// blocks: the rows of every block in a range are the rows not less than the splitter before it
+// and less than the splitter after it, so the merged ranges are in order.
+bool MergeSorterState::_build_merge_ranges(const SortDescription& sort_description) {
+    if (ExecEnv::GetInstance()->sort_merge_thread_pool() == nullptr ||
+        config::sort_merge_parallelism <= 1 || _offset != 0 || _sorted_blocks.size() < 2) {
+        return false;
+    }
+    size_t num_ranges =
+            std::min(static_cast<size_t>(config::sort_merge_parallelism) * MERGE_RANGES_PER_TASK,
+                     _num_rows / MIN_ROWS_PER_MERGE_RANGE);
+    if (num_ranges < 2) {
+        return false;
+    }
+
+    std::vector<std::shared_ptr<MergeSortCursorImpl>> cursors;
+    for (auto& block : _sorted_blocks) {
+        cursors.emplace_back(MergeSortCursorImpl::create_shared(block, sort_description));
+    }
+    // the order of row lhs_row of cursor lhs and row rhs_row of cursor rhs
+    auto compare = [&](size_t lhs, size_t lhs_row, size_t rhs, size_t rhs_row) {
+        for (size_t i = 0; i < sort_description.size(); ++i) {
+            int res = sort_description[i].direction *
+                      cursors[lhs]->sort_columns[i]->compare_at(
+                              lhs_row, rhs_row, *cursors[rhs]->sort_columns[i],
+                              sort_description[i].nulls_direction);
+            if (res != 0) {
+                return res;
+            }
+        }
+        return 0;
+    };
+
+    std::vector<std::pair<size_t, size_t>> samples;
+    for (size_t i = 0; i < cursors.size(); ++i) {
+        size_t rows = cursors[i]->rows;
+        size_t num_samples = std::min(rows, num_ranges * SAMPLES_PER_MERGE_RANGE);
+        for (size_t j = 0; j < num_samples; ++j) {
+            samples.emplace_back(i, rows * j / num_samples);
+        }
+    }
+    pdqsort(samples.begin(), samples.end(), [&](const auto& lhs, const auto& rhs) {
+        return compare(lhs.first, lhs.second, rhs.first, rhs.second) < 0;
+    });
+
+    std::vector<MergeRange> ranges(num_ranges, MergeRange(cursors.size()));
+    for (size_t i = 0; i < cursors.size(); ++i) {
+        size_t start = 0;
+        for (size_t r = 0; r + 1 < num_ranges; ++r) {
+            const auto& splitter = samples[samples.size() * (r + 1) / num_ranges];
+            // the first row not less than the splitter
+            size_t low = start;
+            size_t high = cursors[i]->rows;
+            while (low < high) {
+                size_t mid = (low + high) / 2;
+                if (compare(i, mid, splitter.first, splitter.second) < 0) {
+                    low = mid + 1;
+                } else {
+                    high = mid;
+                }
+            }
+            ranges[r][i] = {start, low};
+            start = low;
+        }
+        ranges[num_ranges - 1][i] = {start, cursors[i]->rows};
+    }
+
+    _range_cursors = std::move(cursors);
+    _merge_ranges.clear();
+    for (auto& range : ranges) {
+        // equal splitters leave empty ranges
+        bool empty = std::all_of(range.begin(), range.end(),
+                                 [](const auto& rows) { return rows.first == rows.second; });
+        if (!empty) {
+            _merge_ranges.push_back(std::move(range));
+        }
+    }
+    _next_merge_range = 0;
+    return true;
+}
+
+void MergeSorterState::_merge_range(const MergeRange& range, int batch_size,
+                                    std::vector<Block>* blocks) const {
+    std::vector<MergeSortCursor> cursors;
+    for (size_t i = 0; i < range.size(); ++i) {
+        if (range[i].first == range[i].second) {
+            continue;
+        }
+        // the cursors of the ranges share the blocks, so a block is never swapped out
+        auto cursor = MergeSortCursorImpl::create_shared(*_range_cursors[i]);
+        cursor->pos = static_cast<int>(range[i].first);
+        cursor->rows = static_cast<int>(range[i].second);
+        cursors.emplace_back(std::move(cursor));
+    }
+    MergeSorterQueue queue(cursors);
+    size_t num_columns = _unsorted_block->columns();
+    while (queue.is_valid()) {
+        MutableBlock m_block(_unsorted_block->clone_empty());
+        MutableColumns& merged_columns = m_block.mutable_columns();
+        size_t merged_rows = 0;
+        while (queue.is_valid() && merged_rows < batch_size) {
+            auto [current, current_rows] = queue.current();
+            current_rows = std::min(current_rows, batch_size - merged_rows);
+            for (size_t i = 0; i < num_columns; ++i) {
+                merged_columns[i]->insert_range_from(*current->impl->columns[i],
+                                                     current->impl->pos, current_rows);
+            }
+            merged_rows += current_rows;
+            if (!current->impl->is_last(current_rows)) {
+                queue.next(current_rows);
+            } else {
+                queue.remove_top();
+            }
+        }
+        blocks->emplace_back(m_block.to_block());
+    }
+}
+
+// Merges the next key ranges, one for each merge task, the reading thread merges ranges too.
+Status MergeSorterState::_merge_next_ranges(int batch_size) {
+    size_t num_tasks = std::min(static_cast<size_t>(config::sort_merge_parallelism),
+                                _merge_ranges.size() - _next_merge_range);
+    std::vector<std::vector<Block>> merged_blocks(num_tasks);
+    std::atomic<size_t> next_task = 0;
+    std::mutex status_lock;
+    Status status;
+    auto merge_ranges = [&]() {
+        for (size_t t = next_task++; t < num_tasks; t = next_task++) {
+            Status st = [&]() -> Status {
+                RETURN_IF_CATCH_EXCEPTION(_merge_range(_merge_ranges[_next_merge_range + t],
+                                                       batch_size, &merged_blocks[t]));
+                return Status::OK();
+            }();
+            if (!st.ok()) {
+                std::lock_guard lock(status_lock);
+                if (status.ok()) {
+                    status = st;
+                }
+                next_task = num_tasks;
+            }
+        }
+    };
+    std::unique_ptr<ThreadPoolToken> token;
+    if (num_tasks > 1) {
+        token = ExecEnv::GetInstance()->sort_merge_thread_pool()->new_token(
+                ThreadPool::ExecutionMode::CONCURRENT, static_cast<int>(num_tasks - 1));
+        auto mem_tracker = thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker_sptr();
+        for (size_t t = 1; t < num_tasks; ++t) {
+            static_cast<void>(token->submit_func([&, mem_tracker]() {
+                SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(mem_tracker);
+                merge_ranges();
+            }));
+        }
+    }
+    merge_ranges();
+    if (token != nullptr) {
+        token->shutdown();
+    }
+    RETURN_IF_ERROR(status);
+
+    for (auto& blocks : merged_blocks) {
+        for (auto& block : blocks) {
+            _range_merged_blocks.emplace_back(std::move(block));
+        }
+    }
+    _next_merge_range += num_tasks;
+    if (_next_merge_range == _merge_ranges.size()) {
+        // all the rows are in the merged blocks
+        _range_cursors.clear();
+        _merge_ranges.clear();
+        _next_merge_range = 0;
+    }
+    return Status::OK();
+}
+
 Status MergeSorterState::merge_sort_read(doris::vectorized::Block* block, int batch_size,
                                          bool* eos) {
     DCHECK(_sorted_blocks.empty());
     DCHECK(unsorted_block()->empty());
+    if (!_merge_ranges.empty() && _range_merged_blocks.empty()) {
+        RETURN_IF_ERROR(_merge_next_ranges(batch_size));
+    }
+    if (!_range_merged_blocks.empty()) {
+        block->swap(_range_merged_blocks.front());
+        _range_merged_blocks.pop_front();
+        return Status::OK();
+    }
     RETURN_IF_ERROR(_merge_sort_read_impl(batch_size, block, eos));
     return Status::OK();
 }
@@ -290,7 +494,8 @@ Status FullSorter::prepare_for_read() {
     if (_state->unsorted_block()->rows() > 0) {
         RETURN_IF_ERROR(_do_sort());
     }
-    return _state->build_merge_tree(_sort_description);
+    // the key ranges are merged in full, which only pays off when all the rows are read
+    return _state->build_merge_tree(_sort_description, _limit == -1 && !_enable_spill);
 }
 
 Status FullSorter::get_next(RuntimeState* state, Block* block, bool* eos) {
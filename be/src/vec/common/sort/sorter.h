@@ -64,7 +64,9 @@ public:
 
     void add_sorted_block(std::shared_ptr<Block> block);
 
-    Status build_merge_tree(const SortDescription& sort_description);
+    // With parallel_merge, the sorted blocks are split into key ranges which are merged by
+    // several threads at the same time, if the sort merge thread pool is enabled.
+    Status build_merge_tree(const SortDescription& sort_description, bool parallel_merge = false);
 
     Status merge_sort_read(doris::vectorized::Block* block, int batch_size, bool* eos);
 
@@ -86,6 +88,13 @@ public:
 private:
     Status _merge_sort_read_impl(int batch_size, doris::vectorized::Block* block, bool* eos);
 
+    // the rows [first, second) of every sorted block in one key range
+    using MergeRange = std::vector<std::pair<size_t, size_t>>;
+
+    bool _build_merge_ranges(const SortDescription& sort_description);
+    Status _merge_next_ranges(int batch_size);
+    void _merge_range(const MergeRange& range, int batch_size, std::vector<Block>* blocks) const;
+
     std::unique_ptr<Block> _unsorted_block;
     MergeSorterQueue _queue;
     std::vector<std::shared_ptr<Block>> _sorted_blocks;
@@ -96,6 +105,12 @@ private:
 
     Block _merge_sorted_block;
     std::unique_ptr<VSortedRunMerger> _merger;
+
+    // cursors on the whole sorted blocks whose key ranges are merged in parallel
+    std::vector<std::shared_ptr<MergeSortCursorImpl>> _range_cursors;
+    std::vector<MergeRange> _merge_ranges;
+    size_t _next_merge_range = 0;
+    std::deque<Block> _range_merged_blocks;
 };
 
 class Sorter {
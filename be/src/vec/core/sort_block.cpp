@@ -20,10 +20,130 @@
 
 #include "vec/core/sort_block.h"
 
+#include <cstring>
+#include <type_traits>
+
+#include "common/config.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
 #include "vec/core/column_with_type_and_name.h"
 
 namespace doris::vectorized {
 
+namespace {
+
+// the keys of wider sort columns are not worth the memory, they are sorted column by column
+constexpr size_t MAX_NORMALIZED_KEY_SIZE = 32;
+
+// Writes the value of every row of a fixed width column to the keys, so that memcmp of two
+// keys orders the rows as compare_at of the column does. A nullable column takes one byte
+// more before the value which places the nulls first or last.
+template <typename ColumnType>
+void encode_normalized_keys(const IColumn& column, const UInt8* null_map, bool descending,
+                            bool nulls_first, uint8_t* keys, size_t key_size, size_t offset) {
+    using ValueType = typename ColumnType::value_type;
+    using UnsignedType = std::make_unsigned_t<ValueType>;
+    const auto& data = assert_cast<const ColumnType&>(column).get_data();
+    for (size_t row = 0; row < data.size(); ++row) {
+        uint8_t* pos = keys + row * key_size + offset;
+        if (null_map != nullptr) {
+            if (null_map[row]) {
+                *pos = nulls_first ? 0 : 2;
+                continue;
+            }
+            *pos++ = 1;
+        }
+        auto value = static_cast<UnsignedType>(data[row]);
+        if constexpr (std::is_signed_v<ValueType>) {
+            value ^= UnsignedType(1) << (sizeof(UnsignedType) * 8 - 1);
+        }
+        if (descending) {
+            value = ~value;
+        }
+        for (size_t i = sizeof(UnsignedType); i > 0; --i) {
+            pos[i - 1] = static_cast<uint8_t>(value);
+            value >>= 8;
+        }
+    }
+}
+
+using NormalizedKeyEncoder = void (*)(const IColumn&, const UInt8*, bool, bool, uint8_t*, size_t,
+                                      size_t);
+
+// the column types whose values compare as their integer representation
+bool get_normalized_key_encoder(const IColumn& column, NormalizedKeyEncoder* encoder,
+                                size_t* value_size) {
+    auto try_type = [&]<typename ColumnType>() {
+        if (!check_and_get_column<ColumnType>(column)) {
+            return false;
+        }
+        *encoder = &encode_normalized_keys<ColumnType>;
+        *value_size = sizeof(typename ColumnType::value_type);
+        return true;
+    };
+    return try_type.template operator()<ColumnUInt8>() ||
+           try_type.template operator()<ColumnInt8>() ||
+           try_type.template operator()<ColumnInt16>() ||
+           try_type.template operator()<ColumnInt32>() ||
+           try_type.template operator()<ColumnInt64>() ||
+           try_type.template operator()<ColumnInt128>() ||
+           try_type.template operator()<ColumnDateV2>() ||
+           try_type.template operator()<ColumnDateTimeV2>();
+}
+
+// Sorts the rows by one memcmp of their normalized keys instead of column by column, if all
+// the sort columns can be normalized. Returns false and leaves perm untouched otherwise.
+bool sort_by_normalized_keys(const ColumnsWithSortDescriptions& columns_with_sort_desc,
+                             size_t rows, UInt64 limit, IColumn::Permutation& perm) {
+    struct KeyColumn {
+        const IColumn* column;
+        const UInt8* null_map;
+        NormalizedKeyEncoder encoder;
+        size_t offset;
+    };
+    std::vector<KeyColumn> key_columns;
+    size_t key_size = 0;
+    for (const auto& [column, desc] : columns_with_sort_desc) {
+        KeyColumn key_column {column, nullptr, nullptr, key_size};
+        if (const auto* nullable = check_and_get_column<ColumnNullable>(column)) {
+            key_column.column = &nullable->get_nested_column();
+            key_column.null_map = nullable->get_null_map_data().data();
+        }
+        size_t value_size = 0;
+        if (!get_normalized_key_encoder(*key_column.column, &key_column.encoder, &value_size)) {
+            return false;
+        }
+        key_size += value_size + (key_column.null_map != nullptr ? 1 : 0);
+        if (key_size > MAX_NORMALIZED_KEY_SIZE) {
+            return false;
+        }
+        key_columns.push_back(key_column);
+    }
+
+    std::vector<uint8_t> keys(rows * key_size, 0);
+    for (size_t i = 0; i < key_columns.size(); ++i) {
+        const auto& desc = columns_with_sort_desc[i].second;
+        const auto& key_column = key_columns[i];
+        key_column.encoder(*key_column.column, key_column.null_map, desc.direction < 0,
+                           desc.nulls_direction * desc.direction < 0, keys.data(), key_size,
+                           key_column.offset);
+    }
+
+    // rows with equal keys keep their order in the block
+    auto less = [&](size_t lhs, size_t rhs) {
+        int res = memcmp(keys.data() + lhs * key_size, keys.data() + rhs * key_size, key_size);
+        return res < 0 || (res == 0 && lhs < rhs);
+    };
+    if (limit > 0) {
+        std::partial_sort(perm.begin(), perm.begin() + limit, perm.end(), less);
+    } else {
+        pdqsort(perm.begin(), perm.end(), less);
+    }
+    return true;
+}
+
+} // namespace
+
 ColumnsWithSortDescriptions get_columns_with_sort_description(const Block& block,
                                                               const SortDescription& description) {
     size_t size = description.size();
@@ -78,7 +198,9 @@ void sort_block(Block& src_block, Block& dest_block, const SortDescription& desc
 
         ColumnsWithSortDescriptions columns_with_sort_desc =
                 get_columns_with_sort_description(src_block, description);
-        {
+        bool sorted = config::enable_normalized_key_sort_block &&
+                      sort_by_normalized_keys(columns_with_sort_desc, size, limit, perm);
+        if (!sorted) {
             EqualFlags flags(size, 1);
             EqualRange range {0, size};
 
@@ -23,14 +23,18 @@
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <utility>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "common/consts.h"
+#include "common/exception.h"
 #include "common/status.h"
 #include "exec/decompressor.h"
 #include "exec/line_reader.h"
@@ -40,9 +44,13 @@
 #include "io/fs/file_reader.h"
 #include "io/fs/s3_file_reader.h"
 #include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
+#include "runtime/thread_context.h"
 #include "util/string_util.h"
+#include "util/threadpool.h"
 #include "util/utf8_check.h"
+#include "vec/columns/column_nullable.h"
 #include "vec/core/block.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/data_types/data_type_factory.hpp"
@@ -64,6 +72,9 @@ enum class FileCachePolicy : uint8_t;
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
 
+// the fewest lines a thread parses, more threads do not pay off for a small batch
+static constexpr size_t MIN_LINES_PER_PARSE_TASK = 256;
+
 void EncloseCsvTextFieldSplitter::do_split(const Slice& line, std::vector<Slice>* splitted_values) {
     const char* data = line.data;
     const auto& column_sep_positions = _text_line_reader_ctx->column_sep_positions();
@@ -341,6 +352,10 @@ Status CsvReader::get_next_block(Block* block, size_t* read_rows, bool* eof) {
             col->resize(rows);
         }
         block->set_columns(std::move(mutate_columns));
+    } else if (_can_parse_in_parallel()) {
+        auto columns = block->mutate_columns();
+        RETURN_IF_ERROR(_read_lines_in_parallel(block, columns, batch_size, &rows));
+        block->set_columns(std::move(columns));
     } else {
         auto columns = block->mutate_columns();
         while (rows < batch_size && !_line_reader_eof) {
@@ -616,33 +631,38 @@ Status CsvReader::_fill_dest_columns(const Slice& line, Block* block,
         return Status::OK();
     }
 
-    for (int i = 0; i < _file_slot_descs.size(); ++i) {
-        int col_idx = _col_idxs[i];
-        // col idx is out of range, fill with null format
-        auto value = col_idx < _split_values.size()
-                             ? _split_values[col_idx]
-                             : Slice(_options.null_format, _options.null_len);
-
-        IColumn* col_ptr = columns[i].get();
-        if (!_is_load) {
-            col_ptr = const_cast<IColumn*>(
-                    block->get_by_position(_file_slot_idx_map[i]).column.get());
-        }
-
-        if (_use_nullable_string_opt[i]) {
-            // For load task, we always read "string" from file.
-            // So serdes[i] here must be DataTypeNullableSerDe, and DataTypeNullableSerDe -> nested_serde must be DataTypeStringSerDe.
-            // So we use deserialize_nullable_string and stringSerDe to reduce virtual function calls.
-            RETURN_IF_ERROR(_deserialize_nullable_string(*col_ptr, value));
-        } else {
-            RETURN_IF_ERROR(_deserialize_one_cell(_serdes[i], *col_ptr, value));
-        }
+    for (size_t i = 0; i < _file_slot_descs.size(); ++i) {
+        RETURN_IF_ERROR(_deserialize_value(i, _split_values, *_dest_column(block, columns, i)));
     }
     ++(*rows);
 
     return Status::OK();
 }
 
+IColumn* CsvReader::_dest_column(Block* block, std::vector<MutableColumnPtr>& columns,
+                                 size_t slot_idx) {
+    if (!_is_load) {
+        return const_cast<IColumn*>(
+                block->get_by_position(_file_slot_idx_map[slot_idx]).column.get());
+    }
+    return columns[slot_idx].get();
+}
+
+Status CsvReader::_deserialize_value(size_t slot_idx, const std::vector<Slice>& values,
+                                     IColumn& column) {
+    int col_idx = _col_idxs[slot_idx];
+    // col idx is out of range, fill with null format
+    auto value = col_idx < values.size() ? values[col_idx]
+                                         : Slice(_options.null_format, _options.null_len);
+    if (_use_nullable_string_opt[slot_idx]) {
+        // For load task, we always read "string" from file.
+        // So serdes[i] here must be DataTypeNullableSerDe, and DataTypeNullableSerDe -> nested_serde must be DataTypeStringSerDe.
+        // So we use deserialize_nullable_string and stringSerDe to reduce virtual function calls.
+        return _deserialize_nullable_string(column, value);
+    }
+    return _deserialize_one_cell(_serdes[slot_idx], column, value);
+}
+
 Status CsvReader::_fill_empty_line(Block* block, std::vector<MutableColumnPtr>& columns,
                                    size_t* rows) {
     for (int i = 0; i < _file_slot_descs.size(); ++i) {
@@ -658,8 +678,156 @@ Status CsvReader::_fill_empty_line(Block* block, std::vector<MutableColumnPtr>&
     return Status::OK();
 }
 
+bool CsvReader::_check_line(const Slice& line) {
+    return _is_proto_format || validate_utf8(_params, line.data, line.size);
+}
+
+bool CsvReader::_can_parse_in_parallel() const {
+    // the splitter of enclosed lines takes the separators found by the line reader,
+    // and a line of proto format refers to a row held by the reader
+    return config::csv_parse_parallelism > 1 && _enclose == 0 && !_is_proto_format &&
+           ExecEnv::GetInstance()->csv_parse_thread_pool() != nullptr;
+}
+
+// The scanner thread reads the lines of a batch and copies them out of the line reader, then the
+// lines are split and deserialized by several threads, every one into columns of its own, which
+// are appended to the block in the order of the lines. The scanner thread parses lines too, so
+// the read goes on even if the pool is busy with other readers.
+Status CsvReader::_read_lines_in_parallel(Block* block, std::vector<MutableColumnPtr>& columns,
+                                          size_t batch_size, size_t* rows) {
+    _line_buf.clear();
+    _line_positions.clear();
+    bool is_remove_bom = false;
+    while (_line_positions.size() < batch_size && !_line_reader_eof) {
+        const uint8_t* ptr = nullptr;
+        size_t size = 0;
+        RETURN_IF_ERROR(_line_reader->read_line(&ptr, &size, &_line_reader_eof, _io_ctx));
+        if (!is_remove_bom && _skip_lines == 0) {
+            ptr = _remove_bom(ptr, size);
+            is_remove_bom = true;
+        }
+        if (_skip_lines > 0) {
+            _skip_lines--;
+            is_remove_bom = true;
+            continue;
+        }
+        if (size == 0) {
+            if (!_line_reader_eof && _state->is_read_csv_empty_line_as_null()) {
+                _line_positions.emplace_back(_line_buf.size(), 0);
+            }
+            continue;
+        }
+        _line_positions.emplace_back(_line_buf.size(), size);
+        _line_buf.append(reinterpret_cast<const char*>(ptr), size);
+    }
+    if (_line_positions.empty()) {
+        return Status::OK();
+    }
+
+    size_t num_lines = _line_positions.size();
+    size_t num_tasks =
+            std::min(static_cast<size_t>(config::csv_parse_parallelism),
+                     (num_lines + MIN_LINES_PER_PARSE_TASK - 1) / MIN_LINES_PER_PARSE_TASK);
+    std::vector<ParseTask> tasks(num_tasks);
+    for (size_t t = 0; t < num_tasks; ++t) {
+        tasks[t].begin = num_lines * t / num_tasks;
+        tasks[t].end = num_lines * (t + 1) / num_tasks;
+        for (size_t i = 0; i < _file_slot_descs.size(); ++i) {
+            tasks[t].columns.push_back(_dest_column(block, columns, i)->clone_empty());
+        }
+    }
+
+    std::atomic<size_t> next_task = 0;
+    std::mutex status_lock;
+    Status status;
+    auto parse_lines = [&]() {
+        for (size_t t = next_task++; t < num_tasks; t = next_task++) {
+            Status st = [&]() -> Status {
+                RETURN_IF_ERROR_OR_CATCH_EXCEPTION(_parse_lines(&tasks[t]));
+                return Status::OK();
+            }();
+            if (!st.ok()) {
+                std::lock_guard lock(status_lock);
+                if (status.ok()) {
+                    status = st;
+                }
+                // the lines left are not needed
+                next_task = num_tasks;
+            }
+        }
+    };
+    std::unique_ptr<ThreadPoolToken> token;
+    if (num_tasks > 1) {
+        token = ExecEnv::GetInstance()->csv_parse_thread_pool()->new_token(
+                ThreadPool::ExecutionMode::CONCURRENT, static_cast<int>(num_tasks - 1));
+        auto mem_tracker = thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker_sptr();
+        for (size_t t = 1; t < num_tasks; ++t) {
+            static_cast<void>(token->submit_func([&, mem_tracker]() {
+                SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(mem_tracker);
+                parse_lines();
+            }));
+        }
+    }
+    parse_lines();
+    if (token != nullptr) {
+        // the tasks not started have no lines left to parse, drop them and wait for the others
+        token->shutdown();
+    }
+    RETURN_IF_ERROR(status);
+
+    for (auto& task : tasks) {
+        for (size_t line_idx : task.invalid_lines) {
+            const auto& [offset, size] = _line_positions[line_idx];
+            Slice line(_line_buf.data() + offset, size);
+            bool success = false;
+            RETURN_IF_ERROR(_validate_line(line, &success));
+            if (success) {
+                RETURN_IF_ERROR(_line_split_to_values(line, &success));
+            }
+            DCHECK(!success);
+        }
+        for (size_t i = 0; i < task.columns.size(); ++i) {
+            _dest_column(block, columns, i)->insert_range_from(*task.columns[i], 0, task.rows);
+        }
+        *rows += task.rows;
+    }
+    return Status::OK();
+}
+
+Status CsvReader::_parse_lines(ParseTask* task) {
+    std::vector<Slice> values;
+    values.reserve(_file_slot_descs.size());
+    for (size_t line_idx = task->begin; line_idx < task->end; ++line_idx) {
+        const auto& [offset, size] = _line_positions[line_idx];
+        if (size == 0) {
+            for (auto& column : task->columns) {
+                assert_cast<ColumnNullable&>(*column).insert_data(nullptr, 0);
+            }
+            ++task->rows;
+            continue;
+        }
+        Slice line(_line_buf.data() + offset, size);
+        // the errors of the invalid lines are reported by the scanner thread
+        if (!_check_line(line)) {
+            task->invalid_lines.push_back(line_idx);
+            continue;
+        }
+        values.clear();
+        _fields_splitter->split_line(line, &values);
+        if (_is_load && !_is_column_count_valid(values.size())) {
+            task->invalid_lines.push_back(line_idx);
+            continue;
+        }
+        for (size_t i = 0; i < task->columns.size(); ++i) {
+            RETURN_IF_ERROR(_deserialize_value(i, values, *task->columns[i]));
+        }
+        ++task->rows;
+    }
+    return Status::OK();
+}
+
 Status CsvReader::_validate_line(const Slice& line, bool* success) {
-    if (!_is_proto_format && !validate_utf8(_params, line.data, line.size)) {
+    if (!_check_line(line)) {
         if (!_is_load) {
             return Status::InternalError<false>("Only support csv data in utf8 codec");
         } else {
@@ -688,13 +856,7 @@ Status CsvReader::_line_split_to_values(const Slice& line, bool* success) {
         // Only check for load task. For query task, the non exist column will be filled "null".
         // if actual column number in csv file is not equal to _file_slot_descs.size()
         // then filter this line.
-        bool ignore_col = false;
-        ignore_col = _params.__isset.file_attributes &&
-                     _params.file_attributes.__isset.ignore_csv_redundant_col &&
-                     _params.file_attributes.ignore_csv_redundant_col;
-
-        if ((!ignore_col && _split_values.size() != _file_slot_descs.size()) ||
-            (ignore_col && _split_values.size() < _file_slot_descs.size())) {
+        if (!_is_column_count_valid(_split_values.size())) {
             std::string cmp_str =
                     _split_values.size() > _file_slot_descs.size() ? "more than" : "less than";
             _counter->num_rows_filtered++;
@@ -731,6 +893,14 @@ Status CsvReader::_line_split_to_values(const Slice& line, bool* success) {
     return Status::OK();
 }
 
+bool CsvReader::_is_column_count_valid(size_t num_values) const {
+    bool ignore_col = _params.__isset.file_attributes &&
+                      _params.file_attributes.__isset.ignore_csv_redundant_col &&
+                      _params.file_attributes.ignore_csv_redundant_col;
+    return ignore_col ? num_values >= _file_slot_descs.size()
+                      : num_values == _file_slot_descs.size();
+}
+
 void CsvReader::_split_line(const Slice& line) {
     _split_values.clear();
     _fields_splitter->split_line(line, &_split_values);
@@ -203,6 +203,8 @@ protected:
     // If return Status::OK but "success" is false, which means this is load request
     // and the line is skipped as unqualified row, and the process should continue.
     virtual Status _validate_line(const Slice& line, bool* success);
+    // check the encoding of a line without reporting, could be called by the parse threads
+    virtual bool _check_line(const Slice& line);
 
     RuntimeProfile* _profile = nullptr;
     const TFileScanRangeParams& _params;
@@ -226,6 +228,23 @@ private:
     Status _fill_dest_columns(const Slice& line, Block* block,
                               std::vector<MutableColumnPtr>& columns, size_t* rows);
     Status _fill_empty_line(Block* block, std::vector<MutableColumnPtr>& columns, size_t* rows);
+    Status _deserialize_value(size_t slot_idx, const std::vector<Slice>& values, IColumn& column);
+    bool _is_column_count_valid(size_t num_values) const;
+    IColumn* _dest_column(Block* block, std::vector<MutableColumnPtr>& columns, size_t slot_idx);
+
+    // The lines of a batch parsed by one thread into columns of its own.
+    struct ParseTask {
+        size_t begin = 0;
+        size_t end = 0;
+        MutableColumns columns;
+        size_t rows = 0;
+        // the invalid lines, whose errors are reported by the scanner thread
+        std::vector<size_t> invalid_lines;
+    };
+    bool _can_parse_in_parallel() const;
+    Status _read_lines_in_parallel(Block* block, std::vector<MutableColumnPtr>& columns,
+                                   size_t batch_size, size_t* rows);
+    Status _parse_lines(ParseTask* task);
     Status _line_split_to_values(const Slice& line, bool* success);
     void _split_line(const Slice& line);
     void _init_system_properties();
@@ -282,6 +301,11 @@ private:
     // save source text which have been splitted.
     std::vector<Slice> _split_values;
     std::vector<int> _use_nullable_string_opt;
+
+    // The lines of a batch copied out of the line reader to be parsed in parallel,
+    // and their positions in the buffer. An empty line is read as a row of nulls.
+    std::string _line_buf;
+    std::vector<std::pair<size_t, size_t>> _line_positions;
 };
 } // namespace vectorized
 #include "common/compile_check_end.h"
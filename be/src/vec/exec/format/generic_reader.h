@@ -73,6 +73,11 @@ public:
         return Status::OK();
     }
 
+    /// Called when the value ranges passed to the reader at init are narrowed by the runtime
+    /// filters arrived later. The reader may skip the unread data whose statistics can not
+    /// match the narrowed ranges.
+    virtual Status filter_by_value_ranges() { return Status::OK(); }
+
     virtual Status close() { return Status::OK(); }
 
     Status set_read_lines_mode(const std::list<int64_t>& read_lines) {
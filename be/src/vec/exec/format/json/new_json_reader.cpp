@@ -2095,6 +2095,12 @@ Status NewJsonReader::_get_json_value(size_t* size, bool* eof, simdjson::error_c
 Status NewJsonReader::_simdjson_write_columns_by_jsonpath(
         simdjson::ondemand::object* value, const std::vector<SlotDescriptor*>& slot_descs,
         Block& block, bool* valid) {
+    if (!_jsonpath_trie_inited) {
+        _init_jsonpath_trie(slot_descs);
+    }
+    if (_use_jsonpath_trie) {
+        return _simdjson_write_columns_by_jsonpath_trie(value, slot_descs, block, valid);
+    }
     // write by jsonpath
     bool has_valid_value = false;
     for (size_t i = 0; i < slot_descs.size(); i++) {
@@ -2163,6 +2169,143 @@ Status NewJsonReader::_simdjson_write_columns_by_jsonpath(
     return Status::OK();
 }
 
+void NewJsonReader::_init_jsonpath_trie(const std::vector<SlotDescriptor*>& slot_descs) {
+    _jsonpath_trie_inited = true;
+    _use_jsonpath_trie = false;
+    _jsonpath_trie.clear();
+    _jsonpath_trie.emplace_back();
+    for (size_t i = 0; i < slot_descs.size() && i < _parsed_jsonpaths.size(); ++i) {
+        if (!slot_descs[i]->is_materialized()) {
+            continue;
+        }
+        const auto& jsonpath = _parsed_jsonpaths[i];
+        if (jsonpath.size() <= 1 || !jsonpath[0].is_valid ||
+            JsonFunctions::is_root_path(jsonpath)) {
+            return;
+        }
+        size_t node_index = 0;
+        for (size_t j = 1; j < jsonpath.size(); ++j) {
+            // an array index or a jsonpath which is the prefix of another one
+            if (!jsonpath[j].is_valid || jsonpath[j].idx != -1 ||
+                _jsonpath_trie[node_index].slot_index >= 0) {
+                return;
+            }
+            ++_jsonpath_trie[node_index].num_paths;
+            StringRef key(jsonpath[j].key);
+            auto it = _jsonpath_trie[node_index].children.find(key);
+            if (it != _jsonpath_trie[node_index].children.end()) {
+                node_index = it->second;
+                continue;
+            }
+            size_t child_index = _jsonpath_trie.size();
+            _jsonpath_trie[node_index].children.emplace(key, child_index);
+            _jsonpath_trie.emplace_back();
+            node_index = child_index;
+        }
+        // a jsonpath of several slots, only one of them could read the value
+        if (_jsonpath_trie[node_index].slot_index >= 0 ||
+            !_jsonpath_trie[node_index].children.empty()) {
+            return;
+        }
+        _jsonpath_trie[node_index].slot_index = static_cast<int64_t>(i);
+        _jsonpath_trie[node_index].num_paths = 1;
+    }
+    _use_jsonpath_trie = true;
+}
+
+Status NewJsonReader::_simdjson_write_columns_by_jsonpath_trie(
+        simdjson::ondemand::object* value, const std::vector<SlotDescriptor*>& slot_descs,
+        Block& block, bool* valid) {
+    size_t cur_row_count = block.rows();
+    _seen_columns.assign(block.columns(), false);
+    *valid = true;
+    size_t num_matched = 0;
+    RETURN_IF_ERROR(
+            _simdjson_match_jsonpath_trie(*value, 0, slot_descs, block, &num_matched, valid));
+    for (size_t i = 0; *valid && i < slot_descs.size(); ++i) {
+        if (_seen_columns[i] || !slot_descs[i]->is_materialized()) {
+            continue;
+        }
+        auto* column_ptr = block.get_by_position(i).column->assume_mutable().get();
+        RETURN_IF_ERROR(_fill_missing_column(slot_descs[i], _serdes[i], column_ptr, valid));
+    }
+    if (!(*valid)) {
+        // the columns are written in the order of the fields, remove the part of the row written
+        for (size_t i = 0; i < block.columns(); ++i) {
+            auto column = block.get_by_position(i).column->assume_mutable();
+            if (column->size() > cur_row_count) {
+                column->pop_back(1);
+            }
+        }
+        return Status::OK();
+    }
+    if (num_matched == 0) {
+        std::string col_names;
+        for (size_t i = 0; i < block.columns(); ++i) {
+            auto column = block.get_by_position(i).column->assume_mutable();
+            column->pop_back(1);
+        }
+        for (auto* slot_desc : slot_descs) {
+            col_names.append(slot_desc->col_name() + ", ");
+        }
+        RETURN_IF_ERROR(_append_error_msg(value,
+                                          "There is no column matching jsonpaths in the json file, "
+                                          "columns:[{}], please check columns "
+                                          "and jsonpaths:" +
+                                                  _jsonpaths,
+                                          col_names, valid));
+    }
+    return Status::OK();
+}
+
+Status NewJsonReader::_simdjson_match_jsonpath_trie(simdjson::ondemand::object& object,
+                                                    size_t node_index,
+                                                    const std::vector<SlotDescriptor*>& slot_descs,
+                                                    Block& block, size_t* num_matched,
+                                                    bool* valid) {
+    const auto& node = _jsonpath_trie[node_index];
+    size_t node_matched = 0;
+    for (auto field : object) {
+        // matched as the raw key, the same as find_field_unordered in extract_from_object
+        std::string_view key = field.escaped_key();
+        auto it = node.children.find(StringRef(key.data(), key.size()));
+        if (it == node.children.end()) {
+            continue;
+        }
+        const auto& child = _jsonpath_trie[it->second];
+        simdjson::ondemand::value val = field.value();
+        if (child.slot_index >= 0) {
+            auto i = static_cast<size_t>(child.slot_index);
+            // the first one of the duplicate keys
+            if (_seen_columns[i]) {
+                continue;
+            }
+            auto* column_ptr = block.get_by_position(i).column->assume_mutable().get();
+            RETURN_IF_ERROR(_simdjson_write_data_to_column(val, slot_descs[i]->type(), column_ptr,
+                                                           slot_descs[i]->col_name(), _serdes[i],
+                                                           valid));
+            if (!(*valid)) {
+                return Status::OK();
+            }
+            _seen_columns[i] = true;
+            ++node_matched;
+        } else if (val.type() == simdjson::ondemand::json_type::object) {
+            simdjson::ondemand::object child_object = val.get_object();
+            RETURN_IF_ERROR(_simdjson_match_jsonpath_trie(child_object, it->second, slot_descs,
+                                                          block, &node_matched, valid));
+            if (!(*valid)) {
+                return Status::OK();
+            }
+        }
+        // the rest of the object is skipped by simdjson
+        if (node_matched == node.num_paths) {
+            break;
+        }
+    }
+    *num_matched += node_matched;
+    return Status::OK();
+}
+
 Status NewJsonReader::_get_column_default_value(
         const std::vector<SlotDescriptor*>& slot_descs,
         const std::unordered_map<std::string, VExprContextSPtr>& col_default_value_ctx) {
@@ -183,6 +183,16 @@ private:
     Status _simdjson_write_columns_by_jsonpath(simdjson::ondemand::object* value,
                                                const std::vector<SlotDescriptor*>& slot_descs,
                                                Block& block, bool* valid);
+
+    void _init_jsonpath_trie(const std::vector<SlotDescriptor*>& slot_descs);
+    Status _simdjson_write_columns_by_jsonpath_trie(simdjson::ondemand::object* value,
+                                                    const std::vector<SlotDescriptor*>& slot_descs,
+                                                    Block& block, bool* valid);
+    // Write the fields of `object` matching the children of `node_index` in the trie,
+    // `num_matched` is added the number of the slots written.
+    Status _simdjson_match_jsonpath_trie(simdjson::ondemand::object& object, size_t node_index,
+                                         const std::vector<SlotDescriptor*>& slot_descs,
+                                         Block& block, size_t* num_matched, bool* valid);
     Status _append_error_msg(simdjson::ondemand::object* obj, std::string error_msg,
                              std::string col_name, bool* valid);
 
@@ -272,6 +282,20 @@ private:
     std::vector<NameMap::iterator> _prev_positions;
     /// Set of columns which already met in row. Exception is thrown if there are more than one column with the same name.
     std::vector<UInt8> _seen_columns;
+    /// The jsonpaths compiled into a trie of keys, so the fields of an object are matched to the
+    /// slots in one pass over it, instead of looking up every jsonpath in the object.
+    struct JsonPathTrieNode {
+        /// the slot whose jsonpath ends at the node, -1 if none
+        int64_t slot_index = -1;
+        /// the number of the jsonpaths ending under the node
+        size_t num_paths = 0;
+        /// key -> the index of the child in _jsonpath_trie, keys refer to _parsed_jsonpaths
+        NameMap children;
+    };
+    std::vector<JsonPathTrieNode> _jsonpath_trie;
+    bool _jsonpath_trie_inited = false;
+    /// false if some jsonpath can not be matched by the trie, e.g. `$.a[0]` or `$.`
+    bool _use_jsonpath_trie = false;
     // simdjson
     std::unique_ptr<uint8_t[]> _json_str_ptr;
     const uint8_t* _json_str = nullptr;
@@ -67,8 +67,10 @@
 #include "vec/columns/column_const.h"
 #include "vec/columns/column_map.h"
 #include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
 #include "vec/columns/column_struct.h"
 #include "vec/common/string_ref.h"
+#include "vec/common/typeid_cast.h"
 #include "vec/core/block.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/core/types.h"
@@ -1425,12 +1427,61 @@ Status OrcReader::_decode_string_column(const std::string& col_name,
     }
 }
 
+// The directly encoded values of a string batch are placed back to back in the blob of orc, so
+// they can be appended to the string column with one copy and the offsets derived from the
+// lengths, rather than collecting a StringRef of each row first. Returns false without touching
+// the column if the values are not contiguous, e.g. the batch is converted by schema evolution.
+static bool append_contiguous_strings(ColumnString& column, const orc::StringVectorBatch* cvb,
+                                      size_t num_values) {
+    const char* const* values = cvb->data.data();
+    const int64_t* lengths = cvb->length.data();
+    const char* not_null = cvb->hasNulls ? cvb->notNull.data() : nullptr;
+    const char* start = nullptr;
+    size_t total_length = 0;
+    for (size_t i = 0; i < num_values; ++i) {
+        if ((not_null == nullptr || not_null[i]) && lengths[i] > 0) {
+            if (start == nullptr) {
+                start = values[i];
+            } else if (values[i] != start + total_length) {
+                return false;
+            }
+            total_length += static_cast<size_t>(lengths[i]);
+        }
+    }
+
+    auto& chars = column.get_chars();
+    auto& offsets = column.get_offsets();
+    const size_t origin_length = chars.size();
+    ColumnString::check_chars_length(origin_length + total_length, offsets.size() + num_values);
+    const size_t origin_rows = offsets.size();
+    offsets.resize(origin_rows + num_values);
+    size_t offset = origin_length;
+    for (size_t i = 0; i < num_values; ++i) {
+        if (not_null == nullptr || not_null[i]) {
+            offset += static_cast<size_t>(lengths[i]);
+        }
+        offsets[origin_rows + i] = static_cast<uint32_t>(offset);
+    }
+    chars.resize(origin_length + total_length);
+    if (total_length > 0) {
+        memcpy(chars.data() + origin_length, start, total_length);
+    }
+    return true;
+}
+
 template <bool is_filter>
 Status OrcReader::_decode_string_non_dict_encoded_column(const std::string& col_name,
                                                          const MutableColumnPtr& data_column,
                                                          const orc::TypeKind& type_kind,
                                                          const orc::EncodedStringVectorBatch* cvb,
                                                          size_t num_values) {
+    if (type_kind != orc::TypeKind::CHAR) {
+        auto* string_column = typeid_cast<ColumnString*>(data_column.get());
+        if (string_column != nullptr &&
+            append_contiguous_strings(*string_column, cvb, num_values)) {
+            return Status::OK();
+        }
+    }
     const static std::string empty_string;
     std::vector<StringRef> string_values;
     string_values.reserve(num_values);
@@ -25,6 +25,7 @@
 #include <memory>
 #include <orc/OrcFile.hh>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -190,7 +191,7 @@ public:
     Status get_parsed_schema(std::vector<std::string>* col_names,
                              std::vector<DataTypePtr>* col_types) override;
 
-    void set_position_delete_rowids(std::vector<int64_t>* delete_rows) {
+    void set_position_delete_rowids(const std::vector<int64_t>* delete_rows) {
         _position_delete_ordered_rowids = delete_rows;
     }
     void _execute_filter_position_delete_rowids(IColumn::Filter& filter);
@@ -360,9 +361,15 @@ private:
         auto& column_data = static_cast<ColumnVector<PType>&>(*data_column).get_data();
         auto origin_size = column_data.size();
         column_data.resize(origin_size + num_values);
-        for (int i = 0; i < num_values; ++i) {
-            column_data[origin_size + i] =
-                    (typename PrimitiveTypeTraits<PType>::CppType)cvb_data[i];
+        using CppType = typename PrimitiveTypeTraits<PType>::CppType;
+        using OrcCppType = std::remove_cv_t<std::remove_pointer_t<decltype(cvb_data)>>;
+        if constexpr (std::is_same_v<CppType, OrcCppType>) {
+            // the same layout as orc batch, e.g. bigint and double
+            memcpy(column_data.data() + origin_size, cvb_data, num_values * sizeof(CppType));
+        } else {
+            for (int i = 0; i < num_values; ++i) {
+                column_data[origin_size + i] = (CppType)cvb_data[i];
+            }
         }
         return Status::OK();
     }
@@ -696,7 +703,7 @@ private:
     std::unordered_map<std::string, std::unique_ptr<converter::ColumnTypeConverter>> _converters;
 
     //support iceberg position delete .
-    std::vector<int64_t>* _position_delete_ordered_rowids = nullptr;
+    const std::vector<int64_t>* _position_delete_ordered_rowids = nullptr;
     std::unordered_map<const VSlotRef*, orc::PredicateDataType>
             _vslot_ref_to_orc_predicate_data_type;
     std::unordered_map<const VLiteral*, orc::Literal> _vliteral_to_orc_literal;
@@ -42,6 +42,10 @@
 
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
+
+// the shortest run of values filtered by the lazy read which is skipped, instead of decoded
+static constexpr size_t MIN_FILTERED_RUN_TO_SKIP = 32;
+
 static void fill_struct_null_map(FieldSchema* field, NullMap& null_map,
                                  const std::vector<level_t>& rep_levels,
                                  const std::vector<level_t>& def_levels) {
@@ -237,6 +241,71 @@ Status ScalarColumnReader::_skip_values(size_t num_values) {
     return Status::OK();
 }
 
+Status ScalarColumnReader::_load_page_data() {
+    if (_chunk_reader->page_data_loaded()) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_chunk_reader->load_page_data());
+    size_t pending_skip_values = _pending_skip_values;
+    _pending_skip_values = 0;
+    return _skip_values(pending_skip_values);
+}
+
+Status ScalarColumnReader::_skip_page() {
+    _pending_skip_values = 0;
+    return _chunk_reader->skip_page();
+}
+
+Status ScalarColumnReader::_skip_values_lazily(size_t num_values) {
+    if (_chunk_reader->page_data_loaded()) {
+        return _skip_values(num_values);
+    }
+    DCHECK_LE(num_values, _remaining_num_values());
+    _pending_skip_values += num_values;
+    return Status::OK();
+}
+
+Status ScalarColumnReader::_read_filtered_values(size_t num_values, ColumnPtr& doris_column,
+                                                 DataTypePtr& type, FilterMap& filter_map,
+                                                 bool is_dict_filter) {
+    if (!filter_map.has_filter() || filter_map.filter_all() ||
+        _filter_map_index + num_values > filter_map.filter_map_size()) {
+        RETURN_IF_ERROR(_load_page_data());
+        return _read_values(num_values, doris_column, type, filter_map, is_dict_filter);
+    }
+    // the values filtered are not decoded, but a short run is not worth another decode call
+    const uint8_t* filter_data = filter_map.filter_map_data() + _filter_map_index;
+    size_t read_start = 0;
+    size_t i = 0;
+    while (i < num_values) {
+        if (filter_data[i] != 0) {
+            ++i;
+            continue;
+        }
+        size_t run_end = i;
+        while (run_end < num_values && filter_data[run_end] == 0) {
+            ++run_end;
+        }
+        if (run_end - i >= MIN_FILTERED_RUN_TO_SKIP || (i == 0 && run_end == num_values)) {
+            if (i > read_start) {
+                RETURN_IF_ERROR(_load_page_data());
+                RETURN_IF_ERROR(_read_values(i - read_start, doris_column, type, filter_map,
+                                             is_dict_filter));
+            }
+            _filter_map_index += run_end - i;
+            RETURN_IF_ERROR(_skip_values_lazily(run_end - i));
+            read_start = run_end;
+        }
+        i = run_end;
+    }
+    if (num_values > read_start) {
+        RETURN_IF_ERROR(_load_page_data());
+        RETURN_IF_ERROR(_read_values(num_values - read_start, doris_column, type, filter_map,
+                                     is_dict_filter));
+    }
+    return Status::OK();
+}
+
 Status ScalarColumnReader::_read_values(size_t num_values, ColumnPtr& doris_column,
                                         DataTypePtr& type, FilterMap& filter_map,
                                         bool is_dict_filter) {
@@ -595,7 +664,11 @@ Status ScalarColumnReader::read_column_data(
     DataTypePtr& resolved_type = _converter->get_physical_type();
 
     do {
-        if (_chunk_reader->remaining_num_values() == 0) {
+        if (_remaining_num_values() == 0) {
+            if (_pending_skip_values > 0) {
+                // no value of the page is read, skip it without loading
+                RETURN_IF_ERROR(_skip_page());
+            }
             if (!_chunk_reader->has_next_page()) {
                 *eof = true;
                 *read_rows = 0;
@@ -612,13 +685,12 @@ Status ScalarColumnReader::read_column_data(
 
         // generate the row ranges that should be read
         std::list<RowRange> read_ranges;
-        _generate_read_ranges(_current_row_index,
-                              _current_row_index + _chunk_reader->remaining_num_values(),
+        _generate_read_ranges(_current_row_index, _current_row_index + _remaining_num_values(),
                               read_ranges);
         if (read_ranges.size() == 0) {
             // skip the whole page
-            _current_row_index += _chunk_reader->remaining_num_values();
-            RETURN_IF_ERROR(_chunk_reader->skip_page());
+            _current_row_index += _remaining_num_values();
+            RETURN_IF_ERROR(_skip_page());
             *read_rows = 0;
         } else {
             bool skip_whole_batch = false;
@@ -634,8 +706,8 @@ Status ScalarColumnReader::read_column_data(
                     filter_map.can_filter_all(remaining_num_values, _filter_map_index)) {
                     // We can skip the whole page if the remaining values is filtered by predicate columns
                     _filter_map_index += remaining_num_values;
-                    _current_row_index += _chunk_reader->remaining_num_values();
-                    RETURN_IF_ERROR(_chunk_reader->skip_page());
+                    _current_row_index += _remaining_num_values();
+                    RETURN_IF_ERROR(_skip_page());
                     *read_rows = remaining_num_values;
                     if (!_chunk_reader->has_next_page()) {
                         *eof = true;
@@ -648,22 +720,22 @@ Status ScalarColumnReader::read_column_data(
                     _filter_map_index += batch_size;
                 }
             }
-            // load page data to decode or skip values
-            RETURN_IF_ERROR(_chunk_reader->load_page_data_idempotent());
+            // the page data is loaded once there are values to decode
             size_t has_read = 0;
             for (auto& range : read_ranges) {
                 // generate the skipped values
                 size_t skip_values = range.first_row - _current_row_index;
-                RETURN_IF_ERROR(_skip_values(skip_values));
+                RETURN_IF_ERROR(_skip_values_lazily(skip_values));
                 _current_row_index += skip_values;
                 // generate the read values
                 size_t read_values =
                         std::min((size_t)(range.last_row - range.first_row), batch_size - has_read);
                 if (skip_whole_batch) {
-                    RETURN_IF_ERROR(_skip_values(read_values));
+                    RETURN_IF_ERROR(_skip_values_lazily(read_values));
                 } else {
-                    RETURN_IF_ERROR(_read_values(read_values, resolved_column, resolved_type,
-                                                 filter_map, is_dict_filter));
+                    RETURN_IF_ERROR(_read_filtered_values(read_values, resolved_column,
+                                                          resolved_type, filter_map,
+                                                          is_dict_filter));
                 }
                 has_read += read_values;
                 _current_row_index += read_values;
@@ -674,7 +746,7 @@ Status ScalarColumnReader::read_column_data(
             *read_rows = has_read;
         }
 
-        if (_chunk_reader->remaining_num_values() == 0 && !_chunk_reader->has_next_page()) {
+        if (_remaining_num_values() == 0 && !_chunk_reader->has_next_page()) {
             *eof = true;
         }
     } while (false);
@@ -205,7 +205,21 @@ private:
     std::unique_ptr<parquet::PhysicalToLogicalConverter> _converter = nullptr;
     std::unique_ptr<std::vector<uint8_t>> _nested_filter_map_data = nullptr;
     size_t _orig_filter_map_index = 0;
+    // The values of current page skipped before the page is loaded, they are skipped when the
+    // page is loaded to read other values, or with the page if no value of it is read.
+    size_t _pending_skip_values = 0;
 
+    // the remaining number of values in current page not read or skipped
+    size_t _remaining_num_values() const {
+        return _chunk_reader->remaining_num_values() - _pending_skip_values;
+    }
+    Status _load_page_data();
+    Status _skip_page();
+    // Skip the values without loading the page if it is not loaded yet.
+    Status _skip_values_lazily(size_t num_values);
+    // Read the values, and skip the runs of values filtered by the filter map instead of decoding.
+    Status _read_filtered_values(size_t num_values, ColumnPtr& doris_column, DataTypePtr& type,
+                                 FilterMap& filter_map, bool is_dict_filter);
     Status _skip_values(size_t num_values);
     Status _read_values(size_t num_values, ColumnPtr& doris_column, DataTypePtr& type,
                         FilterMap& filter_map, bool is_dict_filter);
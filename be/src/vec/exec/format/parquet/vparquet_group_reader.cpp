@@ -350,6 +350,7 @@ Status RowGroupReader::next_batch(Block* block, size_t batch_size, size_t* read_
                 bool can_filter_all = false;
 
                 {
+                    _execute_dict_code_filters(block, &result_filter);
                     RETURN_IF_ERROR_OR_CATCH_EXCEPTION(VExprContext::execute_conjuncts(
                             _filter_conjuncts, &filters, block, &result_filter, &can_filter_all));
                 }
@@ -499,6 +500,7 @@ Status RowGroupReader::_do_lazy_read(Block* block, size_t batch_size, size_t* re
 
             {
                 SCOPED_RAW_TIMER(&_predicate_filter_time);
+                _execute_dict_code_filters(block, &result_filter);
                 RETURN_IF_ERROR(VExprContext::execute_conjuncts(filter_contexts, &filters, block,
                                                                 &result_filter, &can_filter_all));
             }
@@ -975,7 +977,13 @@ Status RowGroupReader::_rewrite_dict_predicates() {
             continue;
         }
 
-        // 4. Rewrite conjuncts.
+        // 4. Filter by the matched codes of the dictionary if there are many, otherwise
+        // rewrite conjuncts.
+        if (dict_codes.size() > FIXED_CONTAINER_MAX_SIZE) {
+            _dict_code_filters.push_back({dict_filter_col_name, std::move(result_filter)});
+            ++it;
+            continue;
+        }
         RETURN_IF_ERROR(_rewrite_dict_conjuncts(
                 dict_codes, slot_id, temp_block.get_by_position(dict_pos).column->is_nullable()));
         ++it;
@@ -1069,6 +1077,32 @@ Status RowGroupReader::_rewrite_dict_conjuncts(std::vector<int32_t>& dict_codes,
     return Status::OK();
 }
 
+void RowGroupReader::_execute_dict_code_filters(Block* block,
+                                                IColumn::Filter* result_filter) const {
+    auto* __restrict result_filter_data = result_filter->data();
+    size_t rows = result_filter->size();
+    for (const auto& dict_code_filter : _dict_code_filters) {
+        const auto* __restrict matched_codes = dict_code_filter.matched_codes.data();
+        const IColumn* column = block->get_by_name(dict_code_filter.col_name).column.get();
+        if (const auto* nullable_column = check_and_get_column<ColumnNullable>(*column)) {
+            const auto* __restrict codes =
+                    assert_cast<const ColumnInt32&>(nullable_column->get_nested_column())
+                            .get_data()
+                            .data();
+            const auto* __restrict null_map_data = nullable_column->get_null_map_data().data();
+            for (size_t i = 0; i < rows; ++i) {
+                result_filter_data[i] &= (!null_map_data[i]) & matched_codes[codes[i]];
+            }
+        } else {
+            const auto* __restrict codes =
+                    assert_cast<const ColumnInt32&>(*column).get_data().data();
+            for (size_t i = 0; i < rows; ++i) {
+                result_filter_data[i] &= matched_codes[codes[i]];
+            }
+        }
+    }
+}
+
 void RowGroupReader::_convert_dict_cols_to_string_cols(Block* block) {
     for (auto& dict_filter_cols : _dict_filter_cols) {
         size_t pos = block->get_position_by_name(dict_filter_cols.first);
@@ -211,6 +211,7 @@ private:
     bool is_dictionary_encoded(const tparquet::ColumnMetaData& column_metadata);
     Status _rewrite_dict_predicates();
     Status _rewrite_dict_conjuncts(std::vector<int32_t>& dict_codes, int slot_id, bool is_nullable);
+    void _execute_dict_code_filters(Block* block, IColumn::Filter* result_filter) const;
     void _convert_dict_cols_to_string_cols(Block* block);
 
     Status _get_current_batch_row_id(size_t read_rows);
@@ -246,6 +247,14 @@ private:
     VExprContextSPtrs _filter_conjuncts;
     // std::pair<col_name, slot_id>
     std::vector<std::pair<std::string, int>> _dict_filter_cols;
+    // The dict filter columns whose predicates match several dict codes. They are filtered by
+    // looking up the code of each row in `matched_codes`(1 if the code matches), which is cheaper
+    // than an IN predicate of the codes.
+    struct DictCodeFilter {
+        std::string col_name;
+        IColumn::Filter matched_codes;
+    };
+    std::vector<DictCodeFilter> _dict_code_filters;
     RuntimeState* _state = nullptr;
     std::shared_ptr<ObjectPool> _obj_pool;
     bool _is_row_group_filtered = false;
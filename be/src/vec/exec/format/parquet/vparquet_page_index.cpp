@@ -23,6 +23,7 @@
 #include <limits>
 #include <ostream>
 #include <string>
+#include <utility>
 
 #include "common/logging.h"
 #include "common/status.h"
@@ -41,7 +42,7 @@ struct FieldSchema;
 
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
-Status PageIndex::create_skipped_row_range(tparquet::OffsetIndex& offset_index,
+Status PageIndex::create_skipped_row_range(const tparquet::OffsetIndex& offset_index,
                                            int64_t total_rows_of_group, int page_idx,
                                            RowRange* row_range) {
     const auto& page_locations = offset_index.page_locations;
@@ -56,7 +57,7 @@ Status PageIndex::create_skipped_row_range(tparquet::OffsetIndex& offset_index,
     return Status::OK();
 }
 
-Status PageIndex::collect_skipped_page_range(tparquet::ColumnIndex* column_index,
+Status PageIndex::collect_skipped_page_range(const tparquet::ColumnIndex* column_index,
                                              const ColumnValueRangeType& col_val_range,
                                              const FieldSchema* col_schema,
                                              std::vector<int>& skipped_ranges,
@@ -124,6 +125,52 @@ Status PageIndex::parse_offset_index(const tparquet::ColumnChunk& chunk, const u
     RETURN_IF_ERROR(deserialize_thrift_msg(buff + buffer_offset, &length, true, offset_index));
     return Status::OK();
 }
+
+RowGroupPageIndex::RowGroupPageIndex(const PageIndex& page_index,
+                                     std::vector<uint8_t> column_index_buff,
+                                     std::vector<uint8_t> offset_index_buff)
+        : _page_index(page_index),
+          _column_index_buff(std::move(column_index_buff)),
+          _offset_index_buff(std::move(offset_index_buff)) {}
+
+RowGroupPageIndex::~RowGroupPageIndex() = default;
+
+Status RowGroupPageIndex::get_column_index(const tparquet::ColumnChunk& chunk, int column_id,
+                                           const tparquet::ColumnIndex** column_index) {
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        auto it = _column_indexes.find(column_id);
+        if (it != _column_indexes.end()) {
+            *column_index = it->second.get();
+            return Status::OK();
+        }
+    }
+    // deserialize out of the lock, a concurrent reader may parse the same column at worst
+    auto parsed = std::make_unique<tparquet::ColumnIndex>();
+    RETURN_IF_ERROR(
+            _page_index.parse_column_index(chunk, _column_index_buff.data(), parsed.get()));
+    std::lock_guard<std::mutex> lock(_lock);
+    *column_index = _column_indexes.emplace(column_id, std::move(parsed)).first->second.get();
+    return Status::OK();
+}
+
+Status RowGroupPageIndex::get_offset_index(const tparquet::ColumnChunk& chunk, int column_id,
+                                           const tparquet::OffsetIndex** offset_index) {
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        auto it = _offset_indexes.find(column_id);
+        if (it != _offset_indexes.end()) {
+            *offset_index = it->second.get();
+            return Status::OK();
+        }
+    }
+    auto parsed = std::make_unique<tparquet::OffsetIndex>();
+    RETURN_IF_ERROR(
+            _page_index.parse_offset_index(chunk, _offset_index_buff.data(), parsed.get()));
+    std::lock_guard<std::mutex> lock(_lock);
+    *offset_index = _offset_indexes.emplace(column_id, std::move(parsed)).first->second.get();
+    return Status::OK();
+}
 #include "common/compile_check_end.h"
 
 } // namespace doris::vectorized
@@ -19,6 +19,9 @@
 #include <common/status.h>
 #include <stdint.h>
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "exec/olap_common.h"
@@ -44,9 +47,9 @@ class PageIndex {
 public:
     PageIndex() = default;
     ~PageIndex() = default;
-    Status create_skipped_row_range(tparquet::OffsetIndex& offset_index,
+    Status create_skipped_row_range(const tparquet::OffsetIndex& offset_index,
                                     int64_t total_rows_of_group, int page_idx, RowRange* row_range);
-    Status collect_skipped_page_range(tparquet::ColumnIndex* column_index,
+    Status collect_skipped_page_range(const tparquet::ColumnIndex* column_index,
                                       const ColumnValueRangeType& col_val_range,
                                       const FieldSchema* col_schema,
                                       std::vector<int>& skipped_ranges, const cctz::time_zone& ctz);
@@ -63,6 +66,30 @@ private:
     int64_t _offset_index_start;
     int64_t _offset_index_size;
 };
+
+// The page indexes of a row group, which can be shared by the readers of the same file through
+// FileMetaCache. The raw buffers are read once, and the column index or offset index of a column
+// is only deserialized when it is used for the first time.
+class RowGroupPageIndex {
+public:
+    RowGroupPageIndex(const PageIndex& page_index, std::vector<uint8_t> column_index_buff,
+                      std::vector<uint8_t> offset_index_buff);
+    ~RowGroupPageIndex();
+
+    Status get_column_index(const tparquet::ColumnChunk& chunk, int column_id,
+                            const tparquet::ColumnIndex** column_index);
+    Status get_offset_index(const tparquet::ColumnChunk& chunk, int column_id,
+                            const tparquet::OffsetIndex** offset_index);
+
+private:
+    PageIndex _page_index;
+    const std::vector<uint8_t> _column_index_buff;
+    const std::vector<uint8_t> _offset_index_buff;
+
+    std::mutex _lock;
+    std::unordered_map<int, std::unique_ptr<tparquet::ColumnIndex>> _column_indexes;
+    std::unordered_map<int, std::unique_ptr<tparquet::OffsetIndex>> _offset_indexes;
+};
 #include "common/compile_check_end.h"
 
 } // namespace doris::vectorized
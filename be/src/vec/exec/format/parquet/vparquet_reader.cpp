@@ -346,6 +346,7 @@ Status ParquetReader::init_reader(
     }
     // build column predicates for column lazy read
     _lazy_read_ctx.conjuncts = conjuncts;
+    _filter_groups = filter_groups;
     RETURN_IF_ERROR(_init_row_groups(filter_groups));
     return Status::OK();
 }
@@ -632,6 +633,27 @@ Status ParquetReader::_next_row_group_reader() {
                                        _slot_id_to_filter_conjuncts);
 }
 
+Status ParquetReader::filter_by_value_ranges() {
+    if (!_filter_groups || _read_line_mode_mode) {
+        return Status::OK();
+    }
+    SCOPED_RAW_TIMER(&_statistics.row_group_filter_time);
+    for (auto it = _read_row_groups.begin(); it != _read_row_groups.end();) {
+        const tparquet::RowGroup& row_group = _t_metadata->row_groups[it->row_group_id];
+        bool filter_group = false;
+        RETURN_IF_ERROR(_process_column_stat_filter(row_group.columns, &filter_group));
+        if (filter_group) {
+            _statistics.read_row_groups--;
+            _statistics.filtered_row_groups++;
+            _statistics.filtered_group_rows += row_group.num_rows;
+            it = _read_row_groups.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    return Status::OK();
+}
+
 Status ParquetReader::_init_row_groups(const bool& is_filter_groups) {
     SCOPED_RAW_TIMER(&_statistics.row_group_filter_time);
     if (is_filter_groups && (_total_groups == 0 || _t_metadata->num_rows == 0 || _range_size < 0)) {
@@ -754,6 +776,51 @@ bool ParquetReader::_has_page_index(const std::vector<tparquet::ColumnChunk>& co
     return page_index.check_and_get_page_index_ranges(columns);
 }
 
+Status ParquetReader::_get_row_group_page_index(
+        int row_group_id, const PageIndex& page_index,
+        std::shared_ptr<RowGroupPageIndex>* row_group_page_index) {
+    using CachedPageIndex = std::shared_ptr<RowGroupPageIndex>;
+    std::string cache_key;
+    if (_meta_cache != nullptr) {
+        cache_key = FileMetaCache::get_key(_file_reader, _file_description.mtime) +
+                    "_page_index_" + std::to_string(row_group_id);
+        ObjLRUCache::CacheHandle handle;
+        if (_meta_cache->cache().lookup({cache_key}, &handle)) {
+            *row_group_page_index = *(CachedPageIndex*)handle.data<CachedPageIndex>();
+            return Status::OK();
+        }
+    }
+
+    std::vector<uint8_t> col_index_buff(page_index._column_index_size);
+    std::vector<uint8_t> off_index_buff(page_index._offset_index_size);
+    size_t bytes_read = 0;
+    Slice result(col_index_buff.data(), page_index._column_index_size);
+    {
+        SCOPED_RAW_TIMER(&_statistics.read_page_index_time);
+        RETURN_IF_ERROR(_file_reader->read_at(page_index._column_index_start, result, &bytes_read,
+                                              _io_ctx));
+    }
+    _column_statistics.read_bytes += bytes_read;
+    Slice res(off_index_buff.data(), page_index._offset_index_size);
+    {
+        SCOPED_RAW_TIMER(&_statistics.read_page_index_time);
+        RETURN_IF_ERROR(
+                _file_reader->read_at(page_index._offset_index_start, res, &bytes_read, _io_ctx));
+    }
+    _column_statistics.read_bytes += bytes_read;
+    // read twice: parse column index & parse offset index
+    _column_statistics.meta_read_calls += 2;
+
+    *row_group_page_index = std::make_shared<RowGroupPageIndex>(
+            page_index, std::move(col_index_buff), std::move(off_index_buff));
+    if (_meta_cache != nullptr) {
+        ObjLRUCache::CacheHandle handle;
+        _meta_cache->cache().insert({cache_key}, new CachedPageIndex(*row_group_page_index),
+                                    &handle);
+    }
+    return Status::OK();
+}
+
 Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
                                           const RowGroupReader::RowGroupIndex& row_group_index,
                                           std::vector<RowRange>& candidate_row_ranges) {
@@ -784,27 +851,11 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
         read_whole_row_group();
         return Status::OK();
     }
-    std::vector<uint8_t> col_index_buff(page_index._column_index_size);
-    size_t bytes_read = 0;
-    Slice result(col_index_buff.data(), page_index._column_index_size);
-    {
-        SCOPED_RAW_TIMER(&_statistics.read_page_index_time);
-        RETURN_IF_ERROR(_file_reader->read_at(page_index._column_index_start, result, &bytes_read,
-                                              _io_ctx));
-    }
-    _column_statistics.read_bytes += bytes_read;
+    std::shared_ptr<RowGroupPageIndex> row_group_page_index;
+    RETURN_IF_ERROR(_get_row_group_page_index(row_group_index.row_group_id, page_index,
+                                              &row_group_page_index));
     auto& schema_desc = _file_metadata->schema();
     std::vector<RowRange> skipped_row_ranges;
-    std::vector<uint8_t> off_index_buff(page_index._offset_index_size);
-    Slice res(off_index_buff.data(), page_index._offset_index_size);
-    {
-        SCOPED_RAW_TIMER(&_statistics.read_page_index_time);
-        RETURN_IF_ERROR(
-                _file_reader->read_at(page_index._offset_index_start, res, &bytes_read, _io_ctx));
-    }
-    _column_statistics.read_bytes += bytes_read;
-    // read twice: parse column index & parse offset index
-    _column_statistics.meta_read_calls += 2;
     SCOPED_RAW_TIMER(&_statistics.parse_page_index_time);
 
     for (size_t idx = 0; idx < _read_table_columns.size(); idx++) {
@@ -824,30 +875,32 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
         if (chunk.column_index_offset == 0 && chunk.column_index_length == 0) {
             continue;
         }
-        tparquet::ColumnIndex column_index;
-        RETURN_IF_ERROR(page_index.parse_column_index(chunk, col_index_buff.data(), &column_index));
-        const int64_t num_of_pages = column_index.null_pages.size();
+        const tparquet::ColumnIndex* column_index = nullptr;
+        RETURN_IF_ERROR(
+                row_group_page_index->get_column_index(chunk, parquet_col_id, &column_index));
+        const int64_t num_of_pages = column_index->null_pages.size();
         if (num_of_pages <= 0) {
             continue;
         }
         auto& conjuncts = conjunct_iter->second;
         std::vector<int> skipped_page_range;
         const FieldSchema* col_schema = schema_desc.get_column(read_file_col);
-        RETURN_IF_ERROR(page_index.collect_skipped_page_range(&column_index, conjuncts, col_schema,
+        RETURN_IF_ERROR(page_index.collect_skipped_page_range(column_index, conjuncts, col_schema,
                                                               skipped_page_range, *_ctz));
         if (skipped_page_range.empty()) {
             continue;
         }
-        tparquet::OffsetIndex offset_index;
-        RETURN_IF_ERROR(page_index.parse_offset_index(chunk, off_index_buff.data(), &offset_index));
+        const tparquet::OffsetIndex* offset_index = nullptr;
+        RETURN_IF_ERROR(
+                row_group_page_index->get_offset_index(chunk, parquet_col_id, &offset_index));
         for (int page_id : skipped_page_range) {
             RowRange skipped_row_range;
-            RETURN_IF_ERROR(page_index.create_skipped_row_range(offset_index, row_group.num_rows,
+            RETURN_IF_ERROR(page_index.create_skipped_row_range(*offset_index, row_group.num_rows,
                                                                 page_id, &skipped_row_range));
             // use the union row range
             skipped_row_ranges.emplace_back(skipped_row_range);
         }
-        _col_offsets[parquet_col_id] = offset_index;
+        _col_offsets[parquet_col_id] = *offset_index;
     }
     if (skipped_row_ranges.empty()) {
         read_whole_row_group();
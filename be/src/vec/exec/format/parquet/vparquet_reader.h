@@ -121,6 +121,9 @@ public:
 
     Status get_next_block(Block* block, size_t* read_rows, bool* eof) override;
 
+    // Skip the unread row groups by the statistics of the narrowed value ranges.
+    Status filter_by_value_ranges() override;
+
     Status close() override;
 
     RowRange get_whole_range() { return _whole_range; }
@@ -212,6 +215,9 @@ private:
     Status _process_page_index(const tparquet::RowGroup& row_group,
                                const RowGroupReader::RowGroupIndex& row_group_index,
                                std::vector<RowRange>& candidate_row_ranges);
+    // Read the page indexes of a row group, or share them with other readers by _meta_cache.
+    Status _get_row_group_page_index(int row_group_id, const PageIndex& page_index,
+                                     std::shared_ptr<RowGroupPageIndex>* row_group_page_index);
 
     // Row Group Filter
     bool _is_misaligned_range_group(const tparquet::RowGroup& row_group);
@@ -276,6 +282,8 @@ private:
     RowGroupReader::LazyReadContext _lazy_read_ctx;
 
     std::list<RowGroupReader::RowGroupIndex> _read_row_groups;
+    // Whether the row groups are filtered by statistics, set by init_reader.
+    bool _filter_groups = false;
     // parquet file reader object
     size_t _batch_size;
     int64_t _range_start_offset;
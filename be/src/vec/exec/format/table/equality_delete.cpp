@@ -43,7 +43,7 @@ Status SimpleEqualityDelete::_build_set() {
     return Status::OK();
 }
 
-Status SimpleEqualityDelete::filter_data_block(Block* data_block) {
+Status SimpleEqualityDelete::filter_data_block(Block* data_block) const {
     SCOPED_TIMER(equality_delete_time);
     auto* column_and_type = data_block->try_get_by_name(_delete_column_name);
     if (column_and_type == nullptr) {
@@ -56,13 +56,8 @@ Status SimpleEqualityDelete::filter_data_block(Block* data_block) {
                 _delete_column_name, column_and_type->type->get_name(), (int)_delete_column_type);
     }
     size_t rows = data_block->rows();
-    // _filter: 1 => in _hybrid_set; 0 => not in _hybrid_set
-    if (_filter == nullptr) {
-        _filter = std::make_unique<IColumn::Filter>(rows, 0);
-    } else {
-        // reset the array capacity and fill all elements using the 0
-        _filter->assign(rows, UInt8(0));
-    }
+    // filter: 1 => in _hybrid_set; 0 => not in _hybrid_set
+    IColumn::Filter filter(rows, 0);
 
     if (column_and_type->column->is_nullable()) {
         const NullMap& null_map =
@@ -70,23 +65,23 @@ Status SimpleEqualityDelete::filter_data_block(Block* data_block) {
                         ->get_null_map_data();
         _hybrid_set->find_batch_nullable(
                 remove_nullable(column_and_type->column)->assume_mutable_ref(), rows, null_map,
-                *_filter);
+                filter);
         if (_hybrid_set->contain_null()) {
-            auto* filter_data = _filter->data();
+            auto* filter_data = filter.data();
             for (size_t i = 0; i < rows; ++i) {
                 filter_data[i] = filter_data[i] || null_map[i];
             }
         }
     } else {
-        _hybrid_set->find_batch(column_and_type->column->assume_mutable_ref(), rows, *_filter);
+        _hybrid_set->find_batch(column_and_type->column->assume_mutable_ref(), rows, filter);
     }
-    // should reverse _filter
-    auto* filter_data = _filter->data();
+    // should reverse filter
+    auto* filter_data = filter.data();
     for (size_t i = 0; i < rows; ++i) {
         filter_data[i] = !filter_data[i];
     }
 
-    Block::filter_block_internal(data_block, *_filter, data_block->columns());
+    Block::filter_block_internal(data_block, filter, data_block->columns());
     return Status::OK();
 }
 
@@ -98,15 +93,22 @@ Status MultiEqualityDelete::_build_set() {
     for (ColumnPtr column : _delete_block->get_columns()) {
         column->update_hashes_with_value(_delete_hashes.data(), nullptr);
     }
+    _delete_hash_map.reserve(rows);
+    _next_delete_rows.resize(rows, END_OF_CHAIN);
     for (size_t i = 0; i < rows; ++i) {
-        _delete_hash_map.insert({_delete_hashes[i], i});
+        auto [it, inserted] = _delete_hash_map.try_emplace(_delete_hashes[i], i);
+        if (!inserted) {
+            _next_delete_rows[i] = it->second;
+            it->second = i;
+        }
     }
-    _data_column_index.resize(_delete_block->columns());
     return Status::OK();
 }
 
-Status MultiEqualityDelete::filter_data_block(Block* data_block) {
+Status MultiEqualityDelete::filter_data_block(Block* data_block) const {
     SCOPED_TIMER(equality_delete_time);
+    // the delete column indexes in data block
+    std::vector<size_t> data_column_index(_delete_block->columns());
     size_t column_index = 0;
     for (std::string column_name : _delete_block->get_names()) {
         auto* column_and_type = data_block->try_get_by_name(column_name);
@@ -120,42 +122,40 @@ Status MultiEqualityDelete::filter_data_block(Block* data_block) {
                     column_name, _delete_block->get_by_name(column_name).type->get_name(),
                     column_and_type->type->get_name());
         }
-        _data_column_index[column_index++] = data_block->get_position_by_name(column_name);
+        data_column_index[column_index++] = data_block->get_position_by_name(column_name);
     }
     size_t rows = data_block->rows();
-    _data_hashes.clear();
-    _data_hashes.resize(rows, 0);
-    for (size_t index : _data_column_index) {
-        data_block->get_by_position(index).column->update_hashes_with_value(_data_hashes.data(),
+    // hash column for data block
+    std::vector<uint64_t> data_hashes(rows, 0);
+    for (size_t index : data_column_index) {
+        data_block->get_by_position(index).column->update_hashes_with_value(data_hashes.data(),
                                                                             nullptr);
     }
 
-    if (_filter == nullptr) {
-        _filter = std::make_unique<IColumn::Filter>(rows, 1);
-    } else {
-        //reset the array capacity and fill all elements using the 0
-        _filter->assign(rows, UInt8(1));
-    }
-    auto* filter_data = _filter->data();
+    IColumn::Filter filter(rows, 1);
+    auto* filter_data = filter.data();
     for (size_t i = 0; i < rows; ++i) {
-        for (auto beg = _delete_hash_map.lower_bound(_data_hashes[i]),
-                  end = _delete_hash_map.upper_bound(_data_hashes[i]);
-             beg != end; ++beg) {
-            if (_equal(data_block, i, beg->second)) {
+        auto it = _delete_hash_map.find(data_hashes[i]);
+        if (it == _delete_hash_map.end()) {
+            continue;
+        }
+        for (size_t delete_row = it->second; delete_row != END_OF_CHAIN;
+             delete_row = _next_delete_rows[delete_row]) {
+            if (_equal(data_block, data_column_index, i, delete_row)) {
                 filter_data[i] = 0;
                 break;
             }
         }
     }
 
-    Block::filter_block_internal(data_block, *_filter, data_block->columns());
+    Block::filter_block_internal(data_block, filter, data_block->columns());
     return Status::OK();
 }
 
-bool MultiEqualityDelete::_equal(Block* data_block, size_t data_row_index,
-                                 size_t delete_row_index) {
+bool MultiEqualityDelete::_equal(Block* data_block, const std::vector<size_t>& data_column_index,
+                                 size_t data_row_index, size_t delete_row_index) const {
     for (size_t i = 0; i < _delete_block->columns(); ++i) {
-        ColumnPtr data_col = data_block->get_by_position(_data_column_index[i]).column;
+        ColumnPtr data_col = data_block->get_by_position(data_column_index[i]).column;
         ColumnPtr delete_col = _delete_block->get_by_position(i).column;
         if (data_col->compare_at(data_row_index, delete_row_index, delete_col->assume_mutable_ref(),
                                  -1) != 0) {
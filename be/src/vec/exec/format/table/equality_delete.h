@@ -15,6 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <parallel_hashmap/phmap.h>
+
+#include <limits>
+
 #include "exprs/hybrid_set.h"
 #include "util/runtime_profile.h"
 #include "vec/core/block.h"
@@ -29,6 +33,8 @@ namespace doris::vectorized {
  * If there are more delete columns in delete file, use `MultiEqualityDelete`,
  * which generates a hash column from all delete columns, and only compare the values
  * when the hash values are the same.
+ * The delete set is immutable after `init`, so it can be shared by the readers of different
+ * scanners, and `filter_data_block` can be called concurrently.
  */
 class EqualityDeleteBase {
 protected:
@@ -56,7 +62,7 @@ public:
         return _build_set();
     }
 
-    virtual Status filter_data_block(Block* data_block) = 0;
+    virtual Status filter_data_block(Block* data_block) const = 0;
 
     static std::unique_ptr<EqualityDeleteBase> get_delete_impl(Block* delete_block);
 };
@@ -66,14 +72,13 @@ protected:
     std::shared_ptr<HybridSetBase> _hybrid_set;
     std::string _delete_column_name;
     PrimitiveType _delete_column_type;
-    std::unique_ptr<IColumn::Filter> _filter;
 
     Status _build_set() override;
 
 public:
     SimpleEqualityDelete(Block* delete_block) : EqualityDeleteBase(delete_block) {}
 
-    Status filter_data_block(Block* data_block) override;
+    Status filter_data_block(Block* data_block) const override;
 };
 
 /**
@@ -81,26 +86,26 @@ public:
  */
 class MultiEqualityDelete : public EqualityDeleteBase {
 protected:
+    static constexpr size_t END_OF_CHAIN = std::numeric_limits<size_t>::max();
+
     // hash column for delete block
     std::vector<uint64_t> _delete_hashes;
-    // hash column for data block
-    std::vector<uint64_t> _data_hashes;
-    // hash code => row index
+    // hash code => the first row index with this hash code, and the following rows are chained
+    // by _next_delete_rows, ended with END_OF_CHAIN.
     // if hash values are equal, then compare the real values
     // the row index records the row number of the delete row in delete block
-    std::multimap<uint64_t, size_t> _delete_hash_map;
-    // the delete column indexes in data block
-    std::vector<size_t> _data_column_index;
-    std::unique_ptr<IColumn::Filter> _filter;
+    phmap::flat_hash_map<uint64_t, size_t> _delete_hash_map;
+    std::vector<size_t> _next_delete_rows;
 
     Status _build_set() override;
 
-    bool _equal(Block* data_block, size_t data_row_index, size_t delete_row_index);
+    bool _equal(Block* data_block, const std::vector<size_t>& data_column_index,
+                size_t data_row_index, size_t delete_row_index) const;
 
 public:
     MultiEqualityDelete(Block* delete_block) : EqualityDeleteBase(delete_block) {}
 
-    Status filter_data_block(Block* data_block) override;
+    Status filter_data_block(Block* data_block) const override;
 };
 
 #include "common/compile_check_end.h"
@@ -143,9 +143,52 @@ Status IcebergTableReader::init_row_filters() {
 
 Status IcebergTableReader::_equality_delete_base(
         const std::vector<TIcebergDeleteFileDesc>& delete_files) {
+    Status create_status = Status::OK();
+    // the delete files are read and built into the hash set only once, and shared by the splits
+    auto* delete_set = _kv_cache->get<EqualityDeleteSet>(
+            _equality_delete_cache_key(delete_files), [&]() -> EqualityDeleteSet* {
+                auto* equality_delete = new EqualityDeleteSet;
+                create_status = _build_equality_delete_set(delete_files, equality_delete);
+                if (!create_status) {
+                    delete equality_delete;
+                    return nullptr;
+                }
+                return equality_delete;
+            });
+    RETURN_IF_ERROR(create_status);
+    DCHECK(delete_set != nullptr);
+
+    for (int i = 0; i < delete_set->delete_col_names.size(); ++i) {
+        const std::string& delete_col = delete_set->delete_col_names[i];
+        if (std::find(_all_required_col_names.begin(), _all_required_col_names.end(), delete_col) ==
+            _all_required_col_names.end()) {
+            _expand_col_names.emplace_back(delete_col);
+            DataTypePtr data_type = make_nullable(delete_set->delete_col_types[i]);
+            MutableColumnPtr data_column = data_type->create_column();
+            _expand_columns.emplace_back(std::move(data_column), data_type, delete_col);
+        }
+    }
+    for (const std::string& delete_col : _expand_col_names) {
+        _all_required_col_names.emplace_back(delete_col);
+    }
+    _equality_delete_impl = delete_set->delete_impl.get();
+    return Status::OK();
+}
+
+std::string IcebergTableReader::_equality_delete_cache_key(
+        const std::vector<TIcebergDeleteFileDesc>& delete_files) {
+    std::string key = "equality_delete";
+    for (const auto& delete_file : delete_files) {
+        key.append("_").append(delete_file.path);
+    }
+    return key;
+}
+
+Status IcebergTableReader::_build_equality_delete_set(
+        const std::vector<TIcebergDeleteFileDesc>& delete_files, EqualityDeleteSet* delete_set) {
     bool init_schema = false;
-    std::vector<std::string> equality_delete_col_names;
-    std::vector<DataTypePtr> equality_delete_col_types;
+    std::vector<std::string>& equality_delete_col_names = delete_set->delete_col_names;
+    std::vector<DataTypePtr>& equality_delete_col_types = delete_set->delete_col_types;
     std::unordered_map<std::string, std::tuple<std::string, const SlotDescriptor*>>
             partition_columns;
     std::unordered_map<std::string, VExprContextSPtr> missing_columns;
@@ -163,7 +206,7 @@ Status IcebergTableReader::_equality_delete_base(
             RETURN_IF_ERROR(delete_reader->init_schema_reader());
             RETURN_IF_ERROR(delete_reader->get_parsed_schema(&equality_delete_col_names,
                                                              &equality_delete_col_types));
-            _generate_equality_delete_block(&_equality_delete_block, equality_delete_col_names,
+            _generate_equality_delete_block(&delete_set->delete_block, equality_delete_col_names,
                                             equality_delete_col_types);
             init_schema = true;
         }
@@ -188,26 +231,13 @@ Status IcebergTableReader::_equality_delete_base(
             size_t read_rows = 0;
             RETURN_IF_ERROR(delete_reader->get_next_block(&block, &read_rows, &eof));
             if (read_rows > 0) {
-                MutableBlock mutable_block(&_equality_delete_block);
+                MutableBlock mutable_block(&delete_set->delete_block);
                 RETURN_IF_ERROR(mutable_block.merge(block));
             }
         }
     }
-    for (int i = 0; i < equality_delete_col_names.size(); ++i) {
-        const std::string& delete_col = equality_delete_col_names[i];
-        if (std::find(_all_required_col_names.begin(), _all_required_col_names.end(), delete_col) ==
-            _all_required_col_names.end()) {
-            _expand_col_names.emplace_back(delete_col);
-            DataTypePtr data_type = make_nullable(equality_delete_col_types[i]);
-            MutableColumnPtr data_column = data_type->create_column();
-            _expand_columns.emplace_back(std::move(data_column), data_type, delete_col);
-        }
-    }
-    for (const std::string& delete_col : _expand_col_names) {
-        _all_required_col_names.emplace_back(delete_col);
-    }
-    _equality_delete_impl = EqualityDeleteBase::get_delete_impl(&_equality_delete_block);
-    return _equality_delete_impl->init(_profile);
+    delete_set->delete_impl = EqualityDeleteBase::get_delete_impl(&delete_set->delete_block);
+    return delete_set->delete_impl->init(_profile);
 }
 
 void IcebergTableReader::_generate_equality_delete_block(
@@ -282,14 +312,36 @@ Status IcebergTableReader::_position_delete_base(
         delete_file_map.if_contains(data_file_path, get_value);
     }
     if (num_delete_rows > 0) {
-        SCOPED_TIMER(_iceberg_profile.delete_rows_sort_time);
-        _sort_delete_rows(delete_rows_array, num_delete_rows);
+        if (delete_rows_array.size() == 1) {
+            // already sorted in the delete file, no need to copy it
+            _iceberg_delete_rows = delete_rows_array.front();
+        } else {
+            // the splits of a data file share the same delete files, merge them only once
+            SCOPED_TIMER(_iceberg_profile.delete_rows_sort_time);
+            _iceberg_delete_rows = _kv_cache->get<DeleteRows>(
+                    _merged_delete_rows_cache_key(data_file_path, delete_files),
+                    [&]() -> DeleteRows* {
+                        auto* merged_rows = new DeleteRows;
+                        _sort_delete_rows(delete_rows_array, num_delete_rows, merged_rows);
+                        return merged_rows;
+                    });
+        }
         this->set_delete_rows();
         COUNTER_UPDATE(_iceberg_profile.num_delete_rows, num_delete_rows);
     }
     return Status::OK();
 }
 
+std::string IcebergTableReader::_merged_delete_rows_cache_key(
+        const std::string& data_file_path,
+        const std::vector<TIcebergDeleteFileDesc>& delete_files) {
+    std::string key = "merged_delete_rows_" + data_file_path;
+    for (const auto& delete_file : delete_files) {
+        key.append("_").append(delete_file.path);
+    }
+    return key;
+}
+
 IcebergTableReader::PositionDeleteRange IcebergTableReader::_get_range(
         const ColumnDictI32& file_path_column) {
     IcebergTableReader::PositionDeleteRange range;
@@ -331,52 +383,49 @@ IcebergTableReader::PositionDeleteRange IcebergTableReader::_get_range(
     return range;
 }
 
-void IcebergTableReader::_sort_delete_rows(std::vector<std::vector<int64_t>*>& delete_rows_array,
-                                           int64_t num_delete_rows) {
+void IcebergTableReader::_sort_delete_rows(const std::vector<DeleteRows*>& delete_rows_array,
+                                           int64_t num_delete_rows, DeleteRows* result) {
+    result->resize(num_delete_rows);
     if (delete_rows_array.empty()) {
         return;
     }
     if (delete_rows_array.size() == 1) {
-        _iceberg_delete_rows.resize(num_delete_rows);
-        memcpy(_iceberg_delete_rows.data(), delete_rows_array.front()->data(),
+        memcpy(result->data(), delete_rows_array.front()->data(),
                sizeof(int64_t) * num_delete_rows);
         return;
     }
     if (delete_rows_array.size() == 2) {
-        _iceberg_delete_rows.resize(num_delete_rows);
         std::merge(delete_rows_array.front()->begin(), delete_rows_array.front()->end(),
                    delete_rows_array.back()->begin(), delete_rows_array.back()->end(),
-                   _iceberg_delete_rows.begin());
+                   result->begin());
         return;
     }
 
-    using vec_pair = std::pair<std::vector<int64_t>::iterator, std::vector<int64_t>::iterator>;
-    _iceberg_delete_rows.resize(num_delete_rows);
-    auto row_id_iter = _iceberg_delete_rows.begin();
-    auto iter_end = _iceberg_delete_rows.end();
-    std::vector<vec_pair> rows_array;
-    for (auto* rows : delete_rows_array) {
+    // k-way merge by a min heap of the current row of each delete file
+    using RowsCursor = std::pair<DeleteRows::const_iterator, DeleteRows::const_iterator>;
+    auto greater = [](const RowsCursor& lhs, const RowsCursor& rhs) {
+        return *lhs.first > *rhs.first;
+    };
+    std::vector<RowsCursor> heap;
+    heap.reserve(delete_rows_array.size());
+    for (const auto* rows : delete_rows_array) {
         if (!rows->empty()) {
-            rows_array.emplace_back(rows->begin(), rows->end());
+            heap.emplace_back(rows->begin(), rows->end());
         }
     }
-    size_t array_size = rows_array.size();
-    while (row_id_iter != iter_end) {
-        int64_t min_index = 0;
-        int64_t min = *rows_array[0].first;
-        for (size_t i = 0; i < array_size; ++i) {
-            if (*rows_array[i].first < min) {
-                min_index = i;
-                min = *rows_array[i].first;
-            }
-        }
-        *row_id_iter++ = min;
-        rows_array[min_index].first++;
-        if (UNLIKELY(rows_array[min_index].first == rows_array[min_index].second)) {
-            rows_array.erase(rows_array.begin() + min_index);
-            array_size--;
+    std::make_heap(heap.begin(), heap.end(), greater);
+    auto row_id_iter = result->begin();
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), greater);
+        RowsCursor& cursor = heap.back();
+        *row_id_iter++ = *cursor.first++;
+        if (cursor.first == cursor.second) {
+            heap.pop_back();
+        } else {
+            std::push_heap(heap.begin(), heap.end(), greater);
         }
     }
+    DCHECK(row_id_iter == result->end());
 }
 
 void IcebergTableReader::_gen_position_delete_file_range(Block& block, DeleteFile* position_delete,
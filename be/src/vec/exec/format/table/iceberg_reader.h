@@ -103,14 +103,17 @@ protected:
      * Sorting by file_path allows filter pushdown by file in columnar storage formats.
      * Sorting by position allows filtering rows while scanning, to avoid keeping deletes in memory.
      */
-    void _sort_delete_rows(std::vector<std::vector<int64_t>*>& delete_rows_array,
-                           int64_t num_delete_rows);
+    static void _sort_delete_rows(const std::vector<DeleteRows*>& delete_rows_array,
+                                  int64_t num_delete_rows, DeleteRows* result);
 
     PositionDeleteRange _get_range(const ColumnDictI32& file_path_column);
 
     PositionDeleteRange _get_range(const ColumnString& file_path_column);
 
     static std::string _delet_file_cache_key(const std::string& path) { return "delete_" + path; }
+    static std::string _merged_delete_rows_cache_key(
+            const std::string& data_file_path,
+            const std::vector<TIcebergDeleteFileDesc>& delete_files);
 
     Status _position_delete_base(const std::string data_file_path,
                                  const std::vector<TIcebergDeleteFileDesc>& delete_files);
@@ -128,7 +131,8 @@ protected:
     // owned by scan node
     ShardedKVCache* _kv_cache;
     IcebergProfile _iceberg_profile;
-    std::vector<int64_t> _iceberg_delete_rows;
+    // the sorted position deletes of the data file, owned by _kv_cache
+    const DeleteRows* _iceberg_delete_rows = nullptr;
     std::vector<std::string> _expand_col_names;
     std::vector<ColumnWithTypeAndName> _expand_columns;
     std::vector<std::string> _all_required_col_names;
@@ -149,9 +153,22 @@ protected:
     void _gen_position_delete_file_range(Block& block, DeleteFile* const position_delete,
                                          size_t read_rows, bool file_path_column_dictionary_coded);
 
-    // equality delete
-    Block _equality_delete_block;
-    std::unique_ptr<EqualityDeleteBase> _equality_delete_impl;
+    // The equality deletes built from a group of delete files, which is shared by the readers of
+    // the data files with the same delete files through _kv_cache.
+    struct EqualityDeleteSet {
+        Block delete_block;
+        std::vector<std::string> delete_col_names;
+        std::vector<DataTypePtr> delete_col_types;
+        std::unique_ptr<EqualityDeleteBase> delete_impl;
+    };
+
+    static std::string _equality_delete_cache_key(
+            const std::vector<TIcebergDeleteFileDesc>& delete_files);
+    Status _build_equality_delete_set(const std::vector<TIcebergDeleteFileDesc>& delete_files,
+                                      EqualityDeleteSet* delete_set);
+
+    // equality delete, owned by _kv_cache
+    const EqualityDeleteBase* _equality_delete_impl = nullptr;
 };
 
 class IcebergParquetReader final : public IcebergTableReader {
@@ -178,7 +195,7 @@ public:
 
     void set_delete_rows() final {
         auto* parquet_reader = (ParquetReader*)(_file_format_reader.get());
-        parquet_reader->set_delete_rows(&_iceberg_delete_rows);
+        parquet_reader->set_delete_rows(_iceberg_delete_rows);
     }
 
 protected:
@@ -204,7 +221,7 @@ public:
 
     void set_delete_rows() final {
         auto* orc_reader = (OrcReader*)_file_format_reader.get();
-        orc_reader->set_position_delete_rowids(&_iceberg_delete_rows);
+        orc_reader->set_position_delete_rowids(_iceberg_delete_rows);
     }
 
     Status init_reader(
@@ -95,11 +95,7 @@ Status PaimonReader::init_row_filters() {
     }
     auto deletion_vector = DORIS_TRY(DeletionVector::deserialize(result.data, result.size));
     if (!deletion_vector.is_empty()) {
-        for (auto i = deletion_vector.minimum(); i <= deletion_vector.maximum(); i++) {
-            if (deletion_vector.is_delete(i)) {
-                _delete_rows.push_back(i);
-            }
-        }
+        deletion_vector.to_sorted_rows(&_delete_rows);
         COUNTER_UPDATE(_paimon_profile.num_delete_rows, _delete_rows.size());
         set_delete_rows();
     }
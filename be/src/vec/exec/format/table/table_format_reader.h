@@ -101,6 +101,10 @@ public:
 
     bool fill_all_columns() const override { return _file_format_reader->fill_all_columns(); }
 
+    Status filter_by_value_ranges() override {
+        return _file_format_reader->filter_by_value_ranges();
+    }
+
     virtual Status init_row_filters() = 0;
 
 protected:
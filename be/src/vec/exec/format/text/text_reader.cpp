@@ -163,6 +163,11 @@ Status TextReader::_validate_line(const Slice& line, bool* success) {
     return Status::OK();
 }
 
+bool TextReader::_check_line(const Slice& line) {
+    // text file do not need utf8 check
+    return true;
+}
+
 Status TextReader::_deserialize_nullable_string(IColumn& column, Slice& slice) {
     auto& null_column = assert_cast<ColumnNullable&>(column);
     if (_options.null_len > 0) {
@@ -378,6 +378,26 @@ Status JniConnector::_fill_column(TableMetaAddress& address, ColumnPtr& doris_co
     return Status::OK();
 }
 
+// The offsets from java side start from zero in each batch, so they have the same layout as
+// doris offsets if the column is empty, which is the usual case as the block is cleared for each
+// batch. Only shift them by the existing data otherwise. Returns the shifted start offset.
+template <typename DorisOffset, typename JavaOffset>
+static size_t append_java_offsets(PaddedPODArray<DorisOffset>& doris_offsets,
+                                  const JavaOffset* offsets, size_t num_rows) {
+    static_assert(sizeof(DorisOffset) == sizeof(JavaOffset));
+    size_t origin_size = doris_offsets.size();
+    size_t start_offset = doris_offsets[origin_size - 1];
+    doris_offsets.resize(origin_size + num_rows);
+    if (start_offset == 0) {
+        memcpy(doris_offsets.data() + origin_size, offsets, sizeof(JavaOffset) * num_rows);
+    } else {
+        for (size_t i = 0; i < num_rows; ++i) {
+            doris_offsets[origin_size + i] = offsets[i] + start_offset;
+        }
+    }
+    return start_offset;
+}
+
 Status JniConnector::_fill_string_column(TableMetaAddress& address, MutableColumnPtr& doris_column,
                                          size_t num_rows) {
     auto& string_col = static_cast<const ColumnString&>(*doris_column);
@@ -398,12 +418,7 @@ Status JniConnector::_fill_string_column(TableMetaAddress& address, MutableColum
     string_chars.resize(origin_chars_size + offsets[num_rows - 1]);
     memcpy(string_chars.data() + origin_chars_size, chars, offsets[num_rows - 1]);
 
-    size_t origin_offsets_size = string_offsets.size();
-    size_t start_offset = string_offsets[origin_offsets_size - 1];
-    string_offsets.resize(origin_offsets_size + num_rows);
-    for (size_t i = 0; i < num_rows; ++i) {
-        string_offsets[origin_offsets_size + i] = offsets[i] + start_offset;
-    }
+    append_java_offsets(string_offsets, offsets, num_rows);
     return Status::OK();
 }
 
@@ -417,11 +432,7 @@ Status JniConnector::_fill_array_column(TableMetaAddress& address, MutableColumn
 
     int64_t* offsets = reinterpret_cast<int64_t*>(address.next_meta_as_ptr());
     size_t origin_size = offsets_data.size();
-    offsets_data.resize(origin_size + num_rows);
-    size_t start_offset = offsets_data[origin_size - 1];
-    for (size_t i = 0; i < num_rows; ++i) {
-        offsets_data[origin_size + i] = offsets[i] + start_offset;
-    }
+    size_t start_offset = append_java_offsets(offsets_data, offsets, num_rows);
 
     // offsets[num_rows - 1] == offsets_data[origin_size + num_rows - 1] - start_offset
     // but num_row equals 0 when there are all empty arrays
@@ -443,11 +454,7 @@ Status JniConnector::_fill_map_column(TableMetaAddress& address, MutableColumnPt
 
     int64_t* offsets = reinterpret_cast<int64_t*>(address.next_meta_as_ptr());
     size_t origin_size = map_offsets.size();
-    map_offsets.resize(origin_size + num_rows);
-    size_t start_offset = map_offsets[origin_size - 1];
-    for (size_t i = 0; i < num_rows; ++i) {
-        map_offsets[origin_size + i] = offsets[i] + start_offset;
-    }
+    size_t start_offset = append_java_offsets(map_offsets, offsets, num_rows);
 
     RETURN_IF_ERROR(_fill_column(address, key_column, key_type,
                                  map_offsets[origin_size + num_rows - 1] - start_offset));
@@ -38,6 +38,7 @@
 #include "common/logging.h"
 #include "common/status.h"
 #include "exec/rowid_fetcher.h"
+#include "exprs/hybrid_set.h"
 #include "io/cache/block_file_cache_profile.h"
 #include "runtime/descriptors.h"
 #include "runtime/runtime_state.h"
@@ -77,6 +78,7 @@
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
 #include "vec/exprs/vexpr_fwd.h"
+#include "vec/exprs/vliteral.h"
 #include "vec/exprs/vslot_ref.h"
 #include "vec/functions/function.h"
 #include "vec/functions/function_string.h"
@@ -132,6 +134,14 @@ FileScanner::FileScanner(
 
 Status FileScanner::prepare(RuntimeState* state, const VExprContextSPtrs& conjuncts) {
     RETURN_IF_ERROR(Scanner::prepare(state, conjuncts));
+    if (config::enable_late_arrival_runtime_filter_row_group_pruning && _total_rf_num > 0 &&
+        _colname_to_value_range != nullptr) {
+        _late_arrival_colname_to_value_range = *_colname_to_value_range;
+        _colname_to_value_range = &_late_arrival_colname_to_value_range;
+        for (const auto& ctx : _conjuncts) {
+            _pushed_down_conjunct_roots.insert(ctx->root().get());
+        }
+    }
     _get_block_timer =
             ADD_TIMER_WITH_LEVEL(_local_state->scanner_profile(), "FileScannerGetBlockTime", 1);
     _cast_to_input_block_timer = ADD_TIMER_WITH_LEVEL(_local_state->scanner_profile(),
@@ -345,6 +355,95 @@ Status FileScanner::_process_late_arrival_conjuncts() {
     return Status::OK();
 }
 
+// Narrows `range` by the IN or min/max runtime filter `impl` on its column, returns whether
+// `range` is changed. The values are used as they are, so the types needing the conversions of
+// the scan node are skipped.
+template <PrimitiveType T>
+static bool narrow_value_range_by_runtime_filter(ColumnValueRange<T>& range, const VExpr* impl,
+                                                 int max_in_values) {
+    using CppType = typename ColumnValueRange<T>::CppType;
+    if constexpr (T == TYPE_DATE || T == TYPE_DATETIME || T == TYPE_HLL) {
+        return false;
+    } else {
+        if (impl->node_type() == TExprNodeType::IN_PRED) {
+            auto hybrid_set = impl->get_set_func();
+            if (hybrid_set == nullptr || hybrid_set->size() > max_in_values) {
+                return false;
+            }
+            auto temp_range = ColumnValueRange<T>::create_empty_column_value_range(
+                    range.is_nullable_col(), range.precision(), range.scale());
+            auto* iter = hybrid_set->begin();
+            while (iter->has_next()) {
+                static_cast<void>(temp_range.add_fixed_value(
+                        *reinterpret_cast<const CppType*>(iter->get_value())));
+                iter->next();
+            }
+            range.intersection(temp_range);
+            return true;
+        }
+        if (impl->node_type() == TExprNodeType::BINARY_PRED && impl->children().size() == 2 &&
+            impl->children()[1]->is_literal() &&
+            (impl->op() == TExprOpcode::GE || impl->op() == TExprOpcode::LE)) {
+            StringRef value = assert_cast<const VLiteral*>(impl->children()[1].get())
+                                      ->get_column_ptr()
+                                      ->get_data_at(0);
+            if (value.data == nullptr) {
+                return false;
+            }
+            SQLFilterOp op = impl->op() == TExprOpcode::GE ? FILTER_LARGER_OR_EQUAL
+                                                           : FILTER_LESS_OR_EQUAL;
+            if constexpr (is_string_type(T)) {
+                static_cast<void>(range.add_range(op, value));
+            } else {
+                static_cast<void>(
+                        range.add_range(op, *reinterpret_cast<const CppType*>(value.data)));
+            }
+            return true;
+        }
+        return false;
+    }
+}
+
+// Narrows the value ranges by the IN and min/max runtime filters appended to `_conjuncts` since
+// the last call, and lets the current reader skip its unread data by them. The next readers get
+// the narrowed ranges at init. The conjuncts still filter the rows.
+Status FileScanner::_push_down_late_arrival_runtime_filter() {
+    if (_colname_to_value_range != &_late_arrival_colname_to_value_range) {
+        return Status::OK();
+    }
+    bool narrowed = false;
+    for (const auto& ctx : _conjuncts) {
+        const auto& root = ctx->root();
+        if (!_pushed_down_conjunct_roots.insert(root.get()).second || !root->is_rf_wrapper()) {
+            continue;
+        }
+        auto impl = root->get_impl();
+        if (impl == nullptr || impl->children().empty() || !impl->children()[0]->is_slot_ref()) {
+            continue;
+        }
+        const auto* slot_ref = assert_cast<VSlotRef*>(impl->children()[0].get());
+        const auto* slot = _state->desc_tbl().get_slot_descriptor(slot_ref->slot_id());
+        if (slot == nullptr) {
+            continue;
+        }
+        auto iter = _late_arrival_colname_to_value_range.find(slot->col_name());
+        if (iter == _late_arrival_colname_to_value_range.end()) {
+            continue;
+        }
+        std::visit(
+                [&](auto& range) {
+                    narrowed |= narrow_value_range_by_runtime_filter(
+                            range, impl.get(),
+                            _state->query_options().max_pushdown_conditions_per_column);
+                },
+                iter->second);
+    }
+    if (narrowed && _cur_reader != nullptr) {
+        RETURN_IF_ERROR(_cur_reader->filter_by_value_ranges());
+    }
+    return Status::OK();
+}
+
 void FileScanner::_get_slot_ids(VExpr* expr, std::vector<int>* slot_ids) {
     for (auto& child_expr : expr->children()) {
         if (child_expr->is_slot_ref()) {
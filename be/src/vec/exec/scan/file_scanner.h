@@ -111,6 +111,8 @@ protected:
 
     void _collect_profile_before_close() override;
 
+    Status _push_down_late_arrival_runtime_filter() override;
+
     // fe will add skip_bitmap_col to _input_tuple_desc iff the target olaptable has skip_bitmap_col
     // and the current load is a flexible partial update
     bool _should_process_skip_bitmap_col() const { return _skip_bitmap_col_idx != -1; }
@@ -124,6 +126,11 @@ protected:
     std::unique_ptr<GenericReader> _cur_reader;
     bool _cur_reader_eof = false;
     const std::unordered_map<std::string, ColumnValueRangeType>* _colname_to_value_range = nullptr;
+    // A copy of the value ranges of the scan node narrowed by the runtime filters arrived after
+    // the scanner is prepared, `_colname_to_value_range` points to it if there are runtime
+    // filters to wait for. See `_push_down_late_arrival_runtime_filter`.
+    std::unordered_map<std::string, ColumnValueRangeType> _late_arrival_colname_to_value_range;
+    std::unordered_set<const VExpr*> _pushed_down_conjunct_roots;
     // File source slot descriptors
     std::vector<SlotDescriptor*> _file_slot_descs;
     // col names from _file_slot_descs
@@ -38,6 +38,7 @@
 #include "common/consts.h"
 #include "common/logging.h"
 #include "exec/olap_utils.h"
+#include "exprs/create_predicate_function.h"
 #include "exprs/function_filter.h"
 #include "io/cache/block_file_cache_profile.h"
 #include "io/io_common.h"
@@ -45,6 +46,7 @@
 #include "olap/inverted_index_profile.h"
 #include "olap/olap_common.h"
 #include "olap/olap_tuple.h"
+#include "olap/predicate_creator.h"
 #include "olap/rowset/rowset.h"
 #include "olap/rowset/rowset_meta.h"
 #include "olap/schema_cache.h"
@@ -60,10 +62,13 @@
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
+#include "vec/common/assert_cast.h"
 #include "vec/common/schema_util.h"
 #include "vec/core/block.h"
 #include "vec/exec/scan/scan_node.h"
 #include "vec/exprs/vexpr_context.h"
+#include "vec/exprs/vliteral.h"
+#include "vec/exprs/vslot_ref.h"
 #include "vec/json/path_in_data.h"
 #include "vec/olap/block_reader.h"
 
@@ -406,6 +411,18 @@ Status OlapScanner::_init_tablet_reader_params(
         }
     }
 
+    // Runtime filters arriving after this point only reach the tablet reader through
+    // `late_arrival_predicates`, see `_push_down_late_arrival_runtime_filter`.
+    if (config::enable_late_arrival_runtime_filter_zone_map_pruning && _total_rf_num > 0) {
+        _tablet_reader_params.late_arrival_predicates = std::make_shared<LateArrivalPredicates>();
+        for (const auto& ctx : _conjuncts) {
+            _pushed_down_conjunct_roots.insert(ctx->root().get());
+        }
+        for (const auto& ctx : _common_expr_ctxs_push_down) {
+            _pushed_down_conjunct_roots.insert(ctx->root().get());
+        }
+    }
+
     // If this is a Two-Phase read query, and we need to delay the release of Rowset
     // by rowset->update_delayed_expired_timestamp().This could expand the lifespan of Rowset
     if (tablet_schema->field_index(BeConsts::ROWID_COL) >= 0) {
@@ -456,6 +473,71 @@ Status OlapScanner::_init_variant_columns() {
     return Status::OK();
 }
 
+// Converts the IN and min/max runtime filters appended to `_conjuncts` since the last call into
+// column predicates of the tablet schema. They are only used by the segment iterators to prune
+// pages by zone map, the conjuncts still filter the rows, so any filter that can not be
+// converted exactly is simply skipped.
+Status OlapScanner::_push_down_late_arrival_runtime_filter() {
+    auto& late_arrival_predicates = _tablet_reader_params.late_arrival_predicates;
+    if (late_arrival_predicates == nullptr) {
+        return Status::OK();
+    }
+    const auto& tablet_schema = _tablet_reader_params.tablet_schema;
+    std::vector<std::unique_ptr<ColumnPredicate>> predicates;
+    for (const auto& ctx : _conjuncts) {
+        const auto& root = ctx->root();
+        if (!_pushed_down_conjunct_roots.insert(root.get()).second || !root->is_rf_wrapper()) {
+            continue;
+        }
+        auto impl = root->get_impl();
+        if (impl == nullptr || impl->children().empty() || !impl->children()[0]->is_slot_ref()) {
+            continue;
+        }
+        const auto* slot_ref = assert_cast<VSlotRef*>(impl->children()[0].get());
+        const auto* slot = _state->desc_tbl().get_slot_descriptor(slot_ref->slot_id());
+        if (slot == nullptr || slot->type()->get_primitive_type() == TYPE_VARIANT) {
+            continue;
+        }
+        int32_t index = tablet_schema->field_index(slot->col_name());
+        if (index < 0) {
+            continue;
+        }
+        const auto& column = tablet_schema->column(index);
+        // like TabletReader, predicates on value columns of agg/mor tables can not prune rows
+        // before merge
+        if (column.aggregation() != FieldAggregationMethod::OLAP_FIELD_AGGREGATION_NONE) {
+            continue;
+        }
+
+        ColumnPredicate* predicate = nullptr;
+        if (impl->node_type() == TExprNodeType::IN_PRED && impl->get_set_func() != nullptr) {
+            predicate =
+                    create_column_predicate(index, impl->get_set_func(), column.type(), &column);
+        } else if (impl->node_type() == TExprNodeType::BINARY_PRED &&
+                   impl->children().size() == 2 && impl->children()[1]->is_literal()) {
+            // the bound is converted through its string form, keep to the types whose
+            // string form is exact
+            auto type = slot->type()->get_primitive_type();
+            if (!is_int(type) && !is_decimal(type) && !is_date_v2_or_datetime_v2(type)) {
+                continue;
+            }
+            auto value = assert_cast<VLiteral*>(impl->children()[1].get())->value();
+            if (impl->op() == TExprOpcode::GE) {
+                predicate = create_comparison_predicate<PredicateType::GE>(
+                        column, index, value, false, _late_arrival_predicate_arena);
+            } else if (impl->op() == TExprOpcode::LE) {
+                predicate = create_comparison_predicate<PredicateType::LE>(
+                        column, index, value, false, _late_arrival_predicate_arena);
+            }
+        }
+        if (predicate != nullptr) {
+            predicates.emplace_back(predicate);
+        }
+    }
+    late_arrival_predicates->add(std::move(predicates));
+    return Status::OK();
+}
+
 Status OlapScanner::_init_return_columns() {
     for (auto* slot : _output_tuple_desc->slots()) {
         if (!slot->is_materialized()) {
@@ -636,9 +718,14 @@ void OlapScanner::_collect_profile_before_close() {
     COUNTER_UPDATE(local_state->_rows_vec_cond_input_counter, stats.vec_cond_input_rows);
     COUNTER_UPDATE(local_state->_rows_short_circuit_cond_input_counter,
                    stats.short_circuit_cond_input_rows);
+    COUNTER_UPDATE(local_state->_staged_pred_column_read_rows_counter,
+                   stats.staged_pred_column_read_rows);
+    COUNTER_UPDATE(local_state->_staged_pred_column_skipped_rows_counter,
+                   stats.staged_pred_column_skipped_rows);
     COUNTER_UPDATE(local_state->_rows_expr_cond_input_counter, stats.expr_cond_input_rows);
     COUNTER_UPDATE(local_state->_stats_filtered_counter, stats.rows_stats_filtered);
     COUNTER_UPDATE(local_state->_stats_rp_filtered_counter, stats.rows_stats_rp_filtered);
+    COUNTER_UPDATE(local_state->_stats_late_rf_filtered_counter, stats.rows_stats_late_rf_filtered);
     COUNTER_UPDATE(local_state->_dict_filtered_counter, stats.rows_dict_filtered);
     COUNTER_UPDATE(local_state->_bf_filtered_counter, stats.rows_bf_filtered);
     COUNTER_UPDATE(local_state->_del_filtered_counter, stats.rows_del_filtered);
@@ -646,8 +733,15 @@ void OlapScanner::_collect_profile_before_close() {
     COUNTER_UPDATE(local_state->_del_filtered_counter, stats.rows_vec_del_cond_filtered);
     COUNTER_UPDATE(local_state->_conditions_filtered_counter, stats.rows_conditions_filtered);
     COUNTER_UPDATE(local_state->_key_range_filtered_counter, stats.rows_key_range_filtered);
+    COUNTER_UPDATE(local_state->_sample_filtered_counter, stats.rows_sample_filtered);
     COUNTER_UPDATE(local_state->_total_pages_num_counter, stats.total_pages_num);
     COUNTER_UPDATE(local_state->_cached_pages_num_counter, stats.cached_pages_num);
+    COUNTER_UPDATE(local_state->_decoded_dict_page_cache_hit_counter,
+                   stats.decoded_dict_page_cache_hit);
+    COUNTER_UPDATE(local_state->_remote_page_prefetch_ranges_counter,
+                   stats.remote_page_prefetch_ranges);
+    COUNTER_UPDATE(local_state->_remote_page_prefetch_bytes_counter,
+                   stats.remote_page_prefetch_bytes);
     COUNTER_UPDATE(local_state->_bitmap_index_filter_counter, stats.rows_bitmap_index_filtered);
     COUNTER_UPDATE(local_state->_bitmap_index_filter_timer, stats.bitmap_index_filter_timer);
     COUNTER_UPDATE(local_state->_inverted_index_filter_counter, stats.rows_inverted_index_filtered);
@@ -738,6 +832,9 @@ void OlapScanner::_collect_profile_before_close() {
     tablet->query_scan_bytes->increment(local_state->_read_uncompressed_counter->value());
     tablet->query_scan_rows->increment(local_state->_scan_rows->value());
     tablet->query_scan_count->increment(1);
+    tablet->scan_count_since_compaction.fetch_add(1, std::memory_order_relaxed);
+    tablet->merged_rows_since_compaction.fetch_add(
+            _tablet_reader->merged_rows() + stats.rows_del_by_bitmap, std::memory_order_relaxed);
 }
 
 } // namespace doris::vectorized
@@ -82,6 +82,7 @@ public:
 protected:
     Status _get_block_impl(RuntimeState* state, Block* block, bool* eos) override;
     void _collect_profile_before_close() override;
+    Status _push_down_late_arrival_runtime_filter() override;
 
 private:
     Status _init_tablet_reader_params(const std::vector<OlapScanRange*>& key_ranges,
@@ -94,6 +95,12 @@ private:
 
     std::vector<OlapScanRange*> _key_ranges;
 
+    // Must outlive the predicates in `_tablet_reader_params.late_arrival_predicates`.
+    Arena _late_arrival_predicate_arena;
+    // Roots of the conjuncts that the tablet reader already knows about, runtime filters
+    // not in it are converted into `late_arrival_predicates` when they arrive.
+    std::unordered_set<const VExpr*> _pushed_down_conjunct_roots;
+
     TabletReader::ReaderParams _tablet_reader_params;
     std::unique_ptr<TabletReader> _tablet_reader;
 
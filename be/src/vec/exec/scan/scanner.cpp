@@ -19,6 +19,7 @@
 
 #include <glog/logging.h>
 
+#include "common/cast_set.h"
 #include "common/config.h"
 #include "pipeline/exec/scan_operator.h"
 #include "runtime/descriptors.h"
@@ -49,6 +50,8 @@ Status Scanner::prepare(RuntimeState* state, const VExprContextSPtrs& conjuncts)
         }
     }
 
+    _total_rf_num = cast_set<int>(_local_state->_helper.runtime_filter_nums());
+
     const auto& projections = _local_state->_projections;
     if (!projections.empty()) {
         _projections.resize(projections.size());
@@ -228,7 +231,7 @@ Status Scanner::try_append_late_arrival_runtime_filter() {
     // But it is ok because it will be updated at next time.
     RETURN_IF_ERROR(_local_state->clone_conjunct_ctxs(_conjuncts));
     _applied_rf_num = arrived_rf_num;
-    return Status::OK();
+    return _push_down_late_arrival_runtime_filter();
 }
 
 Status Scanner::close(RuntimeState* state) {
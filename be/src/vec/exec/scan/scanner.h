@@ -103,6 +103,10 @@ protected:
     // Update the counters before closing this scanner
     virtual void _collect_profile_before_close();
 
+    // Called after late arrival runtime filters are appended to `_conjuncts`, so that the
+    // scanner can also hand them to its storage layer.
+    virtual Status _push_down_late_arrival_runtime_filter() { return Status::OK(); }
+
     // Filter the output block finally.
     Status _filter_output_block(Block* block);
 
@@ -19,7 +19,11 @@
 
 #include <atomic>
 #include <cstdint>
+#include <deque>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <utility>
 
 #include "common/be_mock_util.h"
 #include "common/status.h"
@@ -120,16 +124,11 @@ public:
                                 .set_max_queue_size(queue_size)
                                 .set_cgroup_cpu_ctl(_cgroup_cpu_ctl)
                                 .build(&_scan_thread_pool));
+        _max_queue_size = queue_size;
         return Status::OK();
     }
 
-    Status submit_scan_task(SimplifiedScanTask scan_task) {
-        if (!_is_stop) {
-            return _scan_thread_pool->submit_func([scan_task] { scan_task.scan_func(); });
-        } else {
-            return Status::InternalError<false>("scanner pool {} is shutdown.", _sched_name);
-        }
-    }
+    Status submit_scan_task(SimplifiedScanTask scan_task);
 
     void reset_thread_num(int new_max_thread_num, int new_min_thread_num) {
         int cur_max_thread_num = _scan_thread_pool->max_threads();
@@ -184,7 +183,10 @@ public:
         }
     }
 
-    MOCK_FUNCTION int get_queue_size() { return _scan_thread_pool->get_queue_size(); }
+    MOCK_FUNCTION int get_queue_size() {
+        return _scan_thread_pool->get_queue_size() +
+               _fair_queued_tasks.load(std::memory_order_relaxed);
+    }
 
     MOCK_FUNCTION int get_active_threads() { return _scan_thread_pool->num_active_threads(); }
 
@@ -197,8 +199,27 @@ public:
                                             std::unique_lock<std::mutex>& transfer_lock);
 
 private:
+    // Body of the pool threads that serve `_fair_queues`, runs until no task waits.
+    void _run_fair_scan_tasks();
+
     std::unique_ptr<ThreadPool> _scan_thread_pool;
     std::atomic<bool> _is_stop;
+    int _max_queue_size = 0;
+
+    // With `enable_fair_scan_task_dispatch`, submitted tasks wait here per query instead of in
+    // the pool's FIFO queue, and up to max_threads pool threads take them one query after
+    // another, so a query with thousands of queued scan tasks cannot hold back a small one.
+    using QueryKey = std::pair<int64_t, int64_t>;
+    struct FairScanTask {
+        uint64_t seq;
+        SimplifiedScanTask task;
+    };
+    std::mutex _fair_lock;
+    std::map<QueryKey, std::deque<FairScanTask>> _fair_queues;
+    QueryKey _last_served_query {};
+    uint64_t _next_fair_seq = 0;
+    int _num_fair_dispatchers = 0;
+    std::atomic<int> _fair_queued_tasks = 0;
     std::weak_ptr<CgroupCpuCtl> _cgroup_cpu_ctl;
     std::string _sched_name;
     std::string _workload_group;
@@ -17,6 +17,7 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "scanner_scheduler.h"
 #include "vec/exec/scan/scanner_context.h"
 
@@ -24,6 +25,91 @@ namespace doris::vectorized {
 class ScannerDelegate;
 class ScanTask;
 
+Status SimplifiedScanScheduler::submit_scan_task(SimplifiedScanTask scan_task) {
+    if (_is_stop) {
+        return Status::InternalError<false>("scanner pool {} is shutdown.", _sched_name);
+    }
+    if (!config::enable_fair_scan_task_dispatch) {
+        return _scan_thread_pool->submit_func([scan_task] { scan_task.scan_func(); });
+    }
+
+    QueryKey key {};
+    if (scan_task.scanner_context) {
+        key = {scan_task.scanner_context->_query_id.hi, scan_task.scanner_context->_query_id.lo};
+    }
+    uint64_t seq = 0;
+    bool spawn_dispatcher = false;
+    {
+        std::lock_guard<std::mutex> l(_fair_lock);
+        if (_fair_queued_tasks.load(std::memory_order_relaxed) >= _max_queue_size) {
+            return Status::Error<ErrorCode::SERVICE_UNAVAILABLE>(
+                    "scanner pool {} is at capacity ({} tasks queued)", _sched_name,
+                    _max_queue_size);
+        }
+        seq = _next_fair_seq++;
+        _fair_queues[key].push_back({seq, std::move(scan_task)});
+        _fair_queued_tasks.fetch_add(1, std::memory_order_relaxed);
+        if (_num_fair_dispatchers < _scan_thread_pool->max_threads()) {
+            ++_num_fair_dispatchers;
+            spawn_dispatcher = true;
+        }
+    }
+    if (!spawn_dispatcher) {
+        return Status::OK();
+    }
+
+    auto st = _scan_thread_pool->submit_func([this] { _run_fair_scan_tasks(); });
+    if (!st.ok()) {
+        std::lock_guard<std::mutex> l(_fair_lock);
+        // The running dispatchers will still get to the task; only when there is none left
+        // does it have to be withdrawn so the caller can fail it.
+        if (--_num_fair_dispatchers > 0) {
+            return Status::OK();
+        }
+        auto it = _fair_queues.find(key);
+        if (it != _fair_queues.end()) {
+            auto& tasks = it->second;
+            for (auto task_it = tasks.begin(); task_it != tasks.end(); ++task_it) {
+                if (task_it->seq == seq) {
+                    tasks.erase(task_it);
+                    _fair_queued_tasks.fetch_sub(1, std::memory_order_relaxed);
+                    break;
+                }
+            }
+            if (tasks.empty()) {
+                _fair_queues.erase(it);
+            }
+        }
+    }
+    return st;
+}
+
+void SimplifiedScanScheduler::_run_fair_scan_tasks() {
+    while (true) {
+        SimplifiedScanTask scan_task;
+        {
+            std::lock_guard<std::mutex> l(_fair_lock);
+            if (_fair_queues.empty() || _is_stop) {
+                --_num_fair_dispatchers;
+                return;
+            }
+            // Serve the query after the one served last, wrapping around.
+            auto it = _fair_queues.upper_bound(_last_served_query);
+            if (it == _fair_queues.end()) {
+                it = _fair_queues.begin();
+            }
+            _last_served_query = it->first;
+            scan_task = std::move(it->second.front().task);
+            it->second.pop_front();
+            if (it->second.empty()) {
+                _fair_queues.erase(it);
+            }
+            _fair_queued_tasks.fetch_sub(1, std::memory_order_relaxed);
+        }
+        scan_task.scan_func();
+    }
+}
+
 Status SimplifiedScanScheduler::schedule_scan_task(std::shared_ptr<ScannerContext> scanner_ctx,
                                                    std::shared_ptr<ScanTask> current_scan_task,
                                                    std::unique_lock<std::mutex>& transfer_lock) {
@@ -20,7 +20,10 @@
 #include <fmt/core.h>
 
 #include <cstddef>
+#include <cstdint>
+#include <vector>
 
+#include "common/exception.h"
 #include "common/status.h"
 #include "vec/core/block.h"
 #include "vec/exprs/vexpr_context.h"
@@ -58,6 +61,18 @@ public:
     virtual void get_same_many_values(MutableColumnPtr& column, int length = 0) = 0;
     virtual int get_value(MutableColumnPtr& column, int max_step) = 0;
 
+    // Whether get_value_batch is supported, it is only used when this is the only function.
+    virtual bool support_get_value_batch() const { return false; }
+    // Batch version of get_value. Outputs at most `max_step` results from the current position
+    // of row `row_idx` on, moving on to the next rows of the block when the results of a row are
+    // exhausted, and appends the child row of every result to `row_indices`. Returns the row to
+    // continue from, which is `num_rows` when all the rows of the block are done.
+    virtual int64_t get_value_batch(MutableColumnPtr& column, int64_t row_idx, int64_t num_rows,
+                                    int max_step, std::vector<uint32_t>& row_indices) {
+        throw doris::Exception(ErrorCode::NOT_IMPLEMENTED_ERROR,
+                               "get_value_batch is not supported by {}", _fn_name);
+    }
+
     virtual Status close() { return Status::OK(); }
 
     virtual void forward(int step = 1) {
@@ -21,6 +21,7 @@
 
 #include <ostream>
 
+#include "common/cast_set.h"
 #include "common/status.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_array.h"
@@ -132,23 +133,71 @@ int VExplodeTableFunction::get_value(MutableColumnPtr& column, int max_step) {
         column->insert_default();
         max_step = 1;
     } else {
-        if (_is_nullable) {
-            auto* nullable_column = assert_cast<ColumnNullable*>(column.get());
-            auto nested_column = nullable_column->get_nested_column_ptr();
-            auto* nullmap_column =
-                    assert_cast<ColumnUInt8*>(nullable_column->get_null_map_column_ptr().get());
-            nested_column->insert_range_from(*_detail.nested_col, pos, max_step);
-            size_t old_size = nullmap_column->size();
-            nullmap_column->resize(old_size + max_step);
-            memcpy(nullmap_column->get_data().data() + old_size,
-                   _detail.nested_nullmap_data + pos * sizeof(UInt8), max_step * sizeof(UInt8));
-        } else {
-            column->insert_range_from(*_detail.nested_col, pos, max_step);
-        }
+        _insert_values(column, pos, max_step);
     }
     forward(max_step);
     return max_step;
 }
 
+int64_t VExplodeTableFunction::get_value_batch(MutableColumnPtr& column, int64_t row_idx,
+                                               int64_t num_rows, int max_step,
+                                               std::vector<uint32_t>& row_indices) {
+    // The elements of consecutive rows are consecutive in the nested column, so the results
+    // of many rows are usually inserted by one range.
+    size_t range_begin = 0;
+    size_t range_length = 0;
+    int step = 0;
+    while (step < max_step && row_idx < num_rows) {
+        if (current_empty()) {
+            if (_is_outer) {
+                _insert_values(column, range_begin, range_length);
+                range_length = 0;
+                column->insert_default();
+                row_indices.push_back(cast_set<uint32_t>(row_idx));
+                ++step;
+            }
+        } else {
+            auto length = std::min<int64_t>(max_step - step, _cur_size - _cur_offset);
+            size_t pos = _array_offset + _cur_offset;
+            if (range_begin + range_length != pos) {
+                _insert_values(column, range_begin, range_length);
+                range_begin = pos;
+                range_length = 0;
+            }
+            range_length += length;
+            row_indices.resize(row_indices.size() + length, cast_set<uint32_t>(row_idx));
+            _cur_offset += length;
+            step += cast_set<int>(length);
+            if (_cur_offset < _cur_size) {
+                break;
+            }
+        }
+        if (++row_idx < num_rows) {
+            process_row(row_idx);
+        }
+    }
+    _insert_values(column, range_begin, range_length);
+    return row_idx;
+}
+
+void VExplodeTableFunction::_insert_values(MutableColumnPtr& column, size_t pos, size_t length) {
+    if (length == 0) {
+        return;
+    }
+    if (_is_nullable) {
+        auto* nullable_column = assert_cast<ColumnNullable*>(column.get());
+        auto nested_column = nullable_column->get_nested_column_ptr();
+        auto* nullmap_column =
+                assert_cast<ColumnUInt8*>(nullable_column->get_null_map_column_ptr().get());
+        nested_column->insert_range_from(*_detail.nested_col, pos, length);
+        size_t old_size = nullmap_column->size();
+        nullmap_column->resize(old_size + length);
+        memcpy(nullmap_column->get_data().data() + old_size,
+               _detail.nested_nullmap_data + pos * sizeof(UInt8), length * sizeof(UInt8));
+    } else {
+        column->insert_range_from(*_detail.nested_col, pos, length);
+    }
+}
+
 #include "common/compile_check_end.h"
 } // namespace doris::vectorized
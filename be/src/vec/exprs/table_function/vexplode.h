@@ -45,9 +45,14 @@ public:
     void process_close() override;
     void get_same_many_values(MutableColumnPtr& column, int length) override;
     int get_value(MutableColumnPtr& column, int max_step) override;
+    bool support_get_value_batch() const override { return true; }
+    int64_t get_value_batch(MutableColumnPtr& column, int64_t row_idx, int64_t num_rows,
+                            int max_step, std::vector<uint32_t>& row_indices) override;
 
 private:
     Status _process_init_variant(Block* block, int value_column_idx);
+    // inserts the elements [pos, pos + length) of the nested column
+    void _insert_values(MutableColumnPtr& column, size_t pos, size_t length);
     ColumnPtr _array_column;
     ColumnArrayExecutionData _detail;
     size_t _array_offset; // start offset of array[row_idx]
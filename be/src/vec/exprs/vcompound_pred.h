@@ -16,18 +16,26 @@
 // under the License.
 
 #pragma once
+#include <fmt/format.h>
+#include <fmt/ranges.h> // IWYU pragma: keep
 #include <gen_cpp/Opcodes_types.h>
 
 #include <algorithm>
 #include <cstdint>
+#include <string>
+#include <vector>
 
+#include "common/config.h"
 #include "common/status.h"
+#include "olap/rowset/segment_v2/inverted_index_cache.h"
+#include "olap/rowset/segment_v2/inverted_index_query_type.h"
 #include "util/simd/bits.h"
 #include "vec/columns/column.h"
 #include "vec/common/assert_cast.h"
 #include "vec/exprs/vectorized_fn_call.h"
 #include "vec/exprs/vexpr_context.h"
 #include "vec/exprs/vexpr_fwd.h"
+#include "vec/exprs/vslot_ref.h"
 
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
@@ -56,6 +64,13 @@ public:
     const std::string& expr_name() const override { return _expr_name; }
 
     Status evaluate_inverted_index(VExprContext* context, uint32_t segment_num_rows) override {
+        std::string cache_key;
+        bool use_cache = config::enable_inverted_index_compound_query_cache &&
+                         get_inverted_index_cache_key(context, &cache_key);
+        if (use_cache && _lookup_inverted_index_cache(context, cache_key)) {
+            return Status::OK();
+        }
+
         segment_v2::InvertedIndexResultBitmap res;
         bool all_pass = true;
 
@@ -145,11 +160,35 @@ public:
         }
 
         if (all_pass && !res.is_empty()) {
+            if (use_cache) {
+                _insert_inverted_index_cache(cache_key, res);
+            }
             context->get_inverted_index_context()->set_inverted_index_result_for_expr(this, res);
         }
         return Status::OK();
     }
 
+    // The key is built from the keys of the children, so a compound predicate is only cached when
+    // all of its leaves are. The children of AND and OR are sorted, so that the same predicates
+    // written in another order share the entry.
+    bool get_inverted_index_cache_key(VExprContext* context, std::string* key) const override {
+        std::vector<std::string> child_keys;
+        child_keys.reserve(_children.size());
+        for (const auto& child : _children) {
+            std::string child_key;
+            if (!child->get_inverted_index_cache_key(context, &child_key)) {
+                return false;
+            }
+            child_keys.emplace_back(std::move(child_key));
+        }
+        if (_op != TExprOpcode::COMPOUND_NOT) {
+            std::sort(child_keys.begin(), child_keys.end());
+            child_keys.erase(std::unique(child_keys.begin(), child_keys.end()), child_keys.end());
+        }
+        *key = fmt::format("{}({})", compound_operator_to_string(_op), fmt::join(child_keys, ","));
+        return true;
+    }
+
     Status execute(VExprContext* context, Block* block, int* result_column_id) override {
         if (fast_execute(context, block, result_column_id)) {
             return Status::OK();
@@ -382,6 +421,65 @@ private:
         return (l_null & r_null) | (r_null & (r_null ^ a)) | (l_null & (l_null ^ b));
     }
 
+    static segment_v2::InvertedIndexQueryCache::CacheKey _inverted_index_cache_key(
+            const std::string& key, const std::string& bitmap_name) {
+        return {"", "", segment_v2::InvertedIndexQueryType::COMPOUND_QUERY,
+                key + "/" + bitmap_name};
+    }
+
+    // Mark the columns of all the leaves as evaluated by the index, as if the children had been
+    // evaluated one by one.
+    static void _set_inverted_index_status(VExprContext* context, const VExpr* expr) {
+        for (const auto& child : expr->children()) {
+            if (child->is_compound_predicate()) {
+                _set_inverted_index_status(context, child.get());
+                continue;
+            }
+            for (const auto& arg : child->children()) {
+                if (arg->is_slot_ref()) {
+                    context->get_inverted_index_context()->set_true_for_inverted_index_status(
+                            child.get(), assert_cast<VSlotRef*>(arg.get())->column_id());
+                }
+            }
+        }
+    }
+
+    bool _lookup_inverted_index_cache(VExprContext* context, const std::string& key) {
+        auto* cache = segment_v2::InvertedIndexQueryCache::instance();
+        if (cache == nullptr) {
+            return false;
+        }
+        segment_v2::InvertedIndexQueryCacheHandle data_handle;
+        segment_v2::InvertedIndexQueryCacheHandle null_handle;
+        if (!cache->lookup(_inverted_index_cache_key(key, "data"), &data_handle) ||
+            !cache->lookup(_inverted_index_cache_key(key, "null"), &null_handle)) {
+            return false;
+        }
+        // the parents combine the results in place, so they must not share the cached bitmaps
+        context->get_inverted_index_context()->set_inverted_index_result_for_expr(
+                this, segment_v2::InvertedIndexResultBitmap(
+                              std::make_shared<roaring::Roaring>(*data_handle.get_bitmap()),
+                              std::make_shared<roaring::Roaring>(*null_handle.get_bitmap())));
+        _set_inverted_index_status(context, this);
+        return true;
+    }
+
+    static void _insert_inverted_index_cache(const std::string& key,
+                                             const segment_v2::InvertedIndexResultBitmap& res) {
+        auto* cache = segment_v2::InvertedIndexQueryCache::instance();
+        if (cache == nullptr || !res.get_data_bitmap() || !res.get_null_bitmap()) {
+            return;
+        }
+        segment_v2::InvertedIndexQueryCacheHandle data_handle;
+        segment_v2::InvertedIndexQueryCacheHandle null_handle;
+        auto data_bitmap = std::make_shared<roaring::Roaring>(*res.get_data_bitmap());
+        auto null_bitmap = std::make_shared<roaring::Roaring>(*res.get_null_bitmap());
+        data_bitmap->runOptimize();
+        null_bitmap->runOptimize();
+        cache->insert(_inverted_index_cache_key(key, "data"), data_bitmap, &data_handle);
+        cache->insert(_inverted_index_cache_key(key, "null"), null_bitmap, &null_handle);
+    }
+
     bool _has_const_child() const {
         return std::ranges::any_of(_children,
                                    [](const VExprSPtr& arg) -> bool { return arg->is_constant(); });
@@ -233,7 +233,18 @@ Status VectorizedFnCall::execute_runtime_filter(doris::vectorized::VExprContext*
 Status VectorizedFnCall::execute(VExprContext* context, vectorized::Block* block,
                                  int* result_column_id) {
     ColumnNumbers arguments;
-    return _do_execute(context, block, result_column_id, arguments);
+    const size_t origin_columns = block->columns();
+    RETURN_IF_ERROR(_do_execute(context, block, result_column_id, arguments));
+    // Intermediate results of the children are only read by this node, release them now so a
+    // deep expression tree keeps about one column per level alive instead of every column it
+    // has ever computed until the whole tree finishes.
+    for (auto arg : arguments) {
+        auto& column = block->get_by_position(arg).column;
+        if (arg >= origin_columns && column != nullptr) {
+            column = column->clone_empty();
+        }
+    }
+    return Status::OK();
 }
 
 const std::string& VectorizedFnCall::expr_name() const {
@@ -280,6 +291,9 @@ bool VectorizedFnCall::equals(const VExpr& other) {
     if (this->_function_name != other_ptr->_function_name) {
         return false;
     }
+    if (!this->_data_type->equals(*other_ptr->_data_type)) {
+        return false;
+    }
     if (get_num_children() != other_ptr->get_num_children()) {
         return false;
     }
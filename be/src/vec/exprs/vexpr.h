@@ -127,6 +127,12 @@ public:
         return Status::OK();
     }
 
+    // build a key which identifies the result of evaluate_inverted_index on the current segment,
+    // so that the result can be cached across queries. return false if the expr can not be keyed
+    virtual bool get_inverted_index_cache_key(VExprContext* context, std::string* key) const {
+        return false;
+    }
+
     Status _evaluate_inverted_index(VExprContext* context, const FunctionBasePtr& function,
                                     uint32_t segment_num_rows);
 
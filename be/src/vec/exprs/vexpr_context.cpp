@@ -161,8 +161,49 @@ Status VExprContext::filter_block(const VExprContextSPtrs& expr_contexts, Block*
     ColumnNumbers columns_to_filter(column_to_keep);
     std::iota(columns_to_filter.begin(), columns_to_filter.end(), 0);
 
-    return execute_conjuncts_and_filter_block(expr_contexts, block, columns_to_filter,
-                                              static_cast<int>(column_to_keep));
+    if (expr_contexts.size() == 1) {
+        return execute_conjuncts_and_filter_block(expr_contexts, block, columns_to_filter,
+                                                  static_cast<int>(column_to_keep));
+    }
+
+    // Conjuncts are evaluated one by one. Once the selected rows drop to a small fraction of the
+    // block, the block is compacted right away so that the remaining conjuncts only compute the
+    // surviving rows instead of the whole block.
+    static constexpr size_t EARLY_FILTER_RATIO = 8;
+    _reset_memory_usage(expr_contexts);
+    IColumn::Filter result_filter(block->rows(), 1);
+    expr_contexts[0]->_memory_usage += result_filter.allocated_bytes();
+    for (size_t i = 0; i < expr_contexts.size(); ++i) {
+        bool can_filter_all = false;
+        RETURN_IF_ERROR(execute_conjuncts({expr_contexts[i]}, nullptr, false, block,
+                                          &result_filter, &can_filter_all));
+        if (can_filter_all) {
+            for (auto& col : columns_to_filter) {
+                // NOLINTNEXTLINE(performance-move-const-arg)
+                std::move(*block->get_by_position(col).column).assume_mutable()->clear();
+            }
+            break;
+        }
+
+        const size_t rows = block->rows();
+        const bool is_last = i + 1 == expr_contexts.size();
+        if (!is_last) {
+            const size_t selected_rows =
+                    rows - simd::count_zero_num((int8_t*)result_filter.data(), rows);
+            if (selected_rows * EARLY_FILTER_RATIO > rows) {
+                continue;
+            }
+        }
+        RETURN_IF_CATCH_EXCEPTION(
+                Block::filter_block_internal(block, columns_to_filter, result_filter));
+        Block::erase_useless_column(block, column_to_keep);
+        if (!is_last) {
+            result_filter.resize(block->rows());
+            memset(result_filter.data(), 1, result_filter.size());
+        }
+    }
+    Block::erase_useless_column(block, column_to_keep);
+    return Status::OK();
 }
 
 Status VExprContext::execute_conjuncts(const VExprContextSPtrs& ctxs,
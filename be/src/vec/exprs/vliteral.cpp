@@ -79,15 +79,17 @@ bool VLiteral::equals(const VExpr& other) {
     if (this->_expr_name != other_ptr->_expr_name) {
         return false;
     }
-    if (this->_column_ptr->structure_equals(*other_ptr->_column_ptr)) {
-        if (this->_column_ptr->size() != other_ptr->_column_ptr->size()) {
+    if (!this->_data_type->equals(*other_ptr->_data_type) ||
+        !this->_column_ptr->structure_equals(*other_ptr->_column_ptr)) {
+        return false;
+    }
+    if (this->_column_ptr->size() != other_ptr->_column_ptr->size()) {
+        return false;
+    }
+    for (size_t i = 0; i < this->_column_ptr->size(); i++) {
+        if (this->_column_ptr->compare_at(i, i, *other_ptr->_column_ptr, -1) != 0) {
             return false;
         }
-        for (size_t i = 0; i < this->_column_ptr->size(); i++) {
-            if (this->_column_ptr->compare_at(i, i, *other_ptr->_column_ptr, -1) != 0) {
-                return false;
-            }
-        }
     }
     return true;
 }
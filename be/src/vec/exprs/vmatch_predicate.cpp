@@ -43,6 +43,7 @@
 #include "vec/core/column_numbers.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/exprs/vexpr_context.h"
+#include "vec/exprs/vliteral.h"
 #include "vec/exprs/vslot_ref.h"
 #include "vec/functions/simple_function_factory.h"
 
@@ -135,6 +136,35 @@ Status VMatchPredicate::evaluate_inverted_index(VExprContext* context, uint32_t
     return _evaluate_inverted_index(context, _function, segment_num_rows);
 }
 
+bool VMatchPredicate::get_inverted_index_cache_key(VExprContext* context, std::string* key) const {
+    if (get_num_children() != 2 || !get_child(0)->is_slot_ref() || !get_child(1)->is_literal()) {
+        return false;
+    }
+    auto index_context = context->get_inverted_index_context();
+    auto column_id = assert_cast<VSlotRef*>(get_child(0).get())->column_id();
+    auto* iter = index_context->get_inverted_index_iterator_by_column_id(column_id);
+    const auto* storage_name_type =
+            index_context->get_storage_name_and_type_by_column_id(column_id);
+    if (iter == nullptr || storage_name_type == nullptr || iter->type() != IndexType::INVERTED) {
+        return false;
+    }
+    auto reader = std::static_pointer_cast<InvertedIndexReader>(iter->get_reader());
+    if (reader == nullptr) {
+        return false;
+    }
+    // the index file key scopes the entry to the segment, the analyzer properties and the
+    // query string decide which rows match
+    auto query_str = assert_cast<VLiteral*>(get_child(1).get())->value();
+    *key = fmt::format("{}({}/{},{},{},{},{},{},{},{}:{})", _function_name,
+                       reader->get_index_file_cache_key(), storage_name_type->first,
+                       _inverted_index_ctx->custom_analyzer,
+                       inverted_index_parser_type_to_string(_inverted_index_ctx->parser_type),
+                       _inverted_index_ctx->parser_mode, _inverted_index_ctx->lower_case,
+                       _inverted_index_ctx->stop_words, _inverted_index_ctx->char_filter_map,
+                       query_str.size(), query_str);
+    return true;
+}
+
 Status VMatchPredicate::execute(VExprContext* context, Block* block, int* result_column_id) {
     DCHECK(_open_finished || _getting_const_col);
     if (fast_execute(context, block, result_column_id)) {
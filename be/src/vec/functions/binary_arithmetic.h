@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "runtime/decimalv2_value.h"
 #include "runtime/primitive_type.h"
 #include "vec/columns/column_decimal.h"
@@ -159,6 +161,12 @@ struct PlusMinusDecimalImpl {
 
         const auto& a = column_left_ptr->get_data();
         auto& c = column_result->get_data();
+        if (check_overflow_for_decimal &&
+            (is_overflow_impossible(type_left, type_right, res_data_type) ||
+             is_block_overflow_impossible<ResultType>(a.data(), a.size(), &b, 1,
+                                                      max_result_number))) {
+            check_overflow_for_decimal = false;
+        }
         std::visit(
                 [&](auto check_overflow_for_decimal) {
                     for (size_t i = 0; i < column_left->size(); ++i) {
@@ -186,6 +194,12 @@ struct PlusMinusDecimalImpl {
 
         auto& b = column_right_ptr->get_data();
         auto& c = column_result->get_data();
+        if (check_overflow_for_decimal &&
+            (is_overflow_impossible(type_left, type_right, res_data_type) ||
+             is_block_overflow_impossible<ResultType>(&a, 1, b.data(), b.size(),
+                                                      max_result_number))) {
+            check_overflow_for_decimal = false;
+        }
         std::visit(
                 [&](auto check_overflow_for_decimal) {
                     for (size_t i = 0; i < column_right->size(); ++i) {
@@ -271,6 +285,11 @@ struct PlusMinusDecimalImpl {
         const auto& a = column_left_ptr->get_data().data();
         const auto& b = column_right_ptr->get_data().data();
         const auto& c = column_result->get_data().data();
+        if (check_overflow_for_decimal &&
+            (is_overflow_impossible(type_left, type_right, res_data_type) ||
+             is_block_overflow_impossible<ResultType>(a, sz, b, sz, max_result_number))) {
+            check_overflow_for_decimal = false;
+        }
         std::visit(
                 [&](auto check_overflow_for_decimal) {
                     for (size_t i = 0; i < sz; i++) {
@@ -333,6 +352,44 @@ struct PlusMinusDecimalImpl {
         }
     }
 
+    // Both sides are already in the result scale, so the sum of two values has at most one more
+    // digit than the wider side.
+    template <PrimitiveType ResultType>
+    static bool is_overflow_impossible(const DataTypeA* type_left, const DataTypeB* type_right,
+                                       const DataTypeDecimal<ResultType>& res_data_type) {
+        if constexpr (ResultType == TYPE_DECIMALV2) {
+            return false;
+        } else {
+            return std::max(type_left->get_precision(), type_right->get_precision()) + 1 <=
+                   res_data_type.get_precision();
+        }
+    }
+
+    template <typename T>
+    static wide::Int256 max_abs(const T* data, size_t size) {
+        typename T::NativeType max_value = 0;
+        typename T::NativeType min_value = 0;
+        for (size_t i = 0; i < size; ++i) {
+            max_value = std::max(max_value, data[i].value);
+            min_value = std::min(min_value, data[i].value);
+        }
+        return std::max(wide::Int256(max_value), -wide::Int256(min_value));
+    }
+
+    // When the precisions allow overflow, the largest magnitudes in this block may still not.
+    template <PrimitiveType ResultType>
+    static bool is_block_overflow_impossible(
+            const ArgA* a, size_t a_size, const ArgB* b, size_t b_size,
+            const typename PrimitiveTypeTraits<ResultType>::ColumnItemType& max_result_number) {
+        if constexpr (ResultType == TYPE_DECIMALV2) {
+            return false;
+        } else {
+            // decimal values are below 10^76, the sum of two magnitudes still fits Int256
+            return max_abs(a, a_size) + max_abs(b, b_size) <=
+                   wide::Int256(max_result_number.value);
+        }
+    }
+
     template <PrimitiveType PT>
     static std::pair<typename PrimitiveTypeTraits<PT>::ColumnItemType,
                      typename PrimitiveTypeTraits<PT>::ColumnItemType>
@@ -17,10 +17,15 @@
 
 #include "vec/functions/complex_hash_map_dictionary.h" // for ComplexHashMapDictionary
 
+#include <algorithm>
+#include <limits>
 #include <type_traits>
 #include <vector>
 
 #include "common/status.h"
+#include "runtime/primitive_type.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
 #include "vec/functions/dictionary.h"
 
 namespace doris::vectorized {
@@ -30,6 +35,7 @@ ComplexHashMapDictionary::~ComplexHashMapDictionary() {
         SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(_mem_tracker);
         _hash_map_method.method_variant.emplace<std::monostate>();
         ColumnPtrs {}.swap(_key_columns);
+        PaddedPODArray<UInt32> {}.swap(_dense_rows);
     }
 }
 
@@ -44,10 +50,114 @@ size_t ComplexHashMapDictionary::allocated_bytes() const {
     for (const auto& column : _key_columns) {
         bytes += column->allocated_bytes();
     }
-    return bytes + IDictionary::allocated_bytes();
+    return bytes + _dense_rows.allocated_bytes() + IDictionary::allocated_bytes();
 }
+
+bool ComplexHashMapDictionary::try_load_dense_keys(const ColumnPtrs& key_columns,
+                                                   const DataTypes& key_types) {
+    if (key_columns.size() != 1) {
+        return false;
+    }
+    switch (key_types[0]->get_primitive_type()) {
+    case TYPE_TINYINT:
+        return try_load_dense_keys_impl<TYPE_TINYINT>(*key_columns[0]);
+    case TYPE_SMALLINT:
+        return try_load_dense_keys_impl<TYPE_SMALLINT>(*key_columns[0]);
+    case TYPE_INT:
+        return try_load_dense_keys_impl<TYPE_INT>(*key_columns[0]);
+    case TYPE_BIGINT:
+        return try_load_dense_keys_impl<TYPE_BIGINT>(*key_columns[0]);
+    default:
+        return false;
+    }
+}
+
+template <PrimitiveType KeyType>
+bool ComplexHashMapDictionary::try_load_dense_keys_impl(const IColumn& key_column) {
+    const auto& keys = assert_cast<const ColumnVector<KeyType>&>(key_column).get_data();
+    if (keys.empty() || keys.size() >= std::numeric_limits<UInt32>::max()) {
+        return false;
+    }
+    const auto [min_it, max_it] = std::minmax_element(keys.begin(), keys.end());
+    // the offsets are computed in UInt64 so that the range of BIGINT keys does not overflow
+    const auto min_key = static_cast<UInt64>(static_cast<Int64>(*min_it));
+    const UInt64 range = static_cast<UInt64>(static_cast<Int64>(*max_it)) - min_key;
+    if (range >= 2 * keys.size()) {
+        return false;
+    }
+
+    _dense_rows.resize_fill(range + 1, 0);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        auto& row = _dense_rows[static_cast<UInt64>(static_cast<Int64>(keys[i])) - min_key];
+        if (row != 0) {
+            throw doris::Exception(
+                    ErrorCode::INVALID_ARGUMENT,
+                    DICT_DATA_ERROR_TAG + "The key has duplicate data in HashMapDictionary");
+        }
+        row = static_cast<UInt32>(i + 1);
+    }
+    _use_dense_layout = true;
+    _dense_key_type = KeyType;
+    _dense_min_key = static_cast<Int64>(*min_it);
+    return true;
+}
+
+void ComplexHashMapDictionary::find_dense_keys(const ColumnPtrs& key_columns,
+                                               const DataTypes& key_types,
+                                               IColumn::Selector& value_index,
+                                               NullMap& key_not_found) const {
+    if (key_columns.size() != 1 || key_types[0]->get_primitive_type() != _dense_key_type) {
+        throw doris::Exception(ErrorCode::INTERNAL_ERROR, "key column not match");
+    }
+    const NullMap* key_null_map = nullptr;
+    const IColumn* key_column = key_columns[0].get();
+    if (const auto* nullable_column = check_and_get_column<ColumnNullable>(key_column)) {
+        key_null_map = &nullable_column->get_null_map_data();
+        key_column = &nullable_column->get_nested_column();
+    }
+    switch (_dense_key_type) {
+    case TYPE_TINYINT:
+        return find_dense_keys_impl<TYPE_TINYINT>(*key_column, key_null_map, value_index,
+                                                  key_not_found);
+    case TYPE_SMALLINT:
+        return find_dense_keys_impl<TYPE_SMALLINT>(*key_column, key_null_map, value_index,
+                                                   key_not_found);
+    case TYPE_INT:
+        return find_dense_keys_impl<TYPE_INT>(*key_column, key_null_map, value_index,
+                                              key_not_found);
+    case TYPE_BIGINT:
+        return find_dense_keys_impl<TYPE_BIGINT>(*key_column, key_null_map, value_index,
+                                                 key_not_found);
+    default:
+        throw doris::Exception(ErrorCode::INTERNAL_ERROR, "unexpected dense key type {}",
+                               type_to_string(_dense_key_type));
+    }
+}
+
+template <PrimitiveType KeyType>
+void ComplexHashMapDictionary::find_dense_keys_impl(const IColumn& key_column,
+                                                    const NullMap* key_null_map,
+                                                    IColumn::Selector& value_index,
+                                                    NullMap& key_not_found) const {
+    const auto& keys = assert_cast<const ColumnVector<KeyType>&>(key_column).get_data();
+    const auto min_key = static_cast<UInt64>(_dense_min_key);
+    const UInt64 size = _dense_rows.size();
+    for (size_t i = 0; i < keys.size(); ++i) {
+        const UInt64 offset = static_cast<UInt64>(static_cast<Int64>(keys[i])) - min_key;
+        const UInt32 row = offset < size ? _dense_rows[offset] : 0;
+        // if the key is null, it is not found
+        key_not_found[i] = row == 0 || (key_null_map != nullptr && (*key_null_map)[i]);
+        value_index[i] = row - 1;
+    }
+}
+
 void ComplexHashMapDictionary::load_data(const ColumnPtrs& key_columns, const DataTypes& key_types,
                                          const std::vector<ColumnPtr>& values_column) {
+    if (try_load_dense_keys(key_columns, key_types)) {
+        load_values(values_column);
+        return;
+    }
+
     // load key column
     THROW_IF_ERROR(init_hash_method<DictionaryHashMapMethod>(&_hash_map_method, key_types, true));
 
@@ -134,6 +244,16 @@ ColumnPtrs ComplexHashMapDictionary::get_tuple_columns(
     // if key is not found, or key is null , wiil set true
     NullMap key_not_found = NullMap(rows, false);
 
+    if (_use_dense_layout) {
+        find_dense_keys(key_columns, key_types, value_index, key_not_found);
+        ColumnPtrs columns;
+        for (size_t i = 0; i < attribute_names.size(); ++i) {
+            columns.push_back(get_single_value_column(value_index, key_not_found,
+                                                      attribute_names[i], attribute_types[i]));
+        }
+        return columns;
+    }
+
     DictionaryHashMapMethod find_hash_map;
     // In init_find_hash_map, hashtable will be shared, similar to shared_hashtable in join
     init_find_hash_map(find_hash_map, key_types);
@@ -23,6 +23,7 @@
 
 #include "common/status.h"
 #include "vec/columns/column.h"
+#include "vec/common/pod_array.h"
 #include "vec/core/columns_with_type_and_name.h"
 #include "vec/data_types/data_type.h"
 #include "vec/data_types/data_type_nullable.h"
@@ -78,8 +79,30 @@ private:
     void init_find_hash_map(DictionaryHashMapMethod& find_hash_map_method,
                             const DataTypes& key_types) const;
 
+    // Builds the flat array layout if there is a single integer key column whose values are
+    // dense, returns false if the keys do not fit it.
+    bool try_load_dense_keys(const ColumnPtrs& key_columns, const DataTypes& key_types);
+
+    template <PrimitiveType KeyType>
+    bool try_load_dense_keys_impl(const IColumn& key_column);
+
+    void find_dense_keys(const ColumnPtrs& key_columns, const DataTypes& key_types,
+                         IColumn::Selector& value_index, NullMap& key_not_found) const;
+
+    template <PrimitiveType KeyType>
+    void find_dense_keys_impl(const IColumn& key_column, const NullMap* key_null_map,
+                              IColumn::Selector& value_index, NullMap& key_not_found) const;
+
     DictionaryHashMapMethod _hash_map_method;
 
+    // The flat array layout, used instead of the hash map for a single integer key column whose
+    // range of values is at most twice of the number of keys. The value row of key `k` is
+    // `_dense_rows[k - _dense_min_key] - 1`, 0 means there is no such key.
+    bool _use_dense_layout = false;
+    PrimitiveType _dense_key_type = INVALID_TYPE;
+    Int64 _dense_min_key = 0;
+    PaddedPODArray<UInt32> _dense_rows;
+
     // Used to save key columns, because some types of hashmaps do not hold key columns, such as MethodStringNoCache
     ColumnPtrs _key_columns;
 };
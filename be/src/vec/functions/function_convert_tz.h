@@ -231,6 +231,11 @@ private:
             }
             return;
         }
+        // the civil times are shifted by the offsets of the zones, in seconds since 1970-01-01
+        constexpr int64_t epoch_daynr = 719528;
+        constexpr int64_t second_per_day = SECOND_PER_HOUR * HOUR_PER_DAY;
+        TimezoneConverter from_converter(from_tz);
+        TimezoneConverter to_converter(to_tz);
         for (size_t i = 0; i < input_rows_count; i++) {
             if (result_null_map[i]) {
                 result_column->insert_default();
@@ -239,22 +244,34 @@ private:
 
             DateValueType ts_value =
                     binary_cast<NativeType, DateValueType>(date_column->get_element(i));
-            ReturnDateValueType ts_value2;
+            const int64_t daynr = ts_value.daynr();
+            const int64_t civil_seconds = to_converter.to_civil_seconds(
+                    from_converter.to_unix_seconds((daynr - epoch_daynr) * second_per_day +
+                                                   ts_value.time_part_to_seconds()));
+            int64_t result_daynr = civil_seconds / second_per_day;
+            int64_t second_of_day = civil_seconds % second_per_day;
+            if (second_of_day < 0) {
+                result_daynr--;
+                second_of_day += second_per_day;
+            }
+            result_daynr += epoch_daynr;
 
-            if constexpr (std::is_same_v<ArgDateType, DataTypeDateTimeV2>) {
-                std::pair<int64_t, int64_t> timestamp;
-                if (!ts_value.unix_timestamp(&timestamp, from_tz)) {
-                    push_null(i);
-                    continue;
-                }
-                ts_value2.from_unixtime(timestamp, to_tz);
-            } else {
-                int64_t timestamp;
-                if (!ts_value.unix_timestamp(&timestamp, from_tz)) {
-                    push_null(i);
-                    continue;
-                }
-                ts_value2.from_unixtime(timestamp, to_tz);
+            ReturnDateValueType ts_value2 = ts_value;
+            if (result_daynr != daynr &&
+                (result_daynr <= 0 || !ts_value2.get_date_from_daynr(result_daynr))) [[unlikely]] {
+                push_null(i);
+                continue;
+            }
+            const auto hour = static_cast<uint8_t>(second_of_day / SECOND_PER_HOUR);
+            const auto minute =
+                    static_cast<uint8_t>(second_of_day % SECOND_PER_HOUR / SECOND_PER_MINUTE);
+            const auto second = static_cast<uint8_t>(second_of_day % SECOND_PER_MINUTE);
+            if constexpr (is_v1) {
+                ts_value2.unchecked_set_time(ts_value2.year(), ts_value2.month(), ts_value2.day(),
+                                             hour, minute, second);
+                ts_value2.set_type(TIME_DATETIME);
+            } else if constexpr (std::is_same_v<ArgDateType, DataTypeDateTimeV2>) {
+                ts_value2.unchecked_set_time(hour, minute, second, ts_value.microsecond());
             }
 
             if (!ts_value2.is_valid_date()) [[unlikely]] {
@@ -184,15 +184,18 @@ match_value(const std::vector<JsonPath>& parsed_paths, rapidjson::Value* documen
     return root;
 }
 
-template <JsonFunctionType fntype>
-rapidjson::Value* get_json_object(std::string_view json_string, std::string_view path_string,
-                                  rapidjson::Document* document) {
-    std::vector<JsonPath>* parsed_paths;
-    std::vector<JsonPath> tmp_parsed_paths;
+// A json path split into its components once, so it can be matched against many documents.
+struct ParsedJsonPath {
+    // false if no document can match the path
+    bool valid = false;
+    std::vector<JsonPath> paths;
+};
 
+ParsedJsonPath parse_json_path(std::string_view path_string) {
+    ParsedJsonPath parsed;
     //Cannot use '\' as the last character, return NULL
-    if (path_string.back() == '\\') {
-        return nullptr;
+    if (!path_string.empty() && path_string.back() == '\\') {
+        return parsed;
     }
 
     std::string fixed_string;
@@ -213,16 +216,26 @@ rapidjson::Value* get_json_object(std::string_view json_string, std::string_view
         auto tok = get_json_token(path_string);
 #endif
         std::vector<std::string> paths(tok.begin(), tok.end());
-        get_parsed_paths(paths, &tmp_parsed_paths);
-        if (tmp_parsed_paths.empty()) {
-            return document;
-        }
+        get_parsed_paths(paths, &parsed.paths);
     } catch (boost::escaped_list_error&) {
         // meet unknown escape sequence, example '$.name\k'
-        return nullptr;
+        parsed.paths.clear();
+        return parsed;
     }
+    parsed.valid = true;
+    return parsed;
+}
 
-    parsed_paths = &tmp_parsed_paths;
+template <JsonFunctionType fntype>
+rapidjson::Value* get_json_object(std::string_view json_string, const ParsedJsonPath& parsed_path,
+                                  rapidjson::Document* document) {
+    if (!parsed_path.valid) {
+        return nullptr;
+    }
+    const std::vector<JsonPath>* parsed_paths = &parsed_path.paths;
+    if (parsed_paths->empty()) {
+        return document;
+    }
 
     if (!(*parsed_paths)[0].is_valid) {
         return nullptr;
@@ -248,6 +261,23 @@ rapidjson::Value* get_json_object(std::string_view json_string, std::string_view
     return match_value(*parsed_paths, document, document->GetAllocator());
 }
 
+template <JsonFunctionType fntype>
+rapidjson::Value* get_json_object(std::string_view json_string, std::string_view path_string,
+                                  rapidjson::Document* document) {
+    return get_json_object<fntype>(json_string, parse_json_path(path_string), document);
+}
+
+// Matches a path against a document that was already parsed, so several paths can share
+// one parse. Behaves like get_json_object<JSON_FUN_STRING> on the same input.
+rapidjson::Value* match_parsed_document(const ParsedJsonPath& parsed_path,
+                                        rapidjson::Document* document, bool parse_error) {
+    if (!parsed_path.valid || parsed_path.paths.empty() || !parsed_path.paths[0].is_valid ||
+        parse_error) {
+        return nullptr;
+    }
+    return match_value(parsed_path.paths, document, document->GetAllocator());
+}
+
 template <typename NumberType>
 struct GetJsonNumberType {
     using ReturnType = typename NumberType::ReturnType;
@@ -448,6 +478,7 @@ struct GetJsonString {
                               NullMap& null_map) {
         size_t input_rows_count = loffsets.size();
         res_offsets.resize(input_rows_count);
+        const auto parsed_path = parse_json_path(std::string_view(rdata.data, rdata.size));
 
         for (size_t i = 0; i < input_rows_count; ++i) {
             if (null_map[i]) {
@@ -458,9 +489,8 @@ struct GetJsonString {
             const auto l_raw = reinterpret_cast<const char*>(&ldata[loffsets[i - 1]]);
 
             std::string_view json_string(l_raw, l_size);
-            std::string_view path_string(rdata.data, rdata.size);
 
-            execute_impl(json_string, path_string, res_data, res_offsets, null_map, i);
+            execute_impl(json_string, parsed_path, res_data, res_offsets, null_map, i);
         }
     }
     static void scalar_vector(FunctionContext* context, const StringRef& ldata, const Chars& rdata,
@@ -487,10 +517,17 @@ struct GetJsonString {
     static void execute_impl(const std::string_view& json_string,
                              const std::string_view& path_string, Chars& res_data,
                              Offsets& res_offsets, NullMap& null_map, size_t index_now) {
+        execute_impl(json_string, parse_json_path(path_string), res_data, res_offsets, null_map,
+                     index_now);
+    }
+
+    static void execute_impl(const std::string_view& json_string,
+                             const ParsedJsonPath& parsed_path, Chars& res_data,
+                             Offsets& res_offsets, NullMap& null_map, size_t index_now) {
         rapidjson::Document document;
         rapidjson::Value* root = nullptr;
 
-        root = get_json_object<JSON_FUN_STRING>(json_string, path_string, &document);
+        root = get_json_object<JSON_FUN_STRING>(json_string, parsed_path, &document);
         const int max_string_len = DEFAULT_MAX_JSON_SIZE;
 
         if (root == nullptr || root->IsNull()) {
@@ -665,34 +702,10 @@ struct FunctionJsonExtractImpl {
         return {found, std::move(value)};
     }
 
-    static rapidjson::Value* get_document(const ColumnString* path_col,
-                                          rapidjson::Document* document,
-                                          std::vector<JsonPath>& parsed_paths, const size_t row,
+    static ParsedJsonPath get_parsed_path(const ColumnString* path_col, const size_t row,
                                           bool is_const_column) {
         const auto path = path_col->get_data_at(index_check_const(row, is_const_column));
-        std::string_view path_string(path.data, path.size);
-        //Cannot use '\' as the last character, return NULL
-        if (path_string.back() == '\\') {
-            document->SetNull();
-            return nullptr;
-        }
-
-#ifdef USE_LIBCPP
-        std::string s(path_string);
-        auto tok = get_json_token(s);
-#else
-        auto tok = get_json_token(path_string);
-#endif
-        // TODO: here maybe could use std::vector<std::string_view> or std::span
-        std::vector<std::string> paths(tok.begin(), tok.end());
-        get_parsed_paths(paths, &parsed_paths);
-        if (parsed_paths.empty()) {
-            return nullptr;
-        }
-        if (!(parsed_paths)[0].is_valid) {
-            return nullptr;
-        }
-        return document;
+        return parse_json_path(std::string_view(path.data, path.size));
     }
 
     static void execute(const std::vector<const ColumnString*>& data_columns,
@@ -726,36 +739,16 @@ struct FunctionJsonExtractImpl {
         };
         if (data_columns.size() == 2) {
             if (column_is_consts[1]) {
-                std::vector<JsonPath> parsed_paths;
-                auto* root = get_document(data_columns[1], &document, parsed_paths, 0,
-                                          column_is_consts[1]);
+                auto parsed_path = get_parsed_path(data_columns[1], 0, column_is_consts[1]);
                 for (size_t row = 0; row < input_rows_count; row++) {
-                    bool is_null = false;
                     rapidjson::Value value;
-                    if (root != nullptr) {
-                        const auto& obj = json_col->get_data_at(row);
-                        std::string_view json_string(obj.data, obj.size);
-                        if (UNLIKELY((parsed_paths).size() == 1)) {
-                            document.SetString(json_string.data(),
-                                               cast_set<rapidjson::SizeType>(json_string.size()),
-                                               allocator);
-                        }
-                        document.Parse(json_string.data(), json_string.size());
-                        if (UNLIKELY(document.HasParseError())) {
-                            null_map[row] = 1;
-                            result_column.insert_default();
-                            continue;
-                        }
-                        auto* root_val = match_value(parsed_paths, &document, allocator);
-                        if (root_val != nullptr) {
-                            value.CopyFrom(*root_val, allocator);
-                        } else {
-                            is_null = true;
-                        }
-                    } else {
-                        is_null = true;
+                    const auto& obj = json_col->get_data_at(row);
+                    auto* root_val = get_json_object<JSON_FUN_STRING>(
+                            std::string_view(obj.data, obj.size), parsed_path, &document);
+                    if (root_val != nullptr) {
+                        value.CopyFrom(*root_val, allocator);
                     }
-                    insert_result_lambda(value, is_null, row);
+                    insert_result_lambda(value, root_val == nullptr, row);
                 }
             } else {
                 for (size_t row = 0; row < input_rows_count; row++) {
@@ -766,18 +759,35 @@ struct FunctionJsonExtractImpl {
             }
 
         } else {
+            // Parse every document once and match all paths against it, instead of
+            // re-parsing the same document for each path argument.
+            std::vector<ParsedJsonPath> parsed_paths(data_columns.size());
+            for (size_t col = 1; col < data_columns.size(); ++col) {
+                if (column_is_consts[col]) {
+                    parsed_paths[col] = get_parsed_path(data_columns[col], 0, true);
+                }
+            }
+            rapidjson::Document row_document;
             rapidjson::Value value;
             value.SetArray();
             value.Reserve(cast_set<rapidjson::SizeType>(data_columns.size() - 1), allocator);
             for (size_t row = 0; row < input_rows_count; row++) {
                 value.Clear();
                 bool found_any = false;
+                const auto obj = json_col->get_data_at(index_check_const(row, column_is_consts[0]));
+                row_document.Parse(obj.data, obj.size);
+                const bool parse_error = row_document.HasParseError();
                 for (size_t col = 1; col < data_columns.size(); ++col) {
-                    auto result = parse_json(json_col, data_columns[col], allocator, row, col,
-                                             column_is_consts);
-                    if (result.first) {
+                    if (!column_is_consts[col]) {
+                        parsed_paths[col] = get_parsed_path(data_columns[col], row, false);
+                    }
+                    auto* root = match_parsed_document(parsed_paths[col], &row_document,
+                                                       parse_error);
+                    if (root != nullptr) {
                         found_any = true;
-                        value.PushBack(std::move(result.second), allocator);
+                        rapidjson::Value result;
+                        result.CopyFrom(*root, allocator);
+                        value.PushBack(std::move(result), allocator);
                     }
                 }
                 insert_result_lambda(value, !found_any, row);
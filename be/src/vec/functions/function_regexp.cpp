@@ -64,7 +64,7 @@ struct RegexpCountImpl {
                                    const ColumnString* pattern_col, const size_t index_now) {
         re2::RE2* re = reinterpret_cast<re2::RE2*>(
                 context->get_function_state(FunctionContext::THREAD_LOCAL));
-        std::unique_ptr<re2::RE2> scoped_re;
+        std::shared_ptr<re2::RE2> scoped_re;
         if (re == nullptr) {
             std::string error_str;
             DCHECK(pattern_col);
@@ -130,15 +130,14 @@ public:
                 }
 
                 std::string error_str;
-                std::unique_ptr<re2::RE2> scoped_re;
+                std::shared_ptr<re2::RE2> scoped_re;
                 bool st = StringFunctions::compile_regex(pattern, &error_str, StringRef(),
                                                          StringRef(), scoped_re);
                 if (!st) {
                     context->set_error(error_str.c_str());
                     return Status::InvalidArgument(error_str);
                 }
-                std::shared_ptr<re2::RE2> re(scoped_re.release());
-                context->set_function_state(scope, re);
+                context->set_function_state(scope, scoped_re);
             }
         }
         return Status::OK();
@@ -209,7 +208,7 @@ public:
                 }
 
                 std::string error_str;
-                std::unique_ptr<re2::RE2> scoped_re;
+                std::shared_ptr<re2::RE2> scoped_re;
                 StringRef options_value;
                 if constexpr (std::is_same_v<FourParamTypes, ParamTypes>) {
                     DCHECK_EQ(context->get_num_args(), 4);
@@ -224,8 +223,7 @@ public:
                     context->set_error(error_str.c_str());
                     return Status::InvalidArgument(error_str);
                 }
-                std::shared_ptr<re2::RE2> re(scoped_re.release());
-                context->set_function_state(scope, re);
+                context->set_function_state(scope, scoped_re);
             }
         }
         return Status::OK();
@@ -318,7 +316,7 @@ struct RegexpReplaceImpl {
                                     const size_t index_now) {
         re2::RE2* re = reinterpret_cast<re2::RE2*>(
                 context->get_function_state(FunctionContext::THREAD_LOCAL));
-        std::unique_ptr<re2::RE2> scoped_re; // destroys re if state->re is nullptr
+        std::shared_ptr<re2::RE2> scoped_re; // destroys re if state->re is nullptr
         if (re == nullptr) {
             std::string error_str;
             const auto& pattern = pattern_col->get_data_at(index_check_const(index_now, Const));
@@ -388,7 +386,7 @@ struct RegexpReplaceOneImpl {
                                     const size_t index_now) {
         re2::RE2* re = reinterpret_cast<re2::RE2*>(
                 context->get_function_state(FunctionContext::THREAD_LOCAL));
-        std::unique_ptr<re2::RE2> scoped_re; // destroys re if state->re is nullptr
+        std::shared_ptr<re2::RE2> scoped_re; // destroys re if state->re is nullptr
         if (re == nullptr) {
             std::string error_str;
             const auto& pattern = pattern_col->get_data_at(index_check_const(index_now, Const));
@@ -471,7 +469,7 @@ struct RegexpExtractImpl {
                                     const size_t index_now) {
         re2::RE2* re = reinterpret_cast<re2::RE2*>(
                 context->get_function_state(FunctionContext::THREAD_LOCAL));
-        std::unique_ptr<re2::RE2> scoped_re;
+        std::shared_ptr<re2::RE2> scoped_re;
         if (re == nullptr) {
             std::string error_str;
             const auto& pattern = pattern_col->get_data_at(index_check_const(index_now, Const));
@@ -550,7 +548,7 @@ struct RegexpExtractAllImpl {
                                     const size_t index_now) {
         re2::RE2* re = reinterpret_cast<re2::RE2*>(
                 context->get_function_state(FunctionContext::THREAD_LOCAL));
-        std::unique_ptr<re2::RE2> scoped_re;
+        std::shared_ptr<re2::RE2> scoped_re;
         if (re == nullptr) {
             std::string error_str;
             const auto& pattern = pattern_col->get_data_at(index_check_const(index_now, Const));
@@ -641,15 +639,14 @@ public:
                 }
 
                 std::string error_str;
-                std::unique_ptr<re2::RE2> scoped_re;
+                std::shared_ptr<re2::RE2> scoped_re;
                 bool st = StringFunctions::compile_regex(pattern, &error_str, StringRef(),
                                                          StringRef(), scoped_re);
                 if (!st) {
                     context->set_error(error_str.c_str());
                     return Status::InvalidArgument(error_str);
                 }
-                std::shared_ptr<re2::RE2> re(scoped_re.release());
-                context->set_function_state(scope, re);
+                context->set_function_state(scope, scoped_re);
             }
         }
         return Status::OK();
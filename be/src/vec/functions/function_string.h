@@ -1656,7 +1656,6 @@ public:
             }
 
             auto delimiter = delimiter_col->get_data_at(i);
-            auto delimiter_str = delimiter_col->get_data_at(i).to_string();
             auto part_number = part_num_col_data[i];
             auto str = str_col->get_data_at(i);
             if (delimiter.size == 0) {
@@ -1674,7 +1673,7 @@ public:
                         pre_offset = offset;
                         size_t n = str.size - offset - 1;
                         const char* pos = reinterpret_cast<const char*>(
-                                memchr(str.data + offset + 1, delimiter_str[0], n));
+                                memchr(str.data + offset + 1, delimiter.data[0], n));
                         if (pos != nullptr) {
                             offset = pos - str.data;
                             num++;
@@ -1727,13 +1726,16 @@ public:
                 }
             } else {
                 part_number = -part_number;
-                auto str_str = str.to_string();
+                // views instead of copies: the backward search used to copy the string once per
+                // row plus once per delimiter found
+                const std::string_view str_str(str.data, str.size);
+                const std::string_view delimiter_view(delimiter.data, delimiter.size);
                 int32_t offset = str.size;
                 int32_t pre_offset = offset;
                 int32_t num = 0;
                 auto substr = str_str;
                 while (num <= part_number && offset >= 0) {
-                    offset = (int)substr.rfind(delimiter, offset);
+                    offset = (int)substr.rfind(delimiter_view, offset);
                     if (offset != -1) {
                         if (++num == part_number) {
                             break;
@@ -654,24 +654,43 @@ struct StRelationFunction {
         }
     }
 
-    static void const_vector(const ColumnPtr& left_column, const ColumnPtr& right_column,
-                             ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
-        auto lhs_value = left_column->get_data_at(0);
-        std::vector<std::unique_ptr<GeoShape>> shapes(2);
+    // The constant shape is decoded once for all the rows, so is the index S2 builds lazily
+    // over a polygon.
+    template <bool const_is_left>
+    static void const_shape_loop(const ColumnPtr& const_column, const ColumnPtr& vector_column,
+                                 ColumnUInt8::MutablePtr& res, NullMap& null_map,
+                                 const size_t size) {
+        auto const_value = const_column->get_data_at(0);
+        std::unique_ptr<GeoShape> const_shape(
+                GeoShape::from_encoded(const_value.data, const_value.size));
+        if (!const_shape) {
+            std::fill(null_map.begin(), null_map.end(), 1);
+            return;
+        }
+        auto& res_data = res->get_data();
         for (int row = 0; row < size; ++row) {
-            auto rhs_value = right_column->get_data_at(row);
-            loop_do(lhs_value, rhs_value, shapes, res, null_map, row);
+            auto value = vector_column->get_data_at(row);
+            std::unique_ptr<GeoShape> shape(GeoShape::from_encoded(value.data, value.size));
+            if (!shape) {
+                null_map[row] = 1;
+                continue;
+            }
+            if constexpr (const_is_left) {
+                res_data[row] = Func::evaluate(const_shape.get(), shape.get());
+            } else {
+                res_data[row] = Func::evaluate(shape.get(), const_shape.get());
+            }
         }
     }
 
+    static void const_vector(const ColumnPtr& left_column, const ColumnPtr& right_column,
+                             ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
+        const_shape_loop<true>(left_column, right_column, res, null_map, size);
+    }
+
     static void vector_const(const ColumnPtr& left_column, const ColumnPtr& right_column,
                              ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
-        auto rhs_value = right_column->get_data_at(0);
-        std::vector<std::unique_ptr<GeoShape>> shapes(2);
-        for (int row = 0; row < size; ++row) {
-            auto lhs_value = left_column->get_data_at(row);
-            loop_do(lhs_value, rhs_value, shapes, res, null_map, row);
-        }
+        const_shape_loop<false>(right_column, left_column, res, null_map, size);
     }
 
     static void vector_vector(const ColumnPtr& left_column, const ColumnPtr& right_column,
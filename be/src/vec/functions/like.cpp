@@ -27,6 +27,7 @@
 #include <vector>
 
 #include "common/logging.h"
+#include "exprs/regexp_cache.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_const.h"
 #include "vec/columns/column_vector.h"
@@ -396,15 +397,27 @@ Status FunctionLikeBase::constant_regex_fn_scalar(LikeSearchState* state, const
 
 Status FunctionLikeBase::regexp_fn_scalar(LikeSearchState* state, const StringRef& val,
                                           const StringRef& pattern, unsigned char* result) {
-    RE2::Options opts;
-    opts.set_never_nl(false);
-    opts.set_dot_nl(true);
-    re2::RE2 re(re2::StringPiece(pattern.data, pattern.size), opts);
-    if (re.ok()) {
-        *result = RE2::PartialMatch(re2::StringPiece(val.data, val.size), re);
-    } else {
-        return Status::RuntimeError("Invalid pattern: {}", pattern.debug_string());
+    // the pattern differs per row, so compiled patterns are shared through the regexp cache
+    auto* cache = ExecEnv::GetInstance()->regexp_cache();
+    std::string key;
+    std::shared_ptr<re2::RE2> re;
+    if (cache != nullptr) {
+        key = RegexpCache::make_key("regexp_fn", "", pattern.to_string_view());
+        re = cache->lookup(key);
+    }
+    if (re == nullptr) {
+        RE2::Options opts;
+        opts.set_never_nl(false);
+        opts.set_dot_nl(true);
+        re = std::make_shared<re2::RE2>(re2::StringPiece(pattern.data, pattern.size), opts);
+        if (!re->ok()) {
+            return Status::RuntimeError("Invalid pattern: {}", pattern.debug_string());
+        }
+        if (cache != nullptr) {
+            cache->insert(key, re);
+        }
     }
+    *result = RE2::PartialMatch(re2::StringPiece(val.data, val.size), *re);
 
     return Status::OK();
 }
@@ -20,6 +20,9 @@
 
 #include <stddef.h>
 
+#include <algorithm>
+#include <limits>
+
 #include "runtime/decimalv2_value.h"
 #include "vec/columns/column_decimal.h"
 #include "vec/columns/column_vector.h"
@@ -184,6 +187,12 @@ struct MultiplyDecimalImpl {
         bool need_adjust_scale = scale_diff_multiplier.value > 1;
         const auto& a = column_left_ptr->get_data();
         auto& c = column_result->get_data();
+        if (check_overflow_for_decimal &&
+            (is_overflow_impossible(type_left, type_right, res_data_type) ||
+             is_block_overflow_impossible<ResultType>(a.data(), a.size(), &b, 1,
+                                                      max_result_number, scale_diff_multiplier))) {
+            check_overflow_for_decimal = false;
+        }
         std::visit(
                 [&](auto need_adjust_scale, auto check_overflow_for_decimal) {
                     for (size_t i = 0; i < column_left->size(); ++i) {
@@ -213,6 +222,12 @@ struct MultiplyDecimalImpl {
         bool need_adjust_scale = scale_diff_multiplier.value > 1;
         auto& b = column_right_ptr->get_data();
         auto& c = column_result->get_data();
+        if (check_overflow_for_decimal &&
+            (is_overflow_impossible(type_left, type_right, res_data_type) ||
+             is_block_overflow_impossible<ResultType>(&a, 1, b.data(), b.size(),
+                                                      max_result_number, scale_diff_multiplier))) {
+            check_overflow_for_decimal = false;
+        }
         std::visit(
                 [&](auto need_adjust_scale, auto check_overflow_for_decimal) {
                     for (size_t i = 0; i < column_right->size(); ++i) {
@@ -311,6 +326,23 @@ struct MultiplyDecimalImpl {
             const auto& b = column_right_ptr->get_data().data();
             const auto& c = column_result->get_data().data();
             bool need_adjust_scale = scale_diff_multiplier.value > 1;
+            if (check_overflow_for_decimal &&
+                (is_overflow_impossible(type_left, type_right, res_data_type) ||
+                 is_block_overflow_impossible<ResultType>(a, sz, b, sz, max_result_number,
+                                                          scale_diff_multiplier))) {
+                // No row can overflow, skip the checks but keep the rounding of the checked path.
+                std::visit(
+                        [&](auto need_adjust_scale) {
+                            for (size_t i = 0; i < sz; i++) {
+                                c[i] = typename ColumnDecimal<ResultType>::value_type(
+                                        apply<need_adjust_scale, false>(
+                                                a[i], b[i], *type_left, *type_right, res_data_type,
+                                                max_result_number, scale_diff_multiplier));
+                            }
+                        },
+                        make_bool_variant(need_adjust_scale));
+                return column_result;
+            }
             std::visit(
                     [&](auto need_adjust_scale, auto check_overflow_for_decimal) {
                         for (size_t i = 0; i < sz; i++) {
@@ -440,6 +472,59 @@ struct MultiplyDecimalImpl {
         }
     }
 
+    // True if the declared precisions alone rule out overflow: the unscaled product fits the
+    // native result type, and after dropping the scale difference it fits the result precision.
+    // Rounding off the dropped digits may carry into one more digit.
+    template <PrimitiveType ResultType>
+    static bool is_overflow_impossible(const DataTypeA* type_left, const DataTypeB* type_right,
+                                       const DataTypeDecimal<ResultType>& res_data_type) {
+        if constexpr (ResultType == TYPE_DECIMALV2) {
+            return false;
+        } else {
+            int product_precision = type_left->get_precision() + type_right->get_precision();
+            int scale_diff = type_left->get_scale() + type_right->get_scale() -
+                             res_data_type.get_scale();
+            int result_precision = product_precision - scale_diff + (scale_diff > 0);
+            return product_precision <= max_decimal_precision<ResultType>() &&
+                   result_precision <= res_data_type.get_precision();
+        }
+    }
+
+    template <typename T>
+    static wide::Int256 max_abs(const T* data, size_t size) {
+        typename T::NativeType max_value = 0;
+        typename T::NativeType min_value = 0;
+        for (size_t i = 0; i < size; ++i) {
+            max_value = std::max(max_value, data[i].value);
+            min_value = std::min(min_value, data[i].value);
+        }
+        return std::max(wide::Int256(max_value), -wide::Int256(min_value));
+    }
+
+    // Checked once per block when the precisions can't rule out overflow: the result of the
+    // largest magnitudes of both sides bounds the result of every row.
+    template <PrimitiveType ResultType>
+    static bool is_block_overflow_impossible(
+            const ArgA* a, size_t a_size, const ArgB* b, size_t b_size,
+            const typename PrimitiveTypeTraits<ResultType>::ColumnItemType& max_result_number,
+            const typename PrimitiveTypeTraits<ResultType>::ColumnItemType& scale_diff_multiplier) {
+        if constexpr (ResultType == TYPE_DECIMALV2 || ResultType == TYPE_DECIMAL256 ||
+                      TypeA == TYPE_DECIMAL256 || TypeB == TYPE_DECIMAL256) {
+            // the product of the magnitudes may not fit Int256
+            return false;
+        } else {
+            using NativeResultType = typename PrimitiveTypeTraits<ResultType>::CppNativeType;
+            wide::Int256 product = max_abs(a, a_size) * max_abs(b, b_size);
+            if (product > wide::Int256(std::numeric_limits<NativeResultType>::max())) {
+                return false;
+            }
+            if (scale_diff_multiplier.value > 1) {
+                product = (product + scale_diff_multiplier.value / 2) / scale_diff_multiplier.value;
+            }
+            return product <= wide::Int256(max_result_number.value);
+        }
+    }
+
     template <PrimitiveType PT>
     static std::pair<typename PrimitiveTypeTraits<PT>::ColumnItemType,
                      typename PrimitiveTypeTraits<PT>::ColumnItemType>
@@ -97,7 +97,15 @@ Status JsonbSerializeUtil::jsonb_to_block(
     JsonbDocument& doc = *pdoc;
     size_t num_rows = dst.rows();
     size_t filled_columns = 0;
-    for (auto it = doc->begin(); it != doc->end(); ++it) {
+    // Stop walking the row once every wanted column is read, point queries usually
+    // project a few columns of a wide row
+    size_t wanted_columns = col_id_to_idx.size();
+    if (!include_cids.empty()) {
+        wanted_columns = static_cast<size_t>(
+                std::count_if(include_cids.begin(), include_cids.end(),
+                              [&](int cid) { return col_id_to_idx.contains(cid); }));
+    }
+    for (auto it = doc->begin(); it != doc->end() && filled_columns < wanted_columns; ++it) {
         auto col_it = col_id_to_idx.find(it->getKeyId());
         if (col_it != col_id_to_idx.end() &&
             (include_cids.empty() || include_cids.contains(it->getKeyId()))) {
@@ -76,6 +76,13 @@ void OlapBlockDataConvertor::add_column_data_convertor(const TabletColumn& colum
     _convertors.emplace_back(create_olap_column_data_convertor(column));
 }
 
+void OlapBlockDataConvertor::add_variant_column_data_convertor(
+        const TabletColumn& column, ColumnVariant::PathSet materialized_paths) {
+    DCHECK(column.is_variant_type());
+    _convertors.emplace_back(
+            std::make_unique<OlapColumnDataConvertorVariant>(std::move(materialized_paths)));
+}
+
 OlapBlockDataConvertor::OlapColumnDataConvertorBaseUPtr
 OlapBlockDataConvertor::create_map_convertor(const TabletColumn& column) {
     const auto& key_column = column.get_sub_column(0);
@@ -283,6 +290,11 @@ void OlapBlockDataConvertor::clear_source_content() {
     }
 }
 
+void OlapBlockDataConvertor::clear_source_content(size_t cid) {
+    assert(cid < _convertors.size());
+    _convertors[cid]->clear_source_column();
+}
+
 std::pair<Status, IOlapColumnDataAccessor*> OlapBlockDataConvertor::convert_column_data(
         size_t cid) {
     assert(cid < _convertors.size());
@@ -1017,7 +1029,7 @@ void OlapBlockDataConvertor::OlapColumnDataConvertorVariant::set_source_column(
     }
     // ensure data finalized
     _source_column_ptr = &const_cast<ColumnVariant&>(variant);
-    _source_column_ptr->finalize(ColumnVariant::FinalizeMode::WRITE_MODE);
+    _source_column_ptr->finalize(ColumnVariant::FinalizeMode::WRITE_MODE, _materialized_paths);
     _root_data_convertor = std::make_unique<OlapColumnDataConvertorVarChar>(true);
     _root_data_convertor->set_source_column(
             {_source_column_ptr->get_root()->get_ptr(), nullptr, ""}, row_pos, num_rows);
@@ -83,8 +83,12 @@ public:
                                                    size_t row_pos, size_t num_rows, uint32_t cid);
 
     void clear_source_content();
+    void clear_source_content(size_t cid);
     std::pair<Status, IOlapColumnDataAccessor*> convert_column_data(size_t cid);
     void add_column_data_convertor(const TabletColumn& column);
+    // the variant column keeps materialized_paths as subcolumns when finalized for write
+    void add_variant_column_data_convertor(const TabletColumn& column,
+                                           ColumnVariant::PathSet materialized_paths);
 
     bool empty() const { return _convertors.empty(); }
     void reserve(size_t size) { _convertors.reserve(size); }
@@ -515,6 +519,8 @@ private:
     class OlapColumnDataConvertorVariant : public OlapColumnDataConvertorBase {
     public:
         OlapColumnDataConvertorVariant() = default;
+        explicit OlapColumnDataConvertorVariant(ColumnVariant::PathSet materialized_paths)
+                : _materialized_paths(std::move(materialized_paths)) {}
 
         void set_source_column(const ColumnWithTypeAndName& typed_column, size_t row_pos,
                                size_t num_rows) override;
@@ -532,6 +538,8 @@ private:
         // // _nullmap contains null info for this variant
         std::unique_ptr<OlapColumnDataConvertorVarChar> _root_data_convertor;
         ColumnVariant* _source_column_ptr;
+        // paths already stored as typed subcolumns, never split into sparse columns
+        ColumnVariant::PathSet _materialized_paths;
     };
 
 private:
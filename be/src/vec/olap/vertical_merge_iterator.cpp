@@ -67,7 +67,11 @@ uint16_t RowSource::data() const {
 
 /*  --------------  row source buffer -------------   */
 
+// The row sources are written to the buffer file in chunks of at most this many.
+static constexpr size_t ROW_SOURCES_FILE_CHUNK_ROWS = 1024 * 1024;
+
 // current row_sources must save in memory so agg key can update agg flag
+
 Status RowSourcesBuffer::append(const std::vector<RowSource>& row_sources) {
     if (_buffer.allocated_bytes() + row_sources.size() * sizeof(UInt16) >
         config::vertical_compaction_max_row_source_memory_mb * 1024 * 1024) {
@@ -96,8 +100,29 @@ Status RowSourcesBuffer::seek_to_begin() {
             LOG(WARNING) << "failed to seek to 0";
             return Status::InternalError("failed to seek to 0");
         }
+        _file_offset = 0;
+        _reset_buffer();
+    }
+    return Status::OK();
+}
+
+Status RowSourcesBuffer::create_reader(std::unique_ptr<RowSourcesBuffer>* reader) {
+    if (_fd < 0) {
+        DCHECK_EQ(_buf_idx, 0);
+        RETURN_IF_ERROR(_create_buffer_file());
+        RETURN_IF_ERROR(_serialize());
+        _file_offset = 0;
         _reset_buffer();
     }
+    auto buffer = std::make_unique<RowSourcesBuffer>(_tablet_id, _tablet_path, _reader_type);
+    // the readers share the file, but not the file position, every one reads with pread
+    buffer->_fd = ::dup(_fd);
+    if (buffer->_fd < 0) {
+        LOG(WARNING) << "failed to dup row source buffer file, err: " << strerror(errno);
+        return Status::InternalError("failed to dup row source buffer file");
+    }
+    buffer->_total_size = _total_size;
+    *reader = std::move(buffer);
     return Status::OK();
 }
 
@@ -212,29 +237,30 @@ Status RowSourcesBuffer::flush() {
 }
 
 Status RowSourcesBuffer::_serialize() {
-    size_t rows = _buffer.size();
-    if (rows == 0) {
-        return Status::OK();
-    }
-    // write size
-    ssize_t bytes_written = ::write(_fd, &rows, sizeof(rows));
-    if (bytes_written != sizeof(size_t)) {
-        LOG(WARNING) << "failed to write buffer size to file, bytes_written=" << bytes_written;
-        return Status::InternalError("fail to write buffer size to file");
-    }
-    // write data
-    bytes_written = ::write(_fd, _buffer.data(), _buffer.size() * sizeof(UInt16));
-    if (bytes_written != _buffer.size() * sizeof(UInt16)) {
-        LOG(WARNING) << "failed to write buffer data to file, bytes_written=" << bytes_written
-                     << " buffer size=" << _buffer.size() * sizeof(UInt16);
-        return Status::InternalError("fail to write buffer size to file");
+    // write the buffer in chunks, a reader of the file keeps only one chunk in memory
+    for (size_t start = 0; start < _buffer.size(); start += ROW_SOURCES_FILE_CHUNK_ROWS) {
+        size_t rows = std::min(_buffer.size() - start, ROW_SOURCES_FILE_CHUNK_ROWS);
+        // write size
+        ssize_t bytes_written = ::write(_fd, &rows, sizeof(rows));
+        if (bytes_written != sizeof(size_t)) {
+            LOG(WARNING) << "failed to write buffer size to file, bytes_written="
+                         << bytes_written;
+            return Status::InternalError("fail to write buffer size to file");
+        }
+        // write data
+        bytes_written = ::write(_fd, _buffer.data() + start, rows * sizeof(UInt16));
+        if (bytes_written != rows * sizeof(UInt16)) {
+            LOG(WARNING) << "failed to write buffer data to file, bytes_written="
+                         << bytes_written << " buffer size=" << rows * sizeof(UInt16);
+            return Status::InternalError("fail to write buffer size to file");
+        }
     }
     return Status::OK();
 }
 
 Status RowSourcesBuffer::_deserialize() {
     size_t rows = 0;
-    ssize_t bytes_read = ::read(_fd, &rows, sizeof(rows));
+    ssize_t bytes_read = ::pread(_fd, &rows, sizeof(rows), _file_offset);
     if (bytes_read == 0) {
         LOG(WARNING) << "end of row source buffer file";
         return Status::EndOfFile("end of row source buffer file");
@@ -244,12 +270,14 @@ Status RowSourcesBuffer::_deserialize() {
     }
     _buffer.resize(rows);
     auto& internal_data = _buffer;
-    bytes_read = ::read(_fd, internal_data.data(), rows * sizeof(UInt16));
+    bytes_read = ::pread(_fd, internal_data.data(), rows * sizeof(UInt16),
+                         _file_offset + sizeof(rows));
     if (bytes_read != rows * sizeof(UInt16)) {
         LOG(WARNING) << "failed to read buffer data from file, bytes_read=" << bytes_read
                      << ", expect bytes=" << rows * sizeof(UInt16);
         return Status::InternalError("failed to read buffer data from file");
     }
+    _file_offset += sizeof(rows) + rows * sizeof(UInt16);
     return Status::OK();
 }
 
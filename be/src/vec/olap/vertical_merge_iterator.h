@@ -115,6 +115,11 @@ public:
 
     Status seek_to_begin();
 
+    // Create a buffer to read all the row sources again from the beginning, with its own read
+    // position in the buffer file, so that value column groups can be merged at the same time.
+    // The row sources kept in memory are spilled to the file first.
+    Status create_reader(std::unique_ptr<RowSourcesBuffer>* reader);
+
     size_t same_source_count(uint16_t source, size_t limit);
 
     // return continuous agg_flag=true count from index
@@ -134,6 +139,8 @@ private:
     ReaderType _reader_type = ReaderType::UNKNOWN;
     uint64_t _buf_idx = 0;
     int _fd = -1;
+    // read position in the buffer file
+    off_t _file_offset = 0;
     PaddedPODArray<UInt16> _buffer;
     uint64_t _total_size = 0;
 };
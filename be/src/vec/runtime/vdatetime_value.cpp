@@ -1949,10 +1949,63 @@ bool DateV2Value<T>::from_date_str(const char* date_str, int len,
                                    bool convert_zero) {
     return from_date_str_base(date_str, len, scale, &local_time_zone, convert_zero);
 }
+template <typename T>
+bool DateV2Value<T>::from_iso_date_str(const char* date_str, int len, bool convert_zero,
+                                       bool* parsed) {
+    *parsed = false;
+    if (len != 10 && len != 19) {
+        return false;
+    }
+    // '0' - '9' is the only byte range that maps to 0..9 after the unsigned subtraction
+    auto digit = [date_str](int i) { return static_cast<uint8_t>(date_str[i] - '0'); };
+    auto two_digits = [&](int i, uint32_t* value) {
+        const uint8_t high = digit(i);
+        const uint8_t low = digit(i + 1);
+        *value = high * 10 + low;
+        return high <= 9 && low <= 9;
+    };
+    uint32_t year_high = 0;
+    uint32_t year_low = 0;
+    uint32_t month = 0;
+    uint32_t day = 0;
+    if (!two_digits(0, &year_high) || !two_digits(2, &year_low) || date_str[4] != '-' ||
+        !two_digits(5, &month) || date_str[7] != '-' || !two_digits(8, &day)) {
+        return false;
+    }
+    uint32_t hour = 0;
+    uint32_t minute = 0;
+    uint32_t second = 0;
+    if (len == 19 && ((date_str[10] != ' ' && date_str[10] != 'T') ||
+                      !two_digits(11, &hour) || date_str[13] != ':' ||
+                      !two_digits(14, &minute) || date_str[16] != ':' ||
+                      !two_digits(17, &second))) {
+        return false;
+    }
+    *parsed = true;
+
+    const uint32_t year = year_high * 100 + year_low;
+    if (is_invalid(year, month, day, 0, 0, 0, 0)) {
+        if (year == 0 && month == 0 && day == 0 && convert_zero) {
+            month = 1;
+            day = 1;
+        } else {
+            return false;
+        }
+    }
+    return check_range_and_set_time(year, month, day, hour, minute, second, 0);
+}
+
 // if local_time_zone is null, only be able to parse time without timezone
 template <typename T>
 bool DateV2Value<T>::from_date_str_base(const char* date_str, int len, int scale,
                                         const cctz::time_zone* local_time_zone, bool convert_zero) {
+    // most loaded and exported timestamps are fixed width ISO strings, skip the generic parser
+    bool parsed = false;
+    const bool res = from_iso_date_str(date_str, len, convert_zero, &parsed);
+    if (parsed) {
+        return res;
+    }
+
     const char* ptr = date_str;
     const char* end = date_str + len;
     // ONLY 2, 6 can follow by a space
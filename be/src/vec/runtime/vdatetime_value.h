@@ -1335,6 +1335,11 @@ private:
     bool from_date_str_base(const char* date_str, int len, int scale,
                             const cctz::time_zone* local_time_zone, bool convert_zero);
 
+    // Parses the fixed width ISO layouts "YYYY-MM-DD" and "YYYY-MM-DD HH:MM:SS" (or with 'T').
+    // Sets *parsed to false if the input has another layout and must go through
+    // from_date_str_base.
+    bool from_iso_date_str(const char* date_str, int len, bool convert_zero, bool* parsed);
+
     // Used to construct from int value
     int64_t standardize_timevalue(int64_t value);
 
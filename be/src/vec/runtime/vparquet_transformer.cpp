@@ -232,6 +232,9 @@ Status VParquetTransformer::_parse_properties() {
             arrow_builder.enable_deprecated_int96_timestamps();
         }
         arrow_builder.store_schema();
+        // each column of the buffered row group is written by a task of the arrow CPU pool, the
+        // row group is still bounded by min_row_group_size
+        arrow_builder.set_use_threads(config::enable_parquet_writer_parallel_column_encoding);
         _arrow_properties = arrow_builder.build();
     } catch (const parquet::ParquetException& e) {
         return Status::InternalError("parquet writer parse properties error: {}", e.what());
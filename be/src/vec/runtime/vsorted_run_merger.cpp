@@ -17,6 +17,7 @@
 
 #include "vec/runtime/vsorted_run_merger.h"
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -162,20 +163,32 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
                     num_columns, merged_columns.size());
         }
 
-        _indexs.reserve(_batch_size);
-        _block_addrs.reserve(_batch_size);
+        _runs.reserve(_batch_size);
 
         auto do_insert = [&]() {
-            _column_addrs.resize(_indexs.size());
             for (size_t i = 0; i < num_columns; ++i) {
-                for (size_t j = 0; j < _indexs.size(); j++) {
-                    _column_addrs[j] = _block_addrs[j]->get_by_position(i).column.get();
+                // the rows of the runs with one row are inserted in one call, the longer runs
+                // with one insert_range_from each
+                auto insert_single_rows = [&]() {
+                    if (!_indexs.empty()) {
+                        merged_columns[i]->insert_from_multi_column(_column_addrs, _indexs);
+                        _indexs.clear();
+                        _column_addrs.clear();
+                    }
+                };
+                for (const auto& run : _runs) {
+                    const auto* column = run.block->get_by_position(i).column.get();
+                    if (run.length == 1) {
+                        _column_addrs.emplace_back(column);
+                        _indexs.emplace_back(run.start);
+                    } else {
+                        insert_single_rows();
+                        merged_columns[i]->insert_range_from(*column, run.start, run.length);
+                    }
                 }
-                merged_columns[i]->insert_from_multi_column(_column_addrs, _indexs);
+                insert_single_rows();
             }
-            _indexs.clear();
-            _block_addrs.clear();
-            _column_addrs.clear();
+            _runs.clear();
         };
 
         /// Take rows from queue in right order and push to 'merged'.
@@ -184,15 +197,16 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
             auto current = _priority_queue.top();
             _priority_queue.pop();
 
-            if (_offset > 0) {
-                _offset--;
-            } else {
-                _indexs.emplace_back(current->pos);
-                _block_addrs.emplace_back(current->block_ptr());
-                ++merged_rows;
+            size_t run_rows = _run_length(current, _batch_size - merged_rows + _offset);
+            size_t skipped_rows = std::min(run_rows, _offset);
+            _offset -= skipped_rows;
+            if (run_rows > skipped_rows) {
+                _runs.push_back({current->block_ptr(), current->pos + skipped_rows,
+                                 run_rows - skipped_rows});
+                merged_rows += run_rows - skipped_rows;
             }
 
-            current->next();
+            current->next(run_rows);
             if (_need_more_data(current)) {
                 do_insert();
                 return Status::OK();
@@ -210,6 +224,35 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
     return Status::OK();
 }
 
+size_t VSortedRunMerger::_run_length(const MergeSortCursor& current, size_t max_rows) const {
+    max_rows = std::min(max_rows, static_cast<size_t>(current->rows - current->pos));
+    if (_priority_queue.empty()) {
+        return max_rows;
+    }
+    // the rows of current up to the first one greater than the top of the other runs can be
+    // merged without going through the queue, find it by galloping then binary search
+    const auto& next = _priority_queue.top();
+    auto not_greater = [&](size_t run_rows) {
+        return current.greater_at(next, current->pos + run_rows - 1, next->pos) <= 0;
+    };
+    size_t run_rows = 1;
+    size_t step = 1;
+    while (run_rows + step <= max_rows && not_greater(run_rows + step)) {
+        run_rows += step;
+        step *= 2;
+    }
+    size_t upper = std::min(run_rows + step, max_rows + 1);
+    while (upper - run_rows > 1) {
+        size_t mid = (run_rows + upper) / 2;
+        if (not_greater(mid)) {
+            run_rows = mid;
+        } else {
+            upper = mid;
+        }
+    }
+    return run_rows;
+}
+
 bool VSortedRunMerger::_need_more_data(MergeSortCursor& current) {
     if (!current->is_last(0)) {
         _priority_queue.push(current);
@@ -36,7 +36,9 @@ namespace doris::vectorized {
 // VSortedRunMerger is used to merge multiple sorted runs of blocks. A run is a sorted
 // sequence of blocks, which are fetched from a BlockSupplier function object.
 // Merging is implemented using a binary min-heap that maintains the run with the next
-// rows in sorted order at the top of the heap.
+// rows in sorted order at the top of the heap. The rows of the top run which still sort
+// before the next run are taken at once, so a heap operation is paid per run of rows
+// rather than per row.
 //
 // Merged block of rows are retrieved from VSortedRunMerger via calls to get_next().
 class VSortedRunMerger {
@@ -86,12 +88,21 @@ protected:
     // Times calls to get the next batch of rows from the input run.
     RuntimeProfile::Counter* _get_next_block_timer = nullptr;
 
+    // consecutive rows of one input taken into the merged block
+    struct MergedRun {
+        Block* block;
+        size_t start;
+        size_t length;
+    };
+    std::vector<MergedRun> _runs;
     std::vector<size_t> _indexs;
-    std::vector<Block*> _block_addrs;
     std::vector<const IColumn*> _column_addrs;
 
 private:
     void init_timers(RuntimeProfile* profile);
+    // The number of rows of current, at most max_rows, which are merged before the rows of
+    // the other runs in the queue.
+    size_t _run_length(const MergeSortCursor& current, size_t max_rows) const;
     // If current stream is exhausted and not eof, we should break this loop and read more blocks.
     bool _need_more_data(MergeSortCursor& current);
 };
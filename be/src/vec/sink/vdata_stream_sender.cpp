@@ -133,6 +133,7 @@ Status Channel::add_rows(Block* block, const uint32_t* data, const uint32_t offs
     if (_fragment_instance_id.lo == -1) {
         return Status::OK();
     }
+    _num_rows_added += size;
 
     bool serialized = false;
     if (_pblock == nullptr) {
@@ -330,13 +331,44 @@ Status BlockSerializer::_serialize_block(PBlock* dest, size_t num_receivers) {
     return Status::OK();
 }
 
+segment_v2::CompressionTypePB BlockSerializer::_compression_type() {
+    auto compression_type = _parent->compression_type();
+    if (compression_type == segment_v2::CompressionTypePB::NO_COMPRESSION ||
+        !config::enable_exchange_adaptive_compression) {
+        return compression_type;
+    }
+    if (_skip_compression_blocks > 0) {
+        --_skip_compression_blocks;
+        return segment_v2::CompressionTypePB::NO_COMPRESSION;
+    }
+    return compression_type;
+}
+
+void BlockSerializer::_update_compression_skip(size_t uncompressed_bytes,
+                                               size_t compressed_bytes) {
+    static constexpr int max_skip_compression_blocks = 64;
+    // Compressing costs CPU on both sides, it only pays off when it saves at least 10%.
+    if (compressed_bytes * 10 >= uncompressed_bytes * 9) {
+        _skip_compression_blocks = _skip_compression_backoff;
+        _skip_compression_backoff =
+                std::min(_skip_compression_backoff * 2, max_skip_compression_blocks);
+    } else {
+        _skip_compression_backoff = 1;
+    }
+}
+
 Status BlockSerializer::serialize_block(const Block* src, PBlock* dest, size_t num_receivers) {
     SCOPED_TIMER(_parent->_serialize_batch_timer);
     dest->Clear();
     size_t uncompressed_bytes = 0, compressed_bytes = 0;
+    auto compression_type = _compression_type();
     RETURN_IF_ERROR(src->serialize(_parent->_state->be_exec_version(), dest, &uncompressed_bytes,
-                                   &compressed_bytes, _parent->compression_type(),
+                                   &compressed_bytes, compression_type,
                                    _parent->transfer_large_data_by_brpc()));
+    if (compression_type != segment_v2::CompressionTypePB::NO_COMPRESSION &&
+        uncompressed_bytes > 0) {
+        _update_compression_skip(uncompressed_bytes, compressed_bytes);
+    }
     COUNTER_UPDATE(_parent->_bytes_sent_counter, compressed_bytes * num_receivers);
     COUNTER_UPDATE(_parent->_uncompressed_bytes_counter, uncompressed_bytes * num_receivers);
     COUNTER_UPDATE(_parent->_compress_timer, src->get_compress_time());
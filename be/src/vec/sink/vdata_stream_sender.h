@@ -97,9 +97,15 @@ public:
 
 private:
     Status _serialize_block(PBlock* dest, size_t num_receivers = 1);
+    segment_v2::CompressionTypePB _compression_type();
+    void _update_compression_skip(size_t uncompressed_bytes, size_t compressed_bytes);
 
     pipeline::ExchangeSinkLocalState* _parent;
     std::unique_ptr<MutableBlock> _mutable_block;
+    // Blocks left to send uncompressed, because the last compressed one saved too little.
+    int _skip_compression_blocks = 0;
+    // Blocks to skip after the next poorly compressed one, doubled on every such block.
+    int _skip_compression_backoff = 1;
 
     bool _is_local;
     const int _batch_size;
@@ -161,6 +167,9 @@ public:
     Status add_rows(Block* block, const uint32_t* data, const uint32_t offset, const uint32_t size,
                     bool eos);
 
+    // Rows partitioned into this channel by add_rows().
+    int64_t num_rows_added() const { return _num_rows_added; }
+
     void set_exchange_buffer(pipeline::ExchangeSinkBuffer* buffer) { _buffer = buffer; }
 
     InstanceLoId dest_ins_id() const { return _fragment_instance_id.lo; }
@@ -218,6 +227,7 @@ private:
     bool _eos_send = false;
     std::shared_ptr<pipeline::ExchangeSendCallback<PTransmitDataResult>> _send_callback;
     std::unique_ptr<PBlock> _pblock;
+    int64_t _num_rows_added = 0;
 };
 
 #define HANDLE_CHANNEL_STATUS(state, channel, status)    \
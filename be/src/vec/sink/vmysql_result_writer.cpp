@@ -184,11 +184,6 @@ Status VMysqlResultWriter<is_binary_format>::_write_one_block(RuntimeState* stat
     uint64_t bytes_sent = 0;
     {
         SCOPED_TIMER(_convert_tuple_timer);
-        MysqlRowBuffer<is_binary_format> row_buffer;
-        if constexpr (is_binary_format) {
-            row_buffer.start_binary_row(_output_vexpr_ctxs.size());
-        }
-
         struct Arguments {
             const IColumn* column;
             bool is_const;
@@ -233,19 +228,58 @@ Status VMysqlResultWriter<is_binary_format>::_write_one_block(RuntimeState* stat
             }
         }
 
-        for (int row_idx = 0; row_idx < num_rows; ++row_idx) {
+        if constexpr (is_binary_format) {
+            // every binary row starts with its own null bitmap, so it is built row by row
+            MysqlRowBuffer<is_binary_format> row_buffer;
+            row_buffer.start_binary_row(num_cols);
+            for (int row_idx = 0; row_idx < num_rows; ++row_idx) {
+                for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
+                    RETURN_IF_ERROR(arguments[col_idx].serde->write_column_to_mysql(
+                            *(arguments[col_idx].column), row_buffer, row_idx,
+                            arguments[col_idx].is_const, _options));
+                }
+
+                // copy MysqlRowBuffer to Thrift
+                result->result_batch.rows[row_idx].append(row_buffer.buf(), row_buffer.length());
+                bytes_sent += row_buffer.length();
+                row_buffer.reset();
+                row_buffer.start_binary_row(num_cols);
+            }
+        } else {
+            // Text rows are a plain concatenation of their cells, so serialize column by column:
+            // all cells of a column go through one serde into one buffer, which keeps the
+            // dispatch monomorphic, and each row is then assembled with its exact size known.
+            std::vector<std::unique_ptr<MysqlRowBuffer<is_binary_format>>> column_buffers(
+                    num_cols);
+            const auto rows = static_cast<size_t>(num_rows);
+            std::vector<int64_t> cell_ends(num_cols * rows);
             for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
-                RETURN_IF_ERROR(arguments[col_idx].serde->write_column_to_mysql(
-                        *(arguments[col_idx].column), row_buffer, row_idx,
-                        arguments[col_idx].is_const, _options));
+                column_buffers[col_idx] = std::make_unique<MysqlRowBuffer<is_binary_format>>();
+                auto& column_buffer = *column_buffers[col_idx];
+                int64_t* ends = cell_ends.data() + col_idx * rows;
+                for (int row_idx = 0; row_idx < num_rows; ++row_idx) {
+                    RETURN_IF_ERROR(arguments[col_idx].serde->write_column_to_mysql(
+                            *(arguments[col_idx].column), column_buffer, row_idx,
+                            arguments[col_idx].is_const, _options));
+                    ends[row_idx] = column_buffer.length();
+                }
             }
 
-            // copy MysqlRowBuffer to Thrift
-            result->result_batch.rows[row_idx].append(row_buffer.buf(), row_buffer.length());
-            bytes_sent += row_buffer.length();
-            row_buffer.reset();
-            if constexpr (is_binary_format) {
-                row_buffer.start_binary_row(_output_vexpr_ctxs.size());
+            for (int row_idx = 0; row_idx < num_rows; ++row_idx) {
+                int64_t row_length = 0;
+                for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
+                    const int64_t* ends = cell_ends.data() + col_idx * rows;
+                    row_length += ends[row_idx] - (row_idx == 0 ? 0 : ends[row_idx - 1]);
+                }
+                auto& row = result->result_batch.rows[row_idx];
+                row.reserve(static_cast<size_t>(row_length));
+                for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
+                    const int64_t* ends = cell_ends.data() + col_idx * rows;
+                    const int64_t begin = row_idx == 0 ? 0 : ends[row_idx - 1];
+                    row.append(column_buffers[col_idx]->buf() + begin,
+                               static_cast<size_t>(ends[row_idx] - begin));
+                }
+                bytes_sent += static_cast<uint64_t>(row_length);
             }
         }
     }
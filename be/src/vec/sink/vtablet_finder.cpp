@@ -37,9 +37,7 @@ Status OlapTabletFinder::find_tablets(RuntimeState* state, Block* block, int row
                                       std::vector<VOlapTablePartition*>& partitions,
                                       std::vector<uint32_t>& tablet_index, std::vector<bool>& skip,
                                       std::vector<int64_t>* miss_rows) {
-    for (int index = 0; index < rows; index++) {
-        _vpartition->find_partition(block, index, partitions[index]);
-    }
+    _vpartition->find_partitions(block, rows, partitions);
 
     std::vector<uint32_t> qualified_rows;
     qualified_rows.reserve(rows);
@@ -76,6 +76,16 @@ Status VWalWriter::write_wal(vectorized::Block* block) {
     return Status::OK();
 }
 
+Status VWalWriter::sync_wal() {
+    if (!config::group_commit_sync_wal_on_append || _wal_writer == nullptr) {
+        return Status::OK();
+    }
+    if (_wal_syncer == nullptr) {
+        return _wal_writer->sync();
+    }
+    return _wal_syncer->sync(_wal_writer);
+}
+
 Status VWalWriter::close() {
     if (config::group_commit_wait_replay_wal_finish) {
         std::string wal_path;
@@ -95,6 +105,7 @@ Status VWalWriter::_create_wal_writer(int64_t wal_id, std::shared_ptr<WalWriter>
     RETURN_IF_ERROR(_wal_manager->get_wal_path(wal_id, wal_path));
     wal_writer = std::make_shared<WalWriter>(wal_path);
     RETURN_IF_ERROR(wal_writer->init());
+    _wal_syncer = _wal_manager->get_wal_syncer(wal_path);
     return Status::OK();
 }
 } // namespace vectorized
@@ -35,6 +35,8 @@ public:
     ~VWalWriter();
     Status init();
     Status write_wal(vectorized::Block* block);
+    // Wait until the blocks written so far are durable, if group_commit_sync_wal_on_append.
+    Status sync_wal();
     Status close();
 
 private:
@@ -49,6 +51,7 @@ private:
     std::vector<TSlotDescriptor>& _slot_descs;
     int _be_exe_version = 0;
     std::shared_ptr<WalWriter> _wal_writer;
+    WalSyncer* _wal_syncer = nullptr;
 };
 } // namespace vectorized
 } // namespace doris
\ No newline at end of file
@@ -22,12 +22,14 @@
 #include <algorithm>
 
 #include "common/cast_set.h"
+#include "common/config.h"
 #include "common/exception.h"
 #include "io/file_factory.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/local_file_system.h"
 #include "runtime/exec_env.h"
 #include "util/slice.h"
+#include "util/threadpool.h"
 #include "vec/core/block.h"
 #include "vec/spill/spill_stream_manager.h"
 namespace doris {
@@ -96,12 +98,72 @@ Status SpillReader::open() {
     }
     block_start_offsets_[block_count_] = file_size - (block_count_ + 2) * sizeof(size_t);
 
+    read_ahead_blocks_ =
+            block_count_ > 1 ? cast_set<size_t>(std::max(config::spill_read_ahead_blocks, 0)) : 0;
+    read_ahead_index_ = read_block_index_;
+
     return Status::OK();
 }
 
 void SpillReader::seek(size_t block_index) {
     DCHECK_LT(block_index, block_count_);
     read_block_index_ = block_index;
+    if (!read_ahead_queue_.empty() && read_ahead_queue_.front()->block_index != block_index) {
+        _reset_read_ahead();
+    }
+    if (read_ahead_queue_.empty()) {
+        read_ahead_index_ = block_index;
+    }
+}
+
+void SpillReader::_submit_read_ahead() {
+    auto* spill_io_pool = ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool();
+    // the current block is also in the queue
+    while (read_ahead_queue_.size() <= read_ahead_blocks_ && read_ahead_index_ < block_count_) {
+        auto read_ahead_block = std::make_shared<ReadAheadBlock>();
+        read_ahead_block->block_index = read_ahead_index_;
+        read_ahead_block->offset = block_start_offsets_[read_ahead_index_];
+        // allocate in the query thread so the memory is tracked by the query
+        read_ahead_block->buff.resize(block_start_offsets_[read_ahead_index_ + 1] -
+                                      read_ahead_block->offset);
+        read_ahead_block->claimed = std::make_shared<std::atomic<bool>>(false);
+        ++read_ahead_index_;
+
+        auto promise = std::make_shared<std::promise<Status>>();
+        read_ahead_block->future = promise->get_future();
+        if (spill_io_pool != nullptr) {
+            // `block` is only touched after claiming it, the reader waits for the future then.
+            static_cast<void>(spill_io_pool->submit_func(
+                    [file_reader = file_reader_, block = read_ahead_block.get(),
+                     claimed = read_ahead_block->claimed, promise]() {
+                        if (claimed->exchange(true)) {
+                            return;
+                        }
+                        Slice result(block->buff.data(), block->buff.size());
+                        promise->set_value(file_reader->read_at(block->offset, result,
+                                                                &block->bytes_read));
+                    }));
+        }
+        read_ahead_queue_.emplace_back(std::move(read_ahead_block));
+    }
+}
+
+Status SpillReader::_wait_read_ahead(ReadAheadBlock& block, bool need_data) {
+    if (!block.claimed->exchange(true)) {
+        if (!need_data) {
+            return Status::OK();
+        }
+        Slice result(block.buff.data(), block.buff.size());
+        return file_reader_->read_at(block.offset, result, &block.bytes_read);
+    }
+    return block.future.get();
+}
+
+void SpillReader::_reset_read_ahead() {
+    for (auto& block : read_ahead_queue_) {
+        static_cast<void>(_wait_read_ahead(*block, false));
+    }
+    read_ahead_queue_.clear();
 }
 
 Status SpillReader::read(Block* block, bool* eos) {
@@ -117,13 +179,33 @@ Status SpillReader::read(Block* block, bool* eos) {
             block_start_offsets_[read_block_index_ + 1] - block_start_offsets_[read_block_index_];
 
     if (bytes_to_read == 0) {
+        if (!read_ahead_queue_.empty() &&
+            read_ahead_queue_.front()->block_index == read_block_index_) {
+            static_cast<void>(_wait_read_ahead(*read_ahead_queue_.front(), false));
+            read_ahead_queue_.pop_front();
+        }
         ++read_block_index_;
         return Status::OK();
     }
 
     Slice result(read_buff_.data(), bytes_to_read);
     size_t bytes_read = 0;
-    {
+    ReadAheadBlockSPtr read_ahead_block;
+    if (read_ahead_blocks_ > 0) {
+        _submit_read_ahead();
+        DCHECK(!read_ahead_queue_.empty());
+        read_ahead_block = std::move(read_ahead_queue_.front());
+        read_ahead_queue_.pop_front();
+        DCHECK_EQ(read_ahead_block->block_index, read_block_index_);
+        {
+            SCOPED_TIMER(_read_file_timer);
+            RETURN_IF_ERROR(_wait_read_ahead(*read_ahead_block, true));
+        }
+        result.data = read_ahead_block->buff.data();
+        bytes_read = read_ahead_block->bytes_read;
+        // keep the next blocks loading while this one is deserialized
+        _submit_read_ahead();
+    } else {
         SCOPED_TIMER(_read_file_timer);
         RETURN_IF_ERROR(file_reader_->read_at(block_start_offsets_[read_block_index_], result,
                                               &bytes_read));
@@ -159,6 +241,7 @@ Status SpillReader::close() {
     if (!file_reader_) {
         return Status::OK();
     }
+    _reset_read_ahead();
     (void)file_reader_->close();
     file_reader_.reset();
     return Status::OK();
@@ -19,6 +19,9 @@
 
 #include <gen_cpp/data.pb.h>
 
+#include <atomic>
+#include <deque>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -70,6 +73,27 @@ public:
     }
 
 private:
+    // A block whose file data is read by the spill io thread pool ahead of `read`.
+    // Whoever sets `claimed` first, the io task or the reader, reads the data. So a reader
+    // which runs in the spill io thread pool itself never waits for a task queued behind it.
+    struct ReadAheadBlock {
+        size_t block_index = 0;
+        size_t offset = 0;
+        size_t bytes_read = 0;
+        PaddedPODArray<char> buff;
+        std::shared_ptr<std::atomic<bool>> claimed;
+        std::future<Status> future;
+    };
+    using ReadAheadBlockSPtr = std::shared_ptr<ReadAheadBlock>;
+
+    // Keep up to `read_ahead_blocks_` blocks after the current one in flight.
+    void _submit_read_ahead();
+    // Wait for the data of the block, read it in place if the io task has not started yet.
+    // With `need_data` false an unstarted read is skipped instead.
+    Status _wait_read_ahead(ReadAheadBlock& block, bool need_data);
+    // Wait for the in flight reads and drop them, the buffers are referenced by the io tasks.
+    void _reset_read_ahead();
+
     int64_t stream_id_;
     std::string file_path_;
     io::FileReaderSPtr file_reader_;
@@ -82,6 +106,11 @@ private:
 
     PBlock pb_block_;
 
+    size_t read_ahead_blocks_ = 0;
+    // index of the next block to submit to the read ahead queue
+    size_t read_ahead_index_ = 0;
+    std::deque<ReadAheadBlockSPtr> read_ahead_queue_;
+
     RuntimeProfile::Counter* _read_file_timer = nullptr;
     RuntimeProfile::Counter* _deserialize_timer = nullptr;
     RuntimeProfile::Counter* _read_block_count = nullptr;
@@ -27,6 +27,7 @@
 #include <random>
 #include <string>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "io/fs/file_system.h"
 #include "io/fs/local_file_system.h"
@@ -140,8 +141,12 @@ std::vector<SpillDataDir*> SpillStreamManager::_get_stores_for_spill(
         return {};
     }
 
-    std::sort(stores_with_usage.begin(), stores_with_usage.end(),
-              [](auto&& a, auto&& b) { return a.second < b.second; });
+    if (config::enable_spill_load_aware_placement && stores_with_usage.size() > 1) {
+        _sort_stores_by_load(stores_with_usage);
+    } else {
+        std::sort(stores_with_usage.begin(), stores_with_usage.end(),
+                  [](auto&& a, auto&& b) { return a.second < b.second; });
+    }
 
     std::vector<SpillDataDir*> stores;
     for (const auto& [store, _] : stores_with_usage) {
@@ -150,6 +155,48 @@ std::vector<SpillDataDir*> SpillStreamManager::_get_stores_for_spill(
     return stores;
 }
 
+// Order the dirs by the expected time a new stream waits for its disk: the active writers
+// including the new one divided by the recent write throughput. Dirs without throughput yet
+// are assumed as fast as the fastest one. The streams of one query are spread over all disks
+// this way, instead of all going to the disk with the most free space. Equally loaded dirs are
+// taken round robin.
+void SpillStreamManager::_sort_stores_by_load(
+        std::vector<std::pair<SpillDataDir*, double>>& stores_with_usage) {
+    const size_t store_count = stores_with_usage.size();
+    std::vector<double> throughputs(store_count);
+    double max_throughput = 0;
+    for (size_t i = 0; i < store_count; ++i) {
+        throughputs[i] = stores_with_usage[i].first->write_throughput();
+        max_throughput = std::max(max_throughput, throughputs[i]);
+    }
+    if (max_throughput == 0) {
+        max_throughput = 1;
+    }
+
+    const auto round = _placement_round++;
+    // stores_with_usage: <store, disk usage>, replaced by <store, load score> here
+    for (size_t i = 0; i < store_count; ++i) {
+        auto& [store, score] = stores_with_usage[i];
+        const auto throughput = throughputs[i] > 0 ? throughputs[i] : max_throughput;
+        score = static_cast<double>(store->active_writers() + 1) / throughput;
+    }
+    std::vector<size_t> order(store_count);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        if (stores_with_usage[a].second != stores_with_usage[b].second) {
+            return stores_with_usage[a].second < stores_with_usage[b].second;
+        }
+        return (a + store_count - round % store_count) % store_count <
+               (b + store_count - round % store_count) % store_count;
+    });
+    std::vector<std::pair<SpillDataDir*, double>> sorted;
+    sorted.reserve(store_count);
+    for (auto i : order) {
+        sorted.emplace_back(stores_with_usage[i]);
+    }
+    stores_with_usage.swap(sorted);
+}
+
 Status SpillStreamManager::register_spill_stream(RuntimeState* state, SpillStreamSPtr& spill_stream,
                                                  const std::string& query_id,
                                                  const std::string& operator_name, int32_t node_id,
@@ -413,13 +460,30 @@ bool SpillDataDir::reach_capacity_limit(int64_t incoming_data_size) {
     }
     return false;
 }
+
+void SpillDataDir::update_write_throughput(int64_t bytes, int64_t time_ns) {
+    if (bytes <= 0 || time_ns <= 0) {
+        return;
+    }
+    const double throughput =
+            static_cast<double>(bytes) * 1e9 / static_cast<double>(time_ns); // bytes per second
+    std::lock_guard<std::mutex> l(_mutex);
+    // weight of the newest sample, the estimation follows a changed disk load within tens of writes
+    constexpr double NEW_SAMPLE_WEIGHT = 0.1;
+    _write_bytes_per_second = _write_bytes_per_second == 0
+                                      ? throughput
+                                      : _write_bytes_per_second * (1 - NEW_SAMPLE_WEIGHT) +
+                                                throughput * NEW_SAMPLE_WEIGHT;
+}
+
 std::string SpillDataDir::debug_string() {
     return fmt::format(
             "path: {}, capacity: {}, limit: {}, used: {}, available: "
-            "{}",
+            "{}, active writers: {}, write throughput: {}/s",
             _path, PrettyPrinter::print_bytes(_disk_capacity_bytes),
             PrettyPrinter::print_bytes(_spill_data_limit_bytes),
             PrettyPrinter::print_bytes(_spill_data_bytes),
-            PrettyPrinter::print_bytes(_available_bytes));
+            PrettyPrinter::print_bytes(_available_bytes), _active_writers.load(),
+            PrettyPrinter::print_bytes(static_cast<int64_t>(_write_bytes_per_second)));
 }
 } // namespace doris::vectorized
@@ -79,6 +79,20 @@ public:
         return _spill_data_limit_bytes;
     }
 
+    // Number of spill writers currently writing to this dir, used as the queue depth of the disk.
+    void add_active_writer(int64_t delta) { _active_writers.fetch_add(delta); }
+
+    int64_t active_writers() const { return _active_writers.load(); }
+
+    // Feed the time of one spill write into the write throughput estimation of the disk.
+    void update_write_throughput(int64_t bytes, int64_t time_ns);
+
+    // Bytes per second written recently, 0 if nothing is written yet.
+    double write_throughput() {
+        std::lock_guard<std::mutex> l(_mutex);
+        return _write_bytes_per_second;
+    }
+
     std::string debug_string();
 
 private:
@@ -101,6 +115,9 @@ private:
     // the actual available capacity of the disk of this data dir
     size_t _available_bytes = 0;
     int64_t _spill_data_bytes = 0;
+    // exponential moving average of the write throughput
+    double _write_bytes_per_second = 0;
+    std::atomic<int64_t> _active_writers = 0;
     TStorageMedium::type _storage_medium;
 
     std::shared_ptr<MetricEntity> spill_data_dir_metric_entity;
@@ -152,6 +169,7 @@ private:
     Status _init_spill_store_map();
     void _spill_gc_thread_callback();
     std::vector<SpillDataDir*> _get_stores_for_spill(TStorageMedium::type storage_medium);
+    void _sort_stores_by_load(std::vector<std::pair<SpillDataDir*, double>>& stores_with_usage);
 
     std::unordered_map<std::string, std::unique_ptr<SpillDataDir>> _spill_store_map;
 
@@ -160,6 +178,8 @@ private:
     scoped_refptr<Thread> _spill_gc_thread;
 
     std::atomic_uint64_t id_ = 0;
+    // rotates the start of the placement among equally loaded dirs
+    std::atomic_uint64_t _placement_round = 0;
 
     std::shared_ptr<MetricEntity> _entity {nullptr};
 
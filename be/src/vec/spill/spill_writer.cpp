@@ -18,21 +18,42 @@
 #include "vec/spill/spill_writer.h"
 
 #include "agent/be_exec_version_manager.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "io/fs/local_file_system.h"
 #include "io/fs/local_file_writer.h"
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
+#include "util/stopwatch.hpp"
 #include "vec/spill/spill_stream_manager.h"
 
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
+static segment_v2::CompressionTypePB spill_compression_type() {
+    const auto& codec = config::spill_block_compression_codec;
+    if (codec == "lz4") {
+        return segment_v2::CompressionTypePB::LZ4;
+    } else if (codec == "none") {
+        return segment_v2::CompressionTypePB::NO_COMPRESSION;
+    }
+    return segment_v2::CompressionTypePB::ZSTD; // ZSTD for better compression ratio
+}
+
+SpillWriter::~SpillWriter() {
+    if (active_on_data_dir_) {
+        data_dir_->add_active_writer(-1);
+    }
+}
+
 Status SpillWriter::open() {
     if (file_writer_) {
         return Status::OK();
     }
-    return io::global_local_filesystem()->create_file(file_path_, &file_writer_);
+    RETURN_IF_ERROR(io::global_local_filesystem()->create_file(file_path_, &file_writer_));
+    data_dir_->add_active_writer(1);
+    active_on_data_dir_ = true;
+    return Status::OK();
 }
 
 Status SpillWriter::close() {
@@ -40,6 +61,10 @@ Status SpillWriter::close() {
         return Status::OK();
     }
     closed_ = true;
+    if (active_on_data_dir_) {
+        data_dir_->add_active_writer(-1);
+        active_on_data_dir_ = false;
+    }
 
     meta_.append((const char*)&max_sub_block_size_, sizeof(max_sub_block_size_));
     meta_.append((const char*)&written_blocks_, sizeof(written_blocks_));
@@ -115,10 +140,9 @@ Status SpillWriter::_write_internal(const Block& block, size_t& written_bytes) {
         {
             PBlock pblock;
             SCOPED_TIMER(_serialize_timer);
-            status = block.serialize(
-                    BeExecVersionManager::get_newest_version(), &pblock, &uncompressed_bytes,
-                    &compressed_bytes,
-                    segment_v2::CompressionTypePB::ZSTD); // ZSTD for better compression ratio
+            status = block.serialize(BeExecVersionManager::get_newest_version(), &pblock,
+                                     &uncompressed_bytes, &compressed_bytes,
+                                     spill_compression_type());
             RETURN_IF_ERROR(status);
             int64_t pblock_mem = pblock.ByteSizeLong();
             COUNTER_UPDATE(_memory_used_counter, pblock_mem);
@@ -165,8 +189,12 @@ Status SpillWriter::_write_internal(const Block& block, size_t& written_bytes) {
             }};
             {
                 SCOPED_TIMER(_write_file_timer);
+                MonotonicStopWatch write_watch;
+                write_watch.start();
                 status = file_writer_->append(buff);
                 RETURN_IF_ERROR(status);
+                data_dir_->update_write_throughput(
+                        buff_size, static_cast<int64_t>(write_watch.elapsed_time()));
             }
         }
     }
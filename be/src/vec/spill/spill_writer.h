@@ -47,6 +47,8 @@ public:
         _memory_used_counter = common_profile->get_counter("MemoryUsage");
     }
 
+    ~SpillWriter();
+
     Status open();
 
     Status close();
@@ -77,6 +79,8 @@ private:
     // for checking disk capacity when write data to disk.
     SpillDataDir* data_dir_ = nullptr;
     std::atomic_bool closed_ = false;
+    // counted in the active writers of `data_dir_` between open and close
+    bool active_on_data_dir_ = false;
     int64_t stream_id_;
     size_t batch_size_;
     size_t max_sub_block_size_ = 0;
@@ -0,0 +1,46 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "cloud/cloud_tablet_hotspot.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "cloud/cloud_storage_engine.h"
+#include "cloud/cloud_tablet.h"
+#include "olap/tablet_meta.h"
+
+namespace doris {
+
+TEST(CloudTabletHotspotTest, RecentlyAccessed) {
+    CloudStorageEngine engine({});
+    TabletMetaSharedPtr tablet_meta(new TabletMeta(1, 2, 15673, 15674, 4, 5, TTabletSchema(), 6,
+                                                   {{7, 8}}, UniqueId(9, 10),
+                                                   TTabletType::TABLET_TYPE_DISK,
+                                                   TCompressionType::LZ4F));
+    auto tablet = std::make_shared<CloudTablet>(engine, tablet_meta);
+
+    TabletHotspot hotspot;
+    EXPECT_FALSE(hotspot.is_recently_accessed(tablet->tablet_id(), 3600));
+    hotspot.count(*tablet);
+    EXPECT_TRUE(hotspot.is_recently_accessed(tablet->tablet_id(), 3600));
+    EXPECT_FALSE(hotspot.is_recently_accessed(tablet->tablet_id(), 0));
+    EXPECT_FALSE(hotspot.is_recently_accessed(tablet->tablet_id() + 1, 3600));
+}
+
+} // namespace doris
@@ -68,6 +68,29 @@ void test_find(HashMethodType& method, Columns column, const std::vector<int64_t
     }
 }
 
+// keys sorted by runs, the equal adjacent keys take the place of the row before them
+template <typename HashMethodType>
+void test_lazy_emplace_batch(HashMethodType& method, Columns columns,
+                             const std::vector<IColumn::ColumnIndex>& expect_places) {
+    using State = typename HashMethodType::State;
+    ColumnRawPtrs key_raw_columns;
+    for (auto column : columns) {
+        key_raw_columns.push_back(column.get());
+    }
+    State state(key_raw_columns);
+    const size_t rows = key_raw_columns[0]->size();
+    method.init_serialized_keys(key_raw_columns, rows);
+
+    IColumn::ColumnIndex created = 0;
+    auto creator = [&](const auto& ctor, auto& key, auto& origin) { ctor(key, created++); };
+    auto creator_for_null_key = [&](auto& mapped) {
+        throw doris::Exception(ErrorCode::INTERNAL_ERROR, "no null key"); // NOLINT
+    };
+    std::vector<IColumn::ColumnIndex> places(rows);
+    lazy_emplace_batch(method, state, rows, creator, creator_for_null_key, places.data());
+    EXPECT_EQ(expect_places, places);
+}
+
 TEST(HashTableMethodTest, testMethodOneNumber) {
     MethodOneNumber<UInt32, PHHashMap<UInt32, IColumn::ColumnIndex, HashCRC32<UInt32>>> method;
 
@@ -115,6 +138,16 @@ TEST(HashTableMethodTest, testMethodSerialized) {
               {0, 1, -1, 3, -1, 4});
 }
 
+TEST(HashTableMethodTest, testMethodSerializedEmplaceBatch) {
+    MethodSerialized<StringHashMap<IColumn::ColumnIndex>> method;
+
+    test_lazy_emplace_batch(
+            method,
+            {ColumnHelper::create_column<DataTypeInt32>({1, 1, 1, 2, 2, 1}),
+             ColumnHelper::create_column<DataTypeString>({"a", "a", "b", "b", "b", "a"})},
+            {0, 0, 1, 2, 2, 0});
+}
+
 TEST(HashTableMethodTest, testMethodStringNoCache) {
     MethodStringNoCache<StringHashMap<IColumn::ColumnIndex>> method;
 
@@ -127,4 +160,12 @@ TEST(HashTableMethodTest, testMethodStringNoCache) {
               {0, 1, -1, 3, -1, 4});
 }
 
+TEST(HashTableMethodTest, testMethodStringNoCacheEmplaceBatch) {
+    MethodStringNoCache<StringHashMap<IColumn::ColumnIndex>> method;
+
+    test_lazy_emplace_batch(
+            method, {ColumnHelper::create_column<DataTypeString>({"a", "a", "", "", "b", "a"})},
+            {0, 0, 1, 1, 2, 0});
+}
+
 } // namespace doris::vectorized
\ No newline at end of file
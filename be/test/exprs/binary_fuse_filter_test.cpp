@@ -0,0 +1,103 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "exprs/binary_fuse_filter.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace doris {
+
+TEST(BinaryFuseFilterTest, FindInsertedKeys) {
+    for (size_t n : {1, 2, 3, 10, 1000, 100000}) {
+        std::mt19937_64 rng(n);
+        std::vector<uint64_t> keys(n);
+        for (auto& key : keys) {
+            key = rng();
+        }
+        BinaryFuseFilter8 filter;
+        ASSERT_TRUE(filter.init(keys).ok()) << n;
+        for (auto key : keys) {
+            EXPECT_TRUE(filter.find(key)) << n;
+        }
+        std::vector<uint8_t> results(n);
+        filter.find_batch(keys.data(), n, results.data());
+        EXPECT_TRUE(std::all_of(results.begin(), results.end(), [](uint8_t r) { return r; }));
+    }
+}
+
+TEST(BinaryFuseFilterTest, FalsePositiveRate) {
+    std::mt19937_64 rng(0);
+    std::vector<uint64_t> keys(100000);
+    for (auto& key : keys) {
+        key = rng();
+    }
+    BinaryFuseFilter8 filter;
+    ASSERT_TRUE(filter.init(keys).ok());
+    // About 9.5 bits per key at this size.
+    EXPECT_LT(filter.size_in_bytes(), keys.size() * 10 / 8);
+
+    size_t false_positives = 0;
+    size_t probes = 1000000;
+    for (size_t i = 0; i < probes; ++i) {
+        false_positives += filter.find(rng());
+    }
+    // The expected rate is 1/256.
+    EXPECT_LT(false_positives, probes / 100);
+}
+
+TEST(BinaryFuseFilterTest, EmptyAndDuplicates) {
+    BinaryFuseFilter8 empty;
+    ASSERT_TRUE(empty.init({}).ok());
+    EXPECT_FALSE(empty.find(0));
+    EXPECT_EQ(empty.size_in_bytes(), 0);
+
+    BinaryFuseFilter8 filter;
+    ASSERT_TRUE(filter.init(std::vector<uint64_t>(1000, 7)).ok());
+    EXPECT_TRUE(filter.find(7));
+}
+
+TEST(BinaryFuseFilterTest, Serialize) {
+    std::vector<uint64_t> keys(1000);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        keys[i] = i * 31;
+    }
+    BinaryFuseFilter8 filter;
+    ASSERT_TRUE(filter.init(keys).ok());
+    std::string data;
+    filter.serialize(&data);
+
+    BinaryFuseFilter8 other;
+    ASSERT_TRUE(other.init_from_data(data.data(), data.size()).ok());
+    for (auto key : keys) {
+        EXPECT_TRUE(other.find(key));
+    }
+    EXPECT_FALSE(other.init_from_data(data.data(), data.size() - 1).ok());
+    EXPECT_FALSE(other.init_from_data(data.data(), 8).ok());
+
+    BinaryFuseFilter8 empty;
+    ASSERT_TRUE(empty.init({}).ok());
+    empty.serialize(&data);
+    ASSERT_TRUE(other.init_from_data(data.data(), data.size()).ok());
+    EXPECT_FALSE(other.find(0));
+}
+
+} // namespace doris
@@ -22,6 +22,8 @@
 
 #include <memory>
 
+#include "exprs/regexp_cache.h"
+
 namespace doris {
 
 class StringFunctionsTest : public ::testing::Test {
@@ -121,4 +123,34 @@ TEST_F(StringFunctionsTest, TestCompileRegex) {
     EXPECT_TRUE(re->options().dot_nl());
 }
 
-} // namespace doris
\ No newline at end of file
+TEST_F(StringFunctionsTest, TestCompileSharedRegex) {
+    std::string error_str;
+    std::shared_ptr<re2::RE2> re;
+    EXPECT_TRUE(StringFunctions::compile_regex(create_string_ref("a.c"), &error_str,
+                                               create_string_ref(""), create_string_ref(""), re));
+    EXPECT_TRUE(re != nullptr);
+    EXPECT_TRUE(re2::RE2::FullMatch("abc", *re));
+
+    EXPECT_FALSE(StringFunctions::compile_regex(create_string_ref("a(bc"), &error_str,
+                                                create_string_ref(""), create_string_ref(""), re));
+    EXPECT_TRUE(re == nullptr);
+    EXPECT_FALSE(error_str.empty());
+}
+
+TEST_F(StringFunctionsTest, TestRegexpCache) {
+    RegexpCache cache(16);
+    EXPECT_NE(RegexpCache::make_key("regexp", "i", "abc"),
+              RegexpCache::make_key("regexp", "", "iabc"));
+    EXPECT_NE(RegexpCache::make_key("regexp", "", "abc"),
+              RegexpCache::make_key("regexp_fn", "", "abc"));
+
+    auto key = RegexpCache::make_key("regexp", "", "a+b");
+    EXPECT_TRUE(cache.lookup(key) == nullptr);
+    auto re = std::make_shared<re2::RE2>("a+b");
+    cache.insert(key, re);
+    auto cached = cache.lookup(key);
+    EXPECT_EQ(cached.get(), re.get());
+    EXPECT_TRUE(re2::RE2::FullMatch("aab", *cached));
+}
+
+} // namespace doris
@@ -341,6 +341,37 @@ TEST_F(BufferedReaderTest, test_read_amplify) {
     EXPECT_EQ(merge_reader.statistics().merged_bytes, 1024 * kb + 12 * kb);
 }
 
+TEST_F(BufferedReaderTest, test_wasted_bytes) {
+    size_t kb = 1024;
+    io::FileReaderSPtr offset_reader = std::make_shared<MockOffsetFileReader>(2048 * kb); // 2MB
+    std::vector<io::PrefetchRange> random_access_ranges;
+    random_access_ranges.emplace_back(0, 1 * kb);       // column0
+    random_access_ranges.emplace_back(3 * kb, 4 * kb);  // column1
+    random_access_ranges.emplace_back(5 * kb, 6 * kb);  // column2
+    random_access_ranges.emplace_back(7 * kb, 12 * kb); // column3
+
+    io::MergeRangeFileReader merge_reader(nullptr, offset_reader, random_access_ranges);
+    std::vector<char> data(12 * kb);
+    size_t bytes_read = 0;
+
+    // will merge column 0 ~ 3
+    static_cast<void>(merge_reader.read_at(0, Slice(data.data(), 1 * kb), &bytes_read, nullptr));
+    EXPECT_EQ(merge_reader.statistics().merged_bytes, 12 * kb);
+    EXPECT_EQ(merge_reader.statistics().wasted_bytes, 0);
+    // skip the first 512 bytes of column3
+    static_cast<void>(
+            merge_reader.read_at(7 * kb + 512, Slice(data.data(), 1 * kb), &bytes_read, nullptr));
+    EXPECT_EQ(bytes_read, 1 * kb);
+    EXPECT_EQ((uint8_t)data[0], (7 * kb + 512) % UCHAR_MAX);
+    EXPECT_EQ(merge_reader.statistics().wasted_bytes, 512);
+    // skip the first half of column1, e.g. the rows filtered by lazy read
+    static_cast<void>(merge_reader.read_at(3 * kb + 512, Slice(data.data(), 512), &bytes_read,
+                                           nullptr));
+    EXPECT_EQ(bytes_read, 512);
+    EXPECT_EQ(merge_reader.statistics().wasted_bytes, 1024);
+    EXPECT_EQ(merge_reader.statistics().merged_bytes, 12 * kb);
+}
+
 TEST_F(BufferedReaderTest, test_merged_io) {
     io::FileReaderSPtr offset_reader =
             std::make_shared<MockOffsetFileReader>(128 * 1024 * 1024); // 128MB
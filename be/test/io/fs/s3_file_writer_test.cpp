@@ -1470,4 +1470,30 @@ TEST_F(S3FileWriterTest, write_buffer_boundary) {
     // clang-format on
 }
 
+TEST_F(S3FileWriterTest, grow_first_buffer) {
+    bool enable_file_cache = config::enable_file_cache;
+    config::enable_file_cache = false;
+    Defer defer {[&]() { config::enable_file_cache = enable_file_cache; }};
+
+    auto sp = SyncPoint::get_instance();
+    sp->enable_processing();
+    sp->clear_all_call_backs();
+
+    // the buffer of the first part starts small and grows while appending small pieces
+    std::string content;
+    for (size_t i = 0; content.size() < config::s3_write_buffer_size + 1000; ++i) {
+        content += generate_test_string(char('a' + (i % 26)), 1000 + i);
+    }
+    std::string filename = "grow_first_buffer.dat";
+    auto [mock_client, s3_file_writer] = create_s3_client(filename);
+    for (size_t pos = 0, i = 0; pos < content.size(); ++i) {
+        size_t size = std::min(content.size() - pos, 1000 + i);
+        EXPECT_EQ(s3_file_writer->append({content.data() + pos, size}), Status::OK());
+        pos += size;
+    }
+    EXPECT_EQ(s3_file_writer->close(), Status::OK());
+    EXPECT_EQ(mock_client->upload_part_count, 2);
+    EXPECT_EQ(mock_client->objects[get_s3_path(filename)], content);
+}
+
 } // namespace doris
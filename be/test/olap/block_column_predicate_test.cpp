@@ -86,6 +86,56 @@ TEST_F(BlockColumnPredicateTest, SINGLE_COLUMN_VEC) {
     EXPECT_EQ(pred_col->get_data()[sel_idx[0]], value);
 }
 
+TEST_F(BlockColumnPredicateTest, SINGLE_COLUMN_VEC_DENSE_BATCHES) {
+    vectorized::MutableColumns block;
+    block.push_back(vectorized::PredicateColumnType<TYPE_INT>::create());
+
+    // more rows than one dense evaluate batch and not a multiple of the simd width
+    int rows = 1000;
+    int col_idx = 0;
+    std::unique_ptr<ColumnPredicate> pred(
+            new ComparisonPredicateBase<TYPE_INT, PredicateType::LT>(col_idx, 3));
+    SingleColumnBlockPredicate single_column_block_pred(pred.get());
+
+    std::vector<uint16_t> sel_idx(rows);
+    block[col_idx]->reserve(rows);
+    for (int i = 0; i < rows; i++) {
+        int value = i % 7;
+        block[col_idx]->insert_data((char*)&value, 0);
+        sel_idx[i] = i;
+    }
+
+    // dense: all rows are selected
+    uint16_t selected_size = single_column_block_pred.evaluate(block, sel_idx.data(), rows);
+    std::vector<uint16_t> expected;
+    for (int i = 0; i < rows; i++) {
+        if (i % 7 < 3) {
+            expected.push_back(i);
+        }
+    }
+    ASSERT_EQ(selected_size, expected.size());
+    for (uint16_t i = 0; i < selected_size; i++) {
+        EXPECT_EQ(sel_idx[i], expected[i]);
+    }
+
+    // sparse: only the even rows are selected
+    selected_size = 0;
+    for (int i = 0; i < rows; i += 2) {
+        sel_idx[selected_size++] = i;
+    }
+    selected_size = single_column_block_pred.evaluate(block, sel_idx.data(), selected_size);
+    expected.clear();
+    for (int i = 0; i < rows; i += 2) {
+        if (i % 7 < 3) {
+            expected.push_back(i);
+        }
+    }
+    ASSERT_EQ(selected_size, expected.size());
+    for (uint16_t i = 0; i < selected_size; i++) {
+        EXPECT_EQ(sel_idx[i], expected[i]);
+    }
+}
+
 TEST_F(BlockColumnPredicateTest, AND_MUTI_COLUMN_VEC) {
     vectorized::MutableColumns block;
     block.push_back(vectorized::PredicateColumnType<TYPE_INT>::create());
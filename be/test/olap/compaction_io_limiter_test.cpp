@@ -0,0 +1,141 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "olap/compaction_io_limiter.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+
+namespace doris {
+
+class CompactionIOLimiterTest : public testing::Test {
+protected:
+    void SetUp() override {
+        _latency_threshold_us = config::compaction_io_query_read_latency_threshold_us;
+        config::compaction_io_query_read_latency_threshold_us = 20000;
+    }
+
+    void TearDown() override {
+        config::compaction_io_query_read_latency_threshold_us = _latency_threshold_us;
+    }
+
+    int64_t _latency_threshold_us = 0;
+};
+
+TEST_F(CompactionIOLimiterTest, PriorityClasses) {
+    CompactionIOLimiter limiter;
+    const int64_t rate = 1000;
+    const int64_t now_us = 1000 * 1000;
+
+    // cumulative compaction can take the whole bucket
+    auto* disk = limiter._get_disk("/data1");
+    EXPECT_EQ(0, limiter._take(disk, CompactionIOClass::CUMULATIVE, 600, now_us, rate));
+    // base compaction leaves a quarter of the bucket, waits for 50 bytes
+    EXPECT_NEAR(50 * 1000, limiter._take(disk, CompactionIOClass::BASE, 200, now_us, rate), 1);
+
+    // cold data compaction leaves half of the bucket, waits for 100 bytes
+    disk = limiter._get_disk("/data2");
+    EXPECT_NEAR(100 * 1000, limiter._take(disk, CompactionIOClass::COLD_DATA, 600, now_us, rate),
+                1);
+    EXPECT_EQ(limiter._get_disk("/data1"), limiter._get_disk("/data1"));
+}
+
+TEST_F(CompactionIOLimiterTest, Refill) {
+    CompactionIOLimiter limiter;
+    const int64_t rate = 1000;
+    int64_t now_us = 1000 * 1000;
+    auto* disk = limiter._get_disk("/data1");
+
+    // the debt is paid back at the rate
+    EXPECT_NEAR(500 * 1000, limiter._take(disk, CompactionIOClass::CUMULATIVE, 1500, now_us, rate),
+                1);
+    now_us += 500 * 1000;
+    EXPECT_EQ(0, limiter._take(disk, CompactionIOClass::CUMULATIVE, 0, now_us, rate));
+    EXPECT_NEAR(1000, limiter._take(disk, CompactionIOClass::CUMULATIVE, 1, now_us, rate), 1);
+
+    // the bucket holds no more than one second of tokens
+    now_us += 10 * 1000 * 1000;
+    EXPECT_EQ(0, limiter._take(disk, CompactionIOClass::CUMULATIVE, 1000, now_us, rate));
+    EXPECT_GT(limiter._take(disk, CompactionIOClass::CUMULATIVE, 1, now_us, rate), 0);
+}
+
+TEST_F(CompactionIOLimiterTest, AdaptToQueryLatency) {
+    CompactionIOLimiter limiter;
+    const int64_t rate = 1000;
+    int64_t now_us = 1000 * 1000;
+    auto* disk = limiter._get_disk("/data1");
+    EXPECT_EQ(0, limiter._take(disk, CompactionIOClass::CUMULATIVE, 1, now_us, rate));
+
+    // slow query reads halve the rate
+    limiter.record_query_read("/data1", 50000);
+    limiter.record_query_read("/data1", 30000);
+    now_us += 1000 * 1000;
+    limiter._take(disk, CompactionIOClass::CUMULATIVE, 0, now_us, rate);
+    EXPECT_DOUBLE_EQ(0.5, disk->rate_factor);
+    limiter.record_query_read("/data1", 30000);
+    now_us += 1000 * 1000;
+    limiter._take(disk, CompactionIOClass::CUMULATIVE, 0, now_us, rate);
+    EXPECT_DOUBLE_EQ(0.25, disk->rate_factor);
+
+    // not checked again within a second
+    limiter.record_query_read("/data1", 30000);
+    limiter._take(disk, CompactionIOClass::CUMULATIVE, 0, now_us + 1000, rate);
+    EXPECT_DOUBLE_EQ(0.25, disk->rate_factor);
+
+    // fast query reads raise it back step by step
+    limiter.record_query_read("/data1", 100);
+    now_us += 1000 * 1000;
+    limiter._take(disk, CompactionIOClass::CUMULATIVE, 0, now_us, rate);
+    EXPECT_DOUBLE_EQ(0.375, disk->rate_factor);
+    now_us += 1000 * 1000;
+    limiter._take(disk, CompactionIOClass::CUMULATIVE, 0, now_us, rate);
+    EXPECT_DOUBLE_EQ(0.5, disk->rate_factor);
+    for (int i = 0; i < 10; ++i) {
+        now_us += 1000 * 1000;
+        limiter._take(disk, CompactionIOClass::CUMULATIVE, 0, now_us, rate);
+    }
+    EXPECT_DOUBLE_EQ(1.0, disk->rate_factor);
+
+    // a fixed rate when the threshold is 0
+    config::compaction_io_query_read_latency_threshold_us = 0;
+    limiter.record_query_read("/data1", 50000);
+    now_us += 1000 * 1000;
+    limiter._take(disk, CompactionIOClass::CUMULATIVE, 0, now_us, rate);
+    EXPECT_DOUBLE_EQ(1.0, disk->rate_factor);
+}
+
+TEST_F(CompactionIOLimiterTest, ScopedIOClass) {
+    EXPECT_EQ(CompactionIOClass::NONE, CompactionIOLimiter::current_io_class());
+    {
+        CompactionIOLimiter::ScopedIOClass io_class(
+                CompactionIOLimiter::io_class_of(ReaderType::READER_BASE_COMPACTION));
+        EXPECT_EQ(CompactionIOClass::BASE, CompactionIOLimiter::current_io_class());
+        {
+            CompactionIOLimiter::ScopedIOClass inner(
+                    CompactionIOLimiter::io_class_of(ReaderType::READER_CUMULATIVE_COMPACTION));
+            EXPECT_EQ(CompactionIOClass::CUMULATIVE, CompactionIOLimiter::current_io_class());
+        }
+        EXPECT_EQ(CompactionIOClass::BASE, CompactionIOLimiter::current_io_class());
+    }
+    EXPECT_EQ(CompactionIOClass::NONE, CompactionIOLimiter::current_io_class());
+    EXPECT_EQ(CompactionIOClass::NONE,
+              CompactionIOLimiter::io_class_of(ReaderType::READER_QUERY));
+    EXPECT_EQ(CompactionIOClass::COLD_DATA,
+              CompactionIOLimiter::io_class_of(ReaderType::READER_COLD_DATA_COMPACTION));
+}
+
+} // namespace doris
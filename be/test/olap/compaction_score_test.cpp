@@ -155,4 +155,32 @@ TEST_F(CompactionScoreTest, TestCompactionScore) {
     EXPECT_EQ(tablet->get_real_compaction_score(), 9);
 }
 
+TEST_F(CompactionScoreTest, TestCompactionPriorityScore) {
+    TabletMetaSharedPtr tablet_meta;
+    tablet_meta.reset(new TabletMeta(1, 2, 15675, 15676, 4, 5, TTabletSchema(), 6, {{7, 8}},
+                                     UniqueId(9, 10), TTabletType::TABLET_TYPE_DISK,
+                                     TCompressionType::LZ4F));
+    TabletSharedPtr tablet(new Tablet(*(_storage_engine.get()), tablet_meta, _data_dir.get(),
+                                      CUMULATIVE_SIZE_BASED_POLICY));
+    EXPECT_TRUE(tablet->init().ok());
+
+    double weight = config::compaction_read_amplification_weight;
+    // compaction score only
+    config::compaction_read_amplification_weight = 0;
+    tablet->scan_count_since_compaction = 1023;
+    EXPECT_EQ(tablet->calc_compaction_priority_score(10), 10);
+
+    config::compaction_read_amplification_weight = 1;
+    // 1023 scans
+    EXPECT_EQ(tablet->calc_compaction_priority_score(10), 110);
+    // rows merged by the scans count as well
+    tablet->merged_rows_since_compaction = 1024 * 1024;
+    EXPECT_EQ(tablet->calc_compaction_priority_score(10), 120);
+    // a tablet not read is ranked by its compaction score
+    tablet->scan_count_since_compaction = 0;
+    tablet->merged_rows_since_compaction = 0;
+    EXPECT_EQ(tablet->calc_compaction_priority_score(10), 10);
+    config::compaction_read_amplification_weight = weight;
+}
+
 } // namespace doris
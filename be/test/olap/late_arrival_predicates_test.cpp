@@ -0,0 +1,66 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/late_arrival_predicates.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "olap/null_predicate.h"
+
+namespace doris {
+
+TEST(LateArrivalPredicatesTest, CollectSinceVersion) {
+    LateArrivalPredicates late_arrival_predicates;
+    EXPECT_EQ(late_arrival_predicates.version(), 0);
+
+    std::vector<const ColumnPredicate*> predicates;
+    EXPECT_EQ(late_arrival_predicates.collect(0, &predicates), 0);
+    EXPECT_TRUE(predicates.empty());
+
+    // publishing nothing does not bump the version
+    late_arrival_predicates.add({});
+    EXPECT_EQ(late_arrival_predicates.version(), 0);
+
+    std::vector<std::unique_ptr<ColumnPredicate>> first;
+    first.emplace_back(std::make_unique<NullPredicate>(0, true));
+    first.emplace_back(std::make_unique<NullPredicate>(1, false));
+    late_arrival_predicates.add(std::move(first));
+    EXPECT_EQ(late_arrival_predicates.version(), 2);
+
+    size_t version = late_arrival_predicates.collect(0, &predicates);
+    EXPECT_EQ(version, 2);
+    ASSERT_EQ(predicates.size(), 2);
+    EXPECT_EQ(predicates[0]->column_id(), 0);
+    EXPECT_EQ(predicates[1]->column_id(), 1);
+
+    std::vector<std::unique_ptr<ColumnPredicate>> second;
+    second.emplace_back(std::make_unique<NullPredicate>(2, true));
+    late_arrival_predicates.add(std::move(second));
+    EXPECT_EQ(late_arrival_predicates.version(), 3);
+
+    // only the predicates published after `version` are handed out, the old ones stay valid
+    std::vector<const ColumnPredicate*> newer;
+    EXPECT_EQ(late_arrival_predicates.collect(version, &newer), 3);
+    ASSERT_EQ(newer.size(), 1);
+    EXPECT_EQ(newer[0]->column_id(), 2);
+    EXPECT_EQ(predicates[0]->column_id(), 0);
+}
+
+} // namespace doris
@@ -22,6 +22,7 @@
 #include <gtest/gtest-test-part.h>
 
 #include <iosfwd>
+#include <string>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -399,6 +400,87 @@ TEST_F(CacheTest, UsageLRUK) {
     ASSERT_EQ(896, cache.get_usage());
 }
 
+TEST_F(CacheTest, FrequencySketch) {
+    FrequencySketch sketch;
+    // no table before the capacity is set
+    sketch.increment(42);
+    ASSERT_EQ(0, sketch.frequency(42));
+
+    sketch.ensure_capacity(64);
+    for (int i = 0; i < 5; ++i) {
+        sketch.increment(42);
+    }
+    ASSERT_EQ(5, sketch.frequency(42));
+    ASSERT_EQ(0, sketch.frequency(43));
+
+    // 4 bit counters saturate
+    for (int i = 0; i < 20; ++i) {
+        sketch.increment(42);
+    }
+    ASSERT_EQ(15, sketch.frequency(42));
+
+    // aging halves all counters
+    sketch._reset();
+    ASSERT_EQ(7, sketch.frequency(42));
+
+    // growing drops the history, shrinking is ignored
+    sketch.ensure_capacity(1024);
+    ASSERT_EQ(0, sketch.frequency(42));
+    sketch.increment(42);
+    sketch.ensure_capacity(16);
+    ASSERT_EQ(1, sketch.frequency(42));
+}
+
+TEST_F(CacheTest, TinyLFUAdmission) {
+    LRUCache cache(LRUCacheType::NUMBER, true);
+    cache.set_tiny_lfu_admission(true);
+    cache.set_capacity(3);
+
+    auto lookup = [&](const CacheKey& key) {
+        Cache::Handle* handle = cache.lookup(key, key.hash(key.data(), key.size(), 0));
+        bool found = handle != nullptr;
+        if (found) {
+            cache.release(handle);
+        }
+        return found;
+    };
+
+    // not full, all admitted
+    std::vector<std::string> hot_keys = {"1", "2", "3"};
+    for (int i = 0; i < static_cast<int>(hot_keys.size()); ++i) {
+        insert_number_LRUCache(cache, CacheKey(hot_keys[i]), i, 1, CachePriority::NORMAL);
+    }
+    ASSERT_EQ(3, cache.get_usage());
+    for (int round = 0; round < 3; ++round) {
+        for (const auto& key : hot_keys) {
+            ASSERT_TRUE(lookup(CacheKey(key)));
+        }
+    }
+
+    // a scan of one-off keys does not flush the hot keys
+    for (int i = 100; i < 120; ++i) {
+        std::string key = std::to_string(i);
+        insert_number_LRUCache(cache, CacheKey(key), i, 1, CachePriority::NORMAL);
+        ASSERT_FALSE(lookup(CacheKey(key)));
+    }
+    for (const auto& key : hot_keys) {
+        ASSERT_TRUE(lookup(CacheKey(key)));
+    }
+    ASSERT_EQ(3, cache.get_usage());
+    ASSERT_EQ(20, cache.get_admission_reject_count());
+    ASSERT_EQ(0, cache.get_admission_accept_count());
+
+    // a key read more often than the victim is admitted, LRU-K is bypassed
+    CacheKey new_hot_key("new_hot");
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_FALSE(lookup(new_hot_key));
+    }
+    insert_number_LRUCache(cache, new_hot_key, 10, 1, CachePriority::NORMAL);
+    ASSERT_TRUE(lookup(new_hot_key));
+    ASSERT_EQ(3, cache.get_usage());
+    ASSERT_EQ(1, cache.get_admission_accept_count());
+}
+
 TEST_F(CacheTest, Prune) {
     LRUCache cache(LRUCacheType::NUMBER);
     cache.set_capacity(5);
@@ -701,6 +783,49 @@ TEST(CacheHandleTest, HandleTableTest) {
     }
 }
 
+TEST(CacheHandleTest, HandleTableIncrementalResize) {
+    HandleTable ht;
+    const int count = 10000;
+    std::vector<std::string> keys;
+    std::vector<LRUHandle*> hs;
+    for (int i = 0; i < count; ++i) {
+        keys.push_back(std::to_string(i));
+        auto* h = reinterpret_cast<LRUHandle*>(malloc(sizeof(LRUHandle) - 1 + keys[i].size()));
+        h->value = nullptr;
+        h->charge = 1;
+        h->total_size = sizeof(LRUHandle) - 1 + keys[i].size() + 1;
+        h->key_length = keys[i].size();
+        h->hash = static_cast<uint32_t>(i * 2654435761U);
+        h->refs = 0;
+        h->next = h->prev = nullptr;
+        h->next_hash = nullptr;
+        h->in_cache = false;
+        h->priority = CachePriority::NORMAL;
+        memcpy(h->key_data, keys[i].data(), keys[i].size());
+        EXPECT_EQ(ht.insert(h), nullptr);
+        hs.push_back(h);
+        // every entry stays reachable while the buckets are moved
+        if (ht._old_list != nullptr) {
+            for (int j = 0; j <= i; j += 97) {
+                EXPECT_EQ(ht.lookup(CacheKey(keys[j]), hs[j]->hash), hs[j]);
+            }
+        }
+    }
+    EXPECT_EQ(ht.element_count(), count);
+    for (int i = 0; i < count; ++i) {
+        EXPECT_EQ(ht.lookup(CacheKey(keys[i]), hs[i]->hash), hs[i]);
+    }
+    for (int i = 0; i < count; i += 2) {
+        EXPECT_EQ(ht.remove(CacheKey(keys[i]), hs[i]->hash), hs[i]);
+        EXPECT_TRUE(ht.remove(hs[i + 1]));
+    }
+    EXPECT_EQ(ht.element_count(), 0);
+    EXPECT_EQ(ht._old_list, nullptr);
+    for (auto* h : hs) {
+        free(h);
+    }
+}
+
 TEST_F(CacheTest, SetCapacity) {
     init_number_cache();
     for (int i = 0; i < kCacheSize; i++) {
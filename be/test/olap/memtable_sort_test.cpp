@@ -16,8 +16,16 @@
 // under the License.
 
 #include <gtest/gtest.h>
+#include <pdqsort.h>
+
+#include <numeric>
+#include <random>
+#include <string>
 
 #include "olap/memtable.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
 
 namespace doris {
 
@@ -80,4 +88,94 @@ TEST_F(MemTableSortTest, Tie) {
     EXPECT_FALSE(it3.next());
 }
 
+TEST_F(MemTableSortTest, NormalizedKeySorter) {
+    std::mt19937 rng(42);
+    const size_t num_rows = 1000;
+    auto ints = vectorized::ColumnInt32::create();
+    auto null_map = vectorized::ColumnUInt8::create();
+    auto strings = vectorized::ColumnString::create();
+    auto bigints = vectorized::ColumnInt64::create();
+    for (size_t i = 0; i < num_rows; ++i) {
+        ints->insert_value(static_cast<int32_t>(rng() % 20) - 10);
+        null_map->insert_value(rng() % 10 == 0);
+        // some strings are longer than the key and only differ after it
+        std::string value(rng() % 2 == 0 ? 0 : rng() % 40, 'a');
+        value += std::to_string(rng() % 5);
+        strings->insert_data(value.data(), value.size());
+        bigints->insert_value(static_cast<int64_t>(rng() % 3) - 1);
+    }
+    auto nullable = vectorized::ColumnNullable::create(std::move(ints), std::move(null_map));
+    std::vector<const vectorized::IColumn*> columns {nullable.get(), strings.get(),
+                                                     bigints.get()};
+    auto compare = [&](const std::vector<size_t>& order, size_t lhs, size_t rhs,
+                       size_t num_columns) {
+        for (size_t i = 0; i < num_columns; ++i) {
+            const auto* column = columns[order[i]];
+            int res = column->compare_at(lhs, rhs, *column, -1);
+            if (res != 0) {
+                return res;
+            }
+        }
+        return 0;
+    };
+
+    // sort rows[10, num_rows) by the key, then the tied rows by all the columns
+    auto check_sort = [&](const std::vector<size_t>& order, size_t key_size,
+                          size_t num_full_columns) {
+        std::vector<const vectorized::IColumn*> key_columns;
+        std::vector<FieldType> key_types;
+        const FieldType types[] = {FieldType::OLAP_FIELD_TYPE_INT,
+                                   FieldType::OLAP_FIELD_TYPE_VARCHAR,
+                                   FieldType::OLAP_FIELD_TYPE_BIGINT};
+        for (size_t i : order) {
+            key_columns.push_back(columns[i]);
+            key_types.push_back(types[i]);
+        }
+        NormalizedKeySorter sorter(key_columns, key_types);
+        EXPECT_EQ(key_size, sorter.key_size());
+        EXPECT_EQ(num_full_columns, sorter.num_full_columns());
+
+        DorisVector<uint32_t> rows(num_rows);
+        std::iota(rows.begin(), rows.end(), 0U);
+        Tie tie(10, num_rows);
+        sorter.sort(rows, 10, num_rows, tie);
+        for (size_t i = 11; i < num_rows; ++i) {
+            int res = compare(order, rows[i - 1], rows[i], order.size());
+            if (tie[i]) {
+                EXPECT_EQ(0, compare(order, rows[i - 1], rows[i], num_full_columns));
+            } else {
+                EXPECT_LT(res, 0);
+            }
+        }
+        auto iter = tie.iter();
+        while (iter.next()) {
+            pdqsort(std::next(rows.begin(), iter.left()), std::next(rows.begin(), iter.right()),
+                    [&](uint32_t lhs, uint32_t rhs) {
+                        return compare(order, lhs, rhs, order.size()) < 0;
+                    });
+        }
+        std::vector<bool> seen(num_rows, false);
+        for (size_t i = 0; i < num_rows; ++i) {
+            EXPECT_FALSE(seen[rows[i]]);
+            seen[rows[i]] = true;
+            if (i < 10) {
+                EXPECT_EQ(i, rows[i]);
+            } else if (i > 10) {
+                EXPECT_LE(compare(order, rows[i - 1], rows[i], order.size()), 0);
+            }
+        }
+    };
+
+    // the string is cut to the rest of the key, and the column after it is not encoded
+    check_sort({0, 1, 2}, NormalizedKeySorter::MAX_KEY_SIZE, 1);
+    check_sort({2, 0}, 13, 2);
+    check_sort({1, 0}, NormalizedKeySorter::MAX_KEY_SIZE, 0);
+
+    // a column which can not be normalized ends the key
+    NormalizedKeySorter sorter({nullable.get(), strings.get()},
+                               {FieldType::OLAP_FIELD_TYPE_DATETIME,
+                                FieldType::OLAP_FIELD_TYPE_VARCHAR});
+    EXPECT_EQ(0, sorter.key_size());
+}
+
 } // namespace doris
@@ -286,4 +286,35 @@ TEST_F(StoragePageCacheTest, mixed_pages) {
     }
 }
 
+TEST_F(StoragePageCacheTest, decoded_pages) {
+    {
+        // disabled by default
+        StoragePageCache cache(kNumShards * 2048, 0, 0, kNumShards);
+        EXPECT_FALSE(cache.has_decoded_page_cache());
+    }
+
+    StoragePageCache cache(kNumShards * 2048, 0, 0, kNumShards, kNumShards * 2048);
+    ASSERT_TRUE(cache.has_decoded_page_cache());
+
+    StoragePageCache::CacheKey key("abc", 0, 0);
+    EXPECT_EQ(nullptr, cache.lookup_decoded<std::string>(key));
+
+    auto words = std::make_shared<std::string>("decoded");
+    cache.insert_decoded(key, words, 1024);
+    auto found = cache.lookup_decoded<std::string>(key);
+    EXPECT_EQ(words, found);
+
+    // not visible to the page caches
+    PageCacheHandle handle;
+    EXPECT_FALSE(cache.lookup(key, &handle, segment_v2::DATA_PAGE));
+
+    // the data stays valid after the entry is evicted
+    for (int i = 1; i < 1000; ++i) {
+        StoragePageCache::CacheKey other_key("abc", 0, i);
+        cache.insert_decoded(other_key, std::make_shared<std::string>("other"), 1024);
+    }
+    EXPECT_EQ(nullptr, cache.lookup_decoded<std::string>(key));
+    EXPECT_EQ("decoded", *found);
+}
+
 } // namespace doris
@@ -322,4 +322,73 @@ TEST_F(PrimaryKeyIndexTest, single_page) {
         EXPECT_TRUE(status.is<ErrorCode::ENTRY_NOT_FOUND>());
     }
 }
+TEST_F(PrimaryKeyIndexTest, shared_key_prefixes) {
+    std::string filename = kTestDir + "/shared_key_prefixes";
+    io::FileWriterPtr file_writer;
+    auto fs = io::global_local_filesystem();
+    EXPECT_TRUE(fs->create_file(filename, &file_writer).ok());
+
+    int32_t data_page_size = config::primary_key_data_page_size;
+    config::primary_key_data_page_size = 256;
+    PrimaryKeyIndexBuilder builder(file_writer.get(), 0, 0);
+    static_cast<void>(builder.init());
+    // keys sharing a long prefix, and the bytes after it repeat across pages
+    std::vector<std::string> keys;
+    for (int i = 0; i < 3000; i++) {
+        std::string id = std::to_string(100000 + i * 37);
+        std::string key = "tenant_0001/user/" + id.substr(0, 3) + "/" + id;
+        keys.push_back(key);
+        static_cast<void>(builder.add_item(key));
+    }
+    EXPECT_GT(builder.data_page_num(), 1);
+    segment_v2::PrimaryKeyIndexMetaPB index_meta;
+    EXPECT_TRUE(builder.finalize(&index_meta));
+    EXPECT_TRUE(file_writer->close().ok());
+    config::primary_key_data_page_size = data_page_size;
+
+    PrimaryKeyIndexReader index_reader;
+    io::FileReaderSPtr file_reader;
+    EXPECT_TRUE(fs->open_file(filename, &file_reader).ok());
+    EXPECT_TRUE(index_reader.parse_index(file_reader, index_meta, nullptr).ok());
+    const auto* value_index = index_reader._index_reader->_value_index_reader.get();
+    EXPECT_TRUE(value_index->has_key_prefixes());
+    EXPECT_EQ(strlen("tenant_0001/user/"), value_index->key_prefix_offset());
+
+    std::unique_ptr<segment_v2::IndexedColumnIterator> index_iterator;
+    EXPECT_TRUE(index_reader.new_iterator(&index_iterator, nullptr).ok());
+    bool exact_match = false;
+    for (size_t i = 0; i < keys.size(); i++) {
+        auto status = index_iterator->seek_at_or_after(&keys[i], &exact_match);
+        EXPECT_TRUE(status.ok());
+        EXPECT_TRUE(exact_match);
+        EXPECT_EQ(i, index_iterator->get_current_ordinal());
+
+        // a key right after keys[i], and one not sharing the common prefix
+        std::string next_key = keys[i] + "0";
+        Slice slice(next_key);
+        status = index_iterator->seek_at_or_after(&slice, &exact_match);
+        EXPECT_FALSE(exact_match);
+        if (i + 1 < keys.size()) {
+            EXPECT_TRUE(status.ok());
+            EXPECT_EQ(i + 1, index_iterator->get_current_ordinal());
+        } else {
+            EXPECT_TRUE(status.is<ErrorCode::ENTRY_NOT_FOUND>());
+        }
+    }
+    {
+        std::string key("tenant_0000");
+        Slice slice(key);
+        auto status = index_iterator->seek_at_or_after(&slice, &exact_match);
+        EXPECT_TRUE(status.ok());
+        EXPECT_FALSE(exact_match);
+        EXPECT_EQ(0, index_iterator->get_current_ordinal());
+    }
+    {
+        std::string key("tenant_0002");
+        Slice slice(key);
+        auto status = index_iterator->seek_at_or_after(&slice, &exact_match);
+        EXPECT_FALSE(exact_match);
+        EXPECT_TRUE(status.is<ErrorCode::ENTRY_NOT_FOUND>());
+    }
+}
 } // namespace doris
@@ -0,0 +1,145 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/binary_fsst_page.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "olap/rowset/segment_v2/binary_dict_page.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "util/coding.h"
+#include "vec/columns/column_string.h"
+#include "vec/common/assert_cast.h"
+
+namespace doris::segment_v2 {
+
+class BinaryFsstPageTest : public testing::Test {
+protected:
+    void SetUp() override {
+        _enable_dict_page_fsst_fallback = config::enable_dict_page_fsst_fallback;
+        for (int i = 0; i < 1000; ++i) {
+            _values.push_back("https://www.example.com/item/" + std::to_string(i * 7919) +
+                              "?ref=search&page=" + std::to_string(i % 10));
+            _raw_size += _values.back().size();
+        }
+        _values[10] = "";
+    }
+
+    void TearDown() override {
+        config::enable_dict_page_fsst_fallback = _enable_dict_page_fsst_fallback;
+    }
+
+    void check_page(PageDecoder* decoder) {
+        ASSERT_EQ(_values.size(), decoder->count());
+
+        auto column = vectorized::ColumnString::create();
+        vectorized::MutableColumnPtr dst = std::move(column);
+        size_t n = 300;
+        ASSERT_TRUE(decoder->seek_to_position_in_page(5).ok());
+        ASSERT_TRUE(decoder->next_batch(&n, dst).ok());
+        ASSERT_EQ(300, n);
+        ASSERT_EQ(305, decoder->current_index());
+        n = _values.size();
+        ASSERT_TRUE(decoder->next_batch(&n, dst).ok());
+        ASSERT_EQ(_values.size() - 305, n);
+        const auto& strings = assert_cast<const vectorized::ColumnString&>(*dst);
+        ASSERT_EQ(_values.size() - 5, strings.size());
+        for (size_t i = 0; i < strings.size(); ++i) {
+            EXPECT_EQ(_values[i + 5], strings.get_data_at(i).to_string());
+        }
+
+        std::vector<rowid_t> rowids {100, 110, 999, 1100};
+        dst = vectorized::ColumnString::create();
+        n = rowids.size();
+        ASSERT_TRUE(decoder->read_by_rowids(rowids.data(), 100, &n, dst).ok());
+        ASSERT_EQ(3, n);
+        const auto& picked = assert_cast<const vectorized::ColumnString&>(*dst);
+        EXPECT_EQ(_values[0], picked.get_data_at(0).to_string());
+        EXPECT_EQ(_values[10], picked.get_data_at(1).to_string());
+        EXPECT_EQ(_values[899], picked.get_data_at(2).to_string());
+    }
+
+    bool _enable_dict_page_fsst_fallback = false;
+    std::vector<std::string> _values;
+    size_t _raw_size = 0;
+};
+
+TEST_F(BinaryFsstPageTest, encode_decode) {
+    PageBuilderOptions options;
+    options.data_page_size = 256 * 1024;
+    PageBuilder* builder_ptr = nullptr;
+    ASSERT_TRUE(BinaryFsstPageBuilder::create(&builder_ptr, options).ok());
+    std::unique_ptr<PageBuilder> builder(builder_ptr);
+
+    std::vector<Slice> slices(_values.begin(), _values.end());
+    size_t count = slices.size();
+    ASSERT_TRUE(builder->add(reinterpret_cast<const uint8_t*>(slices.data()), &count).ok());
+    ASSERT_EQ(slices.size(), count);
+    OwnedSlice page;
+    ASSERT_TRUE(builder->finish(&page).ok());
+    EXPECT_LT(page.slice().size * 2, _raw_size);
+
+    Slice first;
+    Slice last;
+    ASSERT_TRUE(builder->get_first_value(&first).ok());
+    ASSERT_TRUE(builder->get_last_value(&last).ok());
+    EXPECT_EQ(_values.front(), first.to_string());
+    EXPECT_EQ(_values.back(), last.to_string());
+
+    BinaryFsstPageDecoder decoder(page.slice(), PageDecoderOptions());
+    ASSERT_TRUE(decoder.init().ok());
+    check_page(&decoder);
+}
+
+TEST_F(BinaryFsstPageTest, dict_page_fallback) {
+    config::enable_dict_page_fsst_fallback = true;
+    PageBuilderOptions options;
+    options.data_page_size = 256 * 1024;
+    // the dictionary overflows on the first page
+    options.dict_page_size = 1024;
+    PageBuilder* builder_ptr = nullptr;
+    ASSERT_TRUE(BinaryDictPageBuilder::create(&builder_ptr, options).ok());
+    std::unique_ptr<PageBuilder> builder(builder_ptr);
+
+    std::vector<Slice> slices(_values.begin(), _values.end());
+    size_t count = slices.size();
+    ASSERT_TRUE(builder->add(reinterpret_cast<const uint8_t*>(slices.data()), &count).ok());
+    ASSERT_LT(count, slices.size());
+    OwnedSlice first_page;
+    ASSERT_TRUE(builder->finish(&first_page).ok());
+
+    ASSERT_TRUE(builder->reset().ok());
+    count = slices.size();
+    ASSERT_TRUE(builder->add(reinterpret_cast<const uint8_t*>(slices.data()), &count).ok());
+    ASSERT_EQ(slices.size(), count);
+    OwnedSlice page;
+    ASSERT_TRUE(builder->finish(&page).ok());
+    EXPECT_EQ(BINARY_DICT_PAGE_FSST_MODE,
+              decode_fixed32_le(reinterpret_cast<const uint8_t*>(page.slice().data)));
+
+    BinaryDictPageDecoder decoder(page.slice(), PageDecoderOptions());
+    ASSERT_TRUE(decoder.init().ok());
+    EXPECT_FALSE(decoder.is_dict_encoding());
+    check_page(&decoder);
+}
+
+} // namespace doris::segment_v2
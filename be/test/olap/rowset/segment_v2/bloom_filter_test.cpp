@@ -23,6 +23,8 @@
 #include <unordered_set>
 #include <vector>
 
+#include "olap/itoken_extractor.h"
+
 using namespace doris;
 using namespace segment_v2;
 
@@ -299,4 +301,34 @@ TEST_F(BloomFilterTest, TestInitWithInvalidInputs) {
     uint32_t non_power_of_two_size = 1000; // Not a power of two
     st = bf->init(buffer, non_power_of_two_size, HASH_MURMUR3_X64_64);
     EXPECT_EQ(st.code(), TStatusCode::INVALID_ARGUMENT);
-}
\ No newline at end of file
+}
+// The ngram filter of a LIKE pattern is tested against a page filter by its non-zero words
+TEST_F(BloomFilterTest, TestNGramBloomFilterContains) {
+    const size_t bf_size = 4096;
+    NgramTokenExtractor extractor(3);
+    std::unique_ptr<BloomFilter> page_bf;
+    EXPECT_TRUE(BloomFilter::create(NGRAM_BLOOM_FILTER, &page_bf, bf_size).ok());
+    for (int i = 0; i < 100; ++i) {
+        std::string value = "the quick brown fox " + std::to_string(i);
+        extractor.string_to_bloom_filter(value.data(), value.size(), *page_bf);
+    }
+
+    auto pattern_bf = [&](const std::string& pattern) {
+        std::unique_ptr<BloomFilter> bf;
+        EXPECT_TRUE(BloomFilter::create(NGRAM_BLOOM_FILTER, &bf, bf_size).ok());
+        EXPECT_TRUE(extractor.string_like_to_bloom_filter(pattern.data(), pattern.size(), *bf));
+        return bf;
+    };
+    auto hit_bf = pattern_bf("%brown fox 4%");
+    auto miss_bf = pattern_bf("%lazy dog%");
+    EXPECT_TRUE(page_bf->contains(*hit_bf));
+    EXPECT_FALSE(page_bf->contains(*miss_bf));
+
+    // a filter read from its buffer is tested by all words, and gives the same result
+    for (const auto* bf : {hit_bf.get(), miss_bf.get()}) {
+        std::unique_ptr<BloomFilter> read_bf;
+        EXPECT_TRUE(BloomFilter::create(NGRAM_BLOOM_FILTER, &read_bf, bf_size).ok());
+        EXPECT_TRUE(read_bf->init(bf->data(), bf->size(), CITY_HASH_64).ok());
+        EXPECT_EQ(page_bf->contains(*read_bf), page_bf->contains(*bf));
+    }
+}
@@ -138,6 +138,28 @@ TEST(BasicTokenizerTest, ConsecutiveNumbers) {
     EXPECT_EQ(tokens[0].size(), 255);
 }
 
+TEST(BasicTokenizerTest, LongAsciiRuns) {
+    // words and separators longer than 16 bytes, on and across 16 byte boundaries
+    std::string word1 = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+    std::string word2 = "abcdefghijklmnop";
+    std::string text = word1 + std::string(20, ' ') + word2 + ",;:" + std::string(17, '-') +
+                       "x你Y\xffz" + std::string(33, '.') + "End";
+    auto tokens = tokenize(text, true);
+
+    std::vector<std::string> expected = {"abcdefghijklmnopqrstuvwxyz0123456789",
+                                         word2,
+                                         "x",
+                                         "你",
+                                         "y",
+                                         "z",
+                                         "end"};
+    ASSERT_EQ(tokens, expected);
+
+    tokens = tokenize(text, false);
+    ASSERT_EQ(tokens[0], word1);
+    ASSERT_EQ(tokens[4], "Y");
+}
+
 TEST(BasicTokenizerTest, EmojiHandling) {
     const std::string input = "😊😋";
     auto tokens = tokenize(input);
@@ -0,0 +1,90 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/inverted_index/query_v2/boolean_query.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <roaring/roaring.hh>
+#include <vector>
+
+#include "olap/rowset/segment_v2/inverted_index/query_v2/operator.h"
+#include "olap/rowset/segment_v2/inverted_index/query_v2/roaring_query.h"
+
+namespace doris::segment_v2::idx_query_v2 {
+
+class BooleanQueryTest : public testing::Test {
+public:
+    static Node make_roaring_query(const std::vector<uint32_t>& docs) {
+        auto roaring = std::make_shared<roaring::Roaring>();
+        for (auto doc : docs) {
+            roaring->add(doc);
+        }
+        return std::make_shared<RoaringQuery>(roaring);
+    }
+
+    static BooleanQueryPtr make_boolean_query(OperatorType type,
+                                              const std::vector<std::vector<uint32_t>>& clauses) {
+        BooleanQuery::Builder builder;
+        EXPECT_TRUE(builder.set_op(type).ok());
+        for (const auto& docs : clauses) {
+            EXPECT_TRUE(builder.add(make_roaring_query(docs)).ok());
+        }
+        auto node = builder.build();
+        EXPECT_TRUE(node.has_value());
+        return std::get<BooleanQueryPtr>(node.value());
+    }
+};
+
+TEST_F(BooleanQueryTest, roaring_query_advance) {
+    auto node = make_roaring_query({3, 100, 70000, 200000});
+    const auto& query = std::get<RoaringQueryPtr>(node);
+    // advance works before the first next_doc
+    EXPECT_EQ(100, query->advance(50));
+    // a target at or before the current doc does not move it
+    EXPECT_EQ(100, query->advance(100));
+    EXPECT_EQ(100, query->advance(4));
+    EXPECT_EQ(70000, query->next_doc());
+    EXPECT_EQ(200000, query->advance(70001));
+    EXPECT_EQ(INT_MAX, query->next_doc());
+    EXPECT_EQ(INT_MAX, query->next_doc());
+    EXPECT_EQ(INT_MAX, query->advance(300000));
+}
+
+TEST_F(BooleanQueryTest, disjunction_advance) {
+    auto query = make_boolean_query(OperatorType::OP_OR, {{1, 5, 9}, {2, 5, 20}});
+    EXPECT_EQ(5, query->advance(4));
+    EXPECT_EQ(9, query->next_doc());
+    // the child at doc 9 must not be moved past it
+    EXPECT_EQ(9, query->advance(9));
+    EXPECT_EQ(20, query->next_doc());
+    EXPECT_EQ(INT_MAX, query->next_doc());
+}
+
+TEST_F(BooleanQueryTest, execute) {
+    auto result = std::make_shared<roaring::Roaring>();
+    make_boolean_query(OperatorType::OP_OR, {{1, 5, 9}, {2, 5, 20}})->execute(result);
+    EXPECT_EQ(roaring::Roaring({1, 2, 5, 9, 20}), *result);
+
+    result = std::make_shared<roaring::Roaring>();
+    make_boolean_query(OperatorType::OP_AND, {{1, 5, 9, 20}, {2, 5, 20}, {5, 7, 20, 30}})
+            ->execute(result);
+    EXPECT_EQ(roaring::Roaring({5, 20}), *result);
+}
+
+} // namespace doris::segment_v2::idx_query_v2
@@ -135,5 +135,28 @@ TEST_F(RowRangesTest, TestRangesToRoaring) {
     EXPECT_EQ(row_ranges_union.count(), row_bitmap.cardinality());
 }
 
+TEST_F(RowRangesTest, TestCreateSampled) {
+    RowRanges all = RowRanges::create_sampled(10000, 100, 1, 7);
+    EXPECT_EQ(10000, all.count());
+    EXPECT_EQ(1, all.range_size());
+    EXPECT_TRUE(RowRanges::create_sampled(10000, 100, 0, 7).is_empty());
+
+    RowRanges sampled = RowRanges::create_sampled(100050, 100, 0.1, 7);
+    // the granules are kept or skipped as a whole, the last one is shorter
+    for (size_t i = 0; i < sampled.range_size(); ++i) {
+        EXPECT_EQ(0, sampled.get_range_from(i) % 100);
+        EXPECT_TRUE(sampled.get_range_to(i) % 100 == 0 || sampled.get_range_to(i) == 100050);
+    }
+    EXPECT_GT(sampled.count(), 7000);
+    EXPECT_LT(sampled.count(), 13000);
+
+    // the same seed samples the same rows, another seed other rows
+    roaring::Roaring bitmap = RowRanges::ranges_to_roaring(sampled);
+    EXPECT_EQ(bitmap,
+              RowRanges::ranges_to_roaring(RowRanges::create_sampled(100050, 100, 0.1, 7)));
+    EXPECT_NE(bitmap,
+              RowRanges::ranges_to_roaring(RowRanges::create_sampled(100050, 100, 0.1, 8)));
+}
+
 } // namespace segment_v2
 } // namespace doris
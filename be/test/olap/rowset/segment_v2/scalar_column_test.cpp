@@ -0,0 +1,246 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <gen_cpp/segment_v2.pb.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "io/fs/buffered_reader.h"
+#include "io/fs/file_reader.h"
+#include "io/fs/file_writer.h"
+#include "io/fs/local_file_system.h"
+#include "olap/olap_common.h"
+#include "olap/rowset/segment_v2/column_reader.h"
+#include "olap/rowset/segment_v2/column_writer.h"
+#include "olap/rowset/segment_v2/encoding_info.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
+#include "olap/rowset/segment_v2/row_ranges.h"
+#include "olap/tablet_schema.h"
+#include "olap/types.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
+
+namespace doris::segment_v2 {
+
+static const std::string TEST_DIR = "./ut_dir/scalar_column_test";
+
+class ScalarColumnTest : public testing::Test {
+protected:
+    void SetUp() override {
+        _enable_adaptive_column_encoding = config::enable_adaptive_column_encoding;
+        auto st = io::global_local_filesystem()->delete_directory(TEST_DIR);
+        ASSERT_TRUE(st.ok()) << st;
+        st = io::global_local_filesystem()->create_directory(TEST_DIR);
+        ASSERT_TRUE(st.ok()) << st;
+    }
+
+    void TearDown() override {
+        config::enable_adaptive_column_encoding = _enable_adaptive_column_encoding;
+        EXPECT_TRUE(io::global_local_filesystem()->delete_directory(TEST_DIR).ok());
+    }
+
+    // write `values` as a not null bigint column left to the default encoding
+    void write_column(const std::string& name, const std::vector<int64_t>& values,
+                      ColumnMetaPB* meta) {
+        io::FileWriterPtr file_writer;
+        auto st = io::global_local_filesystem()->create_file(TEST_DIR + "/" + name, &file_writer);
+        ASSERT_TRUE(st.ok()) << st;
+
+        ColumnWriterOptions writer_opts;
+        writer_opts.meta = meta;
+        meta->set_column_id(0);
+        meta->set_unique_id(0);
+        meta->set_type(int(FieldType::OLAP_FIELD_TYPE_BIGINT));
+        meta->set_length(0);
+        meta->set_encoding(DEFAULT_ENCODING);
+        meta->set_compression(segment_v2::CompressionTypePB::LZ4F);
+        meta->set_is_nullable(false);
+
+        TabletColumn column(FieldAggregationMethod::OLAP_FIELD_AGGREGATION_NONE,
+                            FieldType::OLAP_FIELD_TYPE_BIGINT);
+        std::unique_ptr<ColumnWriter> writer;
+        ASSERT_TRUE(ColumnWriter::create(writer_opts, &column, file_writer.get(), &writer).ok());
+        ASSERT_TRUE(writer->init().ok());
+        const auto* ptr = reinterpret_cast<const uint8_t*>(values.data());
+        ASSERT_TRUE(writer->append_data(&ptr, values.size()).ok());
+        ASSERT_TRUE(writer->finish().ok());
+        ASSERT_TRUE(writer->write_data().ok());
+        ASSERT_TRUE(writer->write_ordinal_index().ok());
+        ASSERT_TRUE(file_writer->close().ok());
+    }
+
+    void open_column(const std::string& name, const ColumnMetaPB& meta, size_t num_rows,
+                     io::FileReaderSPtr* file_reader, std::unique_ptr<ColumnReader>* reader) {
+        ASSERT_TRUE(io::global_local_filesystem()->open_file(TEST_DIR + "/" + name, file_reader)
+                            .ok());
+        ColumnReaderOptions reader_opts;
+        ASSERT_TRUE(ColumnReader::create(reader_opts, meta, num_rows, *file_reader, reader).ok());
+    }
+
+    void check_column(const std::string& name, const std::vector<int64_t>& values,
+                      const ColumnMetaPB& meta) {
+        io::FileReaderSPtr file_reader;
+        std::unique_ptr<ColumnReader> reader;
+        open_column(name, meta, values.size(), &file_reader, &reader);
+        TabletColumn column(FieldAggregationMethod::OLAP_FIELD_AGGREGATION_NONE,
+                            FieldType::OLAP_FIELD_TYPE_BIGINT);
+        ColumnIterator* it = nullptr;
+        ASSERT_TRUE(reader->new_iterator(&it, &column).ok());
+        std::unique_ptr<ColumnIterator> iter(it);
+        OlapReaderStatistics stats;
+        ColumnIteratorOptions iter_opts;
+        iter_opts.stats = &stats;
+        iter_opts.file_reader = file_reader.get();
+        ASSERT_TRUE(iter->init(iter_opts).ok());
+
+        // sequential read over all pages
+        ASSERT_TRUE(iter->seek_to_ordinal(0).ok());
+        vectorized::MutableColumnPtr dst = vectorized::ColumnInt64::create();
+        size_t n = values.size();
+        bool has_null = false;
+        ASSERT_TRUE(iter->next_batch(&n, dst, &has_null).ok());
+        ASSERT_EQ(n, values.size());
+        const auto& data = assert_cast<const vectorized::ColumnInt64&>(*dst).get_data();
+        for (size_t i = 0; i < values.size(); ++i) {
+            ASSERT_EQ(data[i], values[i]) << i;
+        }
+
+        // read by rowids
+        std::vector<rowid_t> rowids;
+        for (rowid_t i = 3; i < values.size(); i += 7) {
+            rowids.push_back(i);
+        }
+        vectorized::MutableColumnPtr picked = vectorized::ColumnInt64::create();
+        ASSERT_TRUE(iter->read_by_rowids(rowids.data(), rowids.size(), picked).ok());
+        ASSERT_EQ(picked->size(), rowids.size());
+        const auto& picked_data = assert_cast<const vectorized::ColumnInt64&>(*picked).get_data();
+        for (size_t i = 0; i < rowids.size(); ++i) {
+            ASSERT_EQ(picked_data[i], values[rowids[i]]) << rowids[i];
+        }
+    }
+
+private:
+    bool _enable_adaptive_column_encoding = false;
+};
+
+TEST_F(ScalarColumnTest, adaptive_encoding_ascending_values) {
+    config::enable_adaptive_column_encoding = true;
+    std::vector<int64_t> values;
+    int64_t ts = 1700000000000000;
+    for (int i = 0; i < 200000; ++i) {
+        ts += 1 + i % 5;
+        values.push_back(ts);
+    }
+    ColumnMetaPB meta;
+    write_column("ascending", values, &meta);
+    EXPECT_EQ(meta.encoding(), FOR_ENCODING);
+    check_column("ascending", values, meta);
+}
+
+TEST_F(ScalarColumnTest, adaptive_encoding_random_values) {
+    config::enable_adaptive_column_encoding = true;
+    std::mt19937_64 rng(42);
+    std::vector<int64_t> values;
+    for (int i = 0; i < 100000; ++i) {
+        values.push_back(static_cast<int64_t>(rng() % 1000));
+    }
+    ColumnMetaPB meta;
+    write_column("random", values, &meta);
+    EXPECT_EQ(meta.encoding(), BIT_SHUFFLE);
+    check_column("random", values, meta);
+}
+
+TEST_F(ScalarColumnTest, adaptive_encoding_disabled) {
+    config::enable_adaptive_column_encoding = false;
+    std::vector<int64_t> values;
+    for (int i = 0; i < 10000; ++i) {
+        values.push_back(i);
+    }
+    ColumnMetaPB meta;
+    write_column("disabled", values, &meta);
+    EXPECT_EQ(meta.encoding(), BIT_SHUFFLE);
+    check_column("disabled", values, meta);
+}
+
+TEST_F(ScalarColumnTest, data_page_ordinals_and_ranges) {
+    std::vector<int64_t> values;
+    for (int i = 0; i < 100000; ++i) {
+        values.push_back(i * 7919L);
+    }
+    ColumnMetaPB meta;
+    write_column("ordinals", values, &meta);
+    io::FileReaderSPtr file_reader;
+    std::unique_ptr<ColumnReader> reader;
+    open_column("ordinals", meta, values.size(), &file_reader, &reader);
+
+    OlapReaderStatistics stats;
+    ColumnIteratorOptions iter_opts;
+    iter_opts.stats = &stats;
+    iter_opts.file_reader = file_reader.get();
+    std::vector<ordinal_t> ordinals;
+    ASSERT_TRUE(reader->get_data_page_first_ordinals(iter_opts, &ordinals).ok());
+    ASSERT_GT(ordinals.size(), 1);
+    EXPECT_EQ(ordinals[0], 0);
+    for (size_t i = 0; i < ordinals.size(); ++i) {
+        if (i > 0) {
+            EXPECT_LT(ordinals[i - 1], ordinals[i]);
+        }
+        EXPECT_LT(ordinals[i], values.size());
+        OrdinalPageIndexIterator page_iter;
+        ASSERT_TRUE(reader->seek_at_or_before(ordinals[i], &page_iter, iter_opts).ok());
+        EXPECT_EQ(page_iter.first_ordinal(), ordinals[i]);
+    }
+
+    // file ranges of the data pages overlapping some row ranges
+    std::vector<io::PrefetchRange> ranges;
+    auto all_rows = RowRanges::create_single(values.size());
+    ASSERT_TRUE(reader->get_data_page_ranges(iter_opts, all_rows, &ranges).ok());
+    ASSERT_EQ(ranges.size(), ordinals.size());
+    for (size_t i = 1; i < ranges.size(); ++i) {
+        EXPECT_LE(ranges[i - 1].end_offset, ranges[i].start_offset);
+    }
+
+    // two ranges within one page read the page once
+    size_t page = (ordinals.size() - 1) / 2;
+    ordinal_t page_end = ordinals[page + 1];
+    RowRanges in_page;
+    in_page.add(RowRange(ordinals[page], ordinals[page] + 1));
+    in_page.add(RowRange(page_end - 1, page_end));
+    std::vector<io::PrefetchRange> page_ranges;
+    ASSERT_TRUE(reader->get_data_page_ranges(iter_opts, in_page, &page_ranges).ok());
+    ASSERT_EQ(page_ranges.size(), 1);
+    EXPECT_EQ(page_ranges[0], ranges[page]);
+
+    // a range ending in the next page reads both pages
+    RowRanges across_pages;
+    across_pages.add(RowRange(page_end - 1, page_end + 1));
+    page_ranges.clear();
+    ASSERT_TRUE(reader->get_data_page_ranges(iter_opts, across_pages, &page_ranges).ok());
+    ASSERT_EQ(page_ranges.size(), 2);
+    EXPECT_EQ(page_ranges[0], ranges[page]);
+    EXPECT_EQ(page_ranges[1], ranges[page + 1]);
+}
+
+} // namespace doris::segment_v2
@@ -355,6 +355,23 @@ TEST_F(SegmentCacheTest, vec_sequence_col) {
     auto seq_v = read_block.get_by_position(4).column->get_int(0);
     ASSERT_EQ(100, seq_v);
 
+    // open the segment again with lazily created column readers, the result should not change
+    config::enable_segment_lazy_column_reader = true;
+    std::vector<segment_v2::SegmentSharedPtr> lazy_segments;
+    res = ((BetaRowset*)rowset.get())->load_segments(&lazy_segments);
+    config::enable_segment_lazy_column_reader = false;
+    ASSERT_TRUE(res.ok());
+    ASSERT_EQ(1, lazy_segments.size());
+    EXPECT_LT(lazy_segments[0]->meta_mem_usage(), segments[0]->meta_mem_usage());
+    std::unique_ptr<RowwiseIterator> lazy_iter;
+    s = lazy_segments[0]->new_iterator(schema, opts, &lazy_iter);
+    ASSERT_TRUE(s.ok());
+    auto lazy_read_block = rowset->tablet_schema()->create_block();
+    res = lazy_iter->next_batch(&lazy_read_block);
+    ASSERT_TRUE(res.ok()) << res;
+    ASSERT_EQ(1, lazy_read_block.rows());
+    ASSERT_EQ(100, lazy_read_block.get_by_position(4).column->get_int(0));
+
     res = engine_ref->tablet_manager()->drop_tablet(request.tablet_id, request.replica_id, false);
     ASSERT_TRUE(res.ok());
 }
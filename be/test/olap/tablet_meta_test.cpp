@@ -24,6 +24,7 @@
 #include <string>
 #include <utility>
 
+#include "common/config.h"
 #include "gtest/gtest_pred_impl.h"
 #include "olap/rowset/rowset.h"
 #include "olap/tablet_schema.h"
@@ -245,4 +246,36 @@ TEST(TabletMetaTest, TestDeleteBitmap) {
     }
 }
 
+TEST(TabletMetaTest, TestDeleteBitmapAggCacheOnCommit) {
+    bool enable_mow_get_agg_by_cache = config::enable_mow_get_agg_by_cache;
+    config::enable_mow_get_agg_by_cache = true;
+    DeleteBitmap dbmp(10087);
+    RowsetId rowset_id {3, 0, 1, 1};
+    for (uint32_t version = 1; version <= 3; ++version) {
+        dbmp.add({rowset_id, 0, version}, version);
+    }
+    ASSERT_EQ(dbmp.get_agg({rowset_id, 0, 3})->cardinality(), 3);
+    ASSERT_EQ(dbmp._get_rowset_cache_version({rowset_id, 0, 3}), 3);
+
+    // a publish of version 5 extends the cached aggregation of version 3
+    DeleteBitmap delta(10087);
+    delta.add({rowset_id, 0, 5}, 100);
+    delta.add({rowset_id, 1, 5}, 200);
+    dbmp.merge(delta);
+    dbmp.update_agg_cache(delta);
+    ASSERT_EQ(dbmp._get_rowset_cache_version({rowset_id, 0, 5}), 5);
+    ASSERT_EQ(dbmp._get_rowset_cache_version({rowset_id, 1, 5}), 5);
+    auto bm = dbmp.get_agg({rowset_id, 0, 5});
+    ASSERT_EQ(bm->cardinality(), 4);
+    ASSERT_TRUE(bm->contains(100));
+    ASSERT_EQ(dbmp.get_agg({rowset_id, 1, 5})->cardinality(), 1);
+
+    // nothing is deleted after version 5, reads of later versions share its bitmap
+    auto later = dbmp.get_agg({rowset_id, 0, 8});
+    ASSERT_EQ(later.get(), bm.get());
+    dbmp.add({rowset_id, 0, 7}, 101);
+    ASSERT_EQ(dbmp.get_agg({rowset_id, 0, 7})->cardinality(), 5);
+    config::enable_mow_get_agg_by_cache = enable_mow_get_agg_by_cache;
+}
+
 } // namespace doris
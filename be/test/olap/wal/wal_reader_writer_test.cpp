@@ -16,8 +16,10 @@
 // under the License.
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <filesystem>
 #include <memory>
+#include <thread>
 
 #include "agent/be_exec_version_manager.h"
 #include "common/object_pool.h"
@@ -25,6 +27,7 @@
 #include "gmock/gmock.h"
 #include "io/fs/local_file_system.h"
 #include "olap/wal/wal_reader.h"
+#include "olap/wal/wal_syncer.h"
 #include "olap/wal/wal_writer.h"
 #include "runtime/exec_env.h"
 #include "service/brpc.h"
@@ -138,4 +141,60 @@ TEST_F(WalReaderWriterTest, TestWriteAndRead1) {
     static_cast<void>(wal_reader.finalize());
     EXPECT_EQ(3, block_count);
 }
-} // namespace doris
\ No newline at end of file
+
+TEST_F(WalReaderWriterTest, TestSyncInGroups) {
+    WalSyncer wal_syncer(_s_test_data_path);
+    ASSERT_TRUE(wal_syncer.start().ok());
+    std::vector<std::shared_ptr<WalWriter>> wal_writers;
+    for (int i = 0; i < 2; ++i) {
+        auto wal_writer = std::make_shared<WalWriter>(_s_test_data_path + "/wal_" +
+                                                      std::to_string(i));
+        ASSERT_TRUE(wal_writer->init().ok());
+        wal_writers.push_back(wal_writer);
+    }
+    std::vector<std::thread> threads;
+    std::atomic<int> failed = 0;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&, i]() {
+            auto& wal_writer = wal_writers[i % wal_writers.size()];
+            for (int j = 0; j < 10; ++j) {
+                PBlock pblock;
+                generate_block(pblock, j * 1024);
+                if (!wal_writer->append_blocks(std::vector<PBlock*> {&pblock}).ok() ||
+                    !wal_syncer.sync(wal_writer).ok()) {
+                    ++failed;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(0, failed);
+
+    // a finalized wal is durable already
+    ASSERT_TRUE(wal_writers[0]->finalize().ok());
+    EXPECT_TRUE(wal_syncer.sync(wal_writers[0]).ok());
+    // the wal is synced by the caller after the syncer is stopped
+    wal_syncer.stop();
+    EXPECT_TRUE(wal_syncer.sync(wal_writers[1]).ok());
+    ASSERT_TRUE(wal_writers[1]->finalize().ok());
+
+    for (auto& wal_writer : wal_writers) {
+        auto wal_reader = WalReader(wal_writer->file_name());
+        ASSERT_TRUE(wal_reader.init().ok());
+        int block_count = 0;
+        while (true) {
+            PBlock pblock;
+            Status st = wal_reader.read_block(pblock);
+            if (!st.ok()) {
+                EXPECT_TRUE(st.is<ErrorCode::END_OF_FILE>());
+                break;
+            }
+            ++block_count;
+        }
+        static_cast<void>(wal_reader.finalize());
+        EXPECT_EQ(40, block_count);
+    }
+}
+} // namespace doris
@@ -205,6 +205,9 @@ TEST_F(MultiCastDataStreamerTest, NormTest) {
                     block2, ColumnHelper::create_block<DataTypeString>({"a", "b", "c"})));
         }
     }
+    // the blocks read by all the consumers are released from the buffered bytes
+    EXPECT_EQ(multi_cast_data_streamer->_multi_cast_blocks.size(), 0);
+    EXPECT_EQ(multi_cast_data_streamer->_cumulative_mem_size.load(), 0);
 }
 
 TEST_F(MultiCastDataStreamerTest, MultiTest) {
@@ -554,4 +554,74 @@ TEST_F(ExceptOperatorTest, test_refresh_hash_table) {
         EXPECT_TRUE(block.empty());
     }
 }
+
+TEST_F(IntersectOperatorTest, test_skip_probe_of_empty_result) {
+    init_op(3, {std::make_shared<DataTypeInt64>()});
+    sink_op->_child_exprs =
+            MockSlotRef::create_mock_contexts(DataTypes {std::make_shared<DataTypeInt64>()});
+    for (auto& probe_sink_op : probe_sink_ops) {
+        probe_sink_op->_child_exprs =
+                MockSlotRef::create_mock_contexts(DataTypes {std::make_shared<DataTypeInt64>()});
+    }
+
+    init_local_state();
+
+    {
+        Block block = ColumnHelper::create_block<DataTypeInt64>({1, 2, 3});
+        EXPECT_TRUE(sink_op->sink(state.get(), &block, true));
+    }
+    {
+        Block block = ColumnHelper::create_block<DataTypeInt64>({4, 5});
+        EXPECT_TRUE(probe_sink_ops[0]->sink(states[0].get(), &block, true));
+    }
+    EXPECT_EQ(shared_state->get_hash_table_size(), 0);
+    EXPECT_TRUE(OperatorHelper::is_ready(probe_sink_local_state[1]->dependencies()));
+    {
+        Block block = ColumnHelper::create_block<DataTypeInt64>({1, 2, 3, 4});
+        EXPECT_TRUE(probe_sink_ops[1]->sink(states[1].get(), &block, true));
+    }
+    EXPECT_EQ(probe_sink_local_state[0]->_skipped_probe_rows->value(), 0);
+    EXPECT_EQ(probe_sink_local_state[1]->_skipped_probe_rows->value(), 4);
+
+    {
+        Block block;
+        bool eos = false;
+        EXPECT_TRUE(source_op->get_block(state.get(), &block, &eos));
+        EXPECT_TRUE(block.empty());
+    }
+}
+
+TEST_F(ExceptOperatorTest, test_skip_probe_of_empty_result) {
+    init_op(3, {std::make_shared<DataTypeInt64>()});
+    sink_op->_child_exprs =
+            MockSlotRef::create_mock_contexts(DataTypes {std::make_shared<DataTypeInt64>()});
+    for (auto& probe_sink_op : probe_sink_ops) {
+        probe_sink_op->_child_exprs =
+                MockSlotRef::create_mock_contexts(DataTypes {std::make_shared<DataTypeInt64>()});
+    }
+
+    init_local_state();
+
+    {
+        Block block = ColumnHelper::create_block<DataTypeInt64>({1, 2, 3});
+        EXPECT_TRUE(sink_op->sink(state.get(), &block, true));
+    }
+    {
+        Block block = ColumnHelper::create_block<DataTypeInt64>({3, 2, 1, 0});
+        EXPECT_TRUE(probe_sink_ops[0]->sink(states[0].get(), &block, true));
+    }
+    EXPECT_EQ(shared_state->valid_element_in_hash_tbl, 0);
+    {
+        Block block = ColumnHelper::create_block<DataTypeInt64>({1, 5});
+        EXPECT_TRUE(probe_sink_ops[1]->sink(states[1].get(), &block, true));
+    }
+    EXPECT_EQ(probe_sink_local_state[1]->_skipped_probe_rows->value(), 2);
+
+    {
+        Block block;
+        bool eos = false;
+        EXPECT_TRUE(source_op->get_block(state.get(), &block, &eos));
+        EXPECT_TRUE(block.empty());
+    }
+}
 } // namespace doris::pipeline
\ No newline at end of file
@@ -19,7 +19,9 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <numeric>
 
+#include "common/config.h"
 #include "pipeline/exec/aggregation_sink_operator.h"
 #include "pipeline/exec/aggregation_source_operator.h"
 #include "pipeline/exec/mock_operator.h"
@@ -406,4 +408,96 @@ TEST_F(StreamingAggOperatorTest, test4) {
     { EXPECT_TRUE(local_state->close(state.get()).ok()); }
 }
 
+TEST_F(StreamingAggOperatorTest, adaptive_passthrough) {
+    const auto origin_retry_rows = config::streaming_agg_passthrough_retry_rows;
+    config::streaming_agg_passthrough_retry_rows = 1000;
+    op->_aggregate_evaluators.push_back(vectorized::create_mock_agg_fn_evaluator(
+            pool, MockSlotRef::create_mock_contexts(1, std::make_shared<DataTypeInt64>()), false,
+            false));
+    op->_pool = &pool;
+    op->_needs_finalize = false;
+    op->_is_merge = false;
+
+    EXPECT_TRUE(op->set_child(child_op));
+
+    EXPECT_TRUE(op->prepare(state.get()).ok());
+    op->_probe_expr_ctxs = MockSlotRef::create_mock_contexts(0, std::make_shared<DataTypeInt64>());
+
+    {
+        auto local_state = std::make_unique<MockStreamingAggLocalState>(state.get(), op.get());
+        LocalStateInfo info {.parent_profile = &profile,
+                             .scan_ranges = {},
+                             .shared_state = nullptr,
+                             .shared_state_map = {},
+                             .task_idx = 0};
+
+        EXPECT_TRUE(local_state->init(state.get(), info).ok());
+        state->resize_op_id_to_local_state(-100);
+        state->emplace_local_state(op->operator_id(), std::move(local_state));
+    }
+
+    {
+        local_state =
+                static_cast<MockStreamingAggLocalState*>(state->get_local_state(op->operator_id()));
+        EXPECT_TRUE(local_state->open(state.get()).ok());
+    }
+
+    auto unique_block = [](int64_t start, int64_t rows) {
+        std::vector<int64_t> keys(rows);
+        std::iota(keys.begin(), keys.end(), start);
+        return vectorized::Block {ColumnHelper::create_column_with_name<DataTypeInt64>(keys),
+                                  ColumnHelper::create_column_with_name<DataTypeInt64>(keys)};
+    };
+
+    // unique keys, the hash table outgrows L2 without any reduction
+    const int64_t rows = 100000;
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_FALSE(local_state->_adaptive_passthrough);
+        auto block = unique_block(i * rows, rows);
+        auto st = op->push(state.get(), &block, false);
+        EXPECT_TRUE(st.ok()) << st.msg();
+    }
+    EXPECT_TRUE(local_state->_adaptive_passthrough);
+    EXPECT_EQ(local_state->_get_hash_table_size(), 3 * rows);
+
+    {
+        local_state->should_not_do_pre_agg = true;
+        auto block = unique_block(3 * rows, 2000);
+        auto st = op->push(state.get(), &block, false);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_TRUE(local_state->_need_reset_hash_table);
+        EXPECT_FALSE(op->need_more_input_data(state.get()));
+    }
+
+    {
+        bool eos = false;
+        vectorized::Block block;
+        auto st = op->pull(state.get(), &block, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_FALSE(eos);
+        EXPECT_EQ(block.rows(), 2000);
+    }
+
+    {
+        // flush the hash table, then go on aggregating with an empty one
+        size_t flushed_rows = 0;
+        while (local_state->_need_reset_hash_table) {
+            bool eos = false;
+            vectorized::Block block;
+            auto st = op->pull(state.get(), &block, &eos);
+            EXPECT_TRUE(st.ok()) << st.msg();
+            EXPECT_FALSE(eos);
+            flushed_rows += block.rows();
+        }
+        EXPECT_EQ(flushed_rows, 3 * rows);
+        EXPECT_EQ(local_state->_get_hash_table_size(), 0);
+        EXPECT_FALSE(local_state->_adaptive_passthrough);
+        EXPECT_TRUE(local_state->_retrying_aggregation);
+        EXPECT_TRUE(op->need_more_input_data(state.get()));
+    }
+
+    { EXPECT_TRUE(local_state->close(state.get()).ok()); }
+    config::streaming_agg_passthrough_retry_rows = origin_retry_rows;
+}
+
 } // namespace doris::pipeline
@@ -408,6 +408,12 @@ TEST_F(PipelineTaskTest, TEST_EXECUTE) {
     {
         EXPECT_TRUE(task->close(Status::OK()).ok());
         EXPECT_EQ(task->_exec_state, PipelineTask::State::FINISHED);
+        // the task was blocked 4 times above
+        EXPECT_GT(task->_blocked_time_ns, 0);
+        EXPECT_EQ(task->_blocked_timer->value(), task->_blocked_time_ns);
+        auto stats = pip->last_finished_task();
+        EXPECT_GT(stats.finish_time_ns, 0);
+        EXPECT_EQ(stats.blocked_time_ns, task->_blocked_time_ns);
         EXPECT_TRUE(task->finalize().ok());
         EXPECT_EQ(task->_exec_state, PipelineTask::State::FINALIZED);
     }
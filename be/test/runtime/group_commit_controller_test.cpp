@@ -0,0 +1,112 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "runtime/group_commit_mgr.h"
+
+namespace doris {
+
+class GroupCommitControllerTest : public testing::Test {
+protected:
+    void SetUp() override {
+        _enable = config::enable_group_commit_adaptive_batching;
+        _max_interval_ms = config::group_commit_adaptive_max_interval_ms;
+        config::enable_group_commit_adaptive_batching = true;
+        config::group_commit_adaptive_max_interval_ms = 10000;
+    }
+
+    void TearDown() override {
+        config::enable_group_commit_adaptive_batching = _enable;
+        config::group_commit_adaptive_max_interval_ms = _max_interval_ms;
+    }
+
+    bool _enable = false;
+    int64_t _max_interval_ms = 0;
+};
+
+TEST_F(GroupCommitControllerTest, BaseWithoutHistory) {
+    GroupCommitController controller;
+    auto decision = controller.decide(1000, 64 << 20, 0);
+    EXPECT_EQ(1000, decision.interval_ms);
+    EXPECT_EQ(64 << 20, decision.data_bytes);
+}
+
+TEST_F(GroupCommitControllerTest, SlowLoadWaitsLonger) {
+    GroupCommitController controller;
+    // 1MB in 1s, it takes 4s to collect 4MB
+    controller.update(1 << 20, 1000, 10);
+    auto decision = controller.decide(1000, 4 << 20, 0);
+    EXPECT_EQ(4000, decision.interval_ms);
+    EXPECT_EQ(4 << 20, decision.data_bytes);
+
+    // not longer than the max interval
+    config::group_commit_adaptive_max_interval_ms = 2000;
+    decision = controller.decide(1000, 4 << 20, 0);
+    EXPECT_EQ(2000, decision.interval_ms);
+    EXPECT_EQ(4 << 20, decision.data_bytes);
+
+    // nor shorter than the property of the table
+    decision = controller.decide(3000, 4 << 20, 0);
+    EXPECT_EQ(3000, decision.interval_ms);
+}
+
+TEST_F(GroupCommitControllerTest, FastLoadCommitsMore) {
+    GroupCommitController controller;
+    // 16MB in 1s
+    controller.update(16 << 20, 1000, 10);
+    auto decision = controller.decide(1000, 4 << 20, 0);
+    EXPECT_EQ(1000, decision.interval_ms);
+    EXPECT_EQ(16 << 20, decision.data_bytes);
+
+    // at most 8 times the base data bytes
+    decision = controller.decide(1000, 1 << 20, 0);
+    EXPECT_EQ(8 << 20, decision.data_bytes);
+}
+
+TEST_F(GroupCommitControllerTest, SlowCommit) {
+    GroupCommitController controller;
+    controller.update(16 << 20, 1000, 3000);
+    auto decision = controller.decide(1000, 4 << 20, 0);
+    EXPECT_EQ(3000, decision.interval_ms);
+    EXPECT_EQ(32 << 20, decision.data_bytes);
+}
+
+TEST_F(GroupCommitControllerTest, BaseUnderMemoryPressure) {
+    GroupCommitController controller;
+    controller.update(1 << 20, 1000, 10);
+    auto decision = controller.decide(1000, 4 << 20, 0.6);
+    EXPECT_EQ(1000, decision.interval_ms);
+    EXPECT_EQ(4 << 20, decision.data_bytes);
+
+    config::enable_group_commit_adaptive_batching = false;
+    decision = controller.decide(1000, 4 << 20, 0);
+    EXPECT_EQ(1000, decision.interval_ms);
+}
+
+TEST_F(GroupCommitControllerTest, AverageOfHistory) {
+    GroupCommitController controller;
+    controller.update(1 << 20, 1000, 10);
+    controller.update(11 << 20, 1000, 10);
+    // 1MB + 0.3 * 10MB per second
+    auto decision = controller.decide(1000, 1 << 20, 0);
+    EXPECT_EQ(1000, decision.interval_ms);
+    EXPECT_EQ(4 << 20, decision.data_bytes);
+}
+
+} // namespace doris
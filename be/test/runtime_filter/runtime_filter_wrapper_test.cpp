@@ -1320,6 +1320,52 @@ TEST_F(RuntimeFilterWrapperTest, TestInOrBloom) {
     EXPECT_EQ(wrapper->contain_null(), false);
 }
 
+TEST_F(RuntimeFilterWrapperTest, TestInOrBloomDecideByNdv) {
+    using DataType = vectorized::DataTypeInt32;
+    int32_t max_in_num = 64;
+    RuntimeFilterParams params {.filter_id = 0,
+                                .filter_type = RuntimeFilterType::IN_OR_BLOOM_FILTER,
+                                .column_return_type = PrimitiveType::TYPE_INT,
+                                .null_aware = false,
+                                .max_in_num = max_in_num,
+                                .runtime_bloom_filter_min_size = 64,
+                                .runtime_bloom_filter_max_size = 128,
+                                .bloom_filter_size = 64,
+                                .build_bf_by_runtime_size = false,
+                                .bloom_filter_size_calculated_by_ndv = false,
+                                .enable_fixed_len_to_uint32_v2 = true,
+                                .bitmap_filter_not_in = false};
+    {
+        // Too many rows to wait for the ndv.
+        auto wrapper = std::make_shared<RuntimeFilterWrapper>(&params);
+        EXPECT_TRUE(wrapper->init(max_in_num * 9, true).ok());
+        EXPECT_EQ(wrapper->get_real_type(), RuntimeFilterType::BLOOM_FILTER);
+    }
+    auto wrapper = std::make_shared<RuntimeFilterWrapper>(&params);
+    // 80 rows with only 10 distinct values stay an in filter.
+    EXPECT_TRUE(wrapper->init(80, true).ok());
+    EXPECT_EQ(wrapper->get_real_type(), RuntimeFilterType::IN_FILTER);
+    std::vector<int> data_vector(80);
+    for (size_t i = 0; i < data_vector.size(); i++) {
+        data_vector[i] = int(i % 10);
+    }
+    EXPECT_TRUE(wrapper->insert(vectorized::ColumnHelper::create_column<DataType>(data_vector), 0)
+                        .ok());
+    EXPECT_EQ(wrapper->get_real_type(), RuntimeFilterType::IN_FILTER);
+    EXPECT_EQ(wrapper->hybrid_set()->size(), 10);
+
+    // More distinct values than max_in_num change it to a bloom filter with all values.
+    std::iota(data_vector.begin(), data_vector.end(), 100);
+    EXPECT_TRUE(wrapper->insert(vectorized::ColumnHelper::create_column<DataType>(data_vector), 0)
+                        .ok());
+    EXPECT_EQ(wrapper->get_real_type(), RuntimeFilterType::BLOOM_FILTER);
+    std::vector<int> probe {0, 9, 100, 179};
+    std::vector<uint8_t> res(probe.size());
+    wrapper->bloom_filter_func()->find_fixed_len(
+            vectorized::ColumnHelper::create_column<DataType>(probe), res.data());
+    EXPECT_TRUE(std::all_of(res.begin(), res.end(), [](uint8_t i) -> bool { return i; }));
+}
+
 TEST_F(RuntimeFilterWrapperTest, TestErrorPath) {
     using DataType = vectorized::DataTypeInt32;
     int32_t filter_id = 0;
@@ -17,12 +17,15 @@
 
 #include "util/block_compression.h"
 
+#include <fmt/format.h>
 #include <gen_cpp/segment_v2.pb.h>
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 #include <stdlib.h>
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest_pred_impl.h"
 #include "util/faststring.h"
@@ -148,4 +151,44 @@ TEST_F(BlockCompressionTest, multi) {
     test_multi_slices(segment_v2::CompressionTypePB::ZSTD);
 }
 
+TEST_F(BlockCompressionTest, zstd_dict) {
+    // short rows sharing most of their bytes, like the pages of a text column
+    std::vector<std::string> pages;
+    for (int i = 0; i < 1000; ++i) {
+        pages.emplace_back(fmt::format("{{\"user_id\": {}, \"status\": \"active\", \"region\": "
+                                       "\"ap-southeast-{}\"}}",
+                                       i, i % 3));
+    }
+    std::vector<Slice> samples(pages.begin(), pages.end());
+    std::string dict;
+    EXPECT_TRUE(train_zstd_dictionary(samples, 4096, &dict).ok());
+    EXPECT_FALSE(dict.empty());
+    EXPECT_LE(dict.size(), 4096);
+
+    std::unique_ptr<BlockCompressionCodec> dict_codec;
+    EXPECT_TRUE(create_zstd_dict_codec(dict, &dict_codec).ok());
+    BlockCompressionCodec* plain_codec;
+    EXPECT_TRUE(
+            get_block_compression_codec(segment_v2::CompressionTypePB::ZSTD, &plain_codec).ok());
+
+    const auto& page = pages[42];
+    faststring plain_compressed;
+    EXPECT_TRUE(plain_codec->compress(page, &plain_compressed).ok());
+    faststring compressed;
+    EXPECT_TRUE(dict_codec->compress(page, &compressed).ok());
+    EXPECT_LT(compressed.size(), plain_compressed.size());
+
+    std::string uncompressed(page.size(), '\0');
+    Slice uncompressed_slice(uncompressed);
+    EXPECT_TRUE(dict_codec->decompress(Slice(compressed), &uncompressed_slice).ok());
+    EXPECT_EQ(page, uncompressed);
+
+    // the frame refers to the dictionary, it can not be read without it
+    uncompressed_slice = Slice(uncompressed);
+    EXPECT_FALSE(plain_codec->decompress(Slice(compressed), &uncompressed_slice).ok());
+
+    // too few samples to train from
+    EXPECT_FALSE(train_zstd_dictionary({Slice(page)}, 4096, &dict).ok());
+}
+
 } // namespace doris
@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/deletion_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace doris {
+
+static void append_big_endian(std::string* buf, uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        buf->push_back(static_cast<char>((value >> shift) & 0xff));
+    }
+}
+
+// length(4 bytes) + magic number(4 bytes) + serialized roaring bitmap, see paimon DeletionVector
+static std::string serialize(const roaring::Roaring& roaring_bitmap) {
+    std::string bitmap(roaring_bitmap.getSizeInBytes(), '\0');
+    roaring_bitmap.write(bitmap.data());
+    std::string buf;
+    append_big_endian(&buf, static_cast<uint32_t>(bitmap.size() + 4));
+    append_big_endian(&buf, DeletionVector::MAGIC_NUMBER);
+    buf.append(bitmap);
+    return buf;
+}
+
+TEST(DeletionVectorTest, to_sorted_rows) {
+    roaring::Roaring roaring_bitmap;
+    std::vector<int64_t> expected;
+    for (uint32_t i = 0; i < 200000; i += 7) {
+        roaring_bitmap.add(i);
+        expected.push_back(i);
+    }
+    roaring_bitmap.add(4000000000U);
+    expected.push_back(4000000000U);
+    std::string buf = serialize(roaring_bitmap);
+
+    auto deletion_vector = DeletionVector::deserialize(buf.data(), buf.size());
+    ASSERT_TRUE(deletion_vector.has_value());
+    EXPECT_FALSE(deletion_vector->is_empty());
+    EXPECT_TRUE(deletion_vector->is_delete(7));
+    EXPECT_FALSE(deletion_vector->is_delete(8));
+
+    std::vector<int64_t> rows {-1};
+    deletion_vector->to_sorted_rows(&rows);
+    ASSERT_EQ(rows.size(), expected.size() + 1);
+    EXPECT_EQ(rows[0], -1);
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), rows.begin() + 1));
+}
+
+TEST(DeletionVectorTest, deserialize_error) {
+    roaring::Roaring roaring_bitmap;
+    roaring_bitmap.add(1);
+    std::string buf = serialize(roaring_bitmap);
+
+    std::string wrong_length = buf;
+    wrong_length.push_back('\0');
+    EXPECT_FALSE(DeletionVector::deserialize(wrong_length.data(), wrong_length.size()).has_value());
+
+    std::string wrong_magic = buf;
+    wrong_magic[4] = static_cast<char>(wrong_magic[4] + 1);
+    EXPECT_FALSE(DeletionVector::deserialize(wrong_magic.data(), wrong_magic.size()).has_value());
+}
+
+} // namespace doris
@@ -128,6 +128,69 @@ TEST_F(TestForCoding, TestSkipOneFrame) {
     test_skip(128);
 }
 
+TEST_F(TestForCoding, TestSkipBackAfterBatch) {
+    faststring buffer(1);
+    ForEncoder<uint32_t> encoder(&buffer);
+    std::vector<uint32_t> input_data;
+    for (uint32_t i = 0; i < 512; ++i) {
+        input_data.push_back(i * 3);
+    }
+    encoder.put_batch(input_data.data(), input_data.size());
+    encoder.flush();
+
+    ForDecoder<uint32_t> decoder(buffer.data(), buffer.length());
+    decoder.init();
+    // decodes the first three frames directly into the output
+    std::vector<uint32_t> actual_result(384);
+    EXPECT_TRUE(decoder.get_batch(actual_result.data(), 384));
+    // move back into the last frame decoded above
+    EXPECT_TRUE(decoder.skip(-64));
+    std::vector<uint32_t> tail(128);
+    EXPECT_TRUE(decoder.get_batch(tail.data(), 128));
+    EXPECT_EQ(std::vector<uint32_t>(input_data.begin() + 320, input_data.begin() + 448), tail);
+}
+
+TEST_F(TestForCoding, TestMinDeltaFormat) {
+    // second level timestamps sampled every ~10 seconds, plus a frame with a constant interval
+    std::vector<int64_t> input_data;
+    int64_t ts = 1700000000;
+    for (int i = 0; i < 300; ++i) {
+        ts += i < 128 ? 10 : 9 + (i * 7) % 3;
+        input_data.push_back(ts);
+    }
+
+    faststring plain_buffer(1);
+    ForEncoder<int64_t> plain_encoder(&plain_buffer);
+    plain_encoder.put_batch(input_data.data(), input_data.size());
+    plain_encoder.flush();
+
+    faststring buffer(1);
+    ForEncoder<int64_t> encoder(&buffer, true);
+    encoder.put_batch(input_data.data(), input_data.size());
+    encoder.flush();
+    EXPECT_LT(buffer.size(), plain_buffer.size());
+
+    ForDecoder<int64_t> decoder(buffer.data(), buffer.length());
+    decoder.init();
+    std::vector<int64_t> actual_result(input_data.size());
+    EXPECT_TRUE(decoder.get_batch(actual_result.data(), input_data.size()));
+    EXPECT_EQ(input_data, actual_result);
+
+    EXPECT_TRUE(decoder.skip(-(int32_t)input_data.size() + 140));
+    int64_t value;
+    EXPECT_TRUE(decoder.get(&value));
+    EXPECT_EQ(input_data[140], value);
+
+    bool exact_match;
+    EXPECT_TRUE(decoder.seek_at_or_after_value(&input_data[200], &exact_match));
+    EXPECT_TRUE(exact_match);
+    EXPECT_EQ(200, decoder.current_index());
+    int64_t target = input_data[200] + 1;
+    EXPECT_TRUE(decoder.seek_at_or_after_value(&target, &exact_match));
+    EXPECT_FALSE(exact_match);
+    EXPECT_EQ(201, decoder.current_index());
+}
+
 TEST_F(TestForCoding, TestInt64) {
     faststring buffer(1);
     ForEncoder<int64_t> encoder(&buffer);
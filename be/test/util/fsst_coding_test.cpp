@@ -0,0 +1,131 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/fsst_coding.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace doris {
+
+class FsstCodingTest : public testing::Test {
+public:
+    static std::vector<std::string> make_urls(size_t num) {
+        std::mt19937 rng(42);
+        std::vector<std::string> paths {"index.html", "search", "api/v1/items", "static/app.js"};
+        std::vector<std::string> urls;
+        for (size_t i = 0; i < num; ++i) {
+            urls.push_back("https://www.example.com/" + paths[rng() % paths.size()] +
+                           "?user_id=" + std::to_string(rng() % 100000) +
+                           "&session=" + std::to_string(rng()));
+        }
+        return urls;
+    }
+
+    // compress every string on its own with a table trained on all of them, and check that
+    // each decompresses back
+    static size_t round_trip(const std::vector<std::string>& values, FsstSymbolTable* table) {
+        std::vector<Slice> samples(values.begin(), values.end());
+        table->train(samples);
+
+        faststring serialized;
+        table->serialize(&serialized);
+        FsstSymbolTable read_table;
+        size_t consumed = 0;
+        EXPECT_TRUE(read_table.deserialize(serialized.data(), serialized.size(), &consumed));
+        EXPECT_EQ(serialized.size(), consumed);
+        EXPECT_EQ(table->num_symbols(), read_table.num_symbols());
+
+        size_t compressed_size = consumed;
+        for (const auto& value : values) {
+            faststring compressed;
+            table->compress(Slice(value), &compressed);
+            EXPECT_LE(compressed.size(), table->max_compressed_size(value.size()));
+            compressed_size += compressed.size();
+
+            size_t size = read_table.decompressed_size(compressed.data(), compressed.size());
+            EXPECT_EQ(value.size(), size);
+            std::vector<uint8_t> decompressed(size + FsstSymbolTable::DECOMPRESS_PADDING);
+            EXPECT_EQ(size, read_table.decompress(compressed.data(), compressed.size(),
+                                                  decompressed.data()));
+            EXPECT_EQ(value, std::string(reinterpret_cast<char*>(decompressed.data()), size));
+        }
+        return compressed_size;
+    }
+};
+
+TEST_F(FsstCodingTest, compress_urls) {
+    auto urls = make_urls(1000);
+    size_t raw_size = 0;
+    for (const auto& url : urls) {
+        raw_size += url.size();
+    }
+    FsstSymbolTable table;
+    size_t compressed_size = round_trip(urls, &table);
+    EXPECT_GT(table.num_symbols(), 0);
+    EXPECT_LT(compressed_size * 2, raw_size);
+}
+
+TEST_F(FsstCodingTest, incompressible_values) {
+    std::mt19937 rng(7);
+    std::vector<std::string> values;
+    for (int i = 0; i < 200; ++i) {
+        std::string value(16, '\0');
+        for (auto& c : value) {
+            c = static_cast<char>(rng());
+        }
+        values.push_back(value);
+    }
+    FsstSymbolTable table;
+    round_trip(values, &table);
+    // symbols would not pay off, the strings are kept as they are
+    EXPECT_EQ(0, table.num_symbols());
+}
+
+TEST_F(FsstCodingTest, special_values) {
+    // empty strings, the escape byte itself and bytes missing from the training sample
+    std::vector<std::string> values {"", "aaaaaaaaaaaaaaaaaaaaaaaa", std::string(1, '\xff'),
+                                     "aaaa\xff\xff", std::string(3, '\0'), "aaaaaaaaaaaa"};
+    FsstSymbolTable table;
+    round_trip(values, &table);
+
+    faststring compressed;
+    std::string unseen = "zzz aaaaaaaa";
+    table.compress(Slice(unseen), &compressed);
+    std::vector<uint8_t> decompressed(unseen.size() + FsstSymbolTable::DECOMPRESS_PADDING);
+    EXPECT_EQ(unseen.size(),
+              table.decompress(compressed.data(), compressed.size(), decompressed.data()));
+    EXPECT_EQ(unseen, std::string(reinterpret_cast<char*>(decompressed.data()), unseen.size()));
+}
+
+TEST_F(FsstCodingTest, invalid_table) {
+    FsstSymbolTable table;
+    size_t consumed = 0;
+    EXPECT_FALSE(table.deserialize(nullptr, 0, &consumed));
+    // two symbols, the second one longer than the symbol bytes left
+    uint8_t data[] = {2, 1, 5, 'a', 'b'};
+    EXPECT_FALSE(table.deserialize(data, sizeof(data), &consumed));
+    // a symbol longer than 8 bytes
+    uint8_t long_symbol[] = {1, 9, 'a', 'a', 'a', 'a', 'a', 'a', 'a', 'a', 'a'};
+    EXPECT_FALSE(table.deserialize(long_symbol, sizeof(long_symbol), &consumed));
+    EXPECT_EQ(0, table.num_symbols());
+}
+
+} // namespace doris
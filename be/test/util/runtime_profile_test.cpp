@@ -144,6 +144,9 @@ TEST(RuntimeProfileTest, ProtoBasic) {
     ss.clear();
 
     ASSERT_EQ(proto_profile.nodes_size(), 3);
+    ASSERT_EQ(proto_profile.nodes(0).counters_size(), 1);
+    EXPECT_EQ(proto_profile.nodes(0).counters(0).value(), 1);
+    EXPECT_EQ(proto_profile.nodes(0).counters(0).level(), 2);
 
     // Deserialize from proto
     std::unique_ptr<RuntimeProfile> from_proto = RuntimeProfile::from_proto(proto_profile);
@@ -213,6 +213,30 @@ TEST(StringToInt, InvalidLeadingTrailing) {
     test_int_value<int8_t>("   ", 0, StringParser::PARSE_FAILURE);
 }
 
+TEST(StringToInt, EightDigitsAtOnce) {
+    // every length and every position of the first non digit around the 8 digits chunks
+    const std::string digits = "123456789012345678";
+    for (size_t len = 1; len <= digits.size(); ++len) {
+        std::string str = digits.substr(0, len);
+        test_int_value<int64_t>(str.c_str(), std::stoll(str), StringParser::PARSE_SUCCESS);
+        std::string with_fraction = str + ".25";
+        StringParser::ParseResult result;
+        EXPECT_EQ(std::stoll(str), StringParser::string_to_int<int64_t>(
+                                           with_fraction.data(), with_fraction.size(), &result));
+        EXPECT_EQ(result, StringParser::PARSE_SUCCESS);
+        for (size_t pos = 1; pos < len; ++pos) {
+            std::string invalid = str;
+            invalid[pos] = ':';
+            test_int_value<int64_t>(invalid.c_str(), 0, StringParser::PARSE_FAILURE);
+            invalid[pos] = '/';
+            test_int_value<int64_t>(invalid.c_str(), 0, StringParser::PARSE_FAILURE);
+        }
+    }
+    test_int_value<int32_t>("-987654321", -987654321, StringParser::PARSE_SUCCESS);
+    test_unsigned_int_value<uint64_t>("9876543210987654", 9876543210987654ULL,
+                                      StringParser::PARSE_SUCCESS);
+}
+
 TEST(StringToInt, Limit) {
     test_int_value<int8_t>("127", 127, StringParser::PARSE_SUCCESS);
     test_int_value<int8_t>("-128", -128, StringParser::PARSE_SUCCESS);
@@ -23,6 +23,7 @@
 #include <boost/utility/binary.hpp>
 #include <iostream>
 
+#include "cctz/civil_time.h"
 #include "cctz/time_zone.h"
 #include "gtest/gtest.h"
 #include "gtest/gtest_pred_impl.h"
@@ -141,4 +142,35 @@ TEST(TimezoneUtilsTest, FindTimezone) {
     EXPECT_FALSE(TimezoneUtils::find_cctz_time_zone(tzname, result));
 }
 
+TEST(TimezoneUtilsTest, TimezoneConverter) {
+    TimezoneUtils::load_timezones_to_cache();
+    const cctz::civil_second epoch(1970, 1, 1, 0, 0, 0);
+    // DST of 1 hour and of 30 minutes, a skipped day, and a fixed offset
+    for (std::string tzname : {"America/Los_Angeles", "Australia/Lord_Howe", "Pacific/Apia",
+                               "Asia/Shanghai", "+05:30"}) {
+        cctz::time_zone ctz;
+        ASSERT_TRUE(TimezoneUtils::find_cctz_time_zone(tzname, ctz)) << tzname;
+        TimezoneConverter to_civil(ctz);
+        TimezoneConverter to_unix(ctz);
+        // steps not dividing an hour to hit the skipped and repeated civil times around transitions
+        const int64_t end = cctz::civil_second(2030, 1, 1, 0, 0, 0) - epoch;
+        for (int64_t seconds = cctz::civil_second(1900, 1, 1, 0, 0, 0) - epoch; seconds < end;
+             seconds += 3607) {
+            const auto tp = cctz::time_point<cctz::seconds>(cctz::seconds(seconds));
+            ASSERT_EQ(cctz::convert(tp, ctz) - epoch, to_civil.to_civil_seconds(seconds))
+                    << tzname << " " << seconds;
+            ASSERT_EQ(cctz::convert(epoch + seconds, ctz).time_since_epoch().count(),
+                      to_unix.to_unix_seconds(seconds))
+                    << tzname << " " << seconds;
+        }
+        // cctz does not enumerate the transitions this far ahead
+        const int64_t far = cctz::civil_second(9000, 7, 1, 0, 0, 0) - epoch;
+        const auto tp = cctz::time_point<cctz::seconds>(cctz::seconds(far));
+        EXPECT_EQ(cctz::convert(tp, ctz) - epoch, to_civil.to_civil_seconds(far)) << tzname;
+        EXPECT_EQ(cctz::convert(epoch + far, ctz).time_since_epoch().count(),
+                  to_unix.to_unix_seconds(far))
+                << tzname;
+    }
+}
+
 } // namespace doris
@@ -18,6 +18,8 @@
 #include <gtest/gtest.h>
 
 #include "agg_function_test.h"
+#include "vec/aggregate_functions/aggregate_function_count.h"
+#include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_number.h"
 
 namespace doris::vectorized {
@@ -30,4 +32,30 @@ TEST_F(AggregateFunctionCountTest, test_int64) {
     execute(Block({ColumnHelper::create_column_with_name<DataTypeInt64>({1, 2, 3})}),
             ColumnHelper::create_column_with_name<DataTypeInt64>({3}));
 }
+
+TEST_F(AggregateFunctionCountTest, test_sliding_frame_incremental) {
+    // count(x) over (rows between 2 preceding and current row)
+    auto column = ColumnHelper::create_nullable_column<DataTypeInt64>({1, 2, 3, 4, 5, 6},
+                                                                      {0, 1, 0, 0, 1, 1});
+    AggregateFunctionCountNotNullUnary function(
+            {std::make_shared<DataTypeNullable>(std::make_shared<DataTypeInt64>())});
+    EXPECT_TRUE(function.supported_incremental_mode());
+
+    Arena arena;
+    auto* place = reinterpret_cast<AggregateDataPtr>(arena.alloc(function.size_of_data()));
+    function.create(place);
+    const IColumn* columns[] {column.get()};
+    UInt8 use_null_result = 0;
+    UInt8 could_use_previous_result = 0;
+    auto result = ColumnInt64::create();
+    for (int64_t row = 0; row < 6; ++row) {
+        function.execute_function_with_incremental(0, 6, row - 2, row + 1, place, columns, arena,
+                                                   false, false, false, &use_null_result,
+                                                   &could_use_previous_result);
+        function.insert_result_into(place, *result);
+    }
+    EXPECT_TRUE(ColumnHelper::column_equal(
+            std::move(result), ColumnHelper::create_column<DataTypeInt64>({1, 1, 2, 2, 2, 1})));
+    function.destroy(place);
+}
 } // namespace doris::vectorized
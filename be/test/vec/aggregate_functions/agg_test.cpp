@@ -27,10 +27,13 @@
 #include "vec/aggregate_functions/aggregate_function_simple_factory.h"
 #include "vec/aggregate_functions/aggregate_function_topn.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
 #include "vec/columns/column_string.h"
 #include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
 #include "vec/core/field.h"
 #include "vec/core/types.h"
+#include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/data_types/data_type_string.h"
 
@@ -68,6 +71,84 @@ TEST(AggTest, basic_test) {
     agg_function->destroy(place);
 }
 
+TEST(AggTest, sum_batch_test) {
+    Arena arena;
+    auto column_vector_int32 = ColumnInt32::create();
+    for (int i = 0; i < agg_test_batch_size; i++) {
+        column_vector_int32->insert(Field::create_field<TYPE_INT>(cast_to_nearest_field_type(i)));
+    }
+    AggregateFunctionSimpleFactory factory;
+    register_aggregate_function_sum(factory);
+    DataTypes data_types = {std::make_shared<DataTypeInt32>()};
+    auto agg_function = factory.get("sum", data_types, false, -1);
+    const IColumn* column[1] = {column_vector_int32.get()};
+
+    // Scatter the rows over two states by parity.
+    const size_t size_of_data = agg_function->size_of_data();
+    std::unique_ptr<char[]> memory(new char[size_of_data * 3]);
+    AggregateDataPtr states[3] = {memory.get(), memory.get() + size_of_data,
+                                  memory.get() + 2 * size_of_data};
+    for (auto* state : states) {
+        agg_function->create(state);
+    }
+    std::vector<AggregateDataPtr> places(agg_test_batch_size);
+    for (int i = 0; i < agg_test_batch_size; i++) {
+        places[i] = states[i % 2];
+    }
+    agg_function->add_batch(agg_test_batch_size, places.data(), 0, column, arena);
+    agg_function->add_batch_single_place(agg_test_batch_size, states[2], column, arena);
+
+    int64_t even = 0;
+    int64_t odd = 0;
+    for (int i = 0; i < agg_test_batch_size; i++) {
+        (i % 2 ? odd : even) += i;
+    }
+    EXPECT_EQ(even, *reinterpret_cast<int64_t*>(states[0]));
+    EXPECT_EQ(odd, *reinterpret_cast<int64_t*>(states[1]));
+    EXPECT_EQ(even + odd, *reinterpret_cast<int64_t*>(states[2]));
+    for (auto* state : states) {
+        agg_function->destroy(state);
+    }
+}
+
+TEST(AggTest, nullable_sum_batch_single_place_test) {
+    Arena arena;
+    auto column = ColumnNullable::create(ColumnInt32::create(), ColumnUInt8::create());
+    int64_t expected = 0;
+    for (int i = 0; i < agg_test_batch_size; i++) {
+        // runs of not null and null rows of different lengths
+        if (i % 7 < 4) {
+            column->insert(Field::create_field<TYPE_INT>(cast_to_nearest_field_type(i)));
+            expected += i;
+        } else {
+            column->insert_default();
+        }
+    }
+    auto all_null_column = ColumnNullable::create(ColumnInt32::create(), ColumnUInt8::create());
+    all_null_column->insert_many_defaults(agg_test_batch_size);
+
+    AggregateFunctionSimpleFactory factory;
+    register_aggregate_function_sum(factory);
+    DataTypes data_types = {make_nullable(std::make_shared<DataTypeInt32>())};
+    auto agg_function = factory.get("sum", data_types, true, -1);
+    std::unique_ptr<char[]> memory(new char[agg_function->size_of_data()]);
+    AggregateDataPtr place = memory.get();
+
+    auto result = make_nullable(std::make_shared<DataTypeInt64>())->create_column();
+    for (const auto* input : {column.get(), all_null_column.get()}) {
+        agg_function->create(place);
+        const IColumn* columns[1] = {input};
+        agg_function->add_batch_single_place(agg_test_batch_size, place, columns, arena);
+        agg_function->insert_result_into(place, *result);
+        agg_function->destroy(place);
+    }
+    const auto& nullable_result = assert_cast<const ColumnNullable&>(*result);
+    EXPECT_FALSE(nullable_result.is_null_at(0));
+    EXPECT_EQ(expected, assert_cast<const ColumnInt64&>(nullable_result.get_nested_column())
+                                .get_element(0));
+    EXPECT_TRUE(nullable_result.is_null_at(1));
+}
+
 TEST(AggTest, topn_test) {
     Arena arena;
     MutableColumns datas(2);
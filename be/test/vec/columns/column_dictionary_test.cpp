@@ -357,6 +357,7 @@ TEST_F(ColumnDictionaryTest, convert_to_predicate_column_if_dictionary) {
                                            dict_array.data(), dict_indices_row_count,
                                            dict_data_row_count);
     auto col_converted = tmp_column_dict->convert_to_predicate_column_if_dictionary();
+    EXPECT_EQ(col_converted->size(), dict_indices_row_count);
     for (size_t i = 0; i != dict_indices_row_count; ++i) {
         // EXPECT_EQ(col_converted->get_data_at(i), column_dict_data->get_data_at(i));
     }
@@ -24,6 +24,7 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "runtime/define_primitive_type.h"
 #include "vec/columns/common_column_test.h"
 #include "vec/data_types/data_type_factory.hpp"
@@ -351,4 +352,33 @@ TEST_F(ColumnVariantTest, test_insert_indices_from) {
     }
 }
 
+TEST_F(ColumnVariantTest, finalize_keeps_materialized_paths) {
+    auto ratio = config::variant_ratio_of_defaults_as_sparse_column;
+    auto threshold = config::variant_threshold_rows_to_estimate_sparse_column;
+    config::variant_ratio_of_defaults_as_sparse_column = 0.5;
+    config::variant_threshold_rows_to_estimate_sparse_column = 1;
+
+    // both paths have one value out of four rows, so both look sparse
+    auto make_subcolumn = []() {
+        ColumnVariant::Subcolumn subcolumn(0, true);
+        subcolumn.insert(Field::create_field<TYPE_INT>(1));
+        subcolumn.insert_many_defaults(3);
+        return subcolumn;
+    };
+    ColumnVariant::Subcolumns subcolumns;
+    subcolumns.create_root(ColumnVariant::Subcolumn(4, true, true /*root*/));
+    subcolumns.add(PathInData("a"), make_subcolumn());
+    subcolumns.add(PathInData("b"), make_subcolumn());
+    auto variant = ColumnVariant::create(std::move(subcolumns), true);
+
+    variant->finalize(ColumnVariant::FinalizeMode::WRITE_MODE, {PathInData("b")});
+    EXPECT_NE(variant->get_sparse_subcolumns().find_exact(PathInData("a")), nullptr);
+    EXPECT_EQ(variant->get_subcolumns().find_exact(PathInData("a")), nullptr);
+    EXPECT_EQ(variant->get_sparse_subcolumns().find_exact(PathInData("b")), nullptr);
+    EXPECT_NE(variant->get_subcolumns().find_exact(PathInData("b")), nullptr);
+
+    config::variant_ratio_of_defaults_as_sparse_column = ratio;
+    config::variant_threshold_rows_to_estimate_sparse_column = threshold;
+}
+
 } // namespace doris::vectorized
@@ -0,0 +1,151 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/hash_table/join_hash_table.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+#include "common/config.h"
+
+namespace doris {
+
+class JoinHashTableTest : public testing::Test {
+public:
+    void SetUp() override {
+        _enable_clustered_build = config::enable_hash_join_clustered_build;
+        _clustered_build_min_rows = config::hash_join_clustered_build_min_rows;
+    }
+
+    void TearDown() override {
+        config::enable_hash_join_clustered_build = _enable_clustered_build;
+        config::hash_join_clustered_build_min_rows = _clustered_build_min_rows;
+    }
+
+protected:
+    using Table = JoinHashTable<uint64_t>;
+
+    template <int JoinOpType>
+    void build(Table& table, const std::vector<uint64_t>& build_keys, bool clustered) {
+        config::enable_hash_join_clustered_build = clustered;
+        config::hash_join_clustered_build_min_rows = 0;
+        table.template prepare_build<JoinOpType>(build_keys.size(), BATCH_SIZE, false);
+        _build_buckets.resize(build_keys.size());
+        for (size_t i = 0; i < build_keys.size(); i++) {
+            _build_buckets[i] = uint32_t(table.hash(build_keys[i]) & (table.get_bucket_size() - 1));
+        }
+        table.build(build_keys.data(), _build_buckets.data(), build_keys.size(), false);
+        EXPECT_EQ(table.is_clustered(), clustered);
+    }
+
+    // Probe all keys and return the matched (probe row, build row) pairs in sorted order.
+    template <int JoinOpType>
+    std::vector<std::pair<uint32_t, uint32_t>> probe(Table& table,
+                                                     const std::vector<uint64_t>& probe_keys) {
+        DorisVector<uint32_t> build_idx_map(probe_keys.size());
+        for (size_t i = 0; i < probe_keys.size(); i++) {
+            build_idx_map[i] = uint32_t(table.hash(probe_keys[i]) & (table.get_bucket_size() - 1));
+        }
+        table.pre_build_idxs(build_idx_map);
+
+        std::vector<uint32_t> probe_idxs(BATCH_SIZE + 1);
+        std::vector<uint32_t> build_idxs(BATCH_SIZE + 1);
+        std::vector<std::pair<uint32_t, uint32_t>> result;
+        int probe_idx = 0;
+        uint32_t build_idx = 0;
+        bool probe_visited = false;
+        const int probe_rows = int(probe_keys.size());
+        while (probe_idx < probe_rows || build_idx != 0) {
+            auto [new_probe_idx, new_build_idx, matched_cnt] =
+                    table.template find_batch<JoinOpType>(
+                            probe_keys.data(), build_idx_map.data(), probe_idx, build_idx,
+                            probe_rows, probe_idxs.data(), probe_visited, build_idxs.data(),
+                            nullptr, false, false, false);
+            for (uint32_t i = 0; i < matched_cnt; i++) {
+                result.emplace_back(probe_idxs[i], build_idxs[i]);
+            }
+            probe_idx = new_probe_idx;
+            build_idx = new_build_idx;
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    static constexpr int BATCH_SIZE = 64;
+
+private:
+    bool _enable_clustered_build = false;
+    int64_t _clustered_build_min_rows = 0;
+    std::vector<uint32_t> _build_buckets;
+};
+
+TEST_F(JoinHashTableTest, ClusteredBuildInnerJoin) {
+    // the first row of build side is mocked
+    std::vector<uint64_t> build_keys {0};
+    for (uint64_t i = 0; i < 1000; i++) {
+        // every key has i % 4 + 1 duplicated rows
+        for (uint64_t j = 0; j <= i % 4; j++) {
+            build_keys.push_back(i * 7);
+        }
+    }
+    std::vector<uint64_t> probe_keys;
+    for (uint64_t i = 0; i < 3000; i++) {
+        probe_keys.push_back(i);
+    }
+
+    Table chained;
+    build<TJoinOp::INNER_JOIN>(chained, build_keys, false);
+    Table clustered;
+    build<TJoinOp::INNER_JOIN>(clustered, build_keys, true);
+
+    auto expected = probe<TJoinOp::INNER_JOIN>(chained, probe_keys);
+    auto actual = probe<TJoinOp::INNER_JOIN>(clustered, probe_keys);
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(expected, actual);
+    for (auto [probe_row, build_row] : actual) {
+        EXPECT_EQ(probe_keys[probe_row], build_keys[build_row]);
+    }
+}
+
+TEST_F(JoinHashTableTest, ClusteredBuildRightOuterJoinVisited) {
+    std::vector<uint64_t> build_keys {0};
+    for (uint64_t i = 1; i <= 500; i++) {
+        build_keys.push_back(i);
+        build_keys.push_back(i);
+    }
+    // only probe the even keys
+    std::vector<uint64_t> probe_keys;
+    for (uint64_t i = 2; i <= 500; i += 2) {
+        probe_keys.push_back(i);
+    }
+
+    Table clustered;
+    build<TJoinOp::RIGHT_OUTER_JOIN>(clustered, build_keys, true);
+    auto result = probe<TJoinOp::RIGHT_OUTER_JOIN>(clustered, probe_keys);
+    EXPECT_EQ(result.size(), probe_keys.size() * 2);
+
+    // `visited` is indexed by build row even if the rows are stored clustered
+    const auto& visited = clustered.get_visited();
+    for (size_t row = 1; row < build_keys.size(); row++) {
+        EXPECT_EQ(bool(visited[row]), build_keys[row] % 2 == 0) << row;
+    }
+}
+
+} // namespace doris
@@ -0,0 +1,110 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/hash_table/two_level_ph_hash_map.h"
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+#include "common/config.h"
+#include "vec/common/hash_table/hash.h"
+
+namespace doris::vectorized {
+
+class TwoLevelPHHashMapTest : public testing::Test {
+public:
+    void SetUp() override {
+        _origin_threshold = config::agg_two_level_hash_table_threshold;
+        config::agg_two_level_hash_table_threshold = 1000;
+    }
+    void TearDown() override { config::agg_two_level_hash_table_threshold = _origin_threshold; }
+
+private:
+    int64_t _origin_threshold = 0;
+};
+
+using TestMap = TwoLevelPHHashMap<UInt64, int64_t, HashCRC32<UInt64>>;
+
+TEST_F(TwoLevelPHHashMapTest, ConvertAndFind) {
+    TestMap map;
+    const size_t rows = 10000;
+    for (size_t i = 0; i < rows; ++i) {
+        UInt64 key = i * 7;
+        TestMap::LookupResult it;
+        map.lazy_emplace(key, it, map.hash(key),
+                         [&](const auto& ctor, auto& k, auto&) { ctor(k, int64_t(i)); });
+        EXPECT_EQ(map.is_two_level(), i >= 1000);
+    }
+    EXPECT_EQ(map.size(), rows);
+
+    for (size_t i = 0; i < rows; ++i) {
+        UInt64 key = i * 7;
+        auto* found = map.find(key, map.hash(key));
+        ASSERT_NE(found, nullptr);
+        EXPECT_EQ(found->second, int64_t(i));
+        EXPECT_EQ(map.find(key * 7 + 1), nullptr);
+    }
+
+    // insert an existing key does not create a new element
+    TestMap::LookupResult it;
+    bool inserted = true;
+    map.emplace(UInt64(7), it, inserted);
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(it->second, 1);
+    EXPECT_EQ(map.size(), rows);
+}
+
+TEST_F(TwoLevelPHHashMapTest, Iterate) {
+    TestMap map;
+    const size_t rows = 5000;
+    for (size_t i = 0; i < rows; ++i) {
+        map.insert(i, int64_t(i) * 2);
+    }
+    ASSERT_TRUE(map.is_two_level());
+
+    std::set<UInt64> keys;
+    for (auto it = map.begin(); it != map.end(); ++it) {
+        EXPECT_EQ(it->get_second(), int64_t(it->get_first()) * 2);
+        keys.insert(it->get_first());
+    }
+    EXPECT_EQ(keys.size(), rows);
+
+    size_t mapped_count = 0;
+    map.for_each_mapped([&](int64_t& mapped) {
+        EXPECT_EQ(mapped % 2, 0);
+        ++mapped_count;
+    });
+    EXPECT_EQ(mapped_count, rows);
+
+    map.clear_and_shrink();
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.is_two_level());
+    EXPECT_TRUE(map.begin() == map.end());
+}
+
+TEST_F(TwoLevelPHHashMapTest, Disabled) {
+    config::agg_two_level_hash_table_threshold = 0;
+    TestMap map;
+    for (size_t i = 0; i < 5000; ++i) {
+        map.insert(i, int64_t(i));
+    }
+    EXPECT_FALSE(map.is_two_level());
+    EXPECT_EQ(map.size(), 5000);
+}
+
+} // namespace doris::vectorized
@@ -22,16 +22,20 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <random>
 #include <utility>
 
+#include "common/config.h"
 #include "common/object_pool.h"
+#include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "testutil/column_helper.h"
 #include "testutil/mock/mock_descriptors.h"
 #include "testutil/mock/mock_runtime_state.h"
 #include "testutil/mock/mock_slot_ref.h"
+#include "util/threadpool.h"
 #include "vec/common/assert_cast.h"
 #include "vec/common/sort/heap_sorter.h"
 #include "vec/common/sort/sorter.h"
@@ -121,4 +125,53 @@ TEST_F(FullSorterTest, test_full_sorter3) {
     EXPECT_EQ(sorter->_state->get_sorted_block()[1]->rows(), 4);
 }
 
-} // namespace doris::vectorized
\ No newline at end of file
+TEST_F(FullSorterTest, test_full_sorter_parallel_merge) {
+    std::unique_ptr<ThreadPool> thread_pool;
+    EXPECT_TRUE(ThreadPoolBuilder("SortMergeThreadPool")
+                        .set_min_threads(2)
+                        .set_max_threads(2)
+                        .build(&thread_pool)
+                        .ok());
+    ExecEnv::GetInstance()->set_sort_merge_thread_pool(std::move(thread_pool));
+
+    sorter = FullSorter::create_unique(sort_exec_exprs, -1, 0, &pool, is_asc_order, nulls_first,
+                                       *row_desc, nullptr, nullptr);
+    sorter->init_profile(&_profile);
+    std::mt19937 rng(7);
+    const size_t rows_per_block = 100000;
+    for (int i = 0; i < 3; i++) {
+        std::vector<Int64> values;
+        for (size_t j = 0; j < rows_per_block; j++) {
+            // many equal keys, so the splitters are equal to rows of several blocks
+            values.push_back(static_cast<Int64>(rng() % 1000));
+        }
+        Block block = ColumnHelper::create_block<DataTypeInt64>(values);
+        EXPECT_TRUE(sorter->append_block(&block).ok());
+        EXPECT_TRUE(sorter->_do_sort());
+    }
+    EXPECT_TRUE(sorter->prepare_for_read().ok());
+    EXPECT_FALSE(sorter->_state->_merge_ranges.empty());
+
+    size_t rows = 0;
+    Int64 last = std::numeric_limits<Int64>::min();
+    bool eos = false;
+    while (!eos) {
+        Block block;
+        EXPECT_TRUE(sorter->get_next(&_state, &block, &eos).ok());
+        if (block.rows() == 0) {
+            continue;
+        }
+        const auto& column =
+                assert_cast<const ColumnInt64&>(*block.get_by_position(0).column).get_data();
+        for (auto value : column) {
+            EXPECT_LE(last, value);
+            last = value;
+        }
+        rows += block.rows();
+    }
+    EXPECT_EQ(rows, 3 * rows_per_block);
+
+    ExecEnv::GetInstance()->set_sort_merge_thread_pool(nullptr);
+}
+
+} // namespace doris::vectorized
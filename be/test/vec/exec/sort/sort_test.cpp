@@ -25,6 +25,7 @@
 #include <random>
 #include <utility>
 
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "runtime/runtime_state.h"
 #include "testutil/column_helper.h"
@@ -37,6 +38,7 @@
 #include "vec/common/sort/topn_sorter.h"
 #include "vec/common/sort/vsort_exec_exprs.h"
 #include "vec/core/block.h"
+#include "vec/core/sort_block.h"
 #include "vec/exec/format/orc/vorc_reader.h"
 namespace doris::vectorized {
 class SortTest : public testing::Test {
@@ -210,4 +212,40 @@ TEST_F(SortTest, test_sorter) {
     }
 }
 
+TEST_F(SortTest, test_sort_block_by_normalized_keys) {
+    std::mt19937 rng(42);
+    std::vector<Int32> values1;
+    std::vector<UInt8> null_map;
+    std::vector<Int64> values2;
+    for (int i = 0; i < 1000; i++) {
+        values1.push_back(static_cast<Int32>(rng() % 20) - 10);
+        null_map.push_back(rng() % 5 == 0);
+        values2.push_back(static_cast<Int64>(rng() % 1000) - 500);
+    }
+    Block src_block({ColumnHelper::create_nullable_column_with_name<DataTypeInt32>(values1,
+                                                                                    null_map),
+                     ColumnHelper::create_column_with_name<DataTypeInt64>(values2)});
+
+    bool old_config = config::enable_normalized_key_sort_block;
+    for (int direction : {1, -1}) {
+        for (int nulls_direction : {1, -1}) {
+            for (UInt64 limit : {0, 10, 500}) {
+                SortDescription description {{0, direction, nulls_direction},
+                                             {1, -direction, nulls_direction}};
+                Block expected = src_block.clone_without_columns();
+                config::enable_normalized_key_sort_block = false;
+                sort_block(src_block, expected, description, limit);
+
+                Block result = src_block.clone_without_columns();
+                config::enable_normalized_key_sort_block = true;
+                sort_block(src_block, result, description, limit);
+
+                EXPECT_TRUE(ColumnHelper::block_equal(expected, result))
+                        << direction << " " << nulls_direction << " " << limit;
+            }
+        }
+    }
+    config::enable_normalized_key_sort_block = old_config;
+}
+
 } // namespace doris::vectorized
@@ -613,3 +613,18 @@ TEST(TEST_VEXPR, LITERALTEST) {
         EXPECT_EQ("12:00:00.0000", literal.value());
     }
 }
+
+TEST(TEST_VEXPR, LITERAL_EQUALS_TEST) {
+    using namespace doris;
+    using namespace doris::vectorized;
+    VLiteral int_literal(create_literal<TYPE_INT>(1024));
+    VLiteral same_int_literal(create_literal<TYPE_INT>(1024));
+    VLiteral other_int_literal(create_literal<TYPE_INT>(1025));
+    VLiteral bigint_literal(create_literal<TYPE_BIGINT>(1024));
+    VLiteral string_literal(create_literal<TYPE_STRING, std::string>(std::string("1024")));
+
+    EXPECT_TRUE(int_literal.equals(same_int_literal));
+    EXPECT_FALSE(int_literal.equals(other_int_literal));
+    EXPECT_FALSE(int_literal.equals(bigint_literal));
+    EXPECT_FALSE(int_literal.equals(string_literal));
+}
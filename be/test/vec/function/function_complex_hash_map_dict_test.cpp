@@ -20,6 +20,9 @@
 #include <vector>
 
 #include "function_test_util.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/data_types/data_type_string.h"
 #include "vec/functions/complex_hash_map_dictionary.h"
@@ -132,4 +135,47 @@ TEST(ComplexHashMapDictTest, Test1) {
             "dict1");
 }
 
+TEST(ComplexHashMapDictTest, DenseKeys) {
+    auto make_dict = [](std::vector<Int32> keys) {
+        std::vector<Int64> values(keys.begin(), keys.end());
+        auto dict = create_complex_hash_map_dict_from_column(
+                "dict1", {create_column_with_data_and_name<DataTypeInt32>(keys, "key")},
+                {create_column_with_data_and_name<DataTypeInt64>(values, "value")});
+        return std::dynamic_pointer_cast<ComplexHashMapDictionary>(dict);
+    };
+
+    auto dense_dict = make_dict({7, 3, 5, 4});
+    EXPECT_TRUE(dense_dict->_use_dense_layout);
+    EXPECT_EQ(dense_dict->_dense_rows.size(), 5);
+    auto sparse_dict = make_dict({1, 1000, 100000});
+    EXPECT_FALSE(sparse_dict->_use_dense_layout);
+
+    auto key_type = std::make_shared<DataTypeInt32>();
+    auto value_type = std::make_shared<DataTypeInt64>();
+    auto null_map = ColumnUInt8::create();
+    for (UInt8 is_null : {0, 0, 0, 0, 0, 1}) {
+        null_map->insert_value(is_null);
+    }
+    auto nullable_key = ColumnNullable::create(
+            create_column_with_data<DataTypeInt32>({3, 6, 7, -1, 100000, 4}), std::move(null_map));
+    for (const auto& dict : {dense_dict, sparse_dict}) {
+        auto result =
+                dict->get_column("value", value_type, nullable_key->clone(), key_type);
+        const auto& nullable_result = assert_cast<const ColumnNullable&>(*result);
+        const auto& values = assert_cast<const ColumnInt64&>(nullable_result.get_nested_column());
+        for (size_t i = 0; i < 6; ++i) {
+            auto key = assert_cast<const ColumnInt32&>(nullable_key->get_nested_column())
+                               .get_element(i);
+            bool found = !nullable_key->is_null_at(i) &&
+                         (dict == dense_dict ? key == 3 || key == 7 : key == 100000);
+            EXPECT_EQ(nullable_result.is_null_at(i), !found) << i;
+            if (found) {
+                EXPECT_EQ(values.get_element(i), key) << i;
+            }
+        }
+    }
+
+    EXPECT_THROW(make_dict({1, 2, 2}), doris::Exception);
+}
+
 } // namespace doris::vectorized
@@ -156,4 +156,26 @@ TEST(FunctionJsonTEST, JsonExtractTest) {
                                                            data_set));
 }
 
+TEST(FunctionJsonTEST, JsonExtractMultiPathTest) {
+    std::string json_extract_name = "json_extract";
+    InputTypeSet input_types = {PrimitiveType::TYPE_VARCHAR, PrimitiveType::TYPE_VARCHAR,
+                                PrimitiveType::TYPE_VARCHAR};
+
+    // every path is matched against the same parsed document, missing ones are skipped
+    DataSet data_set = {
+            {{STRING(R"({"k1": "v1", "k2": { "k21": 6.6, "k22": [1, 2, 3] } })"),
+              STRING(R"($.k1)"), STRING(R"($.k2.k22[1])")},
+             STRING(R"(["v1",2])")},
+            {{STRING(R"({"k1": "v1", "k2": { "k21": 6.6, "k22": [1, 2, 3] } })"),
+              STRING(R"($.k3)"), STRING(R"($.k2.k21)")},
+             STRING(R"([6.6])")},
+            {{STRING(R"({"k1": "v1"})"), STRING(R"($.k3)"), STRING(R"($.k4)")}, Null()},
+            {{STRING(R"({"k1": )"), STRING(R"($.k1)"), STRING(R"($)")}, Null()},
+            {{Null(), STRING(R"($.k1)"), STRING(R"($.k2)")}, Null()},
+    };
+
+    static_cast<void>(
+            check_function<DataTypeString, true>(json_extract_name, input_types, data_set));
+}
+
 } // namespace doris::vectorized
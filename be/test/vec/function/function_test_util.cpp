@@ -20,6 +20,7 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <iostream>
 
 #include "runtime/jsonb_value.h"
@@ -621,6 +622,40 @@ static Block* process_table_function(TableFunction* fn, Block* input_block,
     return output_block.release();
 }
 
+// runs get_value_batch with small steps, so the results of a row are split over the calls
+static Block* process_table_function_batch(TableFunction* fn, Block* input_block,
+                                           const InputTypeSet& output_types) {
+    ut_type::UTDataTypeDescs descs;
+    if (!parse_ut_data_type(output_types, descs)) {
+        return nullptr;
+    }
+    RuntimeState runtime_state((TQueryGlobals()));
+    if (fn->process_init(input_block, &runtime_state) != Status::OK()) {
+        LOG(WARNING) << "TableFunction process_init failed";
+        return nullptr;
+    }
+    vectorized::MutableColumnPtr column = descs[0].data_type->create_column();
+    if (column->is_nullable()) {
+        fn->set_nullable();
+    }
+
+    const auto num_rows = static_cast<int64_t>(input_block->rows());
+    std::vector<uint32_t> row_indices;
+    int64_t row_idx = 0;
+    if (num_rows > 0) {
+        fn->process_row(0);
+    }
+    while (row_idx < num_rows) {
+        row_idx = fn->get_value_batch(column, row_idx, num_rows, 2, row_indices);
+    }
+    EXPECT_EQ(row_indices.size(), column->size());
+    EXPECT_TRUE(std::is_sorted(row_indices.begin(), row_indices.end()));
+
+    std::unique_ptr<Block> output_block = Block::create_unique();
+    output_block->insert({std::move(column), descs[0].data_type, descs[0].col_name});
+    return output_block.release();
+}
+
 void check_vec_table_function(TableFunction* fn, const InputTypeSet& input_types,
                               const InputDataSet& input_set, const InputTypeSet& output_types,
                               const InputDataSet& output_set, const bool test_get_value_func) {
@@ -636,14 +671,24 @@ void check_vec_table_function(TableFunction* fn, const InputTypeSet& input_types
     EXPECT_TRUE(real_output_block != nullptr);
 
     // compare real_output_block with expect_output_block
-    EXPECT_EQ(expect_output_block->columns(), real_output_block->columns());
-    EXPECT_EQ(expect_output_block->rows(), real_output_block->rows());
-    for (size_t col = 0; col < expect_output_block->columns(); ++col) {
-        auto left_col = expect_output_block->get_by_position(col).column;
-        auto right_col = real_output_block->get_by_position(col).column;
-        for (size_t row = 0; row < expect_output_block->rows(); ++row) {
-            EXPECT_EQ(left_col->compare_at(row, row, *right_col, 0), 0);
+    auto check_output = [&](const Block& real_output_block) {
+        EXPECT_EQ(expect_output_block->columns(), real_output_block.columns());
+        EXPECT_EQ(expect_output_block->rows(), real_output_block.rows());
+        for (size_t col = 0; col < expect_output_block->columns(); ++col) {
+            auto left_col = expect_output_block->get_by_position(col).column;
+            auto right_col = real_output_block.get_by_position(col).column;
+            for (size_t row = 0; row < expect_output_block->rows(); ++row) {
+                EXPECT_EQ(left_col->compare_at(row, row, *right_col, 0), 0);
+            }
         }
+    };
+    check_output(*real_output_block);
+
+    if (fn->support_get_value_batch()) {
+        std::unique_ptr<Block> batch_output_block(
+                process_table_function_batch(fn, input_block.get(), output_types));
+        ASSERT_TRUE(batch_output_block != nullptr);
+        check_output(*batch_output_block);
     }
 }
 
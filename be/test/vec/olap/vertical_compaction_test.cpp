@@ -436,6 +436,50 @@ TEST_F(VerticalCompactionTest, TestRowSourcesBuffer) {
     }
 }
 
+TEST_F(VerticalCompactionTest, TestRowSourcesBufferReaders) {
+    // small enough to stay in memory, and large enough to be spilled in several chunks
+    for (size_t num_rows : {1000, 3 * 1024 * 1024}) {
+        RowSourcesBuffer buffer(102, absolute_dir, ReaderType::READER_BASE_COMPACTION);
+        std::vector<RowSource> row_sources;
+        for (size_t i = 0; i < num_rows; ++i) {
+            row_sources.emplace_back(i % 7, i % 3 == 0);
+            if (row_sources.size() == 4096) {
+                ASSERT_TRUE(buffer.append(row_sources).ok());
+                row_sources.clear();
+            }
+        }
+        ASSERT_TRUE(buffer.append(row_sources).ok());
+        ASSERT_TRUE(buffer.flush().ok());
+        ASSERT_TRUE(buffer.seek_to_begin().ok());
+
+        std::unique_ptr<RowSourcesBuffer> reader1;
+        std::unique_ptr<RowSourcesBuffer> reader2;
+        ASSERT_TRUE(buffer.create_reader(&reader1).ok());
+        ASSERT_TRUE(buffer.create_reader(&reader2).ok());
+        EXPECT_EQ(num_rows, reader1->total_size());
+
+        // the readers and the buffer read on their own positions
+        std::vector<RowSourcesBuffer*> buffers {reader1.get(), &buffer, reader2.get()};
+        std::vector<size_t> rows(buffers.size(), 0);
+        for (size_t round = 0; round < num_rows; ++round) {
+            for (size_t i = 0; i < buffers.size(); ++i) {
+                // the first reader reads two rows for one of the others
+                for (size_t n = 0; n < (i == 0 ? 2 : 1) && rows[i] < num_rows; ++n) {
+                    ASSERT_TRUE(buffers[i]->has_remaining().ok());
+                    auto row_source = buffers[i]->current();
+                    ASSERT_EQ(rows[i] % 7, row_source.get_source_num());
+                    ASSERT_EQ(rows[i] % 3 == 0, row_source.agg_flag());
+                    buffers[i]->advance();
+                    rows[i]++;
+                }
+            }
+        }
+        for (auto* b : buffers) {
+            EXPECT_TRUE(b->has_remaining().is<END_OF_FILE>());
+        }
+    }
+}
+
 TEST_F(VerticalCompactionTest, TestDupKeyVerticalMerge) {
     auto num_input_rowset = 2;
     auto num_segments = 2;
@@ -485,4 +485,59 @@ TEST(SortMergerTest, TEST_SINGLE_STREAM) {
     }
 }
 
-} // namespace doris::vectorized
\ No newline at end of file
+TEST(SortMergerTest, TEST_RUNS_OF_ONE_STREAM) {
+    /**
+     * in: [([1, 2, 3, 10, 11, 12], eos = false), ([], eos = true)]
+     *     [([4, 5, 6, 7, 13, 14], eos = false), ([], eos = true)]
+     *     offset = 2, limit = -1, ASC
+     * out: [3, 4, 5, 6, 7, 10, 11, 12], [13, 14]
+     */
+    std::vector<std::vector<Int64>> inputs = {{1, 2, 3, 10, 11, 12}, {4, 5, 6, 7, 13, 14}};
+    const int batch_size = 100;
+    std::vector<int> round(inputs.size(), 0);
+
+    std::unique_ptr<VSortedRunMerger> merger;
+    auto profile = std::make_shared<RuntimeProfile>("");
+    auto ordering_expr = MockSlotRef::create_mock_contexts(std::make_shared<DataTypeInt64>());
+    {
+        std::vector<bool> is_asc_order = {true};
+        std::vector<bool> nulls_first = {false};
+        const int limit = -1;
+        const int offset = 2;
+        merger.reset(new VSortedRunMerger(ordering_expr, is_asc_order, nulls_first, batch_size,
+                                          limit, offset, profile.get()));
+    }
+    {
+        std::vector<vectorized::BlockSupplier> child_block_suppliers;
+        for (int child_idx = 0; child_idx < inputs.size(); child_idx++) {
+            vectorized::BlockSupplier block_supplier = [&, id = child_idx](vectorized::Block* block,
+                                                                         bool* eos) {
+                *eos = ++round[id] == 2;
+                if (!*eos) {
+                    *block = ColumnHelper::create_block<DataTypeInt64>(inputs[id]);
+                }
+                return Status::OK();
+            };
+            child_block_suppliers.push_back(block_supplier);
+        }
+        EXPECT_TRUE(merger->prepare(child_block_suppliers).ok());
+    }
+    {
+        vectorized::Block block;
+        bool eos = false;
+        EXPECT_TRUE(merger->get_next(&block, &eos).ok());
+        EXPECT_TRUE(ColumnHelper::column_equal(
+                block.get_by_position(0).column,
+                ColumnHelper::create_column<DataTypeInt64>({3, 4, 5, 6, 7, 10, 11, 12})));
+        EXPECT_FALSE(eos);
+    }
+    {
+        vectorized::Block block;
+        bool eos = false;
+        EXPECT_TRUE(merger->get_next(&block, &eos).ok());
+        EXPECT_TRUE(ColumnHelper::column_equal(block.get_by_position(0).column,
+                                               ColumnHelper::create_column<DataTypeInt64>({13, 14})));
+    }
+}
+
+} // namespace doris::vectorized
@@ -878,4 +878,59 @@ TEST(VDateTimeValueTest, datetime_diff_test) {
     }
 }
 
+TEST(VDateTimeValueTest, datetime_v2_from_iso_date_str_test) {
+    {
+        DateV2Value<DateTimeV2ValueType> value;
+        std::string str = "2022-05-24 23:50:50";
+        EXPECT_TRUE(value.from_date_str(str.data(), (int)str.size()));
+        EXPECT_EQ(value.year(), 2022);
+        EXPECT_EQ(value.month(), 5);
+        EXPECT_EQ(value.day(), 24);
+        EXPECT_EQ(value.hour(), 23);
+        EXPECT_EQ(value.minute(), 50);
+        EXPECT_EQ(value.second(), 50);
+        EXPECT_EQ(value.microsecond(), 0);
+    }
+    {
+        DateV2Value<DateTimeV2ValueType> value;
+        std::string str = "2022-05-24T01:02:03";
+        EXPECT_TRUE(value.from_date_str(str.data(), (int)str.size()));
+        EXPECT_EQ(value.hour(), 1);
+        EXPECT_EQ(value.minute(), 2);
+        EXPECT_EQ(value.second(), 3);
+    }
+    {
+        DateV2Value<DateV2ValueType> value;
+        std::string str = "2022-05-24";
+        EXPECT_TRUE(value.from_date_str(str.data(), (int)str.size()));
+        EXPECT_EQ(value.year(), 2022);
+        EXPECT_EQ(value.month(), 5);
+        EXPECT_EQ(value.day(), 24);
+    }
+    {
+        // invalid values keep failing on the fast path
+        DateV2Value<DateTimeV2ValueType> value;
+        for (std::string str : {"2022-02-30", "2022-13-01", "2022-05-24 24:00:00",
+                                "2022-05-24 23:60:00", "0000-00-00"}) {
+            EXPECT_FALSE(value.from_date_str(str.data(), (int)str.size())) << str;
+        }
+        std::string zero = "0000-00-00";
+        EXPECT_TRUE(value.from_date_str(zero.data(), (int)zero.size(), -1, true));
+        EXPECT_EQ(value.month(), 1);
+        EXPECT_EQ(value.day(), 1);
+    }
+    {
+        // other layouts still go through the generic parser
+        DateV2Value<DateTimeV2ValueType> value;
+        std::string str = "2022-5-24 3:50:50";
+        EXPECT_TRUE(value.from_date_str(str.data(), (int)str.size()));
+        EXPECT_EQ(value.month(), 5);
+        EXPECT_EQ(value.hour(), 3);
+        std::string compact = "20220524235050";
+        EXPECT_TRUE(value.from_date_str(compact.data(), (int)compact.size()));
+        EXPECT_EQ(value.day(), 24);
+        EXPECT_EQ(value.second(), 50);
+    }
+}
+
 } // namespace doris::vectorized
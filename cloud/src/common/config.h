@@ -89,6 +89,9 @@ CONF_Strings(recycle_whitelist, ""); // Comma seprated list
 CONF_Strings(recycle_blacklist, ""); // Comma seprated list
 // IO worker thread pool concurrency: object list, delete
 CONF_mInt32(instance_recycler_worker_pool_size, "32");
+// Whether to issue the batches of one `delete_objects` call concurrently in the
+// worker pool instead of one after another
+CONF_mBool(enable_concurrent_delete_objects_batches, "false");
 // The worker pool size for http api `statistics_recycle` worker pool
 CONF_mInt32(instance_recycler_statistics_recycle_worker_pool_size, "5");
 CONF_Bool(enable_checker, "false");
@@ -155,6 +158,9 @@ CONF_Int64(default_max_qps_limit, "1000000");
 CONF_String(specific_max_qps_limit, "get_cluster:5000000;begin_txn:5000000");
 CONF_Bool(enable_rate_limit, "true");
 CONF_Int64(bvar_qps_update_second, "5");
+// limit the kv bytes read per second by each warehouse each rpc, 0 means no limit.
+// Expensive rpcs (e.g. range scans) drain the budget faster than cheap gets.
+CONF_mInt64(max_rpc_read_bytes_per_second, "0");
 
 CONF_mInt32(copy_job_max_retention_second, "259200"); //3 * 24 * 3600 seconds
 CONF_String(arn_id, "");
@@ -178,6 +184,11 @@ CONF_mInt16(meta_schema_value_version, "1");
 CONF_mInt32(schema_dict_kv_size_limit, "5242880");
 // Limit the count of columns in schema dict value, default 4K
 CONF_mInt32(schema_dict_key_count_limit, "4096");
+// Whether to cache parsed schema kvs in memory. A schema kv is never overwritten
+// once written, so a cached schema can not be stale.
+CONF_mBool(enable_schema_kv_cache, "false");
+// Max number of schemas kept in the schema kv cache
+CONF_mInt64(schema_kv_cache_capacity, "10000");
 
 // For instance check interval
 CONF_Int64(reserved_buffer_days, "3");
@@ -279,6 +290,9 @@ CONF_Bool(enable_cloud_txn_lazy_commit, "true");
 CONF_Int32(txn_lazy_commit_rowsets_thresold, "1000");
 CONF_Int32(txn_lazy_commit_num_threads, "8");
 CONF_Int32(txn_lazy_max_rowsets_per_batch, "1000");
+// The number of threads committing the partitions of one lazy commit txn concurrently,
+// partitions are committed one by one if it is not greater than 1
+CONF_Int32(txn_lazy_commit_partition_parallelism, "1");
 // max TabletIndexPB num for batch get
 CONF_Int32(max_tablet_index_num_per_batch, "1000");
 
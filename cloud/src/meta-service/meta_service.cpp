@@ -720,6 +720,9 @@ void internal_get_tablet(MetaServiceCode& code, std::string& msg, const std::str
         }
         auto key = meta_schema_key(
                 {instance_id, tablet_meta->index_id(), tablet_meta->schema_version()});
+        if (get_cached_schema(key, tablet_meta->mutable_schema())) {
+            return;
+        }
         ValueBuf val_buf;
         err = cloud::blob_get(txn, key, &val_buf);
         if (err != TxnErrorCode::TXN_OK) {
@@ -734,6 +737,7 @@ void internal_get_tablet(MetaServiceCode& code, std::string& msg, const std::str
             msg = fmt::format("malformed schema value, key={}", key);
             return;
         }
+        cache_schema(key, tablet_meta->schema());
     }
 }
 
@@ -1676,6 +1680,9 @@ std::vector<std::pair<int64_t, int64_t>> calc_sync_versions(int64_t req_bc_cnt,
 static bool try_fetch_and_parse_schema(Transaction* txn, RowsetMetaCloudPB& rowset_meta,
                                        const std::string& key, MetaServiceCode& code,
                                        std::string& msg) {
+    if (get_cached_schema(key, rowset_meta.mutable_tablet_schema())) {
+        return true;
+    }
     ValueBuf val_buf;
     TxnErrorCode err = cloud::blob_get(txn, key, &val_buf);
     if (err != TxnErrorCode::TXN_OK) {
@@ -1691,6 +1698,7 @@ static bool try_fetch_and_parse_schema(Transaction* txn, RowsetMetaCloudPB& rows
         msg = fmt::format("malformed schema value, key={}", key);
         return false;
     }
+    cache_schema(key, *schema);
     return true;
 }
 
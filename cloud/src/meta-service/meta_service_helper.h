@@ -289,6 +289,11 @@ inline MetaServiceCode cast_as(TxnErrorCode code) {
             if (!drop_request) {                                                              \
                 g_bvar_ms_##func_name.put(instance_id, sw.elapsed_us());                      \
             }                                                                                 \
+            if (config::enable_rate_limit && config::max_rpc_read_bytes_per_second > 0) {     \
+                if (auto limiter = rate_limiter_->get_rpc_rate_limiter(#func_name)) {         \
+                    limiter->consume_read_bytes(instance_id, stats.get_bytes);                \
+                }                                                                             \
+            }                                                                                 \
             GET_RPCKVCOUNT_MACRO(_0, ##__VA_ARGS__, RPCKVCOUNT_3, RPCKVCOUNT_2, RPCKVCOUNT_1, \
                                  RPCKVCOUNT_0)                                                \
             (func_name, ##__VA_ARGS__)                                                        \
@@ -308,6 +313,12 @@ inline MetaServiceCode cast_as(TxnErrorCode code) {
             msg = "reach max qps limit";                                                     \
             return;                                                                          \
         }                                                                                    \
+        if (!rate_limiter->get_read_bytes_token(instance_id)) {                              \
+            drop_request = true;                                                             \
+            code = MetaServiceCode::MAX_QPS_LIMIT;                                           \
+            msg = "reach max read bytes limit";                                              \
+            return;                                                                          \
+        }                                                                                    \
     }
 
 // FIXME(gavin): should it be a member function of ResourceManager?
@@ -26,7 +26,11 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <type_traits>
+#include <unordered_map>
 
 #include "common/config.h"
 #include "common/logging.h"
@@ -131,6 +135,71 @@ bool parse_schema_value(const ValueBuf& buf, doris::TabletSchemaCloudPB* schema)
     // TODO(plat1ko): Apply decompression based on value version
     return buf.to_pb(schema);
 }
+
+namespace {
+// LRU cache of parsed schema kvs. Schema kvs are immutable once written (see `put_schema_kv`),
+// so entries never need to be invalidated, only evicted.
+class SchemaKVCache {
+public:
+    static SchemaKVCache& instance() {
+        static SchemaKVCache cache;
+        return cache;
+    }
+
+    std::shared_ptr<const doris::TabletSchemaCloudPB> get(std::string_view key) {
+        std::lock_guard lock(mutex_);
+        auto it = map_.find(std::string(key));
+        if (it == map_.end()) {
+            return nullptr;
+        }
+        lru_.splice(lru_.begin(), lru_, it->second);
+        return it->second->second;
+    }
+
+    void put(std::string_view key, std::shared_ptr<const doris::TabletSchemaCloudPB> schema) {
+        std::lock_guard lock(mutex_);
+        std::string k(key);
+        if (auto it = map_.find(k); it != map_.end()) {
+            lru_.splice(lru_.begin(), lru_, it->second);
+            return;
+        }
+        lru_.emplace_front(k, std::move(schema));
+        map_.emplace(std::move(k), lru_.begin());
+        auto capacity = std::max<int64_t>(config::schema_kv_cache_capacity, 1);
+        while (static_cast<int64_t>(lru_.size()) > capacity) {
+            map_.erase(lru_.back().first);
+            lru_.pop_back();
+        }
+    }
+
+private:
+    using Entry = std::pair<std::string, std::shared_ptr<const doris::TabletSchemaCloudPB>>;
+
+    std::mutex mutex_;
+    std::list<Entry> lru_;
+    std::unordered_map<std::string, std::list<Entry>::iterator> map_;
+};
+} // namespace
+
+bool get_cached_schema(std::string_view schema_key, doris::TabletSchemaCloudPB* schema) {
+    if (!config::enable_schema_kv_cache) {
+        return false;
+    }
+    auto cached = SchemaKVCache::instance().get(schema_key);
+    if (cached == nullptr) {
+        return false;
+    }
+    schema->CopyFrom(*cached);
+    return true;
+}
+
+void cache_schema(std::string_view schema_key, const doris::TabletSchemaCloudPB& schema) {
+    if (!config::enable_schema_kv_cache) {
+        return;
+    }
+    SchemaKVCache::instance().put(schema_key,
+                                  std::make_shared<const doris::TabletSchemaCloudPB>(schema));
+}
 /**
  * Processes dictionary items, mapping them to a dictionary key and adding the key to rowset meta.
  * If it's a new item, generates a new key and increments the item ID. This function is also responsible
@@ -20,6 +20,8 @@
 #include <gen_cpp/cloud.pb.h>
 #include <gen_cpp/olap_file.pb.h>
 
+#include <string_view>
+
 namespace doris::cloud {
 class Transaction;
 struct ValueBuf;
@@ -30,6 +32,13 @@ void put_schema_kv(MetaServiceCode& code, std::string& msg, Transaction* txn,
 // Return true if parse success
 [[nodiscard]] bool parse_schema_value(const ValueBuf& buf, doris::TabletSchemaCloudPB* schema);
 
+// Lookup the schema of `schema_key` in the in-process schema kv cache, return true if found
+[[nodiscard]] bool get_cached_schema(std::string_view schema_key,
+                                     doris::TabletSchemaCloudPB* schema);
+
+// Add a schema which has been read from `schema_key` to the in-process schema kv cache
+void cache_schema(std::string_view schema_key, const doris::TabletSchemaCloudPB& schema);
+
 // Writes schema dictionary metadata to RowsetMetaCloudPB
 void write_schema_dict(MetaServiceCode& code, std::string& msg, const std::string& instance_id,
                        Transaction* txn, RowsetMetaCloudPB* rowset_meta);
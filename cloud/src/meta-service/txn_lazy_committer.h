@@ -20,6 +20,10 @@
 #include <gen_cpp/cloud.pb.h>
 
 #include <atomic>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "common/simple_thread_pool.h"
 #include "meta-store/txn_kv.h"
@@ -39,6 +43,19 @@ public:
 private:
     friend class TxnLazyCommitter;
 
+    // Convert the tmp rowsets of the partitions and advance their versions, in parallel if
+    // the committer has a partition pool
+    void commit_partitions(
+            int64_t db_id,
+            std::unordered_map<int64_t,
+                               std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>>&
+                    partition_to_tmp_rowset_metas);
+    void commit_partition(
+            int64_t db_id, int64_t partition_id,
+            const std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>& tmp_rowset_metas,
+            std::unordered_map<int64_t, TabletIndexPB>& tablet_ids, MetaServiceCode& code,
+            std::string& msg);
+
     std::string instance_id_;
     int64_t txn_id_;
     std::shared_ptr<TxnKv> txn_kv_;
@@ -57,9 +74,13 @@ public:
     void remove(int64_t txn_id);
 
 private:
+    friend class TxnLazyCommitTask;
+
     std::shared_ptr<TxnKv> txn_kv_;
 
     std::unique_ptr<SimpleThreadPool> worker_pool_;
+    // Commits the partitions of one txn concurrently, nullptr if disabled
+    std::unique_ptr<SimpleThreadPool> partition_pool_;
 
     std::mutex mutex_;
     // <txn_id, TxnLazyCommitTask>
@@ -48,7 +48,7 @@ TxnErrorCode MemTxnKv::create_txn(std::unique_ptr<Transaction>* txn) {
 }
 
 TxnErrorCode MemTxnKv::get_kv(const std::string& key, std::string* val, int64_t version) {
-    std::lock_guard<std::mutex> l(lock_);
+    std::shared_lock l(lock_);
     auto it = mem_kv_.find(key);
     if (it == mem_kv_.end() || it->second.empty()) {
         return TxnErrorCode::TXN_KEY_NOT_FOUND;
@@ -83,7 +83,7 @@ TxnErrorCode MemTxnKv::get_kv(const std::string& begin, const std::string& end,
         use_limit = false;
     }
 
-    std::unique_lock<std::mutex> l(lock_);
+    std::shared_lock l(lock_);
 
     auto apply_key_selector = [&](RangeKeySelector selector,
                                   const std::string& key) -> decltype(mem_kv_.lower_bound(key)) {
@@ -189,14 +189,13 @@ TxnErrorCode MemTxnKv::get_kv(const std::string& begin, const std::string& end,
 TxnErrorCode MemTxnKv::update(const std::set<std::string>& read_set,
                               const std::vector<OpTuple>& op_list, int64_t read_version,
                               int64_t* committed_version) {
-    std::lock_guard<std::mutex> l(lock_);
+    std::unique_lock l(lock_);
 
     // check_conflict
     for (const auto& k : read_set) {
-        auto iter = log_kv_.find(k);
-        if (iter != log_kv_.end()) {
-            auto log_item = iter->second;
-            if (log_item.front().commit_version_ > read_version) {
+        auto iter = last_modified_version_.find(k);
+        if (iter != last_modified_version_.end()) {
+            if (iter->second > read_version) {
                 LOG(WARNING) << "commit conflict";
                 //keep the same behaviour with fdb.
                 return TxnErrorCode::TXN_CONFLICT;
@@ -209,8 +208,7 @@ TxnErrorCode MemTxnKv::update(const std::set<std::string>& read_set,
     int16_t seq = 0;
     for (const auto& vec : op_list) {
         const auto& [op_type, k, v] = vec;
-        LogItem log_item {op_type, committed_version_, k, v};
-        log_kv_[k].push_front(log_item);
+        last_modified_version_[k] = committed_version_;
         switch (op_type) {
         case memkv::ModifyOpType::PUT: {
             mem_kv_[k].push_front(Version {committed_version_, v});
@@ -300,12 +298,12 @@ int MemTxnKv::gen_version_timestamp(int64_t ver, int16_t seq, std::string* str)
 }
 
 int64_t MemTxnKv::get_last_commited_version() {
-    std::lock_guard<std::mutex> l(lock_);
+    std::shared_lock l(lock_);
     return committed_version_;
 }
 
 int64_t MemTxnKv::get_last_read_version() {
-    std::lock_guard<std::mutex> l(lock_);
+    std::unique_lock l(lock_);
     read_version_ = committed_version_;
     return read_version_;
 }
@@ -326,7 +324,7 @@ namespace doris::cloud::memkv {
 
 Transaction::Transaction(std::shared_ptr<MemTxnKv> kv) : kv_(std::move(kv)) {
     std::lock_guard<std::mutex> l(lock_);
-    read_version_ = kv_->committed_version_;
+    read_version_ = kv_->get_last_commited_version();
 }
 
 int Transaction::init() {
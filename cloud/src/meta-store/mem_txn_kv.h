@@ -26,6 +26,7 @@
 #include <numeric>
 #include <optional>
 #include <set>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -61,7 +62,7 @@ public:
                         std::vector<std::pair<std::string, std::string>>* kv_list);
 
     size_t total_kvs() const {
-        std::lock_guard<std::mutex> l(lock_);
+        std::shared_lock l(lock_);
         return mem_kv_.size();
     }
 
@@ -84,28 +85,17 @@ private:
 
     static int gen_version_timestamp(int64_t ver, int16_t seq, std::string* str);
 
-    struct LogItem {
-        memkv::ModifyOpType op_;
-        int64_t commit_version_;
-
-        // for get's op: key=key, value=""
-        // for range get's op: key=begin, value=end
-        // for atomic_set_ver_key/atomic_set_ver_value's op: key=key, value=value
-        // for atomic_add's op: key=key, value=to_add
-        // for remove's op: key=key, value=""
-        // for range remove's op: key=begin, value=end
-        std::string key;
-        std::string value;
-    };
-
     struct Version {
         int64_t commit_version;
         std::optional<std::string> value;
     };
 
     std::map<std::string, std::list<Version>> mem_kv_;
-    std::unordered_map<std::string, std::list<LogItem>> log_kv_;
-    mutable std::mutex lock_;
+    // key -> the version of the last commit which modified it, for conflict detection.
+    // for range remove's op: key=begin
+    std::unordered_map<std::string, int64_t> last_modified_version_;
+    // Readers share the lock, only commits take it exclusively
+    mutable std::shared_mutex lock_;
     int64_t committed_version_ = 0;
     int64_t read_version_ = 0;
 };
@@ -205,4 +205,66 @@ void RpcRateLimiter::QpsToken::set_max_qps_limit(int64_t max_qps_limit) {
     max_qps_limit_ = max_qps_limit;
 }
 
+bool RpcRateLimiter::get_read_bytes_token(const std::string& instance_id) {
+    int64_t max_bytes_per_second = config::max_rpc_read_bytes_per_second;
+    if (max_bytes_per_second <= 0 || instance_id.empty()) {
+        return true;
+    }
+    std::shared_ptr<ReadBytesToken> token;
+    {
+        std::lock_guard<bthread::Mutex> l(mutex_);
+        auto it = read_bytes_limiter_.find(instance_id);
+        // new instance always can get token
+        if (it == read_bytes_limiter_.end()) {
+            read_bytes_limiter_[instance_id] = std::make_shared<ReadBytesToken>();
+            return true;
+        }
+        token = it->second;
+    }
+    return token->get_token(max_bytes_per_second);
+}
+
+void RpcRateLimiter::consume_read_bytes(const std::string& instance_id, int64_t read_bytes) {
+    if (config::max_rpc_read_bytes_per_second <= 0 || instance_id.empty() || read_bytes <= 0) {
+        return;
+    }
+    std::shared_ptr<ReadBytesToken> token;
+    {
+        std::lock_guard<bthread::Mutex> l(mutex_);
+        auto& t = read_bytes_limiter_[instance_id];
+        if (t == nullptr) {
+            t = std::make_shared<ReadBytesToken>();
+        }
+        token = t;
+    }
+    token->consume(read_bytes);
+}
+
+void RpcRateLimiter::ReadBytesToken::refill(int64_t max_bytes_per_second,
+                                            std::chrono::steady_clock::time_point now) {
+    using namespace std::chrono;
+    auto capacity = static_cast<double>(max_bytes_per_second);
+    if (!initialized_) {
+        initialized_ = true;
+        available_bytes_ += capacity;
+    } else {
+        double elapsed_s = duration_cast<duration<double>>(now - last_refill_time_).count();
+        available_bytes_ += elapsed_s * capacity;
+    }
+    available_bytes_ = std::min(available_bytes_, capacity);
+    last_refill_time_ = now;
+}
+
+bool RpcRateLimiter::ReadBytesToken::get_token(int64_t max_bytes_per_second) {
+    auto now = std::chrono::steady_clock::now();
+    std::lock_guard<bthread::Mutex> l(mutex_);
+    refill(max_bytes_per_second, now);
+    return available_bytes_ > 0;
+}
+
+void RpcRateLimiter::ReadBytesToken::consume(int64_t read_bytes) {
+    std::lock_guard<bthread::Mutex> l(mutex_);
+    available_bytes_ -= static_cast<double>(read_bytes);
+}
+
 } // namespace doris::cloud
@@ -21,6 +21,7 @@
 #include <bthread/mutex.h>
 #include <google/protobuf/service.h>
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <shared_mutex>
@@ -103,6 +104,21 @@ public:
      */
     bool get_qps_token(const std::string& instance_id, std::function<int()>& get_bvar_qps);
 
+    /**
+     * @brief Whether the instance still has read bytes budget, see `max_rpc_read_bytes_per_second`
+     *
+     * @param instance_id
+     */
+    bool get_read_bytes_token(const std::string& instance_id);
+
+    /**
+     * @brief Charge the kv bytes read by a finished rpc to the instance's read bytes budget
+     *
+     * @param instance_id
+     * @param read_bytes
+     */
+    void consume_read_bytes(const std::string& instance_id, int64_t read_bytes);
+
     std::string_view rpc_name() const { return rpc_name_; }
 
     int64_t max_qps_limit() const { return max_qps_limit_; }
@@ -139,6 +155,24 @@ public:
         int64_t max_qps_limit_;
     };
 
+    // A token bucket of read bytes, refilled at `max_rpc_read_bytes_per_second`. The cost of
+    // an rpc is only known after it finishes, so the bucket may go into debt and rejects rpcs
+    // until it is refilled.
+    class ReadBytesToken {
+    public:
+        bool get_token(int64_t max_bytes_per_second);
+
+        void consume(int64_t read_bytes);
+
+    private:
+        void refill(int64_t max_bytes_per_second, std::chrono::steady_clock::time_point now);
+
+        bthread::Mutex mutex_;
+        std::chrono::steady_clock::time_point last_refill_time_ {std::chrono::steady_clock::now()};
+        double available_bytes_ {0};
+        bool initialized_ {false};
+    };
+
     void for_each_qps_token(std::function<void(std::string_view, std::shared_ptr<QpsToken>)> cb);
 
     // Todo: Recycle outdated instance_id
@@ -149,6 +183,8 @@ private:
     std::unordered_map<std::string, std::shared_ptr<QpsToken>> qps_limiter_;
     // instance ids which specific limit have been set
     std::unordered_set<std::string> instance_with_specific_limit_;
+    // instance_id -> ReadBytesToken
+    std::unordered_map<std::string, std::shared_ptr<ReadBytesToken>> read_bytes_limiter_;
     std::string rpc_name_;
     int64_t max_qps_limit_;
 };
@@ -54,7 +54,8 @@ ObjectStorageResponse ObjStorageClient::delete_objects_recursively_(ObjectStorag
             continue;
         }
         concurrent_delete_executor.add([this, &path, k = std::move(keys), option]() mutable {
-            return delete_objects(path.bucket, std::move(k), option).ret;
+            // Already running in `option.executor`, don't fan out into it again
+            return delete_objects(path.bucket, std::move(k), {.prefetch = option.prefetch}).ret;
         });
     }
 
@@ -66,7 +67,8 @@ ObjectStorageResponse ObjStorageClient::delete_objects_recursively_(ObjectStorag
 
     if (!keys.empty()) {
         concurrent_delete_executor.add([this, &path, k = std::move(keys), option]() mutable {
-            return delete_objects(path.bucket, std::move(k), option).ret;
+            // Already running in `option.executor`, don't fan out into it again
+            return delete_objects(path.bucket, std::move(k), {.prefetch = option.prefetch}).ret;
         });
     }
     bool finished = true;
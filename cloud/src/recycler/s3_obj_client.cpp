@@ -26,6 +26,7 @@
 #include <aws/s3/model/ListObjectsV2Request.h>
 #include <aws/s3/model/PutObjectRequest.h>
 
+#include <algorithm>
 #include <ranges>
 
 #include "common/config.h"
@@ -34,6 +35,7 @@
 #include "cpp/s3_rate_limiter.h"
 #include "cpp/sync_point.h"
 #include "recycler/s3_accessor.h"
+#include "recycler/sync_executor.h"
 #include "recycler/util.h"
 
 namespace doris::cloud {
@@ -220,15 +222,14 @@ ObjectStorageResponse S3ObjClient::delete_objects(const std::string& bucket,
         return {0};
     }
 
-    Aws::S3::Model::DeleteObjectsRequest delete_request;
-    delete_request.SetBucket(bucket);
-
-    auto issue_delete = [&bucket, &delete_request,
+    auto issue_delete = [&bucket,
                          this](std::vector<Aws::S3::Model::ObjectIdentifier> objects) -> int {
         if (objects.size() == 1) {
             return delete_object({.bucket = bucket, .key = objects[0].GetKey()}).ret;
         }
 
+        Aws::S3::Model::DeleteObjectsRequest delete_request;
+        delete_request.SetBucket(bucket);
         Aws::S3::Model::Delete del;
         del.WithObjects(std::move(objects)).SetQuiet(true);
         delete_request.SetDelete(std::move(del));
@@ -247,27 +248,48 @@ ObjectStorageResponse S3ObjClient::delete_objects(const std::string& bucket,
             return -1;
         }
 
-        if (!delete_outcome.IsSuccess()) {
-            LOG_WARNING("failed to delete objects")
-                    .tag("endpoint", endpoint_)
-                    .tag("bucket", bucket)
-                    .tag("key[0]", delete_request.GetDelete().GetObjects().front().GetKey())
-                    .tag("responseCode",
-                         static_cast<int>(delete_outcome.GetError().GetResponseCode()))
-                    .tag("error", delete_outcome.GetError().GetMessage());
-            return -1;
-        }
-
         return 0;
     };
 
+    size_t delete_batch_size = MaxDeleteBatch;
+    TEST_INJECTION_POINT_CALLBACK("S3ObjClient::delete_objects", &delete_batch_size);
+
+    // Throttling (503 SlowDown) is retried with backoff by `S3CustomRetryStrategy`, so
+    // the batches only need to be spread over the worker pool here.
+    if (config::enable_concurrent_delete_objects_batches && option.executor != nullptr &&
+        keys.size() > delete_batch_size) {
+        SyncExecutor<int> concurrent_delete_executor(
+                option.executor,
+                fmt::format("delete {} objects under bucket {}", keys.size(), bucket),
+                [](const int& ret) { return ret != 0; });
+        std::vector<Aws::S3::Model::ObjectIdentifier> objects;
+        for (auto&& key : keys) {
+            objects.emplace_back().SetKey(std::move(key));
+            if (objects.size() < delete_batch_size) {
+                continue;
+            }
+            concurrent_delete_executor.add([&issue_delete, o = std::move(objects)]() mutable {
+                return issue_delete(std::move(o));
+            });
+            objects.clear();
+        }
+        if (!objects.empty()) {
+            concurrent_delete_executor.add([&issue_delete, o = std::move(objects)]() mutable {
+                return issue_delete(std::move(o));
+            });
+        }
+        bool finished = true;
+        std::vector<int> rets = concurrent_delete_executor.when_all(&finished);
+        if (!finished || std::ranges::any_of(rets, [](int r) { return r != 0; })) {
+            return {-1};
+        }
+        return {0};
+    }
+
     int ret = 0;
     // `DeleteObjectsRequest` can only contain 1000 keys at most.
     std::vector<Aws::S3::Model::ObjectIdentifier> objects;
 
-    size_t delete_batch_size = MaxDeleteBatch;
-    TEST_INJECTION_POINT_CALLBACK("S3ObjClient::delete_objects", &delete_batch_size);
-
     // std::views::chunk(1000)
     for (auto&& key : keys) {
         objects.emplace_back().SetKey(std::move(key));
@@ -212,6 +212,30 @@ TEST(RateLimiterTest, AdjustLimitInfluenceTest) {
     }
 }
 
+TEST(RateLimiterTest, ReadBytesLimitTest) {
+    config::max_rpc_read_bytes_per_second = 1000;
+    std::unique_ptr<int, std::function<void(int*)>> defer(
+            (int*)0x01, [](int*) { config::max_rpc_read_bytes_per_second = 0; });
+
+    RpcRateLimiter limiter("get_rowset", 1000000);
+    ASSERT_TRUE(limiter.get_read_bytes_token(mock_instance_0));
+    ASSERT_TRUE(limiter.get_read_bytes_token(mock_instance_1));
+
+    // One expensive rpc drains the budget of its instance only
+    limiter.consume_read_bytes(mock_instance_0, 1500);
+    ASSERT_FALSE(limiter.get_read_bytes_token(mock_instance_0));
+    ASSERT_TRUE(limiter.get_read_bytes_token(mock_instance_1));
+
+    // The budget is refilled over time
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    ASSERT_TRUE(limiter.get_read_bytes_token(mock_instance_0));
+
+    // No limit
+    config::max_rpc_read_bytes_per_second = 0;
+    limiter.consume_read_bytes(mock_instance_1, 1L << 40);
+    ASSERT_TRUE(limiter.get_read_bytes_token(mock_instance_1));
+}
+
 TEST(RateLimiterTest, TestAdjustLimitInfluence1) {
     auto meta_service = get_meta_service();
     mock_add_cluster(*meta_service, mock_instance_0);
@@ -27,6 +27,7 @@
 #include "common/defer.h"
 #include "cpp/sync_point.h"
 #include "meta-service/meta_service.h"
+#include "meta-store/blob_message.h"
 #include "meta-store/keys.h"
 #include "meta-store/txn_kv.h"
 #include "meta-store/txn_kv_error.h"
@@ -697,6 +698,48 @@ TEST(SchemaKVTest, InsertExistedRowsetTest) {
     check_get_tablet(meta_service.get(), 10005, 2);
 }
 
+TEST(SchemaKVTest, SchemaKVCacheTest) {
+    auto meta_service = get_meta_service();
+
+    auto sp = SyncPoint::get_instance();
+    DORIS_CLOUD_DEFER {
+        SyncPoint::get_instance()->clear_all_call_backs();
+    };
+    sp->set_call_back("get_instance_id", [&](auto&& args) {
+        auto* ret = try_any_cast_ret<std::string>(args);
+        ret->first = instance_id;
+        ret->second = true;
+    });
+    sp->enable_processing();
+
+    config::enable_schema_kv_cache = true;
+    DORIS_CLOUD_DEFER {
+        config::enable_schema_kv_cache = false;
+    };
+
+    constexpr auto table_id = 20001, index_id = 20002, partition_id = 20003, tablet_id = 20004;
+    ASSERT_NO_FATAL_FAILURE(create_tablet(meta_service.get(), table_id, index_id, partition_id,
+                                          tablet_id, next_rowset_id(), 3));
+    check_get_tablet(meta_service.get(), tablet_id, 3);
+
+    // Remove the schema kv, the following reads must be served by the cache
+    std::unique_ptr<Transaction> txn;
+    ASSERT_EQ(meta_service->txn_kv()->create_txn(&txn), TxnErrorCode::TXN_OK);
+    ValueBuf val_buf;
+    ASSERT_EQ(cloud::blob_get(txn.get(), meta_schema_key({instance_id, index_id, 3}), &val_buf),
+              TxnErrorCode::TXN_OK);
+    val_buf.remove(txn.get());
+    ASSERT_EQ(txn->commit(), TxnErrorCode::TXN_OK);
+
+    check_get_tablet(meta_service.get(), tablet_id, 3);
+    GetRowsetResponse res;
+    ASSERT_NO_FATAL_FAILURE(
+            get_rowset(meta_service.get(), table_id, index_id, partition_id, tablet_id, res));
+    ASSERT_EQ(res.rowset_meta_size(), 1);
+    EXPECT_EQ(res.rowset_meta(0).tablet_schema().schema_version(), 3);
+    EXPECT_EQ(res.rowset_meta(0).tablet_schema().column_size(), 10);
+}
+
 static void check_schema(MetaServiceProxy* meta_service, int64_t tablet_id,
                          int32_t schema_version) {
     brpc::Controller cntl;